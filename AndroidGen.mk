@@ -12,6 +12,7 @@ LOCAL_SRC_FILES := \
 	execserver/xsTestProcess.cpp \
 	executor/xeBatchExecutor.cpp \
 	executor/xeBatchResult.cpp \
+	executor/xeBinaryLogParser.cpp \
 	executor/xeCallQueue.cpp \
 	executor/xeCommLink.cpp \
 	executor/xeContainerFormatParser.cpp \
@@ -19,10 +20,12 @@ LOCAL_SRC_FILES := \
 	executor/xeLocalTcpIpLink.cpp \
 	executor/xeTcpIpLink.cpp \
 	executor/xeTestCase.cpp \
+	executor/xeTestCaseIndex.cpp \
 	executor/xeTestCaseListParser.cpp \
 	executor/xeTestCaseResult.cpp \
 	executor/xeTestLogParser.cpp \
 	executor/xeTestLogWriter.cpp \
+	executor/xeTestResultMatcher.cpp \
 	executor/xeTestResultParser.cpp \
 	executor/xeXMLParser.cpp \
 	executor/xeXMLWriter.cpp \
@@ -242,8 +245,10 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/modules/vulkan/ubo/vktRandomUniformBlockCase.cpp \
 	external/vulkancts/modules/vulkan/ubo/vktUniformBlockCase.cpp \
 	external/vulkancts/modules/vulkan/ubo/vktUniformBlockTests.cpp \
+	external/vulkancts/modules/vulkan/vktDevicePool.cpp \
 	external/vulkancts/modules/vulkan/vktDrawUtil.cpp \
 	external/vulkancts/modules/vulkan/vktInfoTests.cpp \
+	external/vulkancts/modules/vulkan/vktProgramPreparer.cpp \
 	external/vulkancts/modules/vulkan/vktRenderPassTests.cpp \
 	external/vulkancts/modules/vulkan/vktShaderLibrary.cpp \
 	external/vulkancts/modules/vulkan/vktTestCase.cpp \
@@ -259,6 +264,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuApp.cpp \
 	framework/common/tcuArray.cpp \
 	framework/common/tcuAstcUtil.cpp \
+	framework/common/tcuAsyncVerifier.cpp \
 	framework/common/tcuBilinearImageCompare.cpp \
 	framework/common/tcuCPUWarmup.cpp \
 	framework/common/tcuCommandLine.cpp \
@@ -275,10 +281,14 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuInterval.cpp \
 	framework/common/tcuMatrix.cpp \
 	framework/common/tcuMaybe.cpp \
+	framework/common/tcuMemoryStats.cpp \
+	framework/common/tcuPerfStatistics.cpp \
 	framework/common/tcuPlatform.cpp \
+	framework/common/tcuProfiler.cpp \
 	framework/common/tcuRGBA.cpp \
 	framework/common/tcuRandomValueIterator.cpp \
 	framework/common/tcuRasterizationVerifier.cpp \
+	framework/common/tcuReferenceImageCache.cpp \
 	framework/common/tcuRenderTarget.cpp \
 	framework/common/tcuResource.cpp \
 	framework/common/tcuResultCollector.cpp \
@@ -370,6 +380,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/deutil/deCommandLine.c \
 	framework/delibs/deutil/deDynamicLibrary.c \
 	framework/delibs/deutil/deFile.c \
+	framework/delibs/deutil/deMemoryUsage.c \
 	framework/delibs/deutil/deProcess.c \
 	framework/delibs/deutil/deSocket.c \
 	framework/delibs/deutil/deTimer.c \
@@ -422,6 +433,7 @@ LOCAL_SRC_FILES := \
 	framework/opengl/simplereference/sglrContextWrapper.cpp \
 	framework/opengl/simplereference/sglrGLContext.cpp \
 	framework/opengl/simplereference/sglrReferenceContext.cpp \
+	framework/opengl/simplereference/sglrReferenceFunctions.cpp \
 	framework/opengl/simplereference/sglrReferenceUtils.cpp \
 	framework/opengl/simplereference/sglrShaderProgram.cpp \
 	framework/opengl/wrapper/glwDefs.cpp \
@@ -445,6 +457,7 @@ LOCAL_SRC_FILES := \
 	framework/platform/android/tcuAndroidUtil.cpp \
 	framework/platform/android/tcuAndroidWindow.cpp \
 	framework/platform/android/tcuTestLogParserJNI.cpp \
+	framework/qphelper/qpBinaryLogWriter.c \
 	framework/qphelper/qpCrashHandler.c \
 	framework/qphelper/qpDebugOut.c \
 	framework/qphelper/qpInfo.c \
@@ -919,9 +932,11 @@ LOCAL_SRC_FILES := \
 	modules/internal/ditAstcTests.cpp \
 	modules/internal/ditBuildInfoTests.cpp \
 	modules/internal/ditDelibsTests.cpp \
+	modules/internal/ditExecutorTests.cpp \
 	modules/internal/ditFrameworkTests.cpp \
 	modules/internal/ditImageCompareTests.cpp \
 	modules/internal/ditImageIOTests.cpp \
+	modules/internal/ditPerformanceTests.cpp \
 	modules/internal/ditSRGB8ConversionTest.cpp \
 	modules/internal/ditSeedBuilderTests.cpp \
 	modules/internal/ditTestCase.cpp \
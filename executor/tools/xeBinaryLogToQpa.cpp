@@ -0,0 +1,86 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Convert binary test log to text (.qpa) format.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeBinaryLogParser.hpp"
+#include "deFilePath.hpp"
+
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using std::string;
+
+static void convertLog (const char* srcFileName, const char* dstFileName)
+{
+	std::ifstream			in			(srcFileName, std::ifstream::binary|std::ifstream::in);
+	std::ofstream			out			(dstFileName, std::ofstream::binary|std::ofstream::out);
+	xe::BinaryLogParser		parser;
+	deUint8					buf			[32*1024];
+	string					text;
+
+	if (!in.good())
+		throw std::runtime_error(string("Failed to open '") + srcFileName + "'");
+
+	if (!out.good())
+		throw std::runtime_error(string("Failed to open '") + dstFileName + "'");
+
+	for (;;)
+	{
+		int numRead;
+
+		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
+		numRead = (int)in.gcount();
+
+		if (numRead <= 0)
+			break;
+
+		text.clear();
+		parser.feed(&buf[0], (size_t)numRead, text);
+		out.write(text.c_str(), (std::streamsize)text.length());
+
+		if (!out.good())
+			throw std::runtime_error(string("Failed to write to '") + dstFileName + "'");
+	}
+}
+
+int main (int argc, const char* const* argv)
+{
+	if (argc != 3)
+	{
+		printf("%s: [binary log] [output .qpa]\n", de::FilePath(argv[0]).getBaseName().c_str());
+		return -1;
+	}
+
+	try
+	{
+		convertLog(argv[1], argv[2]);
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -98,7 +99,7 @@ void registerOptions (de::cmdline::Parser& parser)
 	parser << Option<StartServer>	("s",		"start-server",	"Start local execserver. Path to the execserver binary.")
 		   << Option<Host>			("c",		"connect",		"Connect to host. Address of the execserver.")
 		   << Option<Port>			("p",		"port",			"TCP port of the execserver.",											"50016")
-		   << Option<CaseListDir>	("cd",		"caselistdir",	"Path to the directory containing test case XML files.",				".")
+		   << Option<CaseListDir>	("cd",		"caselistdir",	"Path to the directory containing test case list files (XML or binary).",				".")
 		   << Option<TestSet>		("t",		"testset",		"Comma-separated list of include filters.",								parseCommaSeparatedList)
 		   << Option<ExcludeSet>	("e",		"exclude",		"Comma-separated list of exclude filters.",								parseCommaSeparatedList, "")
 		   << Option<ContinueFile>	(DE_NULL,	"continue",		"Continue execution by initializing results from existing test log.")
@@ -275,30 +276,67 @@ void readCaseList (xe::TestGroup* root, const char* filename)
 	}
 }
 
+void readBinaryCaseList (xe::TestGroup* root, const char* filename)
+{
+	std::ifstream			in		(filename, std::ios_base::binary);
+	std::vector<deUint8>	data;
+
+	XE_CHECK(in.good());
+
+	in.seekg(0, std::ios_base::end);
+	data.resize((size_t)in.tellg());
+	in.seekg(0, std::ios_base::beg);
+
+	XE_CHECK(!data.empty());
+
+	in.read((char*)&data[0], (std::streamsize)data.size());
+	XE_CHECK(in.good() && in.gcount() == (std::streamsize)data.size());
+
+	xe::parseBinaryCaseList(root, &data[0], data.size());
+}
+
+bool hasSuffix (const string& str, const string& suffix)
+{
+	return str.length() >= suffix.length() && str.compare(str.length()-suffix.length(), suffix.length(), suffix) == 0;
+}
+
 void readCaseLists (xe::TestRoot& root, const char* caseListDir)
 {
-	int						testCaseListCount	= 0;
-	de::DirectoryIterator	iter				(caseListDir);
+	std::map<string, de::FilePath>	xmlCaseLists;
+	std::map<string, de::FilePath>	binaryCaseLists;
 
-	for (; iter.hasItem(); iter.next())
+	for (de::DirectoryIterator iter (caseListDir); iter.hasItem(); iter.next())
 	{
 		de::FilePath item = iter.getItem();
 
 		if (item.getType() == de::FilePath::TYPE_FILE)
 		{
 			string baseName = item.getBaseName();
-			if (baseName.find("-cases.xml") == baseName.length()-10)
-			{
-				string		packageName	= baseName.substr(0, baseName.length()-10);
-				xe::TestGroup*	package		= root.createGroup(packageName.c_str(), "");
 
-				readCaseList(package, item.getPath());
-				testCaseListCount++;
-			}
+			if (hasSuffix(baseName, "-cases.xml"))
+				xmlCaseLists[baseName.substr(0, baseName.length()-10)] = item;
+			else if (hasSuffix(baseName, "-cases.bin"))
+				binaryCaseLists[baseName.substr(0, baseName.length()-10)] = item;
+		}
+	}
+
+	// Binary case list is preferred if both exist for a package.
+	for (std::map<string, de::FilePath>::const_iterator iter = binaryCaseLists.begin(); iter != binaryCaseLists.end(); ++iter)
+	{
+		xe::TestGroup* package = root.createGroup(iter->first.c_str(), "");
+		readBinaryCaseList(package, iter->second.getPath());
+	}
+
+	for (std::map<string, de::FilePath>::const_iterator iter = xmlCaseLists.begin(); iter != xmlCaseLists.end(); ++iter)
+	{
+		if (binaryCaseLists.find(iter->first) == binaryCaseLists.end())
+		{
+			xe::TestGroup* package = root.createGroup(iter->first.c_str(), "");
+			readCaseList(package, iter->second.getPath());
 		}
 	}
 
-	if (testCaseListCount == 0)
+	if (xmlCaseLists.empty() && binaryCaseLists.empty())
 		throw xe::Error("Couldn't find test case lists from test case list directory: '" + string(caseListDir)  + "'");
 }
 
@@ -20,16 +20,23 @@
  * \file
  * \brief Merge two test logs.
  *
- * \todo [2013-11-08 pyry] Write variant that can operate with less memory.
+ * By default all inputs are parsed into memory before writing the merged
+ * log. In streaming mode inputs are first indexed, recording only the
+ * location of each test case result, and the results are then copied
+ * from inputs to output one at a time.
  *//*--------------------------------------------------------------------*/
 
 #include "xeTestLogParser.hpp"
 #include "xeTestResultParser.hpp"
 #include "xeTestLogWriter.hpp"
+#include "xeContainerFormatParser.hpp"
+#include "xeBinaryLogParser.hpp"
+#include "deSharedPtr.hpp"
 #include "deString.h"
 
 #include <vector>
 #include <string>
+#include <map>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
@@ -43,7 +50,8 @@ using std::map;
 
 enum Flags
 {
-	FLAG_USE_LAST_INFO = (1<<0)
+	FLAG_USE_LAST_INFO	= (1<<0),
+	FLAG_STREAMING		= (1<<1)
 };
 
 struct CommandLine
@@ -58,6 +66,30 @@ struct CommandLine
 	deUint32		flags;
 };
 
+static void mergeSessionInfo (xe::SessionInfo& combinedInfo, const xe::SessionInfo& info, deUint32 flags)
+{
+	if (flags & FLAG_USE_LAST_INFO)
+	{
+		if (!info.targetName.empty())		combinedInfo.targetName			= info.targetName;
+		if (!info.releaseId.empty())		combinedInfo.releaseId			= info.releaseId;
+		if (!info.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
+		if (!info.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
+		if (!info.configName.empty())		combinedInfo.configName			= info.configName;
+		if (!info.resultName.empty())		combinedInfo.resultName			= info.resultName;
+		if (!info.timestamp.empty())		combinedInfo.timestamp			= info.timestamp;
+	}
+	else
+	{
+		if (combinedInfo.targetName.empty())		combinedInfo.targetName			= info.targetName;
+		if (combinedInfo.releaseId.empty())			combinedInfo.releaseId			= info.releaseId;
+		if (combinedInfo.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
+		if (combinedInfo.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
+		if (combinedInfo.configName.empty())		combinedInfo.configName			= info.configName;
+		if (combinedInfo.resultName.empty())		combinedInfo.resultName			= info.resultName;
+		if (combinedInfo.timestamp.empty())			combinedInfo.timestamp			= info.timestamp;
+	}
+}
+
 class LogHandler : public xe::TestLogHandler
 {
 public:
@@ -69,38 +101,15 @@ public:
 
 	void setSessionInfo (const xe::SessionInfo& info)
 	{
-		xe::SessionInfo& combinedInfo = m_batchResult->getSessionInfo();
-
-		if (m_flags & FLAG_USE_LAST_INFO)
-		{
-			if (!info.targetName.empty())		combinedInfo.targetName			= info.targetName;
-			if (!info.releaseId.empty())		combinedInfo.releaseId			= info.releaseId;
-			if (!info.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
-			if (!info.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
-			if (!info.configName.empty())		combinedInfo.configName			= info.configName;
-			if (!info.resultName.empty())		combinedInfo.resultName			= info.resultName;
-			if (!info.timestamp.empty())		combinedInfo.timestamp			= info.timestamp;
-		}
-		else
-		{
-			if (combinedInfo.targetName.empty())		combinedInfo.targetName			= info.targetName;
-			if (combinedInfo.releaseId.empty())			combinedInfo.releaseId			= info.releaseId;
-			if (combinedInfo.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
-			if (combinedInfo.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
-			if (combinedInfo.configName.empty())		combinedInfo.configName			= info.configName;
-			if (combinedInfo.resultName.empty())		combinedInfo.resultName			= info.resultName;
-			if (combinedInfo.timestamp.empty())			combinedInfo.timestamp			= info.timestamp;
-		}
+		mergeSessionInfo(m_batchResult->getSessionInfo(), info, m_flags);
 	}
 
 	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
 	{
+		// \note Data and status of existing result are reset by the parser. Using
+		//		 clear() here would also clear the case path.
 		if (m_batchResult->hasTestCaseResult(casePath))
-		{
-			xe::TestCaseResultPtr existingResult = m_batchResult->getTestCaseResult(casePath);
-			existingResult->clear();
-			return existingResult;
-		}
+			return m_batchResult->getTestCaseResult(casePath);
 		else
 			return m_batchResult->createTestCaseResult(casePath);
 	}
@@ -145,6 +154,356 @@ static void readLogFile (xe::BatchResult* dstResult, const char* filename, deUin
 	in.close();
 }
 
+// Streaming merge.
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Source log accessed in text container format
+ *
+ * Binary logs are decoded on the fly. Offsets always refer to the decoded
+ * text. Random access to binary logs decodes forward from the current
+ * position, or from the start of the log if an earlier offset is requested.
+ *//*--------------------------------------------------------------------*/
+class SourceLog
+{
+public:
+							SourceLog		(const char* filename);
+
+	//! Get next chunk of log text. Returns false at end of log.
+	bool					readChunk		(const deUint8** data, size_t* numBytes);
+
+	//! Copy range of log text to stream.
+	void					copyText		(std::ostream& dst, deInt64 offset, deInt64 numBytes);
+
+private:
+							SourceLog		(const SourceLog& other);
+	SourceLog&				operator=		(const SourceLog& other);
+
+	void					rewind			(void);
+
+	const string			m_filename;
+	std::ifstream			m_in;
+	bool					m_isBinary;
+	xe::BinaryLogParser		m_binaryParser;
+	deUint8					m_buf[32*1024];
+
+	string					m_text;			//!< Current chunk of text.
+	deInt64					m_textOffset;	//!< Offset of current chunk.
+};
+
+SourceLog::SourceLog (const char* filename)
+	: m_filename	(filename)
+	, m_in			(filename, std::ifstream::binary|std::ifstream::in)
+	, m_isBinary	(false)
+	, m_textOffset	(0)
+{
+	if (!m_in.good())
+		throw std::runtime_error(string("Failed to open '") + filename + "'");
+
+	{
+		const int firstByte = m_in.peek();
+		m_isBinary = firstByte != std::ifstream::traits_type::eof() && xe::BinaryLogParser::isBinaryLogStart((deUint8)firstByte);
+	}
+}
+
+bool SourceLog::readChunk (const deUint8** data, size_t* numBytes)
+{
+	m_textOffset += (deInt64)m_text.size();
+	m_text.clear();
+
+	while (m_text.empty())
+	{
+		m_in.read((char*)&m_buf[0], DE_LENGTH_OF_ARRAY(m_buf));
+
+		const int numRead = (int)m_in.gcount();
+
+		if (numRead <= 0)
+			return false;
+
+		if (m_isBinary)
+			m_binaryParser.feed(&m_buf[0], (size_t)numRead, m_text);
+		else
+			m_text.assign((const char*)&m_buf[0], (size_t)numRead);
+	}
+
+	*data		= (const deUint8*)m_text.c_str();
+	*numBytes	= m_text.size();
+
+	return true;
+}
+
+void SourceLog::rewind (void)
+{
+	m_in.clear();
+	m_in.seekg(0);
+	m_binaryParser.clear();
+	m_text.clear();
+	m_textOffset = 0;
+}
+
+void SourceLog::copyText (std::ostream& dst, deInt64 offset, deInt64 numBytes)
+{
+	if (!m_isBinary)
+	{
+		m_in.clear();
+		m_in.seekg((std::streamoff)offset);
+
+		while (numBytes > 0)
+		{
+			m_in.read((char*)&m_buf[0], (std::streamsize)de::min<deInt64>(numBytes, DE_LENGTH_OF_ARRAY(m_buf)));
+
+			const int numRead = (int)m_in.gcount();
+
+			if (numRead <= 0)
+				throw std::runtime_error(string("Failed to read '") + m_filename + "'");
+
+			dst.write((const char*)&m_buf[0], numRead);
+			numBytes -= numRead;
+		}
+	}
+	else
+	{
+		if (offset < m_textOffset)
+			rewind();
+
+		while (numBytes > 0)
+		{
+			const deInt64 textEnd = m_textOffset + (deInt64)m_text.size();
+
+			if (offset < textEnd)
+			{
+				const size_t	start	= (size_t)(offset - m_textOffset);
+				const size_t	count	= (size_t)de::min<deInt64>(numBytes, textEnd - offset);
+
+				dst.write(m_text.c_str() + start, (std::streamsize)count);
+				offset		+= (deInt64)count;
+				numBytes	-= (deInt64)count;
+			}
+			else
+			{
+				const deUint8*	data;
+				size_t			dataSize;
+
+				if (!readChunk(&data, &dataSize))
+					throw std::runtime_error(string("Unexpected end of '") + m_filename + "'");
+			}
+		}
+	}
+}
+
+struct CaseLocation
+{
+	CaseLocation (void)
+		: logNdx		(0)
+		, dataOffset	(0)
+		, dataSize		(0)
+		, statusCode	(xe::TESTSTATUSCODE_RUNNING)
+		, lastChar		(0)
+	{
+	}
+
+	int					logNdx;
+	deInt64				dataOffset;		//!< Offset of test case data in source log text.
+	deInt64				dataSize;
+	xe::TestStatusCode	statusCode;
+	deUint8				lastChar;		//!< Last character of test case data.
+};
+
+struct LogIndex
+{
+	typedef map<string, CaseLocation> CaseMap;
+
+	xe::SessionInfo			sessionInfo;
+	CaseMap					cases;
+	vector<const string*>	caseOrder;		//!< Case paths in order of first appearance.
+};
+
+static void setSessionInfoAttribute (xe::SessionInfo& info, const char* attribute, const char* value)
+{
+	if (deStringEqual(attribute, "releaseName"))
+		info.releaseName = value;
+	else if (deStringEqual(attribute, "releaseId"))
+		info.releaseId = value;
+	else if (deStringEqual(attribute, "targetName"))
+		info.targetName = value;
+	else if (deStringEqual(attribute, "candyTargetName"))
+		info.candyTargetName = value;
+	else if (deStringEqual(attribute, "configName"))
+		info.configName = value;
+	else if (deStringEqual(attribute, "resultName"))
+		info.resultName = value;
+	else if (deStringEqual(attribute, "timestamp"))
+		info.timestamp = value;
+}
+
+static xe::TestStatusCode getTerminateStatusCode (const char* reason)
+{
+	try
+	{
+		return xe::getTestStatusCode(reason);
+	}
+	catch (const xe::ParseError&)
+	{
+		return xe::TESTSTATUSCODE_CRASH;
+	}
+}
+
+// \note Follows the same rules as TestLogParser when assigning data and status to test cases.
+static void indexLogFile (LogIndex& index, SourceLog& log, int logNdx, deUint32 flags)
+{
+	xe::ContainerFormatParser	parser;
+	xe::SessionInfo				sessionInfo;
+	bool						inSession	= false;
+	CaseLocation*				curCase		= DE_NULL;
+	deInt64						offset		= 0;
+	const deUint8*				data;
+	size_t						dataSize;
+
+	while (log.readChunk(&data, &dataSize))
+	{
+		parser.feed(data, dataSize);
+
+		for (;;)
+		{
+			const xe::ContainerElement element = parser.getElement();
+
+			if (element == xe::CONTAINERELEMENT_INCOMPLETE)
+				break;
+
+			switch (element)
+			{
+				case xe::CONTAINERELEMENT_BEGIN_SESSION:
+					if (inSession)
+						throw xe::Error("Unexpected #beginSession");
+
+					mergeSessionInfo(index.sessionInfo, sessionInfo, flags);
+					inSession = true;
+					break;
+
+				case xe::CONTAINERELEMENT_END_SESSION:
+					if (!inSession)
+						throw xe::Error("Unexpected #endSession");
+
+					inSession = false;
+					break;
+
+				case xe::CONTAINERELEMENT_SESSION_INFO:
+					if (inSession)
+						throw xe::Error("Unexpected #sessionInfo");
+
+					setSessionInfoAttribute(sessionInfo, parser.getSessionInfoAttribute(), parser.getSessionInfoValue());
+					break;
+
+				case xe::CONTAINERELEMENT_BEGIN_TEST_CASE_RESULT:
+				{
+					if (!inSession)
+						throw xe::Error("Unexpected #beginTestCaseResult");
+
+					const std::pair<LogIndex::CaseMap::iterator, bool> entry = index.cases.insert(std::make_pair(string(parser.getTestCasePath()), CaseLocation()));
+
+					if (entry.second)
+						index.caseOrder.push_back(&entry.first->first);
+
+					curCase				= &entry.first->second;
+					*curCase			= CaseLocation();
+					curCase->logNdx		= logNdx;
+					curCase->dataOffset	= offset + parser.getElementSize();
+					break;
+				}
+
+				case xe::CONTAINERELEMENT_END_TEST_CASE_RESULT:
+					if (curCase)
+						curCase->statusCode = xe::TESTSTATUSCODE_LAST;
+					curCase = DE_NULL;
+					break;
+
+				case xe::CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT:
+					if (curCase)
+						curCase->statusCode = getTerminateStatusCode(parser.getTerminateReason());
+					curCase = DE_NULL;
+					break;
+
+				case xe::CONTAINERELEMENT_END_OF_STRING:
+					if (curCase)
+						curCase->statusCode = xe::TESTSTATUSCODE_TERMINATED;
+					curCase = DE_NULL;
+					break;
+
+				case xe::CONTAINERELEMENT_TEST_LOG_DATA:
+					if (curCase)
+					{
+						const int numDataBytes = parser.getDataSize();
+
+						if (curCase->dataSize == 0)
+							curCase->dataOffset = offset;
+
+						curCase->dataSize = offset + numDataBytes - curCase->dataOffset;
+						parser.getData(&curCase->lastChar, 1, numDataBytes-1);
+					}
+					break;
+
+				default:
+					throw xe::ContainerParseError("Unknown container element");
+			}
+
+			offset += parser.getElementSize();
+			parser.advance();
+		}
+	}
+}
+
+static void writeMergedLog (const LogIndex& index, const vector<de::SharedPtr<SourceLog> >& logs, std::ostream& dst)
+{
+	xe::writeSessionInfo(index.sessionInfo, dst);
+
+	dst << "#beginSession\n";
+
+	for (vector<const string*>::const_iterator casePath = index.caseOrder.begin(); casePath != index.caseOrder.end(); ++casePath)
+	{
+		const CaseLocation& location = index.cases.find(**casePath)->second;
+
+		xe::writeTestCaseBegin((*casePath)->c_str(), dst);
+
+		if (location.dataSize > 0)
+		{
+			logs[location.logNdx]->copyText(dst, location.dataOffset, location.dataSize);
+
+			if (location.lastChar != '\n' && location.lastChar != '\r')
+				dst << "\n";
+		}
+
+		xe::writeTestCaseEnd(location.statusCode, dst);
+
+		if (!dst.good())
+			throw std::runtime_error("Failed to write merged log");
+	}
+
+	dst << "\n#endSession\n";
+}
+
+static void mergeTestLogsStreaming (const CommandLine& cmdLine)
+{
+	LogIndex							index;
+	vector<de::SharedPtr<SourceLog> >	logs;
+
+	for (int logNdx = 0; logNdx < (int)cmdLine.srcFilenames.size(); logNdx++)
+	{
+		logs.push_back(de::SharedPtr<SourceLog>(new SourceLog(cmdLine.srcFilenames[logNdx].c_str())));
+		indexLogFile(index, *logs.back(), logNdx, cmdLine.flags);
+	}
+
+	if (!cmdLine.dstFilename.empty())
+	{
+		std::ofstream out (cmdLine.dstFilename.c_str(), std::ofstream::binary|std::ofstream::trunc);
+
+		if (!out.good())
+			throw std::runtime_error(string("Failed to open '") + cmdLine.dstFilename + "'");
+
+		writeMergedLog(index, logs, out);
+	}
+	else
+		writeMergedLog(index, logs, std::cout);
+}
+
 static void mergeTestLogs (const CommandLine& cmdLine)
 {
 	xe::BatchResult batchResult;
@@ -163,6 +522,8 @@ static void printHelp (const char* binName)
 	printf("%s: [filename] [[filename 2] ...]\n", binName);
 	printf("  --dst=[filename]    Write final log to file, otherwise written to stdout.\n");
 	printf("  --info=[first|last] Select which session info to use (default: first).\n");
+	printf("  --streaming         Copy test case results directly from inputs instead of\n");
+	printf("                      loading all of them into memory.\n");
 }
 
 static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -183,6 +544,8 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 			cmdLine.flags &= ~FLAG_USE_LAST_INFO;
 		else if (deStringEqual(arg, "--info=last"))
 			cmdLine.flags |= FLAG_USE_LAST_INFO;
+		else if (deStringEqual(arg, "--streaming"))
+			cmdLine.flags |= FLAG_STREAMING;
 		else
 			return false;
 	}
@@ -205,7 +568,10 @@ int main (int argc, const char* const* argv)
 			return -1;
 		}
 
-		mergeTestLogs(cmdLine);
+		if (cmdLine.flags & FLAG_STREAMING)
+			mergeTestLogsStreaming(cmdLine);
+		else
+			mergeTestLogs(cmdLine);
 	}
 	catch (const std::exception& e)
 	{
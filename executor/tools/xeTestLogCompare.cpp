@@ -19,13 +19,19 @@
  *//*!
  * \file
  * \brief Test log compare utility.
+ *
+ * Logs are parsed concurrently and compared in lockstep, one test case at
+ * a time. Results are buffered only when case order differs between logs.
  *//*--------------------------------------------------------------------*/
 
 #include "xeTestLogParser.hpp"
 #include "xeTestResultParser.hpp"
+#include "xeTestResultMatcher.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
 #include "deThread.hpp"
+#include "deThreadSafeRingBuffer.hpp"
+#include "deSharedPtr.hpp"
 #include "deCommandLine.hpp"
 
 #include <vector>
@@ -34,13 +40,10 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
-#include <set>
-#include <map>
+#include <stdexcept>
 
 using std::vector;
 using std::string;
-using std::set;
-using std::map;
 
 enum OutputMode
 {
@@ -116,17 +119,31 @@ struct CommandLine
 	vector<string>		filenames;
 };
 
-struct ShortBatchResult
+struct ResultItem
 {
-	vector<xe::TestCaseResultHeader>	resultHeaders;
-	map<string, int>					resultMap;
+	enum Type
+	{
+		TYPE_RESULT = 0,
+		TYPE_END,			//!< End of log.
+		TYPE_ERROR,			//!< Reading log failed, message in error.
+
+		TYPE_LAST
+	};
+
+	ResultItem (void) : type(TYPE_LAST) {}
+
+	Type						type;
+	xe::TestCaseResultHeader	header;
+	string						error;
 };
 
+typedef de::ThreadSafeRingBuffer<ResultItem> ResultQueue;
+
 class ShortResultHandler : public xe::TestLogHandler
 {
 public:
-	ShortResultHandler (ShortBatchResult& result)
-		: m_result(result)
+	ShortResultHandler (ResultQueue& results)
+		: m_results(results)
 	{
 	}
 
@@ -147,37 +164,35 @@ public:
 
 	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
 	{
-		xe::TestCaseResultHeader	header;
-		int							caseNdx	= (int)m_result.resultHeaders.size();
+		ResultItem item;
 
-		header.casePath			= caseData->getTestCasePath();
-		header.caseType			= xe::TESTCASETYPE_SELF_VALIDATE;
-		header.statusCode		= caseData->getStatusCode();
-		header.statusDetails	= caseData->getStatusDetails();
+		item.type					= ResultItem::TYPE_RESULT;
+		item.header.casePath		= caseData->getTestCasePath();
+		item.header.caseType		= xe::TESTCASETYPE_SELF_VALIDATE;
+		item.header.statusCode		= caseData->getStatusCode();
+		item.header.statusDetails	= caseData->getStatusDetails();
 
-		if (header.statusCode == xe::TESTSTATUSCODE_LAST)
+		if (item.header.statusCode == xe::TESTSTATUSCODE_LAST)
 		{
 			xe::TestCaseResult fullResult;
 
 			xe::parseTestCaseResultFromData(&m_testResultParser, &fullResult, *caseData.get());
 
-			header = xe::TestCaseResultHeader(fullResult);
+			item.header = xe::TestCaseResultHeader(fullResult);
 		}
 
-		// Insert into result list & map.
-		m_result.resultHeaders.push_back(header);
-		m_result.resultMap[header.casePath] = caseNdx;
+		m_results.pushFront(item);
 	}
 
 private:
-	ShortBatchResult&		m_result;
+	ResultQueue&			m_results;
 	xe::TestResultParser	m_testResultParser;
 };
 
-static void readLogFile (ShortBatchResult& batchResult, const char* filename)
+static void readLogFile (ResultQueue& results, const char* filename)
 {
 	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	ShortResultHandler	resultHandler	(batchResult);
+	ShortResultHandler	resultHandler	(results);
 	xe::TestLogParser	parser			(&resultHandler);
 	deUint8				buf				[1024];
 	int					numRead			= 0;
@@ -196,62 +211,76 @@ static void readLogFile (ShortBatchResult& batchResult, const char* filename)
 	in.close();
 }
 
-class LogFileReader : public de::Thread
+class LogFileReader : public de::Thread, public xe::TestResultSource
 {
 public:
-	LogFileReader (ShortBatchResult& batchResult, const char* filename)
-		: m_batchResult	(batchResult)
-		, m_filename	(filename)
+	enum
 	{
-	}
+		RESULT_QUEUE_SIZE	= 256
+	};
 
-	void run (void)
+	LogFileReader (const char* filename)
+		: m_filename	(filename)
+		, m_results		(RESULT_QUEUE_SIZE)
+		, m_isFinished	(false)
 	{
-		readLogFile(m_batchResult, m_filename.c_str());
 	}
 
-private:
-	ShortBatchResult&	m_batchResult;
-	std::string			m_filename;
-};
+	~LogFileReader (void)
+	{
+		if (isStarted())
+		{
+			// Unblock reader if all results were not consumed.
+			while (!m_isFinished)
+				m_isFinished = m_results.popBack().type != ResultItem::TYPE_RESULT;
 
-static void computeCaseList (vector<string>& cases, const vector<ShortBatchResult>& batchResults)
-{
-	// \todo [2012-07-10 pyry] Do proper case ordering (eg. handle missing cases nicely).
-	set<string> addedCases;
+			join();
+		}
+	}
 
-	for (vector<ShortBatchResult>::const_iterator batchIter = batchResults.begin(); batchIter != batchResults.end(); batchIter++)
+	void run (void)
 	{
-		for (vector<xe::TestCaseResultHeader>::const_iterator caseIter = batchIter->resultHeaders.begin(); caseIter != batchIter->resultHeaders.end(); caseIter++)
+		ResultItem endItem;
+
+		try
 		{
-			if (addedCases.find(caseIter->casePath) == addedCases.end())
-			{
-				cases.push_back(caseIter->casePath);
-				addedCases.insert(caseIter->casePath);
-			}
+			readLogFile(m_results, m_filename.c_str());
+			endItem.type = ResultItem::TYPE_END;
+		}
+		catch (const std::exception& e)
+		{
+			endItem.type	= ResultItem::TYPE_ERROR;
+			endItem.error	= m_filename + ": " + e.what();
 		}
-	}
-}
 
-static void getTestResultHeaders (vector<xe::TestCaseResultHeader>& headers, const vector<ShortBatchResult>& batchResults, const char* casePath)
-{
-	headers.resize(batchResults.size());
+		m_results.pushFront(endItem);
+	}
 
-	for (int ndx = 0; ndx < (int)batchResults.size(); ndx++)
+	//! Get next test case result from log. Returns false at end of log.
+	bool getNext (xe::TestCaseResultHeader& dst)
 	{
-		const ShortBatchResult&				batchResult	= batchResults[ndx];
-		map<string, int>::const_iterator	resultPos	= batchResult.resultMap.find(casePath);
+		if (m_isFinished)
+			return false;
 
-		if (resultPos != batchResult.resultMap.end())
-			headers[ndx] = batchResult.resultHeaders[resultPos->second];
-		else
+		const ResultItem item = m_results.popBack();
+
+		if (item.type == ResultItem::TYPE_ERROR)
 		{
-			headers[ndx].casePath	= casePath;
-			headers[ndx].caseType	= xe::TESTCASETYPE_SELF_VALIDATE;
-			headers[ndx].statusCode	= xe::TESTSTATUSCODE_LAST;
+			m_isFinished = true;
+			throw std::runtime_error(item.error);
 		}
+
+		m_isFinished	= item.type != ResultItem::TYPE_RESULT;
+		dst				= item.header;
+
+		return !m_isFinished;
 	}
-}
+
+private:
+	std::string			m_filename;
+	ResultQueue			m_results;
+	bool				m_isFinished;
+};
 
 static const char* getStatusCodeName (xe::TestStatusCode code)
 {
@@ -261,43 +290,90 @@ static const char* getStatusCodeName (xe::TestStatusCode code)
 		return xe::getTestStatusCodeName(code);
 }
 
-static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
+class CompareResultHandler : public xe::MatchedResultHandler
 {
-	vector<ShortBatchResult>	results;
-	vector<string>				batchNames;
-	bool						compareOk	= true;
-
-	XE_CHECK(!cmdLine.filenames.empty());
+public:
+	CompareResultHandler (const CommandLine& cmdLine, const vector<string>& batchNames, std::ostream& dst)
+		: m_cmdLine		(cmdLine)
+		, m_batchNames	(batchNames)
+		, m_dst			(dst)
+		, m_numCases	(0)
+		, m_numEqual	(0)
+	{
+	}
 
-	try
+	void matched (const vector<xe::TestCaseResultHeader>& headers)
 	{
-		// Read in batch results
-		results.resize(cmdLine.filenames.size());
-		{
-			std::vector<de::SharedPtr<LogFileReader> > readers;
+		const string&	caseName	= headers[0].casePath;
+		bool			allEqual	= true;
 
-			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
+		for (vector<xe::TestCaseResultHeader>::const_iterator iter = headers.begin()+1; iter != headers.end(); iter++)
+		{
+			if (iter->statusCode != headers[0].statusCode)
 			{
-				readers.push_back(de::SharedPtr<LogFileReader>(new LogFileReader(results[ndx], cmdLine.filenames[ndx].c_str())));
-				readers.back()->start();
+				allEqual = false;
+				break;
 			}
+		}
 
-			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
-			{
-				readers[ndx]->join();
+		m_numCases += 1;
 
-				// Use file name as batch name.
-				batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
+		if (allEqual)
+			m_numEqual += 1;
+
+		if (m_cmdLine.outMode == OUTPUTMODE_ALL || !allEqual)
+		{
+			if (m_cmdLine.outFormat == OUTPUTFORMAT_TEXT)
+			{
+				m_dst << caseName << "\n";
+				for (int ndx = 0; ndx < (int)headers.size(); ndx++)
+					m_dst << "  " << m_batchNames[ndx] << ": " << getStatusCodeName(headers[ndx].statusCode) << " (" << headers[ndx].statusDetails << ")\n";
+				m_dst << "\n";
+			}
+			else if (m_cmdLine.outFormat == OUTPUTFORMAT_CSV)
+			{
+				m_dst << caseName;
+				for (vector<xe::TestCaseResultHeader>::const_iterator iter = headers.begin(); iter != headers.end(); iter++)
+					m_dst << "," << (m_cmdLine.outValue == OUTPUTVALUE_STATUS_CODE ? getStatusCodeName(iter->statusCode) : iter->statusDetails.c_str());
+				m_dst << "\n";
 			}
 		}
+	}
 
-		// Compute unified case list.
-		vector<string> caseList;
-		computeCaseList(caseList, results);
+	int getNumCases (void) const { return m_numCases; }
+	int getNumEqual (void) const { return m_numEqual; }
 
-		// Stats.
-		int		numCases		= (int)caseList.size();
-		int		numEqual		= 0;
+private:
+	const CommandLine&		m_cmdLine;
+	const vector<string>&	m_batchNames;
+	std::ostream&			m_dst;
+	int						m_numCases;
+	int						m_numEqual;
+};
+
+static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
+{
+	vector<string>	batchNames;
+	bool			compareOk	= true;
+
+	XE_CHECK(!cmdLine.filenames.empty());
+
+	try
+	{
+		const int								numLogs		= (int)cmdLine.filenames.size();
+		vector<de::SharedPtr<LogFileReader> >	readers;
+		vector<xe::TestResultSource*>			sources;
+
+		// Start reading logs
+		for (int ndx = 0; ndx < numLogs; ndx++)
+		{
+			readers.push_back(de::SharedPtr<LogFileReader>(new LogFileReader(cmdLine.filenames[ndx].c_str())));
+			readers.back()->start();
+			sources.push_back(readers.back().get());
+
+			// Use file name as batch name.
+			batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
+		}
 
 		if (cmdLine.outFormat == OUTPUTFORMAT_CSV)
 		{
@@ -307,53 +383,19 @@ static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
 			dst << "\n";
 		}
 
-		// Compare cases.
-		for (vector<string>::const_iterator caseIter = caseList.begin(); caseIter != caseList.end(); caseIter++)
 		{
-			const string&						caseName	= *caseIter;
-			vector<xe::TestCaseResultHeader>	headers;
-			bool								allEqual	= true;
-
-			getTestResultHeaders(headers, results, caseName.c_str());
+			CompareResultHandler handler (cmdLine, batchNames, dst);
 
-			for (vector<xe::TestCaseResultHeader>::const_iterator iter = headers.begin()+1; iter != headers.end(); iter++)
-			{
-				if (iter->statusCode != headers[0].statusCode)
-				{
-					allEqual = false;
-					break;
-				}
-			}
+			xe::matchTestResults(sources, handler);
 
-			if (allEqual)
-				numEqual += 1;
+			compareOk = handler.getNumEqual() == handler.getNumCases();
 
-			if (cmdLine.outMode == OUTPUTMODE_ALL || !allEqual)
+			if (cmdLine.outFormat == OUTPUTFORMAT_TEXT)
 			{
-				if (cmdLine.outFormat == OUTPUTFORMAT_TEXT)
-				{
-					dst << caseName << "\n";
-					for (int ndx = 0; ndx < (int)headers.size(); ndx++)
-						dst << "  " << batchNames[ndx] << ": " << getStatusCodeName(headers[ndx].statusCode) << " (" << headers[ndx].statusDetails << ")\n";
-					dst << "\n";
-				}
-				else if (cmdLine.outFormat == OUTPUTFORMAT_CSV)
-				{
-					dst << caseName;
-					for (vector<xe::TestCaseResultHeader>::const_iterator iter = headers.begin(); iter != headers.end(); iter++)
-						dst << "," << (cmdLine.outValue == OUTPUTVALUE_STATUS_CODE ? getStatusCodeName(iter->statusCode) : iter->statusDetails.c_str());
-					dst << "\n";
-				}
+				dst << "  " << handler.getNumEqual() << " / " << handler.getNumCases() << " test case results match.\n";
+				dst << "  Comparison " << (compareOk ? "passed" : "FAILED") << "!\n";
 			}
 		}
-
-		compareOk = numEqual == numCases;
-
-		if (cmdLine.outFormat == OUTPUTFORMAT_TEXT)
-		{
-			dst << "  " << numEqual << " / " << numCases << " test case results match.\n";
-			dst << "  Comparison " << (compareOk ? "passed" : "FAILED") << "!\n";
-		}
 	}
 	catch (const std::exception& e)
 	{
@@ -41,80 +41,57 @@ enum
 
 // \todo [2012-11-01 pyry] Update execute set in handler.
 
-static inline bool isExecutedInBatch (const BatchResult* batchResult, const TestCase* testCase)
+static inline bool isExecuted (const ConstTestCaseResultPtr& result)
 {
-	std::string fullPath;
-	testCase->getFullPath(fullPath);
+	return result->getStatusCode() != TESTSTATUSCODE_PENDING && result->getStatusCode() != TESTSTATUSCODE_RUNNING;
+}
 
-	if (batchResult->hasTestCaseResult(fullPath.c_str()))
-	{
-		ConstTestCaseResultPtr data = batchResult->getTestCaseResult(fullPath.c_str());
-		return data->getStatusCode() != TESTSTATUSCODE_PENDING && data->getStatusCode() != TESTSTATUSCODE_RUNNING;
-	}
+static inline bool isExecutedInBatch (const BatchResult* batchResult, const char* casePath)
+{
+	if (batchResult->hasTestCaseResult(casePath))
+		return isExecuted(batchResult->getTestCaseResult(casePath));
 	else
 		return false;
 }
 
-// \todo [2012-06-19 pyry] These can be optimized using TestSetIterator (once implemented)
-
-static void computeExecuteSet (TestSet& executeSet, const TestNode* root, const TestSet& testSet, const BatchResult* batchResult)
+static void computeExecuteSet (TestCaseBitSet& executeSet, const TestCaseIndex& index, const TestSet& testSet, const BatchResult* batchResult)
 {
-	ConstTestNodeIterator	iter	= ConstTestNodeIterator::begin(root);
-	ConstTestNodeIterator	end		= ConstTestNodeIterator::end(root);
+	getTestSetCases(executeSet, index, testSet);
 
-	for (; iter != end; ++iter)
+	// Batch result may contain results of a previous run, for example when continuing from an earlier log.
+	for (int resultNdx = 0; resultNdx < batchResult->getNumTestCaseResults(); resultNdx++)
 	{
-		const TestNode* node = *iter;
+		const ConstTestCaseResultPtr	result	= batchResult->getTestCaseResult(resultNdx);
+		const int						caseNdx	= index.findCase(result->getTestCasePath());
 
-		if (node->getNodeType() == TESTNODETYPE_TEST_CASE && testSet.hasNode(node))
-		{
-			const TestCase* testCase = static_cast<const TestCase*>(node);
-
-			if (!isExecutedInBatch(batchResult, testCase))
-				executeSet.addCase(testCase);
-		}
+		if (caseNdx >= 0 && isExecuted(result))
+			executeSet.remove(caseNdx);
 	}
 }
 
-static void computeBatchRequest (TestSet& requestSet, const TestSet& executeSet, const TestNode* root, int maxCasesInSet)
+static void computeBatchRequest (TestCaseBitSet& requestSet, const TestCaseBitSet& executeSet, int maxCasesInSet)
 {
-	ConstTestNodeIterator	iter		= ConstTestNodeIterator::begin(root);
-	ConstTestNodeIterator	end			= ConstTestNodeIterator::end(root);
-	int						numCases	= 0;
+	int numCases = 0;
 
-	for (; (iter != end) && (numCases < maxCasesInSet); ++iter)
-	{
-		const TestNode* node = *iter;
+	requestSet = TestCaseBitSet(executeSet.getNumCases());
 
-		if (node->getNodeType() == TESTNODETYPE_TEST_CASE && executeSet.hasNode(node))
-		{
-			const TestCase* testCase = static_cast<const TestCase*>(node);
-			requestSet.addCase(testCase);
-			numCases += 1;
-		}
+	for (int caseNdx = executeSet.findNext(0); caseNdx < executeSet.getNumCases() && numCases < maxCasesInSet; caseNdx = executeSet.findNext(caseNdx+1))
+	{
+		requestSet.add(caseNdx);
+		numCases += 1;
 	}
 }
 
-static int removeExecuted (TestSet& set, const TestNode* root, const BatchResult* batchResult)
+static int removeExecuted (TestCaseBitSet& set, const TestCaseIndex& index, const BatchResult* batchResult)
 {
-	TestSet					oldSet		(set);
-	ConstTestNodeIterator	iter		= ConstTestNodeIterator::begin(root);
-	ConstTestNodeIterator	end			= ConstTestNodeIterator::end(root);
-	int						numRemoved	= 0;
+	int numRemoved = 0;
 
-	for (; iter != end; ++iter)
+	for (int caseNdx = set.findNext(0); caseNdx < set.getNumCases(); caseNdx = set.findNext(caseNdx+1))
 	{
-		const TestNode* node = *iter;
-
-		if (node->getNodeType() == TESTNODETYPE_TEST_CASE && oldSet.hasNode(node))
+		if (isExecutedInBatch(batchResult, index.getCasePath(caseNdx)))
 		{
-			const TestCase* testCase = static_cast<const TestCase*>(node);
-
-			if (isExecutedInBatch(batchResult, testCase))
-			{
-				set.removeCase(testCase);
-				numRemoved += 1;
-			}
+			set.remove(caseNdx);
+			numRemoved += 1;
 		}
 	}
 
@@ -159,6 +136,7 @@ BatchExecutor::BatchExecutor (const TargetConfiguration& config, CommLink* commL
 	, m_commLink		(commLink)
 	, m_root			(root)
 	, m_testSet			(testSet)
+	, m_caseIndex		(root)
 	, m_logHandler		(batchResult)
 	, m_batchResult		(batchResult)
 	, m_infoLog			(infoLog)
@@ -192,7 +170,7 @@ void BatchExecutor::run (void)
 	}
 
 	// Compute initial execute set.
-	computeExecuteSet(m_casesToExecute, m_root, m_testSet, m_batchResult);
+	computeExecuteSet(m_casesToExecute, m_caseIndex, m_testSet, m_batchResult);
 
 	// Register callbacks.
 	m_commLink->setCallbacks(enqueueStateChanged, enqueueTestLogData, enqueueInfoLogData, this);
@@ -201,8 +179,8 @@ void BatchExecutor::run (void)
 	{
 		if (!m_casesToExecute.empty())
 		{
-			TestSet batchRequest;
-			computeBatchRequest(batchRequest, m_casesToExecute, m_root, m_config.maxCasesPerSession);
+			TestCaseBitSet batchRequest;
+			computeBatchRequest(batchRequest, m_casesToExecute, m_config.maxCasesPerSession);
 			launchTestSet(batchRequest);
 
 			m_state = STATE_STARTED;
@@ -247,7 +225,7 @@ void BatchExecutor::onStateChanged (CommLinkState state, const char* message)
 				onTestLogData(&eos, 1);
 			}
 
-			int numExecuted = removeExecuted(m_casesToExecute, m_root, m_batchResult);
+			int numExecuted = removeExecuted(m_casesToExecute, m_caseIndex, m_batchResult);
 
 			// \note No new batch is launched if no cases were executed in last one. Otherwise excutor
 			//       could end up in infinite loop.
@@ -259,8 +237,8 @@ void BatchExecutor::onStateChanged (CommLinkState state, const char* message)
 				m_commLink->reset();
 				XE_CHECK(m_commLink->getState() == COMMLINKSTATE_READY);
 
-				TestSet batchRequest;
-				computeBatchRequest(batchRequest, m_casesToExecute, m_root, m_config.maxCasesPerSession);
+				TestCaseBitSet batchRequest;
+				computeBatchRequest(batchRequest, m_casesToExecute, m_config.maxCasesPerSession);
 				launchTestSet(batchRequest);
 			}
 			else
@@ -303,46 +281,12 @@ void BatchExecutor::onInfoLogData (const deUint8* bytes, size_t numBytes)
 		m_infoLog->append(bytes, numBytes);
 }
 
-static void writeCaseListNode (std::ostream& str, const TestNode* node, const TestSet& testSet)
-{
-	DE_ASSERT(testSet.hasNode(node));
-
-	TestNodeType nodeType = node->getNodeType();
-
-	if (nodeType != TESTNODETYPE_ROOT)
-		str << node->getName();
-
-	if (nodeType == TESTNODETYPE_ROOT || nodeType == TESTNODETYPE_GROUP)
-	{
-		const TestGroup*	group	= static_cast<const TestGroup*>(node);
-		bool				isFirst	= true;
-
-		str << "{";
-
-		for (int ndx = 0; ndx < group->getNumChildren(); ndx++)
-		{
-			const TestNode* child = group->getChild(ndx);
-
-			if (testSet.hasNode(child))
-			{
-				if (!isFirst)
-					str << ",";
-
-				writeCaseListNode(str, child, testSet);
-				isFirst = false;
-			}
-		}
-
-		str << "}";
-	}
-}
-
-void BatchExecutor::launchTestSet (const TestSet& testSet)
+void BatchExecutor::launchTestSet (const TestCaseBitSet& testSet)
 {
 	std::ostringstream caseList;
-	XE_CHECK(testSet.hasNode(m_root));
+	XE_CHECK(!testSet.empty());
 	XE_CHECK(m_root->getNodeType() == TESTNODETYPE_ROOT);
-	writeCaseListNode(caseList, m_root, testSet);
+	writeCaseListTrie(caseList, m_caseIndex, testSet);
 
 	m_commLink->startTestProcess(m_config.binaryName.c_str(), m_config.cmdLineArgs.c_str(), m_config.workingDir.c_str(), caseList.str().c_str());
 }
@@ -28,6 +28,7 @@
 #include "xeCommLink.hpp"
 #include "xeTestLogParser.hpp"
 #include "xeCallQueue.hpp"
+#include "xeTestCaseIndex.hpp"
 
 #include <string>
 #include <vector>
@@ -83,7 +84,7 @@ private:
 	void					onTestLogData		(const deUint8* bytes, size_t numBytes);
 	void					onInfoLogData		(const deUint8* bytes, size_t numBytes);
 
-	void					launchTestSet		(const TestSet& testSet);
+	void					launchTestSet		(const TestCaseBitSet& testSet);
 
 	// Callbacks for CommLink.
 	static void				enqueueStateChanged	(void* userPtr, CommLinkState state, const char* message);
@@ -109,13 +110,14 @@ private:
 
 	const TestNode*			m_root;
 	const TestSet&			m_testSet;
+	const TestCaseIndex		m_caseIndex;
 
 	BatchExecutorLogHandler	m_logHandler;
 	BatchResult*			m_batchResult;
 	InfoLog*				m_infoLog;
 
 	State					m_state;
-	TestSet					m_casesToExecute;
+	TestCaseBitSet			m_casesToExecute;
 
 	TestLogParser			m_testLogParser;
 
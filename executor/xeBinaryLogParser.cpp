@@ -0,0 +1,563 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary test log parser.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeBinaryLogParser.hpp"
+#include "deString.h"
+#include "deMemory.h"
+
+#include <cstring>
+
+using std::string;
+
+namespace xe
+{
+
+namespace
+{
+
+// \note Must match qpBinaryLogWriter.h
+const deUint8 s_magic[BinaryLogParser::MAGIC_SIZE] = { 0x89, 'q', 'p', 'L', 'o', 'g', '\r', '\n' };
+
+enum RecordTag
+{
+	TAG_SESSION_INFO = 1,
+	TAG_BEGIN_SESSION,
+	TAG_END_SESSION,
+	TAG_BEGIN_TEST_CASE_RESULT,
+	TAG_END_TEST_CASE_RESULT,
+	TAG_TERMINATE_TEST_CASE_RESULT,
+	TAG_START_DOCUMENT,
+	TAG_END_DOCUMENT,
+	TAG_START_ELEMENT,
+	TAG_END_ELEMENT,
+	TAG_STRING,
+	TAG_INT64,
+	TAG_FLOAT,
+	TAG_DOUBLE,
+	TAG_DATA
+};
+
+// \note Must match qpXmlAttributeType
+enum AttributeType
+{
+	ATTRIBUTETYPE_STRING = 0,
+	ATTRIBUTETYPE_INT,
+	ATTRIBUTETYPE_BOOL
+};
+
+// \note Mirrors escaping done by qpXmlWriter.
+inline const char* getEscapeEntity (char ch)
+{
+	switch (ch)
+	{
+		case '<':	return "&lt;";
+		case '>':	return "&gt;";
+		case '&':	return "&amp;";
+		case '\'':	return "&apos;";
+		case '"':	return "&quot;";
+
+		// Non-printable characters.
+		case 1:		return "&lt;SOH&gt;";
+		case 2:		return "&lt;STX&gt;";
+		case 3:		return "&lt;ETX&gt;";
+		case 4:		return "&lt;EOT&gt;";
+		case 5:		return "&lt;ENQ&gt;";
+		case 6:		return "&lt;ACK&gt;";
+		case 7:		return "&lt;BEL&gt;";
+		case 8:		return "&lt;BS&gt;";
+		case 11:	return "&lt;VT&gt;";
+		case 12:	return "&lt;FF&gt;";
+		case 14:	return "&lt;SO&gt;";
+		case 15:	return "&lt;SI&gt;";
+		case 16:	return "&lt;DLE&gt;";
+		case 17:	return "&lt;DC1&gt;";
+		case 18:	return "&lt;DC2&gt;";
+		case 19:	return "&lt;DC3&gt;";
+		case 20:	return "&lt;DC4&gt;";
+		case 21:	return "&lt;NAK&gt;";
+		case 22:	return "&lt;SYN&gt;";
+		case 23:	return "&lt;ETB&gt;";
+		case 24:	return "&lt;CAN&gt;";
+		case 25:	return "&lt;EM&gt;";
+		case 26:	return "&lt;SUB&gt;";
+		case 27:	return "&lt;ESC&gt;";
+		case 28:	return "&lt;FS&gt;";
+		case 29:	return "&lt;GS&gt;";
+		case 30:	return "&lt;RS&gt;";
+		case 31:	return "&lt;US&gt;";
+
+		default:	return DE_NULL;
+	}
+}
+
+void appendEscaped (string& dst, const char* str, size_t length)
+{
+	size_t numWritten = 0;
+
+	for (size_t pos = 0; pos < length; pos++)
+	{
+		const char* entity;
+
+		// qpXmlWriter handles strings as null-terminated.
+		if (str[pos] == 0)
+		{
+			length = pos;
+			break;
+		}
+
+		entity = getEscapeEntity(str[pos]);
+
+		if (entity)
+		{
+			dst.append(str + numWritten, pos - numWritten);
+			dst.append(entity);
+			numWritten = pos+1;
+		}
+	}
+
+	dst.append(str + numWritten, length - numWritten);
+}
+
+const char* getIndentStr (int indentLevel)
+{
+	static const char	s_indentStr[33]	= "                                ";
+	static const int	s_indentStrLen	= 32;
+	return &s_indentStr[s_indentStrLen - de::min(s_indentStrLen, indentLevel)];
+}
+
+} // anonymous
+
+class BinaryLogParser::Reader
+{
+public:
+	Reader (const deUint8* data, size_t size)
+		: m_data	(data)
+		, m_size	(size)
+		, m_pos		(0)
+	{
+	}
+
+	deUint8 getByte (void)
+	{
+		check(1);
+		return m_data[m_pos++];
+	}
+
+	deUint64 getVarint (void)
+	{
+		deUint64	value	= 0;
+		int			shift	= 0;
+
+		for (;;)
+		{
+			const deUint8 byte = getByte();
+
+			if (shift >= 64)
+				throw BinaryLogParseError("Invalid varint");
+
+			value |= (deUint64)(byte & 0x7f) << shift;
+			shift += 7;
+
+			if ((byte & 0x80) == 0)
+				return value;
+		}
+	}
+
+	deInt64 getSignedVarint (void)
+	{
+		const deUint64 value = getVarint();
+		return (deInt64)(value >> 1) ^ -(deInt64)(value & 1);
+	}
+
+	deUint64 getFixed (int numBytes)
+	{
+		deUint64 value = 0;
+
+		check((size_t)numBytes);
+
+		for (int ndx = 0; ndx < numBytes; ndx++)
+			value |= (deUint64)m_data[m_pos++] << (8*ndx);
+
+		return value;
+	}
+
+	string getString (void)
+	{
+		const size_t	length	= (size_t)getVarint();
+		const char*		str		= (const char*)getBytes(length);
+
+		return string(str, str+length);
+	}
+
+	const deUint8* getBytes (size_t numBytes)
+	{
+		const deUint8* ptr = m_data + m_pos;
+
+		check(numBytes);
+		m_pos += numBytes;
+
+		return ptr;
+	}
+
+	size_t getNumRemaining (void) const
+	{
+		return m_size - m_pos;
+	}
+
+private:
+	void check (size_t numBytes) const
+	{
+		if (m_size - m_pos < numBytes)
+			throw BinaryLogParseError("Truncated binary log record");
+	}
+
+	const deUint8*	m_data;
+	size_t			m_size;
+	size_t			m_pos;
+};
+
+BinaryLogParser::BinaryLogParser (void)
+	: m_magicOk				(false)
+	, m_elementDepth		(0)
+	, m_prevIsStartElement	(false)
+{
+}
+
+BinaryLogParser::~BinaryLogParser (void)
+{
+}
+
+void BinaryLogParser::clear (void)
+{
+	m_buf.clear();
+	m_magicOk				= false;
+	m_elementDepth			= 0;
+	m_prevIsStartElement	= false;
+}
+
+bool BinaryLogParser::isBinaryLogStart (deUint8 firstByte)
+{
+	return firstByte == s_magic[0];
+}
+
+void BinaryLogParser::feed (const deUint8* bytes, size_t numBytes, string& dst)
+{
+	size_t pos = 0;
+
+	m_buf.insert(m_buf.end(), bytes, bytes+numBytes);
+
+	if (!m_magicOk)
+	{
+		if (m_buf.size() < (size_t)MAGIC_SIZE)
+			return;
+
+		if (memcmp(&m_buf[0], &s_magic[0], MAGIC_SIZE) != 0)
+			throw BinaryLogParseError("Invalid binary log header");
+
+		m_magicOk	= true;
+		pos			= MAGIC_SIZE;
+	}
+
+	while (pos < m_buf.size())
+	{
+		const deUint8	tag				= m_buf[pos];
+		size_t			payloadPos		= pos+1;
+		deUint64		payloadSize		= 0;
+		bool			sizeComplete	= false;
+
+		for (int shift = 0; payloadPos < m_buf.size() && shift < 64; shift += 7)
+		{
+			const deUint8 byte = m_buf[payloadPos++];
+
+			payloadSize |= (deUint64)(byte & 0x7f) << shift;
+
+			if ((byte & 0x80) == 0)
+			{
+				sizeComplete = true;
+				break;
+			}
+		}
+
+		if (!sizeComplete || (deUint64)(m_buf.size() - payloadPos) < payloadSize)
+			break; // Wait for rest of the record.
+
+		{
+			Reader payload (&m_buf[0] + payloadPos, (size_t)payloadSize);
+			parseRecord(tag, payload, dst);
+		}
+
+		pos = payloadPos + (size_t)payloadSize;
+	}
+
+	m_buf.erase(m_buf.begin(), m_buf.begin() + pos);
+}
+
+void BinaryLogParser::parseRecord (deUint8 tag, Reader& payload, string& dst)
+{
+	switch (tag)
+	{
+		case TAG_SESSION_INFO:
+		{
+			const string attribute	= payload.getString();
+			const string value		= payload.getString();
+
+			dst += "#sessionInfo " + attribute + " " + value + "\n";
+			break;
+		}
+
+		case TAG_BEGIN_SESSION:
+			dst += "#beginSession\n";
+			break;
+
+		case TAG_END_SESSION:
+			closePending(dst);
+			dst += "\n#endSession\n";
+			break;
+
+		case TAG_BEGIN_TEST_CASE_RESULT:
+			closePending(dst);
+			dst += "\n#beginTestCaseResult " + payload.getString() + "\n";
+			break;
+
+		case TAG_END_TEST_CASE_RESULT:
+			closePending(dst);
+			dst += "\n#endTestCaseResult\n";
+			break;
+
+		case TAG_TERMINATE_TEST_CASE_RESULT:
+			closePending(dst);
+			dst += "\n#terminateTestCaseResult " + payload.getString() + "\n";
+			break;
+
+		case TAG_START_DOCUMENT:
+			startDocument(dst);
+			break;
+
+		case TAG_END_DOCUMENT:
+			closePending(dst);
+			break;
+
+		case TAG_START_ELEMENT:
+			startElement(payload, dst);
+			break;
+
+		case TAG_END_ELEMENT:
+			endElement(payload.getString(), dst);
+			break;
+
+		case TAG_STRING:
+		{
+			const size_t length = payload.getNumRemaining();
+			writeString((const char*)payload.getBytes(length), length, dst);
+			break;
+		}
+
+		case TAG_INT64:
+		{
+			char buf[32];
+			deSprintf(buf, sizeof(buf), "%lld", (long long)payload.getSignedVarint());
+			writeString(buf, strlen(buf), dst);
+			break;
+		}
+
+		case TAG_FLOAT:
+		{
+			const deUint32	bits	= (deUint32)payload.getFixed(4);
+			float			value;
+			char			buf[64];
+
+			DE_STATIC_ASSERT(sizeof(value) == sizeof(bits));
+			deMemcpy(&value, &bits, sizeof(value));
+
+			deSprintf(buf, sizeof(buf), "%f", value);
+			writeString(buf, strlen(buf), dst);
+			break;
+		}
+
+		case TAG_DOUBLE:
+		{
+			const deUint64	bits	= payload.getFixed(8);
+			double			value;
+			char			buf[512];
+
+			DE_STATIC_ASSERT(sizeof(value) == sizeof(bits));
+			deMemcpy(&value, &bits, sizeof(value));
+
+			deSprintf(buf, sizeof(buf), "%f", value);
+			writeString(buf, strlen(buf), dst);
+			break;
+		}
+
+		case TAG_DATA:
+		{
+			const size_t numBytes = payload.getNumRemaining();
+			writeBase64(payload.getBytes(numBytes), numBytes, dst);
+			break;
+		}
+
+		default:
+			// Unknown records are skipped for forward compatibility.
+			break;
+	}
+}
+
+void BinaryLogParser::closePending (string& dst)
+{
+	if (m_prevIsStartElement)
+	{
+		dst += ">\n";
+		m_prevIsStartElement = false;
+	}
+}
+
+void BinaryLogParser::startDocument (string& dst)
+{
+	m_elementDepth			= 0;
+	m_prevIsStartElement	= false;
+
+	dst += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+}
+
+void BinaryLogParser::startElement (Reader& payload, string& dst)
+{
+	const string	elementName	= payload.getString();
+	const deUint64	numAttribs	= payload.getVarint();
+
+	closePending(dst);
+
+	dst += getIndentStr(m_elementDepth);
+	dst += "<" + elementName;
+
+	for (deUint64 ndx = 0; ndx < numAttribs; ndx++)
+	{
+		const string	name	= payload.getString();
+		const deUint8	type	= payload.getByte();
+
+		dst += " " + name + "=\"";
+
+		switch (type)
+		{
+			case ATTRIBUTETYPE_STRING:
+			{
+				const string value = payload.getString();
+				appendEscaped(dst, value.c_str(), value.length());
+				break;
+			}
+
+			case ATTRIBUTETYPE_INT:
+			{
+				char buf[64];
+				deSprintf(buf, sizeof(buf), "%d", (int)payload.getSignedVarint());
+				appendEscaped(dst, buf, strlen(buf));
+				break;
+			}
+
+			case ATTRIBUTETYPE_BOOL:
+				dst += payload.getByte() ? "True" : "False";
+				break;
+
+			default:
+				throw BinaryLogParseError("Unknown attribute type");
+		}
+
+		dst += "\"";
+	}
+
+	m_elementDepth			+= 1;
+	m_prevIsStartElement	= true;
+}
+
+void BinaryLogParser::endElement (const string& elementName, string& dst)
+{
+	if (m_elementDepth <= 0)
+		throw BinaryLogParseError("Unbalanced end element");
+
+	m_elementDepth -= 1;
+
+	if (m_prevIsStartElement)
+	{
+		dst += " />\n";
+		m_prevIsStartElement = false;
+	}
+	else
+		dst += "</" + elementName + ">\n";
+}
+
+void BinaryLogParser::writeString (const char* str, size_t length, string& dst)
+{
+	if (m_prevIsStartElement)
+	{
+		dst += ">";
+		m_prevIsStartElement = false;
+	}
+
+	appendEscaped(dst, str, length);
+}
+
+void BinaryLogParser::writeBase64 (const deUint8* data, size_t numBytes, string& dst)
+{
+	static const char s_base64Table[64] =
+	{
+		'A','B','C','D','E','F','G','H','I','J','K','L','M',
+		'N','O','P','Q','R','S','T','U','V','W','X','Y','Z',
+		'a','b','c','d','e','f','g','h','i','j','k','l','m',
+		'n','o','p','q','r','s','t','u','v','w','x','y','z',
+		'0','1','2','3','4','5','6','7','8','9','+','/'
+	};
+
+	// \note Line layout must match qpXmlWriter_writeBase64().
+	const char*		indentStr	= getIndentStr(m_elementDepth);
+	int				numWritten	= 0;
+
+	closePending(dst);
+
+	dst.reserve(dst.size() + (numBytes+2)/3*4 + (numBytes/48+1)*(strlen(indentStr)+1));
+
+	for (size_t srcNdx = 0; srcNdx < numBytes; srcNdx += 3)
+	{
+		const size_t	numRead	= de::min<size_t>(3, numBytes - srcNdx);
+		const deUint8	s0		= data[srcNdx];
+		const deUint8	s1		= (numRead >= 2) ? data[srcNdx+1] : 0;
+		const deUint8	s2		= (numRead >= 3) ? data[srcNdx+2] : 0;
+
+		if (numWritten == 0)
+			dst += indentStr;
+
+		dst += s_base64Table[s0 >> 2];
+		dst += s_base64Table[((s0&0x3)<<4) | (s1>>4)];
+		dst += (numRead >= 2) ? s_base64Table[((s1&0xF)<<2) | (s2>>6)] : '=';
+		dst += (numRead >= 3) ? s_base64Table[s2&0x3F] : '=';
+
+		numWritten += 4;
+		if (numWritten >= 64)
+		{
+			dst += "\n";
+			numWritten = 0;
+		}
+	}
+
+	if (numWritten > 0)
+		dst += "\n";
+}
+
+} // xe
@@ -0,0 +1,88 @@
+#ifndef _XEBINARYLOGPARSER_HPP
+#define _XEBINARYLOGPARSER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary test log parser.
+ *
+ * Decodes binary test logs written by qpBinaryLogWriter into the text
+ * container format with XML test case results. Output is byte-identical
+ * to what qpTestLog writes when using the XML backend.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+
+#include <string>
+#include <vector>
+
+namespace xe
+{
+
+class BinaryLogParseError : public ParseError
+{
+public:
+	BinaryLogParseError (const std::string& message) : ParseError(message) {}
+};
+
+class BinaryLogParser
+{
+public:
+	enum
+	{
+		MAGIC_SIZE	= 8
+	};
+
+								BinaryLogParser		(void);
+								~BinaryLogParser	(void);
+
+	void						clear				(void);
+
+	//! Decode bytes and append text format log for all complete records to dst.
+	void						feed				(const deUint8* bytes, size_t numBytes, std::string& dst);
+
+	//! Check if log starting with given byte is a binary log.
+	static bool					isBinaryLogStart	(deUint8 firstByte);
+
+private:
+								BinaryLogParser		(const BinaryLogParser& other);
+	BinaryLogParser&			operator=			(const BinaryLogParser& other);
+
+	class Reader;
+
+	void						parseRecord			(deUint8 tag, Reader& payload, std::string& dst);
+
+	void						closePending		(std::string& dst);
+	void						startDocument		(std::string& dst);
+	void						startElement		(Reader& payload, std::string& dst);
+	void						endElement			(const std::string& elementName, std::string& dst);
+	void						writeString			(const char* str, size_t length, std::string& dst);
+	void						writeBase64			(const deUint8* data, size_t numBytes, std::string& dst);
+
+	std::vector<deUint8>		m_buf;				//!< Unparsed bytes.
+	bool						m_magicOk;
+
+	// XML writer state.
+	int							m_elementDepth;
+	bool						m_prevIsStartElement;
+};
+
+} // xe
+
+#endif // _XEBINARYLOGPARSER_HPP
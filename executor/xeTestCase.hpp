@@ -64,6 +64,7 @@ public:
 
 	TestNodeType		getNodeType			(void) const { return m_nodeType;		}
 	const char*			getName				(void) const { return m_name.c_str();	}
+	const char*			getDescription		(void) const { return m_description.c_str();	}
 	const TestGroup*	getParent			(void) const { return m_parent;			}
 
 	void				getFullPath			(std::string& path) const;
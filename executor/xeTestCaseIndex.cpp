@@ -0,0 +1,263 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Flat test case index.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestCaseIndex.hpp"
+#include "deInt32.h"
+#include "deString.h"
+
+#include <cstring>
+
+namespace xe
+{
+
+// TestCaseIndex
+
+TestCaseIndex::TestCaseIndex (const TestNode* root)
+{
+	m_pathData.push_back(0);
+	addNode(root, -1);
+	buildHashTable();
+}
+
+TestCaseIndex::~TestCaseIndex (void)
+{
+}
+
+void TestCaseIndex::addNode (const TestNode* node, int parentNdx)
+{
+	const int	nodeNdx	= (int)m_nodes.size();
+	Node		entry;
+
+	entry.node			= node;
+	entry.parentNdx		= parentNdx;
+	entry.subtreeEnd	= nodeNdx+1;
+	entry.caseBegin		= (int)m_caseNodes.size();
+	entry.caseEnd		= entry.caseBegin;
+	entry.pathOffset	= 0;
+
+	if (parentNdx >= 0)
+	{
+		const int		parentPathOffset	= m_nodes[parentNdx].pathOffset;
+		const size_t	parentPathLen		= strlen(&m_pathData[parentPathOffset]);
+		const char*		name				= node->getName();
+
+		entry.pathOffset = (int)m_pathData.size();
+
+		if (parentPathLen > 0)
+		{
+			// \note Copy through index, m_pathData may be reallocated by insert().
+			for (size_t ndx = 0; ndx < parentPathLen; ndx++)
+				m_pathData.push_back(m_pathData[parentPathOffset + ndx]);
+			m_pathData.push_back('.');
+		}
+
+		m_pathData.insert(m_pathData.end(), name, name + strlen(name));
+		m_pathData.push_back(0);
+	}
+
+	m_nodes.push_back(entry);
+
+	if (node->getNodeType() == TESTNODETYPE_TEST_CASE)
+		m_caseNodes.push_back(nodeNdx);
+	else
+	{
+		const TestGroup* const group = static_cast<const TestGroup*>(node);
+
+		for (int childNdx = 0; childNdx < group->getNumChildren(); childNdx++)
+			addNode(group->getChild(childNdx), nodeNdx);
+	}
+
+	m_nodes[nodeNdx].subtreeEnd	= (int)m_nodes.size();
+	m_nodes[nodeNdx].caseEnd	= (int)m_caseNodes.size();
+}
+
+void TestCaseIndex::buildHashTable (void)
+{
+	size_t tableSize = 16;
+
+	while (tableSize < m_nodes.size()*2)
+		tableSize *= 2;
+
+	m_hashTable.resize(tableSize, -1);
+
+	for (int nodeNdx = 0; nodeNdx < (int)m_nodes.size(); nodeNdx++)
+	{
+		size_t slot = deStringHash(getPath(nodeNdx)) & (tableSize-1);
+
+		while (m_hashTable[slot] >= 0)
+			slot = (slot+1) & (tableSize-1);
+
+		m_hashTable[slot] = nodeNdx;
+	}
+}
+
+int TestCaseIndex::findNode (const char* path) const
+{
+	const size_t	tableSize	= m_hashTable.size();
+	size_t			slot		= deStringHash(path) & (tableSize-1);
+
+	for (;;)
+	{
+		const int nodeNdx = m_hashTable[slot];
+
+		if (nodeNdx < 0)
+			return -1;
+		else if (deStringEqual(getPath(nodeNdx), path))
+			return nodeNdx;
+
+		slot = (slot+1) & (tableSize-1);
+	}
+}
+
+int TestCaseIndex::findCase (const char* path) const
+{
+	const int nodeNdx = findNode(path);
+
+	// \note Case index of a case node is the start of its case range.
+	if (nodeNdx >= 0 && isCase(nodeNdx))
+		return getCaseBegin(nodeNdx);
+	else
+		return -1;
+}
+
+// TestCaseBitSet
+
+TestCaseBitSet::TestCaseBitSet (int numCases)
+	: m_numCases	(numCases)
+	, m_words		((numCases+31)/32, 0u)
+{
+}
+
+bool TestCaseBitSet::empty (void) const
+{
+	for (size_t wordNdx = 0; wordNdx < m_words.size(); wordNdx++)
+	{
+		if (m_words[wordNdx] != 0)
+			return false;
+	}
+
+	return true;
+}
+
+int TestCaseBitSet::count (void) const
+{
+	int numCases = 0;
+
+	for (size_t wordNdx = 0; wordNdx < m_words.size(); wordNdx++)
+		numCases += dePop32(m_words[wordNdx]);
+
+	return numCases;
+}
+
+bool TestCaseBitSet::containsAny (int begin, int end) const
+{
+	DE_ASSERT(de::inBounds(begin, 0, m_numCases+1) && de::inRange(end, begin, m_numCases));
+
+	for (int wordNdx = begin/32; wordNdx*32 < end; wordNdx++)
+	{
+		const int	wordBegin	= wordNdx*32;
+		deUint32	word		= m_words[wordNdx];
+
+		if (begin > wordBegin)
+			word &= ~0u << (begin - wordBegin);
+
+		if (end - wordBegin < 32)
+			word &= (1u << (end - wordBegin)) - 1u;
+
+		if (word != 0)
+			return true;
+	}
+
+	return false;
+}
+
+int TestCaseBitSet::findNext (int caseNdx) const
+{
+	int wordNdx = caseNdx/32;
+
+	if (caseNdx >= m_numCases)
+		return m_numCases;
+
+	{
+		const deUint32 word = m_words[wordNdx] & (~0u << (caseNdx%32));
+
+		if (word != 0)
+			return wordNdx*32 + deCtz32(word);
+	}
+
+	for (wordNdx++; wordNdx < (int)m_words.size(); wordNdx++)
+	{
+		if (m_words[wordNdx] != 0)
+			return wordNdx*32 + deCtz32(m_words[wordNdx]);
+	}
+
+	return m_numCases;
+}
+
+void getTestSetCases (TestCaseBitSet& dst, const TestCaseIndex& index, const TestSet& testSet)
+{
+	dst = TestCaseBitSet(index.getNumCases());
+
+	for (int caseNdx = 0; caseNdx < index.getNumCases(); caseNdx++)
+	{
+		if (testSet.hasNode(index.getNode(index.getCaseNode(caseNdx))))
+			dst.add(caseNdx);
+	}
+}
+
+static void writeCaseListNode (std::ostream& str, const TestCaseIndex& index, int nodeNdx, const TestCaseBitSet& cases)
+{
+	DE_ASSERT(cases.containsAny(index.getCaseBegin(nodeNdx), index.getCaseEnd(nodeNdx)));
+
+	if (index.getParent(nodeNdx) >= 0)
+		str << index.getNode(nodeNdx)->getName();
+
+	if (!index.isCase(nodeNdx))
+	{
+		bool isFirst = true;
+
+		str << "{";
+
+		for (int childNdx = nodeNdx+1; childNdx < index.getSubtreeEnd(nodeNdx); childNdx = index.getSubtreeEnd(childNdx))
+		{
+			if (cases.containsAny(index.getCaseBegin(childNdx), index.getCaseEnd(childNdx)))
+			{
+				if (!isFirst)
+					str << ",";
+
+				writeCaseListNode(str, index, childNdx, cases);
+				isFirst = false;
+			}
+		}
+
+		str << "}";
+	}
+}
+
+void writeCaseListTrie (std::ostream& str, const TestCaseIndex& index, const TestCaseBitSet& cases)
+{
+	DE_ASSERT(!cases.empty());
+	writeCaseListNode(str, index, 0, cases);
+}
+
+} // xe
@@ -0,0 +1,135 @@
+#ifndef _XETESTCASEINDEX_HPP
+#define _XETESTCASEINDEX_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Flat test case index.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeTestCase.hpp"
+
+#include <vector>
+#include <ostream>
+
+namespace xe
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Flat index of test hierarchy
+ *
+ * Nodes are stored in depth-first pre-order, so sub-tree of a node is a
+ * contiguous range of node indices, and test cases of a sub-tree are a
+ * contiguous range of case indices. Full paths of all nodes are stored in
+ * a single buffer and can be looked up with a hash table.
+ *
+ * Index doesn't track changes to the hierarchy after it has been built.
+ *//*--------------------------------------------------------------------*/
+class TestCaseIndex
+{
+public:
+							TestCaseIndex		(const TestNode* root);
+							~TestCaseIndex		(void);
+
+	int						getNumNodes			(void) const				{ return (int)m_nodes.size();					}
+	int						getNumCases			(void) const				{ return (int)m_caseNodes.size();				}
+
+	const TestNode*			getNode				(int nodeNdx) const			{ return m_nodes[nodeNdx].node;					}
+	int						getParent			(int nodeNdx) const			{ return m_nodes[nodeNdx].parentNdx;			}
+	int						getSubtreeEnd		(int nodeNdx) const			{ return m_nodes[nodeNdx].subtreeEnd;			}
+	int						getCaseBegin		(int nodeNdx) const			{ return m_nodes[nodeNdx].caseBegin;			}
+	int						getCaseEnd			(int nodeNdx) const			{ return m_nodes[nodeNdx].caseEnd;				}
+	bool					isCase				(int nodeNdx) const			{ return m_nodes[nodeNdx].node->getNodeType() == TESTNODETYPE_TEST_CASE; }
+
+	//! Full path of node, empty for root.
+	const char*				getPath				(int nodeNdx) const			{ return &m_pathData[m_nodes[nodeNdx].pathOffset];	}
+
+	int						getCaseNode			(int caseNdx) const			{ return m_caseNodes[caseNdx];					}
+	const char*				getCasePath			(int caseNdx) const			{ return getPath(m_caseNodes[caseNdx]);			}
+
+	//! Find node by full path. Returns -1 if not found.
+	int						findNode			(const char* path) const;
+
+	//! Find case index by full path. Returns -1 if not found or node is not a test case.
+	int						findCase			(const char* path) const;
+
+private:
+							TestCaseIndex		(const TestCaseIndex& other);
+	TestCaseIndex&			operator=			(const TestCaseIndex& other);
+
+	struct Node
+	{
+		const TestNode*		node;
+		int					parentNdx;
+		int					subtreeEnd;		//!< One past last node in sub-tree.
+		int					caseBegin;
+		int					caseEnd;
+		int					pathOffset;
+	};
+
+	void					addNode				(const TestNode* node, int parentNdx);
+	void					buildHashTable		(void);
+
+	std::vector<Node>		m_nodes;
+	std::vector<int>		m_caseNodes;		//!< Node index by case index.
+	std::vector<char>		m_pathData;			//!< Null-terminated full paths.
+	std::vector<int>		m_hashTable;		//!< Node indices, -1 for empty slot.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Set of test cases in TestCaseIndex
+ *
+ * Cases are identified by case index.
+ *//*--------------------------------------------------------------------*/
+class TestCaseBitSet
+{
+public:
+							TestCaseBitSet		(void) : m_numCases(0) {}
+	explicit				TestCaseBitSet		(int numCases);
+
+	int						getNumCases			(void) const	{ return m_numCases; }
+
+	void					add					(int caseNdx)			{ m_words[caseNdx/32] |= 1u << (caseNdx%32);				}
+	void					remove				(int caseNdx)			{ m_words[caseNdx/32] &= ~(1u << (caseNdx%32));				}
+	bool					contains			(int caseNdx) const		{ return (m_words[caseNdx/32] & (1u << (caseNdx%32))) != 0;	}
+
+	bool					empty				(void) const;
+	int						count				(void) const;
+
+	//! Does the set contain any case in range [begin, end).
+	bool					containsAny			(int begin, int end) const;
+
+	//! Get first case in set with index >= caseNdx, or getNumCases() if none.
+	int						findNext			(int caseNdx) const;
+
+private:
+	int						m_numCases;
+	std::vector<deUint32>	m_words;
+};
+
+//! Compute set of cases in testSet.
+void getTestSetCases (TestCaseBitSet& dst, const TestCaseIndex& index, const TestSet& testSet);
+
+//! Write cases in set as a case list trie, such as "{group{case1,case2}}". Set must not be empty.
+void writeCaseListTrie (std::ostream& str, const TestCaseIndex& index, const TestCaseBitSet& cases);
+
+} // xe
+
+#endif // _XETESTCASEINDEX_HPP
@@ -143,4 +143,130 @@ void TestCaseListParser::parse (const deUint8* bytes, int numBytes)
 	}
 }
 
+namespace
+{
+
+// \note Must match BinaryCaseListWriter in tcuTestHierarchyUtil.cpp
+enum BinaryCaseListCode
+{
+	BINCASELIST_END = 0,
+	BINCASELIST_GROUP,
+	BINCASELIST_SELF_VALIDATE,
+	BINCASELIST_CAPABILITY,
+	BINCASELIST_ACCURACY,
+	BINCASELIST_PERFORMANCE,
+
+	BINCASELIST_LAST
+};
+
+enum
+{
+	BINCASELIST_FORMAT_VERSION = 1
+};
+
+class BinaryCaseListReader
+{
+public:
+	BinaryCaseListReader (const deUint8* bytes, size_t numBytes)
+		: m_bytes		(bytes)
+		, m_numBytes	(numBytes)
+		, m_pos			(0)
+	{
+	}
+
+	bool isEnd (void) const
+	{
+		return m_pos == m_numBytes;
+	}
+
+	deUint8 readUint8 (void)
+	{
+		XE_CHECK_MSG(m_pos < m_numBytes, "Unexpected end of binary case list");
+		return m_bytes[m_pos++];
+	}
+
+	deUint32 readUint32 (void)
+	{
+		deUint32 value = 0;
+
+		XE_CHECK_MSG(m_numBytes - m_pos >= 4, "Unexpected end of binary case list");
+
+		for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+			value |= (deUint32)m_bytes[m_pos++] << (8*byteNdx);
+
+		return value;
+	}
+
+	void readString (string& dst)
+	{
+		const deUint32 length = readUint32();
+
+		XE_CHECK_MSG(m_numBytes - m_pos >= length, "Unexpected end of binary case list");
+
+		dst.assign((const char*)m_bytes + m_pos, length);
+		m_pos += length;
+	}
+
+private:
+	const deUint8*	m_bytes;
+	size_t			m_numBytes;
+	size_t			m_pos;
+};
+
+TestCaseType getBinaryTestCaseType (deUint8 code)
+{
+	switch (code)
+	{
+		case BINCASELIST_SELF_VALIDATE:	return TESTCASETYPE_SELF_VALIDATE;
+		case BINCASELIST_CAPABILITY:	return TESTCASETYPE_CAPABILITY;
+		case BINCASELIST_ACCURACY:		return TESTCASETYPE_ACCURACY;
+		case BINCASELIST_PERFORMANCE:	return TESTCASETYPE_PERFORMANCE;
+		default:
+			XE_FAIL("Unknown node type in binary case list");
+	}
+}
+
+} // anonymous
+
+void parseBinaryCaseList (TestGroup* rootGroup, const deUint8* bytes, size_t numBytes)
+{
+	static const char		s_magic[]	= { 'd', 'Q', 'C', 'L' };
+	BinaryCaseListReader	reader		(bytes, numBytes);
+	vector<TestGroup*>		groupStack;
+	string					name;
+	string					description;
+
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_magic); ndx++)
+		XE_CHECK_MSG(reader.readUint8() == (deUint8)s_magic[ndx], "Not a binary case list");
+
+	XE_CHECK_MSG(reader.readUint32() == BINCASELIST_FORMAT_VERSION, "Unsupported binary case list version");
+
+	// Package name and description are not stored in the tree.
+	reader.readString(name);
+	reader.readString(description);
+
+	groupStack.push_back(rootGroup);
+
+	while (!groupStack.empty())
+	{
+		const deUint8 code = reader.readUint8();
+
+		if (code == BINCASELIST_END)
+		{
+			groupStack.pop_back();
+			continue;
+		}
+
+		reader.readString(name);
+		reader.readString(description);
+
+		if (code == BINCASELIST_GROUP)
+			groupStack.push_back(groupStack.back()->createGroup(name.c_str(), description.c_str()));
+		else
+			groupStack.back()->createCase(getBinaryTestCaseType(code), name.c_str(), description.c_str());
+	}
+
+	XE_CHECK_MSG(reader.isEnd(), "Trailing data in binary case list");
+}
+
 } // xe
@@ -53,6 +53,9 @@ private:
 	std::vector<TestNode*>	m_nodeStack;
 };
 
+//! Parse case list written with --deqp-runmode=bin-caselist into rootGroup.
+void parseBinaryCaseList (TestGroup* rootGroup, const deUint8* bytes, size_t numBytes);
+
 } // xe
 
 #endif // _XETESTCASELISTPARSER_HPP
@@ -267,6 +267,7 @@ public:
 	int						height;
 	Format					format;
 	Compression				compression;
+	std::string				file;		//!< Name of external pixel data file relative to log, empty if data is inline.
 	std::vector<deUint8>	data;
 };
 
@@ -32,7 +32,8 @@ namespace xe
 {
 
 TestLogParser::TestLogParser (TestLogHandler* handler)
-	: m_handler		(handler)
+	: m_format		(LOGFORMAT_UNKNOWN)
+	, m_handler		(handler)
 	, m_inSession	(false)
 {
 }
@@ -43,6 +44,8 @@ TestLogParser::~TestLogParser (void)
 
 void TestLogParser::reset (void)
 {
+	m_format = LOGFORMAT_UNKNOWN;
+	m_binaryParser.clear();
 	m_containerParser.clear();
 	m_currentCaseData.clear();
 	m_sessionInfo	= SessionInfo();
@@ -50,6 +53,24 @@ void TestLogParser::reset (void)
 }
 
 void TestLogParser::parse (const deUint8* bytes, size_t numBytes)
+{
+	if (m_format == LOGFORMAT_UNKNOWN && numBytes > 0)
+		m_format = BinaryLogParser::isBinaryLogStart(bytes[0]) ? LOGFORMAT_BINARY : LOGFORMAT_TEXT;
+
+	if (m_format == LOGFORMAT_BINARY)
+	{
+		// Binary records are decoded into text format and parsed as usual.
+		m_decodedData.clear();
+		m_binaryParser.feed(bytes, numBytes, m_decodedData);
+
+		if (!m_decodedData.empty())
+			parseContainer((const deUint8*)m_decodedData.c_str(), m_decodedData.size());
+	}
+	else
+		parseContainer(bytes, numBytes);
+}
+
+void TestLogParser::parseContainer (const deUint8* bytes, size_t numBytes)
 {
 	m_containerParser.feed(bytes, numBytes);
 
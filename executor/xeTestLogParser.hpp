@@ -26,6 +26,7 @@
 #include "xeDefs.hpp"
 #include "xeTestCaseResult.hpp"
 #include "xeContainerFormatParser.hpp"
+#include "xeBinaryLogParser.hpp"
 #include "xeTestResultParser.hpp"
 #include "xeBatchResult.hpp"
 
@@ -62,6 +63,20 @@ private:
 							TestLogParser			(const TestLogParser& other);
 	TestLogParser&			operator=				(const TestLogParser& other);
 
+	void					parseContainer			(const deUint8* bytes, size_t numBytes);
+
+	enum LogFormat
+	{
+		LOGFORMAT_UNKNOWN = 0,	//!< No data received yet.
+		LOGFORMAT_TEXT,
+		LOGFORMAT_BINARY,
+
+		LOGFORMAT_LAST
+	};
+
+	LogFormat				m_format;
+	BinaryLogParser			m_binaryParser;
+	std::string				m_decodedData;			//!< Binary log decoded to text format.
 	ContainerFormatParser	m_containerParser;
 	TestLogHandler*			m_handler;
 
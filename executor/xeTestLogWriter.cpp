@@ -61,7 +61,7 @@ std::ostream& operator<< (std::ostream& stream, const ContainerValue& value)
 	return stream;
 }
 
-static void writeSessionInfo (const SessionInfo& info, std::ostream& stream)
+void writeSessionInfo (const SessionInfo& info, std::ostream& stream)
 {
 	if (!info.releaseName.empty())
 		stream << "#sessionInfo releaseName " << ContainerValue(info.releaseName) << "\n";
@@ -86,9 +86,24 @@ static void writeSessionInfo (const SessionInfo& info, std::ostream& stream)
 		stream << "#sessionInfo timestamp " << info.timestamp << "\n";
 }
 
+void writeTestCaseBegin (const char* casePath, std::ostream& stream)
+{
+	stream << "\n#beginTestCaseResult " << casePath << "\n";
+}
+
+void writeTestCaseEnd (TestStatusCode statusCode, std::ostream& stream)
+{
+	if (statusCode == TESTSTATUSCODE_CRASH		||
+		statusCode == TESTSTATUSCODE_TIMEOUT	||
+		statusCode == TESTSTATUSCODE_TERMINATED)
+		stream << "#terminateTestCaseResult " << getTestStatusCodeName(statusCode) << "\n";
+	else
+		stream << "#endTestCaseResult\n";
+}
+
 static void writeTestCase (const TestCaseResultData& caseData, std::ostream& stream)
 {
-	stream << "\n#beginTestCaseResult " << caseData.getTestCasePath() << "\n";
+	writeTestCaseBegin(caseData.getTestCasePath(), stream);
 
 	if (caseData.getDataSize() > 0)
 	{
@@ -99,13 +114,7 @@ static void writeTestCase (const TestCaseResultData& caseData, std::ostream& str
 			stream << "\n";
 	}
 
-	TestStatusCode dataCode = caseData.getStatusCode();
-	if (dataCode == TESTSTATUSCODE_CRASH	||
-		dataCode == TESTSTATUSCODE_TIMEOUT	||
-		dataCode == TESTSTATUSCODE_TERMINATED)
-		stream << "#terminateTestCaseResult " << getTestStatusCodeName(dataCode) << "\n";
-	else
-		stream << "#endTestCaseResult\n";
+	writeTestCaseEnd(caseData.getStatusCode(), stream);
 }
 
 void writeTestLog (const BatchResult& result, std::ostream& stream)
@@ -269,8 +278,12 @@ static void writeResultItem (const ri::Item& item, xml::Writer& dst)
 				<< Writer::Attribute("Width",			de::toString(image.width))
 				<< Writer::Attribute("Height",			de::toString(image.height))
 				<< Writer::Attribute("Format",			getImageFormatName(image.format))
-				<< Writer::Attribute("CompressionMode",	getImageCompressionName(image.compression))
-				<< toBase64(&image.data[0], (int)image.data.size())
+				<< Writer::Attribute("CompressionMode",	getImageCompressionName(image.compression));
+
+			if (!image.file.empty())
+				dst << Writer::Attribute("File", image.file);
+
+			dst << toBase64(image.data.empty() ? DE_NULL : &image.data[0], (int)image.data.size())
 				<< Writer::EndElement;
 			break;
 		}
@@ -40,6 +40,11 @@ class Writer;
 void	writeTestLog			(const BatchResult& batchResult, std::ostream& stream);
 void	writeBatchResultToFile	(const BatchResult& batchResult, const char* filename);
 
+// Building blocks for writing test logs incrementally.
+void	writeSessionInfo		(const SessionInfo& info, std::ostream& stream);
+void	writeTestCaseBegin		(const char* casePath, std::ostream& stream);
+void	writeTestCaseEnd		(TestStatusCode statusCode, std::ostream& stream);
+
 void	writeTestResult			(const TestCaseResult& result, xe::xml::Writer& writer);
 void	writeTestResult			(const TestCaseResult& result, std::ostream& stream);
 void	writeTestResultToFile	(const TestCaseResult& result, const char* filename);
@@ -0,0 +1,154 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Match test case results of several logs by case path.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestResultMatcher.hpp"
+
+#include <deque>
+#include <map>
+#include <set>
+
+namespace xe
+{
+
+using std::vector;
+using std::string;
+using std::map;
+
+namespace
+{
+
+//! Source state: results read ahead while looking for other cases, and paths already read.
+class PendingSource
+{
+public:
+							PendingSource	(TestResultSource& source) : m_source(&source) {}
+
+	bool					getNext			(TestCaseResultHeader& dst);
+	bool					find			(const string& casePath, TestCaseResultHeader& dst);
+
+private:
+	bool					readNew			(TestCaseResultHeader& dst);
+
+	TestResultSource*						m_source;
+	map<string, TestCaseResultHeader>		m_pending;
+	std::deque<string>						m_order;
+	std::set<string>						m_seen;
+};
+
+//! Read next result whose path hasn't been seen in this source yet.
+bool PendingSource::readNew (TestCaseResultHeader& dst)
+{
+	while (m_source->getNext(dst))
+	{
+		if (m_seen.insert(dst.casePath).second)
+			return true;
+	}
+
+	return false;
+}
+
+bool PendingSource::getNext (TestCaseResultHeader& dst)
+{
+	while (!m_order.empty())
+	{
+		const map<string, TestCaseResultHeader>::iterator pos = m_pending.find(m_order.front());
+
+		m_order.pop_front();
+
+		// Results already matched through other sources have been removed.
+		if (pos != m_pending.end())
+		{
+			dst = pos->second;
+			m_pending.erase(pos);
+			return true;
+		}
+	}
+
+	return readNew(dst);
+}
+
+bool PendingSource::find (const string& casePath, TestCaseResultHeader& dst)
+{
+	const map<string, TestCaseResultHeader>::iterator pos = m_pending.find(casePath);
+
+	if (pos != m_pending.end())
+	{
+		dst = pos->second;
+		m_pending.erase(pos);
+		return true;
+	}
+
+	// Case has been read and matched already.
+	if (m_seen.find(casePath) != m_seen.end())
+		return false;
+
+	while (readNew(dst))
+	{
+		if (dst.casePath == casePath)
+			return true;
+
+		m_pending[dst.casePath] = dst;
+		m_order.push_back(dst.casePath);
+	}
+
+	return false;
+}
+
+void setMissingResult (TestCaseResultHeader& dst, const string& casePath)
+{
+	dst					= TestCaseResultHeader();
+	dst.casePath		= casePath;
+	dst.caseType		= TESTCASETYPE_SELF_VALIDATE;
+	dst.statusCode		= TESTSTATUSCODE_LAST;
+}
+
+} // anonymous
+
+void matchTestResults (const vector<TestResultSource*>& sources, MatchedResultHandler& handler)
+{
+	const int						numSources	= (int)sources.size();
+	vector<PendingSource>			pending;
+	vector<TestCaseResultHeader>	results		(numSources);
+
+	for (int ndx = 0; ndx < numSources; ndx++)
+		pending.push_back(PendingSource(*sources[ndx]));
+
+	// All cases present in earlier sources have been matched by the time a source is reached.
+	for (int refNdx = 0; refNdx < numSources; refNdx++)
+	{
+		while (pending[refNdx].getNext(results[refNdx]))
+		{
+			const string casePath = results[refNdx].casePath;
+
+			for (int ndx = 0; ndx < numSources; ndx++)
+			{
+				if (ndx < refNdx || (ndx > refNdx && !pending[ndx].find(casePath, results[ndx])))
+					setMissingResult(results[ndx], casePath);
+			}
+
+			handler.matched(results);
+		}
+	}
+}
+
+} // xe
@@ -0,0 +1,65 @@
+#ifndef _XETESTRESULTMATCHER_HPP
+#define _XETESTRESULTMATCHER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Match test case results of several logs by case path.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeTestCaseResult.hpp"
+
+#include <vector>
+
+namespace xe
+{
+
+//! Stream of test case results, for example from a log being parsed.
+class TestResultSource
+{
+public:
+	virtual					~TestResultSource	(void) {}
+
+	//! Get next result in log order. Returns false at end of log.
+	virtual bool			getNext				(TestCaseResultHeader& dst) = 0;
+};
+
+class MatchedResultHandler
+{
+public:
+	virtual					~MatchedResultHandler	(void) {}
+
+	//! Results of one case, one per source. Status code of missing results is TESTSTATUSCODE_LAST.
+	virtual void			matched					(const std::vector<TestCaseResultHeader>& results) = 0;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Match results of sources by case path
+ *
+ * Sources are read in lockstep, and results are buffered only while
+ * sources disagree on case order. Handler is called once per distinct
+ * case path in order of first appearance. If a case appears more than
+ * once in the same source, the first result is used.
+ *//*--------------------------------------------------------------------*/
+void matchTestResults (const std::vector<TestResultSource*>& sources, MatchedResultHandler& handler);
+
+} // xe
+
+#endif // _XETESTRESULTMATCHER_HPP
@@ -532,6 +532,7 @@ void TestResultParser::handleElementStart (void)
 				image->height		= toInt(getAttribute("Height"));
 				image->format		= getImageFormat(getAttribute("Format"));
 				image->compression	= getImageCompression(getAttribute("CompressionMode"));
+				image->file			= m_xmlParser.hasAttribute("File") ? m_xmlParser.getAttribute("File") : "";
 				item = image;
 				break;
 			}
@@ -519,6 +519,7 @@ void Parser::advance (void)
 					error("Duplicate attribute");
 
 				m_tokenizer.getString(m_attributes[m_attribName]);
+				decodeEntities(m_attributes[m_attribName]);
 				m_state = STATE_ATTRIBUTE_LIST;
 				break;
 
@@ -569,5 +570,40 @@ void Parser::parseEntityValue (void)
 	m_entityValue[0] = value;
 }
 
+void Parser::decodeEntities (std::string& value)
+{
+	std::string::size_type	entityStart	= value.find('&');
+	std::string				decoded;
+
+	if (entityStart == std::string::npos)
+		return;
+
+	decoded.assign(value, 0, entityStart);
+
+	while (entityStart != std::string::npos)
+	{
+		const std::string::size_type	entityEnd	= value.find(';', entityStart);
+
+		if (entityEnd == std::string::npos)
+			error("Unterminated entity in attribute value");
+
+		{
+			const std::string				entity		= value.substr(entityStart, entityEnd - entityStart + 1);
+			const char						entityValue	= getEntityValue(entity);
+			const std::string::size_type	nextStart	= value.find('&', entityEnd + 1);
+
+			if (entityValue == 0)
+				error("Invalid entity '" + entity + "'");
+
+			decoded += entityValue;
+			decoded.append(value, entityEnd + 1, (nextStart == std::string::npos ? value.size() : nextStart) - (entityEnd + 1));
+
+			entityStart = nextStart;
+		}
+	}
+
+	value.swap(decoded);
+}
+
 } // xml
 } // xe
@@ -168,6 +168,7 @@ private:
 	Parser&				operator=			(const Parser& other);
 
 	void				parseEntityValue	(void);
+	void				decodeEntities		(std::string& value);
 
 	void				error				(const std::string& what);
 
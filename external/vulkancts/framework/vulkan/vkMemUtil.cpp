@@ -26,6 +26,7 @@
 #include "vkQueryUtil.hpp"
 #include "vkRef.hpp"
 #include "vkRefUtil.hpp"
+#include "tcuMemoryStats.hpp"
 #include "deInt32.h"
 
 #include <sstream>
@@ -148,23 +149,27 @@ MemoryRequirement::MemoryRequirement (deUint32 flags)
 class SimpleAllocation : public Allocation
 {
 public:
-									SimpleAllocation	(Move<VkDeviceMemory> mem, MovePtr<HostPtr> hostPtr);
+									SimpleAllocation	(Move<VkDeviceMemory> mem, MovePtr<HostPtr> hostPtr, VkDeviceSize size);
 	virtual							~SimpleAllocation	(void);
 
 private:
 	const Unique<VkDeviceMemory>	m_memHolder;
 	const UniquePtr<HostPtr>		m_hostPtr;
+	const VkDeviceSize				m_size;
 };
 
-SimpleAllocation::SimpleAllocation (Move<VkDeviceMemory> mem, MovePtr<HostPtr> hostPtr)
+SimpleAllocation::SimpleAllocation (Move<VkDeviceMemory> mem, MovePtr<HostPtr> hostPtr, VkDeviceSize size)
 	: Allocation	(*mem, (VkDeviceSize)0, hostPtr ? hostPtr->get() : DE_NULL)
 	, m_memHolder	(mem)
 	, m_hostPtr		(hostPtr)
+	, m_size		(size)
 {
+	tcu::memstats::recordDeviceAllocation((deUint64)m_size);
 }
 
 SimpleAllocation::~SimpleAllocation (void)
 {
+	tcu::memstats::recordDeviceFree((deUint64)m_size);
 }
 
 SimpleAllocator::SimpleAllocator (const DeviceInterface& vk, VkDevice device, const VkPhysicalDeviceMemoryProperties& deviceMemProps)
@@ -184,7 +189,7 @@ MovePtr<Allocation> SimpleAllocator::allocate (const VkMemoryAllocateInfo& alloc
 	if (isHostVisibleMemory(m_memProps, allocInfo.memoryTypeIndex))
 		hostPtr = MovePtr<HostPtr>(new HostPtr(m_vk, m_device, *mem, 0u, allocInfo.allocationSize, 0u));
 
-	return MovePtr<Allocation>(new SimpleAllocation(mem, hostPtr));
+	return MovePtr<Allocation>(new SimpleAllocation(mem, hostPtr, allocInfo.allocationSize));
 }
 
 MovePtr<Allocation> SimpleAllocator::allocate (const VkMemoryRequirements& memReqs, MemoryRequirement requirement)
@@ -207,7 +212,7 @@ MovePtr<Allocation> SimpleAllocator::allocate (const VkMemoryRequirements& memRe
 		hostPtr = MovePtr<HostPtr>(new HostPtr(m_vk, m_device, *mem, 0u, allocInfo.allocationSize, 0u));
 	}
 
-	return MovePtr<Allocation>(new SimpleAllocation(mem, hostPtr));
+	return MovePtr<Allocation>(new SimpleAllocation(mem, hostPtr, allocInfo.allocationSize));
 }
 
 void flushMappedMemoryRange (const DeviceInterface& vkd, VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size)
@@ -25,7 +25,10 @@
 #include "vkPlatform.hpp"
 #include "vkImageUtil.hpp"
 #include "tcuFunctionLibrary.hpp"
+#include "tcuTextureUtil.hpp"
+#include "deMath.h"
 #include "deMemory.h"
+#include "deString.h"
 
 #include <stdexcept>
 #include <algorithm>
@@ -154,9 +157,6 @@ struct NAME											\
 	NAME (VkDevice, const Vk##NAME##CreateInfo*) {}	\
 }
 
-VK_NULL_DEFINE_DEVICE_OBJ(Fence);
-VK_NULL_DEFINE_DEVICE_OBJ(Semaphore);
-VK_NULL_DEFINE_DEVICE_OBJ(Event);
 VK_NULL_DEFINE_DEVICE_OBJ(QueryPool);
 VK_NULL_DEFINE_DEVICE_OBJ(BufferView);
 VK_NULL_DEFINE_DEVICE_OBJ(ImageView);
@@ -207,6 +207,51 @@ public:
 										~DebugReportCallbackEXT	(void) {}
 };
 
+// \note All queue operations execute synchronously in vkQueueSubmit() so
+//		 fences and semaphores are signaled as soon as the submission returns.
+
+class Fence
+{
+public:
+						Fence			(VkDevice, const VkFenceCreateInfo* pCreateInfo)
+							: m_signaled((pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) != 0)
+						{}
+
+	bool				isSignaled		(void) const	{ return m_signaled;		}
+	void				setSignaled		(bool signaled)	{ m_signaled = signaled;	}
+
+private:
+	bool				m_signaled;
+};
+
+class Semaphore
+{
+public:
+						Semaphore		(VkDevice, const VkSemaphoreCreateInfo*)
+							: m_signaled(false)
+						{}
+
+	bool				isSignaled		(void) const	{ return m_signaled;		}
+	void				setSignaled		(bool signaled)	{ m_signaled = signaled;	}
+
+private:
+	bool				m_signaled;
+};
+
+class Event
+{
+public:
+						Event			(VkDevice, const VkEventCreateInfo*)
+							: m_set(false)
+						{}
+
+	bool				isSet			(void) const	{ return m_set;	}
+	void				set				(bool value)	{ m_set = value;	}
+
+private:
+	bool				m_set;
+};
+
 class Device
 {
 public:
@@ -287,46 +332,646 @@ private:
 	void* const			m_memory;
 };
 
+VkDeviceSize getPackedImageDataSize (VkFormat format, VkExtent3D extent, VkSampleCountFlagBits samples)
+{
+	return (VkDeviceSize)getPixelSize(mapVkFormat(format))
+			* (VkDeviceSize)extent.width
+			* (VkDeviceSize)extent.height
+			* (VkDeviceSize)extent.depth
+			* (VkDeviceSize)samples;
+}
+
+VkDeviceSize getCompressedImageDataSize (VkFormat format, VkExtent3D extent)
+{
+	try
+	{
+		const tcu::CompressedTexFormat	tcuFormat		= mapVkCompressedFormat(format);
+		const size_t					blockSize		= tcu::getBlockSize(tcuFormat);
+		const tcu::IVec3				blockPixelSize	= tcu::getBlockPixelSize(tcuFormat);
+		const int						numBlocksX		= deDivRoundUp32((int)extent.width, blockPixelSize.x());
+		const int						numBlocksY		= deDivRoundUp32((int)extent.height, blockPixelSize.y());
+		const int						numBlocksZ		= deDivRoundUp32((int)extent.depth, blockPixelSize.z());
+
+		return blockSize*numBlocksX*numBlocksY*numBlocksZ;
+	}
+	catch (...)
+	{
+		return 0; // Unsupported compressed format
+	}
+}
+
 class Buffer
 {
 public:
 						Buffer		(VkDevice, const VkBufferCreateInfo* pCreateInfo)
-							: m_size(pCreateInfo->size)
+							: m_size	(pCreateInfo->size)
+							, m_memory	(DE_NULL)
 						{}
 
 	VkDeviceSize		getSize		(void) const { return m_size;	}
 
+	void				bindMemory	(const DeviceMemory* memory, VkDeviceSize offset)	{ m_memory = (deUint8*)memory->getPtr() + offset;	}
+	deUint8*			getPtr		(void) const										{ return m_memory;									}
+
 private:
 	const VkDeviceSize	m_size;
+	deUint8*			m_memory;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Image
+ *
+ * Image data is tightly packed into memory one mip level at a time with
+ * all array layers of a level stored consecutively, regardless of tiling.
+ *//*--------------------------------------------------------------------*/
 class Image
 {
 public:
-								Image			(VkDevice, const VkImageCreateInfo* pCreateInfo)
-									: m_imageType	(pCreateInfo->imageType)
-									, m_format		(pCreateInfo->format)
-									, m_extent		(pCreateInfo->extent)
-									, m_samples		(pCreateInfo->samples)
-								{}
-
-	VkImageType					getImageType	(void) const { return m_imageType;	}
-	VkFormat					getFormat		(void) const { return m_format;		}
-	VkExtent3D					getExtent		(void) const { return m_extent;		}
-	VkSampleCountFlagBits		getSamples		(void) const { return m_samples;	}
+									Image					(VkDevice, const VkImageCreateInfo* pCreateInfo)
+										: m_imageType	(pCreateInfo->imageType)
+										, m_format		(pCreateInfo->format)
+										, m_extent		(pCreateInfo->extent)
+										, m_mipLevels	(pCreateInfo->mipLevels)
+										, m_arrayLayers	(pCreateInfo->arrayLayers)
+										, m_samples		(pCreateInfo->samples)
+										, m_memory		(DE_NULL)
+									{}
+
+	VkImageType						getImageType			(void) const { return m_imageType;		}
+	VkFormat						getFormat				(void) const { return m_format;			}
+	VkExtent3D						getExtent				(void) const { return m_extent;			}
+	deUint32						getMipLevels			(void) const { return m_mipLevels;		}
+	deUint32						getArrayLayers			(void) const { return m_arrayLayers;	}
+	VkSampleCountFlagBits			getSamples				(void) const { return m_samples;		}
+
+	VkExtent3D						getLevelExtent			(deUint32 mipLevel) const;
+	VkDeviceSize					getLayerSize			(deUint32 mipLevel) const;
+	VkDeviceSize					getSubresourceOffset	(deUint32 mipLevel, deUint32 arrayLayer) const;
+	VkDeviceSize					getMemorySize			(void) const { return getSubresourceOffset(m_mipLevels, 0u);	}
+
+	void							bindMemory				(const DeviceMemory* memory, VkDeviceSize offset)	{ m_memory = (deUint8*)memory->getPtr() + offset;	}
+	deUint8*						getPtr					(void) const										{ return m_memory;									}
+
+	tcu::PixelBufferAccess			getSubresourceAccess	(deUint32 mipLevel, deUint32 arrayLayer) const;
 
 private:
-	const VkImageType			m_imageType;
-	const VkFormat				m_format;
-	const VkExtent3D			m_extent;
-	const VkSampleCountFlagBits	m_samples;
+	const VkImageType				m_imageType;
+	const VkFormat					m_format;
+	const VkExtent3D				m_extent;
+	const deUint32					m_mipLevels;
+	const deUint32					m_arrayLayers;
+	const VkSampleCountFlagBits		m_samples;
+	deUint8*						m_memory;
+};
+
+VkExtent3D Image::getLevelExtent (deUint32 mipLevel) const
+{
+	const VkExtent3D levelExtent =
+	{
+		de::max(m_extent.width	>> mipLevel, 1u),
+		de::max(m_extent.height	>> mipLevel, 1u),
+		de::max(m_extent.depth	>> mipLevel, 1u)
+	};
+	return levelExtent;
+}
+
+VkDeviceSize Image::getLayerSize (deUint32 mipLevel) const
+{
+	if (isCompressedFormat(m_format))
+		return getCompressedImageDataSize(m_format, getLevelExtent(mipLevel));
+	else
+		return getPackedImageDataSize(m_format, getLevelExtent(mipLevel), m_samples);
+}
+
+VkDeviceSize Image::getSubresourceOffset (deUint32 mipLevel, deUint32 arrayLayer) const
+{
+	VkDeviceSize offset = 0;
+
+	for (deUint32 levelNdx = 0; levelNdx < mipLevel; ++levelNdx)
+		offset += getLayerSize(levelNdx) * m_arrayLayers;
+
+	if (arrayLayer > 0)
+		offset += getLayerSize(mipLevel) * arrayLayer;
+
+	return offset;
+}
+
+//! Access to the whole mip level of single array layer. Multisample images expose only the first sample.
+tcu::PixelBufferAccess Image::getSubresourceAccess (deUint32 mipLevel, deUint32 arrayLayer) const
+{
+	const VkExtent3D			levelExtent	= getLevelExtent(mipLevel);
+	const tcu::TextureFormat	format		= mapVkFormat(m_format);
+
+	DE_ASSERT(!isCompressedFormat(m_format));
+	DE_ASSERT(m_memory);
+
+	return tcu::PixelBufferAccess(format, (int)levelExtent.width, (int)levelExtent.height, (int)levelExtent.depth, m_memory + getSubresourceOffset(mipLevel, arrayLayer));
+}
+
+// Transfer operations
+
+//! Copy texel data between accesses of same size. Color copies are bit-exact between size-compatible formats.
+void copyTexels (const tcu::PixelBufferAccess& dst, const tcu::ConstPixelBufferAccess& src, VkImageAspectFlags aspectMask)
+{
+	DE_ASSERT(dst.getSize() == src.getSize());
+
+	if (aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT|VK_IMAGE_ASPECT_STENCIL_BIT))
+	{
+		for (int z = 0; z < dst.getDepth(); z++)
+		for (int y = 0; y < dst.getHeight(); y++)
+		for (int x = 0; x < dst.getWidth(); x++)
+		{
+			if (aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT)
+				dst.setPixDepth(src.getPixDepth(x, y, z), x, y, z);
+
+			if (aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT)
+				dst.setPixStencil(src.getPixStencil(x, y, z), x, y, z);
+		}
+	}
+	else
+	{
+		DE_ASSERT(dst.getFormat().getPixelSize() == src.getFormat().getPixelSize());
+		tcu::copy(tcu::PixelBufferAccess(src.getFormat(), dst.getSize(), dst.getPitch(), dst.getDataPtr()), src);
+	}
+}
+
+//! Access to buffer memory laid out as in vkCmdCopyBufferToImage() and vkCmdCopyImageToBuffer().
+tcu::PixelBufferAccess getBufferImageAccess (const Buffer& buffer, const Image& image, const VkBufferImageCopy& region)
+{
+	const VkImageAspectFlags	aspectMask	= region.imageSubresource.aspectMask;
+	const tcu::TextureFormat	format		= (aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT)		? getDepthCopyFormat(image.getFormat())
+											: (aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT)	? getStencilCopyFormat(image.getFormat())
+											: mapVkFormat(image.getFormat());
+	const int					rowLength	= region.bufferRowLength	!= 0 ? (int)region.bufferRowLength		: (int)region.imageExtent.width;
+	const int					imageHeight	= region.bufferImageHeight	!= 0 ? (int)region.bufferImageHeight	: (int)region.imageExtent.height;
+	const int					rowPitch	= rowLength * format.getPixelSize();
+	const int					slicePitch	= imageHeight * rowPitch;
+	const int					depth		= (int)de::max(region.imageExtent.depth, region.imageSubresource.layerCount);
+
+	return tcu::PixelBufferAccess(format, (int)region.imageExtent.width, (int)region.imageExtent.height, depth, rowPitch, slicePitch, buffer.getPtr() + region.bufferOffset);
+}
+
+tcu::Vec4 readLinear (const tcu::ConstPixelBufferAccess& access, int x, int y, int z)
+{
+	const tcu::Vec4 value = access.getPixel(x, y, z);
+	return tcu::isSRGB(access.getFormat()) ? tcu::sRGBToLinear(value) : value;
+}
+
+void writeLinear (const tcu::PixelBufferAccess& access, const tcu::Vec4& value, int x, int y, int z)
+{
+	access.setPixel(tcu::isSRGB(access.getFormat()) ? tcu::linearToSRGB(value) : value, x, y, z);
+}
+
+//! Blit single array layer. Offsets define the source and destination boxes within the layer.
+void blitLayer (const tcu::PixelBufferAccess& dst, const VkOffset3D* dstOffsets, const tcu::ConstPixelBufferAccess& src, const VkOffset3D* srcOffsets, VkImageAspectFlags aspectMask, VkFilter filter)
+{
+	const tcu::TextureChannelClass	channelClass	= tcu::getTextureChannelClass(src.getFormat().type);
+	const bool						isDepthStencil	= (aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT|VK_IMAGE_ASPECT_STENCIL_BIT)) != 0;
+	const bool						isInteger		= channelClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER || channelClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
+	const bool						useLinear		= filter == VK_FILTER_LINEAR && !isDepthStencil && !isInteger;
+	const tcu::Sampler				sampler			(tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE,
+													 tcu::Sampler::LINEAR, tcu::Sampler::LINEAR, 0.0f, false /* non-normalized coords */);
+	const tcu::IVec3				dstMin			(de::min(dstOffsets[0].x, dstOffsets[1].x), de::min(dstOffsets[0].y, dstOffsets[1].y), de::min(dstOffsets[0].z, dstOffsets[1].z));
+	const tcu::IVec3				dstMax			(de::max(dstOffsets[0].x, dstOffsets[1].x), de::max(dstOffsets[0].y, dstOffsets[1].y), de::max(dstOffsets[0].z, dstOffsets[1].z));
+	const tcu::Vec3					scale			((float)(srcOffsets[1].x - srcOffsets[0].x) / (float)(dstOffsets[1].x - dstOffsets[0].x),
+													 (float)(srcOffsets[1].y - srcOffsets[0].y) / (float)(dstOffsets[1].y - dstOffsets[0].y),
+													 (float)(srcOffsets[1].z - srcOffsets[0].z) / (float)(dstOffsets[1].z - dstOffsets[0].z));
+
+	for (int z = dstMin.z(); z < dstMax.z(); z++)
+	for (int y = dstMin.y(); y < dstMax.y(); y++)
+	for (int x = dstMin.x(); x < dstMax.x(); x++)
+	{
+		// Source coordinate of destination texel center, flips are handled by the sign of scale
+		const float	srcX	= (float)srcOffsets[0].x + ((float)x + 0.5f - (float)dstOffsets[0].x) * scale.x();
+		const float	srcY	= (float)srcOffsets[0].y + ((float)y + 0.5f - (float)dstOffsets[0].y) * scale.y();
+		const float	srcZ	= (float)srcOffsets[0].z + ((float)z + 0.5f - (float)dstOffsets[0].z) * scale.z();
+
+		if (useLinear)
+			writeLinear(dst, src.sample3D(sampler, tcu::Sampler::LINEAR, srcX, srcY, srcZ), x, y, z);
+		else
+		{
+			const int	sx	= de::clamp(deFloorFloatToInt32(srcX), 0, src.getWidth()-1);
+			const int	sy	= de::clamp(deFloorFloatToInt32(srcY), 0, src.getHeight()-1);
+			const int	sz	= de::clamp(deFloorFloatToInt32(srcZ), 0, src.getDepth()-1);
+
+			if (aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT)
+				dst.setPixDepth(src.getPixDepth(sx, sy, sz), x, y, z);
+
+			if (aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT)
+				dst.setPixStencil(src.getPixStencil(sx, sy, sz), x, y, z);
+
+			if (!isDepthStencil)
+			{
+				if (channelClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER)
+					dst.setPixel(src.getPixelInt(sx, sy, sz), x, y, z);
+				else if (channelClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER)
+					dst.setPixel(src.getPixelUint(sx, sy, sz), x, y, z);
+				else
+					writeLinear(dst, readLinear(src, sx, sy, sz), x, y, z);
+			}
+		}
+	}
+}
+
+deUint32 getLevelCount (const Image& image, const VkImageSubresourceRange& range)
+{
+	return range.levelCount == VK_REMAINING_MIP_LEVELS ? image.getMipLevels() - range.baseMipLevel : range.levelCount;
+}
+
+deUint32 getLayerCount (const Image& image, const VkImageSubresourceRange& range)
+{
+	return range.layerCount == VK_REMAINING_ARRAY_LAYERS ? image.getArrayLayers() - range.baseArrayLayer : range.layerCount;
+}
+
+// Command buffers
+
+class Command
+{
+public:
+	virtual			~Command	(void) {}
+	virtual void	execute		(void) const = 0;
 };
 
 class CommandBuffer
 {
 public:
-						CommandBuffer(VkDevice, VkCommandPool, VkCommandBufferLevel)
-						{}
+							CommandBuffer	(VkDevice, VkCommandPool, VkCommandBufferLevel)
+								: m_result(VK_SUCCESS)
+							{}
+							~CommandBuffer	(void) { reset(); }
+
+	//! Append command, takes ownership
+	void					record			(Command* command);
+	void					setResult		(VkResult result)	{ m_result = result;	}
+	VkResult				getResult		(void) const		{ return m_result;		}
+
+	void					reset			(void);
+	void					execute			(void) const;
+
+private:
+	vector<Command*>		m_commands;
+	VkResult				m_result;
+};
+
+void CommandBuffer::record (Command* command)
+{
+	try
+	{
+		m_commands.push_back(command);
+	}
+	catch (...)
+	{
+		delete command;
+		throw;
+	}
+}
+
+void CommandBuffer::reset (void)
+{
+	for (size_t ndx = 0; ndx < m_commands.size(); ++ndx)
+		delete m_commands[ndx];
+	m_commands.clear();
+	m_result = VK_SUCCESS;
+}
+
+void CommandBuffer::execute (void) const
+{
+	for (size_t ndx = 0; ndx < m_commands.size(); ++ndx)
+		m_commands[ndx]->execute();
+}
+
+#define VK_NULL_RECORD(COMMAND_BUFFER, NEW_COMMAND)											\
+	do {																					\
+		try {																				\
+			reinterpret_cast<CommandBuffer*>(COMMAND_BUFFER)->record(NEW_COMMAND);			\
+		} catch (const std::bad_alloc&) {													\
+			reinterpret_cast<CommandBuffer*>(COMMAND_BUFFER)->setResult(VK_ERROR_OUT_OF_HOST_MEMORY);	\
+		}																					\
+	} while (deGetFalse())
+
+class CopyBufferCommand : public Command
+{
+public:
+	CopyBufferCommand (const Buffer* src, const Buffer* dst, deUint32 regionCount, const VkBufferCopy* pRegions)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+	{}
+
+	void execute (void) const
+	{
+		for (size_t ndx = 0; ndx < m_regions.size(); ++ndx)
+			deMemcpy(m_dst->getPtr() + m_regions[ndx].dstOffset, m_src->getPtr() + m_regions[ndx].srcOffset, (size_t)m_regions[ndx].size);
+	}
+
+private:
+	const Buffer* const			m_src;
+	const Buffer* const			m_dst;
+	const vector<VkBufferCopy>	m_regions;
+};
+
+class UpdateBufferCommand : public Command
+{
+public:
+	UpdateBufferCommand (const Buffer* dst, VkDeviceSize offset, VkDeviceSize size, const void* data)
+		: m_dst		(dst)
+		, m_offset	(offset)
+		, m_data	((const deUint8*)data, (const deUint8*)data + size)
+	{}
+
+	void execute (void) const
+	{
+		if (!m_data.empty())
+			deMemcpy(m_dst->getPtr() + m_offset, &m_data[0], m_data.size());
+	}
+
+private:
+	const Buffer* const			m_dst;
+	const VkDeviceSize			m_offset;
+	const vector<deUint8>		m_data;
+};
+
+class FillBufferCommand : public Command
+{
+public:
+	FillBufferCommand (const Buffer* dst, VkDeviceSize offset, VkDeviceSize size, deUint32 data)
+		: m_dst		(dst)
+		, m_offset	(offset)
+		, m_size	(size == VK_WHOLE_SIZE ? ((dst->getSize() - offset) & ~(VkDeviceSize)3) : size)
+		, m_data	(data)
+	{}
+
+	void execute (void) const
+	{
+		deUint8* const dstPtr = m_dst->getPtr() + m_offset;
+
+		for (VkDeviceSize offset = 0; offset + sizeof(deUint32) <= m_size; offset += sizeof(deUint32))
+			deMemcpy(dstPtr + offset, &m_data, sizeof(deUint32));
+	}
+
+private:
+	const Buffer* const			m_dst;
+	const VkDeviceSize			m_offset;
+	const VkDeviceSize			m_size;
+	const deUint32				m_data;
+};
+
+class CopyImageCommand : public Command
+{
+public:
+	CopyImageCommand (const Image* src, const Image* dst, deUint32 regionCount, const VkImageCopy* pRegions)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+	{}
+
+	void execute (void) const
+	{
+		if (isCompressedFormat(m_src->getFormat()) || isCompressedFormat(m_dst->getFormat()))
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkImageCopy& region = m_regions[regionNdx];
+
+			for (deUint32 layerNdx = 0; layerNdx < region.srcSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	src	= m_src->getSubresourceAccess(region.srcSubresource.mipLevel, region.srcSubresource.baseArrayLayer + layerNdx);
+				const tcu::PixelBufferAccess	dst	= m_dst->getSubresourceAccess(region.dstSubresource.mipLevel, region.dstSubresource.baseArrayLayer + layerNdx);
+
+				copyTexels(tcu::getSubregion(dst, region.dstOffset.x, region.dstOffset.y, region.dstOffset.z, region.extent.width, region.extent.height, region.extent.depth),
+						   tcu::getSubregion(src, region.srcOffset.x, region.srcOffset.y, region.srcOffset.z, region.extent.width, region.extent.height, region.extent.depth),
+						   region.srcSubresource.aspectMask);
+			}
+		}
+	}
+
+private:
+	const Image* const			m_src;
+	const Image* const			m_dst;
+	const vector<VkImageCopy>	m_regions;
+};
+
+class BlitImageCommand : public Command
+{
+public:
+	BlitImageCommand (const Image* src, const Image* dst, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+		, m_filter	(filter)
+	{}
+
+	void execute (void) const
+	{
+		if (isCompressedFormat(m_src->getFormat()) || isCompressedFormat(m_dst->getFormat()))
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkImageBlit& region = m_regions[regionNdx];
+
+			for (deUint32 layerNdx = 0; layerNdx < region.srcSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	src	= m_src->getSubresourceAccess(region.srcSubresource.mipLevel, region.srcSubresource.baseArrayLayer + layerNdx);
+				const tcu::PixelBufferAccess	dst	= m_dst->getSubresourceAccess(region.dstSubresource.mipLevel, region.dstSubresource.baseArrayLayer + layerNdx);
+
+				blitLayer(dst, region.dstOffsets, src, region.srcOffsets, region.srcSubresource.aspectMask, m_filter);
+			}
+		}
+	}
+
+private:
+	const Image* const			m_src;
+	const Image* const			m_dst;
+	const vector<VkImageBlit>	m_regions;
+	const VkFilter				m_filter;
+};
+
+class CopyBufferToImageCommand : public Command
+{
+public:
+	CopyBufferToImageCommand (const Buffer* src, const Image* dst, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+	{}
+
+	void execute (void) const
+	{
+		if (isCompressedFormat(m_dst->getFormat()))
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkBufferImageCopy&		region	= m_regions[regionNdx];
+			const tcu::PixelBufferAccess	src		= getBufferImageAccess(*m_src, *m_dst, region);
+
+			for (deUint32 layerNdx = 0; layerNdx < region.imageSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	dst	= m_dst->getSubresourceAccess(region.imageSubresource.mipLevel, region.imageSubresource.baseArrayLayer + layerNdx);
+
+				copyTexels(tcu::getSubregion(dst, region.imageOffset.x, region.imageOffset.y, region.imageOffset.z, region.imageExtent.width, region.imageExtent.height, region.imageExtent.depth),
+						   tcu::getSubregion(src, 0, 0, (int)layerNdx, region.imageExtent.width, region.imageExtent.height, region.imageExtent.depth),
+						   region.imageSubresource.aspectMask);
+			}
+		}
+	}
+
+private:
+	const Buffer* const				m_src;
+	const Image* const				m_dst;
+	const vector<VkBufferImageCopy>	m_regions;
+};
+
+class CopyImageToBufferCommand : public Command
+{
+public:
+	CopyImageToBufferCommand (const Image* src, const Buffer* dst, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+	{}
+
+	void execute (void) const
+	{
+		if (isCompressedFormat(m_src->getFormat()))
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkBufferImageCopy&		region	= m_regions[regionNdx];
+			const tcu::PixelBufferAccess	dst		= getBufferImageAccess(*m_dst, *m_src, region);
+
+			for (deUint32 layerNdx = 0; layerNdx < region.imageSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	src	= m_src->getSubresourceAccess(region.imageSubresource.mipLevel, region.imageSubresource.baseArrayLayer + layerNdx);
+
+				copyTexels(tcu::getSubregion(dst, 0, 0, (int)layerNdx, region.imageExtent.width, region.imageExtent.height, region.imageExtent.depth),
+						   tcu::getSubregion(src, region.imageOffset.x, region.imageOffset.y, region.imageOffset.z, region.imageExtent.width, region.imageExtent.height, region.imageExtent.depth),
+						   region.imageSubresource.aspectMask);
+			}
+		}
+	}
+
+private:
+	const Image* const				m_src;
+	const Buffer* const				m_dst;
+	const vector<VkBufferImageCopy>	m_regions;
+};
+
+class ClearColorImageCommand : public Command
+{
+public:
+	ClearColorImageCommand (const Image* image, const VkClearColorValue* pColor, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+		: m_image	(image)
+		, m_color	(*pColor)
+		, m_ranges	(pRanges, pRanges + rangeCount)
+	{}
+
+	void execute (void) const
+	{
+		if (isCompressedFormat(m_image->getFormat()))
+			return;
+
+		for (size_t rangeNdx = 0; rangeNdx < m_ranges.size(); ++rangeNdx)
+		{
+			const VkImageSubresourceRange&	range	= m_ranges[rangeNdx];
+
+			for (deUint32 levelNdx = 0; levelNdx < getLevelCount(*m_image, range); ++levelNdx)
+			for (deUint32 layerNdx = 0; layerNdx < getLayerCount(*m_image, range); ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	access			= m_image->getSubresourceAccess(range.baseMipLevel + levelNdx, range.baseArrayLayer + layerNdx);
+				const tcu::TextureChannelClass	channelClass	= tcu::getTextureChannelClass(access.getFormat().type);
+
+				if (channelClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER)
+					tcu::clear(access, tcu::IVec4(m_color.int32));
+				else if (channelClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER)
+					tcu::clear(access, tcu::UVec4(m_color.uint32));
+				else
+				{
+					const tcu::Vec4	color	(m_color.float32);
+
+					tcu::clear(access, tcu::isSRGB(access.getFormat()) ? tcu::linearToSRGB(color) : color);
+				}
+			}
+		}
+	}
+
+private:
+	const Image* const						m_image;
+	const VkClearColorValue					m_color;
+	const vector<VkImageSubresourceRange>	m_ranges;
+};
+
+class ClearDepthStencilImageCommand : public Command
+{
+public:
+	ClearDepthStencilImageCommand (const Image* image, const VkClearDepthStencilValue* pDepthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+		: m_image			(image)
+		, m_depthStencil	(*pDepthStencil)
+		, m_ranges			(pRanges, pRanges + rangeCount)
+	{}
+
+	void execute (void) const
+	{
+		for (size_t rangeNdx = 0; rangeNdx < m_ranges.size(); ++rangeNdx)
+		{
+			const VkImageSubresourceRange&	range	= m_ranges[rangeNdx];
+
+			for (deUint32 levelNdx = 0; levelNdx < getLevelCount(*m_image, range); ++levelNdx)
+			for (deUint32 layerNdx = 0; layerNdx < getLayerCount(*m_image, range); ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	access	= m_image->getSubresourceAccess(range.baseMipLevel + levelNdx, range.baseArrayLayer + layerNdx);
+
+				if (range.aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT)
+					tcu::clearDepth(access, m_depthStencil.depth);
+
+				if (range.aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT)
+					tcu::clearStencil(access, (int)m_depthStencil.stencil);
+			}
+		}
+	}
+
+private:
+	const Image* const						m_image;
+	const VkClearDepthStencilValue			m_depthStencil;
+	const vector<VkImageSubresourceRange>	m_ranges;
+};
+
+class SetEventCommand : public Command
+{
+public:
+	SetEventCommand (Event* event, bool set)
+		: m_event	(event)
+		, m_set		(set)
+	{}
+
+	void execute (void) const
+	{
+		m_event->set(m_set);
+	}
+
+private:
+	Event* const				m_event;
+	const bool					m_set;
+};
+
+class ExecuteCommandsCommand : public Command
+{
+public:
+	ExecuteCommandsCommand (deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+		: m_commandBuffers((const CommandBuffer* const*)pCommandBuffers, (const CommandBuffer* const*)pCommandBuffers + commandBufferCount)
+	{}
+
+	void execute (void) const
+	{
+		for (size_t ndx = 0; ndx < m_commandBuffers.size(); ++ndx)
+			m_commandBuffers[ndx]->execute();
+	}
+
+private:
+	const vector<const CommandBuffer*>	m_commandBuffers;
 };
 
 class DescriptorUpdateTemplateKHR
@@ -346,6 +991,7 @@ public:
 
 	VkCommandBuffer						allocate		(VkCommandBufferLevel level);
 	void								free			(VkCommandBuffer buffer);
+	void								reset			(void);
 
 private:
 	const VkDevice						m_device;
@@ -394,6 +1040,12 @@ void CommandPool::free (VkCommandBuffer buffer)
 	DE_FATAL("VkCommandBuffer not owned by VkCommandPool");
 }
 
+void CommandPool::reset (void)
+{
+	for (size_t ndx = 0; ndx < m_buffers.size(); ++ndx)
+		m_buffers[ndx]->reset();
+}
+
 class DescriptorSet
 {
 public:
@@ -471,12 +1123,17 @@ void DescriptorPool::reset (void)
 
 // API implementation
 
+PFN_vkVoidFunction getPlatformProcAddr (const char* name);
+
 extern "C"
 {
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr (VkInstance instance, const char* pName)
 {
-	return reinterpret_cast<Instance*>(instance)->getProcAddr(pName);
+	if (instance)
+		return reinterpret_cast<Instance*>(instance)->getProcAddr(pName);
+	else
+		return getPlatformProcAddr(pName);
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr (VkDevice device, const char* pName)
@@ -821,34 +1478,6 @@ VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements (VkDevice, VkBuffer buffe
 	requirements->alignment			= (VkDeviceSize)1u;
 }
 
-VkDeviceSize getPackedImageDataSize (VkFormat format, VkExtent3D extent, VkSampleCountFlagBits samples)
-{
-	return (VkDeviceSize)getPixelSize(mapVkFormat(format))
-			* (VkDeviceSize)extent.width
-			* (VkDeviceSize)extent.height
-			* (VkDeviceSize)extent.depth
-			* (VkDeviceSize)samples;
-}
-
-VkDeviceSize getCompressedImageDataSize (VkFormat format, VkExtent3D extent)
-{
-	try
-	{
-		const tcu::CompressedTexFormat	tcuFormat		= mapVkCompressedFormat(format);
-		const size_t					blockSize		= tcu::getBlockSize(tcuFormat);
-		const tcu::IVec3				blockPixelSize	= tcu::getBlockPixelSize(tcuFormat);
-		const int						numBlocksX		= deDivRoundUp32((int)extent.width, blockPixelSize.x());
-		const int						numBlocksY		= deDivRoundUp32((int)extent.height, blockPixelSize.y());
-		const int						numBlocksZ		= deDivRoundUp32((int)extent.depth, blockPixelSize.z());
-
-		return blockSize*numBlocksX*numBlocksY*numBlocksZ;
-	}
-	catch (...)
-	{
-		return 0; // Unsupported compressed format
-	}
-}
-
 VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements (VkDevice, VkImage imageHandle, VkMemoryRequirements* requirements)
 {
 	const Image*	image	= reinterpret_cast<const Image*>(imageHandle.getInternal());
@@ -856,10 +1485,7 @@ VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements (VkDevice, VkImage imageHa
 	requirements->memoryTypeBits	= 1u;
 	requirements->alignment			= 16u;
 
-	if (isCompressedFormat(image->getFormat()))
-		requirements->size = getCompressedImageDataSize(image->getFormat(), image->getExtent());
-	else
-		requirements->size = getPackedImageDataSize(image->getFormat(), image->getExtent(), image->getSamples());
+	requirements->size				= image->getMemorySize();
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL mapMemory (VkDevice, VkDeviceMemory memHandle, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
@@ -946,6 +1572,225 @@ VKAPI_ATTR void VKAPI_CALL freeCommandBuffers (VkDevice device, VkCommandPool co
 }
 
 
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandPool (VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags)
+{
+	reinterpret_cast<CommandPool*>((deUintptr)commandPool.getInternal())->reset();
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo*)
+{
+	reinterpret_cast<CommandBuffer*>(commandBuffer)->reset();
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer (VkCommandBuffer commandBuffer)
+{
+	return reinterpret_cast<CommandBuffer*>(commandBuffer)->getResult();
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags)
+{
+	reinterpret_cast<CommandBuffer*>(commandBuffer)->reset();
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory (VkDevice, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	reinterpret_cast<Buffer*>((deUintptr)buffer.getInternal())->bindMemory(reinterpret_cast<const DeviceMemory*>((deUintptr)memory.getInternal()), memoryOffset);
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory (VkDevice, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	reinterpret_cast<Image*>((deUintptr)image.getInternal())->bindMemory(reinterpret_cast<const DeviceMemory*>((deUintptr)memory.getInternal()), memoryOffset);
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getImageSubresourceLayout (VkDevice, VkImage imageHandle, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	const Image* const	image		= reinterpret_cast<const Image*>(imageHandle.getInternal());
+	const VkExtent3D	levelExtent	= image->getLevelExtent(pSubresource->mipLevel);
+	const VkDeviceSize	layerSize	= image->getLayerSize(pSubresource->mipLevel);
+	deUint32			numRows		= levelExtent.height;
+	deUint32			numSlices	= levelExtent.depth;
+
+	// Compressed images are laid out in rows and slices of blocks
+	if (isCompressedFormat(image->getFormat()))
+	{
+		const tcu::IVec3	blockPixelSize	= tcu::getBlockPixelSize(mapVkCompressedFormat(image->getFormat()));
+
+		numRows		= (deUint32)deDivRoundUp32((int)levelExtent.height, blockPixelSize.y());
+		numSlices	= (deUint32)deDivRoundUp32((int)levelExtent.depth, blockPixelSize.z());
+	}
+
+	pLayout->offset		= image->getSubresourceOffset(pSubresource->mipLevel, pSubresource->arrayLayer);
+	pLayout->size		= layerSize;
+	pLayout->rowPitch	= layerSize / (numRows * numSlices);
+	pLayout->arrayPitch	= layerSize;
+	pLayout->depthPitch	= layerSize / numSlices;
+}
+
+// Queue operations are executed synchronously, so all submitted work is complete when vkQueueSubmit() returns.
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit (VkQueue, deUint32 submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	for (deUint32 submitNdx = 0; submitNdx < submitCount; ++submitNdx)
+	{
+		const VkSubmitInfo& submit = pSubmits[submitNdx];
+
+		for (deUint32 ndx = 0; ndx < submit.waitSemaphoreCount; ++ndx)
+			reinterpret_cast<Semaphore*>((deUintptr)submit.pWaitSemaphores[ndx].getInternal())->setSignaled(false);
+
+		for (deUint32 ndx = 0; ndx < submit.commandBufferCount; ++ndx)
+			reinterpret_cast<const CommandBuffer*>(submit.pCommandBuffers[ndx])->execute();
+
+		for (deUint32 ndx = 0; ndx < submit.signalSemaphoreCount; ++ndx)
+			reinterpret_cast<Semaphore*>((deUintptr)submit.pSignalSemaphores[ndx].getInternal())->setSignaled(true);
+	}
+
+	if (fence.getInternal() != 0)
+		reinterpret_cast<Fence*>((deUintptr)fence.getInternal())->setSignaled(true);
+
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueBindSparse (VkQueue, deUint32 bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	for (deUint32 bindNdx = 0; bindNdx < bindInfoCount; ++bindNdx)
+	{
+		const VkBindSparseInfo& bindInfo = pBindInfo[bindNdx];
+
+		for (deUint32 ndx = 0; ndx < bindInfo.waitSemaphoreCount; ++ndx)
+			reinterpret_cast<Semaphore*>((deUintptr)bindInfo.pWaitSemaphores[ndx].getInternal())->setSignaled(false);
+
+		for (deUint32 ndx = 0; ndx < bindInfo.signalSemaphoreCount; ++ndx)
+			reinterpret_cast<Semaphore*>((deUintptr)bindInfo.pSignalSemaphores[ndx].getInternal())->setSignaled(true);
+	}
+
+	if (fence.getInternal() != 0)
+		reinterpret_cast<Fence*>((deUintptr)fence.getInternal())->setSignaled(true);
+
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetFences (VkDevice, deUint32 fenceCount, const VkFence* pFences)
+{
+	for (deUint32 ndx = 0; ndx < fenceCount; ++ndx)
+		reinterpret_cast<Fence*>((deUintptr)pFences[ndx].getInternal())->setSignaled(false);
+
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus (VkDevice, VkFence fence)
+{
+	return reinterpret_cast<const Fence*>((deUintptr)fence.getInternal())->isSignaled() ? VK_SUCCESS : VK_NOT_READY;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitForFences (VkDevice, deUint32 fenceCount, const VkFence* pFences, VkBool32 waitAll, deUint64)
+{
+	deUint32 numSignaled = 0;
+
+	for (deUint32 ndx = 0; ndx < fenceCount; ++ndx)
+	{
+		if (reinterpret_cast<const Fence*>((deUintptr)pFences[ndx].getInternal())->isSignaled())
+			numSignaled += 1;
+	}
+
+	// Nothing can signal the fences while waiting
+	if (waitAll ? (numSignaled == fenceCount) : (numSignaled > 0))
+		return VK_SUCCESS;
+	else
+		return VK_TIMEOUT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getEventStatus (VkDevice, VkEvent event)
+{
+	return reinterpret_cast<const Event*>((deUintptr)event.getInternal())->isSet() ? VK_EVENT_SET : VK_EVENT_RESET;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL setEvent (VkDevice, VkEvent event)
+{
+	reinterpret_cast<Event*>((deUintptr)event.getInternal())->set(true);
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetEvent (VkDevice, VkEvent event)
+{
+	reinterpret_cast<Event*>((deUintptr)event.getInternal())->set(false);
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags)
+{
+	VK_NULL_RECORD(commandBuffer, new SetEventCommand(reinterpret_cast<Event*>((deUintptr)event.getInternal()), true));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags)
+{
+	VK_NULL_RECORD(commandBuffer, new SetEventCommand(reinterpret_cast<Event*>((deUintptr)event.getInternal()), false));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyBufferCommand(reinterpret_cast<const Buffer*>((deUintptr)srcBuffer.getInternal()),
+														reinterpret_cast<const Buffer*>((deUintptr)dstBuffer.getInternal()),
+														regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	VK_NULL_RECORD(commandBuffer, new UpdateBufferCommand(reinterpret_cast<const Buffer*>((deUintptr)dstBuffer.getInternal()), dstOffset, dataSize, pData));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, deUint32 data)
+{
+	VK_NULL_RECORD(commandBuffer, new FillBufferCommand(reinterpret_cast<const Buffer*>((deUintptr)dstBuffer.getInternal()), dstOffset, size, data));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout, VkImage dstImage, VkImageLayout, deUint32 regionCount, const VkImageCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyImageCommand(reinterpret_cast<const Image*>((deUintptr)srcImage.getInternal()),
+													   reinterpret_cast<const Image*>((deUintptr)dstImage.getInternal()),
+													   regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout, VkImage dstImage, VkImageLayout, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	VK_NULL_RECORD(commandBuffer, new BlitImageCommand(reinterpret_cast<const Image*>((deUintptr)srcImage.getInternal()),
+													   reinterpret_cast<const Image*>((deUintptr)dstImage.getInternal()),
+													   regionCount, pRegions, filter));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyBufferToImageCommand(reinterpret_cast<const Buffer*>((deUintptr)srcBuffer.getInternal()),
+															   reinterpret_cast<const Image*>((deUintptr)dstImage.getInternal()),
+															   regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyImageToBufferCommand(reinterpret_cast<const Image*>((deUintptr)srcImage.getInternal()),
+															   reinterpret_cast<const Buffer*>((deUintptr)dstBuffer.getInternal()),
+															   regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout, const VkClearColorValue* pColor, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	VK_NULL_RECORD(commandBuffer, new ClearColorImageCommand(reinterpret_cast<const Image*>((deUintptr)image.getInternal()), pColor, rangeCount, pRanges));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout, const VkClearDepthStencilValue* pDepthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	VK_NULL_RECORD(commandBuffer, new ClearDepthStencilImageCommand(reinterpret_cast<const Image*>((deUintptr)image.getInternal()), pDepthStencil, rangeCount, pRanges));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdExecuteCommands (VkCommandBuffer commandBuffer, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	VK_NULL_RECORD(commandBuffer, new ExecuteCommandsCommand(commandBufferCount, pCommandBuffers));
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL createDisplayModeKHR (VkPhysicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
 {
 	DE_UNREF(pAllocator);
@@ -966,6 +1811,17 @@ VKAPI_ATTR VkResult VKAPI_CALL createSharedSwapchainsKHR (VkDevice device, deUin
 
 } // extern "C"
 
+PFN_vkVoidFunction getPlatformProcAddr (const char* name)
+{
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_platformFunctions); ++ndx)
+	{
+		if (deStringEqual(s_platformFunctions[ndx].name, name))
+			return (PFN_vkVoidFunction)s_platformFunctions[ndx].ptr;
+	}
+
+	return DE_NULL;
+}
+
 Instance::Instance (const VkInstanceCreateInfo*)
 	: m_functions(s_instanceFunctions, DE_LENGTH_OF_ARRAY(s_instanceFunctions))
 {
@@ -385,15 +385,6 @@ VKAPI_ATTR VkResult VKAPI_CALL enumerateDeviceLayerProperties (VkPhysicalDevice
 	return VK_SUCCESS;
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL queueSubmit (VkQueue queue, deUint32 submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
-{
-	DE_UNREF(queue);
-	DE_UNREF(submitCount);
-	DE_UNREF(pSubmits);
-	DE_UNREF(fence);
-	return VK_SUCCESS;
-}
-
 VKAPI_ATTR VkResult VKAPI_CALL queueWaitIdle (VkQueue queue)
 {
 	DE_UNREF(queue);
@@ -435,24 +426,6 @@ VKAPI_ATTR void VKAPI_CALL getDeviceMemoryCommitment (VkDevice device, VkDeviceM
 	DE_UNREF(pCommittedMemoryInBytes);
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory (VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
-{
-	DE_UNREF(device);
-	DE_UNREF(buffer);
-	DE_UNREF(memory);
-	DE_UNREF(memoryOffset);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory (VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
-{
-	DE_UNREF(device);
-	DE_UNREF(image);
-	DE_UNREF(memory);
-	DE_UNREF(memoryOffset);
-	return VK_SUCCESS;
-}
-
 VKAPI_ATTR void VKAPI_CALL getImageSparseMemoryRequirements (VkDevice device, VkImage image, deUint32* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
 {
 	DE_UNREF(device);
@@ -473,61 +446,6 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceSparseImageFormatProperties (VkPhysi
 	DE_UNREF(pProperties);
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL queueBindSparse (VkQueue queue, deUint32 bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
-{
-	DE_UNREF(queue);
-	DE_UNREF(bindInfoCount);
-	DE_UNREF(pBindInfo);
-	DE_UNREF(fence);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL resetFences (VkDevice device, deUint32 fenceCount, const VkFence* pFences)
-{
-	DE_UNREF(device);
-	DE_UNREF(fenceCount);
-	DE_UNREF(pFences);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL getFenceStatus (VkDevice device, VkFence fence)
-{
-	DE_UNREF(device);
-	DE_UNREF(fence);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL waitForFences (VkDevice device, deUint32 fenceCount, const VkFence* pFences, VkBool32 waitAll, deUint64 timeout)
-{
-	DE_UNREF(device);
-	DE_UNREF(fenceCount);
-	DE_UNREF(pFences);
-	DE_UNREF(waitAll);
-	DE_UNREF(timeout);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL getEventStatus (VkDevice device, VkEvent event)
-{
-	DE_UNREF(device);
-	DE_UNREF(event);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL setEvent (VkDevice device, VkEvent event)
-{
-	DE_UNREF(device);
-	DE_UNREF(event);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL resetEvent (VkDevice device, VkEvent event)
-{
-	DE_UNREF(device);
-	DE_UNREF(event);
-	return VK_SUCCESS;
-}
-
 VKAPI_ATTR VkResult VKAPI_CALL getQueryPoolResults (VkDevice device, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount, deUintptr dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
 {
 	DE_UNREF(device);
@@ -541,14 +459,6 @@ VKAPI_ATTR VkResult VKAPI_CALL getQueryPoolResults (VkDevice device, VkQueryPool
 	return VK_SUCCESS;
 }
 
-VKAPI_ATTR void VKAPI_CALL getImageSubresourceLayout (VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
-{
-	DE_UNREF(device);
-	DE_UNREF(image);
-	DE_UNREF(pSubresource);
-	DE_UNREF(pLayout);
-}
-
 VKAPI_ATTR VkResult VKAPI_CALL getPipelineCacheData (VkDevice device, VkPipelineCache pipelineCache, deUintptr* pDataSize, void* pData)
 {
 	DE_UNREF(device);
@@ -583,34 +493,6 @@ VKAPI_ATTR void VKAPI_CALL getRenderAreaGranularity (VkDevice device, VkRenderPa
 	DE_UNREF(pGranularity);
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL resetCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
-{
-	DE_UNREF(device);
-	DE_UNREF(commandPool);
-	DE_UNREF(flags);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(pBeginInfo);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer (VkCommandBuffer commandBuffer)
-{
-	DE_UNREF(commandBuffer);
-	return VK_SUCCESS;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(flags);
-	return VK_SUCCESS;
-}
-
 VKAPI_ATTR void VKAPI_CALL cmdBindPipeline (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
 {
 	DE_UNREF(commandBuffer);
@@ -763,96 +645,6 @@ VKAPI_ATTR void VKAPI_CALL cmdDispatchIndirect (VkCommandBuffer commandBuffer, V
 	DE_UNREF(offset);
 }
 
-VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferCopy* pRegions)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(srcBuffer);
-	DE_UNREF(dstBuffer);
-	DE_UNREF(regionCount);
-	DE_UNREF(pRegions);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageCopy* pRegions)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(srcImage);
-	DE_UNREF(srcImageLayout);
-	DE_UNREF(dstImage);
-	DE_UNREF(dstImageLayout);
-	DE_UNREF(regionCount);
-	DE_UNREF(pRegions);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(srcImage);
-	DE_UNREF(srcImageLayout);
-	DE_UNREF(dstImage);
-	DE_UNREF(dstImageLayout);
-	DE_UNREF(regionCount);
-	DE_UNREF(pRegions);
-	DE_UNREF(filter);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkBufferImageCopy* pRegions)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(srcBuffer);
-	DE_UNREF(dstImage);
-	DE_UNREF(dstImageLayout);
-	DE_UNREF(regionCount);
-	DE_UNREF(pRegions);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferImageCopy* pRegions)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(srcImage);
-	DE_UNREF(srcImageLayout);
-	DE_UNREF(dstBuffer);
-	DE_UNREF(regionCount);
-	DE_UNREF(pRegions);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(dstBuffer);
-	DE_UNREF(dstOffset);
-	DE_UNREF(dataSize);
-	DE_UNREF(pData);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, deUint32 data)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(dstBuffer);
-	DE_UNREF(dstOffset);
-	DE_UNREF(size);
-	DE_UNREF(data);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(image);
-	DE_UNREF(imageLayout);
-	DE_UNREF(pColor);
-	DE_UNREF(rangeCount);
-	DE_UNREF(pRanges);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(image);
-	DE_UNREF(imageLayout);
-	DE_UNREF(pDepthStencil);
-	DE_UNREF(rangeCount);
-	DE_UNREF(pRanges);
-}
-
 VKAPI_ATTR void VKAPI_CALL cmdClearAttachments (VkCommandBuffer commandBuffer, deUint32 attachmentCount, const VkClearAttachment* pAttachments, deUint32 rectCount, const VkClearRect* pRects)
 {
 	DE_UNREF(commandBuffer);
@@ -873,20 +665,6 @@ VKAPI_ATTR void VKAPI_CALL cmdResolveImage (VkCommandBuffer commandBuffer, VkIma
 	DE_UNREF(pRegions);
 }
 
-VKAPI_ATTR void VKAPI_CALL cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(event);
-	DE_UNREF(stageMask);
-}
-
-VKAPI_ATTR void VKAPI_CALL cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(event);
-	DE_UNREF(stageMask);
-}
-
 VKAPI_ATTR void VKAPI_CALL cmdWaitEvents (VkCommandBuffer commandBuffer, deUint32 eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, deUint32 memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, deUint32 bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, deUint32 imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
 {
 	DE_UNREF(commandBuffer);
@@ -987,13 +765,6 @@ VKAPI_ATTR void VKAPI_CALL cmdEndRenderPass (VkCommandBuffer commandBuffer)
 	DE_UNREF(commandBuffer);
 }
 
-VKAPI_ATTR void VKAPI_CALL cmdExecuteCommands (VkCommandBuffer commandBuffer, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
-{
-	DE_UNREF(commandBuffer);
-	DE_UNREF(commandBufferCount);
-	DE_UNREF(pCommandBuffers);
-}
-
 VKAPI_ATTR VkResult VKAPI_CALL getPhysicalDeviceSurfaceSupportKHR (VkPhysicalDevice physicalDevice, deUint32 queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
 {
 	DE_UNREF(physicalDevice);
@@ -24,6 +24,7 @@
 #include "vktComputeTestsUtil.hpp"
 #include "vkQueryUtil.hpp"
 #include "vkTypeUtil.hpp"
+#include "tcuProfiler.hpp"
 
 using namespace vk;
 
@@ -282,6 +283,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
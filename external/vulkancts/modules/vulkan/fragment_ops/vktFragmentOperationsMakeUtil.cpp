@@ -25,6 +25,7 @@
 #include "vkTypeUtil.hpp"
 #include "vkPrograms.hpp"
 #include "vkQueryUtil.hpp"
+#include "tcuProfiler.hpp"
 #include <vector>
 
 namespace vkt
@@ -211,6 +212,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
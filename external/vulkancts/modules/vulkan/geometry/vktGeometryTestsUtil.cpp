@@ -26,6 +26,7 @@
 #include "vkTypeUtil.hpp"
 #include "vkDefs.hpp"
 #include "tcuImageCompare.hpp"
+#include "tcuProfiler.hpp"
 
 #include "tcuImageIO.hpp"
 
@@ -660,6 +661,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
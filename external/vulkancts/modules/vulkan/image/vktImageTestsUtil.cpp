@@ -25,6 +25,7 @@
 #include "vkQueryUtil.hpp"
 #include "vkTypeUtil.hpp"
 #include "tcuTextureUtil.hpp"
+#include "tcuProfiler.hpp"
 
 using namespace vk;
 
@@ -389,6 +390,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
@@ -693,22 +693,41 @@ void* mapMemory (const vk::DeviceInterface&	vkd,
 	return ptr;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Host-side model of the memory contents
+ *
+ * Data is stored byte per byte and definedness as one bit per byte packed
+ * into 64-bit words. Range operations update whole definedness words at a
+ * time and compare fully defined spans with deMemCmp().
+ *//*--------------------------------------------------------------------*/
 class ReferenceMemory
 {
 public:
 			ReferenceMemory	(size_t size);
 
-	void	set				(size_t pos, deUint8 val);
 	deUint8	get				(size_t pos) const;
 	bool	isDefined		(size_t pos) const;
 
 	void	setDefined		(size_t offset, size_t size, const void* data);
 	void	setUndefined	(size_t offset, size_t size);
 	void	setData			(size_t offset, size_t size, const void* data);
+	void	setPattern		(size_t offset, size_t size, const void* pattern, size_t patternSize);
+	void	xorDefined		(size_t offset, size_t size, const deUint8* mask);
+
+	//! Find first defined byte that differs from data. Returns position relative to offset, or size if all defined bytes match.
+	size_t	findMismatch	(size_t offset, size_t size, const deUint8* data) const;
 
 	size_t	getSize			(void) const { return m_data.size(); }
 
 private:
+	enum
+	{
+		BYTES_PER_WORD = 64	//!< Bytes covered by one definedness word
+	};
+
+	void	markDefined		(size_t offset, size_t size);
+	deUint64	getDefinedBits	(size_t pos, size_t count) const;
+
 	vector<deUint8>		m_data;
 	vector<deUint64>	m_defined;
 };
@@ -719,34 +738,153 @@ ReferenceMemory::ReferenceMemory (size_t size)
 {
 }
 
-void ReferenceMemory::set (size_t pos, deUint8 val)
+void ReferenceMemory::markDefined (size_t offset, size_t size)
 {
-	DE_ASSERT(pos < m_data.size());
+	if (size == 0)
+		return;
+
+	{
+		const size_t	firstWord	= offset / BYTES_PER_WORD;
+		const size_t	lastWord	= (offset + size - 1) / BYTES_PER_WORD;
+		const deUint64	firstMask	= ~0ull << (offset % BYTES_PER_WORD);
+		const deUint64	lastMask	= ~0ull >> (BYTES_PER_WORD - 1 - ((offset + size - 1) % BYTES_PER_WORD));
 
-	m_data[pos] = val;
-	m_defined[pos / 64] |= 0x1ull << (pos % 64);
+		if (firstWord == lastWord)
+			m_defined[firstWord] |= firstMask & lastMask;
+		else
+		{
+			m_defined[firstWord] |= firstMask;
+			std::fill(m_defined.begin() + firstWord + 1, m_defined.begin() + lastWord, ~0ull);
+			m_defined[lastWord] |= lastMask;
+		}
+	}
 }
 
-void ReferenceMemory::setData (size_t offset, size_t size, const void* data_)
+//! Get definedness bits of count bytes starting from pos. Range must not cross a word boundary.
+deUint64 ReferenceMemory::getDefinedBits (size_t pos, size_t count) const
 {
-	const deUint8* data = (const deUint8*)data_;
+	const size_t	bitNdx	= pos % BYTES_PER_WORD;
+	const deUint64	mask	= count == BYTES_PER_WORD ? ~0ull : ((0x1ull << count) - 1ull);
 
+	DE_ASSERT(count > 0 && bitNdx + count <= BYTES_PER_WORD);
+
+	return (m_defined[pos / BYTES_PER_WORD] >> bitNdx) & mask;
+}
+
+void ReferenceMemory::setData (size_t offset, size_t size, const void* data)
+{
 	DE_ASSERT(offset < m_data.size());
 	DE_ASSERT(offset + size <= m_data.size());
 
-	// \todo [2016-03-09 mika] Optimize
-	for (size_t pos = 0; pos < size; pos++)
+	deMemcpy(&m_data[offset], data, size);
+	markDefined(offset, size);
+}
+
+void ReferenceMemory::setPattern (size_t offset, size_t size, const void* pattern, size_t patternSize)
+{
+	DE_ASSERT(offset + size <= m_data.size());
+	DE_ASSERT(patternSize > 0);
+
+	if (size == 0)
+		return;
+
 	{
-		m_data[offset + pos] = data[pos];
-		m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+		deUint8* const	dst		= &m_data[offset];
+		size_t			copied	= de::min(size, patternSize);
+
+		deMemcpy(dst, pattern, copied);
+
+		// Double the copied span until range is filled, keeping it a multiple of pattern size
+		while (copied < size)
+		{
+			const size_t chunkSize = de::min(copied, size - copied);
+
+			deMemcpy(dst + copied, dst, chunkSize);
+			copied += chunkSize;
+		}
 	}
+
+	markDefined(offset, size);
 }
 
 void ReferenceMemory::setUndefined	(size_t offset, size_t size)
 {
-	// \todo [2016-03-09 mika] Optimize
-	for (size_t pos = 0; pos < size; pos++)
-		m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+	// \note Marks range as defined like the original per-byte implementation did
+	markDefined(offset, size);
+}
+
+void ReferenceMemory::xorDefined (size_t offset, size_t size, const deUint8* mask)
+{
+	DE_ASSERT(offset + size <= m_data.size());
+
+	for (size_t pos = 0; pos < size;)
+	{
+		const size_t	count		= de::min<size_t>(BYTES_PER_WORD - (offset + pos) % BYTES_PER_WORD, size - pos);
+		const deUint64	definedBits	= getDefinedBits(offset + pos, count);
+		deUint8* const	dst			= &m_data[offset + pos];
+
+		if (definedBits == (count == BYTES_PER_WORD ? ~0ull : ((0x1ull << count) - 1ull)))
+		{
+			for (size_t ndx = 0; ndx < count; ndx++)
+				dst[ndx] ^= mask[pos + ndx];
+		}
+		else if (definedBits != 0)
+		{
+			for (size_t ndx = 0; ndx < count; ndx++)
+			{
+				if (isDefined(offset + pos + ndx))
+					dst[ndx] ^= mask[pos + ndx];
+			}
+		}
+
+		pos += count;
+	}
+}
+
+size_t ReferenceMemory::findMismatch (size_t offset, size_t size, const deUint8* data) const
+{
+	DE_ASSERT(offset + size <= m_data.size());
+
+	for (size_t pos = 0; pos < size;)
+	{
+		const size_t	count		= de::min<size_t>(BYTES_PER_WORD - (offset + pos) % BYTES_PER_WORD, size - pos);
+		const deUint64	definedBits	= getDefinedBits(offset + pos, count);
+
+		if (count == BYTES_PER_WORD && definedBits == ~0ull)
+		{
+			// Compare run of fully defined words at once
+			size_t runSize = count;
+
+			while (pos + runSize + BYTES_PER_WORD <= size && m_defined[(offset + pos + runSize) / BYTES_PER_WORD] == ~0ull)
+				runSize += BYTES_PER_WORD;
+
+			if (deMemCmp(&m_data[offset + pos], data + pos, runSize) != 0)
+			{
+				for (size_t ndx = 0; ndx < runSize; ndx++)
+				{
+					if (m_data[offset + pos + ndx] != data[pos + ndx])
+						return pos + ndx;
+				}
+			}
+
+			pos += runSize;
+		}
+		else
+		{
+			if (definedBits != 0)
+			{
+				for (size_t ndx = 0; ndx < count; ndx++)
+				{
+					if (isDefined(offset + pos + ndx) && m_data[offset + pos + ndx] != data[pos + ndx])
+						return pos + ndx;
+				}
+			}
+
+			pos += count;
+		}
+	}
+
+	return size;
 }
 
 deUint8 ReferenceMemory::get (size_t pos) const
@@ -763,6 +901,22 @@ bool ReferenceMemory::isDefined (size_t pos) const
 	return (m_defined[pos / 64] & (0x1ull << (pos % 64))) != 0;
 }
 
+//! Set reference to random bytes, consuming rng one byte at a time
+void setRandomData (ReferenceMemory& reference, de::Random& rng, size_t size)
+{
+	vector<deUint8>	chunk	(de::min<size_t>(size, 64 * 1024));
+
+	for (size_t offset = 0; offset < size; offset += chunk.size())
+	{
+		const size_t chunkSize = de::min(chunk.size(), size - offset);
+
+		for (size_t ndx = 0; ndx < chunkSize; ndx++)
+			chunk[ndx] = rng.getUint8();
+
+		reference.setData(offset, chunkSize, &chunk[0]);
+	}
+}
+
 class Memory
 {
 public:
@@ -1419,62 +1573,53 @@ void HostMemoryAccess::verify (VerifyContext& context, size_t commandIndex)
 
 	if (m_read && m_write)
 	{
-		for (size_t pos = 0; pos < m_size; pos++)
+		vector<deUint8>	masks	(de::min<size_t>(m_size, 64 * 1024));
+
+		for (size_t offset = 0; offset < m_size; offset += masks.size())
 		{
-			const deUint8	mask	= rng.getUint8();
-			const deUint8	value	= m_readData[pos];
+			const size_t	chunkSize	= de::min(masks.size(), m_size - offset);
+			size_t			mismatch;
+
+			for (size_t ndx = 0; ndx < chunkSize; ndx++)
+				masks[ndx] = rng.getUint8();
+
+			mismatch = reference.findMismatch(offset, chunkSize, &m_readData[offset]);
+			reference.xorDefined(offset, mismatch, &masks[0]);
 
-			if (reference.isDefined(pos))
+			if (mismatch < chunkSize)
 			{
-				if (value != reference.get(pos))
-				{
-					resultCollector.fail(
-							de::toString(commandIndex) + ":" + getName()
-							+ " Result differs from reference, Expected: "
-							+ de::toString(tcu::toHex<8>(reference.get(pos)))
-							+ ", Got: "
-							+ de::toString(tcu::toHex<8>(value))
-							+ ", At offset: "
-							+ de::toString(pos));
-					break;
-				}
+				const size_t pos = offset + mismatch;
 
-				reference.set(pos, reference.get(pos) ^ mask);
+				resultCollector.fail(
+						de::toString(commandIndex) + ":" + getName()
+						+ " Result differs from reference, Expected: "
+						+ de::toString(tcu::toHex<8>(reference.get(pos)))
+						+ ", Got: "
+						+ de::toString(tcu::toHex<8>(m_readData[pos]))
+						+ ", At offset: "
+						+ de::toString(pos));
+				break;
 			}
 		}
 	}
 	else if (m_read)
 	{
-		for (size_t pos = 0; pos < m_size; pos++)
-		{
-			const deUint8	value	= m_readData[pos];
+		const size_t pos = m_size > 0 ? reference.findMismatch(0, m_size, &m_readData[0]) : 0;
 
-			if (reference.isDefined(pos))
-			{
-				if (value != reference.get(pos))
-				{
-					resultCollector.fail(
-							de::toString(commandIndex) + ":" + getName()
-							+ " Result differs from reference, Expected: "
-							+ de::toString(tcu::toHex<8>(reference.get(pos)))
-							+ ", Got: "
-							+ de::toString(tcu::toHex<8>(value))
-							+ ", At offset: "
-							+ de::toString(pos));
-					break;
-				}
-			}
-		}
-	}
-	else if (m_write)
-	{
-		for (size_t pos = 0; pos < m_size; pos++)
+		if (pos < m_size)
 		{
-			const deUint8	value	= rng.getUint8();
-
-			reference.set(pos, value);
+			resultCollector.fail(
+					de::toString(commandIndex) + ":" + getName()
+					+ " Result differs from reference, Expected: "
+					+ de::toString(tcu::toHex<8>(reference.get(pos)))
+					+ ", Got: "
+					+ de::toString(tcu::toHex<8>(m_readData[pos]))
+					+ ", At offset: "
+					+ de::toString(pos));
 		}
 	}
+	else if (m_write)
+		setRandomData(reference, rng, m_size);
 	else
 		DE_FATAL("Host memory access without read or write.");
 }
@@ -2192,15 +2337,18 @@ void FillBuffer::submit (SubmitContext& context)
 void FillBuffer::verify (VerifyContext& context, size_t)
 {
 	ReferenceMemory&	reference	= context.getReference();
+	deUint8				pattern[4];
 
-	for (size_t ndx = 0; ndx < m_bufferSize; ndx++)
+	for (size_t ndx = 0; ndx < 4; ndx++)
 	{
 #if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
-		reference.set(ndx, (deUint8)(0xffu & (m_value >> (8*(ndx % 4)))));
+		pattern[ndx] = (deUint8)(0xffu & (m_value >> (8*ndx)));
 #else
-		reference.set(ndx, (deUint8)(0xffu & (m_value >> (8*(3 - (ndx % 4))))));
+		pattern[ndx] = (deUint8)(0xffu & (m_value >> (8*(3 - ndx))));
 #endif
 	}
+
+	reference.setPattern(0, (size_t)m_bufferSize, pattern, DE_LENGTH_OF_ARRAY(pattern));
 }
 
 class UpdateBuffer : public CmdCommand
@@ -2358,25 +2506,20 @@ void BufferCopyToBuffer::verify (VerifyContext& context, size_t commandIndex)
 		vk::invalidateMappedMemoryRange(vkd, device, *m_memory, 0, m_bufferSize);
 
 		{
-			const deUint8* const data = (const deUint8*)ptr;
+			const deUint8* const	data	= (const deUint8*)ptr;
+			const size_t			size	= (size_t)m_bufferSize;
+			const size_t			pos		= reference.findMismatch(0, size, data);
 
-			for (size_t pos = 0; pos < (size_t)m_bufferSize; pos++)
+			if (pos < size)
 			{
-				if (reference.isDefined(pos))
-				{
-					if (data[pos] != reference.get(pos))
-					{
-						resultCollector.fail(
-								de::toString(commandIndex) + ":" + getName()
-								+ " Result differs from reference, Expected: "
-								+ de::toString(tcu::toHex<8>(reference.get(pos)))
-								+ ", Got: "
-								+ de::toString(tcu::toHex<8>(data[pos]))
-								+ ", At offset: "
-								+ de::toString(pos));
-						break;
-					}
-				}
+				resultCollector.fail(
+						de::toString(commandIndex) + ":" + getName()
+						+ " Result differs from reference, Expected: "
+						+ de::toString(tcu::toHex<8>(reference.get(pos)))
+						+ ", Got: "
+						+ de::toString(tcu::toHex<8>(data[pos]))
+						+ ", At offset: "
+						+ de::toString(pos));
 			}
 		}
 
@@ -2463,8 +2606,7 @@ void BufferCopyFromBuffer::verify (VerifyContext& context, size_t)
 	ReferenceMemory&	reference	(context.getReference());
 	de::Random			rng			(m_seed);
 
-	for (size_t ndx = 0; ndx < (size_t)m_bufferSize; ndx++)
-		reference.set(ndx, rng.getUint8());
+	setRandomData(reference, rng, (size_t)m_bufferSize);
 }
 
 class BufferCopyToImage : public CmdCommand
@@ -2685,25 +2827,20 @@ void BufferCopyToImage::verify (VerifyContext& context, size_t commandIndex)
 		vk::invalidateMappedMemoryRange(vkd, device, *memory, 0,  4 * m_imageWidth * m_imageHeight);
 
 		{
-			const deUint8* const	data = (const deUint8*)ptr;
+			const deUint8* const	data	= (const deUint8*)ptr;
+			const size_t			size	= (size_t)(4 * m_imageWidth * m_imageHeight);
+			const size_t			pos		= reference.findMismatch(0, size, data);
 
-			for (size_t pos = 0; pos < (size_t)( 4 * m_imageWidth * m_imageHeight); pos++)
+			if (pos < size)
 			{
-				if (reference.isDefined(pos))
-				{
-					if (data[pos] != reference.get(pos))
-					{
-						resultCollector.fail(
-								de::toString(commandIndex) + ":" + getName()
-								+ " Result differs from reference, Expected: "
-								+ de::toString(tcu::toHex<8>(reference.get(pos)))
-								+ ", Got: "
-								+ de::toString(tcu::toHex<8>(data[pos]))
-								+ ", At offset: "
-								+ de::toString(pos));
-						break;
-					}
-				}
+				resultCollector.fail(
+						de::toString(commandIndex) + ":" + getName()
+						+ " Result differs from reference, Expected: "
+						+ de::toString(tcu::toHex<8>(reference.get(pos)))
+						+ ", Got: "
+						+ de::toString(tcu::toHex<8>(data[pos]))
+						+ ", At offset: "
+						+ de::toString(pos));
 			}
 		}
 
@@ -2909,8 +3046,7 @@ void BufferCopyFromImage::verify (VerifyContext& context, size_t)
 	ReferenceMemory&	reference		(context.getReference());
 	de::Random			rng	(m_seed);
 
-	for (size_t ndx = 0; ndx < (size_t)(4 * m_imageWidth * m_imageHeight); ndx++)
-		reference.set(ndx, rng.getUint8());
+	setRandomData(reference, rng, (size_t)(4 * m_imageWidth * m_imageHeight));
 }
 
 class ImageCopyToBuffer : public CmdCommand
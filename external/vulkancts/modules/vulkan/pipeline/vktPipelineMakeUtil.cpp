@@ -26,6 +26,7 @@
 #include "vkPrograms.hpp"
 #include "vkRefUtil.hpp"
 #include "vkQueryUtil.hpp"
+#include "tcuProfiler.hpp"
 #include <vector>
 
 namespace vkt
@@ -237,6 +238,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
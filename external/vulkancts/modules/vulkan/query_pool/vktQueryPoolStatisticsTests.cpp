@@ -39,6 +39,7 @@
 #include "vkImageUtil.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuRGBA.hpp"
+#include "tcuProfiler.hpp"
 
 namespace vkt
 {
@@ -151,6 +152,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const VkFenceCreateInfo	fenceInfo	=
 	{
 		VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
@@ -40,7 +40,7 @@ namespace robustness
 
 using namespace vk;
 
-Move<VkDevice> createRobustBufferAccessDevice (Context& context)
+de::MovePtr<DeviceLease> getRobustBufferAccessDevice (Context& context)
 {
 	const float queuePriority = 1.0f;
 
@@ -72,7 +72,7 @@ Move<VkDevice> createRobustBufferAccessDevice (Context& context)
 		&enabledFeatures						// const VkPhysicalDeviceFeatures*	pEnabledFeatures;
 	};
 
-	return createDevice(context.getInstanceInterface(), context.getPhysicalDevice(), &deviceParams);
+	return context.getDevicePool().lease(context.getPhysicalDevice(), deviceParams);
 }
 
 bool areEqual (float a, float b)
@@ -28,6 +28,7 @@
 #include "vkDefs.hpp"
 #include "vkRefUtil.hpp"
 #include "vktTestCase.hpp"
+#include "vktDevicePool.hpp"
 #include "vkMemUtil.hpp"
 #include "deUniquePtr.hpp"
 #include "tcuVectorUtil.hpp"
@@ -37,14 +38,14 @@ namespace vkt
 namespace robustness
 {
 
-vk::Move<vk::VkDevice>	createRobustBufferAccessDevice		(Context& context);
-bool					areEqual							(float a, float b);
-bool					isValueZero							(const void* valuePtr, size_t valueSize);
-bool					isValueWithinBuffer					(const void* buffer, vk::VkDeviceSize bufferSize, const void* valuePtr, size_t valueSizeInBytes);
-bool					isValueWithinBufferOrZero			(const void* buffer, vk::VkDeviceSize bufferSize, const void* valuePtr, size_t valueSizeInBytes);
-bool					verifyOutOfBoundsVec4				(const void* vecPtr, vk::VkFormat bufferFormat);
-void					populateBufferWithTestValues		(void* buffer, vk::VkDeviceSize size, vk::VkFormat format);
-void					logValue							(std::ostringstream& logMsg, const void* valuePtr, vk::VkFormat valueFormat, size_t valueSize);
+de::MovePtr<DeviceLease>	getRobustBufferAccessDevice			(Context& context);
+bool						areEqual							(float a, float b);
+bool						isValueZero							(const void* valuePtr, size_t valueSize);
+bool						isValueWithinBuffer					(const void* buffer, vk::VkDeviceSize bufferSize, const void* valuePtr, size_t valueSizeInBytes);
+bool						isValueWithinBufferOrZero			(const void* buffer, vk::VkDeviceSize bufferSize, const void* valuePtr, size_t valueSizeInBytes);
+bool						verifyOutOfBoundsVec4				(const void* vecPtr, vk::VkFormat bufferFormat);
+void						populateBufferWithTestValues		(void* buffer, vk::VkDeviceSize size, vk::VkFormat format);
+void						logValue							(std::ostringstream& logMsg, const void* valuePtr, vk::VkFormat valueFormat, size_t valueSize);
 
 class TestEnvironment
 {
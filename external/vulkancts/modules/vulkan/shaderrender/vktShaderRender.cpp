@@ -35,6 +35,9 @@
 #include "deFilePath.hpp"
 #include "deMath.h"
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+#include "deThread.hpp"
+#include "deAtomic.h"
 
 #include "vkDeviceUtil.hpp"
 #include "vkImageUtil.hpp"
@@ -61,6 +64,7 @@ namespace
 static const deUint32	MAX_RENDER_WIDTH	= 128;
 static const deUint32	MAX_RENDER_HEIGHT	= 128;
 static const tcu::Vec4	DEFAULT_CLEAR_COLOR	= tcu::Vec4(0.125f, 0.25f, 0.5f, 1.0f);
+static const int		MIN_VALUES_PER_THREAD	= 2048;
 
 static VkImageViewType textureTypeToImageViewType (TextureBinding::Type type)
 {
@@ -167,6 +171,8 @@ public:
 	int										getNumUserAttribs		(void) const { return (int)m_userAttribTransforms.size(); }
 	tcu::Vec4								getUserAttrib			(int attribNdx, float sx, float sy) const;
 
+	void									setupBatch				(ShaderEvalBatch& batch, const float* sx, float sy, int numValues) const;
+
 private:
 	const int								m_gridSize;
 	const int								m_numVertices;
@@ -275,6 +281,58 @@ inline tcu::Vec4 QuadGrid::getUserAttrib (int attribNdx, float sx, float sy) con
 	return m_userAttribTransforms[attribNdx] * tcu::Vec4(sx, sy, 0.0f, 1.0f);
 }
 
+void QuadGrid::setupBatch (ShaderEvalBatch& batch, const float* sx, float sy, int numValues) const
+{
+	// Same computations as in getCoords(), getUnitCoords() and getUserAttrib(), for a row of values at a time.
+	const float fy = 2.0f * sy - 1.0f;
+
+	DE_ASSERT(numValues <= ShaderEvalBatch::MAX_SIZE);
+	DE_ASSERT(getNumUserAttribs() <= ShaderEvalContext::MAX_USER_ATTRIBS);
+
+	batch.numValues			= numValues;
+	batch.numUserAttribs	= getNumUserAttribs();
+
+	for (int ndx = 0; ndx < numValues; ndx++)
+	{
+		const float fx = 2.0f * sx[ndx] - 1.0f;
+
+		batch.coords[0][ndx]		= fx;
+		batch.coords[1][ndx]		= fy;
+		batch.coords[2][ndx]		= -fx + 0.33f*fy;
+		batch.coords[3][ndx]		= -0.275f*fx - fy;
+
+		batch.unitCoords[0][ndx]	= sx[ndx];
+		batch.unitCoords[1][ndx]	= sy;
+		batch.unitCoords[2][ndx]	= 0.33f*sx[ndx] + 0.5f*sy;
+		batch.unitCoords[3][ndx]	= 0.5f*sx[ndx] + 0.25f*sy;
+
+		batch.color[0][ndx]			= 0.0f;
+		batch.color[1][ndx]			= 0.0f;
+		batch.color[2][ndx]			= 0.0f;
+		batch.color[3][ndx]			= 1.0f;
+		batch.isDiscarded[ndx]		= false;
+	}
+
+	for (int attribNdx = 0; attribNdx < getNumUserAttribs(); attribNdx++)
+	{
+		const tcu::Mat4& transform = m_userAttribTransforms[attribNdx];
+
+		for (int compNdx = 0; compNdx < 4; compNdx++)
+		{
+			for (int ndx = 0; ndx < numValues; ndx++)
+			{
+				// Matches Mat4 * Vec4(sx, sy, 0.0, 1.0) exactly
+				float v = 0.0f;
+				v += transform(compNdx, 0) * sx[ndx];
+				v += transform(compNdx, 1) * sy;
+				v += transform(compNdx, 2) * 0.0f;
+				v += transform(compNdx, 3) * 1.0f;
+				batch.in[attribNdx][compNdx][ndx] = v;
+			}
+		}
+	}
+}
+
 // TextureBinding
 
 TextureBinding::TextureBinding (const tcu::Archive&	archive,
@@ -430,6 +488,18 @@ void ShaderEvalContext::reset (float sx, float sy)
 		in[attribNdx] = m_quadGrid.getUserAttrib(attribNdx, sx, sy);
 }
 
+void ShaderEvalContext::reset (const ShaderEvalBatch& batch, int valueNdx)
+{
+	color		= tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	isDiscarded	= false;
+
+	coords		= batch.getCoords(valueNdx);
+	unitCoords	= batch.getUnitCoords(valueNdx);
+
+	for (int attribNdx = 0; attribNdx < batch.numUserAttribs; attribNdx++)
+		in[attribNdx] = batch.getIn(attribNdx, valueNdx);
+}
+
 tcu::Vec4 ShaderEvalContext::texture2D (int unitNdx, const tcu::Vec2& texCoords)
 {
 	if (textures[unitNdx].tex2D)
@@ -438,6 +508,40 @@ tcu::Vec4 ShaderEvalContext::texture2D (int unitNdx, const tcu::Vec2& texCoords)
 		return tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
 }
 
+// ShaderEvalBatch.
+
+ShaderEvalBatch::ShaderEvalBatch (void)
+	: numValues			(0)
+	, numUserAttribs	(0)
+{
+}
+
+tcu::Vec4 ShaderEvalBatch::getCoords (int valueNdx) const
+{
+	return tcu::Vec4(coords[0][valueNdx], coords[1][valueNdx], coords[2][valueNdx], coords[3][valueNdx]);
+}
+
+tcu::Vec4 ShaderEvalBatch::getUnitCoords (int valueNdx) const
+{
+	return tcu::Vec4(unitCoords[0][valueNdx], unitCoords[1][valueNdx], unitCoords[2][valueNdx], unitCoords[3][valueNdx]);
+}
+
+tcu::Vec4 ShaderEvalBatch::getIn (int attribNdx, int valueNdx) const
+{
+	return tcu::Vec4(in[attribNdx][0][valueNdx], in[attribNdx][1][valueNdx], in[attribNdx][2][valueNdx], in[attribNdx][3][valueNdx]);
+}
+
+tcu::Vec4 ShaderEvalBatch::getColor (int valueNdx) const
+{
+	return tcu::Vec4(color[0][valueNdx], color[1][valueNdx], color[2][valueNdx], color[3][valueNdx]);
+}
+
+void ShaderEvalBatch::setColor (int valueNdx, const tcu::Vec4& value)
+{
+	for (int compNdx = 0; compNdx < 4; compNdx++)
+		color[compNdx][valueNdx] = value[compNdx];
+}
+
 // ShaderEvaluator.
 
 ShaderEvaluator::ShaderEvaluator (void)
@@ -460,6 +564,134 @@ void ShaderEvaluator::evaluate (ShaderEvalContext& ctx) const
 	m_evalFunc(ctx);
 }
 
+void ShaderEvaluator::evaluateBatch (ShaderEvalContext& ctx, ShaderEvalBatch& batch) const
+{
+	for (int valueNdx = 0; valueNdx < batch.numValues; valueNdx++)
+	{
+		ctx.reset(batch, valueNdx);
+		evaluate(ctx);
+
+		batch.setColor(valueNdx, ctx.color);
+		batch.isDiscarded[valueNdx] = ctx.isDiscarded;
+	}
+}
+
+namespace
+{
+
+// Evaluates shader at a grid of points given as separate x and y coordinates. Rows are claimed by worker threads.
+class GridEvaluator
+{
+public:
+	GridEvaluator (const ShaderEvaluator& evaluator, const QuadGrid& quadGrid, const std::vector<float>& sx, const std::vector<float>& sy, qpWatchDog* watchDog)
+		: m_evaluator	(evaluator)
+		, m_quadGrid	(quadGrid)
+		, m_sx			(sx)
+		, m_sy			(sy)
+		, m_watchDog	(watchDog)
+		, m_colors		(sx.size()*sy.size())
+		, m_isDiscarded	(sx.size()*sy.size(), 0)
+		, m_nextRow		(0)
+	{
+	}
+
+	//! Evaluate rows until all rows have been claimed. Called from all evaluation threads.
+	void processRows (bool isMainThread)
+	{
+		const int								numCols	= (int)m_sx.size();
+		ShaderEvalContext						evalCtx	(m_quadGrid);
+		const de::UniquePtr<ShaderEvalBatch>	batch	(new ShaderEvalBatch());
+
+		for (;;)
+		{
+			const int rowNdx = (int)deAtomicIncrementInt32(&m_nextRow) - 1;
+
+			if (rowNdx >= (int)m_sy.size())
+				break;
+
+			for (int colOffset = 0; colOffset < numCols; colOffset += ShaderEvalBatch::MAX_SIZE)
+			{
+				const int numValues = de::min(numCols - colOffset, (int)ShaderEvalBatch::MAX_SIZE);
+
+				m_quadGrid.setupBatch(*batch, &m_sx[colOffset], m_sy[rowNdx], numValues);
+				m_evaluator.evaluateBatch(evalCtx, *batch);
+
+				for (int valueNdx = 0; valueNdx < numValues; valueNdx++)
+				{
+					m_colors[rowNdx*numCols + colOffset + valueNdx]			= batch->getColor(valueNdx);
+					m_isDiscarded[rowNdx*numCols + colOffset + valueNdx]	= batch->isDiscarded[valueNdx] ? 1 : 0;
+				}
+			}
+
+			if (isMainThread && m_watchDog)
+				qpWatchDog_touch(m_watchDog);
+		}
+	}
+
+	const tcu::Vec4&	getColor		(int x, int y) const	{ return m_colors[y*(int)m_sx.size() + x];				}
+	bool				isDiscarded		(int x, int y) const	{ return m_isDiscarded[y*(int)m_sx.size() + x] != 0;	}
+
+private:
+	const ShaderEvaluator&		m_evaluator;
+	const QuadGrid&				m_quadGrid;
+	const std::vector<float>&	m_sx;
+	const std::vector<float>&	m_sy;
+	qpWatchDog* const			m_watchDog;
+
+	std::vector<tcu::Vec4>		m_colors;
+	std::vector<deUint8>		m_isDiscarded;
+	volatile deInt32			m_nextRow;
+};
+
+class GridEvaluateThread : public de::Thread
+{
+public:
+	GridEvaluateThread (GridEvaluator& evaluator)
+		: m_evaluator(evaluator)
+	{
+	}
+
+	void run (void)
+	{
+		m_evaluator.processRows(false);
+	}
+
+private:
+	GridEvaluator&	m_evaluator;
+};
+
+void evaluateGrid (GridEvaluator& evaluator, int numValues)
+{
+	const int										numThreads	= de::min((int)deGetNumAvailableLogicalCores(), numValues / MIN_VALUES_PER_THREAD);
+	std::vector<de::SharedPtr<GridEvaluateThread> >	threads;
+
+	// Calling thread evaluates rows as well.
+	try
+	{
+		for (int threadNdx = 1; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<GridEvaluateThread>(new GridEvaluateThread(evaluator)));
+			threads.back()->start();
+		}
+
+		evaluator.processRows(true);
+	}
+	catch (...)
+	{
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		{
+			if (threads[threadNdx]->isStarted())
+				threads[threadNdx]->join();
+		}
+		throw;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		threads[threadNdx]->join();
+}
+
+} // anonymous
+
 // UniformSetup.
 
 UniformSetup::UniformSetup (void)
@@ -3013,21 +3245,23 @@ void ShaderRenderCaseInstance::computeVertexReference (tcu::Surface& result, con
 	const int				gridSize	= quadGrid.getGridSize();
 	const int				stride		= gridSize + 1;
 	const bool				hasAlpha	= true; // \todo [2015-09-07 elecro] add correct alpha check
-	ShaderEvalContext		evalCtx		(quadGrid);
+	std::vector<float>		gridCoords	(gridSize + 1);
+
+	for (int ndx = 0; ndx < gridSize+1; ndx++)
+		gridCoords[ndx] = (float)ndx / (float)gridSize;
 
 	// Evaluate color for each vertex.
+	GridEvaluator			evaluator	(*m_evaluator, quadGrid, gridCoords, gridCoords, m_context.getTestContext().getWatchDog());
+	evaluateGrid(evaluator, (gridSize + 1) * (gridSize + 1));
+
 	std::vector<tcu::Vec4>	colors		((gridSize + 1) * (gridSize + 1));
 	for (int y = 0; y < gridSize+1; y++)
 	for (int x = 0; x < gridSize+1; x++)
 	{
-		const float	sx			= (float)x / (float)gridSize;
-		const float	sy			= (float)y / (float)gridSize;
 		const int	vtxNdx		= ((y * (gridSize+1)) + x);
 
-		evalCtx.reset(sx, sy);
-		m_evaluator->evaluate(evalCtx);
-		DE_ASSERT(!evalCtx.isDiscarded); // Discard is not available in vertex shader.
-		tcu::Vec4 color = evalCtx.color;
+		DE_ASSERT(!evaluator.isDiscarded(x, y)); // Discard is not available in vertex shader.
+		tcu::Vec4 color = evaluator.getColor(x, y);
 
 		if (!hasAlpha)
 			color.w() = 1.0f;
@@ -3100,19 +3334,25 @@ void ShaderRenderCaseInstance::computeFragmentReference (tcu::Surface& result, c
 	const int			width		= result.getWidth();
 	const int			height		= result.getHeight();
 	const bool			hasAlpha	= true;  // \todo [2015-09-07 elecro] add correct alpha check
-	ShaderEvalContext	evalCtx		(quadGrid);
+	std::vector<float>	sx			(width);
+	std::vector<float>	sy			(height);
+
+	for (int x = 0; x < width; x++)
+		sx[x] = ((float)x + 0.5f) / (float)width;
+
+	for (int y = 0; y < height; y++)
+		sy[y] = ((float)y + 0.5f) / (float)height;
+
+	// Evaluate.
+	GridEvaluator		evaluator	(*m_evaluator, quadGrid, sx, sy, m_context.getTestContext().getWatchDog());
+	evaluateGrid(evaluator, width * height);
 
 	// Render.
 	for (int y = 0; y < height; y++)
 	for (int x = 0; x < width; x++)
 	{
-		const float sx = ((float)x + 0.5f) / (float)width;
-		const float sy = ((float)y + 0.5f) / (float)height;
-
-		evalCtx.reset(sx, sy);
-		m_evaluator->evaluate(evalCtx);
 		// Select either clear color or computed color based on discarded bit.
-		tcu::Vec4 color = evalCtx.isDiscarded ? m_clearColor : evalCtx.color;
+		tcu::Vec4 color = evaluator.isDiscarded(x, y) ? m_clearColor : evaluator.getColor(x, y);
 
 		if (!hasAlpha)
 			color.w() = 1.0f;
@@ -63,6 +63,7 @@ private:
 };
 
 class QuadGrid;
+class ShaderEvalBatch;
 class ShaderRenderCaseInstance;
 
 class TextureBinding
@@ -201,6 +202,7 @@ public:
 							~ShaderEvalContext		(void);
 
 	void					reset					(float sx, float sy);
+	void					reset					(const ShaderEvalBatch& batch, int valueNdx);
 
 	// Inputs.
 	tcu::Vec4				coords;
@@ -222,6 +224,38 @@ private:
 	const QuadGrid&			m_quadGrid;
 };
 
+// ShaderEvalBatch.
+// Inputs and outputs for a row of evaluations, one array per vector component.
+
+class ShaderEvalBatch
+{
+public:
+	enum
+	{
+		MAX_SIZE	= 128
+	};
+
+							ShaderEvalBatch			(void);
+
+	tcu::Vec4				getCoords				(int valueNdx) const;
+	tcu::Vec4				getUnitCoords			(int valueNdx) const;
+	tcu::Vec4				getIn					(int attribNdx, int valueNdx) const;
+	tcu::Vec4				getColor				(int valueNdx) const;
+	void					setColor				(int valueNdx, const tcu::Vec4& value);
+
+	int						numValues;
+	int						numUserAttribs;
+
+	// Inputs.
+	float					coords[4][MAX_SIZE];
+	float					unitCoords[4][MAX_SIZE];
+	float					in[ShaderEvalContext::MAX_USER_ATTRIBS][4][MAX_SIZE];
+
+	// Outputs.
+	float					color[4][MAX_SIZE];
+	bool					isDiscarded[MAX_SIZE];
+};
+
 typedef void (*ShaderEvalFunc) (ShaderEvalContext& c);
 
 inline void evalCoordsPassthroughX		(ShaderEvalContext& c) { c.color.x() = c.coords.x(); }
@@ -231,7 +265,8 @@ inline void evalCoordsPassthrough		(ShaderEvalContext& c) { c.color = c.coords;
 inline void evalCoordsSwizzleWZYX		(ShaderEvalContext& c) { c.color = c.coords.swizzle(3,2,1,0); }
 
 // ShaderEvaluator
-// Either inherit a class with overridden evaluate() or just pass in an evalFunc.
+// Either inherit a class with overridden evaluate() or evaluateBatch(), or just pass in an evalFunc.
+// Reference is computed in several threads at once.
 
 class ShaderEvaluator
 {
@@ -242,6 +277,9 @@ public:
 
 	virtual void			evaluate				(ShaderEvalContext& ctx) const;
 
+	//! Evaluate all values in batch. Default implementation calls evaluate() for each value using ctx.
+	virtual void			evaluateBatch			(ShaderEvalContext& ctx, ShaderEvalBatch& batch) const;
+
 private:
 							ShaderEvaluator			(const ShaderEvaluator&);   // not allowed!
 	ShaderEvaluator&		operator=				(const ShaderEvaluator&);   // not allowed!
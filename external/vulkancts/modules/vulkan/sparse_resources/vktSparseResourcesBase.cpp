@@ -154,9 +154,8 @@ void SparseResourcesBaseInstance::createDeviceSupportingQueues(const QueueRequir
 		&deviceFeatures,							// const VkPhysicalDeviceFeatures*    pEnabledFeatures;
 	};
 
-	m_logicalDevice = createDevice(instance, physicalDevice, &deviceInfo);
-	m_deviceDriver	= de::MovePtr<DeviceDriver>(new DeviceDriver(instance, *m_logicalDevice));
-	m_allocator		= de::MovePtr<Allocator>(new SimpleAllocator(*m_deviceDriver, *m_logicalDevice, getPhysicalDeviceMemoryProperties(instance, physicalDevice)));
+	m_deviceLease	= m_context.getDevicePool().lease(physicalDevice, deviceInfo);
+	m_allocator		= de::MovePtr<Allocator>(new SimpleAllocator(getDeviceInterface(), getDevice(), getPhysicalDeviceMemoryProperties(instance, physicalDevice)));
 
 	for (QueuesMap::iterator queuesIter = m_queues.begin(); queuesIter != m_queues.end(); ++queuesIter)
 	{
@@ -164,7 +163,7 @@ void SparseResourcesBaseInstance::createDeviceSupportingQueues(const QueueRequir
 		{
 			Queue& queue = queuesIter->second[queueNdx];
 
-			queue.queueHandle = getDeviceQueue(*m_deviceDriver, *m_logicalDevice, queue.queueFamilyIndex, queue.queueIndex);
+			queue.queueHandle = getDeviceQueue(getDeviceInterface(), getDevice(), queue.queueFamilyIndex, queue.queueIndex);
 		}
 	}
 }
@@ -25,6 +25,7 @@
 
 #include "vkDefs.hpp"
 #include "vktTestCase.hpp"
+#include "vktDevicePool.hpp"
 #include "vkRef.hpp"
 #include "vkPlatform.hpp"
 #include "deUniquePtr.hpp"
@@ -65,14 +66,13 @@ protected:
 
 	void												createDeviceSupportingQueues	(const QueueRequirementsVec& queueRequirements);
 	const Queue&										getQueue						(const vk::VkQueueFlags queueFlags, const deUint32 queueIndex) const;
-	const vk::DeviceInterface&							getDeviceInterface				(void) const { return *m_deviceDriver; }
-	vk::VkDevice										getDevice						(void) const { return *m_logicalDevice; }
+	const vk::DeviceInterface&							getDeviceInterface				(void) const { return m_deviceLease->getDeviceInterface(); }
+	vk::VkDevice										getDevice						(void) const { return m_deviceLease->getDevice(); }
 	vk::Allocator&										getAllocator					(void)		 { return *m_allocator; }
 
 private:
 	std::map<vk::VkQueueFlags, std::vector<Queue> >		m_queues;
-	de::MovePtr<vk::DeviceDriver>						m_deviceDriver;
-	vk::Move<vk::VkDevice>								m_logicalDevice;
+	de::MovePtr<DeviceLease>							m_deviceLease;
 	de::MovePtr<vk::Allocator>							m_allocator;
 };
 
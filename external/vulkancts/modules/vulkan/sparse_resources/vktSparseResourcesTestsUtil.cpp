@@ -25,6 +25,7 @@
 #include "vkQueryUtil.hpp"
 #include "vkTypeUtil.hpp"
 #include "tcuTextureUtil.hpp"
+#include "tcuProfiler.hpp"
 
 #include <deMath.h>
 
@@ -537,6 +538,8 @@ void submitCommandsAndWait (const DeviceInterface&		vk,
 							const deUint32				signalSemaphoreCount,
 							const VkSemaphore*			pSignalSemaphores)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const VkFenceCreateInfo	fenceParams =
 	{
 		VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
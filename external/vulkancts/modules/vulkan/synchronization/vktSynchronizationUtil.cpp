@@ -24,6 +24,7 @@
 #include "vktSynchronizationUtil.hpp"
 #include "vkTypeUtil.hpp"
 #include "deStringUtil.hpp"
+#include "tcuProfiler.hpp"
 
 namespace vkt
 {
@@ -287,6 +288,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
@@ -25,6 +25,7 @@
 #include "vktTessellationUtil.hpp"
 #include "vkTypeUtil.hpp"
 #include "deMath.h"
+#include "tcuProfiler.hpp"
 
 namespace vkt
 {
@@ -266,6 +267,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const Unique<VkFence> fence(createFence(vk, device));
 
 	const VkSubmitInfo submitInfo =
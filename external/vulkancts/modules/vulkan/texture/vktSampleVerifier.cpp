@@ -25,6 +25,9 @@
 #include "vktSampleVerifierUtil.hpp"
 
 #include "deMath.h"
+#include "deAtomic.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
 #include "tcuFloat.hpp"
 #include "tcuTextureUtil.hpp"
 #include "vkImageUtil.hpp"
@@ -60,8 +63,77 @@ int calcUnnormalizedDim (const ImgDim dim)
 	}
 }
 
+enum
+{
+	SAMPLES_PER_BATCH_CHUNK		= 64,	//!< Number of samples claimed by a thread at a time.
+	MIN_SAMPLES_PER_THREAD		= 256	//!< Don't spawn threads for smaller batches.
+};
+
 } // anonymous
 
+class SampleVerifier::BatchVerifier
+{
+public:
+	BatchVerifier (const SampleVerifier& verifier, const SampleArguments* args, const Vec4* results, int numSamples)
+		: m_verifier	(verifier)
+		, m_args		(args)
+		, m_results		(results)
+		, m_numSamples	(numSamples)
+		, m_isValid		(numSamples, 0)
+		, m_nextChunk	(0)
+	{
+	}
+
+	//! Verify chunks until all chunks have been claimed. Called from all verification threads.
+	void processChunks (void)
+	{
+		// Create unopened ofstream to simulate "null" ostream
+		std::ofstream nullStream;
+
+		for (;;)
+		{
+			const int chunkStart = ((int)deAtomicIncrementInt32(&m_nextChunk) - 1) * SAMPLES_PER_BATCH_CHUNK;
+
+			if (chunkStart >= m_numSamples)
+				break;
+
+			for (int sampleNdx = chunkStart; sampleNdx < de::min(chunkStart + SAMPLES_PER_BATCH_CHUNK, m_numSamples); ++sampleNdx)
+				m_isValid[sampleNdx] = m_verifier.verifySampleImpl(m_args[sampleNdx], m_results[sampleNdx], nullStream) ? 1 : 0;
+		}
+	}
+
+	bool isValid (int sampleNdx) const
+	{
+		return m_isValid[sampleNdx] != 0;
+	}
+
+private:
+	const SampleVerifier&		m_verifier;
+	const SampleArguments*		m_args;
+	const Vec4*					m_results;
+	const int					m_numSamples;
+
+	std::vector<deUint8>		m_isValid;
+	volatile deInt32			m_nextChunk;
+};
+
+class SampleVerifier::BatchVerifyThread : public de::Thread
+{
+public:
+	BatchVerifyThread (BatchVerifier& verifier)
+		: m_verifier(verifier)
+	{
+	}
+
+	void run (void)
+	{
+		m_verifier.processChunks();
+	}
+
+private:
+	BatchVerifier&	m_verifier;
+};
+
 SampleVerifier::SampleVerifier (const ImageViewParameters&						imParams,
 								const SamplerParameters&						samplerParams,
 								const SampleLookupSettings&						sampleLookupSettings,
@@ -80,7 +152,44 @@ SampleVerifier::SampleVerifier (const ImageViewParameters&						imParams,
 	, m_unnormalizedDim			(calcUnnormalizedDim(imParams.dim))
 	, m_levels					(levels)
 {
+	initTexelRanges();
+}
+
+void SampleVerifier::initTexelRanges (void)
+{
+	const TextureFormat texFormat = mapVkFormat(m_imParams.format);
+
+	m_levelTexelRanges.resize(m_levels.size());
+
+	for (size_t levelNdx = 0; levelNdx < m_levels.size(); ++levelNdx)
+	{
+		const ConstPixelBufferAccess&	levelAccess	= m_levels[levelNdx];
+		LevelTexelRanges&				ranges		= m_levelTexelRanges[levelNdx];
+		const size_t					numTexels	= (size_t)levelAccess.getWidth() * (size_t)levelAccess.getHeight() * (size_t)levelAccess.getDepth();
+		size_t							texelNdx	= 0;
+
+		ranges.texelMin.resize(numTexels);
+		ranges.texelMax.resize(numTexels);
 
+		for (int z = 0; z < levelAccess.getDepth(); ++z)
+		for (int y = 0; y < levelAccess.getHeight(); ++y)
+		for (int x = 0; x < levelAccess.getWidth(); ++x)
+		{
+			convertFormat(levelAccess.getPixelPtr(x, y, z), texFormat, m_conversionPrecision, ranges.texelMin[texelNdx], ranges.texelMax[texelNdx]);
+
+#if defined(DE_DEBUG)
+			// Make sure tcuTexture agrees
+			{
+				const tcu::Vec4 refPix = levelAccess.getPixel(x, y, z);
+
+				for (int c = 0; c < 4; c++)
+					DE_ASSERT(de::inRange(refPix[c], ranges.texelMin[texelNdx][c], ranges.texelMax[texelNdx][c]));
+			}
+#endif
+
+			++texelNdx;
+		}
+	}
 }
 
 bool SampleVerifier::coordOutOfRange (const IVec3& coord, int compNdx, int level) const
@@ -96,33 +205,32 @@ void SampleVerifier::fetchTexelWrapped (const IVec3&	coord,
 										Vec4&			resultMin,
 										Vec4&			resultMax) const
 {
-    const void* pixelPtr = DE_NULL;
+	const tcu::ConstPixelBufferAccess&	levelAccess	= m_levels[level];
+	IVec3								accessCoord;
 
 	if (m_imParams.dim == IMG_DIM_1D)
 	{
-	    pixelPtr = m_levels[level].getPixelPtr(coord[0], layer, 0);
+	    accessCoord = IVec3(coord[0], layer, 0);
 	}
 	else if (m_imParams.dim == IMG_DIM_2D || m_imParams.dim == IMG_DIM_CUBE)
 	{
-		pixelPtr = m_levels[level].getPixelPtr(coord[0], coord[1], layer);
+		accessCoord = IVec3(coord[0], coord[1], layer);
 	}
 	else
 	{
-		pixelPtr = m_levels[level].getPixelPtr(coord[0], coord[1], coord[2]);
+		accessCoord = coord;
 	}
 
-	convertFormat(pixelPtr, mapVkFormat(m_imParams.format), m_conversionPrecision, resultMin, resultMax);
+	DE_ASSERT(de::inBounds(accessCoord[0], 0, levelAccess.getWidth()) &&
+			  de::inBounds(accessCoord[1], 0, levelAccess.getHeight()) &&
+			  de::inBounds(accessCoord[2], 0, levelAccess.getDepth()));
 
-#if defined(DE_DEBUG)
-	// Make sure tcuTexture agrees
-	const tcu::ConstPixelBufferAccess&	levelAccess	= m_levels[level];
-	const tcu::Vec4						refPix		= (m_imParams.dim == IMG_DIM_1D) ? levelAccess.getPixel(coord[0], layer, 0)
-													: (m_imParams.dim == IMG_DIM_2D || m_imParams.dim == IMG_DIM_CUBE) ? levelAccess.getPixel(coord[0], coord[1], layer)
-													: levelAccess.getPixel(coord[0], coord[1], coord[2]);
+	{
+		const size_t texelNdx = ((size_t)accessCoord[2] * (size_t)levelAccess.getHeight() + (size_t)accessCoord[1]) * (size_t)levelAccess.getWidth() + (size_t)accessCoord[0];
 
-	for (int c = 0; c < 4; c++)
-		DE_ASSERT(de::inRange(refPix[c], resultMin[c], resultMax[c]));
-#endif
+		resultMin = m_levelTexelRanges[level].texelMin[texelNdx];
+		resultMax = m_levelTexelRanges[level].texelMax[texelNdx];
+	}
 }
 
 void SampleVerifier::fetchTexel (const IVec3&	coordIn,
@@ -955,5 +1063,47 @@ bool SampleVerifier::verifySample (const SampleArguments&	args,
 	return verifySampleImpl(args, result, nullStream);
 }
 
+void SampleVerifier::verifySamples (const SampleArguments*	args,
+									const Vec4*				results,
+									int						numSamples,
+									std::vector<int>&		failedSamples) const
+{
+	BatchVerifier									verifier	(*this, args, results, numSamples);
+	const int										numThreads	= de::min((int)deGetNumAvailableLogicalCores(), numSamples / MIN_SAMPLES_PER_THREAD);
+	std::vector<de::SharedPtr<BatchVerifyThread> >	threads;
+
+	// Calling thread verifies samples as well.
+	try
+	{
+		for (int threadNdx = 1; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<BatchVerifyThread>(new BatchVerifyThread(verifier)));
+			threads.back()->start();
+		}
+
+		verifier.processChunks();
+	}
+	catch (...)
+	{
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		{
+			if (threads[threadNdx]->isStarted())
+				threads[threadNdx]->join();
+		}
+		throw;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		threads[threadNdx]->join();
+
+	failedSamples.clear();
+
+	for (int sampleNdx = 0; sampleNdx < numSamples; ++sampleNdx)
+	{
+		if (!verifier.isValid(sampleNdx))
+			failedSamples.push_back(sampleNdx);
+	}
+}
+
 } // texture
 } // vkt
@@ -138,7 +138,24 @@ public:
 										 const tcu::Vec4&									result,
 										 std::string&										report) const;
 
+	//! Verify samples in multiple threads. Indices of failed samples are returned in ascending order.
+	void verifySamples					(const SampleArguments*								args,
+										 const tcu::Vec4*									results,
+										 int												numSamples,
+										 std::vector<int>&									failedSamples) const;
+
 private:
+	class BatchVerifier;
+	class BatchVerifyThread;
+
+	//! Texel value ranges of a mipmap level, converted once with convertFormat().
+	struct LevelTexelRanges
+	{
+		std::vector<tcu::Vec4>	texelMin;
+		std::vector<tcu::Vec4>	texelMax;
+	};
+
+	void initTexelRanges				(void);
 
 	bool verifySampleFiltered			(const tcu::Vec4&									result,
 										 const tcu::IVec3&								    baseTexelHi,
@@ -241,6 +258,7 @@ private:
 	const int										m_unnormalizedDim;
 
 	const std::vector<tcu::ConstPixelBufferAccess>&	m_levels;
+	std::vector<LevelTexelRanges>					m_levelTexelRanges;
 };
 
 } // texture
@@ -757,7 +757,7 @@ bool TextureFilteringTestInstance::verify (void)
 	const int				coordBits			= (int)m_context.getDeviceProperties().limits.subTexelPrecisionBits;
 	const int				mipmapBits			= (int)m_context.getDeviceProperties().limits.mipmapPrecisionBits;
 	const int				maxPrintedFailures	= 5;
-	int						failCount			= 0;
+	std::vector<int>		failedSamples;
 
 	const SampleVerifier	verifier			(m_imParams,
 												 m_samplerParams,
@@ -768,37 +768,34 @@ bool TextureFilteringTestInstance::verify (void)
 												 getFilteringPrecision(m_imParams.format),
 												 m_levels);
 
+	verifier.verifySamples(&m_sampleArguments[0], &m_resultSamples[0], (int)m_numSamples, failedSamples);
 
-	for (deUint32 sampleNdx = 0; sampleNdx < m_numSamples; ++sampleNdx)
+	for (int failNdx = 0; failNdx < de::min((int)failedSamples.size(), maxPrintedFailures); ++failNdx)
 	{
-		if (!verifier.verifySample(m_sampleArguments[sampleNdx], m_resultSamples[sampleNdx]))
-		{
-			if (failCount++ < maxPrintedFailures)
-			{
-				// Re-run with report logging
-				std::string report;
-				verifier.verifySampleReport(m_sampleArguments[sampleNdx], m_resultSamples[sampleNdx], report);
-
-				m_context.getTestContext().getLog()
-					<< TestLog::Section("Failed sample", "Failed sample")
-					<< TestLog::Message
-					<< "Sample " << sampleNdx << ".\n"
-					<< "\tCoordinate: " << m_sampleArguments[sampleNdx].coord << "\n"
-					<< "\tLOD: " << m_sampleArguments[sampleNdx].lod << "\n"
-					<< "\tGPU Result: " << m_resultSamples[sampleNdx] << "\n\n"
-					<< "Failure report:\n" << report << "\n"
-					<< TestLog::EndMessage
-					<< TestLog::EndSection;
-			}
-		}
+		const int sampleNdx = failedSamples[failNdx];
+
+		// Re-run with report logging
+		std::string report;
+		verifier.verifySampleReport(m_sampleArguments[sampleNdx], m_resultSamples[sampleNdx], report);
+
+		m_context.getTestContext().getLog()
+			<< TestLog::Section("Failed sample", "Failed sample")
+			<< TestLog::Message
+			<< "Sample " << sampleNdx << ".\n"
+			<< "\tCoordinate: " << m_sampleArguments[sampleNdx].coord << "\n"
+			<< "\tLOD: " << m_sampleArguments[sampleNdx].lod << "\n"
+			<< "\tGPU Result: " << m_resultSamples[sampleNdx] << "\n\n"
+			<< "Failure report:\n" << report << "\n"
+			<< TestLog::EndMessage
+			<< TestLog::EndSection;
 	}
 
 	m_context.getTestContext().getLog()
 		<< TestLog::Message
-		<< "Passed " << m_numSamples - failCount << " out of " << m_numSamples << "."
+		<< "Passed " << m_numSamples - (deUint32)failedSamples.size() << " out of " << m_numSamples << "."
 		<< TestLog::EndMessage;
 
-	return failCount == 0;
+	return failedSamples.empty();
 }
 
 void TextureFilteringTestInstance::execute (void)
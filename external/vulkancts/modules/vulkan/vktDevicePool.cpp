@@ -0,0 +1,324 @@
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Pool of custom devices.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktDevicePool.hpp"
+
+#include "vkPlatform.hpp"
+#include "vkRef.hpp"
+#include "vkRefUtil.hpp"
+#include "vkAllocationCallbackUtil.hpp"
+#include "vkStrUtil.hpp"
+
+#include "tcuTestLog.hpp"
+
+#include "deMutex.hpp"
+
+#include <set>
+#include <string>
+
+namespace vkt
+{
+
+using std::string;
+using de::MovePtr;
+using de::SharedPtr;
+using tcu::TestLog;
+using namespace vk;
+
+namespace
+{
+
+//! Allocator that keeps track of live object-scope allocations.
+class ObjectAllocationTracker : public ChainedAllocator
+{
+public:
+							ObjectAllocationTracker		(void) : ChainedAllocator(getSystemAllocator()) {}
+
+	void*					allocate					(size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+	void*					reallocate					(void* original, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+	void					free						(void* mem);
+
+	size_t					getNumLiveObjectAllocations	(void) const;
+
+private:
+	mutable de::Mutex		m_lock;
+	std::set<void*>			m_liveObjectAllocations;
+};
+
+void* ObjectAllocationTracker::allocate (size_t size, size_t alignment, VkSystemAllocationScope allocationScope)
+{
+	void* const	ptr	= ChainedAllocator::allocate(size, alignment, allocationScope);
+
+	if (ptr && allocationScope == VK_SYSTEM_ALLOCATION_SCOPE_OBJECT)
+	{
+		const de::ScopedLock lock (m_lock);
+		m_liveObjectAllocations.insert(ptr);
+	}
+
+	return ptr;
+}
+
+void* ObjectAllocationTracker::reallocate (void* original, size_t size, size_t alignment, VkSystemAllocationScope allocationScope)
+{
+	void* const	ptr	= ChainedAllocator::reallocate(original, size, alignment, allocationScope);
+
+	// Failed reallocation leaves original allocation untouched.
+	if (ptr || size == 0)
+	{
+		const de::ScopedLock lock (m_lock);
+
+		if (original)
+			m_liveObjectAllocations.erase(original);
+
+		if (ptr && allocationScope == VK_SYSTEM_ALLOCATION_SCOPE_OBJECT)
+			m_liveObjectAllocations.insert(ptr);
+	}
+
+	return ptr;
+}
+
+void ObjectAllocationTracker::free (void* mem)
+{
+	if (mem)
+	{
+		const de::ScopedLock lock (m_lock);
+		m_liveObjectAllocations.erase(mem);
+	}
+
+	ChainedAllocator::free(mem);
+}
+
+size_t ObjectAllocationTracker::getNumLiveObjectAllocations (void) const
+{
+	const de::ScopedLock lock (m_lock);
+	return m_liveObjectAllocations.size();
+}
+
+template<typename T>
+void appendBytes (string& key, const T& value)
+{
+	key.append((const char*)&value, sizeof(T));
+}
+
+void appendStrings (string& key, deUint32 count, const char* const* strings)
+{
+	appendBytes(key, count);
+
+	for (deUint32 ndx = 0; ndx < count; ++ndx)
+	{
+		key.append(strings[ndx]);
+		key.push_back('\0');
+	}
+}
+
+bool isPoolable (const VkDeviceCreateInfo& createInfo)
+{
+	if (createInfo.pNext)
+		return false;
+
+	for (deUint32 queueNdx = 0; queueNdx < createInfo.queueCreateInfoCount; ++queueNdx)
+	{
+		if (createInfo.pQueueCreateInfos[queueNdx].pNext)
+			return false;
+	}
+
+	return true;
+}
+
+//! Get key identifying devices created with identical parameters, or empty string if device can't be pooled
+string getDeviceKey (VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo& createInfo)
+{
+	string	key;
+
+	if (!isPoolable(createInfo))
+		return key;
+
+	appendBytes(key, physicalDevice);
+	appendBytes(key, createInfo.flags);
+	appendBytes(key, createInfo.queueCreateInfoCount);
+
+	for (deUint32 queueNdx = 0; queueNdx < createInfo.queueCreateInfoCount; ++queueNdx)
+	{
+		const VkDeviceQueueCreateInfo&	queueInfo	= createInfo.pQueueCreateInfos[queueNdx];
+
+		appendBytes(key, queueInfo.flags);
+		appendBytes(key, queueInfo.queueFamilyIndex);
+		appendBytes(key, queueInfo.queueCount);
+
+		for (deUint32 priorityNdx = 0; priorityNdx < queueInfo.queueCount; ++priorityNdx)
+			appendBytes(key, queueInfo.pQueuePriorities[priorityNdx]);
+	}
+
+	appendStrings(key, createInfo.enabledLayerCount, createInfo.ppEnabledLayerNames);
+	appendStrings(key, createInfo.enabledExtensionCount, createInfo.ppEnabledExtensionNames);
+
+	appendBytes(key, (deUint8)(createInfo.pEnabledFeatures ? 1u : 0u));
+
+	if (createInfo.pEnabledFeatures)
+		appendBytes(key, *createInfo.pEnabledFeatures);
+
+	return key;
+}
+
+} // anonymous
+
+// PooledDevice
+
+class PooledDevice
+{
+public:
+									PooledDevice					(const InstanceInterface& vki, VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo& createInfo);
+
+	const string&					getKey							(void) const { return m_key;				}
+	bool							isPoolable						(void) const { return !m_key.empty();		}
+
+	VkDevice						getDevice						(void) const { return *m_device;			}
+	const DeviceInterface&			getDeviceInterface				(void) const { return m_deviceInterface;	}
+
+	size_t							getNumLeakedObjectAllocations	(void) const;
+
+private:
+	const string					m_key;
+	ObjectAllocationTracker			m_allocator;
+	const Unique<VkDevice>			m_device;
+	const DeviceDriver				m_deviceInterface;
+	const size_t					m_numBaseObjectAllocations;		//!< Object allocations made when creating device
+};
+
+PooledDevice::PooledDevice (const InstanceInterface& vki, VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo& createInfo)
+	: m_key							(getDeviceKey(physicalDevice, createInfo))
+	, m_device						(createDevice(vki, physicalDevice, &createInfo, m_allocator.getCallbacks()))
+	, m_deviceInterface				(vki, *m_device)
+	, m_numBaseObjectAllocations	(m_allocator.getNumLiveObjectAllocations())
+{
+}
+
+size_t PooledDevice::getNumLeakedObjectAllocations (void) const
+{
+	const size_t	numLive	= m_allocator.getNumLiveObjectAllocations();
+
+	return numLive > m_numBaseObjectAllocations ? numLive - m_numBaseObjectAllocations : 0;
+}
+
+// DeviceLease
+
+DeviceLease::DeviceLease (DevicePool& pool, const SharedPtr<PooledDevice>& device)
+	: m_pool	(pool)
+	, m_device	(device)
+{
+}
+
+DeviceLease::~DeviceLease (void)
+{
+	try
+	{
+		m_pool.release(m_device);
+	}
+	catch (...)
+	{
+		// Device is destroyed instead of returned to pool.
+	}
+}
+
+VkDevice DeviceLease::getDevice (void) const
+{
+	return m_device->getDevice();
+}
+
+const DeviceInterface& DeviceLease::getDeviceInterface (void) const
+{
+	return m_device->getDeviceInterface();
+}
+
+// DevicePool
+
+DevicePool::DevicePool (const InstanceInterface& vki, TestLog& log, int maxIdleDevices)
+	: m_vki				(vki)
+	, m_log				(log)
+	, m_maxIdleDevices	(maxIdleDevices)
+{
+}
+
+DevicePool::~DevicePool (void)
+{
+}
+
+MovePtr<DeviceLease> DevicePool::lease (VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo& createInfo)
+{
+	const string	key		= getDeviceKey(physicalDevice, createInfo);
+
+	if (!key.empty())
+	{
+		for (DeviceList::iterator iter = m_idleDevices.begin(); iter != m_idleDevices.end(); ++iter)
+		{
+			if ((*iter)->getKey() == key)
+			{
+				const SharedPtr<PooledDevice>	device	= *iter;
+
+				m_idleDevices.erase(iter);
+
+				return MovePtr<DeviceLease>(new DeviceLease(*this, device));
+			}
+		}
+	}
+
+	return MovePtr<DeviceLease>(new DeviceLease(*this, SharedPtr<PooledDevice>(new PooledDevice(m_vki, physicalDevice, createInfo))));
+}
+
+void DevicePool::clear (void)
+{
+	m_idleDevices.clear();
+}
+
+void DevicePool::release (const SharedPtr<PooledDevice>& device)
+{
+	if (!device->isPoolable() || m_maxIdleDevices <= 0)
+		return;
+
+	{
+		const VkResult	result	= device->getDeviceInterface().deviceWaitIdle(device->getDevice());
+
+		if (result != VK_SUCCESS)
+		{
+			m_log << TestLog::Message << "vkDeviceWaitIdle() returned " << getResultName(result) << " when returning device to pool, device is not reused" << TestLog::EndMessage;
+			return;
+		}
+	}
+
+	{
+		const size_t	numLeaked	= device->getNumLeakedObjectAllocations();
+
+		if (numLeaked > 0)
+		{
+			m_log << TestLog::Message << "WARNING: " << numLeaked << " object allocation(s) live when returning device to pool, objects were leaked. Device is not reused." << TestLog::EndMessage;
+			return;
+		}
+	}
+
+	m_idleDevices.push_front(device);
+
+	while ((int)m_idleDevices.size() > m_maxIdleDevices)
+		m_idleDevices.pop_back();
+}
+
+} // vkt
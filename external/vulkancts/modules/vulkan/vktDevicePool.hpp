@@ -0,0 +1,125 @@
+#ifndef _VKTDEVICEPOOL_HPP
+#define _VKTDEVICEPOOL_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Pool of custom devices.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "vkDefs.hpp"
+#include "deSharedPtr.hpp"
+#include "deUniquePtr.hpp"
+
+#include <list>
+
+namespace tcu
+{
+class TestLog;
+}
+
+namespace vk
+{
+class InstanceInterface;
+class DeviceInterface;
+}
+
+namespace vkt
+{
+
+class DevicePool;
+class PooledDevice;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Device leased from DevicePool
+ *
+ * Device is returned to the pool when lease is destroyed. All objects
+ * created from the device must be destroyed before that.
+ *//*--------------------------------------------------------------------*/
+class DeviceLease
+{
+public:
+									~DeviceLease		(void);
+
+	vk::VkDevice					getDevice			(void) const;
+	const vk::DeviceInterface&		getDeviceInterface	(void) const;
+
+private:
+	friend class DevicePool;
+
+									DeviceLease			(DevicePool& pool, const de::SharedPtr<PooledDevice>& device);
+									DeviceLease			(const DeviceLease&); // Not allowed
+	DeviceLease&					operator=			(const DeviceLease&); // Not allowed
+
+	DevicePool&						m_pool;
+	const de::SharedPtr<PooledDevice>	m_device;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Pool of devices created with non-default parameters
+ *
+ * Cases that need extra features, queues or extensions can lease a device
+ * instead of creating one. Devices are keyed by physical device and all
+ * parameters in VkDeviceCreateInfo, and a returned device is given to the
+ * next lease with identical parameters. At most maxIdleDevices unleased
+ * devices are kept, least recently used ones are destroyed first.
+ *
+ * Pooled devices are created with allocation callbacks that track live
+ * object-scope host allocations. When a lease is returned the device is
+ * waited idle and if any object allocations are still live, objects were
+ * leaked and the device is destroyed instead of reused. Leaks are only
+ * detected if implementation uses device allocator for objects created
+ * without allocation callbacks.
+ *
+ * Create infos with pNext chains are not pooled; each lease gets a new
+ * device.
+ *//*--------------------------------------------------------------------*/
+class DevicePool
+{
+public:
+									DevicePool			(const vk::InstanceInterface& vki, tcu::TestLog& log, int maxIdleDevices);
+									~DevicePool			(void);
+
+	//! Lease device created with createInfo, creating a new device if no matching idle device exists.
+	de::MovePtr<DeviceLease>		lease				(vk::VkPhysicalDevice physicalDevice, const vk::VkDeviceCreateInfo& createInfo);
+
+	//! Destroy all idle devices.
+	void							clear				(void);
+
+private:
+	friend class DeviceLease;
+
+									DevicePool			(const DevicePool&); // Not allowed
+	DevicePool&						operator=			(const DevicePool&); // Not allowed
+
+	void							release				(const de::SharedPtr<PooledDevice>& device);
+
+	typedef std::list<de::SharedPtr<PooledDevice> >	DeviceList;
+
+	const vk::InstanceInterface&	m_vki;
+	tcu::TestLog&					m_log;
+	const int						m_maxIdleDevices;
+
+	DeviceList						m_idleDevices;		//!< Most recently used first.
+};
+
+} // vkt
+
+#endif // _VKTDEVICEPOOL_HPP
@@ -31,6 +31,7 @@
 #include "rrPrimitiveTypes.hpp"
 #include "tcuTextureUtil.hpp"
 #include "deArrayUtil.hpp"
+#include "tcuProfiler.hpp"
 
 namespace vkt
 {
@@ -253,6 +254,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const VkQueue			queue,
 							const VkCommandBuffer	commandBuffer)
 {
+	const tcu::ProfileScope profile ("submitAndWait");
+
 	const VkFenceCreateInfo fenceInfo =
 	{
 		VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
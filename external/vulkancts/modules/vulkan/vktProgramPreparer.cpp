@@ -0,0 +1,632 @@
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Background preparation of test case programs.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktProgramPreparer.hpp"
+#include "vktTestCase.hpp"
+
+#include "tcuTestLog.hpp"
+#include "tcuProfiler.hpp"
+
+#include "deThread.hpp"
+#include "deUniquePtr.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <sstream>
+#include <new>
+
+namespace vkt
+{
+
+using std::string;
+using std::vector;
+using de::MovePtr;
+using de::SharedPtr;
+using tcu::TestLog;
+
+namespace
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Exception captured in a worker thread
+ *
+ * Keeps a copy of the original exception so that rethrowing it in the
+ * test thread reports the same result as if the program was built there.
+ *//*--------------------------------------------------------------------*/
+class StoredError
+{
+public:
+	enum Type
+	{
+		TYPE_NOT_SUPPORTED = 0,		//!< tcu::NotSupportedError
+		TYPE_TCU_EXCEPTION,			//!< Other tcu::Exception
+		TYPE_OTHER,
+
+		TYPE_LAST
+	};
+
+								StoredError		(Type type) : m_type(type) {}
+	virtual						~StoredError	(void) {}
+
+	Type						getType			(void) const { return m_type; }
+
+	virtual const std::exception&	get			(void) const = 0;
+	virtual void				rethrow			(void) const = 0;
+
+private:
+	const Type					m_type;
+};
+
+template<typename ExceptionType>
+class StoredErrorImpl : public StoredError
+{
+public:
+								StoredErrorImpl	(Type type, const ExceptionType& error) : StoredError(type), m_error(error) {}
+
+	const std::exception&		get				(void) const { return m_error;	}
+	void						rethrow			(void) const { throw m_error;	}
+
+private:
+	const ExceptionType			m_error;
+};
+
+template<typename ExceptionType>
+SharedPtr<const StoredError> makeStoredError (StoredError::Type type, const ExceptionType& error)
+{
+	return SharedPtr<const StoredError>(new StoredErrorImpl<ExceptionType>(type, error));
+}
+
+//! Capture currently handled exception. Must be called from a catch block.
+SharedPtr<const StoredError> storeCurrentError (void)
+{
+	try
+	{
+		throw;
+	}
+	catch (const tcu::NotSupportedError& e)	{ return makeStoredError(StoredError::TYPE_NOT_SUPPORTED, e);	}
+	catch (const tcu::InternalError& e)		{ return makeStoredError(StoredError::TYPE_TCU_EXCEPTION, e);	}
+	catch (const tcu::ResourceError& e)		{ return makeStoredError(StoredError::TYPE_TCU_EXCEPTION, e);	}
+	catch (const tcu::TestError& e)			{ return makeStoredError(StoredError::TYPE_TCU_EXCEPTION, e);	}
+	catch (const tcu::TestException& e)		{ return makeStoredError(StoredError::TYPE_TCU_EXCEPTION, e);	}
+	catch (const tcu::Exception& e)			{ return makeStoredError(StoredError::TYPE_TCU_EXCEPTION, e);	}
+	catch (const std::bad_alloc& e)			{ return makeStoredError(StoredError::TYPE_OTHER, e);			}
+	catch (const std::exception& e)			{ return makeStoredError(StoredError::TYPE_OTHER, tcu::InternalError(e.what()));			}
+	catch (...)								{ return makeStoredError(StoredError::TYPE_OTHER, tcu::InternalError("Unknown exception"));	}
+}
+
+} // anonymous
+
+struct PreparedProgram
+{
+	string							name;
+	const glu::ProgramSources*		glslSource;			//!< Null for SPIR-V assembly programs.
+	const vk::SpirVAsmSource*		asmSource;
+
+	glu::ShaderProgramInfo			glslBuildInfo;
+	vk::SpirVProgramInfo			asmBuildInfo;
+	MovePtr<vk::ProgramBinary>		binary;
+	SharedPtr<const StoredError>	buildError;
+
+	bool							isDisassembled;
+	string							disassembly;		//!< Disassembly of GLSL program built from source.
+	SharedPtr<const StoredError>	disassemblyError;
+
+	PreparedProgram (const string& name_, const glu::ProgramSources* glslSource_, const vk::SpirVAsmSource* asmSource_)
+		: name				(name_)
+		, glslSource		(glslSource_)
+		, asmSource			(asmSource_)
+		, isDisassembled	(false)
+	{
+	}
+
+	size_t getMemoryUsage (void) const
+	{
+		return (binary ? binary->getSize() : 0) + disassembly.size();
+	}
+};
+
+class PreparedPrograms
+{
+public:
+	PreparedPrograms (const TestCase* testCase_, const string& casePath_)
+		: testCase		(testCase_)
+		, casePath		(casePath_)
+		, isCancelled	(false)
+		, numRemaining	(0)
+		, preparedBytes	(0)
+		, done			(0)
+	{
+	}
+
+	const TestCase* const					testCase;
+	const string							casePath;
+
+	vk::SourceCollections					sources;
+	vector<SharedPtr<PreparedProgram> >		programs;			//!< GLSL programs followed by SPIR-V assembly programs.
+	SharedPtr<const StoredError>			initError;
+
+	// Guarded by preparer lock
+	bool									isCancelled;
+	int										numRemaining;
+	size_t									preparedBytes;
+
+	de::Semaphore							done;				//!< Signaled once all programs are built.
+};
+
+namespace
+{
+
+void initPrograms (PreparedPrograms& entry)
+{
+	try
+	{
+		const tcu::ProfileScope profile ("initPrograms");
+		entry.testCase->initPrograms(entry.sources);
+	}
+	catch (...)
+	{
+		entry.initError = storeCurrentError();
+		return;
+	}
+
+	for (vk::GlslSourceCollection::Iterator progIter = entry.sources.glslSources.begin(); progIter != entry.sources.glslSources.end(); ++progIter)
+		entry.programs.push_back(SharedPtr<PreparedProgram>(new PreparedProgram(progIter.getName(), &progIter.getProgram(), DE_NULL)));
+
+	for (vk::SpirVAsmCollection::Iterator asmIterator = entry.sources.spirvAsmSources.begin(); asmIterator != entry.sources.spirvAsmSources.end(); ++asmIterator)
+		entry.programs.push_back(SharedPtr<PreparedProgram>(new PreparedProgram(asmIterator.getName(), DE_NULL, &asmIterator.getProgram())));
+}
+
+void disassembleProgram (const vk::ProgramBinary& binary, string& dst)
+{
+	const tcu::ProfileScope	profile	("disassembleProgram");
+	std::ostringstream		disasm;
+
+	vk::disassembleProgram(binary, &disasm);
+
+	dst = disasm.str();
+}
+
+void buildProgram (PreparedProgram& program, bool disassemble)
+{
+	try
+	{
+		const tcu::ProfileScope profile ("buildProgram");
+
+		if (program.glslSource)
+			program.binary = MovePtr<vk::ProgramBinary>(vk::buildProgram(*program.glslSource, vk::PROGRAM_FORMAT_SPIRV, &program.glslBuildInfo));
+		else
+			program.binary = MovePtr<vk::ProgramBinary>(vk::assembleProgram(*program.asmSource, &program.asmBuildInfo));
+	}
+	catch (...)
+	{
+		program.buildError = storeCurrentError();
+		return;
+	}
+
+	if (disassemble && program.glslSource && program.binary)
+	{
+		try
+		{
+			disassembleProgram(*program.binary, program.disassembly);
+		}
+		catch (...)
+		{
+			program.disassemblyError = storeCurrentError();
+		}
+
+		program.isDisassembled = true;
+	}
+}
+
+} // anonymous
+
+// ProgramPreparer
+
+class ProgramPreparer::Worker : public de::Thread
+{
+public:
+	Worker (ProgramPreparer& preparer)
+		: m_preparer(preparer)
+	{
+	}
+
+	void run (void)
+	{
+		Job job;
+
+		while (m_preparer.popJob(job))
+		{
+			m_preparer.executeJob(job);
+			job = Job();
+		}
+	}
+
+private:
+	ProgramPreparer&	m_preparer;
+};
+
+ProgramPreparer::ProgramPreparer (int numThreads, size_t memoryBudget, bool deferDisassembly)
+	: m_memoryBudget		(memoryBudget)
+	, m_deferDisassembly	(deferDisassembly)
+	, m_jobCount			(0)
+	, m_stop				(false)
+{
+	DE_ASSERT(numThreads >= 0);
+
+	try
+	{
+		for (int threadNdx = 0; threadNdx < numThreads; threadNdx++)
+		{
+			m_workers.push_back(SharedPtr<Worker>(new Worker(*this)));
+			m_workers.back()->start();
+		}
+	}
+	catch (...)
+	{
+		m_stop = true;
+
+		for (size_t threadNdx = 0; threadNdx < m_workers.size(); threadNdx++)
+			m_jobCount.increment();
+
+		for (size_t threadNdx = 0; threadNdx < m_workers.size(); threadNdx++)
+		{
+			if (m_workers[threadNdx]->isStarted())
+				m_workers[threadNdx]->join();
+		}
+
+		throw;
+	}
+}
+
+ProgramPreparer::~ProgramPreparer (void)
+{
+	{
+		const de::ScopedLock lock (m_lock);
+
+		m_stop = true;
+
+		for (EntryMap::iterator entryIter = m_entries.begin(); entryIter != m_entries.end(); ++entryIter)
+			entryIter->second->isCancelled = true;
+
+		m_jobs.clear();
+	}
+
+	// Running jobs finish before workers exit
+	for (size_t threadNdx = 0; threadNdx < m_workers.size(); threadNdx++)
+		m_jobCount.increment();
+
+	for (size_t threadNdx = 0; threadNdx < m_workers.size(); threadNdx++)
+		m_workers[threadNdx]->join();
+}
+
+SharedPtr<PreparedPrograms> ProgramPreparer::createEntry (const TestCase* testCase, const string& casePath)
+{
+	return SharedPtr<PreparedPrograms>(new PreparedPrograms(testCase, casePath));
+}
+
+size_t ProgramPreparer::getPreparedBytes (void) const
+{
+	size_t numBytes = 0;
+
+	for (EntryMap::const_iterator entryIter = m_entries.begin(); entryIter != m_entries.end(); ++entryIter)
+		numBytes += entryIter->second->preparedBytes;
+
+	return numBytes;
+}
+
+void ProgramPreparer::prepare (const TestCase* testCase, const string& casePath)
+{
+	if (m_workers.empty())
+		return;
+
+	{
+		const de::ScopedLock lock (m_lock);
+
+		if (m_entries.find(casePath) != m_entries.end() || getPreparedBytes() >= m_memoryBudget)
+			return;
+
+		// On failure nothing is queued and take() prepares the case when it is entered,
+		// so that errors are reported for the case they belong to.
+		try
+		{
+			const SharedPtr<PreparedPrograms> entry = createEntry(testCase, casePath);
+
+			m_entries[casePath] = entry;
+			m_entryOrder.push_back(casePath);
+			m_jobs.push_back(Job(entry, -1));
+		}
+		catch (...)
+		{
+			if (!m_entryOrder.empty() && m_entryOrder.back() == casePath)
+				m_entryOrder.pop_back();
+
+			m_entries.erase(casePath);
+			throw;
+		}
+	}
+
+	m_jobCount.increment();
+}
+
+SharedPtr<PreparedPrograms> ProgramPreparer::take (const TestCase* testCase, const string& casePath)
+{
+	SharedPtr<PreparedPrograms> entry;
+
+	if (m_workers.empty())
+	{
+		entry = createEntry(testCase, casePath);
+
+		initPrograms(*entry);
+
+		for (size_t programNdx = 0; programNdx < entry->programs.size(); programNdx++)
+		{
+			const PreparedProgram& program = *entry->programs[programNdx];
+
+			buildProgram(*entry->programs[programNdx], !m_deferDisassembly);
+
+			// Later programs would not be logged anyway
+			if (program.buildError && program.buildError->getType() != StoredError::TYPE_NOT_SUPPORTED)
+				break;
+		}
+
+		return entry;
+	}
+
+	{
+		const de::ScopedLock				lock		(m_lock);
+		const vector<string>::iterator		orderPos	= std::find(m_entryOrder.begin(), m_entryOrder.end(), casePath);
+
+		if (orderPos != m_entryOrder.end())
+		{
+			// Cases prepared before this one were skipped
+			for (vector<string>::iterator skippedPath = m_entryOrder.begin(); skippedPath != orderPos; ++skippedPath)
+			{
+				m_entries[*skippedPath]->isCancelled = true;
+				m_entries.erase(*skippedPath);
+			}
+
+			entry = m_entries[casePath];
+
+			m_entries.erase(casePath);
+			m_entryOrder.erase(m_entryOrder.begin(), orderPos + 1);
+
+			DE_ASSERT(entry->testCase == testCase);
+
+			// Move remaining jobs of this case ahead of look-ahead work
+			{
+				std::deque<Job> reordered;
+
+				for (std::deque<Job>::const_iterator jobIter = m_jobs.begin(); jobIter != m_jobs.end(); ++jobIter)
+				{
+					if (jobIter->entry == entry)
+						reordered.push_back(*jobIter);
+				}
+
+				for (std::deque<Job>::const_iterator jobIter = m_jobs.begin(); jobIter != m_jobs.end(); ++jobIter)
+				{
+					if (jobIter->entry != entry)
+						reordered.push_back(*jobIter);
+				}
+
+				m_jobs.swap(reordered);
+			}
+		}
+		else
+		{
+			entry = createEntry(testCase, casePath);
+			m_jobs.push_front(Job(entry, -1));
+			m_jobCount.increment();
+		}
+	}
+
+	entry->done.decrement();
+
+	return entry;
+}
+
+bool ProgramPreparer::popJob (Job& job)
+{
+	for (;;)
+	{
+		m_jobCount.decrement();
+
+		{
+			const de::ScopedLock lock (m_lock);
+
+			if (m_stop)
+				return false;
+
+			if (m_jobs.empty())
+				continue;
+
+			job = m_jobs.front();
+			m_jobs.pop_front();
+
+			if (!job.entry->isCancelled)
+				return true;
+		}
+	}
+}
+
+void ProgramPreparer::executeJob (const Job& job)
+{
+	PreparedPrograms&	entry		= *job.entry;
+	bool				isComplete	= false;
+
+	if (job.programNdx < 0)
+	{
+		initPrograms(entry);
+
+		if (entry.programs.empty())
+			isComplete = true;
+		else
+		{
+			{
+				const de::ScopedLock lock (m_lock);
+
+				entry.numRemaining = (int)entry.programs.size();
+
+				// Programs of a started case go ahead of other cases so that cases complete in order
+				for (int programNdx = (int)entry.programs.size() - 1; programNdx >= 0; programNdx--)
+					m_jobs.push_front(Job(job.entry, programNdx));
+			}
+
+			for (size_t programNdx = 0; programNdx < entry.programs.size(); programNdx++)
+				m_jobCount.increment();
+		}
+	}
+	else
+	{
+		PreparedProgram& program = *entry.programs[job.programNdx];
+
+		buildProgram(program, !m_deferDisassembly);
+
+		{
+			const de::ScopedLock lock (m_lock);
+
+			entry.preparedBytes	+= program.getMemoryUsage();
+			entry.numRemaining	-= 1;
+
+			isComplete = (entry.numRemaining == 0);
+		}
+	}
+
+	if (isComplete)
+		entry.done.increment();
+}
+
+// Log output
+
+namespace
+{
+
+void logBuildInfo (TestLog& log, const PreparedProgram& program)
+{
+	if (program.glslSource)
+		log << program.glslBuildInfo;
+	else
+		log << program.asmBuildInfo;
+}
+
+void logSource (TestLog& log, const PreparedProgram& program)
+{
+	if (program.glslSource)
+		log << *program.glslSource;
+	else
+		log << *program.asmSource;
+}
+
+class DisassemblyLogContent : public tcu::DeferredLogContent
+{
+public:
+	DisassemblyLogContent (const vk::ProgramBinary& binary)
+		: m_binary(binary.getFormat(), binary.getSize(), binary.getBinary())
+	{
+	}
+
+	void write (TestLog& log) const
+	{
+		try
+		{
+			string disassembly;
+
+			disassembleProgram(m_binary, disassembly);
+
+			log << vk::SpirVAsmSource(disassembly);
+		}
+		catch (const tcu::NotSupportedError& err)
+		{
+			log << err;
+		}
+	}
+
+private:
+	const vk::ProgramBinary		m_binary;
+};
+
+} // anonymous
+
+void buildPrograms (PreparedPrograms&				programs,
+					const string&					casePath,
+					const vk::BinaryRegistryReader&	prebuiltBinRegistry,
+					TestLog&						log,
+					vk::BinaryCollection&			progCollection)
+{
+	if (programs.initError)
+		programs.initError->rethrow();
+
+	for (size_t programNdx = 0; programNdx < programs.programs.size(); programNdx++)
+	{
+		PreparedProgram&	program		= *programs.programs[programNdx];
+		vk::ProgramBinary*	binary		= DE_NULL;
+
+		{
+			const vk::ProgramIdentifier		progId		(casePath, program.name);
+			const tcu::ScopedLogSection		progSection	(log, program.name, "Program: " + program.name);
+			MovePtr<vk::ProgramBinary>		binProg;
+
+			if (!program.buildError)
+			{
+				binProg = program.binary;
+				logBuildInfo(log, program);
+			}
+			else if (program.buildError->getType() == StoredError::TYPE_NOT_SUPPORTED)
+			{
+				// Try to load from cache
+				log << program.buildError->get() << TestLog::Message << "Building from source not supported, loading stored binary instead" << TestLog::EndMessage;
+
+				binProg = MovePtr<vk::ProgramBinary>(prebuiltBinRegistry.loadProgram(progId));
+
+				logSource(log, program);
+			}
+			else
+			{
+				// Build failed for other reason
+				if (program.buildError->getType() == StoredError::TYPE_TCU_EXCEPTION)
+					logBuildInfo(log, program);
+
+				program.buildError->rethrow();
+			}
+
+			TCU_CHECK_INTERNAL(binProg);
+
+			binary = binProg.get();
+			progCollection.add(program.name, binProg);
+		}
+
+		if (program.glslSource)
+		{
+			// Prebuilt binaries and deferred disassembly are disassembled when logged
+			if (!program.isDisassembled)
+				log.writeDeferred(MovePtr<tcu::DeferredLogContent>(new DisassemblyLogContent(*binary)));
+			else if (!program.disassemblyError)
+				log << vk::SpirVAsmSource(program.disassembly);
+			else if (program.disassemblyError->getType() == StoredError::TYPE_NOT_SUPPORTED)
+				log << program.disassemblyError->get();
+			else
+				program.disassemblyError->rethrow();
+		}
+	}
+}
+
+} // vkt
@@ -0,0 +1,133 @@
+#ifndef _VKTPROGRAMPREPARER_HPP
+#define _VKTPROGRAMPREPARER_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Background preparation of test case programs.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "vkPrograms.hpp"
+#include "vkBinaryRegistry.hpp"
+#include "deSharedPtr.hpp"
+#include "deMutex.hpp"
+#include "deSemaphore.hpp"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+class TestLog;
+} // tcu
+
+namespace vkt
+{
+
+class TestCase;
+class PreparedPrograms;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Prepares test case programs in worker threads
+ *
+ * Preparing a case calls TestCase::initPrograms(), then builds GLSL and
+ * assembles SPIR-V assembly programs in parallel and disassembles the
+ * built GLSL programs. Test case executor can ask for upcoming cases to
+ * be prepared while the current case is executing, and take the results
+ * when initializing the case.
+ *
+ * Build results are kept in memory until taken, and nothing is written
+ * to the log before that. Log output is produced by buildPrograms() in
+ * the test thread, in the same order as when programs are built serially.
+ *
+ * With zero worker threads programs are prepared in take().
+ *
+ * If disassembly is deferred, buildPrograms() passes disassembly to the
+ * log as deferred content, and it is done only if the log is written.
+ *//*--------------------------------------------------------------------*/
+class ProgramPreparer
+{
+public:
+										ProgramPreparer		(int numThreads, size_t memoryBudget, bool deferDisassembly);
+										~ProgramPreparer	(void);
+
+	//! Start preparing programs for an upcoming case. Ignored if already prepared or if memory budget is exceeded.
+	void								prepare				(const TestCase* testCase, const std::string& casePath);
+
+	//! Get programs for case, waiting for preparation to finish. Results for earlier cases that were never taken are dropped.
+	de::SharedPtr<PreparedPrograms>		take				(const TestCase* testCase, const std::string& casePath);
+
+	int									getNumThreads		(void) const { return (int)m_workers.size(); }
+
+private:
+										ProgramPreparer		(const ProgramPreparer&);
+	ProgramPreparer&					operator=			(const ProgramPreparer&);
+
+	struct Job
+	{
+		de::SharedPtr<PreparedPrograms>	entry;
+		int								programNdx;	//!< Program to build, or -1 for initPrograms().
+
+		Job (void)
+			: programNdx	(-1)
+		{
+		}
+
+		Job (const de::SharedPtr<PreparedPrograms>& entry_, int programNdx_)
+			: entry			(entry_)
+			, programNdx	(programNdx_)
+		{
+		}
+	};
+
+	class Worker;
+
+	de::SharedPtr<PreparedPrograms>		createEntry			(const TestCase* testCase, const std::string& casePath);
+	bool								popJob				(Job& job);
+	void								executeJob			(const Job& job);
+	size_t								getPreparedBytes	(void) const;
+
+	typedef std::map<std::string, de::SharedPtr<PreparedPrograms> >	EntryMap;
+
+	const size_t						m_memoryBudget;
+	const bool							m_deferDisassembly;
+
+	de::Mutex							m_lock;
+	de::Semaphore						m_jobCount;
+	std::deque<Job>						m_jobs;
+	bool								m_stop;
+
+	EntryMap							m_entries;
+	std::vector<std::string>			m_entryOrder;		//!< Paths of untaken entries in preparation order.
+	std::vector<de::SharedPtr<Worker> >	m_workers;
+};
+
+//! Write build logs for prepared programs and add the binaries to the collection. Throws if preparation or build failed.
+void buildPrograms (PreparedPrograms&				programs,
+					const std::string&				casePath,
+					const vk::BinaryRegistryReader&	prebuiltBinRegistry,
+					tcu::TestLog&					log,
+					vk::BinaryCollection&			progCollection);
+
+} // vkt
+
+#endif // _VKTPROGRAMPREPARER_HPP
@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "vktTestCase.hpp"
+#include "vktDevicePool.hpp"
 
 #include "vkRef.hpp"
 #include "vkRefUtil.hpp"
@@ -273,6 +274,13 @@ vk::Allocator* createAllocator (DefaultDevice* device)
 	return new SimpleAllocator(device->getDeviceInterface(), device->getDevice(), memoryProperties);
 }
 
+// Device pool utilities
+
+enum
+{
+	MAX_IDLE_POOLED_DEVICES	= 4		//!< Number of unleased devices kept in pool
+};
+
 // Context
 
 Context::Context (tcu::TestContext&							testCtx,
@@ -283,6 +291,7 @@ Context::Context (tcu::TestContext&							testCtx,
 	, m_progCollection		(progCollection)
 	, m_device				(new DefaultDevice(m_platformInterface, testCtx.getCommandLine()))
 	, m_allocator			(createAllocator(m_device.get()))
+	, m_devicePool			(new DevicePool(m_device->getInstanceInterface(), testCtx.getLog(), MAX_IDLE_POOLED_DEVICES))
 {
 }
 
@@ -302,6 +311,7 @@ const vk::DeviceInterface&				Context::getDeviceInterface				(void) const { retu
 deUint32								Context::getUniversalQueueFamilyIndex	(void) const { return m_device->getUniversalQueueFamilyIndex();	}
 vk::VkQueue								Context::getUniversalQueue				(void) const { return m_device->getUniversalQueue();			}
 vk::Allocator&							Context::getDefaultAllocator			(void) const { return *m_allocator;								}
+DevicePool&								Context::getDevicePool					(void) const { return *m_devicePool;							}
 
 // TestCase
 
@@ -46,6 +46,7 @@ namespace vkt
 {
 
 class DefaultDevice;
+class DevicePool;
 
 class Context
 {
@@ -74,6 +75,9 @@ public:
 
 	vk::Allocator&								getDefaultAllocator				(void) const;
 
+	// Pool of devices with non-default features, queues or extensions
+	DevicePool&									getDevicePool					(void) const;
+
 protected:
 	tcu::TestContext&							m_testCtx;
 	const vk::PlatformInterface&				m_platformInterface;
@@ -81,6 +85,7 @@ protected:
 
 	const de::UniquePtr<DefaultDevice>			m_device;
 	const de::UniquePtr<vk::Allocator>			m_allocator;
+	const de::UniquePtr<DevicePool>				m_devicePool;
 
 private:
 												Context							(const Context&); // Not allowed
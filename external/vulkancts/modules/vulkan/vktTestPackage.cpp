@@ -22,20 +22,22 @@
  *//*--------------------------------------------------------------------*/
 
 #include "vktTestPackage.hpp"
+#include "vktProgramPreparer.hpp"
 
 #include "tcuPlatform.hpp"
 #include "tcuTestCase.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuProfiler.hpp"
 
 #include "vkPlatform.hpp"
 #include "vkPrograms.hpp"
 #include "vkBinaryRegistry.hpp"
-#include "vkGlslToSpirV.hpp"
 #include "vkDebugReportUtil.hpp"
 #include "vkQueryUtil.hpp"
 
 #include "deUniquePtr.hpp"
+#include "deThread.hpp"
 
 #include "vktTestGroupUtil.hpp"
 #include "vktApiTests.hpp"
@@ -79,66 +81,6 @@
 #include "vktRobustnessTests.hpp"
 
 #include <vector>
-#include <sstream>
-
-namespace // compilation
-{
-
-vk::ProgramBinary* compileProgram (const glu::ProgramSources& source, glu::ShaderProgramInfo* buildInfo)
-{
-	return vk::buildProgram(source, vk::PROGRAM_FORMAT_SPIRV, buildInfo);
-}
-
-vk::ProgramBinary* compileProgram (const vk::SpirVAsmSource& source, vk::SpirVProgramInfo* buildInfo)
-{
-	return vk::assembleProgram(source, buildInfo);
-}
-
-template <typename InfoType, typename IteratorType>
-vk::ProgramBinary* buildProgram (const std::string&					casePath,
-								 IteratorType						iter,
-								 const vk::BinaryRegistryReader&	prebuiltBinRegistry,
-								 tcu::TestLog&						log,
-								 vk::BinaryCollection*				progCollection)
-{
-	const vk::ProgramIdentifier		progId		(casePath, iter.getName());
-	const tcu::ScopedLogSection		progSection	(log, iter.getName(), "Program: " + iter.getName());
-	de::MovePtr<vk::ProgramBinary>	binProg;
-	InfoType						buildInfo;
-
-	try
-	{
-		binProg	= de::MovePtr<vk::ProgramBinary>(compileProgram(iter.getProgram(), &buildInfo));
-		log << buildInfo;
-	}
-	catch (const tcu::NotSupportedError& err)
-	{
-		// Try to load from cache
-		log << err << tcu::TestLog::Message << "Building from source not supported, loading stored binary instead" << tcu::TestLog::EndMessage;
-
-		binProg = de::MovePtr<vk::ProgramBinary>(prebuiltBinRegistry.loadProgram(progId));
-
-		log << iter.getProgram();
-	}
-	catch (const tcu::Exception&)
-	{
-		// Build failed for other reason
-		log << buildInfo;
-		throw;
-	}
-
-	TCU_CHECK_INTERNAL(binProg);
-
-	{
-		vk::ProgramBinary* const	returnBinary	= binProg.get();
-
-		progCollection->add(progId.programName, binProg);
-
-		return returnBinary;
-	}
-}
-
-} // anonymous(compilation)
 
 namespace vkt
 {
@@ -174,9 +116,12 @@ public:
 
 	virtual tcu::TestNode::IterateResult		iterate				(tcu::TestCase* testCase);
 
+	virtual void								prepare				(tcu::TestCase* testCase, const std::string& path);
+
 private:
 	vk::BinaryCollection						m_progCollection;
 	vk::BinaryRegistryReader					m_prebuiltBinRegistry;
+	const UniquePtr<ProgramPreparer>			m_preparer;
 
 	const UniquePtr<vk::Library>				m_library;
 	Context										m_context;
@@ -191,8 +136,22 @@ static MovePtr<vk::Library> createLibrary (tcu::TestContext& testCtx)
 	return MovePtr<vk::Library>(testCtx.getPlatform().getVulkanPlatform().createLibrary());
 }
 
+static MovePtr<ProgramPreparer> createProgramPreparer (tcu::TestContext& testCtx)
+{
+	// Prepared binaries of upcoming cases are kept in memory until the cases are executed
+	const size_t	memoryBudget		= 256u*1024u*1024u;
+	const int		numThreads			= testCtx.getCommandLine().getPrepareAheadCount() > 0
+										? de::max(1, (int)deGetNumAvailableLogicalCores() - 1)
+										: 0;
+	// Disassembly is not needed unless the case fails
+	const bool		deferDisassembly	= (testCtx.getCommandLine().getLogFlags() & QP_TEST_LOG_DETAILS_ON_FAILURE) != 0;
+
+	return MovePtr<ProgramPreparer>(new ProgramPreparer(numThreads, memoryBudget, deferDisassembly));
+}
+
 TestCaseExecutor::TestCaseExecutor (tcu::TestContext& testCtx)
 	: m_prebuiltBinRegistry	(testCtx.getArchive(), "vulkan/prebuilt")
+	, m_preparer			(createProgramPreparer(testCtx))
 	, m_library				(createLibrary(testCtx))
 	, m_context				(testCtx, m_library->getPlatformInterface(), m_progCollection)
 	, m_debugReportRecorder	(testCtx.getCommandLine().isValidationEnabled()
@@ -213,41 +172,20 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 {
 	const TestCase*			vktCase		= dynamic_cast<TestCase*>(testCase);
 	tcu::TestLog&			log			= m_context.getTestContext().getLog();
-	vk::SourceCollections	sourceProgs;
-
-	DE_UNREF(casePath); // \todo [2015-03-13 pyry] Use this to identify ProgramCollection storage path
 
 	if (!vktCase)
 		TCU_THROW(InternalError, "Test node not an instance of vkt::TestCase");
 
 	m_progCollection.clear();
-	vktCase->initPrograms(sourceProgs);
-
-	for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
-	{
-		vk::ProgramBinary* binProg = buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, log, &m_progCollection);
-
-		try
-		{
-			std::ostringstream disasm;
 
-			vk::disassembleProgram(*binProg, &disasm);
+	buildPrograms(*m_preparer->take(vktCase, casePath), casePath, m_prebuiltBinRegistry, log, m_progCollection);
 
-			log << vk::SpirVAsmSource(disasm.str());
-		}
-		catch (const tcu::NotSupportedError& err)
-		{
-			log << err;
-		}
-	}
+	DE_ASSERT(!m_instance);
 
-	for (vk::SpirVAsmCollection::Iterator asmIterator = sourceProgs.spirvAsmSources.begin(); asmIterator != sourceProgs.spirvAsmSources.end(); ++asmIterator)
 	{
-		buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_prebuiltBinRegistry, log, &m_progCollection);
+		const tcu::ProfileScope profile ("createInstance");
+		m_instance = vktCase->createInstance(m_context);
 	}
-
-	DE_ASSERT(!m_instance);
-	m_instance = vktCase->createInstance(m_context);
 }
 
 void TestCaseExecutor::deinit (tcu::TestCase*)
@@ -308,6 +246,14 @@ tcu::TestNode::IterateResult TestCaseExecutor::iterate (tcu::TestCase*)
 		return tcu::TestNode::CONTINUE;
 }
 
+void TestCaseExecutor::prepare (tcu::TestCase* testCase, const std::string& casePath)
+{
+	const TestCase* const	vktCase		= dynamic_cast<TestCase*>(testCase);
+
+	if (vktCase)
+		m_preparer->prepare(vktCase, casePath);
+}
+
 // GLSL shader tests
 
 void createGlslTests (tcu::TestCaseGroup* glslTests)
@@ -39,6 +39,11 @@ public:
 
 	virtual void				init				(void);
 	tcu::TestCaseExecutor*		createExecutor		(void) const;
+
+	// \note Group init only creates test case objects and reads shader library files from the archive.
+	//		 It does not create devices, log or modify shared state. Case lists exported with
+	//		 several threads have been checked to be identical to single-threaded export.
+	bool						isConcurrentGroupInitSupported	(void) const { return true; }
 };
 
 } // vkt
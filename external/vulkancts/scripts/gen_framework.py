@@ -783,6 +783,33 @@ def writeNullDriverImpl (api, filename):
 				"vkFreeCommandBuffers",
 				"vkCreateDisplayModeKHR",
 				"vkCreateSharedSwapchainsKHR",
+				"vkBindBufferMemory",
+				"vkBindImageMemory",
+				"vkGetImageSubresourceLayout",
+				"vkQueueSubmit",
+				"vkQueueBindSparse",
+				"vkResetFences",
+				"vkGetFenceStatus",
+				"vkWaitForFences",
+				"vkGetEventStatus",
+				"vkSetEvent",
+				"vkResetEvent",
+				"vkResetCommandPool",
+				"vkBeginCommandBuffer",
+				"vkEndCommandBuffer",
+				"vkResetCommandBuffer",
+				"vkCmdSetEvent",
+				"vkCmdResetEvent",
+				"vkCmdCopyBuffer",
+				"vkCmdUpdateBuffer",
+				"vkCmdFillBuffer",
+				"vkCmdCopyImage",
+				"vkCmdBlitImage",
+				"vkCmdCopyBufferToImage",
+				"vkCmdCopyImageToBuffer",
+				"vkCmdClearColorImage",
+				"vkCmdClearDepthStencilImage",
+				"vkCmdExecuteCommands",
 			]
 		specialFuncs		= [f for f in api.functions if f.name in specialFuncNames]
 		createFuncs			= [f for f in api.functions if (f.name[:8] == "vkCreate" or f.name == "vkAllocateMemory") and not f in specialFuncs]
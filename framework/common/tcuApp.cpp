@@ -120,6 +120,8 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 			writeXmlCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
 		else if (runMode == RUNMODE_DUMP_TEXT_CASELIST)
 			writeTxtCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
+		else if (runMode == RUNMODE_DUMP_BINARY_CASELIST)
+			writeBinaryCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
 		else
 			DE_ASSERT(false);
 	}
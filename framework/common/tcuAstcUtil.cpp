@@ -1261,18 +1261,28 @@ void interpolateWeights (TexelWeightPair* dst, const deUint32 (&unquantizedWeigh
 	const deUint32	scaleX				= (1024 + blockWidth/2) / (blockWidth-1);
 	const deUint32	scaleY				= (1024 + blockHeight/2) / (blockHeight-1);
 
+	deUint32		gridX[MAX_BLOCK_WIDTH];
+	deUint32		gridY[MAX_BLOCK_HEIGHT];
+
 	DE_ASSERT(blockMode.weightGridWidth*blockMode.weightGridHeight*numWeightsPerTexel <= DE_LENGTH_OF_ARRAY(unquantizedWeights));
+	DE_ASSERT(blockWidth <= MAX_BLOCK_WIDTH && blockHeight <= MAX_BLOCK_HEIGHT);
+
+	// Grid coordinates only depend on texel column or row.
+	for (int texelX = 0; texelX < blockWidth; texelX++)
+		gridX[texelX] = (scaleX*texelX*(blockMode.weightGridWidth-1) + 32) >> 6;
+
+	for (int texelY = 0; texelY < blockHeight; texelY++)
+		gridY[texelY] = (scaleY*texelY*(blockMode.weightGridHeight-1) + 32) >> 6;
 
 	for (int texelY = 0; texelY < blockHeight; texelY++)
 	{
+		const deUint32 jY	= gridY[texelY] >> 4;
+		const deUint32 fY	= gridY[texelY] & 0xf;
+
 		for (int texelX = 0; texelX < blockWidth; texelX++)
 		{
-			const deUint32 gX	= (scaleX*texelX*(blockMode.weightGridWidth-1) + 32) >> 6;
-			const deUint32 gY	= (scaleY*texelY*(blockMode.weightGridHeight-1) + 32) >> 6;
-			const deUint32 jX	= gX >> 4;
-			const deUint32 jY	= gY >> 4;
-			const deUint32 fX	= gX & 0xf;
-			const deUint32 fY	= gY & 0xf;
+			const deUint32 jX	= gridX[texelX] >> 4;
+			const deUint32 fX	= gridX[texelX] & 0xf;
 
 			const deUint32 w11	= (fX*fY + 8) >> 4;
 			const deUint32 w10	= fY - w11;
@@ -1399,18 +1409,45 @@ DecompressResult setTexelColors (void* dst, ColorEndpointPair* colorEndpoints, T
 	const bool			smallBlock	= blockWidth*blockHeight < 31;
 	DecompressResult	result		= DECOMPRESS_RESULT_VALID_BLOCK;
 	bool				isHDREndpoint[4];
+	bool				isHDRChannel[4][4];
+	deUint32			channelC0[4][4];
+	deUint32			channelC1[4][4];
+	int					weightNdx[4];
 
+	// Resolve per-partition and per-channel terms once instead of for each texel.
 	for (int i = 0; i < numPartitions; i++)
+	{
 		isHDREndpoint[i] = isColorEndpointModeHDR(colorEndpointModes[i]);
 
+		for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+		{
+			const deUint32 e0 = colorEndpoints[i].e0[channelNdx];
+			const deUint32 e1 = colorEndpoints[i].e1[channelNdx];
+
+			isHDRChannel[i][channelNdx] = isHDREndpoint[i] && !(channelNdx == 3 && colorEndpointModes[i] == 14); // \note Alpha for mode 14 is treated the same as LDR.
+
+			if (isHDRChannel[i][channelNdx])
+			{
+				channelC0[i][channelNdx] = e0 << 4;
+				channelC1[i][channelNdx] = e1 << 4;
+			}
+			else
+			{
+				channelC0[i][channelNdx] = (e0 << 8) | (isSRGB ? 0x80 : e0);
+				channelC1[i][channelNdx] = (e1 << 8) | (isSRGB ? 0x80 : e1);
+			}
+		}
+	}
+
+	for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+		weightNdx[channelNdx] = ccs == channelNdx ? 1 : 0;
+
 	for (int texelY = 0; texelY < blockHeight; texelY++)
 	for (int texelX = 0; texelX < blockWidth; texelX++)
 	{
 		const int				texelNdx			= texelY*blockWidth + texelX;
 		const int				colorEndpointNdx	= numPartitions == 1 ? 0 : computeTexelPartition(partitionIndexSeed, texelX, texelY, 0, numPartitions, smallBlock);
 		DE_ASSERT(colorEndpointNdx < numPartitions);
-		const UVec4&			e0					= colorEndpoints[colorEndpointNdx].e0;
-		const UVec4&			e1					= colorEndpoints[colorEndpointNdx].e1;
 		const TexelWeightPair&	weight				= texelWeights[texelNdx];
 
 		if (isLDRMode && isHDREndpoint[colorEndpointNdx])
@@ -1436,12 +1473,13 @@ DecompressResult setTexelColors (void* dst, ColorEndpointPair* colorEndpoints, T
 		{
 			for (int channelNdx = 0; channelNdx < 4; channelNdx++)
 			{
-				if (!isHDREndpoint[colorEndpointNdx] || (channelNdx == 3 && colorEndpointModes[colorEndpointNdx] == 14)) // \note Alpha for mode 14 is treated the same as LDR.
+				const deUint32 c0	= channelC0[colorEndpointNdx][channelNdx];
+				const deUint32 c1	= channelC1[colorEndpointNdx][channelNdx];
+				const deUint32 w	= weight.w[weightNdx[channelNdx]];
+				const deUint32 c	= (c0*(64-w) + c1*w + 32) / 64;
+
+				if (!isHDRChannel[colorEndpointNdx][channelNdx])
 				{
-					const deUint32 c0	= (e0[channelNdx] << 8) | (isSRGB ? 0x80 : e0[channelNdx]);
-					const deUint32 c1	= (e1[channelNdx] << 8) | (isSRGB ? 0x80 : e1[channelNdx]);
-					const deUint32 w	= weight.w[ccs == channelNdx ? 1 : 0];
-					const deUint32 c	= (c0*(64-w) + c1*w + 32) / 64;
 
 					if (isSRGB)
 						((deUint8*)dst)[texelNdx*4 + channelNdx] = (deUint8)((c & 0xff00) >> 8);
@@ -1451,10 +1489,6 @@ DecompressResult setTexelColors (void* dst, ColorEndpointPair* colorEndpoints, T
 				else
 				{
 					DE_STATIC_ASSERT((de::meta::TypesSame<deFloat16, deUint16>::Value));
-					const deUint32		c0	= e0[channelNdx] << 4;
-					const deUint32		c1	= e1[channelNdx] << 4;
-					const deUint32		w	= weight.w[ccs == channelNdx ? 1 : 0];
-					const deUint32		c	= (c0*(64-w) + c1*w + 32) / 64;
 					const deUint32		e	= getBits(c, 11, 15);
 					const deUint32		m	= getBits(c, 0, 10);
 					const deUint32		mt	= m < 512		? 3*m
@@ -1573,7 +1607,24 @@ void decompress (const PixelBufferAccess& dst, const deUint8* data, bool isSRGB,
 	decompressBlock(isSRGB ? (void*)&decompressedBuffer.sRGB[0] : (void*)&decompressedBuffer.linear[0],
 					blockData, dst.getWidth(), dst.getHeight(), isSRGB, isLDR);
 
-	if (isSRGB)
+	if (isSRGB && dst.getFormat() == TextureFormat(TextureFormat::sRGBA, TextureFormat::UNORM_INT8) && dst.getPixelPitch() == 4)
+	{
+		// Fast path: decoded texels are already in destination format.
+		for (int i = 0; i < blockHeight; i++)
+			deMemcpy(dst.getPixelPtr(0, i), &decompressedBuffer.sRGB[i*blockWidth*4], blockWidth*4);
+	}
+	else if (!isSRGB && dst.getFormat() == TextureFormat(TextureFormat::RGBA, TextureFormat::HALF_FLOAT) && dst.getPixelPitch() == 4*(int)sizeof(deFloat16))
+	{
+		// Fast path: convert to half floats directly instead of going through setPixel().
+		for (int i = 0; i < blockHeight; i++)
+		{
+			deFloat16* const dstRow = (deFloat16*)dst.getPixelPtr(0, i);
+
+			for (int j = 0; j < blockWidth*4; j++)
+				dstRow[j] = deFloat32To16(decompressedBuffer.linear[i*blockWidth*4 + j]);
+		}
+	}
+	else if (isSRGB)
 	{
 		for (int i = 0; i < blockHeight; i++)
 		for (int j = 0; j < blockWidth; j++)
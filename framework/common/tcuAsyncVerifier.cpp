@@ -0,0 +1,233 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Asynchronous result verification.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuAsyncVerifier.hpp"
+#include "tcuTestLog.hpp"
+#include "deThread.hpp"
+#include "deSemaphore.hpp"
+
+#include <new>
+
+namespace tcu
+{
+
+enum
+{
+	MAX_QUEUED_TASKS	= 64
+};
+
+struct AsyncVerifier::Entry
+{
+	de::UniquePtr<Task>	task;
+	bool				isOk;
+	std::string			error;			//!< Exception message if verify() threw.
+	qpTestResult		errorResult;	//!< Test result of the exception, QP_TEST_RESULT_LAST if verify() did not throw.
+	bool				isErrorFatal;
+	de::Semaphore		done;
+
+	Entry (de::MovePtr<Task> task_)
+		: task			(task_)
+		, isOk			(false)
+		, errorResult	(QP_TEST_RESULT_LAST)
+		, isErrorFatal	(false)
+		, done			(0)
+	{
+	}
+
+	void setError (const std::string& message, qpTestResult result, bool isFatal)
+	{
+		isOk			= false;
+		error			= message;
+		errorResult		= result;
+		isErrorFatal	= isFatal;
+	}
+
+	void execute (void)
+	{
+		try
+		{
+			isOk = task->verify();
+		}
+		catch (const std::bad_alloc&)
+		{
+			setError("Failed to allocate memory during verification", QP_TEST_RESULT_RESOURCE_ERROR, true);
+		}
+		catch (const TestException& e)
+		{
+			setError(e.getMessage(), e.getTestResult(), e.isFatal());
+		}
+		catch (const std::exception& e)
+		{
+			setError(e.what(), QP_TEST_RESULT_FAIL, false);
+		}
+		catch (...)
+		{
+			setError("Unknown exception", QP_TEST_RESULT_INTERNAL_ERROR, false);
+		}
+
+		done.increment();
+	}
+};
+
+class AsyncVerifier::Worker : public de::Thread
+{
+public:
+	Worker (de::ThreadSafeRingBuffer<Entry*>& queue)
+		: m_queue(queue)
+	{
+	}
+
+	void run (void)
+	{
+		for (;;)
+		{
+			Entry* const entry = m_queue.popBack();
+
+			// Null entry signals exit.
+			if (!entry)
+				break;
+
+			entry->execute();
+		}
+	}
+
+private:
+	de::ThreadSafeRingBuffer<Entry*>&	m_queue;
+};
+
+AsyncVerifier::AsyncVerifier (int numThreads)
+	: m_numThreads	(numThreads)
+	, m_queue		(MAX_QUEUED_TASKS)
+{
+	DE_ASSERT(numThreads >= 0);
+}
+
+AsyncVerifier::~AsyncVerifier (void)
+{
+	discard();
+	stopWorkers();
+}
+
+int AsyncVerifier::getDefaultNumThreads (void)
+{
+	// Leave one core for the test thread, but always overlap verification with rendering.
+	return de::max(1, (int)deGetNumAvailableLogicalCores() - 1);
+}
+
+void AsyncVerifier::startWorkers (void)
+{
+	DE_ASSERT(m_workers.empty());
+
+	for (int threadNdx = 0; threadNdx < m_numThreads; threadNdx++)
+	{
+		m_workers.push_back(de::SharedPtr<Worker>(new Worker(m_queue)));
+		m_workers.back()->start();
+	}
+}
+
+void AsyncVerifier::stopWorkers (void)
+{
+	for (size_t threadNdx = 0; threadNdx < m_workers.size(); threadNdx++)
+		m_queue.pushFront(DE_NULL);
+
+	for (size_t threadNdx = 0; threadNdx < m_workers.size(); threadNdx++)
+		m_workers[threadNdx]->join();
+
+	m_workers.clear();
+}
+
+void AsyncVerifier::submit (de::MovePtr<Task> task)
+{
+	const de::SharedPtr<Entry> entry (new Entry(task));
+
+	m_pending.push_back(entry);
+
+	if (m_numThreads == 0)
+	{
+		entry->execute();
+		return;
+	}
+
+	// Workers are started lazily so that contexts that never verify asynchronously don't own idle threads.
+	if (m_workers.empty())
+		startWorkers();
+
+	// Blocks if workers fall too far behind.
+	m_queue.pushFront(entry.get());
+}
+
+bool AsyncVerifier::join (TestLog& log)
+{
+	std::vector<de::SharedPtr<Entry> >	entries;
+	const Entry*						firstError	= DE_NULL;
+	bool								allOk		= true;
+
+	// Wait for everything first so that pending list is consistent even if logging throws.
+	waitPending(entries);
+
+	for (size_t entryNdx = 0; entryNdx < entries.size(); entryNdx++)
+	{
+		const Entry& entry = *entries[entryNdx];
+
+		if (entry.errorResult != QP_TEST_RESULT_LAST)
+		{
+			log << TestLog::Message << "Verification failed with exception: " << entry.error << TestLog::EndMessage;
+
+			if (!firstError)
+				firstError = &entry;
+		}
+		else
+			entry.task->log(log);
+
+		allOk = allOk && entry.isOk;
+	}
+
+	// Rethrow first worker exception in the test thread. Exception type is not preserved, but test result and fatality are.
+	if (firstError)
+	{
+		if (firstError->isErrorFatal)
+			throw ResourceError(firstError->error);
+		else
+			throw TestException(firstError->error, firstError->errorResult);
+	}
+
+	return allOk;
+}
+
+void AsyncVerifier::discard (void)
+{
+	std::vector<de::SharedPtr<Entry> > entries;
+	waitPending(entries);
+}
+
+void AsyncVerifier::waitPending (std::vector<de::SharedPtr<Entry> >& finished)
+{
+	DE_ASSERT(finished.empty());
+
+	finished.swap(m_pending);
+
+	for (size_t entryNdx = 0; entryNdx < finished.size(); entryNdx++)
+		finished[entryNdx]->done.decrement();
+}
+
+} // tcu
@@ -0,0 +1,111 @@
+#ifndef _TCUASYNCVERIFIER_HPP
+#define _TCUASYNCVERIFIER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Asynchronous result verification.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+#include "deThreadSafeRingBuffer.hpp"
+
+#include <vector>
+#include <string>
+
+namespace tcu
+{
+
+class TestLog;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Worker pool for verifying results while the test continues
+ *
+ * Test case can hand off verification of a result, for example image
+ * comparison against a reference, and continue submitting work for the
+ * next iteration while the verification runs on a worker thread. Results
+ * are collected with join(), which must be called before the case
+ * returns STOP.
+ *
+ * Verification tasks must own all data they access, since the test case
+ * may overwrite its result buffers right after submitting. Test log is
+ * not thread-safe, so tasks write to the log only when joined, in
+ * submission order.
+ *//*--------------------------------------------------------------------*/
+class AsyncVerifier
+{
+public:
+	class Task
+	{
+	public:
+		virtual			~Task		(void) {}
+
+		//! Verify result. Called in a worker thread.
+		virtual bool	verify		(void) = 0;
+
+		//! Write verification results to log. Called in the test thread when joined.
+		virtual void	log			(TestLog& log) const = 0;
+	};
+
+	//! Create verifier with given number of worker threads. With zero threads tasks are verified in submit().
+	explicit					AsyncVerifier		(int numThreads);
+								~AsyncVerifier		(void);
+
+	void						submit				(de::MovePtr<Task> task);
+
+	/*--------------------------------------------------------------------*//*!
+	 * \brief Wait for all submitted tasks and log their results
+	 *
+	 * Returns true if all verifications passed. If verify() of any task
+	 * threw, results of all tasks are still logged in submission order and
+	 * the first exception is then rethrown as tcu::TestException carrying
+	 * the original message and test result.
+	 *//*--------------------------------------------------------------------*/
+	bool						join				(TestLog& log);
+
+	//! Wait for all submitted tasks and discard the results.
+	void						discard				(void);
+
+	int							getNumPending		(void) const	{ return (int)m_pending.size();	}
+	int							getNumThreads		(void) const	{ return m_numThreads;			}
+
+	static int					getDefaultNumThreads	(void);
+
+private:
+								AsyncVerifier		(const AsyncVerifier&);
+	AsyncVerifier&				operator=			(const AsyncVerifier&);
+
+	struct Entry;
+	class Worker;
+
+	void						startWorkers		(void);
+	void						stopWorkers			(void);
+	void						waitPending			(std::vector<de::SharedPtr<Entry> >& finished);
+
+	const int									m_numThreads;
+	de::ThreadSafeRingBuffer<Entry*>			m_queue;
+	std::vector<de::SharedPtr<Worker> >			m_workers;
+	std::vector<de::SharedPtr<Entry> >			m_pending;
+};
+
+} // tcu
+
+#endif // _TCUASYNCVERIFIER_HPP
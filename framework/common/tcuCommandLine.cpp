@@ -87,7 +87,15 @@ DE_DECLARE_COMMAND_LINE_OPT(LogShaderSources,			bool);
 DE_DECLARE_COMMAND_LINE_OPT(TestOOM,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceID,					int);
 DE_DECLARE_COMMAND_LINE_OPT(LogFlush,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(BinaryLogFormat,			bool);
+DE_DECLARE_COMMAND_LINE_OPT(LogOnFailure,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(LogImageEncoder,			deUint32);
 DE_DECLARE_COMMAND_LINE_OPT(Validation,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(TraceFilename,				std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ReferenceCacheDir,			std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ReferenceCacheBypass,		bool);
+DE_DECLARE_COMMAND_LINE_OPT(MemoryStats,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(PrepareAhead,				int);
 
 static void parseIntList (const char* src, std::vector<int>* dst)
 {
@@ -112,12 +120,25 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "enable",		true	},
 		{ "disable",	false	}
 	};
+	static const NamedValue<bool> s_logFormats[] =
+	{
+		{ "xml",		false	},
+		{ "binary",		true	}
+	};
+	static const NamedValue<deUint32> s_logImageEncoders[] =
+	{
+		{ "default",	0u								},
+		{ "fast",		QP_TEST_LOG_IMAGE_ENCODER_FAST	},
+		{ "max",		QP_TEST_LOG_IMAGE_ENCODER_MAX	},
+		{ "raw",		QP_TEST_LOG_IMAGE_RAW_FILES		}
+	};
 	static const NamedValue<tcu::RunMode> s_runModes[] =
 	{
 		{ "execute",		RUNMODE_EXECUTE				},
 		{ "xml-caselist",	RUNMODE_DUMP_XML_CASELIST	},
 		{ "txt-caselist",	RUNMODE_DUMP_TEXT_CASELIST	},
-		{ "stdout-caselist",RUNMODE_DUMP_STDOUT_CASELIST}
+		{ "stdout-caselist",RUNMODE_DUMP_STDOUT_CASELIST},
+		{ "bin-caselist",	RUNMODE_DUMP_BINARY_CASELIST}
 	};
 	static const NamedValue<WindowVisibility> s_visibilites[] =
 	{
@@ -175,7 +196,15 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<LogShaderSources>		(DE_NULL,	"deqp-log-shader-sources",		"Enable or disable logging of shader sources",		s_enableNames,		"enable")
 		<< Option<TestOOM>				(DE_NULL,	"deqp-test-oom",				"Run tests that exhaust memory on purpose",			s_enableNames,		TEST_OOM_DEFAULT)
 		<< Option<LogFlush>				(DE_NULL,	"deqp-log-flush",				"Enable or disable log file fflush",				s_enableNames,		"enable")
-		<< Option<Validation>			(DE_NULL,	"deqp-validation",				"Enable or disable test case validation",			s_enableNames,		"disable");
+		<< Option<BinaryLogFormat>		(DE_NULL,	"deqp-log-format",				"Test log format, binary logs can be converted with testlog-binary-to-qpa",	s_logFormats,	"xml")
+		<< Option<LogOnFailure>			(DE_NULL,	"deqp-log-on-failure",			"Log images and shader sources only for test cases that do not pass",	s_enableNames,	"disable")
+		<< Option<LogImageEncoder>		(DE_NULL,	"deqp-log-image-encoder",		"Image encoding in log: fast and max trade PNG size for speed, raw writes pixels into separate files",	s_logImageEncoders,	"default")
+		<< Option<Validation>			(DE_NULL,	"deqp-validation",				"Enable or disable test case validation",			s_enableNames,		"disable")
+		<< Option<TraceFilename>		(DE_NULL,	"deqp-trace-file",				"Enable phase profiling and write trace (Chrome trace-event JSON) to given file")
+		<< Option<ReferenceCacheDir>	(DE_NULL,	"deqp-reference-cache-dir",		"Enable reference image cache in given existing directory")
+		<< Option<ReferenceCacheBypass>	(DE_NULL,	"deqp-reference-cache-bypass",	"Recompute and overwrite cached reference images",	s_enableNames,		"disable")
+		<< Option<MemoryStats>			(DE_NULL,	"deqp-memory-stats",			"Log host and device memory usage of each test case",	s_enableNames,		"disable")
+		<< Option<PrepareAhead>			(DE_NULL,	"deqp-prepare-ahead",			"Number of upcoming test cases to prepare in background",	"0");
 }
 
 void registerLegacyOptions (de::cmdline::Parser& parser)
@@ -729,6 +758,14 @@ bool CommandLine::parse (int argc, const char* const* argv)
 	if (!m_cmdLine.getOption<opt::LogFlush>())
 		m_logFlags |= QP_TEST_LOG_NO_FLUSH;
 
+	if (m_cmdLine.getOption<opt::BinaryLogFormat>())
+		m_logFlags |= QP_TEST_LOG_BINARY_FORMAT;
+
+	if (m_cmdLine.getOption<opt::LogOnFailure>())
+		m_logFlags |= QP_TEST_LOG_DETAILS_ON_FAILURE;
+
+	m_logFlags |= m_cmdLine.getOption<opt::LogImageEncoder>();
+
 	if ((m_cmdLine.hasOption<opt::CasePath>()?1:0) +
 		(m_cmdLine.hasOption<opt::CaseList>()?1:0) +
 		(m_cmdLine.hasOption<opt::CaseListFile>()?1:0) +
@@ -844,6 +881,37 @@ const char* CommandLine::getEGLPixmapType (void) const
 		return DE_NULL;
 }
 
+const char* CommandLine::getTraceFileName (void) const
+{
+	if (m_cmdLine.hasOption<opt::TraceFilename>())
+		return m_cmdLine.getOption<opt::TraceFilename>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getReferenceCacheDir (void) const
+{
+	if (m_cmdLine.hasOption<opt::ReferenceCacheDir>())
+		return m_cmdLine.getOption<opt::ReferenceCacheDir>().c_str();
+	else
+		return DE_NULL;
+}
+
+bool CommandLine::isReferenceCacheBypassed (void) const
+{
+	return m_cmdLine.getOption<opt::ReferenceCacheBypass>();
+}
+
+bool CommandLine::isMemoryStatsEnabled (void) const
+{
+	return m_cmdLine.getOption<opt::MemoryStats>();
+}
+
+int CommandLine::getPrepareAheadCount (void) const
+{
+	return m_cmdLine.getOption<opt::PrepareAhead>();
+}
+
 static bool checkTestGroupName (const CaseTreeNode* root, const char* groupPath)
 {
 	const CaseTreeNode* node = findNode(root, groupPath);
@@ -44,6 +44,7 @@ enum RunMode
 	RUNMODE_DUMP_XML_CASELIST,		//! Test program dumps the list of contained test cases in XML format.
 	RUNMODE_DUMP_TEXT_CASELIST,		//! Test program dumps the list of contained test cases in plain-text format.
 	RUNMODE_DUMP_STDOUT_CASELIST,	//! Test program dumps the list of contained test cases in plain-text format into stdout.
+	RUNMODE_DUMP_BINARY_CASELIST,	//! Test program dumps the list of contained test cases in binary format.
 
 	RUNMODE_LAST
 };
@@ -208,6 +209,21 @@ public:
 	//! Should we run tests that exhaust memory (--deqp-test-oom)
 	bool							isOutOfMemoryTestEnabled	(void) const;
 
+	//! Get phase profiling trace file name (--deqp-trace-file), or null if profiling is not enabled
+	const char*						getTraceFileName			(void) const;
+
+	//! Get reference image cache directory (--deqp-reference-cache-dir), or null if cache is not enabled
+	const char*						getReferenceCacheDir		(void) const;
+
+	//! Should cached reference images be recomputed (--deqp-reference-cache-bypass)
+	bool							isReferenceCacheBypassed	(void) const;
+
+	//! Should memory usage be logged for each test case (--deqp-memory-stats)
+	bool							isMemoryStatsEnabled		(void) const;
+
+	//! Get number of upcoming test cases to prepare in background (--deqp-prepare-ahead)
+	int								getPrepareAheadCount		(void) const;
+
 	/*--------------------------------------------------------------------*//*!
 	 * \brief Creates case list filter
 	 * \param archive Resources
@@ -27,8 +27,12 @@
 
 #include "deStringUtil.hpp"
 #include "deFloat16.h"
+#include "deAtomic.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
 
 #include <algorithm>
+#include <vector>
 
 namespace tcu
 {
@@ -420,6 +424,19 @@ void decompressETC1Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 		{ 47, 183, -47, -183 }
 	};
 
+	// Each sub-block has only four possible colors, resolve them before writing pixels.
+	deUint8 subBlockColors[2][4][ETC2_UNCOMPRESSED_PIXEL_SIZE_RGB8];
+
+	for (int subBlock = 0; subBlock < 2; subBlock++)
+	for (int modifierNdx = 0; modifierNdx < 4; modifierNdx++)
+	{
+		const int modifier = modifierTable[table[subBlock]][modifierNdx];
+
+		subBlockColors[subBlock][modifierNdx][0] = (deUint8)deClamp32((int)baseR[subBlock] + modifier, 0, 255);
+		subBlockColors[subBlock][modifierNdx][1] = (deUint8)deClamp32((int)baseG[subBlock] + modifier, 0, 255);
+		subBlockColors[subBlock][modifierNdx][2] = (deUint8)deClamp32((int)baseB[subBlock] + modifier, 0, 255);
+	}
+
 	// Write final pixels.
 	for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
 	{
@@ -427,13 +444,12 @@ void decompressETC1Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 		const int		y				= pixelNdx % ETC2_BLOCK_HEIGHT;
 		const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_RGB8;
 		const int		subBlock		= ((flipBit ? y : x) >= 2) ? 1 : 0;
-		const deUint32	tableNdx		= table[subBlock];
 		const deUint32	modifierNdx		= (getBit(src, 16+pixelNdx) << 1) | getBit(src, pixelNdx);
-		const int		modifier		= modifierTable[tableNdx][modifierNdx];
+		const deUint8*	color			= subBlockColors[subBlock][modifierNdx];
 
-		dst[dstOffset+0] = (deUint8)deClamp32((int)baseR[subBlock] + modifier, 0, 255);
-		dst[dstOffset+1] = (deUint8)deClamp32((int)baseG[subBlock] + modifier, 0, 255);
-		dst[dstOffset+2] = (deUint8)deClamp32((int)baseB[subBlock] + modifier, 0, 255);
+		dst[dstOffset+0] = color[0];
+		dst[dstOffset+1] = color[1];
+		dst[dstOffset+2] = color[2];
 	}
 }
 
@@ -515,43 +531,57 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 			baseB[1] = extend5To8((deUint8)(selBB + selDB));
 		}
 
-		// Write final pixels for individual or differential mode.
-		for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
+		// Each sub-block has only four possible colors, resolve them before writing pixels.
+		deUint8 subBlockColors[2][4][ETC2_UNCOMPRESSED_PIXEL_SIZE_RGBA8];
+
+		for (int subBlock = 0; subBlock < 2; subBlock++)
+		for (int modifierNdx = 0; modifierNdx < 4; modifierNdx++)
 		{
-			const int		x				= pixelNdx / ETC2_BLOCK_HEIGHT;
-			const int		y				= pixelNdx % ETC2_BLOCK_HEIGHT;
-			const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_RGB8;
-			const int		subBlock		= ((flipBit ? y : x) >= 2) ? 1 : 0;
-			const deUint32	tableNdx		= table[subBlock];
-			const deUint32	modifierNdx		= (getBit(src, 16+pixelNdx) << 1) | getBit(src, pixelNdx);
-			const int		alphaDstOffset	= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_A8; // Only needed for PUNCHTHROUGH version.
+			deUint8* const color = subBlockColors[subBlock][modifierNdx];
 
 			// If doing PUNCHTHROUGH version (alphaMode), opaque bit may affect colors.
 			if (alphaMode && diffOpaqueBit == 0 && modifierNdx == 2)
 			{
-				dst[dstOffset+0]			= 0;
-				dst[dstOffset+1]			= 0;
-				dst[dstOffset+2]			= 0;
-				alphaDst[alphaDstOffset]	= 0;
+				color[0] = 0;
+				color[1] = 0;
+				color[2] = 0;
+				color[3] = 0;
 			}
 			else
 			{
 				int modifier;
 
 				// PUNCHTHROUGH version and opaque bit may also affect modifiers.
-				if (alphaMode && diffOpaqueBit == 0 && (modifierNdx == 0 || modifierNdx == 2))
+				if (alphaMode && diffOpaqueBit == 0 && modifierNdx == 0)
 					modifier = 0;
 				else
-					modifier = modifierTable[tableNdx][modifierNdx];
+					modifier = modifierTable[table[subBlock]][modifierNdx];
 
-				dst[dstOffset+0] = (deUint8)deClamp32((int)baseR[subBlock] + modifier, 0, 255);
-				dst[dstOffset+1] = (deUint8)deClamp32((int)baseG[subBlock] + modifier, 0, 255);
-				dst[dstOffset+2] = (deUint8)deClamp32((int)baseB[subBlock] + modifier, 0, 255);
-
-				if (alphaMode)
-					alphaDst[alphaDstOffset] = 255;
+				color[0] = (deUint8)deClamp32((int)baseR[subBlock] + modifier, 0, 255);
+				color[1] = (deUint8)deClamp32((int)baseG[subBlock] + modifier, 0, 255);
+				color[2] = (deUint8)deClamp32((int)baseB[subBlock] + modifier, 0, 255);
+				color[3] = 255;
 			}
 		}
+
+		// Write final pixels for individual or differential mode.
+		for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
+		{
+			const int		x				= pixelNdx / ETC2_BLOCK_HEIGHT;
+			const int		y				= pixelNdx % ETC2_BLOCK_HEIGHT;
+			const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_RGB8;
+			const int		subBlock		= ((flipBit ? y : x) >= 2) ? 1 : 0;
+			const deUint32	modifierNdx		= (getBit(src, 16+pixelNdx) << 1) | getBit(src, pixelNdx);
+			const int		alphaDstOffset	= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_A8; // Only needed for PUNCHTHROUGH version.
+			const deUint8*	color			= subBlockColors[subBlock][modifierNdx];
+
+			dst[dstOffset+0] = color[0];
+			dst[dstOffset+1] = color[1];
+			dst[dstOffset+2] = color[2];
+
+			if (alphaMode)
+				alphaDst[alphaDstOffset] = color[3];
+		}
 	}
 	else if (mode == MODE_T || mode == MODE_H)
 	{
@@ -725,6 +755,10 @@ void decompressEAC8Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_A8], deUint64
 	const deUint8	baseCodeword	= (deUint8)getBits(src, 56, 63);
 	const deUint8	multiplier		= (deUint8)getBits(src, 52, 55);
 	const deUint32	tableNdx		= getBits(src, 48, 51);
+	deUint8			values[8];
+
+	for (int modifierNdx = 0; modifierNdx < DE_LENGTH_OF_ARRAY(values); modifierNdx++)
+		values[modifierNdx] = (deUint8)deClamp32((int)baseCodeword + (int)multiplier*modifierTable[tableNdx][modifierNdx], 0, 255);
 
 	for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
 	{
@@ -732,10 +766,9 @@ void decompressEAC8Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_A8], deUint64
 		const int		y				= pixelNdx % ETC2_BLOCK_HEIGHT;
 		const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_A8;
 		const int		pixelBitNdx		= 45 - 3*pixelNdx;
-		const deUint32	modifierNdx		= (getBit(src, pixelBitNdx + 2) << 2) | (getBit(src, pixelBitNdx + 1) << 1) | getBit(src, pixelBitNdx);
-		const int		modifier		= modifierTable[tableNdx][modifierNdx];
+		const deUint32	modifierNdx		= getBits(src, pixelBitNdx, pixelBitNdx + 2);
 
-		dst[dstOffset] = (deUint8)deClamp32((int)baseCodeword + (int)multiplier*modifier, 0, 255);
+		dst[dstOffset] = values[modifierNdx];
 	}
 }
 
@@ -773,14 +806,12 @@ void decompressEAC11Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_R11], deUint
 			baseCodeword = -127;
 	}
 
-	for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
+	// Signed values are stored as two's complement, so both modes can share the same 16-bit table.
+	deUint16 values[8];
+
+	for (int modifierNdx = 0; modifierNdx < DE_LENGTH_OF_ARRAY(values); modifierNdx++)
 	{
-		const int		x				= pixelNdx / ETC2_BLOCK_HEIGHT;
-		const int		y				= pixelNdx % ETC2_BLOCK_HEIGHT;
-		const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_R11;
-		const int		pixelBitNdx		= 45 - 3*pixelNdx;
-		const deUint32	modifierNdx		= (getBit(src, pixelBitNdx + 2) << 2) | (getBit(src, pixelBitNdx + 1) << 1) | getBit(src, pixelBitNdx);
-		const int		modifier		= modifierTable[tableNdx][modifierNdx];
+		const int modifier = modifierTable[tableNdx][modifierNdx];
 
 		if (signedMode)
 		{
@@ -791,7 +822,7 @@ void decompressEAC11Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_R11], deUint
 			else
 				value = (deInt16)deClamp32(baseCodeword*8 + modifier, -1023, 1023);
 
-			*((deInt16*)(dst + dstOffset)) = value;
+			values[modifierNdx] = (deUint16)value;
 		}
 		else
 		{
@@ -802,9 +833,20 @@ void decompressEAC11Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_R11], deUint
 			else
 				value= (deUint16)deClamp32(baseCodeword*8 + 4 + modifier, 0, 2047);
 
-			*((deUint16*)(dst + dstOffset)) = value;
+			values[modifierNdx] = value;
 		}
 	}
+
+	for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
+	{
+		const int		x				= pixelNdx / ETC2_BLOCK_HEIGHT;
+		const int		y				= pixelNdx % ETC2_BLOCK_HEIGHT;
+		const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_R11;
+		const int		pixelBitNdx		= 45 - 3*pixelNdx;
+		const deUint32	modifierNdx		= getBits(src, pixelBitNdx, pixelBitNdx + 2);
+
+		*((deUint16*)(dst + dstOffset)) = values[modifierNdx];
+	}
 }
 
 } // EtcDecompressInternal
@@ -1043,37 +1085,125 @@ int componentSum (const IVec3& vec)
 	return vec.x() + vec.y() + vec.z();
 }
 
-} // anonymous
+enum
+{
+	MIN_BLOCKS_PER_THREAD	= 1024	//!< Don't spawn threads for smaller textures.
+};
 
-void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+//! Decodes texture one row of blocks at a time. Rows are shared between all decoding threads.
+class BlockRowDecompressor
 {
-	const int				blockSize			= getBlockSize(fmt);
-	const IVec3				blockPixelSize		(getBlockPixelSize(fmt));
-	const IVec3				blockCount			(deDivRoundUp32(dst.getWidth(),		blockPixelSize.x()),
-												 deDivRoundUp32(dst.getHeight(),	blockPixelSize.y()),
-												 deDivRoundUp32(dst.getDepth(),		blockPixelSize.z()));
-	const IVec3				blockPitches		(blockSize, blockSize * blockCount.x(), blockSize * blockCount.x() * blockCount.y());
+public:
+	BlockRowDecompressor (const PixelBufferAccess& dst, CompressedTexFormat format, const deUint8* src, const TexDecompressionParams& params)
+		: m_dst				(dst)
+		, m_format			(format)
+		, m_src				(src)
+		, m_params			(params)
+		, m_blockPixelSize	(getBlockPixelSize(format))
+		, m_blockCount		(deDivRoundUp32(dst.getWidth(),		m_blockPixelSize.x()),
+							 deDivRoundUp32(dst.getHeight(),	m_blockPixelSize.y()),
+							 deDivRoundUp32(dst.getDepth(),		m_blockPixelSize.z()))
+		, m_blockPitches	(getBlockSize(format), getBlockSize(format) * m_blockCount.x(), getBlockSize(format) * m_blockCount.x() * m_blockCount.y())
+		, m_nextRow			(0)
+	{
+		DE_ASSERT(dst.getFormat() == getUncompressedFormat(format));
+	}
+
+	int getNumBlocks (void) const
+	{
+		return m_blockCount.x() * m_blockCount.y() * m_blockCount.z();
+	}
+
+	//! Decode rows until all rows have been claimed. Called from all decoding threads.
+	void processRows (void)
+	{
+		std::vector<deUint8>	uncompressedBlock	(m_dst.getFormat().getPixelSize() * m_blockPixelSize.x() * m_blockPixelSize.y() * m_blockPixelSize.z());
+		const PixelBufferAccess	blockAccess			(getUncompressedFormat(m_format), m_blockPixelSize.x(), m_blockPixelSize.y(), m_blockPixelSize.z(), &uncompressedBlock[0]);
+		const int				numRows				= m_blockCount.y() * m_blockCount.z();
+
+		for (;;)
+		{
+			const int rowNdx = (int)deAtomicIncrementInt32(&m_nextRow) - 1;
+
+			if (rowNdx >= numRows)
+				break;
+
+			for (int blockX = 0; blockX < m_blockCount.x(); blockX++)
+			{
+				const IVec3				blockPos	(blockX, rowNdx % m_blockCount.y(), rowNdx / m_blockCount.y());
+				const deUint8* const	blockPtr	= m_src + componentSum(blockPos * m_blockPitches);
+				const IVec3				copySize	(de::min(m_blockPixelSize.x(), m_dst.getWidth()		- blockPos.x() * m_blockPixelSize.x()),
+													 de::min(m_blockPixelSize.y(), m_dst.getHeight()	- blockPos.y() * m_blockPixelSize.y()),
+													 de::min(m_blockPixelSize.z(), m_dst.getDepth()		- blockPos.z() * m_blockPixelSize.z()));
+				const IVec3				dstPixelPos	= blockPos * m_blockPixelSize;
+
+				decompressBlock(m_format, blockAccess, blockPtr, m_params);
+
+				copy(getSubregion(m_dst, dstPixelPos.x(), dstPixelPos.y(), dstPixelPos.z(), copySize.x(), copySize.y(), copySize.z()), getSubregion(blockAccess, 0, 0, 0, copySize.x(), copySize.y(), copySize.z()));
+			}
+		}
+	}
+
+private:
+	const PixelBufferAccess			m_dst;
+	const CompressedTexFormat		m_format;
+	const deUint8* const			m_src;
+	const TexDecompressionParams	m_params;
+	const IVec3						m_blockPixelSize;
+	const IVec3						m_blockCount;
+	const IVec3						m_blockPitches;
 
-	std::vector<deUint8>	uncompressedBlock	(dst.getFormat().getPixelSize() * blockPixelSize.x() * blockPixelSize.y() * blockPixelSize.z());
-	const PixelBufferAccess	blockAccess			(getUncompressedFormat(fmt), blockPixelSize.x(), blockPixelSize.y(), blockPixelSize.z(), &uncompressedBlock[0]);
+	volatile deInt32				m_nextRow;
+};
 
-	DE_ASSERT(dst.getFormat() == getUncompressedFormat(fmt));
+class DecompressThread : public de::Thread
+{
+public:
+	DecompressThread (BlockRowDecompressor& decompressor)
+		: m_decompressor(decompressor)
+	{
+	}
 
-	for (int blockZ = 0; blockZ < blockCount.z(); blockZ++)
-	for (int blockY = 0; blockY < blockCount.y(); blockY++)
-	for (int blockX = 0; blockX < blockCount.x(); blockX++)
+	void run (void)
 	{
-		const IVec3				blockPos	(blockX, blockY, blockZ);
-		const deUint8* const	blockPtr	= src + componentSum(blockPos * blockPitches);
-		const IVec3				copySize	(de::min(blockPixelSize.x(), dst.getWidth()		- blockPos.x() * blockPixelSize.x()),
-											 de::min(blockPixelSize.y(), dst.getHeight()	- blockPos.y() * blockPixelSize.y()),
-											 de::min(blockPixelSize.z(), dst.getDepth()		- blockPos.z() * blockPixelSize.z()));
-		const IVec3				dstPixelPos	= blockPos * blockPixelSize;
+		m_decompressor.processRows();
+	}
+
+private:
+	BlockRowDecompressor&	m_decompressor;
+};
 
-		decompressBlock(fmt, blockAccess, blockPtr, params);
+} // anonymous
 
-		copy(getSubregion(dst, dstPixelPos.x(), dstPixelPos.y(), dstPixelPos.z(), copySize.x(), copySize.y(), copySize.z()), getSubregion(blockAccess, 0, 0, 0, copySize.x(), copySize.y(), copySize.z()));
+void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+{
+	BlockRowDecompressor							decompressor	(dst, fmt, src, params);
+	const int										numThreads		= de::min((int)deGetNumAvailableLogicalCores(), decompressor.getNumBlocks() / MIN_BLOCKS_PER_THREAD);
+	std::vector<de::SharedPtr<DecompressThread> >	threads;
+
+	// Calling thread decodes rows as well.
+	try
+	{
+		for (int threadNdx = 1; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<DecompressThread>(new DecompressThread(decompressor)));
+			threads.back()->start();
+		}
+
+		decompressor.processRows();
 	}
+	catch (...)
+	{
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		{
+			if (threads[threadNdx]->isStarted())
+				threads[threadNdx]->join();
+		}
+		throw;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		threads[threadNdx]->join();
 }
 
 CompressedTexture::CompressedTexture (void)
@@ -32,6 +32,7 @@
 #include "tcuTexture.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuProfiler.hpp"
 
 #include <string.h>
 
@@ -216,6 +217,8 @@ static int findNumPositionDeviationFailingPixels (const PixelBufferAccess& error
  *//*--------------------------------------------------------------------*/
 bool fuzzyCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, float threshold, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	FuzzyCompareParams	params;		// Use defaults.
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	float				difference		= fuzzyCompare(params, reference, result, errorMask.getAccess());
@@ -334,6 +337,8 @@ static deInt64 computeSquaredDiffSum (const ConstPixelBufferAccess& ref, const C
  *//*--------------------------------------------------------------------*/
 int measurePixelDiffAccuracy (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, int bestScoreDiff, int worstScoreDiff, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	TextureLevel	diffMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	int				diffFactor		= 8;
 	deInt64			squaredSum		= computeSquaredDiffSum(reference, result, diffMask.getAccess(), diffFactor);
@@ -487,6 +492,8 @@ static tcu::UVec4 computeFlushRelaxedULPDiff (const tcu::Vec4& a, const tcu::Vec
  *//*--------------------------------------------------------------------*/
 bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -573,6 +580,8 @@ bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const cha
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -660,6 +669,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const Vec4& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	const int			width				= result.getWidth();
 	const int			height				= result.getHeight();
 	const int			depth				= result.getDepth();
@@ -719,37 +730,15 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
 	return compareOk;
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Per-pixel threshold-based comparison
- *
- * This compare computes per-pixel differences between result and reference
- * image. Comparison fails if any pixels exceed the given threshold value.
- *
- * This comparison can be used for integer- and fixed-point texture formats.
- * Difference is computed in integer space.
- *
- * On failure error image is generated that shows where the failing pixels
- * are.
- *
- * \param log			Test log for results
- * \param imageSetName	Name for image set when logging results
- * \param imageSetDesc	Description for image set
- * \param reference		Reference image
- * \param result		Result image
- * \param threshold		Maximum allowed difference
- * \param logMode		Logging mode
- * \return true if comparison passes, false otherwise
- *//*--------------------------------------------------------------------*/
-bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
+namespace
 {
-	int					width				= reference.getWidth();
-	int					height				= reference.getHeight();
-	int					depth				= reference.getDepth();
-	TextureLevel		errorMaskStorage	(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), width, height, depth);
-	PixelBufferAccess	errorMask			= errorMaskStorage.getAccess();
-	UVec4				maxDiff				(0, 0, 0, 0);
-	Vec4				pixelBias			(0.0f, 0.0f, 0.0f, 0.0f);
-	Vec4				pixelScale			(1.0f, 1.0f, 1.0f, 1.0f);
+
+UVec4 computeIntThresholdErrorMask (const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const PixelBufferAccess& errorMask)
+{
+	const int	width		= reference.getWidth();
+	const int	height		= reference.getHeight();
+	const int	depth		= reference.getDepth();
+	UVec4		maxDiff		(0, 0, 0, 0);
 
 	TCU_CHECK_INTERNAL(result.getWidth() == width && result.getHeight() == height && result.getDepth() == depth);
 
@@ -772,7 +761,14 @@ bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* im
 		}
 	}
 
-	bool compareOk = boolAll(lessThanEqual(maxDiff, threshold));
+	return maxDiff;
+}
+
+void logIntThresholdCompareResult (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const ConstPixelBufferAccess& errorMask, const UVec4& maxDiff, const UVec4& threshold, CompareLogMode logMode)
+{
+	const bool	compareOk	= boolAll(lessThanEqual(maxDiff, threshold));
+	Vec4		pixelBias	(0.0f, 0.0f, 0.0f, 0.0f);
+	Vec4		pixelScale	(1.0f, 1.0f, 1.0f, 1.0f);
 
 	if (!compareOk || logMode == COMPARE_LOG_EVERYTHING)
 	{
@@ -802,8 +798,97 @@ bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* im
 			<< TestLog::Image("Result",		"Result",		result,		pixelScale, pixelBias)
 			<< TestLog::EndImageSet;
 	}
+}
 
-	return compareOk;
+class IntThresholdCompareTask : public AsyncVerifier::Task
+{
+public:
+	IntThresholdCompareTask (const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
+		: m_imageSetName	(imageSetName)
+		, m_imageSetDesc	(imageSetDesc)
+		, m_reference		(reference.getFormat(), reference.getWidth(), reference.getHeight(), reference.getDepth())
+		, m_result			(result.getFormat(), result.getWidth(), result.getHeight(), result.getDepth())
+		, m_errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight(), reference.getDepth())
+		, m_threshold		(threshold)
+		, m_logMode			(logMode)
+		, m_maxDiff			(0, 0, 0, 0)
+	{
+		TCU_CHECK_INTERNAL(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight() && result.getDepth() == reference.getDepth());
+
+		copy(m_reference.getAccess(), reference);
+		copy(m_result.getAccess(), result);
+	}
+
+	bool verify (void)
+	{
+		const ProfileScope profile ("imageCompare");
+
+		m_maxDiff = computeIntThresholdErrorMask(m_reference.getAccess(), m_result.getAccess(), m_threshold, m_errorMask.getAccess());
+
+		return boolAll(lessThanEqual(m_maxDiff, m_threshold));
+	}
+
+	void log (TestLog& log) const
+	{
+		logIntThresholdCompareResult(log, m_imageSetName.c_str(), m_imageSetDesc.c_str(), m_reference.getAccess(), m_result.getAccess(), m_errorMask.getAccess(), m_maxDiff, m_threshold, m_logMode);
+	}
+
+private:
+	const std::string		m_imageSetName;
+	const std::string		m_imageSetDesc;
+	TextureLevel			m_reference;
+	TextureLevel			m_result;
+	TextureLevel			m_errorMask;
+	const UVec4				m_threshold;
+	const CompareLogMode	m_logMode;
+	UVec4					m_maxDiff;
+};
+
+} // anonymous
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Per-pixel threshold-based comparison
+ *
+ * This compare computes per-pixel differences between result and reference
+ * image. Comparison fails if any pixels exceed the given threshold value.
+ *
+ * This comparison can be used for integer- and fixed-point texture formats.
+ * Difference is computed in integer space.
+ *
+ * On failure error image is generated that shows where the failing pixels
+ * are.
+ *
+ * \param log			Test log for results
+ * \param imageSetName	Name for image set when logging results
+ * \param imageSetDesc	Description for image set
+ * \param reference		Reference image
+ * \param result		Result image
+ * \param threshold		Maximum allowed difference
+ * \param logMode		Logging mode
+ * \return true if comparison passes, false otherwise
+ *//*--------------------------------------------------------------------*/
+bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
+{
+	const ProfileScope profile ("imageCompare");
+
+	TextureLevel		errorMaskStorage	(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight(), reference.getDepth());
+	const UVec4			maxDiff				= computeIntThresholdErrorMask(reference, result, threshold, errorMaskStorage.getAccess());
+
+	logIntThresholdCompareResult(log, imageSetName, imageSetDesc, reference, result, errorMaskStorage.getAccess(), maxDiff, threshold, logMode);
+
+	return boolAll(lessThanEqual(maxDiff, threshold));
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create asynchronous per-pixel threshold-based comparison task
+ *
+ * Verification task performs same comparison and logging as
+ * intThresholdCompare(). Reference and result images are copied so
+ * the caller may reuse its buffers after creating the task.
+ *//*--------------------------------------------------------------------*/
+de::MovePtr<AsyncVerifier::Task> createIntThresholdCompareTask (const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
+{
+	return de::MovePtr<AsyncVerifier::Task>(new IntThresholdCompareTask(imageSetName, imageSetDesc, reference, result, threshold, logMode));
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -837,6 +922,8 @@ bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* im
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -916,6 +1003,8 @@ bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetNam
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationErrorThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, int maxAllowedFailingPixels, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -1006,6 +1095,8 @@ bool pixelThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool bilinearCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const RGBA threshold, CompareLogMode logMode)
 {
+	const ProfileScope profile ("imageCompare");
+
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	bool				isOk			= bilinearCompare(reference, result, errorMask, threshold);
 	Vec4				pixelBias		(0.0f, 0.0f, 0.0f, 0.0f);
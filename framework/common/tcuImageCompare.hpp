@@ -25,6 +25,7 @@
 
 #include "tcuDefs.hpp"
 #include "tcuVectorType.hpp"
+#include "tcuAsyncVerifier.hpp"
 
 namespace tcu
 {
@@ -58,6 +59,9 @@ bool	intThresholdPositionDeviationErrorThresholdCompare	(TestLog& log, const cha
 int		measurePixelDiffAccuracy							(TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, int bestScoreDiff, int worstScoreDiff, CompareLogMode logMode);
 bool	bilinearCompare										(TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const RGBA threshold, CompareLogMode logMode);
 
+// Verification tasks for AsyncVerifier.
+de::MovePtr<AsyncVerifier::Task>	createIntThresholdCompareTask	(const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode);
+
 } // tcu
 
 #endif // _TCUIMAGECOMPARE_HPP
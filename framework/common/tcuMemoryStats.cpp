@@ -0,0 +1,219 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Per-case memory usage statistics.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuMemoryStats.hpp"
+#include "tcuTestLog.hpp"
+
+#include "deMemory.h"
+#include "deMemoryUsage.h"
+#include "deMutex.hpp"
+
+#if defined(DEQP_COUNT_NEW_ALLOCATIONS)
+#	include <new>
+#endif
+
+namespace tcu
+{
+namespace memstats
+{
+namespace
+{
+
+// \note Device allocations are recorded even when statistics are disabled
+//		 so that live memory stays consistent if statistics are enabled
+//		 while allocations are alive.
+struct DeviceMemoryCounters
+{
+	deUint32	numAllocations;
+	deUint64	allocated;
+	deUint64	current;
+	deUint64	peak;
+
+	DeviceMemoryCounters (void)
+		: numAllocations	(0)
+		, allocated			(0)
+		, current			(0)
+		, peak				(0)
+	{
+	}
+};
+
+static volatile deInt32		s_isEnabled			= 0;
+static de::Mutex			s_deviceLock;
+static DeviceMemoryCounters	s_deviceCounters;
+
+} // anonymous
+
+void setEnabled (bool enabled)
+{
+	s_isEnabled = enabled ? 1 : 0;
+	deMemory_setAllocationCountingEnabled(enabled ? DE_TRUE : DE_FALSE);
+}
+
+bool isEnabled (void)
+{
+	return s_isEnabled != 0;
+}
+
+void recordDeviceAllocation (deUint64 size)
+{
+	const de::ScopedLock lock (s_deviceLock);
+
+	s_deviceCounters.numAllocations	+= 1;
+	s_deviceCounters.allocated		+= size;
+	s_deviceCounters.current		+= size;
+	s_deviceCounters.peak			 = de::max(s_deviceCounters.peak, s_deviceCounters.current);
+}
+
+void recordDeviceFree (deUint64 size)
+{
+	const de::ScopedLock lock (s_deviceLock);
+
+	DE_ASSERT(size <= s_deviceCounters.current);
+	s_deviceCounters.current -= de::min(size, s_deviceCounters.current);
+}
+
+//! Get device counters and restart counting from current live memory.
+static DeviceMemoryCounters resetDeviceCounters (void)
+{
+	const de::ScopedLock		lock		(s_deviceLock);
+	const DeviceMemoryCounters	counters	= s_deviceCounters;
+
+	s_deviceCounters.numAllocations	= 0;
+	s_deviceCounters.allocated		= 0;
+	s_deviceCounters.peak			= s_deviceCounters.current;
+
+	return counters;
+}
+
+} // memstats
+
+MemoryStatsTracker::MemoryStatsTracker (void)
+	: m_hasHostPeakMemory	(false)
+	, m_hostStartPeak		(0)
+	, m_startNumAllocations	(0)
+{
+}
+
+void MemoryStatsTracker::begin (void)
+{
+	deProcessMemoryUsage usage;
+
+	deResetProcessPeakMemoryUsage();
+
+	m_hasHostPeakMemory		= deGetProcessMemoryUsage(&usage) == DE_TRUE;
+	m_hostStartPeak			= m_hasHostPeakMemory ? usage.peakResidentBytes : 0;
+	m_startNumAllocations	= deMemory_getNumAllocations();
+
+	memstats::resetDeviceCounters();
+}
+
+MemoryStats MemoryStatsTracker::end (void)
+{
+	const memstats::DeviceMemoryCounters	deviceCounters	= memstats::resetDeviceCounters();
+	MemoryStats								stats;
+	deProcessMemoryUsage					usage;
+
+	if (m_hasHostPeakMemory && deGetProcessMemoryUsage(&usage))
+	{
+		stats.hasHostPeakMemory		= true;
+		stats.hostPeakMemoryDelta	= (deInt64)(usage.peakResidentBytes - m_hostStartPeak);
+	}
+
+	stats.numHostAllocations	= deMemory_getNumAllocations() - m_startNumAllocations;
+	stats.numDeviceAllocations	= deviceCounters.numAllocations;
+	stats.deviceMemoryAllocated	= deviceCounters.allocated;
+	stats.deviceMemoryPeak		= deviceCounters.peak;
+
+	return stats;
+}
+
+void logMemoryStats (TestLog& log, const MemoryStats& stats)
+{
+	if (stats.hasHostPeakMemory)
+		log << TestLog::Integer("HostPeakMemoryDelta", "Growth of host peak resident memory", "B", QP_KEY_TAG_NONE, stats.hostPeakMemoryDelta);
+
+	log << TestLog::Integer("HostAllocations", "Number of host memory allocations", "", QP_KEY_TAG_NONE, (deInt64)stats.numHostAllocations);
+
+	// Only APIs with device memory allocators report device memory
+	if (stats.numDeviceAllocations > 0 || stats.deviceMemoryPeak > 0)
+	{
+		log << TestLog::Integer("DeviceAllocations",		"Number of device memory allocations",		"",		QP_KEY_TAG_NONE, (deInt64)stats.numDeviceAllocations)
+			<< TestLog::Integer("DeviceMemoryAllocated",	"Total device memory allocated",			"B",	QP_KEY_TAG_NONE, (deInt64)stats.deviceMemoryAllocated)
+			<< TestLog::Integer("DeviceMemoryPeak",			"Peak device memory in use",				"B",	QP_KEY_TAG_NONE, (deInt64)stats.deviceMemoryPeak);
+	}
+}
+
+} // tcu
+
+#if defined(DEQP_COUNT_NEW_ALLOCATIONS)
+
+// Replace global allocation functions so that C++ allocations are counted with deMalloc().
+// \note Object file is always linked in since test session executor references the tracker.
+
+void* operator new (size_t size) throw (std::bad_alloc)
+{
+	void* const ptr = deMalloc(size > 0 ? size : 1);
+
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new[] (size_t size) throw (std::bad_alloc)
+{
+	return operator new(size);
+}
+
+void* operator new (size_t size, const std::nothrow_t&) throw ()
+{
+	return deMalloc(size > 0 ? size : 1);
+}
+
+void* operator new[] (size_t size, const std::nothrow_t&) throw ()
+{
+	return deMalloc(size > 0 ? size : 1);
+}
+
+void operator delete (void* ptr) throw ()
+{
+	deFree(ptr);
+}
+
+void operator delete[] (void* ptr) throw ()
+{
+	deFree(ptr);
+}
+
+void operator delete (void* ptr, const std::nothrow_t&) throw ()
+{
+	deFree(ptr);
+}
+
+void operator delete[] (void* ptr, const std::nothrow_t&) throw ()
+{
+	deFree(ptr);
+}
+
+#endif // DEQP_COUNT_NEW_ALLOCATIONS
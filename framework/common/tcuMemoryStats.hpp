@@ -0,0 +1,103 @@
+#ifndef _TCUMEMORYSTATS_HPP
+#define _TCUMEMORYSTATS_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Per-case memory usage statistics.
+ *
+ * Memory statistics are compiled in but disabled by default. When
+ * enabled, test session executor records the growth of host peak
+ * resident memory, number of host allocations and device memory
+ * allocated through API-specific allocators for each test case.
+ *
+ * Host allocations are counted in deMalloc() and friends. If dEQP is
+ * built with DEQP_COUNT_NEW_ALLOCATIONS, global operator new is replaced
+ * with one that allocates through deMalloc() so that C++ allocations
+ * are counted as well.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+
+namespace tcu
+{
+
+class TestLog;
+
+namespace memstats
+{
+
+void	setEnabled					(bool enabled);
+bool	isEnabled					(void);
+
+//! Record device memory allocation. Called by device memory allocators.
+void	recordDeviceAllocation		(deUint64 size);
+
+//! Record release of memory previously recorded with recordDeviceAllocation().
+void	recordDeviceFree			(deUint64 size);
+
+} // memstats
+
+struct MemoryStats
+{
+	bool		hasHostPeakMemory;		//!< False if platform doesn't support querying resident memory.
+	deInt64		hostPeakMemoryDelta;	//!< Growth of peak resident memory in bytes.
+	deUint32	numHostAllocations;
+	deUint32	numDeviceAllocations;
+	deUint64	deviceMemoryAllocated;	//!< Total bytes of device memory allocated.
+	deUint64	deviceMemoryPeak;		//!< Peak bytes of live device memory.
+
+	MemoryStats (void)
+		: hasHostPeakMemory		(false)
+		, hostPeakMemoryDelta	(0)
+		, numHostAllocations	(0)
+		, numDeviceAllocations	(0)
+		, deviceMemoryAllocated	(0)
+		, deviceMemoryPeak		(0)
+	{
+	}
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Collects memory statistics between begin() and end()
+ *
+ * Peak resident memory is reset at begin() if the platform allows it.
+ * Otherwise the reported delta is the growth of process-wide peak,
+ * which is zero for cases that stay below the peak of earlier cases.
+ *//*--------------------------------------------------------------------*/
+class MemoryStatsTracker
+{
+public:
+						MemoryStatsTracker	(void);
+
+	void				begin				(void);
+	MemoryStats			end					(void);
+
+private:
+	bool				m_hasHostPeakMemory;
+	deUint64			m_hostStartPeak;
+	deUint32			m_startNumAllocations;
+};
+
+//! Write memory statistics into the log.
+void logMemoryStats (TestLog& log, const MemoryStats& stats);
+
+} // tcu
+
+#endif // _TCUMEMORYSTATS_HPP
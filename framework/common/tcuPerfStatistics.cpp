@@ -0,0 +1,416 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Robust statistics for performance measurements.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuPerfStatistics.hpp"
+#include "tcuTestLog.hpp"
+#include "deRandom.hpp"
+
+#include <cmath>
+#include <limits>
+
+using std::vector;
+
+namespace tcu
+{
+
+LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints)
+{
+	const float		epsilon					= 1e-6f;
+
+	const int		numDataPoints			= (int)dataPoints.size();
+	vector<float>	pairwiseCoefficients;
+	vector<float>	pointwiseOffsets;
+	LineParameters	result					(0.0f, 0.0f);
+
+	// Compute the pairwise coefficients.
+	for (int i = 0; i < numDataPoints; i++)
+	{
+		const Vec2& ptA = dataPoints[i];
+
+		for (int j = 0; j < i; j++)
+		{
+			const Vec2& ptB = dataPoints[j];
+
+			if (de::abs(ptA.x() - ptB.x()) > epsilon)
+				pairwiseCoefficients.push_back((ptA.y() - ptB.y()) / (ptA.x() - ptB.x()));
+		}
+	}
+
+	// Find the median of the pairwise coefficients.
+	// \note If there are no data point pairs with differing x values, the coefficient variable will stay zero as initialized.
+	if (!pairwiseCoefficients.empty())
+		result.coefficient = destructiveMedian(pairwiseCoefficients);
+
+	// Compute the offsets corresponding to the median coefficient, for all data points.
+	for (int i = 0; i < numDataPoints; i++)
+		pointwiseOffsets.push_back(dataPoints[i].y() - result.coefficient*dataPoints[i].x());
+
+	// Find the median of the offsets.
+	// \note If there are no data points, the offset variable will stay zero as initialized.
+	if (!pointwiseOffsets.empty())
+		result.offset = destructiveMedian(pointwiseOffsets);
+
+	return result;
+}
+
+LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence)
+{
+	DE_ASSERT(!dataPoints.empty());
+
+	// Siegel's variation
+
+	const float						epsilon				= 1e-6f;
+	const int						numDataPoints		= (int)dataPoints.size();
+	std::vector<float>				medianSlopes;
+	std::vector<float>				pointwiseOffsets;
+	LineParametersWithConfidence	result;
+
+	// Compute the median slope via each element
+	for (int i = 0; i < numDataPoints; i++)
+	{
+		const tcu::Vec2&	ptA		= dataPoints[i];
+		std::vector<float>	slopes;
+
+		slopes.reserve(numDataPoints);
+
+		for (int j = 0; j < numDataPoints; j++)
+		{
+			const tcu::Vec2& ptB = dataPoints[j];
+
+			if (de::abs(ptA.x() - ptB.x()) > epsilon)
+				slopes.push_back((ptA.y() - ptB.y()) / (ptA.x() - ptB.x()));
+		}
+
+		// Add median of slopes through point i
+		medianSlopes.push_back(destructiveMedian(slopes));
+	}
+
+	DE_ASSERT(!medianSlopes.empty());
+
+	// Find the median of the pairwise coefficients.
+	std::sort(medianSlopes.begin(), medianSlopes.end());
+	result.coefficient = linearSample(medianSlopes, 0.5f);
+
+	// Compute the offsets corresponding to the median coefficient, for all data points.
+	for (int i = 0; i < numDataPoints; i++)
+		pointwiseOffsets.push_back(dataPoints[i].y() - result.coefficient*dataPoints[i].x());
+
+	// Find the median of the offsets.
+	std::sort(pointwiseOffsets.begin(), pointwiseOffsets.end());
+	result.offset = linearSample(pointwiseOffsets, 0.5f);
+
+	// calculate confidence intervals
+	result.coefficientConfidenceLower = linearSample(medianSlopes, 0.5f - reportedConfidence*0.5f);
+	result.coefficientConfidenceUpper = linearSample(medianSlopes, 0.5f + reportedConfidence*0.5f);
+
+	result.offsetConfidenceLower = linearSample(pointwiseOffsets, 0.5f - reportedConfidence*0.5f);
+	result.offsetConfidenceUpper = linearSample(pointwiseOffsets, 0.5f + reportedConfidence*0.5f);
+
+	result.confidence = reportedConfidence;
+
+	return result;
+}
+
+ConfidenceInterval bootstrapMedianConfidenceInterval (const std::vector<float>& samples, float confidence, int numResamples, deUint32 seed)
+{
+	DE_ASSERT(!samples.empty());
+	DE_ASSERT(de::inRange(confidence, 0.0f, 1.0f));
+	DE_ASSERT(numResamples > 0);
+
+	const int			numSamples	= (int)samples.size();
+	de::Random			rnd			(seed);
+	vector<float>		resample	(samples.size());
+	vector<float>		medians		(numResamples);
+	ConfidenceInterval	result;
+
+	for (int resampleNdx = 0; resampleNdx < numResamples; resampleNdx++)
+	{
+		for (int ndx = 0; ndx < numSamples; ndx++)
+			resample[ndx] = samples[rnd.getInt(0, numSamples-1)];
+
+		medians[resampleNdx] = destructiveMedian(resample);
+	}
+
+	std::sort(medians.begin(), medians.end());
+
+	result.lower		= linearSample(medians, 0.5f - confidence*0.5f);
+	result.upper		= linearSample(medians, 0.5f + confidence*0.5f);
+	result.confidence	= confidence;
+
+	return result;
+}
+
+SampleStatistics::SampleStatistics (void)
+	: numSamples				(0)
+	, minimum					(0.0)
+	, maximum					(0.0)
+	, mean						(0.0)
+	, median					(0.0)
+	, variance					(0.0)
+	, standardDeviation			(0.0)
+	, standardErrorOfMean		(0.0)
+	, medianAbsoluteDeviation	(0.0)
+	, min2Decile				(0.0)
+	, max9Decile				(0.0)
+{
+}
+
+SampleStatistics calculateSampleStatistics (const std::vector<double>& samples)
+{
+	SampleStatistics	stats;
+	vector<double>		sorted	= samples;
+
+	if (samples.empty())
+		return stats;
+
+	std::sort(sorted.begin(), sorted.end());
+
+	stats.numSamples	= (int)samples.size();
+	stats.minimum		= sorted.front();
+	stats.maximum		= sorted.back();
+
+	for (int ndx = 0; ndx < stats.numSamples; ndx++)
+		stats.mean += sorted[ndx];
+	stats.mean /= (double)stats.numSamples;
+
+	for (int ndx = 0; ndx < stats.numSamples; ndx++)
+		stats.variance += (sorted[ndx] - stats.mean) * (sorted[ndx] - stats.mean);
+	stats.variance /= (double)stats.numSamples;
+
+	stats.standardDeviation			= std::sqrt(stats.variance);
+	stats.standardErrorOfMean		= stats.standardDeviation / std::sqrt((double)stats.numSamples);
+	stats.median					= linearSample(sorted, 0.5f);
+	stats.medianAbsoluteDeviation	= tcu::medianAbsoluteDeviation(sorted);
+	stats.min2Decile				= linearSample(sorted, 0.1f);
+	stats.max9Decile				= linearSample(sorted, 0.9f);
+
+	return stats;
+}
+
+int findWarmupLength (const std::vector<float>& samples)
+{
+	const int numSamples = (int)samples.size();
+
+	if (numSamples < 4)
+		return 0;
+
+	{
+		const vector<float>	steadyState		(samples.begin() + numSamples/2, samples.end());
+		const float			center			= median(steadyState);
+		// Accept a few median absolute deviations, but don't react to jitter under one percent of the median
+		const float			threshold		= de::max(4.0f * medianAbsoluteDeviation(steadyState), 0.01f * deFloatAbs(center));
+		int					warmupLength	= 0;
+
+		while (warmupLength < numSamples/2 && deFloatAbs(samples[warmupLength] - center) > threshold)
+			warmupLength++;
+
+		return warmupLength;
+	}
+}
+
+// AdaptiveSampler
+
+enum
+{
+	ADAPTIVE_SAMPLER_CHECK_INTERVAL	= 5,		//!< Re-evaluate confidence interval after this many new samples
+	ADAPTIVE_SAMPLER_NUM_RESAMPLES	= 500
+};
+
+AdaptiveSampler::AdaptiveSampler (const Parameters& params)
+	: m_params			(params)
+	, m_warmupLength	(0)
+	, m_median			(0.0f)
+	, m_targetReached	(false)
+	, m_isDone			(false)
+{
+	DE_ASSERT(0 < m_params.minSamples && m_params.minSamples <= m_params.maxSamples);
+}
+
+void AdaptiveSampler::clear (void)
+{
+	m_samples.clear();
+	m_warmupLength	= 0;
+	m_interval		= ConfidenceInterval();
+	m_median		= 0.0f;
+	m_targetReached	= false;
+	m_isDone		= false;
+}
+
+void AdaptiveSampler::addSample (float sample)
+{
+	DE_ASSERT(!m_isDone);
+
+	m_samples.push_back(sample);
+
+	if ((int)m_samples.size() >= m_params.maxSamples || ((int)m_samples.size() >= m_params.minSamples && ((int)m_samples.size() - m_params.minSamples) % ADAPTIVE_SAMPLER_CHECK_INTERVAL == 0))
+		update();
+}
+
+std::vector<float> AdaptiveSampler::getSteadyStateSamples (void) const
+{
+	return vector<float>(m_samples.begin() + m_warmupLength, m_samples.end());
+}
+
+void AdaptiveSampler::update (void)
+{
+	const int numSamples = (int)m_samples.size();
+
+	m_warmupLength = findWarmupLength(m_samples);
+
+	{
+		const vector<float> steadyState = getSteadyStateSamples();
+
+		m_median	= median(steadyState);
+		m_interval	= bootstrapMedianConfidenceInterval(steadyState, m_params.confidence, ADAPTIVE_SAMPLER_NUM_RESAMPLES, (deUint32)numSamples);
+	}
+
+	m_targetReached	= (numSamples - m_warmupLength) >= m_params.minSamples &&
+					  m_interval.upper - m_interval.lower <= m_params.targetRelativeWidth * deFloatAbs(m_median);
+	m_isDone		= m_targetReached || numSamples >= m_params.maxSamples;
+}
+
+void logSamples (TestLog& log, const std::string& name, const std::string& description, const std::vector<float>& samples, const std::string& unit)
+{
+	log << TestLog::SampleList(name, description)
+		<< TestLog::SampleInfo
+		<< TestLog::ValueInfo("Value", "Sample value", unit, QP_SAMPLE_VALUE_TAG_RESPONSE)
+		<< TestLog::EndSampleInfo;
+
+	for (int sampleNdx = 0; sampleNdx < (int)samples.size(); sampleNdx++)
+		log << TestLog::Sample << samples[sampleNdx] << TestLog::EndSample;
+
+	log << TestLog::EndSampleList;
+}
+
+void logSampleStatistics (TestLog& log, const std::string& name, const std::string& description, const SampleStatistics& stats, const std::string& unit)
+{
+	const ScopedLogSection section (log, name, description);
+
+	log << TestLog::Integer	("NumSamples",				"Number of samples",			"",		QP_KEY_TAG_NONE,	stats.numSamples)
+		<< TestLog::Float	("Minimum",					"Minimum",						unit,	QP_KEY_TAG_NONE,	(float)stats.minimum)
+		<< TestLog::Float	("Maximum",					"Maximum",						unit,	QP_KEY_TAG_NONE,	(float)stats.maximum)
+		<< TestLog::Float	("Mean",					"Mean",							unit,	QP_KEY_TAG_NONE,	(float)stats.mean)
+		<< TestLog::Float	("Median",					"Median",						unit,	QP_KEY_TAG_NONE,	(float)stats.median)
+		<< TestLog::Float	("StandardDeviation",		"Standard deviation",			unit,	QP_KEY_TAG_NONE,	(float)stats.standardDeviation)
+		<< TestLog::Float	("MedianAbsoluteDeviation",	"Median absolute deviation",	unit,	QP_KEY_TAG_NONE,	(float)stats.medianAbsoluteDeviation)
+		<< TestLog::Float	("Min2Decile",				"10th percentile",				unit,	QP_KEY_TAG_NONE,	(float)stats.min2Decile)
+		<< TestLog::Float	("Max9Decile",				"90th percentile",				unit,	QP_KEY_TAG_NONE,	(float)stats.max9Decile);
+}
+
+void PerfStatistics_selfTest (void)
+{
+	// Medians
+	{
+		const float			oddValues[]		= { 5.0f, 1.0f, 3.0f };
+		const float			evenValues[]	= { 4.0f, 1.0f, 3.0f, 2.0f };
+		const vector<float>	odd				(DE_ARRAY_BEGIN(oddValues), DE_ARRAY_END(oddValues));
+		const vector<float>	even			(DE_ARRAY_BEGIN(evenValues), DE_ARRAY_END(evenValues));
+
+		TCU_CHECK(median(odd) == 3.0f);
+		TCU_CHECK(median(even) == 2.5f);
+		TCU_CHECK(medianAbsoluteDeviation(odd) == 2.0f);
+	}
+
+	// Linear sampling
+	{
+		const float			sortedValues[]	= { 0.0f, 10.0f, 20.0f };
+		const vector<float>	sorted			(DE_ARRAY_BEGIN(sortedValues), DE_ARRAY_END(sortedValues));
+
+		TCU_CHECK(linearSample(sorted, 0.0f) == 0.0f);
+		TCU_CHECK(linearSample(sorted, 0.25f) == 5.0f);
+		TCU_CHECK(linearSample(sorted, 1.0f) == 20.0f);
+	}
+
+	// Theil-Sen fits exact line even with an outlier
+	{
+		vector<Vec2> points;
+
+		for (int ndx = 0; ndx < 10; ndx++)
+			points.push_back(Vec2((float)ndx, 2.0f*(float)ndx + 1.0f));
+		points[3].y() = 1000.0f;
+
+		{
+			const LineParameters				line			= theilSenLinearRegression(points);
+			const LineParametersWithConfidence	lineWithConf	= theilSenSiegelLinearRegression(points, 0.6f);
+
+			TCU_CHECK(de::abs(line.coefficient - 2.0f) < 1e-4f && de::abs(line.offset - 1.0f) < 1e-4f);
+			TCU_CHECK(de::abs(lineWithConf.coefficient - 2.0f) < 1e-4f && de::abs(lineWithConf.offset - 1.0f) < 1e-4f);
+			TCU_CHECK(lineWithConf.coefficientConfidenceLower <= lineWithConf.coefficient && lineWithConf.coefficient <= lineWithConf.coefficientConfidenceUpper);
+		}
+	}
+
+	// Basic statistics
+	{
+		const deUint64				values[]	= { 1, 2, 3, 4, 5 };
+		const SampleStatistics		stats		= calculateSampleStatistics(vector<deUint64>(DE_ARRAY_BEGIN(values), DE_ARRAY_END(values)));
+
+		TCU_CHECK(stats.numSamples == 5);
+		TCU_CHECK(stats.minimum == 1.0 && stats.maximum == 5.0);
+		TCU_CHECK(stats.mean == 3.0 && stats.median == 3.0);
+		TCU_CHECK(stats.variance == 2.0);
+		TCU_CHECK(stats.medianAbsoluteDeviation == 1.0);
+	}
+
+	// Warmup detection
+	{
+		const float			values[]	= { 100.0f, 40.0f, 10.0f, 10.2f, 9.8f, 10.1f, 9.9f, 10.0f, 10.3f, 9.7f, 10.0f, 10.1f };
+		const vector<float>	samples		(DE_ARRAY_BEGIN(values), DE_ARRAY_END(values));
+
+		TCU_CHECK(findWarmupLength(samples) == 2);
+		TCU_CHECK(findWarmupLength(vector<float>(samples.begin() + 2, samples.end())) == 0);
+	}
+
+	// Bootstrap interval
+	{
+		de::Random				rnd			(0x39c4a1);
+		vector<float>			samples;
+
+		for (int ndx = 0; ndx < 101; ndx++)
+			samples.push_back(10.0f + rnd.getFloat(-1.0f, 1.0f));
+
+		{
+			const float					center		= median(samples);
+			const ConfidenceInterval	interval	= bootstrapMedianConfidenceInterval(samples, 0.95f, 200, 1u);
+
+			TCU_CHECK(interval.lower <= center && center <= interval.upper);
+			TCU_CHECK(interval.upper - interval.lower < 1.0f);
+		}
+	}
+
+	// Adaptive sampler stops early on stable input and discards warmup
+	{
+		AdaptiveSampler sampler (AdaptiveSampler::Parameters(10, 100, 0.05f, 0.95f));
+
+		sampler.addSample(50.0f);
+
+		while (!sampler.isDone())
+			sampler.addSample(10.0f);
+
+		TCU_CHECK(sampler.isTargetReached());
+		TCU_CHECK(sampler.getWarmupLength() == 1);
+		TCU_CHECK((int)sampler.getSamples().size() < 100);
+		TCU_CHECK(sampler.getMedian() == 10.0f);
+	}
+}
+
+} // tcu
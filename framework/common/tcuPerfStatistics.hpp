@@ -0,0 +1,230 @@
+#ifndef _TCUPERFSTATISTICS_HPP
+#define _TCUPERFSTATISTICS_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Robust statistics for performance measurements.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuVector.hpp"
+#include "deMath.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+namespace tcu
+{
+
+class TestLog;
+
+// Reorders input arbitrarily, linear complexity and no allocations
+template<typename T>
+float destructiveMedian (std::vector<T>& data)
+{
+	const typename std::vector<T>::iterator mid = data.begin()+data.size()/2;
+
+	DE_ASSERT(!data.empty());
+
+	std::nth_element(data.begin(), mid, data.end());
+
+	if (data.size()%2 == 0) // Even number of elements, need average of two centermost elements
+		return ((float)*mid + (float)*std::max_element(data.begin(), mid))*0.5f; // Data is partially sorted around mid, mid is half an item after center
+	else
+		return (float)*mid;
+}
+
+template<typename T>
+float median (const std::vector<T>& data)
+{
+	std::vector<T> temp = data;
+	return destructiveMedian(temp);
+}
+
+// Sample from given sorted values using linear interpolation at a given position as if values were laid to range [0, 1]
+template<typename T>
+float linearSample (const std::vector<T>& values, float position)
+{
+	DE_ASSERT(position >= 0.0f);
+	DE_ASSERT(position <= 1.0f);
+	DE_ASSERT(!values.empty());
+
+	const int	maxNdx				= (int)values.size() - 1;
+	const float	floatNdx			= (float)maxNdx * position;
+	const int	lowerNdx			= (int)deFloatFloor(floatNdx);
+	const int	higherNdx			= lowerNdx + (lowerNdx == maxNdx ? 0 : 1); // Use only last element if position is 1.0
+	const float	interpolationFactor = floatNdx - (float)lowerNdx;
+
+	DE_ASSERT(lowerNdx >= 0 && lowerNdx < (int)values.size());
+	DE_ASSERT(higherNdx >= 0 && higherNdx < (int)values.size());
+	DE_ASSERT(interpolationFactor >= 0 && interpolationFactor < 1.0f);
+
+	return (float)values[lowerNdx] + ((float)values[higherNdx] - (float)values[lowerNdx]) * interpolationFactor;
+}
+
+template<typename T>
+float medianAbsoluteDeviation (const std::vector<T>& data)
+{
+	const float			center		= median(data);
+	std::vector<float>	deviations	(data.size());
+
+	for (int ndx = 0; ndx < (int)data.size(); ndx++)
+		deviations[ndx] = deFloatAbs((float)data[ndx] - center);
+
+	return destructiveMedian(deviations);
+}
+
+struct LineParameters
+{
+	float offset;
+	float coefficient;
+
+	LineParameters (float offset_, float coefficient_) : offset(offset_), coefficient(coefficient_) {}
+};
+
+// Basic Theil-Sen linear estimate. Calculates median of all possible slope coefficients through two of the data points
+// and median of offsets corresponding with the median slope
+LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints);
+
+struct LineParametersWithConfidence
+{
+	float offset;
+	float offsetConfidenceUpper;
+	float offsetConfidenceLower;
+
+	float coefficient;
+	float coefficientConfidenceUpper;
+	float coefficientConfidenceLower;
+
+	float confidence;
+};
+
+// Median-of-medians version of Theil-Sen estimate. Calculates median of medians of slopes through a point and all other points.
+// Confidence interval is given as the range that contains the given fraction of all slopes/offsets
+LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence);
+
+struct ConfidenceInterval
+{
+	float	lower;
+	float	upper;
+	float	confidence;
+
+	ConfidenceInterval (void) : lower(0.0f), upper(0.0f), confidence(0.0f) {}
+};
+
+// Percentile bootstrap confidence interval of the median. Resampling is seeded so results are reproducible.
+ConfidenceInterval bootstrapMedianConfidenceInterval (const std::vector<float>& samples, float confidence, int numResamples, deUint32 seed);
+
+struct SampleStatistics
+{
+	int		numSamples;
+
+	double	minimum;
+	double	maximum;
+	double	mean;
+	double	median;
+	double	variance;
+	double	standardDeviation;
+	double	standardErrorOfMean;
+	double	medianAbsoluteDeviation;
+	double	min2Decile;
+	double	max9Decile;
+
+	SampleStatistics (void);
+};
+
+SampleStatistics calculateSampleStatistics (const std::vector<double>& samples);
+
+template<typename T>
+SampleStatistics calculateSampleStatistics (const std::vector<T>& samples)
+{
+	return calculateSampleStatistics(std::vector<double>(samples.begin(), samples.end()));
+}
+
+//! Find the number of leading samples that are outliers compared to the steady state formed by the later half of samples.
+int findWarmupLength (const std::vector<float>& samples);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Adaptive sampling controller
+ *
+ * Collects samples until the bootstrap confidence interval of the median
+ * of steady state samples is narrow enough relative to the median, or
+ * until the sample count limit is reached. Samples during which the
+ * system was still warming up are detected with findWarmupLength() and
+ * excluded from the result. Call tcu::warmupCPU() before sampling to
+ * shorten the warmup period.
+ *//*--------------------------------------------------------------------*/
+class AdaptiveSampler
+{
+public:
+	struct Parameters
+	{
+		int		minSamples;
+		int		maxSamples;
+		float	targetRelativeWidth;	//!< Target width of the confidence interval relative to median
+		float	confidence;
+
+		Parameters (int minSamples_ = 10, int maxSamples_ = 100, float targetRelativeWidth_ = 0.05f, float confidence_ = 0.95f)
+			: minSamples			(minSamples_)
+			, maxSamples			(maxSamples_)
+			, targetRelativeWidth	(targetRelativeWidth_)
+			, confidence			(confidence_)
+		{
+		}
+	};
+
+								AdaptiveSampler			(const Parameters& params = Parameters());
+
+	void						clear					(void);
+	void						addSample				(float sample);
+	bool						isDone					(void) const { return m_isDone;			}
+
+	const Parameters&			getParameters			(void) const { return m_params;			}
+	const std::vector<float>&	getSamples				(void) const { return m_samples;		}
+	int							getWarmupLength			(void) const { return m_warmupLength;	}
+	std::vector<float>			getSteadyStateSamples	(void) const;
+	float						getMedian				(void) const { return m_median;			}
+	ConfidenceInterval			getConfidenceInterval	(void) const { return m_interval;		}
+	bool						isTargetReached			(void) const { return m_targetReached;	}
+
+private:
+	void						update					(void);
+
+	Parameters					m_params;
+	std::vector<float>			m_samples;
+	int							m_warmupLength;
+	ConfidenceInterval			m_interval;
+	float						m_median;
+	bool						m_targetReached;
+	bool						m_isDone;
+};
+
+//! Write sample values as a sample list with a single response value
+void logSamples				(TestLog& log, const std::string& name, const std::string& description, const std::vector<float>& samples, const std::string& unit);
+
+//! Write statistics as a section of float values
+void logSampleStatistics	(TestLog& log, const std::string& name, const std::string& description, const SampleStatistics& stats, const std::string& unit);
+
+void PerfStatistics_selfTest (void);
+
+} // tcu
+
+#endif // _TCUPERFSTATISTICS_HPP
@@ -0,0 +1,354 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Lightweight scoped phase profiler.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuProfiler.hpp"
+#include "tcuTestLog.hpp"
+
+#include "deMutex.hpp"
+#include "deThreadLocal.hpp"
+#include "deStringUtil.hpp"
+#include "deAtomic.h"
+
+#include <algorithm>
+#include <map>
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+namespace profiler
+{
+namespace
+{
+
+enum
+{
+	RING_SIZE	= 4096	//!< Events per thread between two collect() calls, must be power of two.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Single-producer single-consumer event ring
+ *
+ * Only the owning thread calls push(). drain() and getNumDropped() are
+ * serialized by the registry lock. Counters increase monotonically and
+ * neither side takes a lock. Events pushed while the ring is full are
+ * dropped.
+ *//*--------------------------------------------------------------------*/
+class EventRing
+{
+public:
+							EventRing		(deUint32 threadId);
+
+	void					push			(const char* name, deUint64 startTime, deUint64 endTime);
+	void					drain			(vector<ProfileEvent>& dst);
+	int						getNumDropped	(void);
+
+private:
+	const deUint32			m_threadId;
+	vector<ProfileEvent>	m_events;
+	volatile deUint32		m_writeCount;			//!< Written by owning thread only.
+	volatile deUint32		m_readCount;			//!< Written by collector only.
+	volatile deUint32		m_numDropped;			//!< Written by owning thread only.
+	deUint32				m_numDroppedReported;	//!< Collector's copy of m_numDropped at last getNumDropped().
+};
+
+EventRing::EventRing (deUint32 threadId)
+	: m_threadId			(threadId)
+	, m_events				(RING_SIZE)
+	, m_writeCount			(0)
+	, m_readCount			(0)
+	, m_numDropped			(0)
+	, m_numDroppedReported	(0)
+{
+	DE_STATIC_ASSERT((RING_SIZE & (RING_SIZE-1)) == 0);
+}
+
+void EventRing::push (const char* name, deUint64 startTime, deUint64 endTime)
+{
+	const deUint32	writeCount	= m_writeCount;
+
+	if (writeCount - m_readCount >= (deUint32)RING_SIZE)
+	{
+		m_numDropped = m_numDropped + 1;
+		return;
+	}
+
+	{
+		ProfileEvent& event = m_events[writeCount % RING_SIZE];
+
+		event.name		= name;
+		event.startTime	= startTime;
+		event.endTime	= endTime;
+		event.threadId	= m_threadId;
+	}
+
+	// Publish event only after it has been fully written.
+	deMemoryReadWriteFence();
+	m_writeCount = writeCount + 1;
+}
+
+void EventRing::drain (vector<ProfileEvent>& dst)
+{
+	const deUint32	writeCount	= m_writeCount;
+
+	deMemoryReadWriteFence();
+
+	for (deUint32 count = m_readCount; count != writeCount; count++)
+		dst.push_back(m_events[count % RING_SIZE]);
+
+	// Release slots only after they have been read.
+	deMemoryReadWriteFence();
+	m_readCount = writeCount;
+}
+
+int EventRing::getNumDropped (void)
+{
+	const deUint32	numDropped	= m_numDropped;
+	const deUint32	numNew		= numDropped - m_numDroppedReported;
+
+	m_numDroppedReported = numDropped;
+	return (int)numNew;
+}
+
+// \note Rings are owned by the registry and live until program exit, so
+//		 events recorded by threads that have already finished are not lost.
+class RingRegistry
+{
+public:
+							~RingRegistry	(void);
+
+	EventRing&				getThreadRing	(void);
+	void					collect			(vector<ProfileEvent>& dst);
+	int						getNumDropped	(void);
+
+private:
+	de::Mutex				m_lock;
+	de::ThreadLocal			m_threadRing;
+	vector<EventRing*>		m_rings;
+};
+
+RingRegistry::~RingRegistry (void)
+{
+	for (size_t ndx = 0; ndx < m_rings.size(); ndx++)
+		delete m_rings[ndx];
+}
+
+EventRing& RingRegistry::getThreadRing (void)
+{
+	EventRing* ring = static_cast<EventRing*>(m_threadRing.get());
+
+	if (!ring)
+	{
+		const de::ScopedLock lock (m_lock);
+
+		ring = new EventRing((deUint32)m_rings.size());
+
+		try
+		{
+			m_rings.push_back(ring);
+		}
+		catch (...)
+		{
+			delete ring;
+			throw;
+		}
+
+		m_threadRing.set(ring);
+	}
+
+	return *ring;
+}
+
+void RingRegistry::collect (vector<ProfileEvent>& dst)
+{
+	const de::ScopedLock lock (m_lock);
+
+	for (size_t ndx = 0; ndx < m_rings.size(); ndx++)
+		m_rings[ndx]->drain(dst);
+}
+
+int RingRegistry::getNumDropped (void)
+{
+	const de::ScopedLock	lock		(m_lock);
+	int						numDropped	= 0;
+
+	for (size_t ndx = 0; ndx < m_rings.size(); ndx++)
+		numDropped += m_rings[ndx]->getNumDropped();
+
+	return numDropped;
+}
+
+bool compareStartTime (const ProfileEvent& a, const ProfileEvent& b)
+{
+	return a.startTime < b.startTime;
+}
+
+static volatile deInt32	s_isEnabled		= 0;
+static RingRegistry		s_registry;
+
+} // anonymous
+
+void setEnabled (bool enabled)
+{
+	s_isEnabled = enabled ? 1 : 0;
+}
+
+bool isEnabled (void)
+{
+	return s_isEnabled != 0;
+}
+
+void record (const char* name, deUint64 startTime, deUint64 endTime)
+{
+	s_registry.getThreadRing().push(name, startTime, endTime);
+}
+
+void collect (vector<ProfileEvent>& dst)
+{
+	const size_t firstNew = dst.size();
+
+	s_registry.collect(dst);
+	std::stable_sort(dst.begin() + firstNew, dst.end(), compareStartTime);
+}
+
+int getNumDropped (void)
+{
+	return s_registry.getNumDropped();
+}
+
+} // profiler
+
+// ProfileTraceWriter
+
+static string escapeJsonString (const char* str)
+{
+	string escaped;
+
+	for (const char* ptr = str; *ptr; ptr++)
+	{
+		const char c = *ptr;
+
+		if (c == '"' || c == '\\')
+		{
+			escaped += '\\';
+			escaped += c;
+		}
+		else if ((deUint8)c < 0x20)
+			escaped += ' ';
+		else
+			escaped += c;
+	}
+
+	return escaped;
+}
+
+ProfileTraceWriter::ProfileTraceWriter (const char* fileName)
+	: m_file	(fopen(fileName, "wb"))
+	, m_isFirst	(true)
+{
+	if (!m_file)
+		throw ResourceError(string("Failed to open trace file '") + fileName + "'");
+
+	fputs("[\n", m_file);
+}
+
+ProfileTraceWriter::~ProfileTraceWriter (void)
+{
+	fputs("\n]\n", m_file);
+	fclose(m_file);
+}
+
+void ProfileTraceWriter::writeEvent (const char* name, const char* category, deUint32 threadId, deUint64 startTime, deUint64 endTime)
+{
+	fprintf(m_file, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}",
+			m_isFirst ? "" : ",\n",
+			escapeJsonString(name).c_str(),
+			category,
+			threadId,
+			(unsigned long long)startTime,
+			(unsigned long long)(endTime - startTime));
+	m_isFirst = false;
+}
+
+void ProfileTraceWriter::writeCase (const string& casePath, deUint64 startTime, deUint64 endTime, const vector<ProfileEvent>& events)
+{
+	// \note Case is attributed to thread 0, the trace viewer groups it with events of that thread.
+	writeEvent(casePath.c_str(), "case", 0, startTime, endTime);
+
+	for (vector<ProfileEvent>::const_iterator event = events.begin(); event != events.end(); ++event)
+		writeEvent(event->name, "phase", event->threadId, event->startTime, event->endTime);
+
+	fflush(m_file);
+}
+
+namespace
+{
+
+struct PhaseStats
+{
+	deUint64	totalTime;
+	int			count;
+
+	PhaseStats (void) : totalTime(0), count(0) {}
+};
+
+} // anonymous
+
+void logProfileSummary (TestLog& log, const vector<ProfileEvent>& events, int numDropped)
+{
+	vector<string>					phaseOrder;
+	std::map<string, PhaseStats>	phases;
+
+	for (vector<ProfileEvent>::const_iterator event = events.begin(); event != events.end(); ++event)
+	{
+		const string	name	= event->name;
+		PhaseStats&		stats	= phases[name];
+
+		if (stats.count == 0)
+			phaseOrder.push_back(name);
+
+		stats.totalTime	+= event->endTime - event->startTime;
+		stats.count		+= 1;
+	}
+
+	if (phaseOrder.empty() && numDropped == 0)
+		return;
+
+	{
+		const ScopedLogSection section (log, "PhaseProfile", "Per-phase inclusive timing");
+
+		for (vector<string>::const_iterator name = phaseOrder.begin(); name != phaseOrder.end(); ++name)
+		{
+			const PhaseStats& stats = phases[*name];
+
+			log << TestLog::Integer(*name, "Total time in " + *name + " (" + de::toString(stats.count) + " calls)", "us", QP_KEY_TAG_TIME, (deInt64)stats.totalTime);
+		}
+
+		if (numDropped > 0)
+			log << TestLog::Integer("DroppedProfileEvents", "Profile events lost due to ring overflow", "", QP_KEY_TAG_NONE, numDropped);
+	}
+}
+
+} // tcu
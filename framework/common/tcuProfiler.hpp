@@ -0,0 +1,133 @@
+#ifndef _TCUPROFILER_HPP
+#define _TCUPROFILER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Lightweight scoped phase profiler.
+ *
+ * Profiling is always compiled in but disabled by default. When disabled
+ * a ProfileScope costs a single flag check. When enabled, each finished
+ * scope is recorded into a fixed-size ring owned by the calling thread.
+ * Test session executor drains the rings at the end of each case, logs
+ * a per-phase summary and optionally writes the events into a trace file
+ * in Chrome trace-event JSON format (loadable in chrome://tracing and
+ * Perfetto).
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deClock.h"
+
+#include <string>
+#include <vector>
+#include <cstdio>
+
+namespace tcu
+{
+
+class TestLog;
+
+struct ProfileEvent
+{
+	const char*		name;		//!< Phase name, must have static storage duration.
+	deUint64		startTime;	//!< Start time in microseconds (deGetMicroseconds()).
+	deUint64		endTime;	//!< End time in microseconds.
+	deUint32		threadId;	//!< Profiler-assigned thread index.
+
+	ProfileEvent (void) : name(DE_NULL), startTime(0), endTime(0), threadId(0) {}
+};
+
+namespace profiler
+{
+
+void	setEnabled		(bool enabled);
+bool	isEnabled		(void);
+
+//! Record finished phase into current thread's event ring.
+void	record			(const char* name, deUint64 startTime, deUint64 endTime);
+
+//! Move all recorded events from all threads to dst, ordered by start time.
+void	collect			(std::vector<ProfileEvent>& dst);
+
+//! Get number of events dropped due to full ring since the last call.
+int		getNumDropped	(void);
+
+} // profiler
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Scoped phase timer
+ *
+ * Records the time spent between construction and destruction under
+ * given name if profiling is enabled. Name must be a string literal
+ * or otherwise outlive the profiler.
+ *//*--------------------------------------------------------------------*/
+class ProfileScope
+{
+public:
+	explicit		ProfileScope	(const char* name)
+						: m_name		(name)
+						, m_startTime	(profiler::isEnabled() ? deGetMicroseconds() : 0)
+					{
+					}
+
+					~ProfileScope	(void)
+					{
+						if (m_startTime != 0)
+							profiler::record(m_name, m_startTime, deGetMicroseconds());
+					}
+
+private:
+					ProfileScope	(const ProfileScope&);	// not allowed!
+	ProfileScope&	operator=		(const ProfileScope&);	// not allowed!
+
+	const char*		m_name;
+	const deUint64	m_startTime;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Chrome trace-event JSON writer
+ *
+ * Uses the JSON array format. The closing bracket is written on
+ * destruction but is optional for trace viewers, so a trace from
+ * a crashed run remains loadable.
+ *//*--------------------------------------------------------------------*/
+class ProfileTraceWriter
+{
+public:
+								ProfileTraceWriter	(const char* fileName);
+								~ProfileTraceWriter	(void);
+
+	void						writeCase			(const std::string& casePath, deUint64 startTime, deUint64 endTime, const std::vector<ProfileEvent>& events);
+
+private:
+								ProfileTraceWriter	(const ProfileTraceWriter&);	// not allowed!
+	ProfileTraceWriter&			operator=			(const ProfileTraceWriter&);	// not allowed!
+
+	void						writeEvent			(const char* name, const char* category, deUint32 threadId, deUint64 startTime, deUint64 endTime);
+
+	FILE*						m_file;
+	bool						m_isFirst;
+};
+
+//! Write per-phase summary (total inclusive time and call count per name) into the log.
+void logProfileSummary (TestLog& log, const std::vector<ProfileEvent>& events, int numDropped);
+
+} // tcu
+
+#endif // _TCUPROFILER_HPP
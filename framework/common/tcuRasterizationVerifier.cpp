@@ -29,10 +29,15 @@
 #include "tcuVectorUtil.hpp"
 #include "tcuFloat.hpp"
 #include "deMath.h"
+#include "deAtomic.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+#include "deRandom.hpp"
 
 #include "rrRasterizer.hpp"
 
 #include <limits>
+#include <vector>
 
 namespace tcu
 {
@@ -2088,6 +2093,330 @@ bool verifySinglesampleWideLineGroupInterpolation (const tcu::Surface& surface,
 	}
 }
 
+enum
+{
+	COVERAGE_TILE_SIZE				= 16,	//!< Size of tiles triangles are binned to, in pixels.
+	MIN_COVERAGE_ROWS_PER_THREAD	= 32	//!< Don't spawn threads for smaller images.
+};
+
+//! Bin inclusive pixel rectangles (x0, y0, x1, y1) to tiles. Items of each tile are listed in ascending order. Empty rectangles are skipped.
+void binToTiles (const std::vector<tcu::IVec4>& rects, const tcu::IVec2& numTiles, std::vector<int>& tileStart, std::vector<int>& tileItems)
+{
+	tileStart.assign(numTiles.x() * numTiles.y() + 1, 0);
+
+	for (size_t itemNdx = 0; itemNdx < rects.size(); ++itemNdx)
+	{
+		const tcu::IVec4& rect = rects[itemNdx];
+
+		if (rect.x() > rect.z() || rect.y() > rect.w())
+			continue;
+
+		for (int tileY = rect.y() / COVERAGE_TILE_SIZE; tileY <= rect.w() / COVERAGE_TILE_SIZE; ++tileY)
+		for (int tileX = rect.x() / COVERAGE_TILE_SIZE; tileX <= rect.z() / COVERAGE_TILE_SIZE; ++tileX)
+			tileStart[tileY * numTiles.x() + tileX + 1] += 1;
+	}
+
+	for (size_t tileNdx = 0; tileNdx + 1 < tileStart.size(); ++tileNdx)
+		tileStart[tileNdx + 1] += tileStart[tileNdx];
+
+	tileItems.resize(tileStart.back());
+
+	{
+		std::vector<int> tilePos (tileStart.begin(), tileStart.end() - 1);
+
+		for (size_t itemNdx = 0; itemNdx < rects.size(); ++itemNdx)
+		{
+			const tcu::IVec4& rect = rects[itemNdx];
+
+			if (rect.x() > rect.z() || rect.y() > rect.w())
+				continue;
+
+			for (int tileY = rect.y() / COVERAGE_TILE_SIZE; tileY <= rect.w() / COVERAGE_TILE_SIZE; ++tileY)
+			for (int tileX = rect.x() / COVERAGE_TILE_SIZE; tileX <= rect.z() / COVERAGE_TILE_SIZE; ++tileX)
+				tileItems[tilePos[tileY * numTiles.x() + tileX]++] = (int)itemNdx;
+		}
+	}
+}
+
+//! Get pixel rectangle outside of which pixelOnlyOnASharedEdge() is always false for the triangle.
+tcu::IVec4 getSharedEdgeRect (const TriangleSceneSpec::SceneTriangle& triangle, const tcu::IVec2& viewportSize)
+{
+	const tcu::IVec4 emptyRect	(0, 0, -1, -1);
+	const tcu::IVec4 fullRect	(0, 0, viewportSize.x() - 1, viewportSize.y() - 1);
+
+	if (!triangle.sharedEdge[0] && !triangle.sharedEdge[1] && !triangle.sharedEdge[2])
+		return emptyRect;
+
+	{
+		const tcu::Vec2 triangleNormalizedDeviceSpace[3] =
+		{
+			tcu::Vec2(triangle.positions[0].x() / triangle.positions[0].w(), triangle.positions[0].y() / triangle.positions[0].w()),
+			tcu::Vec2(triangle.positions[1].x() / triangle.positions[1].w(), triangle.positions[1].y() / triangle.positions[1].w()),
+			tcu::Vec2(triangle.positions[2].x() / triangle.positions[2].w(), triangle.positions[2].y() / triangle.positions[2].w()),
+		};
+		const tcu::Vec2 triangleScreenSpace[3] =
+		{
+			(triangleNormalizedDeviceSpace[0] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
+			(triangleNormalizedDeviceSpace[1] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
+			(triangleNormalizedDeviceSpace[2] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
+		};
+		float maxMagnitude = (float)de::max(viewportSize.x(), viewportSize.y());
+
+		for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+		for (int compNdx = 0; compNdx < 2; ++compNdx)
+		{
+			const float value = triangleScreenSpace[vtxNdx][compNdx];
+
+			// NaN coordinates may match anywhere
+			if (deFloatIsNaN(value) || deFloatIsInf(value))
+				return fullRect;
+
+			maxMagnitude = de::max(maxMagnitude, de::abs(value));
+		}
+
+		{
+			// pixelNearLineSegment() accepts pixel centers up to 2 * 1.414 pixels past edge end points. Margin covers
+			// that, the pixel center offset and rounding errors, which grow with coordinate magnitude.
+			const float margin	= 4.0f + 1e-5f * maxMagnitude;
+			const float x0		= deFloatFloor(de::min(de::min(triangleScreenSpace[0].x(), triangleScreenSpace[1].x()), triangleScreenSpace[2].x()) - margin);
+			const float y0		= deFloatFloor(de::min(de::min(triangleScreenSpace[0].y(), triangleScreenSpace[1].y()), triangleScreenSpace[2].y()) - margin);
+			const float x1		= deFloatCeil (de::max(de::max(triangleScreenSpace[0].x(), triangleScreenSpace[1].x()), triangleScreenSpace[2].x()) + margin);
+			const float y1		= deFloatCeil (de::max(de::max(triangleScreenSpace[0].y(), triangleScreenSpace[1].y()), triangleScreenSpace[2].y()) + margin);
+
+			if (x1 < 0.0f || y1 < 0.0f || x0 > (float)(viewportSize.x() - 1) || y0 > (float)(viewportSize.y() - 1))
+				return emptyRect;
+
+			return tcu::IVec4((int)de::max(x0, 0.0f),
+							  (int)de::max(y0, 0.0f),
+							  (int)de::min(x1, (float)(viewportSize.x() - 1)),
+							  (int)de::min(y1, (float)(viewportSize.y() - 1)));
+		}
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Generates triangle scene coverage map
+ *
+ * Triangles are binned to tiles by their bounding boxes, and each pixel
+ * is tested only against the triangles of its tile. Triangles with shared
+ * edges are binned separately by their edge neighborhoods for finding
+ * friend triangles.
+ *
+ * Pixel coverage is the strongest coverage given by any triangle, so the
+ * result does not depend on the order triangles are tested in. Rows are
+ * independent and can be processed in multiple threads.
+ *//*--------------------------------------------------------------------*/
+class TriangleCoverageMapGenerator
+{
+public:
+	TriangleCoverageMapGenerator (const TriangleSceneSpec& scene, const tcu::PixelBufferAccess& coverageMap, int subpixelBits, bool multisample)
+		: m_scene			(scene)
+		, m_coverageMap		(coverageMap)
+		, m_viewportSize	(coverageMap.getWidth(), coverageMap.getHeight())
+		, m_subpixelBits	(subpixelBits)
+		, m_multisample		(multisample)
+		, m_numTiles		((coverageMap.getWidth() + COVERAGE_TILE_SIZE - 1) / COVERAGE_TILE_SIZE, (coverageMap.getHeight() + COVERAGE_TILE_SIZE - 1) / COVERAGE_TILE_SIZE)
+		, m_aabbs			(scene.triangles.size())
+		, m_nextRow			(0)
+	{
+		std::vector<tcu::IVec4>	coverageRects	(scene.triangles.size());
+		std::vector<tcu::IVec4>	edgeRects		(scene.triangles.size());
+
+		for (size_t triNdx = 0; triNdx < scene.triangles.size(); ++triNdx)
+		{
+			const tcu::IVec4& aabb = m_aabbs[triNdx] = getTriangleAABB(scene.triangles[triNdx], m_viewportSize);
+
+			coverageRects[triNdx]	= tcu::IVec4(de::max(0, aabb.x()), de::max(0, aabb.y()), de::min(aabb.z(), m_viewportSize.x() - 1), de::min(aabb.w(), m_viewportSize.y() - 1));
+			edgeRects[triNdx]		= getSharedEdgeRect(scene.triangles[triNdx], m_viewportSize);
+		}
+
+		binToTiles(coverageRects, m_numTiles, m_tileStart, m_tileTriangles);
+		binToTiles(edgeRects, m_numTiles, m_edgeTileStart, m_edgeTileTriangles);
+	}
+
+	//! Generate rows until all rows have been claimed. Called from all threads.
+	void processRows (void)
+	{
+		for (;;)
+		{
+			const int y = (int)deAtomicIncrementInt32(&m_nextRow) - 1;
+
+			if (y >= m_viewportSize.y())
+				break;
+
+			for (int x = 0; x < m_viewportSize.x(); ++x)
+				m_coverageMap.setPixel(tcu::IVec4(getPixelCoverage(tcu::IVec2(x, y)), 0, 0, 0), x, y);
+		}
+	}
+
+private:
+	CoverageType getPixelCoverage (const tcu::IVec2& pixel) const
+	{
+		const int		tileNdx		= (pixel.y() / COVERAGE_TILE_SIZE) * m_numTiles.x() + pixel.x() / COVERAGE_TILE_SIZE;
+		CoverageType	coverage	= COVERAGE_NONE;
+
+		for (int ndx = m_tileStart[tileNdx]; ndx < m_tileStart[tileNdx + 1]; ++ndx)
+		{
+			const int									triNdx		= m_tileTriangles[ndx];
+			const TriangleSceneSpec::SceneTriangle&		triangle	= m_scene.triangles[triNdx];
+			const tcu::IVec4&							aabb		= m_aabbs[triNdx];
+
+			if (pixel.x() < aabb.x() || pixel.x() > aabb.z() || pixel.y() < aabb.y() || pixel.y() > aabb.w())
+				continue;
+
+			{
+				const CoverageType triangleCoverage = calculateTriangleCoverage(triangle.positions[0],
+																				triangle.positions[1],
+																				triangle.positions[2],
+																				pixel,
+																				m_viewportSize,
+																				m_subpixelBits,
+																				m_multisample);
+
+				if (triangleCoverage == COVERAGE_FULL)
+					return COVERAGE_FULL;
+				else if (triangleCoverage == COVERAGE_PARTIAL)
+				{
+					// Sharing an edge with another triangle?
+					// There should always be such a triangle, but the pixel in the other triangle might be
+					// on multiple edges, some of which are not shared. In these cases the coverage cannot be determined.
+					// Assume full coverage if the pixel is only on a shared edge in shared triangle too.
+					if (pixelOnlyOnASharedEdge(pixel, triangle, m_viewportSize) && hasFriendTriangle(triNdx, pixel, tileNdx))
+						return COVERAGE_FULL;
+
+					coverage = COVERAGE_PARTIAL;
+				}
+			}
+		}
+
+		return coverage;
+	}
+
+	bool hasFriendTriangle (int triNdx, const tcu::IVec2& pixel, int tileNdx) const
+	{
+		for (int ndx = m_edgeTileStart[tileNdx]; ndx < m_edgeTileStart[tileNdx + 1]; ++ndx)
+		{
+			const int friendTriNdx = m_edgeTileTriangles[ndx];
+
+			if (friendTriNdx != triNdx && pixelOnlyOnASharedEdge(pixel, m_scene.triangles[friendTriNdx], m_viewportSize))
+				return true;
+		}
+
+		return false;
+	}
+
+	const TriangleSceneSpec&		m_scene;
+	const tcu::PixelBufferAccess	m_coverageMap;
+	const tcu::IVec2				m_viewportSize;
+	const int						m_subpixelBits;
+	const bool						m_multisample;
+	const tcu::IVec2				m_numTiles;
+
+	std::vector<tcu::IVec4>			m_aabbs;
+	std::vector<int>				m_tileStart;			//!< First index in m_tileTriangles for each tile.
+	std::vector<int>				m_tileTriangles;		//!< Triangles with bounding box overlapping the tile.
+	std::vector<int>				m_edgeTileStart;		//!< First index in m_edgeTileTriangles for each tile.
+	std::vector<int>				m_edgeTileTriangles;	//!< Triangles with shared edges near the tile.
+	volatile deInt32				m_nextRow;
+};
+
+class TriangleCoverageMapThread : public de::Thread
+{
+public:
+	TriangleCoverageMapThread (TriangleCoverageMapGenerator& generator)
+		: m_generator(generator)
+	{
+	}
+
+	void run (void)
+	{
+		m_generator.processRows();
+	}
+
+private:
+	TriangleCoverageMapGenerator&	m_generator;
+};
+
+//! Generate coverage map using numThreads threads, including the calling thread.
+void generateTriangleCoverageMap (const TriangleSceneSpec& scene, const tcu::PixelBufferAccess& coverageMap, int subpixelBits, bool multisample, int numThreads)
+{
+	TriangleCoverageMapGenerator							generator	(scene, coverageMap, subpixelBits, multisample);
+	std::vector<de::SharedPtr<TriangleCoverageMapThread> >	threads;
+
+	// Calling thread generates rows as well.
+	try
+	{
+		for (int threadNdx = 1; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<TriangleCoverageMapThread>(new TriangleCoverageMapThread(generator)));
+			threads.back()->start();
+		}
+
+		generator.processRows();
+	}
+	catch (...)
+	{
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		{
+			if (threads[threadNdx]->isStarted())
+				threads[threadNdx]->join();
+		}
+		throw;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		threads[threadNdx]->join();
+}
+
+//! Generate coverage map by testing every triangle against every pixel of its bounding box. Reference for generateTriangleCoverageMap().
+void generateTriangleCoverageMapBruteForce (const TriangleSceneSpec& scene, const tcu::PixelBufferAccess& coverageMap, int subpixelBits, bool multisample)
+{
+	const tcu::IVec2 viewportSize (coverageMap.getWidth(), coverageMap.getHeight());
+
+	tcu::clear(coverageMap, tcu::IVec4(COVERAGE_NONE, 0, 0, 0));
+
+	for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+	{
+		const tcu::IVec4 aabb = getTriangleAABB(scene.triangles[triNdx], viewportSize);
+
+		for (int y = de::max(0, aabb.y()); y <= de::min(aabb.w(), coverageMap.getHeight() - 1); ++y)
+		for (int x = de::max(0, aabb.x()); x <= de::min(aabb.z(), coverageMap.getWidth() - 1); ++x)
+		{
+			if (coverageMap.getPixelUint(x, y).x() == COVERAGE_FULL)
+				continue;
+
+			const CoverageType coverage = calculateTriangleCoverage(scene.triangles[triNdx].positions[0],
+																	scene.triangles[triNdx].positions[1],
+																	scene.triangles[triNdx].positions[2],
+																	tcu::IVec2(x, y),
+																	viewportSize,
+																	subpixelBits,
+																	multisample);
+
+			if (coverage == COVERAGE_FULL)
+				coverageMap.setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
+			else if (coverage == COVERAGE_PARTIAL)
+			{
+				CoverageType resultCoverage = COVERAGE_PARTIAL;
+
+				if (pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[triNdx], viewportSize))
+				{
+					for (int friendTriNdx = 0; friendTriNdx < (int)scene.triangles.size(); ++friendTriNdx)
+					{
+						if (friendTriNdx != triNdx && pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[friendTriNdx], viewportSize))
+						{
+							resultCoverage = COVERAGE_FULL;
+							break;
+						}
+					}
+				}
+
+				coverageMap.setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
+			}
+		}
+	}
+}
+
 } // anonymous
 
 CoverageType calculateTriangleCoverage (const tcu::Vec4& p0, const tcu::Vec4& p1, const tcu::Vec4& p2, const tcu::IVec2& pixel, const tcu::IVec2& viewportSize, int subpixelBits, bool multisample)
@@ -2246,7 +2575,6 @@ bool verifyTriangleGroupRasterization (const tcu::Surface& surface, const Triang
 	const tcu::RGBA		primitivePixelColor			= tcu::RGBA(30, 30, 30, 255);
 	const int			weakVerificationThreshold	= 10;
 	const bool			multisampled				= (args.numSamples != 0);
-	const tcu::IVec2	viewportSize				= tcu::IVec2(surface.getWidth(), surface.getHeight());
 	int					missingPixels				= 0;
 	int					unexpectedPixels			= 0;
 	int					subPixelBits				= args.subpixelBits;
@@ -2269,58 +2597,7 @@ bool verifyTriangleGroupRasterization (const tcu::Surface& surface, const Triang
 
 	// generate coverage map
 
-	tcu::clear(coverageMap.getAccess(), tcu::IVec4(COVERAGE_NONE, 0, 0, 0));
-
-	for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
-	{
-		const tcu::IVec4 aabb = getTriangleAABB(scene.triangles[triNdx], viewportSize);
-
-		for (int y = de::max(0, aabb.y()); y <= de::min(aabb.w(), coverageMap.getHeight() - 1); ++y)
-		for (int x = de::max(0, aabb.x()); x <= de::min(aabb.z(), coverageMap.getWidth() - 1); ++x)
-		{
-			if (coverageMap.getAccess().getPixelUint(x, y).x() == COVERAGE_FULL)
-				continue;
-
-			const CoverageType coverage = calculateTriangleCoverage(scene.triangles[triNdx].positions[0],
-																	scene.triangles[triNdx].positions[1],
-																	scene.triangles[triNdx].positions[2],
-																	tcu::IVec2(x, y),
-																	viewportSize,
-																	subPixelBits,
-																	multisampled);
-
-			if (coverage == COVERAGE_FULL)
-			{
-				coverageMap.getAccess().setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
-			}
-			else if (coverage == COVERAGE_PARTIAL)
-			{
-				CoverageType resultCoverage = COVERAGE_PARTIAL;
-
-				// Sharing an edge with another triangle?
-				// There should always be such a triangle, but the pixel in the other triangle might be
-				// on multiple edges, some of which are not shared. In these cases the coverage cannot be determined.
-				// Assume full coverage if the pixel is only on a shared edge in shared triangle too.
-				if (pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[triNdx], viewportSize))
-				{
-					bool friendFound = false;
-					for (int friendTriNdx = 0; friendTriNdx < (int)scene.triangles.size(); ++friendTriNdx)
-					{
-						if (friendTriNdx != triNdx && pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[friendTriNdx], viewportSize))
-						{
-							friendFound = true;
-							break;
-						}
-					}
-
-					if (friendFound)
-						resultCoverage = COVERAGE_FULL;
-				}
-
-				coverageMap.getAccess().setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
-			}
-		}
-	}
+	generateTriangleCoverageMap(scene, coverageMap.getAccess(), subPixelBits, multisampled, de::min((int)deGetNumAvailableLogicalCores(), surface.getHeight() / MIN_COVERAGE_ROWS_PER_THREAD));
 
 	// check pixels
 
@@ -2463,4 +2740,153 @@ bool verifyTriangulatedLineGroupInterpolation (const tcu::Surface& surface, cons
 	return verifyMultisampleLineGroupInterpolation(surface, scene, args, log);
 }
 
+namespace
+{
+
+TriangleSceneSpec::SceneTriangle makeSceneTriangle (const tcu::Vec4& p0, const tcu::Vec4& p1, const tcu::Vec4& p2, bool shared0, bool shared1, bool shared2)
+{
+	TriangleSceneSpec::SceneTriangle triangle;
+
+	triangle.positions[0]	= p0;
+	triangle.positions[1]	= p1;
+	triangle.positions[2]	= p2;
+	triangle.sharedEdge[0]	= shared0;
+	triangle.sharedEdge[1]	= shared1;
+	triangle.sharedEdge[2]	= shared2;
+
+	for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+		triangle.colors[vtxNdx] = tcu::Vec4(1.0f);
+
+	return triangle;
+}
+
+tcu::Vec4 randomPosition (de::Random& rnd, float range)
+{
+	const float w = rnd.getFloat(0.5f, 2.0f);
+
+	return tcu::Vec4(rnd.getFloat(-range, range) * w, rnd.getFloat(-range, range) * w, 0.0f, w);
+}
+
+//! Independent triangles with random shared edge flags.
+void addRandomTriangles (TriangleSceneSpec& scene, de::Random& rnd, int numTriangles)
+{
+	for (int triNdx = 0; triNdx < numTriangles; ++triNdx)
+		scene.triangles.push_back(makeSceneTriangle(randomPosition(rnd, 1.5f), randomPosition(rnd, 1.5f), randomPosition(rnd, 1.5f), rnd.getBool(), rnd.getBool(), rnd.getBool()));
+}
+
+//! Jittered grid of quads split to triangle pairs. Internal edges are shared.
+void addTriangleGrid (TriangleSceneSpec& scene, de::Random& rnd, int gridSize)
+{
+	std::vector<tcu::Vec4> vertices;
+
+	for (int y = 0; y <= gridSize; ++y)
+	for (int x = 0; x <= gridSize; ++x)
+	{
+		const float jitter	= 0.3f / (float)gridSize;
+		const float w		= rnd.getFloat(0.5f, 2.0f);
+		const float px		= -0.9f + 1.8f * (float)x / (float)gridSize + rnd.getFloat(-jitter, jitter);
+		const float py		= -0.9f + 1.8f * (float)y / (float)gridSize + rnd.getFloat(-jitter, jitter);
+
+		vertices.push_back(tcu::Vec4(px * w, py * w, 0.0f, w));
+	}
+
+	for (int y = 0; y < gridSize; ++y)
+	for (int x = 0; x < gridSize; ++x)
+	{
+		const tcu::Vec4&	v00	= vertices[(y + 0) * (gridSize + 1) + x + 0];
+		const tcu::Vec4&	v10	= vertices[(y + 0) * (gridSize + 1) + x + 1];
+		const tcu::Vec4&	v01	= vertices[(y + 1) * (gridSize + 1) + x + 0];
+		const tcu::Vec4&	v11	= vertices[(y + 1) * (gridSize + 1) + x + 1];
+
+		scene.triangles.push_back(makeSceneTriangle(v00, v10, v11, y > 0, x + 1 < gridSize, true));
+		scene.triangles.push_back(makeSceneTriangle(v00, v11, v01, true, y + 1 < gridSize, x > 0));
+	}
+}
+
+//! Triangle fan around a random center. All edges between fan triangles are shared.
+void addTriangleFan (TriangleSceneSpec& scene, de::Random& rnd, int numTriangles)
+{
+	const tcu::Vec4	center	= randomPosition(rnd, 0.5f);
+	const float		radius	= rnd.getFloat(0.2f, 1.5f);
+
+	for (int triNdx = 0; triNdx < numTriangles; ++triNdx)
+	{
+		const float		angle0	= 2.0f * DE_PI * (float)(triNdx + 0) / (float)numTriangles;
+		const float		angle1	= 2.0f * DE_PI * (float)(triNdx + 1) / (float)numTriangles;
+		const tcu::Vec4	p0		= tcu::Vec4(center.x() + radius * deFloatCos(angle0) * center.w(), center.y() + radius * deFloatSin(angle0) * center.w(), 0.0f, center.w());
+		const tcu::Vec4	p1		= tcu::Vec4(center.x() + radius * deFloatCos(angle1) * center.w(), center.y() + radius * deFloatSin(angle1) * center.w(), 0.0f, center.w());
+
+		scene.triangles.push_back(makeSceneTriangle(center, p0, p1, true, false, true));
+	}
+}
+
+//! Replace random coordinates with non-finite or huge values.
+void addNonFiniteCoordinates (TriangleSceneSpec& scene, de::Random& rnd, int numValues)
+{
+	const float values[] =
+	{
+		std::numeric_limits<float>::quiet_NaN(),
+		std::numeric_limits<float>::infinity(),
+		-std::numeric_limits<float>::infinity(),
+		1.0e6f,
+		-1.0e6f,
+	};
+
+	if (scene.triangles.empty())
+		return;
+
+	for (int valueNdx = 0; valueNdx < numValues; ++valueNdx)
+	{
+		TriangleSceneSpec::SceneTriangle& triangle = scene.triangles[rnd.getInt(0, (int)scene.triangles.size() - 1)];
+
+		triangle.positions[rnd.getInt(0, 2)][rnd.getInt(0, 1)] = rnd.choose<float>(DE_ARRAY_BEGIN(values), DE_ARRAY_END(values));
+	}
+}
+
+} // anonymous
+
+void RasterizationVerifier_selfTest (void)
+{
+	const tcu::IVec2 viewportSizes[] =
+	{
+		tcu::IVec2(1, 1),
+		tcu::IVec2(17, 5),
+		tcu::IVec2(64, 64),
+		tcu::IVec2(97, 41),
+	};
+	const int	subpixelBitCounts[]	= { 0, 4, 8 };
+	const int	numScenes			= 12;
+	de::Random	rnd					(0x6e1c5a37);
+
+	for (int sceneNdx = 0; sceneNdx < numScenes; ++sceneNdx)
+	{
+		TriangleSceneSpec scene;
+
+		addRandomTriangles(scene, rnd, rnd.getInt(0, 8));
+		addTriangleGrid(scene, rnd, rnd.getInt(1, 5));
+		addTriangleFan(scene, rnd, rnd.getInt(3, 12));
+
+		if (sceneNdx % 3 == 2)
+			addNonFiniteCoordinates(scene, rnd, rnd.getInt(1, 3));
+
+		for (int viewportNdx = 0; viewportNdx < DE_LENGTH_OF_ARRAY(viewportSizes); ++viewportNdx)
+		{
+			const tcu::IVec2			viewportSize	= viewportSizes[viewportNdx];
+			const tcu::TextureFormat	format			(tcu::TextureFormat::R, tcu::TextureFormat::UNSIGNED_INT8);
+			const int					subpixelBits	= rnd.choose<int>(DE_ARRAY_BEGIN(subpixelBitCounts), DE_ARRAY_END(subpixelBitCounts));
+			const bool					multisample		= rnd.getBool();
+			const int					numThreads		= rnd.getInt(1, 3);
+			tcu::TextureLevel			reference		(format, viewportSize.x(), viewportSize.y());
+			tcu::TextureLevel			result			(format, viewportSize.x(), viewportSize.y());
+
+			generateTriangleCoverageMapBruteForce(scene, reference.getAccess(), subpixelBits, multisample);
+			generateTriangleCoverageMap(scene, result.getAccess(), subpixelBits, multisample, numThreads);
+
+			for (int y = 0; y < viewportSize.y(); ++y)
+			for (int x = 0; x < viewportSize.x(); ++x)
+				TCU_CHECK(result.getAccess().getPixelUint(x, y).x() == reference.getAccess().getPixelUint(x, y).x());
+		}
+	}
+}
+
 } // tcu
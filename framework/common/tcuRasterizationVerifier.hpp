@@ -190,6 +190,8 @@ LineInterpolationMethod verifyLineGroupInterpolation (const tcu::Surface& surfac
  *//*--------------------------------------------------------------------*/
 bool verifyTriangulatedLineGroupInterpolation (const tcu::Surface& surface, const LineSceneSpec& scene, const RasterizationArguments& args, tcu::TestLog& log);
 
+void RasterizationVerifier_selfTest (void);
+
 } // tcu
 
 #endif // _TCURASTERIZATIONVERIFIER_HPP
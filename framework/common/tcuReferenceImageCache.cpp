@@ -0,0 +1,254 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief On-disk cache for reference images.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuReferenceImageCache.hpp"
+#include "tcuTextureUtil.hpp"
+#include "deFilePath.hpp"
+#include "deFile.h"
+#include "deMemory.h"
+#include "qpInfo.h"
+
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <cstdio>
+
+namespace tcu
+{
+
+namespace
+{
+
+enum
+{
+	ENTRY_VERSION		= 1,
+	ENTRY_DATA_ALIGN	= 16
+};
+
+static const deUint8 s_entryMagic[8] = { 'd', 'E', 'Q', 'P', 'R', 'E', 'F', 'C' };
+
+// Entry file consists of header, key string and pixel data in packed layout.
+struct EntryHeader
+{
+	deUint8		magic[8];
+	deUint32	version;
+	deUint32	paramHash;
+	deInt32		width;
+	deInt32		height;
+	deInt32		depth;
+	deUint32	channelOrder;
+	deUint32	channelType;
+	deUint32	keyLength;
+	deUint32	dataOffset;
+	deUint32	dataSize;
+};
+
+// Case path and framework release identify the entry together with header fields
+std::string getEntryKey (const std::string& casePath)
+{
+	std::ostringstream str;
+	str << casePath << "\n" << qpGetReleaseName() << "\n" << qpGetReleaseId();
+	return str.str();
+}
+
+EntryHeader makeEntryHeader (const std::string& key, deUint32 paramHash, const TextureFormat& format, const IVec3& size)
+{
+	EntryHeader header;
+
+	deMemset(&header, 0, sizeof(header));
+	deMemcpy(header.magic, s_entryMagic, sizeof(s_entryMagic));
+
+	header.version		= ENTRY_VERSION;
+	header.paramHash	= paramHash;
+	header.width		= size.x();
+	header.height		= size.y();
+	header.depth		= size.z();
+	header.channelOrder	= (deUint32)format.order;
+	header.channelType	= (deUint32)format.type;
+	header.keyLength	= (deUint32)key.size();
+	header.dataOffset	= (deUint32)deAlign32((deInt32)(sizeof(EntryHeader) + key.size()), ENTRY_DATA_ALIGN);
+	header.dataSize		= (deUint32)(getPixelSize(format) * size.x() * size.y() * size.z());
+
+	return header;
+}
+
+// 64-bit FNV-1a
+deUint64 hashBytes (deUint64 hash, const void* data, size_t size)
+{
+	const deUint8* const bytes = (const deUint8*)data;
+
+	for (size_t ndx = 0; ndx < size; ndx++)
+	{
+		hash ^= (deUint64)bytes[ndx];
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+class EntryFile
+{
+public:
+	EntryFile (const char* path, deUint32 mode)
+		: m_file(deFile_create(path, mode))
+	{
+	}
+
+	~EntryFile (void)
+	{
+		if (m_file)
+			deFile_destroy(m_file);
+	}
+
+	deFile*	get (void) const { return m_file; }
+
+private:
+	EntryFile				(const EntryFile&);
+	EntryFile& operator=	(const EntryFile&);
+
+	deFile*	m_file;
+};
+
+class EntryMapping
+{
+public:
+	EntryMapping (const deFile* file)
+		: m_mapping(deFileMapping_create(file))
+	{
+	}
+
+	~EntryMapping (void)
+	{
+		if (m_mapping)
+			deFileMapping_destroy(m_mapping);
+	}
+
+	const deUint8*	getPtr	(void) const { return (const deUint8*)deFileMapping_getPtr(m_mapping);	}
+	deInt64			getSize	(void) const { return deFileMapping_getSize(m_mapping);					}
+	bool			isValid	(void) const { return m_mapping != DE_NULL;								}
+
+private:
+	EntryMapping				(const EntryMapping&);
+	EntryMapping& operator=		(const EntryMapping&);
+
+	deFileMapping*	m_mapping;
+};
+
+bool writeAll (deFile* file, const void* data, size_t size)
+{
+	deInt64 numWritten = 0;
+	return deFile_write(file, data, (deInt64)size, &numWritten) == DE_FILERESULT_SUCCESS && numWritten == (deInt64)size;
+}
+
+} // anonymous
+
+ReferenceImageCache::ReferenceImageCache (const char* cacheDir, bool bypass)
+	: m_cacheDir	(cacheDir ? cacheDir : "")
+	, m_bypass		(bypass)
+{
+}
+
+ReferenceImageCache::~ReferenceImageCache (void)
+{
+}
+
+std::string ReferenceImageCache::getEntryPath (deUint32 paramHash, const TextureFormat& format, const IVec3& size) const
+{
+	const std::string	key		= getEntryKey(m_casePath);
+	const EntryHeader	header	= makeEntryHeader(key, paramHash, format, size);
+	deUint64			hash	= 0xcbf29ce484222325ull;
+	std::ostringstream	name;
+
+	hash = hashBytes(hash, &header, sizeof(header));
+	hash = hashBytes(hash, key.c_str(), key.size());
+
+	name << std::hex << std::setw(16) << std::setfill('0') << hash << ".ref";
+
+	return de::FilePath::join(m_cacheDir, name.str()).getPath();
+}
+
+bool ReferenceImageCache::lookup (deUint32 paramHash, const PixelBufferAccess& dst) const
+{
+	if (!isEnabled() || m_bypass)
+		return false;
+
+	const std::string	key			= getEntryKey(m_casePath);
+	const EntryHeader	expected	= makeEntryHeader(key, paramHash, dst.getFormat(), dst.getSize());
+	const std::string	path		= getEntryPath(paramHash, dst.getFormat(), dst.getSize());
+	const EntryFile		file		(path.c_str(), DE_FILEMODE_OPEN|DE_FILEMODE_READ);
+
+	if (!file.get())
+		return false;
+
+	{
+		const EntryMapping mapping (file.get());
+
+		if (!mapping.isValid() || mapping.getSize() != (deInt64)(expected.dataOffset + expected.dataSize))
+			return false;
+
+		// Hash collisions and stale or truncated entries are treated as misses
+		if (deMemCmp(mapping.getPtr(), &expected, sizeof(EntryHeader)) != 0 ||
+			deMemCmp(mapping.getPtr() + sizeof(EntryHeader), key.c_str(), key.size()) != 0)
+			return false;
+
+		copy(dst, ConstPixelBufferAccess(dst.getFormat(), dst.getSize(), mapping.getPtr() + expected.dataOffset));
+	}
+
+	return true;
+}
+
+void ReferenceImageCache::store (deUint32 paramHash, const ConstPixelBufferAccess& src) const
+{
+	if (!isEnabled())
+		return;
+
+	const std::string		key			= getEntryKey(m_casePath);
+	const EntryHeader		header		= makeEntryHeader(key, paramHash, src.getFormat(), src.getSize());
+	const std::string		path		= getEntryPath(paramHash, src.getFormat(), src.getSize());
+	const std::string		tmpPath		= path + ".tmp";
+	std::vector<deUint8>	entry		(header.dataOffset + header.dataSize, 0);
+	bool					writeOk		= false;
+
+	deMemcpy(&entry[0], &header, sizeof(EntryHeader));
+	deMemcpy(&entry[sizeof(EntryHeader)], key.c_str(), key.size());
+	copy(PixelBufferAccess(src.getFormat(), src.getSize(), &entry[header.dataOffset]), src);
+
+	// Write to a temporary file first so that concurrent readers never see partial entries
+	{
+		const EntryFile file (tmpPath.c_str(), DE_FILEMODE_CREATE|DE_FILEMODE_OPEN|DE_FILEMODE_WRITE|DE_FILEMODE_TRUNCATE);
+
+		if (file.get())
+			writeOk = writeAll(file.get(), &entry[0], entry.size());
+	}
+
+	if (writeOk)
+	{
+		std::remove(path.c_str());
+		writeOk = std::rename(tmpPath.c_str(), path.c_str()) == 0;
+	}
+
+	if (!writeOk)
+		std::remove(tmpPath.c_str());
+}
+
+} // tcu
@@ -0,0 +1,83 @@
+#ifndef _TCUREFERENCEIMAGECACHE_HPP
+#define _TCUREFERENCEIMAGECACHE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief On-disk cache for reference images.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTexture.hpp"
+
+#include <string>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Content-addressed on-disk cache for reference images
+ *
+ * Test cases that compute expensive reference images on the CPU can look
+ * them up from the cache before computing them and store the result
+ * afterwards. Entries are keyed by the current test case path, a hash of
+ * the parameters the reference depends on (see tcu::SeedBuilder), image
+ * size and format, and the framework release. Cached images are read
+ * through a read-only file mapping.
+ *
+ * Cache is disabled unless a cache directory is given. In bypass mode
+ * lookups always miss but stored images still replace existing entries,
+ * which is useful when debugging reference computation.
+ *
+ * Cache failures are never fatal; a failed store simply leaves the cache
+ * without the entry.
+ *//*--------------------------------------------------------------------*/
+class ReferenceImageCache
+{
+public:
+							ReferenceImageCache		(const char* cacheDir, bool bypass);
+							~ReferenceImageCache	(void);
+
+	bool					isEnabled				(void) const	{ return !m_cacheDir.empty();	}
+	bool					isBypassed				(void) const	{ return m_bypass;				}
+
+	//! Set test case path used as part of the key. Called by the framework when entering a test case.
+	void					setCasePath				(const std::string& casePath)	{ m_casePath = casePath;	}
+	const std::string&		getCasePath				(void) const					{ return m_casePath;		}
+
+	//! Copy cached image with given key to dst. Size and format of dst are part of the key. Returns false on miss.
+	bool					lookup					(deUint32 paramHash, const PixelBufferAccess& dst) const;
+
+	//! Store image to cache.
+	void					store					(deUint32 paramHash, const ConstPixelBufferAccess& src) const;
+
+private:
+							ReferenceImageCache		(const ReferenceImageCache&);
+	ReferenceImageCache&	operator=				(const ReferenceImageCache&);
+
+	std::string				getEntryPath			(deUint32 paramHash, const TextureFormat& format, const IVec3& size) const;
+
+	const std::string		m_cacheDir;
+	const bool				m_bypass;
+	std::string				m_casePath;
+};
+
+} // tcu
+
+#endif // _TCUREFERENCEIMAGECACHE_HPP
@@ -24,6 +24,7 @@
 #include "tcuTestContext.hpp"
 
 #include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
 
 namespace tcu
 {
@@ -39,6 +40,8 @@ TestContext::TestContext (
 	, m_log				(log)
 	, m_cmdLine			(cmdLine)
 	, m_watchDog		(watchDog)
+	, m_referenceImageCache	(cmdLine.getReferenceCacheDir(), cmdLine.isReferenceCacheBypassed())
+	, m_asyncVerifier	(AsyncVerifier::getDefaultNumThreads())
 	, m_curArchive		(DE_NULL)
 	, m_testResult		(QP_TEST_RESULT_LAST)
 	, m_terminateAfter	(false)
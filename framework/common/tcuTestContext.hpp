@@ -26,6 +26,8 @@
 #include "tcuDefs.hpp"
 #include "qpWatchDog.h"
 #include "qpTestLog.h"
+#include "tcuReferenceImageCache.hpp"
+#include "tcuAsyncVerifier.hpp"
 
 #include <string>
 
@@ -58,6 +60,8 @@ public:
 	void					setTestResult		(qpTestResult result, const char* description);
 	void					touchWatchdog		(void);
 	const CommandLine&		getCommandLine		(void) const	{ return m_cmdLine;		}
+	ReferenceImageCache&	getReferenceImageCache	(void)		{ return m_referenceImageCache;	}
+	AsyncVerifier&			getAsyncVerifier	(void)			{ return m_asyncVerifier;	}
 
 	// API for test framework
 	qpTestResult			getTestResult		(void) const	{ return m_testResult;				}
@@ -79,6 +83,8 @@ protected:
 	TestLog&				m_log;				//!< Test log.
 	const CommandLine&		m_cmdLine;			//!< Command line.
 	qpWatchDog*				m_watchDog;			//!< Watchdog (can be null).
+	ReferenceImageCache		m_referenceImageCache;	//!< Reference image cache (disabled unless enabled in command line).
+	AsyncVerifier			m_asyncVerifier;	//!< Verification worker pool for test cases.
 
 	Archive*				m_curArchive;		//!< Current archive for test cases.
 	qpTestResult			m_testResult;		//!< Latest test result.
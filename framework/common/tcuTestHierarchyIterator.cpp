@@ -144,6 +144,40 @@ const std::string& TestHierarchyIterator::getNodePath (void) const
 	return m_nodePath;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Get test cases that will be entered after the current case
+ *
+ * Only the remaining cases in the group of the current case are
+ * reported since other groups have not been inflated yet. Nothing is
+ * reported if the current node is not a test case.
+ *//*--------------------------------------------------------------------*/
+void TestHierarchyIterator::getUpcomingCases (int maxCases, vector<TestCase*>& cases, vector<string>& casePaths) const
+{
+	if (m_sessionStack.size() < 2 || !isTestNodeTypeExecutable(getNode()->getNodeType()))
+		return;
+
+	{
+		const NodeIter&			parent			= m_sessionStack[m_sessionStack.size()-2];
+		const size_t			parentPathLen	= m_nodePath.find_last_of('.');
+		const string			parentPath		= m_nodePath.substr(0, parentPathLen);
+
+		DE_ASSERT(parent.getState() == NodeIter::STATE_TRAVERSE_CHILDREN);
+		DE_ASSERT(parentPathLen != string::npos);
+
+		for (int childNdx = parent.curChildNdx+1; childNdx < (int)parent.children.size() && (int)cases.size() < maxCases; childNdx++)
+		{
+			TestNode* const		child		= parent.children[childNdx];
+			const string		childPath	= parentPath + "." + child->getName();
+
+			if (isTestNodeTypeExecutable(child->getNodeType()) && m_caseListFilter.checkTestCaseName(childPath.c_str()))
+			{
+				cases.push_back(static_cast<TestCase*>(child));
+				casePaths.push_back(childPath);
+			}
+		}
+	}
+}
+
 std::string TestHierarchyIterator::buildNodePath (const vector<NodeIter>& nodeStack)
 {
 	string nodePath;
@@ -126,6 +126,8 @@ public:
 
 	void					next					(void);
 
+	void					getUpcomingCases		(int maxCases, std::vector<TestCase*>& cases, std::vector<std::string>& casePaths) const;
+
 private:
 	struct NodeIter
 	{
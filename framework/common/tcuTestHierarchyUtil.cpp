@@ -27,12 +27,18 @@
 
 #include "qpXmlWriter.h"
 
+#include "deAtomic.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+
 #include <fstream>
+#include <vector>
 
 namespace tcu
 {
 
 using std::string;
+using std::vector;
 
 static const char* getNodeTypeName (TestNodeType nodeType)
 {
@@ -59,163 +65,578 @@ static std::string makePackageFilename (const std::string& pattern, const std::s
 	return StringTemplate(pattern).specialize(args);
 }
 
-static void writeXmlCaselist (TestHierarchyIterator& iter, qpXmlWriter* writer)
+namespace
 {
-	DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-			  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
 
+//! Enter or leave event of a node in exported case list
+struct CaseListEntry
+{
+	bool			isEnter;
+	TestNodeType	nodeType;
+	string			name;
+	string			description;
+
+	CaseListEntry (bool isEnter_, TestNodeType nodeType_, const char* name_, const char* description_)
+		: isEnter		(isEnter_)
+		, nodeType		(nodeType_)
+		, name			(name_)
+		, description	(description_)
 	{
-		const TestNode* node		= iter.getNode();
-		qpXmlAttribute	attribs[2];
-		int				numAttribs	= 0;
-		attribs[numAttribs++] = qpSetStringAttrib("PackageName", node->getName());
-		attribs[numAttribs++] = qpSetStringAttrib("Description", node->getDescription());
-		DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
+	}
+};
 
-		if (!qpXmlWriter_startDocument(writer) ||
-			!qpXmlWriter_startElement(writer, "TestCaseList", numAttribs, attribs))
-			throw Exception("Failed to start XML document");
+typedef vector<CaseListEntry> CaseListEntries;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Collect case list entries of a sub-tree
+ *
+ * Sub-tree is walked in the same order and with the same filtering as
+ * TestHierarchyIterator does. Group nodes are inflated and cleaned up on
+ * the way.
+ *//*--------------------------------------------------------------------*/
+void collectCaseList (TestNode* node, const string& nodePath, TestHierarchyInflater& inflater, const CaseListFilter& caseListFilter, CaseListEntries& entries)
+{
+	const TestNodeType	nodeType	= node->getNodeType();
+	const bool			isLeaf		= isTestNodeTypeExecutable(nodeType);
+
+	DE_ASSERT(isLeaf || nodeType == NODETYPE_GROUP);
+
+	if (!(isLeaf ? caseListFilter.checkTestCaseName(nodePath.c_str()) : caseListFilter.checkTestGroupName(nodePath.c_str())))
+		return;
+
+	entries.push_back(CaseListEntry(true, nodeType, node->getName(), node->getDescription()));
+
+	if (!isLeaf)
+	{
+		TestCaseGroup* const	group		= static_cast<TestCaseGroup*>(node);
+		vector<TestNode*>		children;
+
+		inflater.enterGroupNode(group, children);
+
+		try
+		{
+			for (size_t childNdx = 0; childNdx < children.size(); childNdx++)
+				collectCaseList(children[childNdx], nodePath + "." + children[childNdx]->getName(), inflater, caseListFilter, entries);
+		}
+		catch (...)
+		{
+			inflater.leaveGroupNode(group);
+			throw;
+		}
+
+		inflater.leaveGroupNode(group);
 	}
 
-	iter.next();
+	entries.push_back(CaseListEntry(false, nodeType, "", ""));
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Collects case lists of sibling sub-trees in multiple threads
+ *//*--------------------------------------------------------------------*/
+class CaseListCollector
+{
+public:
+								CaseListCollector	(TestHierarchyInflater& inflater, const CaseListFilter& caseListFilter, const string& parentPath, const vector<TestNode*>& nodes);
+
+	void						collectNodes		(void);
+
+	//! Get entries of a node, throws if collecting the node failed.
+	CaseListEntries&			getEntries			(int nodeNdx);
+
+private:
+	TestHierarchyInflater&		m_inflater;
+	const CaseListFilter&		m_caseListFilter;
+	const string				m_parentPath;
+	const vector<TestNode*>&	m_nodes;
+
+	vector<CaseListEntries>		m_entries;
+	vector<string>				m_errors;
+	vector<bool>				m_failed;
+
+	volatile deInt32			m_nextNode;
+};
+
+CaseListCollector::CaseListCollector (TestHierarchyInflater& inflater, const CaseListFilter& caseListFilter, const string& parentPath, const vector<TestNode*>& nodes)
+	: m_inflater		(inflater)
+	, m_caseListFilter	(caseListFilter)
+	, m_parentPath		(parentPath)
+	, m_nodes			(nodes)
+	, m_entries			(nodes.size())
+	, m_errors			(nodes.size())
+	, m_failed			(nodes.size(), false)
+	, m_nextNode		(0)
+{
+}
 
-	while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
+void CaseListCollector::collectNodes (void)
+{
+	for (;;)
 	{
-		const TestNode* const	node		= iter.getNode();
-		const TestNodeType		nodeType	= node->getNodeType();
-		const bool				isEnter		= iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE;
+		const int nodeNdx = deAtomicIncrementInt32(&m_nextNode) - 1;
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE ||
-				  iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE);
+		if (nodeNdx >= (int)m_nodes.size())
+			break;
+
+		try
 		{
-			if (isEnter)
-			{
-				const string	caseName	= node->getName();
-				const string	description	= node->getDescription();
-				qpXmlAttribute	attribs[3];
-				int				numAttribs = 0;
-
-				attribs[numAttribs++] = qpSetStringAttrib("Name",			caseName.c_str());
-				attribs[numAttribs++] = qpSetStringAttrib("CaseType",		getNodeTypeName(nodeType));
-				attribs[numAttribs++] = qpSetStringAttrib("Description",	description.c_str());
-				DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
-
-				if (!qpXmlWriter_startElement(writer, "TestCase", numAttribs, attribs))
-					throw Exception("Writing to case list file failed");
-			}
-			else
-			{
-				if (!qpXmlWriter_endElement(writer, "TestCase"))
-					throw tcu::Exception("Writing to case list file failed");
-			}
+			collectCaseList(m_nodes[nodeNdx], m_parentPath + "." + m_nodes[nodeNdx]->getName(), m_inflater, m_caseListFilter, m_entries[nodeNdx]);
+		}
+		catch (const std::exception& e)
+		{
+			m_errors[nodeNdx]	= e.what();
+			m_failed[nodeNdx]	= true;
+		}
+		catch (...)
+		{
+			m_errors[nodeNdx]	= "Unknown error";
+			m_failed[nodeNdx]	= true;
 		}
+	}
+}
+
+CaseListEntries& CaseListCollector::getEntries (int nodeNdx)
+{
+	if (m_failed[nodeNdx])
+		throw Exception(m_errors[nodeNdx]);
+
+	return m_entries[nodeNdx];
+}
+
+class CaseListCollectorThread : public de::Thread
+{
+public:
+								CaseListCollectorThread	(CaseListCollector& collector) : m_collector(collector) {}
+
+	void						run						(void) { m_collector.collectNodes(); }
+
+private:
+	CaseListCollector&			m_collector;
+};
 
-		iter.next();
+/*--------------------------------------------------------------------*//*!
+ * \brief Case list file writer
+ *//*--------------------------------------------------------------------*/
+class CaseListWriter
+{
+public:
+	virtual					~CaseListWriter		(void) {}
+
+	virtual const char*		getTypeExtension	(void) const = 0;
+
+	virtual void			beginPackage		(const string& filename, const TestNode& package) = 0;
+	virtual void			endPackage			(void) = 0;
+
+	virtual void			enterNode			(const CaseListEntry& entry, const string& nodePath) = 0;
+	virtual void			leaveNode			(const CaseListEntry& entry) = 0;
+};
+
+class XmlCaseListWriter : public CaseListWriter
+{
+public:
+							XmlCaseListWriter	(void) : m_file(DE_NULL), m_writer(DE_NULL) {}
+							~XmlCaseListWriter	(void) { close(); }
+
+	const char*				getTypeExtension	(void) const { return "xml"; }
+
+	void					beginPackage		(const string& filename, const TestNode& package);
+	void					endPackage			(void);
+
+	void					enterNode			(const CaseListEntry& entry, const string& nodePath);
+	void					leaveNode			(const CaseListEntry& entry);
+
+private:
+	void					close				(void);
+
+	FILE*					m_file;
+	qpXmlWriter*			m_writer;
+};
+
+void XmlCaseListWriter::beginPackage (const string& filename, const TestNode& package)
+{
+	DE_ASSERT(!m_file && !m_writer);
+
+	m_file = fopen(filename.c_str(), "wb");
+	if (!m_file)
+		throw Exception("Failed to open " + filename);
+
+	m_writer = qpXmlWriter_createFileWriter(m_file, DE_FALSE, DE_FALSE);
+	if (!m_writer)
+		throw Exception("XML writer creation failed");
+
+	{
+		qpXmlAttribute	attribs[2];
+		int				numAttribs	= 0;
+		attribs[numAttribs++] = qpSetStringAttrib("PackageName", package.getName());
+		attribs[numAttribs++] = qpSetStringAttrib("Description", package.getDescription());
+		DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
+
+		if (!qpXmlWriter_startDocument(m_writer) ||
+			!qpXmlWriter_startElement(m_writer, "TestCaseList", numAttribs, attribs))
+			throw Exception("Failed to start XML document");
 	}
+}
 
+void XmlCaseListWriter::endPackage (void)
+{
 	// This could be done in catch, but the file is corrupt at that point anyways.
-	if (!qpXmlWriter_endElement(writer, "TestCaseList") ||
-		!qpXmlWriter_endDocument(writer))
+	if (!qpXmlWriter_endElement(m_writer, "TestCaseList") ||
+		!qpXmlWriter_endDocument(m_writer))
 		throw Exception("Failed to terminate XML document");
+
+	close();
+}
+
+void XmlCaseListWriter::enterNode (const CaseListEntry& entry, const string&)
+{
+	qpXmlAttribute	attribs[3];
+	int				numAttribs = 0;
+
+	attribs[numAttribs++] = qpSetStringAttrib("Name",			entry.name.c_str());
+	attribs[numAttribs++] = qpSetStringAttrib("CaseType",		getNodeTypeName(entry.nodeType));
+	attribs[numAttribs++] = qpSetStringAttrib("Description",	entry.description.c_str());
+	DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
+
+	if (!qpXmlWriter_startElement(m_writer, "TestCase", numAttribs, attribs))
+		throw Exception("Writing to case list file failed");
+}
+
+void XmlCaseListWriter::leaveNode (const CaseListEntry&)
+{
+	if (!qpXmlWriter_endElement(m_writer, "TestCase"))
+		throw tcu::Exception("Writing to case list file failed");
+}
+
+void XmlCaseListWriter::close (void)
+{
+	if (m_writer)
+	{
+		qpXmlWriter_destroy(m_writer);
+		m_writer = DE_NULL;
+	}
+
+	if (m_file)
+	{
+		fclose(m_file);
+		m_file = DE_NULL;
+	}
+}
+
+class TxtCaseListWriter : public CaseListWriter
+{
+public:
+	const char*				getTypeExtension	(void) const { return "txt"; }
+
+	void					beginPackage		(const string& filename, const TestNode& package);
+	void					endPackage			(void) { m_out.close(); }
+
+	void					enterNode			(const CaseListEntry& entry, const string& nodePath);
+	void					leaveNode			(const CaseListEntry&) {}
+
+private:
+	std::ofstream			m_out;
+};
+
+void TxtCaseListWriter::beginPackage (const string& filename, const TestNode&)
+{
+	m_out.open(filename.c_str(), std::ios_base::binary);
+	if (!m_out.is_open() || !m_out.good())
+		throw Exception("Failed to open " + filename);
+}
+
+void TxtCaseListWriter::enterNode (const CaseListEntry& entry, const string& nodePath)
+{
+	m_out << (isTestNodeTypeExecutable(entry.nodeType) ? "TEST" : "GROUP") << ": " << nodePath << "\n";
 }
 
 /*--------------------------------------------------------------------*//*!
- * \brief Export the test list of each package into a separate XML file.
+ * \brief Binary case list writer
+ *
+ * Binary case list can be loaded by the executor without XML parsing. All
+ * integers are little-endian. File layout is:
+ *
+ *  - Magic "dQCL" followed by deUint32 format version (1)
+ *  - Package name and description
+ *  - Node records in depth-first order, each starting with deUint8 code:
+ *    - BINCASELIST_END: End of current group, or package if at top level
+ *    - BINCASELIST_GROUP: Group, followed by name and description. Child
+ *      nodes follow until matching BINCASELIST_END.
+ *    - BINCASELIST_SELF_VALIDATE .. BINCASELIST_PERFORMANCE: Test case,
+ *      followed by name and description.
+ *
+ * Strings are stored as deUint32 length followed by characters without
+ * terminating null.
  *//*--------------------------------------------------------------------*/
-void writeXmlCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+class BinaryCaseListWriter : public CaseListWriter
 {
-	DefaultHierarchyInflater			inflater		(testCtx);
-	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+public:
+	enum Code
+	{
+		BINCASELIST_END = 0,
+		BINCASELIST_GROUP,
+		BINCASELIST_SELF_VALIDATE,
+		BINCASELIST_CAPABILITY,
+		BINCASELIST_ACCURACY,
+		BINCASELIST_PERFORMANCE,
 
-	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
-	const char* const					filenamePattern = cmdLine.getCaseListExportFile();
+		BINCASELIST_LAST
+	};
 
-	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+	enum
 	{
-		const TestNode* node		= iter.getNode();
-		const char*		pkgName		= node->getName();
-		const string	filename	= makePackageFilename(filenamePattern, pkgName, "xml");
+		FORMAT_VERSION = 1
+	};
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-				  node->getNodeType() == NODETYPE_PACKAGE);
+	const char*				getTypeExtension	(void) const { return "bin"; }
 
-		FILE*			file	= DE_NULL;
-		qpXmlWriter*	writer	= DE_NULL;
+	void					beginPackage		(const string& filename, const TestNode& package);
+	void					endPackage			(void);
 
-		try
+	void					enterNode			(const CaseListEntry& entry, const string& nodePath);
+	void					leaveNode			(const CaseListEntry& entry);
+
+private:
+	static Code				getCode				(TestNodeType nodeType);
+
+	void					writeUint32			(deUint32 value);
+	void					writeString			(const string& str);
+
+	string					m_filename;
+	vector<deUint8>			m_data;
+};
+
+BinaryCaseListWriter::Code BinaryCaseListWriter::getCode (TestNodeType nodeType)
+{
+	switch (nodeType)
+	{
+		case NODETYPE_GROUP:			return BINCASELIST_GROUP;
+		case NODETYPE_SELF_VALIDATE:	return BINCASELIST_SELF_VALIDATE;
+		case NODETYPE_CAPABILITY:		return BINCASELIST_CAPABILITY;
+		case NODETYPE_ACCURACY:			return BINCASELIST_ACCURACY;
+		case NODETYPE_PERFORMANCE:		return BINCASELIST_PERFORMANCE;
+		default:
+			DE_ASSERT(false);
+			return BINCASELIST_LAST;
+	}
+}
+
+void BinaryCaseListWriter::writeUint32 (deUint32 value)
+{
+	for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+		m_data.push_back((deUint8)(value >> (8*byteNdx)));
+}
+
+void BinaryCaseListWriter::writeString (const string& str)
+{
+	writeUint32((deUint32)str.size());
+	m_data.insert(m_data.end(), str.begin(), str.end());
+}
+
+void BinaryCaseListWriter::beginPackage (const string& filename, const TestNode& package)
+{
+	static const char s_magic[] = { 'd', 'Q', 'C', 'L' };
+
+	m_filename = filename;
+	m_data.clear();
+
+	m_data.insert(m_data.end(), DE_ARRAY_BEGIN(s_magic), DE_ARRAY_END(s_magic));
+	writeUint32(FORMAT_VERSION);
+	writeString(package.getName());
+	writeString(package.getDescription());
+}
+
+void BinaryCaseListWriter::endPackage (void)
+{
+	m_data.push_back((deUint8)BINCASELIST_END);
+
+	{
+		std::ofstream out (m_filename.c_str(), std::ios_base::binary);
+
+		if (!out.is_open() || !out.good())
+			throw Exception("Failed to open " + m_filename);
+
+		out.write((const char*)&m_data[0], (std::streamsize)m_data.size());
+
+		if (!out.good())
+			throw Exception("Writing to case list file failed");
+	}
+
+	m_data.clear();
+}
+
+void BinaryCaseListWriter::enterNode (const CaseListEntry& entry, const string&)
+{
+	m_data.push_back((deUint8)getCode(entry.nodeType));
+	writeString(entry.name);
+	writeString(entry.description);
+}
+
+void BinaryCaseListWriter::leaveNode (const CaseListEntry& entry)
+{
+	if (entry.nodeType == NODETYPE_GROUP)
+		m_data.push_back((deUint8)BINCASELIST_END);
+}
+
+void writeCaseListEntries (CaseListWriter& writer, const string& parentPath, const CaseListEntries& entries)
+{
+	vector<size_t>	parentPathLengths;
+	string			nodePath		= parentPath;
+
+	for (CaseListEntries::const_iterator entry = entries.begin(); entry != entries.end(); ++entry)
+	{
+		if (entry->isEnter)
+		{
+			parentPathLengths.push_back(nodePath.size());
+			nodePath += "." + entry->name;
+
+			writer.enterNode(*entry, nodePath);
+		}
+		else
 		{
-			file = fopen(filename.c_str(), "wb");
-			if (!file)
-				throw Exception("Failed to open " + filename);
+			DE_ASSERT(!parentPathLengths.empty());
 
-			writer = qpXmlWriter_createFileWriter(file, DE_FALSE, DE_FALSE);
-			if (!writer)
-				throw Exception("XML writer creation failed");
+			writer.leaveNode(*entry);
 
-			print("Writing test cases from '%s' to file '%s'..\n", pkgName, filename.c_str());
+			nodePath.resize(parentPathLengths.back());
+			parentPathLengths.pop_back();
+		}
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Write case list entries of package
+ *
+ * If the package supports concurrent group initialization, top-level
+ * groups are inflated and collected in multiple threads and written in
+ * order afterwards. Output is identical to single-threaded export.
+ *//*--------------------------------------------------------------------*/
+void writePackageCaseList (CaseListWriter& writer, TestPackage& package, const vector<TestNode*>& children, TestHierarchyInflater& inflater, const CaseListFilter& caseListFilter)
+{
+	enum { MIN_GROUPS_PER_THREAD = 2 };
+
+	const string	packagePath	= package.getName();
+	const int		numThreads	= package.isConcurrentGroupInitSupported()
+								? de::min((int)deGetNumAvailableLogicalCores(), (int)children.size() / MIN_GROUPS_PER_THREAD)
+								: 1;
 
-			writeXmlCaselist(iter, writer);
+	if (numThreads <= 1)
+	{
+		CaseListEntries entries;
 
-			qpXmlWriter_destroy(writer);
-			writer = DE_NULL;
+		for (size_t childNdx = 0; childNdx < children.size(); childNdx++)
+		{
+			entries.clear();
+			collectCaseList(children[childNdx], packagePath + "." + children[childNdx]->getName(), inflater, caseListFilter, entries);
+			writeCaseListEntries(writer, packagePath, entries);
+		}
+	}
+	else
+	{
+		CaseListCollector								collector	(inflater, caseListFilter, packagePath, children);
+		std::vector<de::SharedPtr<CaseListCollectorThread> >	threads;
 
-			fclose(file);
-			file = DE_NULL;
+		try
+		{
+			for (int threadNdx = 0; threadNdx < numThreads-1; threadNdx++)
+			{
+				threads.push_back(de::SharedPtr<CaseListCollectorThread>(new CaseListCollectorThread(collector)));
+				threads.back()->start();
+			}
 		}
 		catch (...)
 		{
-			if (writer)
-				qpXmlWriter_destroy(writer);
-			if (file)
-				fclose(file);
+			for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+				threads[threadNdx]->join();
 			throw;
 		}
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-				  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
-		iter.next();
+		collector.collectNodes();
+
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+			threads[threadNdx]->join();
+
+		for (size_t childNdx = 0; childNdx < children.size(); childNdx++)
+		{
+			CaseListEntries& entries = collector.getEntries((int)childNdx);
+
+			writeCaseListEntries(writer, packagePath, entries);
+
+			CaseListEntries().swap(entries);
+		}
 	}
 }
 
 /*--------------------------------------------------------------------*//*!
- * \brief Export the test list of each package into a separate ascii file.
+ * \brief Export the test list of each package into a separate file.
  *//*--------------------------------------------------------------------*/
-void writeTxtCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+void writeCaselistsToFiles (CaseListWriter& writer, TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
 {
 	DefaultHierarchyInflater			inflater		(testCtx);
 	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
-
-	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
 	const char* const					filenamePattern = cmdLine.getCaseListExportFile();
+	vector<TestNode*>					packages;
+
+	root.getChildren(packages);
 
-	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+	for (size_t packageNdx = 0; packageNdx < packages.size(); packageNdx++)
 	{
-		const TestNode* node		= iter.getNode();
-		const char*		pkgName		= node->getName();
-		const string	filename	= makePackageFilename(filenamePattern, pkgName, "txt");
+		TestPackage* const	package		= static_cast<TestPackage*>(packages[packageNdx]);
+		const char*			pkgName		= package->getName();
+		const string		filename	= makePackageFilename(filenamePattern, pkgName, writer.getTypeExtension());
+		vector<TestNode*>	children;
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-				  node->getNodeType() == NODETYPE_PACKAGE);
+		DE_ASSERT(package->getNodeType() == NODETYPE_PACKAGE);
 
-		std::ofstream out(filename.c_str(), std::ios_base::binary);
-		if (!out.is_open() || !out.good())
-			throw Exception("Failed to open " + filename);
+		if (!caseListFilter->checkTestGroupName(pkgName))
+			continue;
+
+		writer.beginPackage(filename, *package);
 
 		print("Writing test cases from '%s' to file '%s'..\n", pkgName, filename.c_str());
 
-		iter.next();
+		inflater.enterTestPackage(package, children);
 
-		while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
+		try
 		{
-			if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
-				out << (isTestNodeTypeExecutable(iter.getNode()->getNodeType()) ? "TEST" : "GROUP") << ": " << iter.getNodePath() << "\n";
-			iter.next();
+			writePackageCaseList(writer, *package, children, inflater, *caseListFilter);
+			writer.endPackage();
+		}
+		catch (...)
+		{
+			inflater.leaveTestPackage(package);
+			throw;
 		}
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-				  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
-		iter.next();
+		inflater.leaveTestPackage(package);
 	}
 }
 
+} // anonymous
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate XML file.
+ *//*--------------------------------------------------------------------*/
+void writeXmlCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	XmlCaseListWriter writer;
+	writeCaselistsToFiles(writer, root, testCtx, cmdLine);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate ascii file.
+ *//*--------------------------------------------------------------------*/
+void writeTxtCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	TxtCaseListWriter writer;
+	writeCaselistsToFiles(writer, root, testCtx, cmdLine);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate binary file.
+ *//*--------------------------------------------------------------------*/
+void writeBinaryCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	BinaryCaseListWriter writer;
+	writeCaselistsToFiles(writer, root, testCtx, cmdLine);
+}
+
 } // tcu
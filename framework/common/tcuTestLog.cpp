@@ -24,9 +24,12 @@
 #include "tcuTestLog.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuSurface.hpp"
+#include "tcuProfiler.hpp"
 #include "deMath.h"
+#include "deSharedPtr.hpp"
 
 #include <limits>
+#include <vector>
 
 namespace tcu
 {
@@ -136,6 +139,338 @@ void LogImage::write (TestLog& log) const
 	}
 }
 
+// TestLog::DeferredDetails
+
+namespace
+{
+
+struct DeferredCommand
+{
+	enum Type
+	{
+		TYPE_START_IMAGE_SET = 0,
+		TYPE_END_IMAGE_SET,
+		TYPE_IMAGE,
+		TYPE_RAW_IMAGE,
+		TYPE_START_SHADER_PROGRAM,
+		TYPE_END_SHADER_PROGRAM,
+		TYPE_SHADER,
+		TYPE_SPIRV_ASSEMBLY_SOURCE,
+		TYPE_KERNEL_SOURCE,
+		TYPE_CONTENT,
+
+		TYPE_LAST
+	};
+
+	Type									type;
+	std::string								name;
+	std::string								description;	//!< Description, or info log of shader or program.
+	std::string								source;
+	bool									isOk;
+	qpShaderType							shaderType;
+	qpImageCompressionMode					compression;
+	qpImageFormat							imageFormat;	//!< Format of raw images.
+	de::SharedPtr<TextureLevel>				image;
+	Vec4									scale;
+	Vec4									bias;
+	de::SharedPtr<const DeferredLogContent>	content;
+
+	explicit DeferredCommand (Type type_)
+		: type			(type_)
+		, isOk			(false)
+		, shaderType	(QP_SHADER_TYPE_LAST)
+		, compression	(QP_IMAGE_COMPRESSION_MODE_LAST)
+		, imageFormat	(QP_IMAGE_FORMAT_LAST)
+	{
+	}
+};
+
+struct DeferredSection
+{
+	std::string		name;
+	std::string		description;
+	int				id;
+};
+
+//! Top-level element and its children, e.g. an image set with its images
+struct DeferredUnit
+{
+	std::vector<DeferredSection>	sections;	//!< Sections the unit was written in.
+	std::vector<DeferredCommand>	commands;
+};
+
+} // anonymous
+
+class TestLog::DeferredDetails
+{
+public:
+									DeferredDetails		(void);
+
+	bool							isCapturing			(void) const { return m_isCapturing; }
+
+	void							begin				(void);
+	void							end					(std::vector<DeferredUnit>& units);
+	std::string						getSummary			(void) const;
+
+	void							startSection		(const char* name, const char* description);
+	void							endSection			(void);
+	void							add					(const DeferredCommand& command);
+
+private:
+	bool							m_isCapturing;
+	std::vector<DeferredSection>	m_openSections;
+	int								m_nextSectionId;
+	int								m_elementDepth;		//!< Nesting depth of image sets and shader programs.
+	std::vector<DeferredUnit>		m_units;
+
+	int								m_numImages;
+	int								m_numShaderPrograms;
+	int								m_numSources;
+	int								m_numOther;
+};
+
+TestLog::DeferredDetails::DeferredDetails (void)
+	: m_isCapturing			(false)
+	, m_nextSectionId		(0)
+	, m_elementDepth		(0)
+	, m_numImages			(0)
+	, m_numShaderPrograms	(0)
+	, m_numSources			(0)
+	, m_numOther			(0)
+{
+}
+
+void TestLog::DeferredDetails::begin (void)
+{
+	m_isCapturing		= true;
+	m_openSections.clear();
+	m_elementDepth		= 0;
+	m_units.clear();
+	m_numImages			= 0;
+	m_numShaderPrograms	= 0;
+	m_numSources		= 0;
+	m_numOther			= 0;
+}
+
+void TestLog::DeferredDetails::end (std::vector<DeferredUnit>& units)
+{
+	m_isCapturing = false;
+	m_openSections.clear();
+	units.swap(m_units);
+	m_units.clear();
+}
+
+std::string TestLog::DeferredDetails::getSummary (void) const
+{
+	const struct
+	{
+		int			count;
+		const char*	name;
+	} counts[] =
+	{
+		{ m_numImages,			"image(s)"				},
+		{ m_numShaderPrograms,	"shader program(s)"		},
+		{ m_numSources,			"shader source(s)"		},
+		{ m_numOther,			"other element(s)"		},
+	};
+	std::ostringstream	str;
+	bool				isFirst	= true;
+
+	str << "Test case passed, omitted from log:";
+
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(counts); ndx++)
+	{
+		if (counts[ndx].count > 0)
+		{
+			str << (isFirst ? " " : ", ") << counts[ndx].count << " " << counts[ndx].name;
+			isFirst = false;
+		}
+	}
+
+	return str.str();
+}
+
+void TestLog::DeferredDetails::startSection (const char* name, const char* description)
+{
+	DeferredSection section;
+
+	section.name		= name;
+	section.description	= description;
+	section.id			= m_nextSectionId++;
+
+	m_openSections.push_back(section);
+}
+
+void TestLog::DeferredDetails::endSection (void)
+{
+	if (!m_openSections.empty())
+		m_openSections.pop_back();
+}
+
+void TestLog::DeferredDetails::add (const DeferredCommand& command)
+{
+	if (m_elementDepth == 0)
+	{
+		m_units.push_back(DeferredUnit());
+		m_units.back().sections = m_openSections;
+	}
+
+	m_units.back().commands.push_back(command);
+
+	switch (command.type)
+	{
+		case DeferredCommand::TYPE_START_IMAGE_SET:
+		case DeferredCommand::TYPE_START_SHADER_PROGRAM:
+			m_elementDepth += 1;
+			break;
+
+		case DeferredCommand::TYPE_END_IMAGE_SET:
+		case DeferredCommand::TYPE_END_SHADER_PROGRAM:
+			m_elementDepth = de::max(0, m_elementDepth - 1);
+			break;
+
+		default:
+			break;
+	}
+
+	switch (command.type)
+	{
+		case DeferredCommand::TYPE_IMAGE:
+		case DeferredCommand::TYPE_RAW_IMAGE:
+			m_numImages += 1;
+			break;
+
+		case DeferredCommand::TYPE_START_SHADER_PROGRAM:
+			m_numShaderPrograms += 1;
+			break;
+
+		case DeferredCommand::TYPE_SHADER:
+			// Shaders within programs are counted as part of the program
+			if (m_elementDepth == 0)
+				m_numSources += 1;
+			break;
+
+		case DeferredCommand::TYPE_SPIRV_ASSEMBLY_SOURCE:
+		case DeferredCommand::TYPE_KERNEL_SOURCE:
+			m_numSources += 1;
+			break;
+
+		case DeferredCommand::TYPE_CONTENT:
+			m_numOther += 1;
+			break;
+
+		default:
+			break;
+	}
+}
+
+namespace
+{
+
+void writeDeferredCommand (TestLog& log, const DeferredCommand& command)
+{
+	switch (command.type)
+	{
+		case DeferredCommand::TYPE_START_IMAGE_SET:
+			log.startImageSet(command.name.c_str(), command.description.c_str());
+			break;
+
+		case DeferredCommand::TYPE_END_IMAGE_SET:
+			log.endImageSet();
+			break;
+
+		case DeferredCommand::TYPE_IMAGE:
+			log.writeImage(command.name.c_str(), command.description.c_str(), command.image->getAccess(), command.scale, command.bias, command.compression);
+			break;
+
+		case DeferredCommand::TYPE_RAW_IMAGE:
+		{
+			const ConstPixelBufferAccess access = command.image->getAccess();
+
+			log.writeImage(command.name.c_str(), command.description.c_str(), command.compression, command.imageFormat,
+						   access.getWidth(), access.getHeight(), access.getRowPitch(), access.getDataPtr());
+			break;
+		}
+
+		case DeferredCommand::TYPE_START_SHADER_PROGRAM:
+			log.startShaderProgram(command.isOk, command.description.c_str());
+			break;
+
+		case DeferredCommand::TYPE_END_SHADER_PROGRAM:
+			log.endShaderProgram();
+			break;
+
+		case DeferredCommand::TYPE_SHADER:
+			log.writeShader(command.shaderType, command.source.c_str(), command.isOk, command.description.c_str());
+			break;
+
+		case DeferredCommand::TYPE_SPIRV_ASSEMBLY_SOURCE:
+			log.writeSpirVAssemblySource(command.source.c_str());
+			break;
+
+		case DeferredCommand::TYPE_KERNEL_SOURCE:
+			log.writeKernelSource(command.source.c_str());
+			break;
+
+		case DeferredCommand::TYPE_CONTENT:
+			try
+			{
+				command.content->write(log);
+			}
+			catch (const LogWriteFailedError&)
+			{
+				throw;
+			}
+			catch (const std::exception& e)
+			{
+				// Result of the case has already been decided
+				log.writeMessage((std::string("Failed to write deferred log content: ") + e.what()).c_str());
+			}
+			break;
+
+		default:
+			DE_ASSERT(false);
+	}
+}
+
+void writeDeferredUnits (TestLog& log, const std::vector<DeferredUnit>& units)
+{
+	std::vector<DeferredSection>	openSections;
+
+	for (size_t unitNdx = 0; unitNdx < units.size(); unitNdx++)
+	{
+		const DeferredUnit&		unit		= units[unitNdx];
+		size_t					numCommon	= 0;
+
+		// Re-open sections the unit was originally written in, sharing sections with previous unit where possible
+		while (numCommon < openSections.size() && numCommon < unit.sections.size() && openSections[numCommon].id == unit.sections[numCommon].id)
+			numCommon += 1;
+
+		while (openSections.size() > numCommon)
+		{
+			log.endSection();
+			openSections.pop_back();
+		}
+
+		for (size_t sectionNdx = numCommon; sectionNdx < unit.sections.size(); sectionNdx++)
+		{
+			log.startSection(unit.sections[sectionNdx].name.c_str(), unit.sections[sectionNdx].description.c_str());
+			openSections.push_back(unit.sections[sectionNdx]);
+		}
+
+		for (size_t commandNdx = 0; commandNdx < unit.commands.size(); commandNdx++)
+			writeDeferredCommand(log, unit.commands[commandNdx]);
+	}
+
+	while (!openSections.empty())
+	{
+		log.endSection();
+		openSections.pop_back();
+	}
+}
+
+} // anonymous
+
 // MessageBuilder
 
 MessageBuilder::MessageBuilder (const MessageBuilder& other)
@@ -181,14 +516,29 @@ TestLog& SampleBuilder::operator<< (const TestLog::EndSampleToken&)
 // TestLog
 
 TestLog::TestLog (const char* fileName, deUint32 flags)
-	: m_log(qpTestLog_createFileLog(fileName, flags))
+	: m_log			(qpTestLog_createFileLog(fileName, flags))
+	, m_deferred	(DE_NULL)
 {
 	if (!m_log)
 		throw ResourceError(std::string("Failed to open test log file '") + fileName + "'");
+
+	if ((flags & QP_TEST_LOG_DETAILS_ON_FAILURE) != 0)
+	{
+		try
+		{
+			m_deferred = new DeferredDetails();
+		}
+		catch (...)
+		{
+			qpTestLog_destroy(m_log);
+			throw;
+		}
+	}
 }
 
 TestLog::~TestLog (void)
 {
+	delete m_deferred;
 	qpTestLog_destroy(m_log);
 }
 
@@ -200,12 +550,29 @@ void TestLog::writeMessage (const char* msgStr)
 
 void TestLog::startImageSet (const char* name, const char* description)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		DeferredCommand command (DeferredCommand::TYPE_START_IMAGE_SET);
+
+		command.name		= name;
+		command.description	= description;
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (qpTestLog_startImageSet(m_log, name, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::endImageSet (void)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		m_deferred->add(DeferredCommand(DeferredCommand::TYPE_END_IMAGE_SET));
+		return;
+	}
+
 	if (qpTestLog_endImageSet(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -235,6 +602,8 @@ static Vector<int, Size> computeScaledSize (const Vector<int, Size>& imageSize,
 
 void TestLog::writeImage (const char* name, const char* description, const ConstPixelBufferAccess& access, const Vec4& pixelScale, const Vec4& pixelBias, qpImageCompressionMode compressionMode)
 {
+	const ProfileScope profile ("writeImage");
+
 	const TextureFormat&	format		= access.getFormat();
 	int						width		= access.getWidth();
 	int						height		= access.getHeight();
@@ -247,6 +616,24 @@ void TestLog::writeImage (const char* name, const char* description, const Const
 	if ((qpTestLog_getLogFlags(m_log) & QP_TEST_LOG_EXCLUDE_IMAGES) != 0)
 		return;
 
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		// Only take a copy, conversion is done if the image is written
+		DeferredCommand command (DeferredCommand::TYPE_IMAGE);
+
+		command.name		= name;
+		command.description	= description;
+		command.image		= de::SharedPtr<TextureLevel>(new TextureLevel(format, width, height, depth));
+		command.scale		= pixelScale;
+		command.bias		= pixelBias;
+		command.compression	= compressionMode;
+
+		tcu::copy(command.image->getAccess(), access);
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (depth == 1 && format.type == TextureFormat::UNORM_INT8
 		&& width <= MAX_IMAGE_SIZE_2D && height <= MAX_IMAGE_SIZE_2D
 		&& (format.order == TextureFormat::RGB || format.order == TextureFormat::RGBA)
@@ -359,52 +746,144 @@ void TestLog::writeImage (const char* name, const char* description, const Const
 
 void TestLog::writeImage (const char* name, const char* description, qpImageCompressionMode compressionMode, qpImageFormat format, int width, int height, int stride, const void* data)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		const TextureFormat		texFormat	(format == QP_IMAGE_FORMAT_RGBA8888 ? TextureFormat::RGBA : TextureFormat::RGB, TextureFormat::UNORM_INT8);
+		DeferredCommand			command		(DeferredCommand::TYPE_RAW_IMAGE);
+
+		DE_ASSERT(format == QP_IMAGE_FORMAT_RGBA8888 || format == QP_IMAGE_FORMAT_RGB888);
+
+		if ((qpTestLog_getLogFlags(m_log) & QP_TEST_LOG_EXCLUDE_IMAGES) != 0)
+			return;
+
+		command.name		= name;
+		command.description	= description;
+		command.image		= de::SharedPtr<TextureLevel>(new TextureLevel(texFormat, width, height));
+		command.compression	= compressionMode;
+		command.imageFormat	= format;
+
+		tcu::copy(command.image->getAccess(), ConstPixelBufferAccess(texFormat, width, height, 1, stride, 0, data));
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (qpTestLog_writeImage(m_log, name, description, compressionMode, format, width, height, stride, data) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::startSection (const char* name, const char* description)
 {
+	if (m_deferred && m_deferred->isCapturing())
+		m_deferred->startSection(name, description);
+
 	if (qpTestLog_startSection(m_log, name, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::endSection (void)
 {
+	if (m_deferred && m_deferred->isCapturing())
+		m_deferred->endSection();
+
 	if (qpTestLog_endSection(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::startShaderProgram (bool linkOk, const char* linkInfoLog)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		DeferredCommand command (DeferredCommand::TYPE_START_SHADER_PROGRAM);
+
+		command.isOk		= linkOk;
+		command.description	= linkInfoLog;
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (qpTestLog_startShaderProgram(m_log, linkOk?DE_TRUE:DE_FALSE, linkInfoLog) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::endShaderProgram (void)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		m_deferred->add(DeferredCommand(DeferredCommand::TYPE_END_SHADER_PROGRAM));
+		return;
+	}
+
 	if (qpTestLog_endShaderProgram(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::writeShader (qpShaderType type, const char* source, bool compileOk, const char* infoLog)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		DeferredCommand command (DeferredCommand::TYPE_SHADER);
+
+		command.shaderType	= type;
+		command.source		= source;
+		command.isOk		= compileOk;
+		command.description	= infoLog;
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (qpTestLog_writeShader(m_log, type, source, compileOk?DE_TRUE:DE_FALSE, infoLog) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::writeSpirVAssemblySource (const char* source)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		DeferredCommand command (DeferredCommand::TYPE_SPIRV_ASSEMBLY_SOURCE);
+
+		command.source = source;
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (qpTestLog_writeSpirVAssemblySource(m_log, source) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::writeKernelSource (const char* source)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		DeferredCommand command (DeferredCommand::TYPE_KERNEL_SOURCE);
+
+		command.source = source;
+
+		m_deferred->add(command);
+		return;
+	}
+
 	if (qpTestLog_writeKernelSource(m_log, source) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
+void TestLog::writeDeferred (de::MovePtr<DeferredLogContent> content)
+{
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		DeferredCommand command (DeferredCommand::TYPE_CONTENT);
+
+		command.content = de::SharedPtr<const DeferredLogContent>(content.release());
+
+		m_deferred->add(command);
+	}
+	else
+		content->write(*this);
+}
+
 void TestLog::writeCompileInfo (const char* name, const char* description, bool compileOk, const char* infoLog)
 {
 	if (qpTestLog_writeCompileInfo(m_log, name, description, compileOk ? DE_TRUE : DE_FALSE, infoLog) == DE_FALSE)
@@ -445,16 +924,33 @@ void TestLog::startCase (const char* testCasePath, qpTestCaseType testCaseType)
 {
 	if (qpTestLog_startCase(m_log, testCasePath, testCaseType) == DE_FALSE)
 		throw LogWriteFailedError();
+
+	if (m_deferred)
+		m_deferred->begin();
 }
 
 void TestLog::endCase (qpTestResult result, const char* description)
 {
+	if (m_deferred && m_deferred->isCapturing())
+	{
+		const std::string			summary		= m_deferred->getSummary();
+		std::vector<DeferredUnit>	units;
+
+		m_deferred->end(units);
+
+		if (result != QP_TEST_RESULT_PASS)
+			writeDeferredUnits(*this, units);
+		else if (!units.empty())
+			writeMessage(summary.c_str());
+	}
+
 	if (qpTestLog_endCase(m_log, result, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
 
 void TestLog::terminateCase (qpTestResult result)
 {
+	// \note Captured details are not written since this may be called from another thread. They are dropped in next startCase().
 	if (qpTestLog_terminateCase(m_log, result) == DE_FALSE)
 		throw LogWriteFailedError();
 }
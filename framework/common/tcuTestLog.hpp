@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "qpTestLog.h"
 #include "tcuTexture.hpp"
+#include "deUniquePtr.hpp"
 
 #include <sstream>
 
@@ -44,6 +45,7 @@ class LogKernelSource;
 class LogSampleList;
 class LogValueInfo;
 class SampleBuilder;
+class DeferredLogContent;
 template<typename T> class LogNumber;
 
 /*--------------------------------------------------------------------*//*!
@@ -73,6 +75,14 @@ template<typename T> class LogNumber;
  *     << TestLog::Image("ImageB", "Image B", imageB)
  *     << TestLog::EndImageSet << TestLog::EndSection;
  * \endcode
+ *
+ * If the log is created with QP_TEST_LOG_DETAILS_ON_FAILURE flag, images,
+ * image sets, shader programs and sources, and deferred content written
+ * during a test case are captured into memory instead. Captured content is
+ * written at the end of the case if the result is not pass, and otherwise
+ * replaced with a message summarizing what was omitted. Image contents are
+ * copied when captured, but conversion and compression are only done if
+ * the content is written.
  *//*--------------------------------------------------------------------*/
 class TestLog
 {
@@ -149,6 +159,7 @@ public:
 	void				writeSpirVAssemblySource(const char* source);
 	void				writeKernelSource		(const char* source);
 	void				writeCompileInfo		(const char* name, const char* description, bool compileOk, const char* infoLog);
+	void				writeDeferred			(de::MovePtr<DeferredLogContent> content);
 
 	void				writeFloat				(const char* name, const char* description, const char* unit, qpKeyValueTag tag, float value);
 	void				writeInteger			(const char* name, const char* description, const char* unit, qpKeyValueTag tag, deInt64 value);
@@ -175,7 +186,10 @@ private:
 						TestLog					(const TestLog& other); // Not allowed!
 	TestLog&			operator=				(const TestLog& other); // Not allowed!
 
+	class DeferredDetails;
+
 	qpTestLog*			m_log;
+	DeferredDetails*	m_deferred;				//!< Details captured from current case, null unless QP_TEST_LOG_DETAILS_ON_FAILURE is set.
 };
 
 class MessageBuilder
@@ -232,6 +246,21 @@ private:
 	std::vector<Value>		m_values;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Log content that is expensive to produce
+ *
+ * write() is called either immediately by TestLog::writeDeferred(), or
+ * at the end of the test case if details are written only for failing
+ * cases. In the latter case write() may not be called at all, and
+ * content must not reference any resources owned by the test case.
+ *//*--------------------------------------------------------------------*/
+class DeferredLogContent
+{
+public:
+	virtual					~DeferredLogContent	(void) {}
+	virtual void			write				(TestLog& log) const = 0;
+};
+
 class LogImageSet
 {
 public:
@@ -58,6 +58,10 @@ public:
 	virtual void						init				(TestCase* testCase, const std::string& path) = 0;
 	virtual void						deinit				(TestCase* testCase) = 0;
 	virtual TestNode::IterateResult		iterate				(TestCase* testCase) = 0;
+
+	//! Hint that given case will be executed soon. Executor may start preparing it in the background.
+	//! Errors in preparation must be reported by init() of that case; exceptions thrown here are ignored.
+	virtual void						prepare				(TestCase* testCase, const std::string& path) { DE_UNREF(testCase); DE_UNREF(path); }
 };
 
 /*--------------------------------------------------------------------*//*!
@@ -74,6 +78,9 @@ public:
 
 	virtual TestCaseExecutor*		createExecutor		(void) const = 0;
 
+	//! Can top-level groups be initialized concurrently from multiple threads. Used when exporting case lists.
+	virtual bool					isConcurrentGroupInitSupported	(void) const { return false; }
+
 	// Deprecated
 	virtual Archive*				getArchive			(void) { return DE_NULL; }
 
@@ -56,10 +56,23 @@ TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& te
 	, m_isInTestCase	(false)
 	, m_testStartTime	(0)
 {
+	if (const char* const traceFileName = testCtx.getCommandLine().getTraceFileName())
+	{
+		m_traceWriter = de::MovePtr<ProfileTraceWriter>(new ProfileTraceWriter(traceFileName));
+		profiler::setEnabled(true);
+	}
+
+	if (testCtx.getCommandLine().isMemoryStatsEnabled())
+		memstats::setEnabled(true);
 }
 
 TestSessionExecutor::~TestSessionExecutor (void)
 {
+	if (m_traceWriter)
+		profiler::setEnabled(false);
+
+	if (m_testCtx.getCommandLine().isMemoryStatsEnabled())
+		memstats::setEnabled(false);
 }
 
 bool TestSessionExecutor::iterate (void)
@@ -172,13 +185,33 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 
 	m_testCtx.setTestResult(QP_TEST_RESULT_LAST, "");
 	m_testCtx.setTerminateAfter(false);
+
+	// Look-ahead work belongs to later cases, so it is done before this case is started and measured.
+	prepareUpcomingCases();
+
 	log.startCase(casePath.c_str(), caseType);
 
+	if (profiler::isEnabled())
+	{
+		// Discard events recorded outside test cases, e.g. during package init.
+		std::vector<ProfileEvent> staleEvents;
+		profiler::collect(staleEvents);
+		profiler::getNumDropped();
+	}
+
 	m_isInTestCase	= true;
 	m_testStartTime	= deGetMicroseconds();
+	m_casePath		= casePath;
+
+	m_testCtx.getReferenceImageCache().setCasePath(casePath);
+
+	if (memstats::isEnabled())
+		m_memoryStats.begin();
 
 	try
 	{
+		const ProfileScope profile ("init");
+
 		m_caseExecutor->init(testCase, casePath);
 		initOk = true;
 	}
@@ -208,13 +241,62 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 	return initOk;
 }
 
+void TestSessionExecutor::prepareUpcomingCases (void)
+{
+	const int maxCases = m_testCtx.getCommandLine().getPrepareAheadCount();
+
+	if (maxCases > 0)
+	{
+		std::vector<TestCase*>		cases;
+		std::vector<std::string>	casePaths;
+
+		try
+		{
+			m_iterator.getUpcomingCases(maxCases, cases, casePaths);
+		}
+		catch (const std::bad_alloc&)
+		{
+			return;
+		}
+
+		// Preparation is only a hint. If it fails, the case is prepared again when it is
+		// entered and the error is reported for that case, not the current one.
+		for (size_t caseNdx = 0; caseNdx < cases.size(); caseNdx++)
+		{
+			try
+			{
+				m_caseExecutor->prepare(cases[caseNdx], casePaths[caseNdx]);
+			}
+			catch (const std::bad_alloc&)
+			{
+				// Ignore
+			}
+			catch (const tcu::Exception&)
+			{
+				// Ignore
+			}
+		}
+	}
+}
+
 void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 {
 	TestLog&	log		= m_testCtx.getLog();
 
+	// Verification tasks left behind, for example by an exception in iterate(), must not outlive the case.
+	if (m_testCtx.getAsyncVerifier().getNumPending() > 0)
+	{
+		m_testCtx.getAsyncVerifier().discard();
+
+		if (m_testCtx.getTestResult() == QP_TEST_RESULT_PASS)
+			m_testCtx.setTestResult(QP_TEST_RESULT_INTERNAL_ERROR, "Asynchronous verification results were not joined");
+	}
+
 	// De-init case.
 	try
 	{
+		const ProfileScope profile ("deinit");
+
 		m_caseExecutor->deinit(testCase);
 	}
 	catch (const tcu::Exception& e)
@@ -224,9 +306,25 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 	}
 
 	{
-		const deInt64 duration = deGetMicroseconds()-m_testStartTime;
+		const deUint64	endTime		= deGetMicroseconds();
+		const deInt64	duration	= (deInt64)(endTime-m_testStartTime);
+
+		if (profiler::isEnabled())
+		{
+			std::vector<ProfileEvent>	events;
+			profiler::collect(events);
+
+			logProfileSummary(log, events, profiler::getNumDropped());
+
+			if (m_traceWriter)
+				m_traceWriter->writeCase(m_casePath, m_testStartTime, endTime, events);
+		}
+
 		m_testStartTime = 0;
 		m_testCtx.getLog() << TestLog::Integer("TestDuration", "Test case duration in microseconds", "us", QP_KEY_TAG_TIME, duration);
+
+		if (memstats::isEnabled())
+			logMemoryStats(log, m_memoryStats.end());
 	}
 
 	{
@@ -269,6 +367,8 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 
 	try
 	{
+		const ProfileScope profile ("iterate");
+
 		iterateResult = m_caseExecutor->iterate(testCase);
 	}
 	catch (const std::bad_alloc&)
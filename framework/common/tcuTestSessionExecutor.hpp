@@ -28,6 +28,8 @@
 #include "tcuTestCase.hpp"
 #include "tcuTestPackage.hpp"
 #include "tcuTestHierarchyIterator.hpp"
+#include "tcuProfiler.hpp"
+#include "tcuMemoryStats.hpp"
 #include "deUniquePtr.hpp"
 
 namespace tcu
@@ -76,6 +78,8 @@ private:
 	TestCase::IterateResult			iterateTestCase		(TestCase* testCase);
 	void							leaveTestCase		(TestCase* testCase);
 
+	void							prepareUpcomingCases(void);
+
 	enum State
 	{
 		STATE_TRAVERSE_HIERARCHY = 0,
@@ -96,6 +100,10 @@ private:
 	bool							m_abortSession;
 	bool							m_isInTestCase;
 	deUint64						m_testStartTime;
+
+	de::MovePtr<ProfileTraceWriter>	m_traceWriter;
+	MemoryStatsTracker				m_memoryStats;
+	std::string						m_casePath;
 };
 
 } // tcu
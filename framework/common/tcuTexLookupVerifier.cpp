@@ -27,6 +27,12 @@
 #include "tcuVectorUtil.hpp"
 #include "tcuTextureUtil.hpp"
 #include "deMath.h"
+#include "deAtomic.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+
+#include <vector>
+#include <limits>
 
 namespace tcu
 {
@@ -2608,4 +2614,298 @@ bool isGatherResultValid (const TextureCubeView&		texture,
 	return isCubeGatherResultValid(texture, sampler, prec, coord, componentNdx, result);
 }
 
+// Batched verification
+
+namespace
+{
+
+enum
+{
+	MIN_QUERIES_PER_THREAD		= 256	//!< Don't spawn threads for smaller batches.
+};
+
+bool isFinite (const Vec4& v)
+{
+	for (int ndx = 0; ndx < 4; ndx++)
+	{
+		if (deFloatIsNaN(v[ndx]) || deFloatIsInf(v[ndx]))
+			return false;
+	}
+
+	return true;
+}
+
+//! Range of values lookup<float>() can return for a texture level.
+struct LevelColorRange
+{
+	Vec4	minVal;
+	Vec4	maxVal;
+	Vec4	maxAbs;
+	bool	allFinite;
+
+	LevelColorRange (const ConstPixelBufferAccess& level, const Sampler& sampler)
+		: minVal	(std::numeric_limits<float>::infinity())
+		, maxVal	(-std::numeric_limits<float>::infinity())
+		, maxAbs	(0.0f)
+		, allFinite	(true)
+	{
+		DE_ASSERT(level.getDepth() == 1);
+
+		// Decode each texel once, the same way lookup<float>() does.
+		for (int y = 0; y < level.getHeight(); y++)
+		for (int x = 0; x < level.getWidth(); x++)
+			add(lookup<float>(level, sampler, x, y, 0));
+
+		// Border color is only used when coordinates are clamped to border.
+		if (sampler.wrapS == Sampler::CLAMP_TO_BORDER || sampler.wrapT == Sampler::CLAMP_TO_BORDER)
+			add(sampleTextureBorder<float>(level.getFormat(), sampler));
+	}
+
+	void add (const Vec4& color)
+	{
+		minVal		= min(minVal, color);
+		maxVal		= max(maxVal, color);
+		maxAbs		= max(maxAbs, abs(color));
+		allFinite	= allFinite && isFinite(color);
+	}
+};
+
+class BatchLookupVerifier2D
+{
+public:
+	BatchLookupVerifier2D (const Texture2DView&				texture,
+						   const Sampler&					sampler,
+						   const LookupPrecision&			prec,
+						   const ConstPixelBufferAccess&	result,
+						   const LookupQuery2D*				queries,
+						   int								numQueries,
+						   qpWatchDog*						watchDog)
+		: m_texture		(texture)
+		, m_sampler		(sampler)
+		, m_prec		(prec)
+		, m_result		(result)
+		, m_queries		(queries)
+		, m_watchDog	(watchDog)
+		, m_rowStart	(result.getHeight()+1, 0)
+		, m_rowQueries	(numQueries)
+		, m_isValid		(numQueries, 0)
+		, m_nextRow		(0)
+	{
+		for (int levelNdx = 0; levelNdx < texture.getNumLevels(); levelNdx++)
+			m_levelRanges.push_back(LevelColorRange(texture.getLevel(levelNdx), sampler));
+
+		// Bucket queries by result row.
+		for (int queryNdx = 0; queryNdx < numQueries; queryNdx++)
+		{
+			DE_ASSERT(de::inBounds(queries[queryNdx].pixel.y(), 0, result.getHeight()));
+			m_rowStart[queries[queryNdx].pixel.y()+1] += 1;
+		}
+
+		for (int rowNdx = 0; rowNdx < result.getHeight(); rowNdx++)
+			m_rowStart[rowNdx+1] += m_rowStart[rowNdx];
+
+		{
+			std::vector<int> rowPos (m_rowStart.begin(), m_rowStart.end()-1);
+
+			for (int queryNdx = 0; queryNdx < numQueries; queryNdx++)
+				m_rowQueries[rowPos[queries[queryNdx].pixel.y()]++] = queryNdx;
+		}
+	}
+
+	//! Verify rows until all rows have been claimed. Called from all verification threads.
+	void processRows (bool isMainThread)
+	{
+		for (;;)
+		{
+			const int rowNdx = (int)deAtomicIncrementInt32(&m_nextRow) - 1;
+
+			if (rowNdx >= m_result.getHeight())
+				break;
+
+			for (int ndx = m_rowStart[rowNdx]; ndx < m_rowStart[rowNdx+1]; ndx++)
+				m_isValid[m_rowQueries[ndx]] = verifyQuery(m_queries[m_rowQueries[ndx]]) ? 1 : 0;
+
+			if (isMainThread && m_watchDog)
+				qpWatchDog_touch(m_watchDog);
+		}
+	}
+
+	bool isValid (int queryNdx) const
+	{
+		return m_isValid[queryNdx] != 0;
+	}
+
+private:
+	bool verifyQuery (const LookupQuery2D& query) const
+	{
+		const Vec4 result = m_result.getPixel(query.pixel.x(), query.pixel.y());
+
+		if (isOutsideLevelColorRange(query, result))
+			return false;
+
+		return isLookupResultValid(m_texture, m_sampler, m_prec, query.coord, query.lodBounds, result);
+	}
+
+	//! Cheap early rejection. Must never reject result accepted by isLookupResultValid().
+	bool isOutsideLevelColorRange (const LookupQuery2D& query, const Vec4& result) const
+	{
+		const float		minLod			= query.lodBounds.x();
+		const float		maxLod			= query.lodBounds.y();
+		const bool		canBeMagnified	= minLod <= m_sampler.lodThreshold;
+		const bool		canBeMinified	= maxLod > m_sampler.lodThreshold;
+		const int		maxTexLevel		= m_texture.getNumLevels()-1;
+		int				minLevel		= canBeMagnified ? 0 : maxTexLevel;
+		int				maxLevel		= 0;
+		Vec4			minVal			(std::numeric_limits<float>::infinity());
+		Vec4			maxVal			(-std::numeric_limits<float>::infinity());
+		Vec4			maxAbs			(0.0f);
+
+		if (!isFinite(result))
+			return false;
+
+		// Same level selection as in isLookupResultValid().
+		if (canBeMinified)
+		{
+			if (isLinearMipmapFilter(m_sampler.minFilter) && maxTexLevel > 0)
+			{
+				minLevel = de::min(minLevel, de::clamp((int)deFloatFloor(minLod), 0, maxTexLevel-1));
+				maxLevel = de::max(maxLevel, de::clamp((int)deFloatFloor(maxLod), 0, maxTexLevel-1)+1);
+			}
+			else if (isNearestMipmapFilter(m_sampler.minFilter))
+			{
+				minLevel = de::min(minLevel, de::clamp((int)deFloatCeil(minLod + 0.5f) - 1,	0, maxTexLevel));
+				maxLevel = de::max(maxLevel, de::clamp((int)deFloatFloor(maxLod + 0.5f),	0, maxTexLevel));
+			}
+			else
+				minLevel = 0;
+		}
+
+		if (minLevel > maxLevel)
+			return false;
+
+		// Range only grows, so give up as soon as result falls within it.
+		for (int levelNdx = minLevel; levelNdx <= maxLevel; levelNdx++)
+		{
+			const LevelColorRange& range = m_levelRanges[levelNdx];
+
+			if (!range.allFinite)
+				return false;
+
+			minVal	= min(minVal, range.minVal);
+			maxVal	= max(maxVal, range.maxVal);
+			maxAbs	= max(maxAbs, range.maxAbs);
+
+			if (isInColorRange(minVal, maxVal, maxAbs, result))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool isInColorRange (const Vec4& minVal, const Vec4& maxVal, const Vec4& maxAbs, const Vec4& result) const
+	{
+		for (int compNdx = 0; compNdx < 4; compNdx++)
+		{
+			if (!m_prec.colorMask[compNdx])
+				continue;
+
+			// \note Filtering computations in the full verifier may round slightly outside the
+			//		 texel value range. Margin is orders of magnitude larger than that error.
+			const float	margin	= (maxAbs[compNdx] + de::abs(result[compNdx])) * (1.0f / float(1<<12));
+			const float	lo		= minVal[compNdx] - m_prec.colorThreshold[compNdx] - margin;
+			const float	hi		= maxVal[compNdx] + m_prec.colorThreshold[compNdx] + margin;
+
+			if (!(result[compNdx] >= lo && result[compNdx] <= hi))
+				return false;
+		}
+
+		return true;
+	}
+
+	const Texture2DView&							m_texture;
+	const Sampler&									m_sampler;
+	const LookupPrecision&							m_prec;
+	const ConstPixelBufferAccess&					m_result;
+	const LookupQuery2D* const						m_queries;
+	qpWatchDog* const								m_watchDog;
+
+	std::vector<LevelColorRange>					m_levelRanges;
+	std::vector<int>								m_rowStart;		//!< First index in m_rowQueries for each row.
+	std::vector<int>								m_rowQueries;	//!< Query indices sorted by row.
+	std::vector<deUint8>							m_isValid;
+	volatile deInt32								m_nextRow;
+};
+
+class BatchLookupVerifyThread : public de::Thread
+{
+public:
+	BatchLookupVerifyThread (BatchLookupVerifier2D& verifier)
+		: m_verifier(verifier)
+	{
+	}
+
+	void run (void)
+	{
+		m_verifier.processRows(false);
+	}
+
+private:
+	BatchLookupVerifier2D&	m_verifier;
+};
+
+} // anonymous
+
+int verifyLookupResults (const Texture2DView&			texture,
+						 const Sampler&					sampler,
+						 const LookupPrecision&			prec,
+						 const ConstPixelBufferAccess&	result,
+						 const LookupQuery2D*			queries,
+						 int							numQueries,
+						 const PixelBufferAccess&		errorMask,
+						 qpWatchDog*					watchDog)
+{
+	DE_ASSERT(isSamplerSupported(sampler));
+	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
+
+	BatchLookupVerifier2D										verifier		(texture, sampler, prec, result, queries, numQueries, watchDog);
+	const int													numThreads		= de::min((int)deGetNumAvailableLogicalCores(), numQueries / MIN_QUERIES_PER_THREAD);
+	std::vector<de::SharedPtr<BatchLookupVerifyThread> >		threads;
+	int															numFailed		= 0;
+
+	// Calling thread verifies rows as well.
+	try
+	{
+		for (int threadNdx = 1; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<BatchLookupVerifyThread>(new BatchLookupVerifyThread(verifier)));
+			threads.back()->start();
+		}
+
+		verifier.processRows(true);
+	}
+	catch (...)
+	{
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		{
+			if (threads[threadNdx]->isStarted())
+				threads[threadNdx]->join();
+		}
+		throw;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		threads[threadNdx]->join();
+
+	for (int queryNdx = 0; queryNdx < numQueries; queryNdx++)
+	{
+		if (!verifier.isValid(queryNdx))
+		{
+			errorMask.setPixel(Vec4(1.0f, 0.0f, 0.0f, 1.0f), queries[queryNdx].pixel.x(), queries[queryNdx].pixel.y());
+			numFailed += 1;
+		}
+	}
+
+	return numFailed;
+}
+
 } // tcu
@@ -26,6 +26,7 @@
 
 #include "tcuDefs.hpp"
 #include "tcuTexture.hpp"
+#include "qpWatchDog.h"
 
 namespace tcu
 {
@@ -123,6 +124,44 @@ bool		isLookupResultValid					(const Texture2DArrayView&		texture, const Sampler
 bool		isLookupResultValid					(const Texture3DView&			texture, const Sampler& sampler, const LookupPrecision& prec, const Vec3& coord, const Vec2& lodBounds, const Vec4& result);
 bool		isLookupResultValid					(const TextureCubeArrayView&	texture, const Sampler& sampler, const LookupPrecision& prec, const IVec4& coordBits, const Vec4& coord, const Vec2& lodBounds, const Vec4& result);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Result pixel to verify in batched lookup verification.
+ *//*--------------------------------------------------------------------*/
+struct LookupQuery2D
+{
+	IVec2		pixel;		//!< Pixel in result image and error mask.
+	Vec2		coord;		//!< Lookup coordinates.
+	Vec2		lodBounds;	//!< Lod bounds, see isLookupResultValid().
+
+	LookupQuery2D (void)
+	{
+	}
+
+	LookupQuery2D (const IVec2& pixel_, const Vec2& coord_, const Vec2& lodBounds_)
+		: pixel		(pixel_)
+		, coord		(coord_)
+		, lodBounds	(lodBounds_)
+	{
+	}
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Verify lookup results for a set of result pixels.
+ *
+ * Gives the same result as calling isLookupResultValid() for each query
+ * with result.getPixel(query.pixel), but texels of each level are decoded
+ * only once to find the level's value range, results clearly outside the
+ * range of all candidate levels are rejected without the full search and
+ * result rows are verified on multiple threads.
+ *
+ * Invalid pixels are set to red in errorMask, other pixels are not
+ * modified.
+ *
+ * \param watchDog	Watchdog to touch while verifying, or DE_NULL
+ * \return Number of invalid pixels
+ *//*--------------------------------------------------------------------*/
+int			verifyLookupResults					(const Texture2DView& texture, const Sampler& sampler, const LookupPrecision& prec, const ConstPixelBufferAccess& result, const LookupQuery2D* queries, int numQueries, const PixelBufferAccess& errorMask, qpWatchDog* watchDog);
+
 bool		isLevel1DLookupResultValid			(const ConstPixelBufferAccess& access, const Sampler& sampler, TexLookupScaleMode scaleMode, const LookupPrecision& prec, const float coordX, const int coordY, const Vec4& result);
 bool		isLevel1DLookupResultValid			(const ConstPixelBufferAccess& access, const Sampler& sampler, TexLookupScaleMode scaleMode, const IntLookupPrecision& prec, const float coordX, const int coordY, const IVec4& result);
 bool		isLevel1DLookupResultValid			(const ConstPixelBufferAccess& access, const Sampler& sampler, TexLookupScaleMode scaleMode, const IntLookupPrecision& prec, const float coordX, const int coordY, const UVec4& result);
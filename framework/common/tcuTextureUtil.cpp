@@ -1009,6 +1009,207 @@ void fillWithMetaballs (const PixelBufferAccess& dst, int numBalls, deUint32 see
 	}
 }
 
+namespace
+{
+
+// Channel conversion kernels for copy(). Kernel is selected based on source and
+// destination formats, and produces bit-exact same results as the generic
+// getPixel() / setPixel() path.
+
+enum
+{
+	COPY_CHANNEL_ZERO	= -1,	//!< Destination channel is zero
+	COPY_CHANNEL_ONE	= -2	//!< Destination channel is one
+};
+
+enum CopyKernelType
+{
+	COPYKERNEL_GENERIC = 0,			//!< No specialized kernel
+	COPYKERNEL_SWIZZLE_8,			//!< Same channel type with 8-bit channels, only channel order differs
+	COPYKERNEL_SWIZZLE_16,			//!< Same channel type with 16-bit channels, only channel order differs
+	COPYKERNEL_SWIZZLE_32,			//!< Same channel type with 32-bit channels, only channel order differs
+	COPYKERNEL_UNORM8_TO_FLOAT,		//!< 8-bit unorm to float
+	COPYKERNEL_UNORM16_TO_FLOAT,	//!< 16-bit unorm to float
+
+	COPYKERNEL_LAST
+};
+
+struct CopyKernel
+{
+	CopyKernelType	type;
+	int				numDstChannels;
+	int				channelMap[4];	//!< Source channel for each destination channel, or COPY_CHANNEL_ZERO / COPY_CHANNEL_ONE
+	deUint32		oneValue;		//!< Bit pattern of one in destination channel type
+};
+
+bool isSwizzleCopyType (TextureFormat::ChannelType type)
+{
+	// Types that are converted to Vec4 / IVec4 and back without loss.
+	switch (type)
+	{
+		case TextureFormat::UNORM_INT8:
+		case TextureFormat::UNORM_INT16:
+		case TextureFormat::SIGNED_INT8:
+		case TextureFormat::SIGNED_INT16:
+		case TextureFormat::SIGNED_INT32:
+		case TextureFormat::UNSIGNED_INT8:
+		case TextureFormat::UNSIGNED_INT16:
+		case TextureFormat::UNSIGNED_INT32:
+		case TextureFormat::FLOAT:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+deUint32 getOneValueBits (TextureFormat::ChannelType type)
+{
+	switch (type)
+	{
+		case TextureFormat::UNORM_INT8:		return 0xffu;
+		case TextureFormat::UNORM_INT16:	return 0xffffu;
+		case TextureFormat::FLOAT:			return 0x3f800000u;
+		default:							return 1u;
+	}
+}
+
+CopyKernel selectCopyKernel (const TextureFormat& dstFormat, const TextureFormat& srcFormat)
+{
+	CopyKernel	kernel;
+
+	kernel.type				= COPYKERNEL_GENERIC;
+	kernel.numDstChannels	= 0;
+	kernel.oneValue			= 0;
+
+	if (!isSwizzleCopyType(srcFormat.type) || !isSwizzleCopyType(dstFormat.type) ||
+		srcFormat.order == TextureFormat::D || srcFormat.order == TextureFormat::S || srcFormat.order == TextureFormat::DS ||
+		dstFormat.order == TextureFormat::D || dstFormat.order == TextureFormat::S || dstFormat.order == TextureFormat::DS)
+		return kernel;
+
+	if (srcFormat.type == dstFormat.type)
+	{
+		switch (getChannelSize(dstFormat.type))
+		{
+			case 1:		kernel.type = COPYKERNEL_SWIZZLE_8;		break;
+			case 2:		kernel.type = COPYKERNEL_SWIZZLE_16;	break;
+			case 4:		kernel.type = COPYKERNEL_SWIZZLE_32;	break;
+			default:
+				DE_ASSERT(false);
+				return kernel;
+		}
+	}
+	else if (srcFormat.type == TextureFormat::UNORM_INT8 && dstFormat.type == TextureFormat::FLOAT)
+		kernel.type = COPYKERNEL_UNORM8_TO_FLOAT;
+	else if (srcFormat.type == TextureFormat::UNORM_INT16 && dstFormat.type == TextureFormat::FLOAT)
+		kernel.type = COPYKERNEL_UNORM16_TO_FLOAT;
+	else
+		return kernel;
+
+	// Destination channel c gets color[writeSwizzle[c]], and color[i] is either a source channel or a constant.
+	{
+		const TextureSwizzle::Channel* const	readMap		= getChannelReadSwizzle(srcFormat.order).components;
+		const TextureSwizzle::Channel* const	writeMap	= getChannelWriteSwizzle(dstFormat.order).components;
+
+		kernel.numDstChannels	= getNumUsedChannels(dstFormat.order);
+		kernel.oneValue			= getOneValueBits(dstFormat.type);
+
+		for (int c = 0; c < kernel.numDstChannels; c++)
+		{
+			DE_ASSERT(deInRange32(writeMap[c], TextureSwizzle::CHANNEL_0, TextureSwizzle::CHANNEL_3));
+
+			switch (readMap[writeMap[c]])
+			{
+				case TextureSwizzle::CHANNEL_0:
+				case TextureSwizzle::CHANNEL_1:
+				case TextureSwizzle::CHANNEL_2:
+				case TextureSwizzle::CHANNEL_3:
+					kernel.channelMap[c] = (int)readMap[writeMap[c]];
+					break;
+
+				case TextureSwizzle::CHANNEL_ZERO:
+					kernel.channelMap[c] = COPY_CHANNEL_ZERO;
+					break;
+
+				case TextureSwizzle::CHANNEL_ONE:
+					kernel.channelMap[c] = COPY_CHANNEL_ONE;
+					break;
+
+				default:
+					DE_ASSERT(false);
+					kernel.type = COPYKERNEL_GENERIC;
+					return kernel;
+			}
+		}
+	}
+
+	return kernel;
+}
+
+template <typename T>
+void copySwizzledRow (const CopyKernel& kernel, deUint8* dstRow, int dstPixelPitch, const deUint8* srcRow, int srcPixelPitch, int width)
+{
+	T	constants[4];
+
+	for (int c = 0; c < kernel.numDstChannels; c++)
+		constants[c] = (kernel.channelMap[c] == COPY_CHANNEL_ONE) ? (T)kernel.oneValue : T(0);
+
+	for (int x = 0; x < width; x++)
+	{
+		const T* const	srcPixel	= (const T*)(srcRow + x*srcPixelPitch);
+		T* const		dstPixel	= (T*)(dstRow + x*dstPixelPitch);
+
+		for (int c = 0; c < kernel.numDstChannels; c++)
+			dstPixel[c] = (kernel.channelMap[c] >= 0) ? srcPixel[kernel.channelMap[c]] : constants[c];
+	}
+}
+
+template <typename T>
+void copyUnormToFloatRow (const CopyKernel& kernel, deUint8* dstRow, int dstPixelPitch, const deUint8* srcRow, int srcPixelPitch, int width)
+{
+	const float	maxValue	= (float)std::numeric_limits<T>::max();
+	float		constants[4];
+
+	for (int c = 0; c < kernel.numDstChannels; c++)
+		constants[c] = (kernel.channelMap[c] == COPY_CHANNEL_ONE) ? 1.0f : 0.0f;
+
+	for (int x = 0; x < width; x++)
+	{
+		const T* const	srcPixel	= (const T*)(srcRow + x*srcPixelPitch);
+		float* const	dstPixel	= (float*)(dstRow + x*dstPixelPitch);
+
+		for (int c = 0; c < kernel.numDstChannels; c++)
+			dstPixel[c] = (kernel.channelMap[c] >= 0) ? (float)srcPixel[kernel.channelMap[c]] / maxValue : constants[c];
+	}
+}
+
+void copyWithKernel (const CopyKernel& kernel, const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
+{
+	typedef void (*CopyRowFunc) (const CopyKernel&, deUint8*, int, const deUint8*, int, int);
+
+	static const CopyRowFunc s_rowFuncs[] =
+	{
+		DE_NULL,
+		copySwizzledRow<deUint8>,
+		copySwizzledRow<deUint16>,
+		copySwizzledRow<deUint32>,
+		copyUnormToFloatRow<deUint8>,
+		copyUnormToFloatRow<deUint16>,
+	};
+	DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(s_rowFuncs) == COPYKERNEL_LAST);
+	DE_ASSERT(de::inBounds<int>(kernel.type, COPYKERNEL_GENERIC+1, COPYKERNEL_LAST));
+
+	const CopyRowFunc	copyRow			= s_rowFuncs[kernel.type];
+	const int			srcPixelPitch	= src.getPixelPitch();
+	const int			dstPixelPitch	= dst.getPixelPitch();
+
+	for (int z = 0; z < dst.getDepth(); z++)
+	for (int y = 0; y < dst.getHeight(); y++)
+		copyRow(kernel, (deUint8*)dst.getPixelPtr(0, y, z), dstPixelPitch, (const deUint8*)src.getPixelPtr(0, y, z), srcPixelPitch, dst.getWidth());
+}
+
+} // anonymous
+
 void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 {
 	DE_ASSERT(src.getSize() == dst.getSize());
@@ -1029,12 +1230,25 @@ void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 	const bool	dstHasDepth			= (dst.getFormat().order == tcu::TextureFormat::DS || dst.getFormat().order == tcu::TextureFormat::D);
 	const bool	dstHasStencil		= (dst.getFormat().order == tcu::TextureFormat::DS || dst.getFormat().order == tcu::TextureFormat::S);
 
+	const CopyKernel	colorKernel	= selectCopyKernel(dst.getFormat(), src.getFormat());
+
 	if (src.getFormat() == dst.getFormat() && srcTightlyPacked && dstTightlyPacked)
 	{
 		// Fast-path for matching formats.
-		for (int z = 0; z < depth; z++)
-		for (int y = 0; y < height; y++)
-			deMemcpy(dst.getPixelPtr(0, y, z), src.getPixelPtr(0, y, z), srcPixelSize*width);
+		const int	rowSize	= srcPixelSize*width;
+
+		if (src.getRowPitch() == rowSize && dst.getRowPitch() == rowSize)
+		{
+			// Rows are contiguous, copy whole slices.
+			for (int z = 0; z < depth; z++)
+				deMemcpy(dst.getPixelPtr(0, 0, z), src.getPixelPtr(0, 0, z), rowSize*height);
+		}
+		else
+		{
+			for (int z = 0; z < depth; z++)
+			for (int y = 0; y < height; y++)
+				deMemcpy(dst.getPixelPtr(0, y, z), src.getPixelPtr(0, y, z), rowSize);
+		}
 	}
 	else if (src.getFormat() == dst.getFormat())
 	{
@@ -1074,6 +1288,11 @@ void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 			tcu::clearStencil(dst, 0u);
 		}
 	}
+	else if (colorKernel.type != COPYKERNEL_GENERIC)
+	{
+		// Specialized conversion kernel.
+		copyWithKernel(colorKernel, dst, src);
+	}
 	else
 	{
 		TextureChannelClass		srcClass	= getTextureChannelClass(src.getFormat().type);
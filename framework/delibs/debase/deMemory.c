@@ -52,6 +52,48 @@
 
 DE_BEGIN_EXTERN_C
 
+static volatile deInt32		s_countAllocations	= 0;
+static volatile deUint32	s_numAllocations	= 0;
+
+DE_INLINE void countAllocation (void)
+{
+	/* Cost when counting is disabled is a single flag check. */
+	if (s_countAllocations)
+	{
+#if (DE_COMPILER == DE_COMPILER_MSC)
+		_InterlockedIncrement((volatile long*)&s_numAllocations);
+#elif (DE_COMPILER == DE_COMPILER_GCC) || (DE_COMPILER == DE_COMPILER_CLANG)
+		__sync_add_and_fetch(&s_numAllocations, 1u);
+#else
+		/* Not thread-safe, count is approximate. */
+		s_numAllocations += 1;
+#endif
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Enable or disable counting allocations made through deMalloc() and friends.
+ * \param enabled	True to enable counting.
+ *//*--------------------------------------------------------------------*/
+void deMemory_setAllocationCountingEnabled (deBool enabled)
+{
+	s_countAllocations = enabled ? 1 : 0;
+}
+
+deBool deMemory_isAllocationCountingEnabled (void)
+{
+	return s_countAllocations != 0;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get number of allocations counted so far.
+ * \return Allocation count. Value wraps around, so use only differences.
+ *//*--------------------------------------------------------------------*/
+deUint32 deMemory_getNumAllocations (void)
+{
+	return s_numAllocations;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Allocate a chunk of memory.
  * \param numBytes	Number of bytes to allocate.
@@ -63,6 +105,8 @@ void* deMalloc (size_t numBytes)
 
 	DE_ASSERT(numBytes > 0);
 
+	countAllocation();
+
 	ptr = malloc((size_t)numBytes);
 
 #if defined(DE_DEBUG)
@@ -103,6 +147,8 @@ void* deCalloc (size_t numBytes)
  *//*--------------------------------------------------------------------*/
 void* deRealloc (void* ptr, size_t numBytes)
 {
+	countAllocation();
+
 	return realloc(ptr, numBytes);
 }
 
@@ -142,6 +188,8 @@ void* deAlignedMalloc (size_t numBytes, size_t alignBytes)
 
 	DE_ASSERT(deIsPowerOfTwoSize(alignBytes) && deIsPowerOfTwoSize(ptrAlignedAlign / sizeof(void*)));
 
+	countAllocation();
+
 	if (posix_memalign(&ptr, ptrAlignedAlign, numBytes) == 0)
 	{
 		DE_ASSERT(ptr);
@@ -156,6 +204,8 @@ void* deAlignedMalloc (size_t numBytes, size_t alignBytes)
 #elif (DE_ALIGNED_MALLOC == DE_ALIGNED_MALLOC_WIN32)
 	DE_ASSERT(deIsPowerOfTwoSize(alignBytes));
 
+	countAllocation();
+
 	return _aligned_malloc(numBytes, alignBytes);
 
 #elif (DE_ALIGNED_MALLOC == DE_ALIGNED_MALLOC_GENERIC)
@@ -183,6 +233,8 @@ void* deAlignedMalloc (size_t numBytes, size_t alignBytes)
 void* deAlignedRealloc (void* ptr, size_t numBytes, size_t alignBytes)
 {
 #if (DE_ALIGNED_MALLOC == DE_ALIGNED_MALLOC_WIN32)
+	countAllocation();
+
 	return _aligned_realloc(ptr, numBytes, alignBytes);
 
 #elif (DE_ALIGNED_MALLOC == DE_ALIGNED_MALLOC_GENERIC) || (DE_ALIGNED_MALLOC == DE_ALIGNED_MALLOC_POSIX)
@@ -255,15 +307,18 @@ void deAlignedFree (void* ptr)
 char* deStrdup (const char* str)
 {
 #if (DE_COMPILER == DE_COMPILER_MSC)
+	countAllocation();
 	return _strdup(str);
 #elif (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
 	/* For some reason Steve doesn't like stdrup(). */
 	size_t	len		= strlen(str);
 	char*	copy	= malloc(len+1);
+	countAllocation();
 	memcpy(copy, str, len);
 	copy[len] = 0;
 	return copy;
 #else
+	countAllocation();
 	return strdup(str);
 #endif
 }
@@ -351,6 +406,25 @@ void deMemory_selfTest (void)
 			deAlignedFree(newPtr);
 		}
 	}
+
+	/* Allocation counting */
+	{
+		const deBool	wasEnabled	= deMemory_isAllocationCountingEnabled();
+		deUint32		numBefore;
+		void*			ptr;
+
+		deMemory_setAllocationCountingEnabled(DE_TRUE);
+
+		numBefore	= deMemory_getNumAllocations();
+		ptr			= deMalloc(16);
+
+		DE_TEST_ASSERT(ptr);
+		DE_TEST_ASSERT(deMemory_getNumAllocations() - numBefore >= 1u);
+
+		deFree(ptr);
+
+		deMemory_setAllocationCountingEnabled(wasEnabled);
+	}
 }
 
 DE_END_EXTERN_C
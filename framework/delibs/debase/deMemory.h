@@ -43,6 +43,11 @@ void	deAlignedFree	(void* ptr);
 
 char*	deStrdup		(const char* str);
 
+/* Allocation counting for memory usage statistics. Counter wraps around. */
+void		deMemory_setAllocationCountingEnabled	(deBool enabled);
+deBool		deMemory_isAllocationCountingEnabled	(void);
+deUint32	deMemory_getNumAllocations				(void);
+
 /*--------------------------------------------------------------------*//*!
  * \brief Fill a block of memory with an 8-bit value.
  * \param ptr		Pointer to memory to free.
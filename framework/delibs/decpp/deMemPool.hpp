@@ -51,6 +51,9 @@ public:
 	void*			alloc					(deUintptr numBytes);
 	void*			alignedAlloc			(deUintptr numBytes, deUint32 alignBytes);
 
+	//! Free all allocations but keep memory for reuse. Destroys child pools.
+	void			reset					(void)					{ deMemPool_reset(m_pool);														}
+
 private:
 					MemPool					(const MemPool& other); // Not allowed!
 	MemPool&		operator=				(const MemPool& other); // Not allowed!
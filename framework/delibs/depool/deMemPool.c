@@ -34,9 +34,11 @@
 
 enum
 {
-	INITIAL_PAGE_SIZE		= 128,		/*!< Size for the first allocated memory page.			*/
-	MAX_PAGE_SIZE			= 8096,		/*!< Maximum size for a memory page.					*/
-	MEM_PAGE_BASE_ALIGN		= 4			/*!< Base alignment guarantee for mem page data ptr.	*/
+	INITIAL_PAGE_SIZE				= 256,			/*!< Size for the first allocated memory page.				*/
+	DEFAULT_MAX_PAGE_SIZE			= 64*1024,		/*!< Default maximum size for a memory page.				*/
+	DEFAULT_PAGE_GROWTH_FACTOR		= 2,			/*!< Default page size multiplier.							*/
+	DEFAULT_LARGE_ALLOC_THRESHOLD	= 16*1024,		/*!< Default size above which allocations get own page.	*/
+	MEM_PAGE_BASE_ALIGN				= 4				/*!< Base alignment guarantee for mem page data ptr.		*/
 };
 
 typedef struct MemPage_s MemPage;
@@ -82,33 +84,44 @@ struct DebugAlloc_s
  * creating the root pool with the deMemPool_createFailingRoot() function.
  * When the feature is enabled, also creation of sub-pools occasionally
  * fails.
+ *
+ * Page sizes grow geometrically as specified by the pool's page policy.
+ * Allocations larger than the policy threshold that don't fit to the
+ * current page get a dedicated page, so that the remainder of the current
+ * page is not wasted. Pages of a reset pool are kept for later allocations.
  *//*--------------------------------------------------------------------*/
 struct deMemPool_s
 {
-	deUint32		flags;				/*!< Flags.											*/
-	deMemPool*		parent;				/*!< Pointer to parent (null for root pools).		*/
-	deMemPoolUtil*	util;				/*!< Utilities (callbacks etc.).					*/
-	int				numChildren;		/*!< Number of child pools.							*/
-	deMemPool*		firstChild;			/*!< Pointer to first child pool in linked list.	*/
-	deMemPool*		prevPool;			/*!< Previous pool in parent's linked list.			*/
-	deMemPool*		nextPool;			/*!< Next pool in parent's linked list.				*/
-
-	MemPage*		currentPage;		/*!< Current memory page from which to allocate.	*/
+	deUint32			flags;				/*!< Flags.											*/
+	deMemPool*			parent;				/*!< Pointer to parent (null for root pools).		*/
+	deMemPoolUtil*		util;				/*!< Utilities (callbacks etc.).					*/
+	deMemPoolUtil		utilStorage;		/*!< Copy of utilities given to root pool.			*/
+	int					numChildren;		/*!< Number of child pools.							*/
+	deMemPool*			firstChild;			/*!< Pointer to first child pool in linked list.	*/
+	deMemPool*			prevPool;			/*!< Previous pool in parent's linked list.			*/
+	deMemPool*			nextPool;			/*!< Next pool in parent's linked list.				*/
+
+	MemPage*			currentPage;		/*!< Current memory page from which to allocate.	*/
+	MemPage*			largeAllocPages;	/*!< Dedicated pages for large allocations.			*/
+	MemPage*			freePages;			/*!< Pages available for reuse after reset.			*/
+
+	deMemPoolPagePolicy	pagePolicy;			/*!< Page allocation policy.						*/
+	deMemPoolStats		stats;				/*!< Allocation statistics.							*/
 
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
-	deBool			allowFailing;		/*!< Is allocation failure simulation enabled?		*/
-	deRandom		failRandom;			/*!< RNG for failing allocations.					*/
+	deBool				allowFailing;			/*!< Is allocation failure simulation enabled?		*/
+	deRandom			failRandom;				/*!< RNG for failing allocations.					*/
 #endif
 #if defined(DE_SUPPORT_DEBUG_POOLS)
-	deBool			enableDebugAllocs;	/*!< If true, always allocates using deMalloc().	*/
-	DebugAlloc*		debugAllocListHead;	/*!< List of allocation in debug mode.				*/
+	deBool				enableDebugAllocs;		/*!< If true, always allocates using deMalloc().	*/
+	DebugAlloc*			debugAllocListHead;		/*!< List of allocation in debug mode.				*/
 
-	int				lastAllocatedIndex;	/*!< Index of last allocated pool (rootPool only).	*/
-	int				allocIndex;			/*!< Allocation index (running counter).			*/
+	int					lastAllocatedIndex;		/*!< Index of last allocated pool (rootPool only).	*/
+	int					allocIndex;				/*!< Allocation index (running counter).			*/
 #endif
 #if defined(DE_SUPPORT_POOL_MEMORY_TRACKING)
-	int				maxMemoryAllocated;	/*!< Maximum amount of memory allocated from pools.	*/
-	int				maxMemoryCapacity;	/*!< Maximum amount of memory allocated for pools.	*/
+	int					maxMemoryAllocated;		/*!< Maximum amount of memory allocated from pools.	*/
+	int					maxMemoryCapacity;		/*!< Maximum amount of memory allocated for pools.	*/
 #endif
 };
 
@@ -160,13 +173,93 @@ static void MemPage_destroy (MemPage* page)
 	deFree(page);
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Destroy all memory pages in a list.
+ * \param page	First memory page in list (may be null).
+ *//*--------------------------------------------------------------------*/
+static void MemPage_destroyList (MemPage* page)
+{
+	while (page)
+	{
+		MemPage* nextPage = page->nextPage;
+		MemPage_destroy(page);
+		page = nextPage;
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Get the last memory page in a list.
+ * \param page	First memory page in list.
+ * \return The last memory page.
+ *//*--------------------------------------------------------------------*/
+static MemPage* MemPage_getLast (MemPage* page)
+{
+	DE_ASSERT(page);
+	while (page->nextPage)
+		page = page->nextPage;
+	return page;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Get the memory page containing the pool itself.
+ *//*--------------------------------------------------------------------*/
+static MemPage* getInitialPage (deMemPool* pool)
+{
+	return ((MemPage*)pool) - 1;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Get a new page for a pool.
+ * \param pool			Pool that will own the page.
+ * \param minCapacity	Minimum capacity for the page.
+ * \param capacity		Capacity for the page if a new one must be created.
+ * \return The page (or null on failure).
+ *
+ * Pages kept by deMemPool_reset() are reused whenever possible. The page
+ * is not linked to any of the pool's page lists.
+ *//*--------------------------------------------------------------------*/
+static MemPage* getPage (deMemPool* pool, size_t minCapacity, size_t capacity)
+{
+	MemPage**	prevPtr		= &pool->freePages;
+	MemPage*	page;
+
+	DE_ASSERT(minCapacity <= capacity);
+
+	for (page = pool->freePages; page; page = page->nextPage)
+	{
+		if ((size_t)page->capacity >= minCapacity)
+		{
+			*prevPtr		= page->nextPage;
+			page->nextPage	= DE_NULL;
+
+			DE_ASSERT(page->bytesAllocated == 0);
+			pool->stats.numPageReuses += 1;
+			return page;
+		}
+
+		prevPtr = &page->nextPage;
+	}
+
+	page = MemPage_create(capacity);
+	if (page)
+		pool->stats.numPageAllocs += 1;
+
+	return page;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \internal
  * \brief Internal function for creating a new memory pool.
- * \param parent	Parent pool (may be null).
+ * \param parent			Parent pool (may be null).
+ * \param linkToParent	Register pool as child of parent. Otherwise the pool
+ *						only inherits settings from parent.
  * \return The created memory pool (or null on failure).
  *//*--------------------------------------------------------------------*/
-static deMemPool* createPoolInternal (deMemPool* parent)
+static deMemPool* createPoolInternal (deMemPool* parent, deBool linkToParent)
 {
 	deMemPool*	pool;
 	MemPage*	initialPage;
@@ -191,20 +284,26 @@ static deMemPool* createPoolInternal (deMemPool* parent)
 
 	memset(pool, 0, sizeof(deMemPool));
 	pool->currentPage = initialPage;
+	pool->stats.numPageAllocs = 1;
 
 	/* Register to parent. */
-	pool->parent = parent;
-	if (parent)
+	if (parent && linkToParent)
 	{
+		pool->parent = parent;
 		parent->numChildren++;
 		if (parent->firstChild) parent->firstChild->prevPool = pool;
 		pool->nextPool = parent->firstChild;
 		parent->firstChild = pool;
 	}
 
-	/* Get utils from parent. */
+	/* Get utils and page policy from parent. */
 	pool->util = parent ? parent->util : DE_NULL;
 
+	if (parent)
+		pool->pagePolicy = parent->pagePolicy;
+	else
+		deMemPool_getDefaultPagePolicy(&pool->pagePolicy);
+
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
 	pool->allowFailing = parent ? parent->allowFailing : DE_FALSE;
 	deRandom_init(&pool->failRandom, parent ? deRandom_getUint32(&parent->failRandom) : 0x1234abcd);
@@ -240,7 +339,7 @@ static deMemPool* createPoolInternal (deMemPool* parent)
  *//*--------------------------------------------------------------------*/
 deMemPool* deMemPool_createRoot	(const deMemPoolUtil* util, deUint32 flags)
 {
-	deMemPool* pool = createPoolInternal(DE_NULL);
+	deMemPool* pool = createPoolInternal(DE_NULL, DE_FALSE);
 	if (!pool)
 		return DE_NULL;
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
@@ -259,16 +358,9 @@ deMemPool* deMemPool_createRoot	(const deMemPoolUtil* util, deUint32 flags)
 	/* Get copy of utilities. */
 	if (util)
 	{
-		deMemPoolUtil* utilCopy = DE_POOL_NEW(pool, deMemPoolUtil);
 		DE_ASSERT(util->allocFailCallback);
-		if (!utilCopy)
-		{
-			deMemPool_destroy(pool);
-			return DE_NULL;
-		}
-
-		memcpy(utilCopy, util, sizeof(deMemPoolUtil));
-		pool->util = utilCopy;
+		memcpy(&pool->utilStorage, util, sizeof(deMemPoolUtil));
+		pool->util = &pool->utilStorage;
 	}
 
 	return pool;
@@ -282,47 +374,53 @@ deMemPool* deMemPool_create (deMemPool* parent)
 {
 	deMemPool* pool;
 	DE_ASSERT(parent);
-	pool = createPoolInternal(parent);
+	pool = createPoolInternal(parent, DE_TRUE);
 	if (!pool && parent->util)
 		parent->util->allocFailCallback(parent->util->userPointer);
 	return pool;
 }
 
 /*--------------------------------------------------------------------*//*!
- * \brief Destroy a memory pool.
- * \param pool	Pool to be destroyed.
+ * \brief Create a pool that is not linked to its parent.
+ * \param parent	Pool to inherit utilities, flags and page policy from.
+ * \return The created memory pool (or null on failure).
  *
- * Frees all the memory allocated from the pool. Also destroyed any child
- * pools that the pool has (recursively).
+ * Detached pool can be used from a different thread than its parent, for
+ * example as a thread-local pool for a worker thread. When the thread is
+ * done, the pool can be merged to its parent with deMemPool_merge(). The
+ * pool itself must be created in the thread owning parent.
  *//*--------------------------------------------------------------------*/
-void deMemPool_destroy (deMemPool* pool)
+deMemPool* deMemPool_createDetached (deMemPool* parent)
 {
-	deMemPool* iter;
-	deMemPool* iterNext;
+	deMemPool* pool;
+	DE_ASSERT(parent);
+	pool = createPoolInternal(parent, DE_FALSE);
+	if (!pool && parent->util)
+		parent->util->allocFailCallback(parent->util->userPointer);
+	return pool;
+}
 
 #if defined(DE_SUPPORT_POOL_MEMORY_TRACKING)
-	/* Update memory consumption statistics. */
-	if (pool->parent)
-	{
-		deMemPool* root = pool->parent;
-		while (root->parent)
-			root = root->parent;
-		root->maxMemoryAllocated	= deMax32(root->maxMemoryAllocated, deMemPool_getNumAllocatedBytes(root, DE_TRUE));
-		root->maxMemoryCapacity		= deMax32(root->maxMemoryCapacity, deMemPool_getCapacity(root, DE_TRUE));
-	}
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Update memory consumption statistics of the root pool.
+ *//*--------------------------------------------------------------------*/
+static void updateMemoryTracking (deMemPool* pool)
+{
+	deMemPool* root = pool;
+	while (root->parent)
+		root = root->parent;
+	root->maxMemoryAllocated	= deMax32(root->maxMemoryAllocated, deMemPool_getNumAllocatedBytes(root, DE_TRUE));
+	root->maxMemoryCapacity		= deMax32(root->maxMemoryCapacity, deMemPool_getCapacity(root, DE_TRUE));
+}
 #endif
 
-	/* Destroy all children. */
-	iter = pool->firstChild;
-	while (iter)
-	{
-		iterNext = iter->nextPool;
-		deMemPool_destroy(iter);
-		iter = iterNext;
-	}
-
-	DE_ASSERT(pool->numChildren == 0);
-
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Remove pool from its parent's list of children.
+ *//*--------------------------------------------------------------------*/
+static void unlinkFromParent (deMemPool* pool)
+{
 	/* Update pointers. */
 	if (pool->prevPool) pool->prevPool->nextPool = pool->nextPool;
 	if (pool->nextPool) pool->nextPool->prevPool = pool->prevPool;
@@ -337,27 +435,115 @@ void deMemPool_destroy (deMemPool* pool)
 		DE_ASSERT(parent->numChildren >= 0);
 	}
 
-#if defined(DE_SUPPORT_DEBUG_POOLS)
-	/* Free all debug allocations. */
-	if (pool->enableDebugAllocs)
+	pool->parent	= DE_NULL;
+	pool->prevPool	= DE_NULL;
+	pool->nextPool	= DE_NULL;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Destroy all children of a pool.
+ *//*--------------------------------------------------------------------*/
+static void destroyChildren (deMemPool* pool)
+{
+	deMemPool* iter = pool->firstChild;
+	deMemPool* iterNext;
+
+	while (iter)
 	{
-		DebugAlloc* alloc	= pool->debugAllocListHead;
-		DebugAlloc* next;
+		iterNext = iter->nextPool;
+		deMemPool_destroy(iter);
+		iter = iterNext;
+	}
 
-		while (alloc)
-		{
-			next = alloc->next;
-			deAlignedFree(alloc->memPtr);
-			deFree(alloc);
-			alloc = next;
-		}
+	DE_ASSERT(pool->numChildren == 0);
+}
+
+#if defined(DE_SUPPORT_DEBUG_POOLS)
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Free all debug allocations made from a pool.
+ *//*--------------------------------------------------------------------*/
+static void freeDebugAllocs (deMemPool* pool)
+{
+	DebugAlloc* alloc	= pool->debugAllocListHead;
+	DebugAlloc* next;
 
-		pool->debugAllocListHead = DE_NULL;
+	while (alloc)
+	{
+		next = alloc->next;
+		deAlignedFree(alloc->memPtr);
+		deFree(alloc);
+		alloc = next;
 	}
+
+	pool->debugAllocListHead = DE_NULL;
+}
+#endif
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Destroy a memory pool.
+ * \param pool	Pool to be destroyed.
+ *
+ * Frees all the memory allocated from the pool. Also destroyed any child
+ * pools that the pool has (recursively).
+ *//*--------------------------------------------------------------------*/
+void deMemPool_destroy (deMemPool* pool)
+{
+#if defined(DE_SUPPORT_POOL_MEMORY_TRACKING)
+	/* Update memory consumption statistics. */
+	if (pool->parent)
+		updateMemoryTracking(pool->parent);
+#endif
+
+	/* Destroy all children. */
+	destroyChildren(pool);
+
+	unlinkFromParent(pool);
+
+#if defined(DE_SUPPORT_DEBUG_POOLS)
+	/* Free all debug allocations. */
+	if (pool->enableDebugAllocs)
+		freeDebugAllocs(pool);
 #endif
 
 	/* Free pages. */
+	MemPage_destroyList(pool->largeAllocPages);
+	MemPage_destroyList(pool->freePages);
+
 	/* \note Pool itself is allocated from first page, so we must not touch the pool after freeing the page! */
+	MemPage_destroyList(pool->currentPage);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Reset a memory pool.
+ * \param pool	Pool to be reset.
+ *
+ * Frees all the allocations made from the pool and destroys any child
+ * pools. Dedicated pages of large allocations are freed, but all other
+ * pages are kept and reused for later allocations. This makes a pool
+ * that is reset between iterations of some work much cheaper than
+ * creating a new pool for each iteration.
+ *//*--------------------------------------------------------------------*/
+void deMemPool_reset (deMemPool* pool)
+{
+	MemPage* const initialPage = getInitialPage(pool);
+
+#if defined(DE_SUPPORT_POOL_MEMORY_TRACKING)
+	updateMemoryTracking(pool);
+#endif
+
+	destroyChildren(pool);
+
+#if defined(DE_SUPPORT_DEBUG_POOLS)
+	if (pool->enableDebugAllocs)
+		freeDebugAllocs(pool);
+#endif
+
+	MemPage_destroyList(pool->largeAllocPages);
+	pool->largeAllocPages = DE_NULL;
+
+	/* Move all but the initial page to the free list. */
 	{
 		MemPage* page = pool->currentPage;
 		MemPage* nextPage;
@@ -365,10 +551,104 @@ void deMemPool_destroy (deMemPool* pool)
 		while (page)
 		{
 			nextPage = page->nextPage;
-			MemPage_destroy(page);
+
+			if (page != initialPage)
+			{
+#if defined(DE_DEBUG)
+				memset(page + 1, 0xCD, (size_t)page->capacity);
+#endif
+				page->bytesAllocated	= 0;
+				page->nextPage			= pool->freePages;
+				pool->freePages			= page;
+			}
+
 			page = nextPage;
 		}
 	}
+
+#if defined(DE_DEBUG)
+	memset((deUint8*)(initialPage + 1) + sizeof(deMemPool), 0xCD, (size_t)initialPage->capacity - sizeof(deMemPool));
+#endif
+
+	initialPage->bytesAllocated	= (int)sizeof(deMemPool);
+	initialPage->nextPage		= DE_NULL;
+	pool->currentPage			= initialPage;
+	pool->stats.numResets		+= 1;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Merge a pool into another pool.
+ * \param dst	Pool that takes ownership of the memory.
+ * \param src	Pool to be merged, destroyed by the operation.
+ *
+ * All allocations and child pools of src are moved to dst, and src is
+ * destroyed. Allocations made from src stay valid until dst is reset or
+ * destroyed. Typically src is a thread-local pool created with
+ * deMemPool_createDetached().
+ *
+ * Neither pool may be used concurrently during the merge.
+ *//*--------------------------------------------------------------------*/
+void deMemPool_merge (deMemPool* dst, deMemPool* src)
+{
+	MemPage* const	srcPages		= src->currentPage;
+	MemPage* const	srcLargePages	= src->largeAllocPages;
+	MemPage* const	srcFreePages	= src->freePages;
+
+	DE_ASSERT(dst && src && dst != src);
+	DE_ASSERT(dst->util == src->util);
+
+	/* Move children. */
+	while (src->firstChild)
+	{
+		deMemPool* const child = src->firstChild;
+
+		unlinkFromParent(child);
+
+		child->parent	= dst;
+		child->nextPool	= dst->firstChild;
+		if (dst->firstChild) dst->firstChild->prevPool = child;
+		dst->firstChild	= child;
+		dst->numChildren++;
+	}
+
+	unlinkFromParent(src);
+
+#if defined(DE_SUPPORT_DEBUG_POOLS)
+	if (src->debugAllocListHead)
+	{
+		DebugAlloc* const last = src->debugAllocListHead;
+		DebugAlloc* tail = last;
+
+		while (tail->next)
+			tail = tail->next;
+
+		tail->next				= dst->debugAllocListHead;
+		dst->debugAllocListHead	= last;
+	}
+#endif
+
+	dst->stats.numAllocs		+= src->stats.numAllocs;
+	dst->stats.numLargeAllocs	+= src->stats.numLargeAllocs;
+	dst->stats.numPageAllocs	+= src->stats.numPageAllocs;
+	dst->stats.numPageReuses	+= src->stats.numPageReuses;
+	dst->stats.numResets		+= src->stats.numResets;
+
+	/* Move pages. Source pages are put after the current page so that dst continues allocating from it. */
+	/* \note Pool src itself is allocated from one of the moved pages, so src must not be touched after this. */
+	MemPage_getLast(srcPages)->nextPage	= dst->currentPage->nextPage;
+	dst->currentPage->nextPage			= srcPages;
+
+	if (srcLargePages)
+	{
+		MemPage_getLast(srcLargePages)->nextPage	= dst->largeAllocPages;
+		dst->largeAllocPages						= srcLargePages;
+	}
+
+	if (srcFreePages)
+	{
+		MemPage_getLast(srcFreePages)->nextPage	= dst->freePages;
+		dst->freePages							= srcFreePages;
+	}
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -395,6 +675,9 @@ int deMemPool_getNumAllocatedBytes (const deMemPool* pool, deBool recurse)
 	for (memPage = pool->currentPage; memPage; memPage = memPage->nextPage)
 		numAllocatedBytes += memPage->bytesAllocated;
 
+	for (memPage = pool->largeAllocPages; memPage; memPage = memPage->nextPage)
+		numAllocatedBytes += memPage->bytesAllocated;
+
 	if (recurse)
 	{
 		deMemPool* child;
@@ -413,6 +696,12 @@ int deMemPool_getCapacity (const deMemPool* pool, deBool recurse)
 	for (memPage = pool->currentPage; memPage; memPage = memPage->nextPage)
 		numCapacityBytes += memPage->capacity;
 
+	for (memPage = pool->largeAllocPages; memPage; memPage = memPage->nextPage)
+		numCapacityBytes += memPage->capacity;
+
+	for (memPage = pool->freePages; memPage; memPage = memPage->nextPage)
+		numCapacityBytes += memPage->capacity;
+
 	if (recurse)
 	{
 		deMemPool* child;
@@ -423,6 +712,65 @@ int deMemPool_getCapacity (const deMemPool* pool, deBool recurse)
 	return numCapacityBytes;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Get allocation statistics of a pool.
+ * \param pool		Pool pointer.
+ * \param stats		Statistics are written here.
+ * \param recurse	Include statistics of child pools?
+ *//*--------------------------------------------------------------------*/
+void deMemPool_getStats (const deMemPool* pool, deMemPoolStats* stats, deBool recurse)
+{
+	*stats = pool->stats;
+
+	if (recurse)
+	{
+		deMemPool* child;
+		for (child = pool->firstChild; child; child = child->nextPool)
+		{
+			deMemPoolStats childStats;
+			deMemPool_getStats(child, &childStats, DE_TRUE);
+
+			stats->numAllocs		+= childStats.numAllocs;
+			stats->numLargeAllocs	+= childStats.numLargeAllocs;
+			stats->numPageAllocs	+= childStats.numPageAllocs;
+			stats->numPageReuses	+= childStats.numPageReuses;
+			stats->numResets		+= childStats.numResets;
+		}
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get the default page policy for new root pools.
+ *//*--------------------------------------------------------------------*/
+void deMemPool_getDefaultPagePolicy (deMemPoolPagePolicy* policy)
+{
+	policy->maxPageSize			= DEFAULT_MAX_PAGE_SIZE;
+	policy->pageGrowthFactor	= DEFAULT_PAGE_GROWTH_FACTOR;
+	policy->largeAllocThreshold	= DEFAULT_LARGE_ALLOC_THRESHOLD;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Set page policy for a pool.
+ * \param pool		Pool pointer.
+ * \param policy	New page policy.
+ *
+ * The policy affects pages allocated after the call. Child pools created
+ * after the call inherit the policy.
+ *//*--------------------------------------------------------------------*/
+void deMemPool_setPagePolicy (deMemPool* pool, const deMemPoolPagePolicy* policy)
+{
+	DE_ASSERT(policy->maxPageSize > 0);
+	DE_ASSERT(policy->pageGrowthFactor >= 1);
+	DE_ASSERT(policy->largeAllocThreshold >= 0);
+
+	pool->pagePolicy = *policy;
+}
+
+void deMemPool_getPagePolicy (const deMemPool* pool, deMemPoolPagePolicy* policy)
+{
+	*policy = pool->pagePolicy;
+}
+
 DE_INLINE void* deMemPool_allocInternal (deMemPool* pool, size_t numBytes, deUint32 alignBytes)
 {
 	MemPage* curPage = pool->currentPage;
@@ -463,15 +811,48 @@ DE_INLINE void* deMemPool_allocInternal (deMemPool* pool, size_t numBytes, deUin
 		void*	alignedPtr		= deAlignPtr(curPagePtr, alignBytes);
 		size_t	alignPadding	= (size_t)((deUintptr)alignedPtr - (deUintptr)curPagePtr);
 
+		pool->stats.numAllocs += 1;
+
 		if (numBytes + alignPadding > (size_t)(curPage->capacity - curPage->bytesAllocated))
 		{
 			/* Does not fit to current page. */
-			int		maxAlignPadding		= deMax32(0, ((int)alignBytes)-MEM_PAGE_BASE_ALIGN);
-			int		newPageCapacity		= deMax32(deMin32(2*curPage->capacity, MAX_PAGE_SIZE), ((int)numBytes)+maxAlignPadding);
+			const size_t	maxAlignPadding		= (size_t)deMax32(0, ((int)alignBytes)-MEM_PAGE_BASE_ALIGN);
+			const size_t	minPageCapacity		= numBytes + maxAlignPadding;
+
+			if (minPageCapacity > (size_t)pool->pagePolicy.largeAllocThreshold)
+			{
+				/* Large allocation, give it a dedicated page and keep allocating small blocks from the current page. */
+				MemPage* const page = MemPage_create(minPageCapacity);
+				if (!page)
+					return DE_NULL;
+
+				page->nextPage			= pool->largeAllocPages;
+				pool->largeAllocPages	= page;
+
+				pool->stats.numPageAllocs	+= 1;
+				pool->stats.numLargeAllocs	+= 1;
+
+				alignedPtr				= deAlignPtr((void*)(page + 1), alignBytes);
+				alignPadding			= (size_t)((deUintptr)alignedPtr - (deUintptr)(page + 1));
+				page->bytesAllocated	= (int)(numBytes + alignPadding);
+
+				DE_ASSERT(numBytes + alignPadding <= (size_t)page->capacity);
+				return alignedPtr;
+			}
+
+			{
+				size_t newPageCapacity = (size_t)curPage->capacity * (size_t)pool->pagePolicy.pageGrowthFactor;
 
-			curPage = MemPage_create((size_t)newPageCapacity);
-			if (!curPage)
-				return DE_NULL;
+				if (newPageCapacity > (size_t)pool->pagePolicy.maxPageSize)
+					newPageCapacity = (size_t)pool->pagePolicy.maxPageSize;
+
+				if (newPageCapacity < minPageCapacity)
+					newPageCapacity = minPageCapacity;
+
+				curPage = getPage(pool, minPageCapacity, newPageCapacity);
+				if (!curPage)
+					return DE_NULL;
+			}
 
 			curPage->nextPage	= pool->currentPage;
 			pool->currentPage	= curPage;
@@ -593,3 +974,154 @@ int deMemPool_getMaxCapacity (const deMemPool* pool)
 }
 
 #endif
+
+static void fillBytes (deUint8* ptr, size_t numBytes, deUint8 value)
+{
+	size_t ndx;
+	for (ndx = 0; ndx < numBytes; ndx++)
+		ptr[ndx] = (deUint8)(value + ndx);
+}
+
+static deBool checkBytes (const deUint8* ptr, size_t numBytes, deUint8 value)
+{
+	size_t ndx;
+	for (ndx = 0; ndx < numBytes; ndx++)
+	{
+		if (ptr[ndx] != (deUint8)(value + ndx))
+			return DE_FALSE;
+	}
+	return DE_TRUE;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Test memory pool functionality.
+ *//*--------------------------------------------------------------------*/
+void deMemPool_selfTest (void)
+{
+	/* Page growth and large allocations. */
+	{
+		deMemPool*			pool	= deMemPool_createRoot(DE_NULL, 0);
+		deMemPoolPagePolicy	policy;
+		deMemPoolStats		stats;
+		deUint8*			small;
+		deUint8*			large;
+		int					i;
+
+		deMemPool_getPagePolicy(pool, &policy);
+		policy.maxPageSize			= 4096;
+		policy.largeAllocThreshold	= 1024;
+		deMemPool_setPagePolicy(pool, &policy);
+
+		for (i = 0; i < 1000; i++)
+		{
+			deUint8* ptr = (deUint8*)deMemPool_alignedAlloc(pool, 24, 16);
+			DE_TEST_ASSERT(ptr && deIsAlignedPtr(ptr, 16));
+		}
+
+		deMemPool_getStats(pool, &stats, DE_FALSE);
+		DE_TEST_ASSERT(stats.numAllocs == 1000);
+		DE_TEST_ASSERT(stats.numLargeAllocs == 0);
+		DE_TEST_ASSERT(stats.numPageAllocs < 20);
+
+		small = (deUint8*)deMemPool_alloc(pool, 8);
+		large = (deUint8*)deMemPool_alignedAlloc(pool, 100000, 64);
+		DE_TEST_ASSERT(small && large && deIsAlignedPtr(large, 64));
+		fillBytes(large, 100000, 3);
+
+		deMemPool_getStats(pool, &stats, DE_FALSE);
+		DE_TEST_ASSERT(stats.numLargeAllocs == 1);
+		DE_TEST_ASSERT(deMemPool_getCapacity(pool, DE_FALSE) >= 100000);
+
+		/* Small allocations continue from the current page. */
+		{
+			const int	numPageAllocs	= stats.numPageAllocs;
+			deUint8*	ptr				= (deUint8*)deMemPool_alloc(pool, 8);
+
+			deMemPool_getStats(pool, &stats, DE_FALSE);
+			DE_TEST_ASSERT(ptr && stats.numPageAllocs == numPageAllocs);
+		}
+
+		DE_TEST_ASSERT(checkBytes(large, 100000, 3));
+		deMemPool_destroy(pool);
+	}
+
+	/* Reset keeps pages. */
+	{
+		deMemPool*		pool			= deMemPool_createRoot(DE_NULL, 0);
+		const int		initialBytes	= deMemPool_getNumAllocatedBytes(pool, DE_FALSE);
+		deMemPoolStats	stats;
+		int				numPageAllocs	= 0;
+		int				iter;
+
+		for (iter = 0; iter < 3; iter++)
+		{
+			deUint8*	ptrs[200];
+			int			i;
+
+			deMemPool_create(pool);
+
+			for (i = 0; i < DE_LENGTH_OF_ARRAY(ptrs); i++)
+			{
+				ptrs[i] = (deUint8*)deMemPool_alloc(pool, (size_t)(1 + (i*37) % 500));
+				DE_TEST_ASSERT(ptrs[i]);
+				fillBytes(ptrs[i], (size_t)(1 + (i*37) % 500), (deUint8)i);
+			}
+
+			for (i = 0; i < DE_LENGTH_OF_ARRAY(ptrs); i++)
+				DE_TEST_ASSERT(checkBytes(ptrs[i], (size_t)(1 + (i*37) % 500), (deUint8)i));
+
+			deMemPool_getStats(pool, &stats, DE_FALSE);
+
+			if (iter == 0)
+				numPageAllocs = stats.numPageAllocs;
+			else
+				DE_TEST_ASSERT(stats.numPageAllocs == numPageAllocs && stats.numPageReuses > 0);
+
+			deMemPool_reset(pool);
+			DE_TEST_ASSERT(deMemPool_getNumChildren(pool) == 0);
+			DE_TEST_ASSERT(deMemPool_getNumAllocatedBytes(pool, DE_FALSE) == initialBytes);
+		}
+
+		deMemPool_getStats(pool, &stats, DE_FALSE);
+		DE_TEST_ASSERT(stats.numResets == 3);
+		deMemPool_destroy(pool);
+	}
+
+	/* Detached pools. */
+	{
+		deMemPool*		root		= deMemPool_createRoot(DE_NULL, 0);
+		deMemPool*		detached	= deMemPool_createDetached(root);
+		deMemPool*		child		= deMemPool_create(detached);
+		deMemPoolStats	stats;
+		deUint8*		ptrs[100];
+		int				i;
+
+		DE_TEST_ASSERT(deMemPool_getNumChildren(root) == 0);
+
+		for (i = 0; i < DE_LENGTH_OF_ARRAY(ptrs); i++)
+		{
+			ptrs[i] = (deUint8*)deMemPool_alloc(i % 2 ? detached : child, 300);
+			DE_TEST_ASSERT(ptrs[i]);
+			fillBytes(ptrs[i], 300, (deUint8)i);
+		}
+
+		deMemPool_alloc(root, 16);
+		deMemPool_merge(root, detached);
+
+		DE_TEST_ASSERT(deMemPool_getNumChildren(root) == 1);
+		DE_TEST_ASSERT(deMemPool_getNumAllocatedBytes(root, DE_TRUE) >= DE_LENGTH_OF_ARRAY(ptrs)*300);
+
+		deMemPool_getStats(root, &stats, DE_TRUE);
+		DE_TEST_ASSERT(stats.numAllocs == DE_LENGTH_OF_ARRAY(ptrs) + 1);
+
+		for (i = 0; i < DE_LENGTH_OF_ARRAY(ptrs); i++)
+			DE_TEST_ASSERT(checkBytes(ptrs[i], 300, (deUint8)i));
+
+		/* Allocating after merge still works. */
+		DE_TEST_ASSERT(deMemPool_alloc(root, 5000));
+		DE_TEST_ASSERT(deMemPool_alloc(child, 5000));
+
+		deMemPool_destroy(root);
+	}
+}
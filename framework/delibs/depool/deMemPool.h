@@ -58,16 +58,50 @@ typedef struct deMemPoolUtil_s
 	deMemPoolAllocFailFunc		allocFailCallback;
 } deMemPoolUtil;
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Page allocation policy
+ *
+ * Each new page is pageGrowthFactor times larger than the previous one,
+ * up to maxPageSize. Allocations larger than largeAllocThreshold that don't
+ * fit to the current page get a dedicated page.
+ *//*--------------------------------------------------------------------*/
+typedef struct deMemPoolPagePolicy_s
+{
+	int		maxPageSize;			/*!< Maximum capacity for a page (in bytes).				*/
+	int		pageGrowthFactor;		/*!< Capacity multiplier for each new page.					*/
+	int		largeAllocThreshold;	/*!< Allocation size above which a dedicated page is used.	*/
+} deMemPoolPagePolicy;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Pool allocation statistics
+ *//*--------------------------------------------------------------------*/
+typedef struct deMemPoolStats_s
+{
+	int		numAllocs;				/*!< Number of allocations made from the pool.				*/
+	int		numLargeAllocs;			/*!< Number of allocations that got a dedicated page.		*/
+	int		numPageAllocs;			/*!< Number of pages allocated from the system.				*/
+	int		numPageReuses;			/*!< Number of pages reused after deMemPool_reset().		*/
+	int		numResets;				/*!< Number of deMemPool_reset() calls.						*/
+} deMemPoolStats;
+
 typedef struct deMemPool_s deMemPool;
 
 DE_BEGIN_EXTERN_C
 
 deMemPool*	deMemPool_createRoot				(const deMemPoolUtil* util, deUint32 flags);
 deMemPool*	deMemPool_create					(deMemPool* parent);
+deMemPool*	deMemPool_createDetached			(deMemPool* parent);
 void		deMemPool_destroy					(deMemPool* pool);
+void		deMemPool_reset						(deMemPool* pool);
+void		deMemPool_merge						(deMemPool* dst, deMemPool* src);
 int			deMemPool_getNumChildren			(const deMemPool* pool);
 int			deMemPool_getNumAllocatedBytes		(const deMemPool* pool, deBool recurse);
 int			deMemPool_getCapacity				(const deMemPool* pool, deBool recurse);
+void		deMemPool_getStats					(const deMemPool* pool, deMemPoolStats* stats, deBool recurse);
+
+void		deMemPool_getDefaultPagePolicy		(deMemPoolPagePolicy* policy);
+void		deMemPool_setPagePolicy				(deMemPool* pool, const deMemPoolPagePolicy* policy);
+void		deMemPool_getPagePolicy				(const deMemPool* pool, deMemPoolPagePolicy* policy);
 
 void*		deMemPool_alloc						(deMemPool* pool, size_t numBytes);
 void*		deMemPool_alignedAlloc				(deMemPool* pool, size_t numBytes, deUint32 alignBytes);
@@ -80,6 +114,8 @@ int			deMemPool_getMaxNumAllocatedBytes	(const deMemPool* pool);
 int			deMemPool_getMaxCapacity			(const deMemPool* pool);
 #endif
 
+void		deMemPool_selfTest					(void);
+
 DE_END_EXTERN_C
 
 #endif /* _DEMEMPOOL_H */
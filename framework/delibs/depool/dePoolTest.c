@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "dePoolTest.h"
+#include "deMemPool.h"
 #include "dePoolArray.h"
 #include "dePoolHeap.h"
 #include "dePoolHash.h"
@@ -32,6 +33,7 @@
 
 void	dePool_selfTest		(void)
 {
+	deMemPool_selfTest();
 	dePoolArray_selfTest();
 	dePoolHeap_selfTest();
 	dePoolHash_selfTest();
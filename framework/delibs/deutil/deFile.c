@@ -31,6 +31,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <sys/mman.h>
 
 struct deFile_s
 {
@@ -204,6 +205,56 @@ deFileResult deFile_write (deFile* file, const void* buf, deInt64 bufSize, deInt
 	return mapReadWriteResult(numWritten);
 }
 
+struct deFileMapping_s
+{
+	void*	ptr;
+	deInt64	size;
+};
+
+deFileMapping* deFileMapping_create (const deFile* file)
+{
+	const deInt64	size	= deFile_getSize(file);
+	deFileMapping*	mapping;
+	void*			ptr;
+
+	if (size <= 0)
+		return DE_NULL;
+
+	ptr = mmap(DE_NULL, (size_t)size, PROT_READ, MAP_PRIVATE, file->fd, 0);
+
+	if (ptr == MAP_FAILED)
+		return DE_NULL;
+
+	mapping = (deFileMapping*)deMalloc(sizeof(deFileMapping));
+
+	if (!mapping)
+	{
+		munmap(ptr, (size_t)size);
+		return DE_NULL;
+	}
+
+	mapping->ptr	= ptr;
+	mapping->size	= size;
+
+	return mapping;
+}
+
+void deFileMapping_destroy (deFileMapping* mapping)
+{
+	munmap(mapping->ptr, (size_t)mapping->size);
+	deFree(mapping);
+}
+
+const void* deFileMapping_getPtr (const deFileMapping* mapping)
+{
+	return mapping->ptr;
+}
+
+deInt64 deFileMapping_getSize (const deFileMapping* mapping)
+{
+	return mapping->size;
+}
+
 #elif (DE_OS == DE_OS_WIN32)
 
 #define VC_EXTRALEAN
@@ -396,6 +447,125 @@ deFileResult deFile_write (deFile* file, const void* buf, deInt64 bufSize, deInt
 	return mapReadWriteResult(result, numWritten32);
 }
 
+struct deFileMapping_s
+{
+	HANDLE	handle;
+	void*	ptr;
+	deInt64	size;
+};
+
+deFileMapping* deFileMapping_create (const deFile* file)
+{
+	const deInt64	size	= deFile_getSize(file);
+	deFileMapping*	mapping;
+	HANDLE			handle;
+	void*			ptr;
+
+	if (size <= 0)
+		return DE_NULL;
+
+	handle = CreateFileMapping(file->handle, DE_NULL, PAGE_READONLY, 0, 0, DE_NULL);
+
+	if (!handle)
+		return DE_NULL;
+
+	ptr = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+
+	if (!ptr)
+	{
+		CloseHandle(handle);
+		return DE_NULL;
+	}
+
+	mapping = (deFileMapping*)deMalloc(sizeof(deFileMapping));
+
+	if (!mapping)
+	{
+		UnmapViewOfFile(ptr);
+		CloseHandle(handle);
+		return DE_NULL;
+	}
+
+	mapping->handle	= handle;
+	mapping->ptr	= ptr;
+	mapping->size	= size;
+
+	return mapping;
+}
+
+void deFileMapping_destroy (deFileMapping* mapping)
+{
+	UnmapViewOfFile(mapping->ptr);
+	CloseHandle(mapping->handle);
+	deFree(mapping);
+}
+
+const void* deFileMapping_getPtr (const deFileMapping* mapping)
+{
+	return mapping->ptr;
+}
+
+deInt64 deFileMapping_getSize (const deFileMapping* mapping)
+{
+	return mapping->size;
+}
+
 #else
 #	error Implement deFile for your OS.
 #endif
+
+static void writeTestFile (const char* filename, const deUint8* data, int size)
+{
+	deFile*	file		= deFile_create(filename, DE_FILEMODE_CREATE|DE_FILEMODE_OPEN|DE_FILEMODE_WRITE|DE_FILEMODE_TRUNCATE);
+	deInt64	numWritten	= 0;
+
+	DE_TEST_ASSERT(file);
+	DE_TEST_ASSERT(size == 0 || (deFile_write(file, data, size, &numWritten) == DE_FILERESULT_SUCCESS && numWritten == size));
+	deFile_destroy(file);
+}
+
+void deFile_selfTest (void)
+{
+	const char*	filename	= "deFile_selfTest.tmp";
+	deUint8		data[4099];
+	int			ndx;
+
+	for (ndx = 0; ndx < DE_LENGTH_OF_ARRAY(data); ndx++)
+		data[ndx] = (deUint8)(ndx * 7 + 3);
+
+	/* Mapping covers whole file and outlives the file handle. */
+	{
+		deFile*			file;
+		deFileMapping*	mapping;
+
+		writeTestFile(filename, data, DE_LENGTH_OF_ARRAY(data));
+
+		file = deFile_create(filename, DE_FILEMODE_OPEN|DE_FILEMODE_READ);
+		DE_TEST_ASSERT(file);
+
+		mapping = deFileMapping_create(file);
+		deFile_destroy(file);
+
+		DE_TEST_ASSERT(mapping);
+		DE_TEST_ASSERT(deFileMapping_getSize(mapping) == DE_LENGTH_OF_ARRAY(data));
+		DE_TEST_ASSERT(deMemCmp(deFileMapping_getPtr(mapping), data, sizeof(data)) == 0);
+
+		deFileMapping_destroy(mapping);
+	}
+
+	/* Empty file can not be mapped. */
+	{
+		deFile* file;
+
+		writeTestFile(filename, DE_NULL, 0);
+
+		file = deFile_create(filename, DE_FILEMODE_OPEN|DE_FILEMODE_READ);
+		DE_TEST_ASSERT(file);
+		DE_TEST_ASSERT(deFile_getSize(file) == 0);
+		DE_TEST_ASSERT(!deFileMapping_create(file));
+		deFile_destroy(file);
+	}
+
+	DE_TEST_ASSERT(deDeleteFile(filename));
+	DE_TEST_ASSERT(!deFileExists(filename));
+}
@@ -29,6 +29,7 @@ DE_BEGIN_EXTERN_C
 
 /* File types. */
 typedef struct deFile_s deFile;
+typedef struct deFileMapping_s deFileMapping;
 
 typedef enum deFileMode_e
 {
@@ -82,6 +83,15 @@ deInt64			deFile_getSize			(const deFile* file);
 deFileResult	deFile_read				(deFile* file, void* buf, deInt64 bufSize, deInt64* numRead);
 deFileResult	deFile_write			(deFile* file, const void* buf, deInt64 bufSize, deInt64* numWritten);
 
+/* Read-only mapping of whole file. File can be destroyed while mapping is alive. */
+deFileMapping*	deFileMapping_create	(const deFile* file);
+void			deFileMapping_destroy	(deFileMapping* mapping);
+
+const void*		deFileMapping_getPtr	(const deFileMapping* mapping);
+deInt64			deFileMapping_getSize	(const deFileMapping* mapping);
+
+void			deFile_selfTest			(void);
+
 DE_END_EXTERN_C
 
 #endif /* _DEFILE_H */
@@ -0,0 +1,152 @@
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process memory usage queries.
+ *//*--------------------------------------------------------------------*/
+
+#include "deMemoryUsage.h"
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)
+#	include <stdio.h>
+#	include <string.h>
+#elif (DE_OS == DE_OS_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	include <windows.h>
+#	include <psapi.h>
+#elif (DE_OS == DE_OS_OSX)
+#	include <mach/mach.h>
+#endif
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)
+
+static deBool parseStatusLine (const char* line, const char* key, deUint64* dst)
+{
+	const size_t	keyLen		= strlen(key);
+	const char*		cur			= line + keyLen;
+	deUint64		value		= 0;
+
+	if (strncmp(line, key, keyLen) != 0)
+		return DE_FALSE;
+
+	while (*cur == ' ' || *cur == '\t')
+		cur++;
+
+	if (*cur < '0' || *cur > '9')
+		return DE_FALSE;
+
+	while (*cur >= '0' && *cur <= '9')
+		value = value*10 + (deUint64)(*cur++ - '0');
+
+	/* Values are reported in kB */
+	*dst = value * 1024;
+	return DE_TRUE;
+}
+
+deBool deGetProcessMemoryUsage (deProcessMemoryUsage* usage)
+{
+	FILE*	file		= fopen("/proc/self/status", "r");
+	char	line[256];
+	deBool	hasRss		= DE_FALSE;
+	deBool	hasPeak		= DE_FALSE;
+
+	if (!file)
+		return DE_FALSE;
+
+	while (fgets(line, (int)sizeof(line), file) && !(hasRss && hasPeak))
+	{
+		hasRss	= hasRss	|| parseStatusLine(line, "VmRSS:", &usage->residentBytes);
+		hasPeak	= hasPeak	|| parseStatusLine(line, "VmHWM:", &usage->peakResidentBytes);
+	}
+
+	fclose(file);
+
+	return hasRss && hasPeak;
+}
+
+deBool deResetProcessPeakMemoryUsage (void)
+{
+	/* Writing 5 to clear_refs resets VmHWM to current VmRSS */
+	FILE*	file	= fopen("/proc/self/clear_refs", "w");
+	deBool	isOk	= DE_FALSE;
+
+	if (!file)
+		return DE_FALSE;
+
+	isOk = fputs("5", file) >= 0;
+	isOk = (fclose(file) == 0) && isOk;
+
+	return isOk;
+}
+
+#elif (DE_OS == DE_OS_WIN32)
+
+deBool deGetProcessMemoryUsage (deProcessMemoryUsage* usage)
+{
+	PROCESS_MEMORY_COUNTERS counters;
+
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return DE_FALSE;
+
+	usage->residentBytes		= (deUint64)counters.WorkingSetSize;
+	usage->peakResidentBytes	= (deUint64)counters.PeakWorkingSetSize;
+
+	return DE_TRUE;
+}
+
+deBool deResetProcessPeakMemoryUsage (void)
+{
+	return DE_FALSE;
+}
+
+#elif (DE_OS == DE_OS_OSX)
+
+deBool deGetProcessMemoryUsage (deProcessMemoryUsage* usage)
+{
+	mach_task_basic_info_data_t		info;
+	mach_msg_type_number_t			count	= MACH_TASK_BASIC_INFO_COUNT;
+
+	if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS)
+		return DE_FALSE;
+
+	usage->residentBytes		= (deUint64)info.resident_size;
+	usage->peakResidentBytes	= (deUint64)info.resident_size_max;
+
+	return DE_TRUE;
+}
+
+deBool deResetProcessPeakMemoryUsage (void)
+{
+	return DE_FALSE;
+}
+
+#else
+
+deBool deGetProcessMemoryUsage (deProcessMemoryUsage* usage)
+{
+	DE_UNREF(usage);
+	return DE_FALSE;
+}
+
+deBool deResetProcessPeakMemoryUsage (void)
+{
+	return DE_FALSE;
+}
+
+#endif
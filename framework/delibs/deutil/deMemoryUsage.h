@@ -0,0 +1,53 @@
+#ifndef _DEMEMORYUSAGE_H
+#define _DEMEMORYUSAGE_H
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process memory usage queries.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+
+DE_BEGIN_EXTERN_C
+
+typedef struct deProcessMemoryUsage_s
+{
+	deUint64	residentBytes;		/*!< Current resident set size.											*/
+	deUint64	peakResidentBytes;	/*!< Peak resident set size since process start or last reset.			*/
+} deProcessMemoryUsage;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get memory usage of current process.
+ * \param usage	Usage is written here.
+ * \return True if query is supported on the platform and succeeded.
+ *//*--------------------------------------------------------------------*/
+deBool		deGetProcessMemoryUsage			(deProcessMemoryUsage* usage);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Reset peak resident set size to current resident set size.
+ * \return True if reset is supported on the platform and succeeded.
+ *
+ * \note Linux supports resetting peak only since 4.0.
+ *//*--------------------------------------------------------------------*/
+deBool		deResetProcessPeakMemoryUsage	(void);
+
+DE_END_EXTERN_C
+
+#endif /* _DEMEMORYUSAGE_H */
@@ -25,6 +25,13 @@
 #include "gluStrUtil.hpp"
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
+#include "deStringUtil.hpp"
+#include "deMemory.h"
+#include "deInt32.h"
+
+#include <vector>
+#include <sstream>
+#include <cstring>
 
 using tcu::TestLog;
 using tcu::toHex;
@@ -32,15 +39,346 @@ using tcu::toHex;
 namespace glu
 {
 
+class CallTraceReader;
+
+template <typename T>
+struct TraceArray
+{
+	const T*	arr;
+	int			size;
+
+	TraceArray (const T* arr_, int size_) : arr(arr_), size(size_) {}
+};
+
+struct TraceString
+{
+	const char*	str;
+
+	TraceString (const char* str_) : str(str_) {}
+};
+
+template <typename T, typename SizeType>
+inline TraceArray<T> traceArray (const T* arr, SizeType size)
+{
+	return TraceArray<T>(arr, de::max((int)size, 0));
+}
+
+inline TraceString traceString (const char*			str)	{ return TraceString(str);					}
+inline TraceString traceString (const glw::GLubyte*	str)	{ return TraceString((const char*)str);	}
+
+//! Format value at capture time, used for prints that can not be deferred.
+template <typename T>
+inline std::string traceText (const T& value)
+{
+	return de::toString(value);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Deferred call trace
+ *
+ * Each call is stored as a record consisting of the format function of
+ * the call followed by raw argument values and copies of any data the
+ * format function would read through pointers. All items are padded to
+ * 8 bytes.
+ *
+ * Trace memory is split into two halves. Once the current half is full
+ * the previous one is dropped and the halves are swapped, so that at least
+ * half of the trace size worth of most recent calls is always retained.
+ *//*--------------------------------------------------------------------*/
+class CallTrace
+{
+public:
+	typedef void (*FormatFunc) (std::ostream& str, CallTraceReader& trace);
+
+	class EndRecordToken {};
+	static const EndRecordToken	EndRecord;
+
+	explicit			CallTrace		(size_t maxSize);
+
+	CallTrace&			beginRecord		(FormatFunc formatFunc);
+
+	template <typename T>
+	CallTrace&			operator<<		(const T& value);
+	template <typename T>
+	CallTrace&			operator<<		(const TraceArray<T>& value);
+	CallTrace&			operator<<		(const TraceString& value);
+	CallTrace&			operator<<		(const std::string& value);
+	CallTrace&			operator<<		(const EndRecordToken&);
+
+	bool				isEmpty			(void) const { return m_numRecords[0] == 0 && m_numRecords[1] == 0; }
+	void				clear			(void);
+	void				format			(std::ostream& str) const;
+
+private:
+	enum
+	{
+		ITEM_ALIGN	= (int)sizeof(deUint64)
+	};
+
+	struct RecordHeader
+	{
+		deUint64		size;
+		FormatFunc		formatFunc;
+	};
+
+	void				putBytes		(const void* data, size_t numBytes);
+	void				putData			(const void* data, deInt64 numBytes);
+
+	const size_t		m_halfSize;
+
+	std::vector<deUint8>	m_records[2];		//!< Previous and current half.
+	int					m_numRecords[2];
+	int					m_numDropped;
+	size_t				m_recordStart;		//!< Start offset of incomplete record or NO_RECORD.
+
+	static const size_t	NO_RECORD		= ~(size_t)0;
+};
+
+class CallTraceReader
+{
+public:
+						CallTraceReader	(const deUint8* data) : m_pos(data) {}
+
+	template <typename T>
+	T					get				(void);
+	template <typename T>
+	tcu::Format::ArrayPointer<T> getArray (void);
+	const char*			getString		(void);
+
+private:
+	const deUint8*		getData			(deInt64 numBytes);
+
+	const deUint8*		m_pos;
+};
+
+const CallTrace::EndRecordToken CallTrace::EndRecord;
+
+CallTrace::CallTrace (size_t maxSize)
+	: m_halfSize	(maxSize/2)
+	, m_numDropped	(0)
+	, m_recordStart	(NO_RECORD)
+{
+	m_numRecords[0] = 0;
+	m_numRecords[1] = 0;
+}
+
+CallTrace& CallTrace::beginRecord (FormatFunc formatFunc)
+{
+	std::vector<deUint8>&	cur		= m_records[1];
+	RecordHeader			header;
+
+	// Drop record left incomplete by an exception
+	if (m_recordStart != NO_RECORD)
+		cur.resize(m_recordStart);
+
+	if (cur.size() >= m_halfSize)
+	{
+		m_numDropped	+= m_numRecords[0];
+		m_numRecords[0]	 = m_numRecords[1];
+		m_numRecords[1]	 = 0;
+		m_records[0].swap(cur);
+		cur.clear();
+	}
+
+	m_recordStart	= cur.size();
+	header.size			= 0;
+	header.formatFunc	= formatFunc;
+	putBytes(&header, sizeof(header));
+
+	return *this;
+}
+
+template <typename T>
+CallTrace& CallTrace::operator<< (const T& value)
+{
+	DE_STATIC_ASSERT(sizeof(T) <= ITEM_ALIGN);
+	putBytes(&value, sizeof(T));
+	return *this;
+}
+
+template <typename T>
+CallTrace& CallTrace::operator<< (const TraceArray<T>& value)
+{
+	putData(value.arr, value.arr ? (deInt64)value.size * (deInt64)sizeof(T) : -1);
+	return *this;
+}
+
+CallTrace& CallTrace::operator<< (const TraceString& value)
+{
+	putData(value.str, value.str ? (deInt64)std::strlen(value.str) + 1 : -1);
+	return *this;
+}
+
+CallTrace& CallTrace::operator<< (const std::string& value)
+{
+	putData(value.c_str(), (deInt64)value.size() + 1);
+	return *this;
+}
+
+CallTrace& CallTrace::operator<< (const EndRecordToken&)
+{
+	std::vector<deUint8>&	cur		= m_records[1];
+	const deUint64			size	= (deUint64)(cur.size() - m_recordStart);
+
+	DE_ASSERT(m_recordStart != NO_RECORD);
+
+	deMemcpy(&cur[m_recordStart], &size, sizeof(size));
+	m_numRecords[1]	+= 1;
+	m_recordStart	 = NO_RECORD;
+
+	return *this;
+}
+
+void CallTrace::putBytes (const void* data, size_t numBytes)
+{
+	std::vector<deUint8>&	cur			= m_records[1];
+	const size_t			offset		= cur.size();
+	const size_t			alignedSize	= deAlignSize(numBytes, ITEM_ALIGN);
+
+	cur.resize(offset + alignedSize, 0);
+
+	if (numBytes > 0)
+		deMemcpy(&cur[offset], data, numBytes);
+}
+
+void CallTrace::putData (const void* data, deInt64 numBytes)
+{
+	*this << numBytes;
+
+	if (numBytes > 0)
+		putBytes(data, (size_t)numBytes);
+}
+
+void CallTrace::clear (void)
+{
+	m_records[0].clear();
+	m_records[1].clear();
+	m_numRecords[0]	= 0;
+	m_numRecords[1]	= 0;
+	m_numDropped	= 0;
+	m_recordStart	= NO_RECORD;
+}
+
+void CallTrace::format (std::ostream& str) const
+{
+	bool isFirst = true;
+
+	if (m_numDropped > 0)
+	{
+		str << "// " << m_numDropped << " earlier call(s) dropped from trace";
+		isFirst = false;
+	}
+
+	for (int halfNdx = 0; halfNdx < 2; halfNdx++)
+	{
+		const std::vector<deUint8>&	records		= m_records[halfNdx];
+		const size_t				end			= (halfNdx == 1 && m_recordStart != NO_RECORD) ? m_recordStart : records.size();
+		size_t						offset		= 0;
+
+		while (offset < end)
+		{
+			RecordHeader	header;
+			CallTraceReader	reader	(&records[offset] + deAlignSize(sizeof(RecordHeader), ITEM_ALIGN));
+
+			deMemcpy(&header, &records[offset], sizeof(header));
+
+			if (!isFirst)
+				str << "\n";
+
+			header.formatFunc(str, reader);
+
+			offset	+= (size_t)header.size;
+			isFirst	 = false;
+		}
+	}
+}
+
+template <typename T>
+T CallTraceReader::get (void)
+{
+	T value;
+	deMemcpy(&value, m_pos, sizeof(T));
+	m_pos += deAlignSize(sizeof(T), sizeof(deUint64));
+	return value;
+}
+
+template <typename T>
+tcu::Format::ArrayPointer<T> CallTraceReader::getArray (void)
+{
+	const deInt64 numBytes = get<deInt64>();
+	return tcu::Format::ArrayPointer<T>((const T*)getData(numBytes), (int)(de::max<deInt64>(numBytes, 0) / (deInt64)sizeof(T)));
+}
+
+const char* CallTraceReader::getString (void)
+{
+	return (const char*)getData(get<deInt64>());
+}
+
+const deUint8* CallTraceReader::getData (deInt64 numBytes)
+{
+	const deUint8* const data = m_pos;
+
+	if (numBytes < 0)
+		return DE_NULL;
+
+	m_pos += deAlignSize((size_t)numBytes, sizeof(deUint64));
+	return data;
+}
+
 CallLogWrapper::CallLogWrapper (const glw::Functions& gl, tcu::TestLog& log)
 	: m_gl			(gl)
 	, m_log			(log)
 	, m_enableLog	(false)
+	, m_callTrace	(DE_NULL)
 {
 }
 
 CallLogWrapper::~CallLogWrapper (void)
 {
+	// \note Test case may have already ended, captured calls can not be logged anymore.
+	delete m_callTrace;
+}
+
+void CallLogWrapper::enableDeferredLogging (bool enable, size_t maxTraceSize)
+{
+	if (enable == isDeferredLoggingEnabled())
+		return;
+
+	if (enable)
+		m_callTrace = new CallTrace(maxTraceSize);
+	else
+	{
+		flushCallLog();
+		delete m_callTrace;
+		m_callTrace = DE_NULL;
+	}
+}
+
+void CallLogWrapper::flushCallLog (void)
+{
+	if (m_callTrace && !m_callTrace->isEmpty())
+	{
+		std::ostringstream str;
+
+		m_callTrace->format(str);
+		m_callTrace->clear();
+
+		m_log << TestLog::Message << str.str() << TestLog::EndMessage;
+	}
+}
+
+void CallLogWrapper::discardCallLog (void)
+{
+	if (m_callTrace)
+		m_callTrace->clear();
+}
+
+void CallLogWrapper::endCallLog (qpTestResult result)
+{
+	if (result != QP_TEST_RESULT_PASS)
+		flushCallLog();
+	else
+		discardCallLog();
 }
 
 template <typename T>
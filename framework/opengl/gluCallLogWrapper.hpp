@@ -35,9 +35,30 @@ class Functions;
 namespace glu
 {
 
+class CallTrace;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief GL call wrapper for logging
+ *
+ * By default each call is written to the test log as it is made. In
+ * deferred mode calls are instead captured as compact binary records into
+ * an in-memory trace of bounded size, and formatted only when the trace is
+ * flushed. Once the trace fills up the oldest calls are dropped.
+ *
+ * Deferred mode allows keeping call logs of large call sequences available
+ * for failure analysis without paying for formatting and log I/O on every
+ * call: endCallLog() flushes the trace if the case did not pass and
+ * discards it otherwise. Captured calls are not written to the log
+ * automatically, since the wrapper may outlive the test case it logs for.
+ *//*--------------------------------------------------------------------*/
 class CallLogWrapper
 {
 public:
+	enum
+	{
+		DEFAULT_CALL_TRACE_SIZE	= 4*1024*1024	//!< Default maximum size of deferred call trace in bytes.
+	};
+
 							CallLogWrapper			(const glw::Functions& gl, tcu::TestLog& log);
 							~CallLogWrapper			(void);
 
@@ -48,10 +69,22 @@ public:
 	bool					isLoggingEnabled		(void)			{ return m_enableLog; }
 	tcu::TestLog&			getLog					(void)			{ return m_log; }
 
+	//! Enable or disable deferred logging. Captured calls are flushed when deferred mode is disabled.
+	void					enableDeferredLogging	(bool enable, size_t maxTraceSize = DEFAULT_CALL_TRACE_SIZE);
+	bool					isDeferredLoggingEnabled(void) const	{ return m_callTrace != DE_NULL; }
+
+	void					flushCallLog			(void);		//!< Write captured calls to log and clear trace.
+	void					discardCallLog			(void);		//!< Clear trace without logging captured calls.
+	void					endCallLog				(qpTestResult result);	//!< Flush trace if result is not pass, discard otherwise.
+
 private:
+							CallLogWrapper			(const CallLogWrapper& other);
+	CallLogWrapper&			operator=				(const CallLogWrapper& other);
+
 	const glw::Functions&	m_gl;
 	tcu::TestLog&			m_log;
 	bool					m_enableLog;
+	CallTrace*				m_callTrace;
 } DE_WARN_UNUSED_TYPE;
 
 } // glu
@@ -4,6096 +4,15410 @@
  * Generated from Khronos GL API description (gl.xml) revision 9302c6a6963864cba6c43d7eee0f4afcdcec2084.
  */
 
+static void formatGlActiveShaderProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	glw::GLuint program = trace.get<glw::GLuint>();
+	str << "glActiveShaderProgram(" << pipeline << ", " << program << ");";
+}
+
 void CallLogWrapper::glActiveShaderProgram (glw::GLuint pipeline, glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glActiveShaderProgram(" << pipeline << ", " << program << ");" << TestLog::EndMessage;
 	m_gl.activeShaderProgram(pipeline, program);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlActiveShaderProgram) << pipeline << program << CallTrace::EndRecord;
+}
+
+static void formatGlActiveTexture (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texture = trace.get<glw::GLenum>();
+	str << "glActiveTexture(" << getTextureUnitStr(texture) << ");";
 }
 
 void CallLogWrapper::glActiveTexture (glw::GLenum texture)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glActiveTexture(" << getTextureUnitStr(texture) << ");" << TestLog::EndMessage;
 	m_gl.activeTexture(texture);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlActiveTexture) << texture << CallTrace::EndRecord;
+}
+
+static void formatGlAttachShader (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	str << "glAttachShader(" << program << ", " << shader << ");";
 }
 
 void CallLogWrapper::glAttachShader (glw::GLuint program, glw::GLuint shader)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glAttachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
 	m_gl.attachShader(program, shader);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlAttachShader) << program << shader << CallTrace::EndRecord;
+}
+
+static void formatGlBeginConditionalRender (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glBeginConditionalRender (glw::GLuint id, glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.beginConditionalRender(id, mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBeginConditionalRender) << id << mode << CallTrace::EndRecord;
+}
+
+static void formatGlBeginQuery (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	str << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");";
 }
 
 void CallLogWrapper::glBeginQuery (glw::GLenum target, glw::GLuint id)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
 	m_gl.beginQuery(target, id);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBeginQuery) << target << id << CallTrace::EndRecord;
+}
+
+static void formatGlBeginQueryIndexed (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	str << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");";
 }
 
 void CallLogWrapper::glBeginQueryIndexed (glw::GLenum target, glw::GLuint index, glw::GLuint id)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");" << TestLog::EndMessage;
 	m_gl.beginQueryIndexed(target, index, id);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBeginQueryIndexed) << target << index << id << CallTrace::EndRecord;
+}
+
+static void formatGlBeginTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum primitiveMode = trace.get<glw::GLenum>();
+	str << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");";
 }
 
 void CallLogWrapper::glBeginTransformFeedback (glw::GLenum primitiveMode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");" << TestLog::EndMessage;
 	m_gl.beginTransformFeedback(primitiveMode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBeginTransformFeedback) << primitiveMode << CallTrace::EndRecord;
+}
+
+static void formatGlBindAttribLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const char* nameData = trace.getString();
+	str << "glBindAttribLocation(" << program << ", " << index << ", " << getStringStr(nameData) << ");";
 }
 
 void CallLogWrapper::glBindAttribLocation (glw::GLuint program, glw::GLuint index, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindAttribLocation(" << program << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	m_gl.bindAttribLocation(program, index, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindAttribLocation) << program << index << traceString(name) << CallTrace::EndRecord;
+}
+
+static void formatGlBindBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glBindBuffer (glw::GLenum target, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.bindBuffer(target, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindBuffer) << target << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlBindBufferBase (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glBindBufferBase (glw::GLenum target, glw::GLuint index, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.bindBufferBase(target, index, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindBufferBase) << target << index << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlBindBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");";
 }
 
 void CallLogWrapper::glBindBufferRange (glw::GLenum target, glw::GLuint index, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.bindBufferRange(target, index, buffer, offset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindBufferRange) << target << index << buffer << offset << size << CallTrace::EndRecord;
+}
+
+static void formatGlBindBuffersBase (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *buffers = trace.get<const glw::GLuint *>();
+	str << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
 }
 
 void CallLogWrapper::glBindBuffersBase (glw::GLenum target, glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
 	m_gl.bindBuffersBase(target, first, count, buffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindBuffersBase) << target << first << count << buffers << CallTrace::EndRecord;
+}
+
+static void formatGlBindBuffersRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *buffers = trace.get<const glw::GLuint *>();
+	const glw::GLintptr *offsets = trace.get<const glw::GLintptr *>();
+	const glw::GLsizeiptr *sizes = trace.get<const glw::GLsizeiptr *>();
+	str << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");";
 }
 
 void CallLogWrapper::glBindBuffersRange (glw::GLenum target, glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers, const glw::GLintptr *offsets, const glw::GLsizeiptr *sizes)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");" << TestLog::EndMessage;
 	m_gl.bindBuffersRange(target, first, count, buffers, offsets, sizes);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindBuffersRange) << target << first << count << buffers << offsets << sizes << CallTrace::EndRecord;
+}
+
+static void formatGlBindFragDataLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint color = trace.get<glw::GLuint>();
+	const char* nameData = trace.getString();
+	str << "glBindFragDataLocation(" << program << ", " << color << ", " << getStringStr(nameData) << ");";
 }
 
 void CallLogWrapper::glBindFragDataLocation (glw::GLuint program, glw::GLuint color, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindFragDataLocation(" << program << ", " << color << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	m_gl.bindFragDataLocation(program, color, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindFragDataLocation) << program << color << traceString(name) << CallTrace::EndRecord;
+}
+
+static void formatGlBindFragDataLocationIndexed (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint colorNumber = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const char* nameData = trace.getString();
+	str << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << getStringStr(nameData) << ");";
 }
 
 void CallLogWrapper::glBindFragDataLocationIndexed (glw::GLuint program, glw::GLuint colorNumber, glw::GLuint index, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	m_gl.bindFragDataLocationIndexed(program, colorNumber, index, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindFragDataLocationIndexed) << program << colorNumber << index << traceString(name) << CallTrace::EndRecord;
+}
+
+static void formatGlBindFramebuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	str << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");";
 }
 
 void CallLogWrapper::glBindFramebuffer (glw::GLenum target, glw::GLuint framebuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");" << TestLog::EndMessage;
 	m_gl.bindFramebuffer(target, framebuffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindFramebuffer) << target << framebuffer << CallTrace::EndRecord;
+}
+
+static void formatGlBindImageTexture (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint unit = trace.get<glw::GLuint>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLboolean layered = trace.get<glw::GLboolean>();
+	glw::GLint layer = trace.get<glw::GLint>();
+	glw::GLenum access = trace.get<glw::GLenum>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	str << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");";
 }
 
 void CallLogWrapper::glBindImageTexture (glw::GLuint unit, glw::GLuint texture, glw::GLint level, glw::GLboolean layered, glw::GLint layer, glw::GLenum access, glw::GLenum format)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");" << TestLog::EndMessage;
 	m_gl.bindImageTexture(unit, texture, level, layered, layer, access, format);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindImageTexture) << unit << texture << level << layered << layer << access << format << CallTrace::EndRecord;
+}
+
+static void formatGlBindImageTextures (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *textures = trace.get<const glw::GLuint *>();
+	str << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
 }
 
 void CallLogWrapper::glBindImageTextures (glw::GLuint first, glw::GLsizei count, const glw::GLuint *textures)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
 	m_gl.bindImageTextures(first, count, textures);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindImageTextures) << first << count << textures << CallTrace::EndRecord;
+}
+
+static void formatGlBindMultiTextureEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	str << "glBindMultiTextureEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << texture << ");";
 }
 
 void CallLogWrapper::glBindMultiTextureEXT (glw::GLenum texunit, glw::GLenum target, glw::GLuint texture)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindMultiTextureEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << texture << ");" << TestLog::EndMessage;
 	m_gl.bindMultiTextureEXT(texunit, target, texture);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindMultiTextureEXT) << texunit << target << texture << CallTrace::EndRecord;
+}
+
+static void formatGlBindProgramPipeline (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	str << "glBindProgramPipeline(" << pipeline << ");";
 }
 
 void CallLogWrapper::glBindProgramPipeline (glw::GLuint pipeline)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
 	m_gl.bindProgramPipeline(pipeline);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindProgramPipeline) << pipeline << CallTrace::EndRecord;
+}
+
+static void formatGlBindRenderbuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	str << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");";
 }
 
 void CallLogWrapper::glBindRenderbuffer (glw::GLenum target, glw::GLuint renderbuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
 	m_gl.bindRenderbuffer(target, renderbuffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindRenderbuffer) << target << renderbuffer << CallTrace::EndRecord;
+}
+
+static void formatGlBindSampler (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint unit = trace.get<glw::GLuint>();
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	str << "glBindSampler(" << unit << ", " << sampler << ");";
 }
 
 void CallLogWrapper::glBindSampler (glw::GLuint unit, glw::GLuint sampler)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindSampler(" << unit << ", " << sampler << ");" << TestLog::EndMessage;
 	m_gl.bindSampler(unit, sampler);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindSampler) << unit << sampler << CallTrace::EndRecord;
+}
+
+static void formatGlBindSamplers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *samplers = trace.get<const glw::GLuint *>();
+	str << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
 }
 
 void CallLogWrapper::glBindSamplers (glw::GLuint first, glw::GLsizei count, const glw::GLuint *samplers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
 	m_gl.bindSamplers(first, count, samplers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindSamplers) << first << count << samplers << CallTrace::EndRecord;
+}
+
+static void formatGlBindTexture (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	str << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");";
 }
 
 void CallLogWrapper::glBindTexture (glw::GLenum target, glw::GLuint texture)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");" << TestLog::EndMessage;
 	m_gl.bindTexture(target, texture);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindTexture) << target << texture << CallTrace::EndRecord;
+}
+
+static void formatGlBindTextureUnit (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint unit = trace.get<glw::GLuint>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	str << "glBindTextureUnit(" << unit << ", " << texture << ");";
 }
 
 void CallLogWrapper::glBindTextureUnit (glw::GLuint unit, glw::GLuint texture)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindTextureUnit(" << unit << ", " << texture << ");" << TestLog::EndMessage;
 	m_gl.bindTextureUnit(unit, texture);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindTextureUnit) << unit << texture << CallTrace::EndRecord;
+}
+
+static void formatGlBindTextures (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *textures = trace.get<const glw::GLuint *>();
+	str << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
 }
 
 void CallLogWrapper::glBindTextures (glw::GLuint first, glw::GLsizei count, const glw::GLuint *textures)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
 	m_gl.bindTextures(first, count, textures);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindTextures) << first << count << textures << CallTrace::EndRecord;
+}
+
+static void formatGlBindTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	str << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");";
 }
 
 void CallLogWrapper::glBindTransformFeedback (glw::GLenum target, glw::GLuint id)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
 	m_gl.bindTransformFeedback(target, id);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindTransformFeedback) << target << id << CallTrace::EndRecord;
+}
+
+static void formatGlBindVertexArray (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint array = trace.get<glw::GLuint>();
+	str << "glBindVertexArray(" << array << ");";
 }
 
 void CallLogWrapper::glBindVertexArray (glw::GLuint array)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindVertexArray(" << array << ");" << TestLog::EndMessage;
 	m_gl.bindVertexArray(array);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindVertexArray) << array << CallTrace::EndRecord;
+}
+
+static void formatGlBindVertexBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	str << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");";
 }
 
 void CallLogWrapper::glBindVertexBuffer (glw::GLuint bindingindex, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizei stride)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
 	m_gl.bindVertexBuffer(bindingindex, buffer, offset, stride);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindVertexBuffer) << bindingindex << buffer << offset << stride << CallTrace::EndRecord;
+}
+
+static void formatGlBindVertexBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *buffers = trace.get<const glw::GLuint *>();
+	const glw::GLintptr *offsets = trace.get<const glw::GLintptr *>();
+	const glw::GLsizei *strides = trace.get<const glw::GLsizei *>();
+	str << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");";
 }
 
 void CallLogWrapper::glBindVertexBuffers (glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers, const glw::GLintptr *offsets, const glw::GLsizei *strides)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
 	m_gl.bindVertexBuffers(first, count, buffers, offsets, strides);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBindVertexBuffers) << first << count << buffers << offsets << strides << CallTrace::EndRecord;
+}
+
+static void formatGlBlendBarrier (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glBlendBarrier(" << ");";
 }
 
 void CallLogWrapper::glBlendBarrier (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendBarrier(" << ");" << TestLog::EndMessage;
 	m_gl.blendBarrier();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendBarrier) << CallTrace::EndRecord;
+}
+
+static void formatGlBlendColor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat red = trace.get<glw::GLfloat>();
+	glw::GLfloat green = trace.get<glw::GLfloat>();
+	glw::GLfloat blue = trace.get<glw::GLfloat>();
+	glw::GLfloat alpha = trace.get<glw::GLfloat>();
+	str << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");";
 }
 
 void CallLogWrapper::glBlendColor (glw::GLfloat red, glw::GLfloat green, glw::GLfloat blue, glw::GLfloat alpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
 	m_gl.blendColor(red, green, blue, alpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendColor) << red << green << blue << alpha << CallTrace::EndRecord;
+}
+
+static void formatGlBlendEquation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glBlendEquation(" << getBlendEquationStr(mode) << ");";
 }
 
 void CallLogWrapper::glBlendEquation (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendEquation(" << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
 	m_gl.blendEquation(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendEquation) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlBlendEquationSeparate (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum modeRGB = trace.get<glw::GLenum>();
+	glw::GLenum modeAlpha = trace.get<glw::GLenum>();
+	str << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");";
 }
 
 void CallLogWrapper::glBlendEquationSeparate (glw::GLenum modeRGB, glw::GLenum modeAlpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
 	m_gl.blendEquationSeparate(modeRGB, modeAlpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendEquationSeparate) << modeRGB << modeAlpha << CallTrace::EndRecord;
+}
+
+static void formatGlBlendEquationSeparatei (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buf = trace.get<glw::GLuint>();
+	glw::GLenum modeRGB = trace.get<glw::GLenum>();
+	glw::GLenum modeAlpha = trace.get<glw::GLenum>();
+	str << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");";
 }
 
 void CallLogWrapper::glBlendEquationSeparatei (glw::GLuint buf, glw::GLenum modeRGB, glw::GLenum modeAlpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
 	m_gl.blendEquationSeparatei(buf, modeRGB, modeAlpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendEquationSeparatei) << buf << modeRGB << modeAlpha << CallTrace::EndRecord;
+}
+
+static void formatGlBlendEquationi (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buf = trace.get<glw::GLuint>();
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");";
 }
 
 void CallLogWrapper::glBlendEquationi (glw::GLuint buf, glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
 	m_gl.blendEquationi(buf, mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendEquationi) << buf << mode << CallTrace::EndRecord;
+}
+
+static void formatGlBlendFunc (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum sfactor = trace.get<glw::GLenum>();
+	glw::GLenum dfactor = trace.get<glw::GLenum>();
+	str << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");";
 }
 
 void CallLogWrapper::glBlendFunc (glw::GLenum sfactor, glw::GLenum dfactor)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");" << TestLog::EndMessage;
 	m_gl.blendFunc(sfactor, dfactor);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendFunc) << sfactor << dfactor << CallTrace::EndRecord;
+}
+
+static void formatGlBlendFuncSeparate (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum sfactorRGB = trace.get<glw::GLenum>();
+	glw::GLenum dfactorRGB = trace.get<glw::GLenum>();
+	glw::GLenum sfactorAlpha = trace.get<glw::GLenum>();
+	glw::GLenum dfactorAlpha = trace.get<glw::GLenum>();
+	str << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");";
 }
 
 void CallLogWrapper::glBlendFuncSeparate (glw::GLenum sfactorRGB, glw::GLenum dfactorRGB, glw::GLenum sfactorAlpha, glw::GLenum dfactorAlpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");" << TestLog::EndMessage;
 	m_gl.blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendFuncSeparate) << sfactorRGB << dfactorRGB << sfactorAlpha << dfactorAlpha << CallTrace::EndRecord;
+}
+
+static void formatGlBlendFuncSeparatei (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buf = trace.get<glw::GLuint>();
+	glw::GLenum srcRGB = trace.get<glw::GLenum>();
+	glw::GLenum dstRGB = trace.get<glw::GLenum>();
+	glw::GLenum srcAlpha = trace.get<glw::GLenum>();
+	glw::GLenum dstAlpha = trace.get<glw::GLenum>();
+	str << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");";
 }
 
 void CallLogWrapper::glBlendFuncSeparatei (glw::GLuint buf, glw::GLenum srcRGB, glw::GLenum dstRGB, glw::GLenum srcAlpha, glw::GLenum dstAlpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");" << TestLog::EndMessage;
 	m_gl.blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendFuncSeparatei) << buf << srcRGB << dstRGB << srcAlpha << dstAlpha << CallTrace::EndRecord;
+}
+
+static void formatGlBlendFunci (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buf = trace.get<glw::GLuint>();
+	glw::GLenum src = trace.get<glw::GLenum>();
+	glw::GLenum dst = trace.get<glw::GLenum>();
+	str << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");";
 }
 
 void CallLogWrapper::glBlendFunci (glw::GLuint buf, glw::GLenum src, glw::GLenum dst)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");" << TestLog::EndMessage;
 	m_gl.blendFunci(buf, src, dst);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlendFunci) << buf << src << dst << CallTrace::EndRecord;
+}
+
+static void formatGlBlitFramebuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint srcX0 = trace.get<glw::GLint>();
+	glw::GLint srcY0 = trace.get<glw::GLint>();
+	glw::GLint srcX1 = trace.get<glw::GLint>();
+	glw::GLint srcY1 = trace.get<glw::GLint>();
+	glw::GLint dstX0 = trace.get<glw::GLint>();
+	glw::GLint dstY0 = trace.get<glw::GLint>();
+	glw::GLint dstX1 = trace.get<glw::GLint>();
+	glw::GLint dstY1 = trace.get<glw::GLint>();
+	glw::GLbitfield mask = trace.get<glw::GLbitfield>();
+	glw::GLenum filter = trace.get<glw::GLenum>();
+	str << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");";
 }
 
 void CallLogWrapper::glBlitFramebuffer (glw::GLint srcX0, glw::GLint srcY0, glw::GLint srcX1, glw::GLint srcY1, glw::GLint dstX0, glw::GLint dstY0, glw::GLint dstX1, glw::GLint dstY1, glw::GLbitfield mask, glw::GLenum filter)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");" << TestLog::EndMessage;
 	m_gl.blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlitFramebuffer) << srcX0 << srcY0 << srcX1 << srcY1 << dstX0 << dstY0 << dstX1 << dstY1 << mask << filter << CallTrace::EndRecord;
+}
+
+static void formatGlBlitNamedFramebuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint readFramebuffer = trace.get<glw::GLuint>();
+	glw::GLuint drawFramebuffer = trace.get<glw::GLuint>();
+	glw::GLint srcX0 = trace.get<glw::GLint>();
+	glw::GLint srcY0 = trace.get<glw::GLint>();
+	glw::GLint srcX1 = trace.get<glw::GLint>();
+	glw::GLint srcY1 = trace.get<glw::GLint>();
+	glw::GLint dstX0 = trace.get<glw::GLint>();
+	glw::GLint dstY0 = trace.get<glw::GLint>();
+	glw::GLint dstX1 = trace.get<glw::GLint>();
+	glw::GLint dstY1 = trace.get<glw::GLint>();
+	glw::GLbitfield mask = trace.get<glw::GLbitfield>();
+	glw::GLenum filter = trace.get<glw::GLenum>();
+	str << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");";
 }
 
 void CallLogWrapper::glBlitNamedFramebuffer (glw::GLuint readFramebuffer, glw::GLuint drawFramebuffer, glw::GLint srcX0, glw::GLint srcY0, glw::GLint srcX1, glw::GLint srcY1, glw::GLint dstX0, glw::GLint dstY0, glw::GLint dstX1, glw::GLint dstY1, glw::GLbitfield mask, glw::GLenum filter)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
 	m_gl.blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBlitNamedFramebuffer) << readFramebuffer << drawFramebuffer << srcX0 << srcY0 << srcX1 << srcY1 << dstX0 << dstY0 << dstX1 << dstY1 << mask << filter << CallTrace::EndRecord;
+}
+
+static void formatGlBufferData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	const void *data = trace.get<const void *>();
+	glw::GLenum usage = trace.get<glw::GLenum>();
+	str << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << data << ", " << getUsageStr(usage) << ");";
 }
 
 void CallLogWrapper::glBufferData (glw::GLenum target, glw::GLsizeiptr size, const void *data, glw::GLenum usage)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << data << ", " << getUsageStr(usage) << ");" << TestLog::EndMessage;
 	m_gl.bufferData(target, size, data, usage);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBufferData) << target << size << data << usage << CallTrace::EndRecord;
+}
+
+static void formatGlBufferPageCommitmentARB (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	glw::GLboolean commit = trace.get<glw::GLboolean>();
+	str << "glBufferPageCommitmentARB(" << toHex(target) << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");";
 }
 
 void CallLogWrapper::glBufferPageCommitmentARB (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLboolean commit)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBufferPageCommitmentARB(" << toHex(target) << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
 	m_gl.bufferPageCommitmentARB(target, offset, size, commit);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBufferPageCommitmentARB) << target << offset << size << commit << CallTrace::EndRecord;
+}
+
+static void formatGlBufferStorage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	const void *data = trace.get<const void *>();
+	glw::GLbitfield flags = trace.get<glw::GLbitfield>();
+	str << "glBufferStorage(" << toHex(target) << ", " << size << ", " << data << ", " << toHex(flags) << ");";
 }
 
 void CallLogWrapper::glBufferStorage (glw::GLenum target, glw::GLsizeiptr size, const void *data, glw::GLbitfield flags)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBufferStorage(" << toHex(target) << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
 	m_gl.bufferStorage(target, size, data, flags);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBufferStorage) << target << size << data << flags << CallTrace::EndRecord;
+}
+
+static void formatGlBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	const void *data = trace.get<const void *>();
+	str << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << data << ");";
 }
 
 void CallLogWrapper::glBufferSubData (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr size, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.bufferSubData(target, offset, size, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlBufferSubData) << target << offset << size << data << CallTrace::EndRecord;
+}
+
+static void formatGlCheckFramebufferStatus (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum returnValue = trace.get<glw::GLenum>();
+	str << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");";
+	str << "\n// " << getFramebufferStatusStr(returnValue) << " returned";
 }
 
 glw::GLenum CallLogWrapper::glCheckFramebufferStatus (glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");" << TestLog::EndMessage;
 	glw::GLenum returnValue = m_gl.checkFramebufferStatus(target);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getFramebufferStatusStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCheckFramebufferStatus) << target << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlCheckNamedFramebufferStatus (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum returnValue = trace.get<glw::GLenum>();
+	str << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");";
+	str << "\n// " << toHex(returnValue) << " returned";
+}
+
 glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatus (glw::GLuint framebuffer, glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatus(framebuffer, target);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCheckNamedFramebufferStatus) << framebuffer << target << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlClampColor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum clamp = trace.get<glw::GLenum>();
+	str << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");";
+}
+
 void CallLogWrapper::glClampColor (glw::GLenum target, glw::GLenum clamp)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");" << TestLog::EndMessage;
 	m_gl.clampColor(target, clamp);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClampColor) << target << clamp << CallTrace::EndRecord;
+}
+
+static void formatGlClear (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLbitfield mask = trace.get<glw::GLbitfield>();
+	str << "glClear(" << getBufferMaskStr(mask) << ");";
 }
 
 void CallLogWrapper::glClear (glw::GLbitfield mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClear(" << getBufferMaskStr(mask) << ");" << TestLog::EndMessage;
 	m_gl.clear(mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClear) << mask << CallTrace::EndRecord;
+}
+
+static void formatGlClearBufferData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *data = trace.get<const void *>();
+	str << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");";
 }
 
 void CallLogWrapper::glClearBufferData (glw::GLenum target, glw::GLenum internalformat, glw::GLenum format, glw::GLenum type, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.clearBufferData(target, internalformat, format, type, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearBufferData) << target << internalformat << format << type << data << CallTrace::EndRecord;
+}
+
+static void formatGlClearBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *data = trace.get<const void *>();
+	str << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");";
 }
 
 void CallLogWrapper::glClearBufferSubData (glw::GLenum target, glw::GLenum internalformat, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLenum format, glw::GLenum type, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.clearBufferSubData(target, internalformat, offset, size, format, type, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearBufferSubData) << target << internalformat << offset << size << format << type << data << CallTrace::EndRecord;
+}
+
+static void formatGlClearBufferfi (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	glw::GLfloat depth = trace.get<glw::GLfloat>();
+	glw::GLint stencil = trace.get<glw::GLint>();
+	str << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");";
 }
 
 void CallLogWrapper::glClearBufferfi (glw::GLenum buffer, glw::GLint drawbuffer, glw::GLfloat depth, glw::GLint stencil)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
 	m_gl.clearBufferfi(buffer, drawbuffer, depth, stencil);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearBufferfi) << buffer << drawbuffer << depth << stencil << CallTrace::EndRecord;
+}
+
+static void formatGlClearBufferfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	const glw::GLfloat *value = trace.get<const glw::GLfloat *>();
+	str << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glClearBufferfv (glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.clearBufferfv(buffer, drawbuffer, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearBufferfv) << buffer << drawbuffer << value << CallTrace::EndRecord;
+}
+
+static void formatGlClearBufferiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	const glw::GLint *value = trace.get<const glw::GLint *>();
+	str << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glClearBufferiv (glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.clearBufferiv(buffer, drawbuffer, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearBufferiv) << buffer << drawbuffer << value << CallTrace::EndRecord;
+}
+
+static void formatGlClearBufferuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	const glw::GLuint *value = trace.get<const glw::GLuint *>();
+	str << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glClearBufferuiv (glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.clearBufferuiv(buffer, drawbuffer, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearBufferuiv) << buffer << drawbuffer << value << CallTrace::EndRecord;
+}
+
+static void formatGlClearColor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat red = trace.get<glw::GLfloat>();
+	glw::GLfloat green = trace.get<glw::GLfloat>();
+	glw::GLfloat blue = trace.get<glw::GLfloat>();
+	glw::GLfloat alpha = trace.get<glw::GLfloat>();
+	str << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");";
 }
 
 void CallLogWrapper::glClearColor (glw::GLfloat red, glw::GLfloat green, glw::GLfloat blue, glw::GLfloat alpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
 	m_gl.clearColor(red, green, blue, alpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearColor) << red << green << blue << alpha << CallTrace::EndRecord;
+}
+
+static void formatGlClearDepth (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLdouble depth = trace.get<glw::GLdouble>();
+	str << "glClearDepth(" << depth << ");";
 }
 
 void CallLogWrapper::glClearDepth (glw::GLdouble depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearDepth(" << depth << ");" << TestLog::EndMessage;
 	m_gl.clearDepth(depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearDepth) << depth << CallTrace::EndRecord;
+}
+
+static void formatGlClearDepthf (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat d = trace.get<glw::GLfloat>();
+	str << "glClearDepthf(" << d << ");";
 }
 
 void CallLogWrapper::glClearDepthf (glw::GLfloat d)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearDepthf(" << d << ");" << TestLog::EndMessage;
 	m_gl.clearDepthf(d);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearDepthf) << d << CallTrace::EndRecord;
+}
+
+static void formatGlClearNamedBufferData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *data = trace.get<const void *>();
+	str << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");";
 }
 
 void CallLogWrapper::glClearNamedBufferData (glw::GLuint buffer, glw::GLenum internalformat, glw::GLenum format, glw::GLenum type, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.clearNamedBufferData(buffer, internalformat, format, type, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearNamedBufferData) << buffer << internalformat << format << type << data << CallTrace::EndRecord;
+}
+
+static void formatGlClearNamedBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *data = trace.get<const void *>();
+	str << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");";
 }
 
 void CallLogWrapper::glClearNamedBufferSubData (glw::GLuint buffer, glw::GLenum internalformat, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLenum format, glw::GLenum type, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.clearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearNamedBufferSubData) << buffer << internalformat << offset << size << format << type << data << CallTrace::EndRecord;
+}
+
+static void formatGlClearNamedFramebufferfi (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	glw::GLfloat depth = trace.get<glw::GLfloat>();
+	glw::GLint stencil = trace.get<glw::GLint>();
+	str << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");";
 }
 
 void CallLogWrapper::glClearNamedFramebufferfi (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, glw::GLfloat depth, glw::GLint stencil)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
 	m_gl.clearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearNamedFramebufferfi) << framebuffer << buffer << drawbuffer << depth << stencil << CallTrace::EndRecord;
+}
+
+static void formatGlClearNamedFramebufferfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	const glw::GLfloat *value = trace.get<const glw::GLfloat *>();
+	str << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glClearNamedFramebufferfv (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.clearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearNamedFramebufferfv) << framebuffer << buffer << drawbuffer << value << CallTrace::EndRecord;
+}
+
+static void formatGlClearNamedFramebufferiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	const glw::GLint *value = trace.get<const glw::GLint *>();
+	str << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glClearNamedFramebufferiv (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.clearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearNamedFramebufferiv) << framebuffer << buffer << drawbuffer << value << CallTrace::EndRecord;
+}
+
+static void formatGlClearNamedFramebufferuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum buffer = trace.get<glw::GLenum>();
+	glw::GLint drawbuffer = trace.get<glw::GLint>();
+	const glw::GLuint *value = trace.get<const glw::GLuint *>();
+	str << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glClearNamedFramebufferuiv (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.clearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearNamedFramebufferuiv) << framebuffer << buffer << drawbuffer << value << CallTrace::EndRecord;
+}
+
+static void formatGlClearStencil (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint s = trace.get<glw::GLint>();
+	str << "glClearStencil(" << s << ");";
 }
 
 void CallLogWrapper::glClearStencil (glw::GLint s)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearStencil(" << s << ");" << TestLog::EndMessage;
 	m_gl.clearStencil(s);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearStencil) << s << CallTrace::EndRecord;
+}
+
+static void formatGlClearTexImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *data = trace.get<const void *>();
+	str << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");";
 }
 
 void CallLogWrapper::glClearTexImage (glw::GLuint texture, glw::GLint level, glw::GLenum format, glw::GLenum type, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.clearTexImage(texture, level, format, type, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearTexImage) << texture << level << format << type << data << CallTrace::EndRecord;
+}
+
+static void formatGlClearTexSubImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *data = trace.get<const void *>();
+	str << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");";
 }
 
 void CallLogWrapper::glClearTexSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.clearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClearTexSubImage) << texture << level << xoffset << yoffset << zoffset << width << height << depth << format << type << data << CallTrace::EndRecord;
+}
+
+static void formatGlClientAttribDefaultEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLbitfield mask = trace.get<glw::GLbitfield>();
+	str << "glClientAttribDefaultEXT(" << toHex(mask) << ");";
 }
 
 void CallLogWrapper::glClientAttribDefaultEXT (glw::GLbitfield mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
 	m_gl.clientAttribDefaultEXT(mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClientAttribDefaultEXT) << mask << CallTrace::EndRecord;
+}
+
+static void formatGlClientWaitSync (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsync sync = trace.get<glw::GLsync>();
+	glw::GLbitfield flags = trace.get<glw::GLbitfield>();
+	glw::GLuint64 timeout = trace.get<glw::GLuint64>();
+	glw::GLenum returnValue = trace.get<glw::GLenum>();
+	str << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");";
+	str << "\n// " << toHex(returnValue) << " returned";
 }
 
 glw::GLenum CallLogWrapper::glClientWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::GLuint64 timeout)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
 	glw::GLenum returnValue = m_gl.clientWaitSync(sync, flags, timeout);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClientWaitSync) << sync << flags << timeout << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlClipControl (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum origin = trace.get<glw::GLenum>();
+	glw::GLenum depth = trace.get<glw::GLenum>();
+	str << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");";
+}
+
 void CallLogWrapper::glClipControl (glw::GLenum origin, glw::GLenum depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");" << TestLog::EndMessage;
 	m_gl.clipControl(origin, depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlClipControl) << origin << depth << CallTrace::EndRecord;
+}
+
+static void formatGlColorMask (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLboolean red = trace.get<glw::GLboolean>();
+	glw::GLboolean green = trace.get<glw::GLboolean>();
+	glw::GLboolean blue = trace.get<glw::GLboolean>();
+	glw::GLboolean alpha = trace.get<glw::GLboolean>();
+	str << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");";
 }
 
 void CallLogWrapper::glColorMask (glw::GLboolean red, glw::GLboolean green, glw::GLboolean blue, glw::GLboolean alpha)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");" << TestLog::EndMessage;
 	m_gl.colorMask(red, green, blue, alpha);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlColorMask) << red << green << blue << alpha << CallTrace::EndRecord;
+}
+
+static void formatGlColorMaski (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLboolean r = trace.get<glw::GLboolean>();
+	glw::GLboolean g = trace.get<glw::GLboolean>();
+	glw::GLboolean b = trace.get<glw::GLboolean>();
+	glw::GLboolean a = trace.get<glw::GLboolean>();
+	str << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");";
 }
 
 void CallLogWrapper::glColorMaski (glw::GLuint index, glw::GLboolean r, glw::GLboolean g, glw::GLboolean b, glw::GLboolean a)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");" << TestLog::EndMessage;
 	m_gl.colorMaski(index, r, g, b, a);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlColorMaski) << index << r << g << b << a << CallTrace::EndRecord;
+}
+
+static void formatGlCompileShader (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	str << "glCompileShader(" << shader << ");";
 }
 
 void CallLogWrapper::glCompileShader (glw::GLuint shader)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompileShader(" << shader << ");" << TestLog::EndMessage;
 	m_gl.compileShader(shader);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompileShader) << shader << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedMultiTexImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedMultiTexImage1DEXT) << texunit << target << level << internalformat << width << border << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedMultiTexImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedMultiTexImage2DEXT) << texunit << target << level << internalformat << width << height << border << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedMultiTexImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedMultiTexImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedMultiTexImage3DEXT) << texunit << target << level << internalformat << width << height << depth << border << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedMultiTexSubImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedMultiTexSubImage1DEXT) << texunit << target << level << xoffset << width << format << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedMultiTexSubImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedMultiTexSubImage2DEXT) << texunit << target << level << xoffset << yoffset << width << height << format << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedMultiTexSubImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedMultiTexSubImage3DEXT) << texunit << target << level << xoffset << yoffset << zoffset << width << height << depth << format << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexImage1D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexImage1D) << target << level << internalformat << width << border << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexImage2D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexImage2D) << target << level << internalformat << width << height << border << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexImage3D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexImage3D) << target << level << internalformat << width << height << depth << border << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexImage3DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexImage3DOES (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexImage3DOES) << target << level << internalformat << width << height << depth << border << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexSubImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexSubImage1D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexSubImage1D) << target << level << xoffset << width << format << imageSize << data << CallTrace::EndRecord;
 }
 
-void CallLogWrapper::glCompressedTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *data)
+static void formatGlCompressedTexSubImage2D (std::ostream& str, CallTraceReader& trace)
 {
-	if (m_enableLog)
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");";
+}
+
+void CallLogWrapper::glCompressedTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *data)
+{
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexSubImage2D) << target << level << xoffset << yoffset << width << height << format << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexSubImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexSubImage3D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexSubImage3D) << target << level << xoffset << yoffset << zoffset << width << height << depth << format << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTexSubImage3DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTexSubImage3DOES (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTexSubImage3DOES) << target << level << xoffset << yoffset << zoffset << width << height << depth << format << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedTextureImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureImage1DEXT(texture, target, level, internalformat, width, border, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureImage1DEXT) << texture << target << level << internalformat << width << border << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedTextureImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureImage2DEXT(texture, target, level, internalformat, width, height, border, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureImage2DEXT) << texture << target << level << internalformat << width << height << border << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedTextureImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureImage3DEXT) << texture << target << level << internalformat << width << height << depth << border << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureSubImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTextureSubImage1D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureSubImage1D) << texture << level << xoffset << width << format << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureSubImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureSubImage1DEXT(texture, target, level, xoffset, width, format, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureSubImage1DEXT) << texture << target << level << xoffset << width << format << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureSubImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTextureSubImage2D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureSubImage2D) << texture << level << xoffset << yoffset << width << height << format << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureSubImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureSubImage2DEXT) << texture << target << level << xoffset << yoffset << width << height << format << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureSubImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *data = trace.get<const void *>();
+	str << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glCompressedTextureSubImage3D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureSubImage3D) << texture << level << xoffset << yoffset << zoffset << width << height << depth << format << imageSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlCompressedTextureSubImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei imageSize = trace.get<glw::GLsizei>();
+	const void *bits = trace.get<const void *>();
+	str << "glCompressedTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");";
 }
 
 void CallLogWrapper::glCompressedTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
 	m_gl.compressedTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCompressedTextureSubImage3DEXT) << texture << target << level << xoffset << yoffset << zoffset << width << height << depth << format << imageSize << bits << CallTrace::EndRecord;
+}
+
+static void formatGlCopyBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum readTarget = trace.get<glw::GLenum>();
+	glw::GLenum writeTarget = trace.get<glw::GLenum>();
+	glw::GLintptr readOffset = trace.get<glw::GLintptr>();
+	glw::GLintptr writeOffset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");";
 }
 
 void CallLogWrapper::glCopyBufferSubData (glw::GLenum readTarget, glw::GLenum writeTarget, glw::GLintptr readOffset, glw::GLintptr writeOffset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyBufferSubData) << readTarget << writeTarget << readOffset << writeOffset << size << CallTrace::EndRecord;
+}
+
+static void formatGlCopyImageSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint srcName = trace.get<glw::GLuint>();
+	glw::GLenum srcTarget = trace.get<glw::GLenum>();
+	glw::GLint srcLevel = trace.get<glw::GLint>();
+	glw::GLint srcX = trace.get<glw::GLint>();
+	glw::GLint srcY = trace.get<glw::GLint>();
+	glw::GLint srcZ = trace.get<glw::GLint>();
+	glw::GLuint dstName = trace.get<glw::GLuint>();
+	glw::GLenum dstTarget = trace.get<glw::GLenum>();
+	glw::GLint dstLevel = trace.get<glw::GLint>();
+	glw::GLint dstX = trace.get<glw::GLint>();
+	glw::GLint dstY = trace.get<glw::GLint>();
+	glw::GLint dstZ = trace.get<glw::GLint>();
+	glw::GLsizei srcWidth = trace.get<glw::GLsizei>();
+	glw::GLsizei srcHeight = trace.get<glw::GLsizei>();
+	glw::GLsizei srcDepth = trace.get<glw::GLsizei>();
+	str << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");";
 }
 
 void CallLogWrapper::glCopyImageSubData (glw::GLuint srcName, glw::GLenum srcTarget, glw::GLint srcLevel, glw::GLint srcX, glw::GLint srcY, glw::GLint srcZ, glw::GLuint dstName, glw::GLenum dstTarget, glw::GLint dstLevel, glw::GLint dstX, glw::GLint dstY, glw::GLint dstZ, glw::GLsizei srcWidth, glw::GLsizei srcHeight, glw::GLsizei srcDepth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
 	m_gl.copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyImageSubData) << srcName << srcTarget << srcLevel << srcX << srcY << srcZ << dstName << dstTarget << dstLevel << dstX << dstY << dstZ << srcWidth << srcHeight << srcDepth << CallTrace::EndRecord;
+}
+
+static void formatGlCopyMultiTexImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	str << "glCopyMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");";
 }
 
 void CallLogWrapper::glCopyMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLint border)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
 	m_gl.copyMultiTexImage1DEXT(texunit, target, level, internalformat, x, y, width, border);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyMultiTexImage1DEXT) << texunit << target << level << internalformat << x << y << width << border << CallTrace::EndRecord;
+}
+
+static void formatGlCopyMultiTexImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	str << "glCopyMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");";
 }
 
 void CallLogWrapper::glCopyMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLint border)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
 	m_gl.copyMultiTexImage2DEXT(texunit, target, level, internalformat, x, y, width, height, border);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyMultiTexImage2DEXT) << texunit << target << level << internalformat << x << y << width << height << border << CallTrace::EndRecord;
+}
+
+static void formatGlCopyMultiTexSubImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glCopyMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
 }
 
 void CallLogWrapper::glCopyMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.copyMultiTexSubImage1DEXT(texunit, target, level, xoffset, x, y, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyMultiTexSubImage1DEXT) << texunit << target << level << xoffset << x << y << width << CallTrace::EndRecord;
+}
+
+static void formatGlCopyMultiTexSubImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyMultiTexSubImage2DEXT) << texunit << target << level << xoffset << yoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyMultiTexSubImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyMultiTexSubImage3DEXT) << texunit << target << level << xoffset << yoffset << zoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyNamedBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint readBuffer = trace.get<glw::GLuint>();
+	glw::GLuint writeBuffer = trace.get<glw::GLuint>();
+	glw::GLintptr readOffset = trace.get<glw::GLintptr>();
+	glw::GLintptr writeOffset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");";
 }
 
 void CallLogWrapper::glCopyNamedBufferSubData (glw::GLuint readBuffer, glw::GLuint writeBuffer, glw::GLintptr readOffset, glw::GLintptr writeOffset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyNamedBufferSubData) << readBuffer << writeBuffer << readOffset << writeOffset << size << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTexImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	str << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");";
 }
 
 void CallLogWrapper::glCopyTexImage1D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLint border)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
 	m_gl.copyTexImage1D(target, level, internalformat, x, y, width, border);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTexImage1D) << target << level << internalformat << x << y << width << border << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTexImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	str << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");";
 }
 
 void CallLogWrapper::glCopyTexImage2D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLint border)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
 	m_gl.copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTexImage2D) << target << level << internalformat << x << y << width << height << border << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTexSubImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
 }
 
 void CallLogWrapper::glCopyTexSubImage1D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.copyTexSubImage1D(target, level, xoffset, x, y, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTexSubImage1D) << target << level << xoffset << x << y << width << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTexSubImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTexSubImage2D) << target << level << xoffset << yoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTexSubImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTexSubImage3D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTexSubImage3D) << target << level << xoffset << yoffset << zoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTexSubImage3DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTexSubImage3DOES (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTexSubImage3DOES) << target << level << xoffset << yoffset << zoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	str << "glCopyTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");";
 }
 
 void CallLogWrapper::glCopyTextureImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLint border)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
 	m_gl.copyTextureImage1DEXT(texture, target, level, internalformat, x, y, width, border);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureImage1DEXT) << texture << target << level << internalformat << x << y << width << border << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	str << "glCopyTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");";
 }
 
 void CallLogWrapper::glCopyTextureImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLint border)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
 	m_gl.copyTextureImage2DEXT(texture, target, level, internalformat, x, y, width, height, border);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureImage2DEXT) << texture << target << level << internalformat << x << y << width << height << border << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureSubImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
 }
 
 void CallLogWrapper::glCopyTextureSubImage1D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.copyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureSubImage1D) << texture << level << xoffset << x << y << width << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureSubImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glCopyTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
 }
 
 void CallLogWrapper::glCopyTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.copyTextureSubImage1DEXT(texture, target, level, xoffset, x, y, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureSubImage1DEXT) << texture << target << level << xoffset << x << y << width << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureSubImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTextureSubImage2D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureSubImage2D) << texture << level << xoffset << yoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureSubImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureSubImage2DEXT) << texture << target << level << xoffset << yoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureSubImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTextureSubImage3D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureSubImage3D) << texture << level << xoffset << yoffset << zoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCopyTextureSubImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glCopyTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glCopyTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCopyTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.copyTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCopyTextureSubImage3DEXT) << texture << target << level << xoffset << yoffset << zoffset << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlCreateBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *buffers = trace.get<glw::GLuint *>();
+	str << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
 }
 
 void CallLogWrapper::glCreateBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
 	m_gl.createBuffers(n, buffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateBuffers) << n << buffers << CallTrace::EndRecord;
+}
+
+static void formatGlCreateFramebuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *framebuffers = trace.get<glw::GLuint *>();
+	str << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");";
 }
 
 void CallLogWrapper::glCreateFramebuffers (glw::GLsizei n, glw::GLuint *framebuffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
 	m_gl.createFramebuffers(n, framebuffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateFramebuffers) << n << framebuffers << CallTrace::EndRecord;
+}
+
+static void formatGlCreateProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	str << "glCreateProgram(" << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLuint CallLogWrapper::glCreateProgram (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateProgram(" << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.createProgram();
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateProgram) << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlCreateProgramPipelines (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *pipelines = trace.get<glw::GLuint *>();
+	str << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");";
+}
+
 void CallLogWrapper::glCreateProgramPipelines (glw::GLsizei n, glw::GLuint *pipelines)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
 	m_gl.createProgramPipelines(n, pipelines);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateProgramPipelines) << n << pipelines << CallTrace::EndRecord;
+}
+
+static void formatGlCreateQueries (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *ids = trace.get<glw::GLuint *>();
+	str << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
 }
 
 void CallLogWrapper::glCreateQueries (glw::GLenum target, glw::GLsizei n, glw::GLuint *ids)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
 	m_gl.createQueries(target, n, ids);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateQueries) << target << n << ids << CallTrace::EndRecord;
+}
+
+static void formatGlCreateRenderbuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *renderbuffers = trace.get<glw::GLuint *>();
+	str << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");";
 }
 
 void CallLogWrapper::glCreateRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
 	m_gl.createRenderbuffers(n, renderbuffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateRenderbuffers) << n << renderbuffers << CallTrace::EndRecord;
+}
+
+static void formatGlCreateSamplers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *samplers = trace.get<glw::GLuint *>();
+	str << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
 }
 
 void CallLogWrapper::glCreateSamplers (glw::GLsizei n, glw::GLuint *samplers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
 	m_gl.createSamplers(n, samplers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateSamplers) << n << samplers << CallTrace::EndRecord;
+}
+
+static void formatGlCreateShader (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	str << "glCreateShader(" << getShaderTypeStr(type) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLuint CallLogWrapper::glCreateShader (glw::GLenum type)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateShader(" << getShaderTypeStr(type) << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.createShader(type);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateShader) << type << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlCreateShaderProgramv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLchar *const*strings = trace.get<const glw::GLchar *const*>();
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	str << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 glw::GLuint CallLogWrapper::glCreateShaderProgramv (glw::GLenum type, glw::GLsizei count, const glw::GLchar *const*strings)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.createShaderProgramv(type, count, strings);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateShaderProgramv) << type << count << strings << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlCreateTextures (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *textures = trace.get<glw::GLuint *>();
+	str << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+}
+
 void CallLogWrapper::glCreateTextures (glw::GLenum target, glw::GLsizei n, glw::GLuint *textures)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
 	m_gl.createTextures(target, n, textures);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateTextures) << target << n << textures << CallTrace::EndRecord;
+}
+
+static void formatGlCreateTransformFeedbacks (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *ids = trace.get<glw::GLuint *>();
+	str << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
 }
 
 void CallLogWrapper::glCreateTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
 	m_gl.createTransformFeedbacks(n, ids);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateTransformFeedbacks) << n << ids << CallTrace::EndRecord;
+}
+
+static void formatGlCreateVertexArrays (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *arrays = trace.get<glw::GLuint *>();
+	str << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");";
 }
 
 void CallLogWrapper::glCreateVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
 	m_gl.createVertexArrays(n, arrays);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCreateVertexArrays) << n << arrays << CallTrace::EndRecord;
+}
+
+static void formatGlCullFace (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glCullFace(" << getFaceStr(mode) << ");";
 }
 
 void CallLogWrapper::glCullFace (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glCullFace(" << getFaceStr(mode) << ");" << TestLog::EndMessage;
 	m_gl.cullFace(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlCullFace) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlDebugMessageCallback (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLDEBUGPROC callback = trace.get<glw::GLDEBUGPROC>();
+	const void *userParam = trace.get<const void *>();
+	str << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");";
 }
 
 void CallLogWrapper::glDebugMessageCallback (glw::GLDEBUGPROC callback, const void *userParam)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");" << TestLog::EndMessage;
 	m_gl.debugMessageCallback(callback, userParam);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDebugMessageCallback) << callback << userParam << CallTrace::EndRecord;
+}
+
+static void formatGlDebugMessageControl (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum source = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLenum severity = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean enabled = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLuint> idsData = trace.getArray<glw::GLuint>();
+	str << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << getPointerStr(idsData.arr, idsData.size) << ", " << getBooleanStr(enabled) << ");";
 }
 
 void CallLogWrapper::glDebugMessageControl (glw::GLenum source, glw::GLenum type, glw::GLenum severity, glw::GLsizei count, const glw::GLuint *ids, glw::GLboolean enabled)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << getPointerStr(ids, (count)) << ", " << getBooleanStr(enabled) << ");" << TestLog::EndMessage;
 	m_gl.debugMessageControl(source, type, severity, count, ids, enabled);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDebugMessageControl) << source << type << severity << count << enabled << traceArray(ids, (count)) << CallTrace::EndRecord;
+}
+
+static void formatGlDebugMessageInsert (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum source = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum severity = trace.get<glw::GLenum>();
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	const char* bufData = trace.getString();
+	str << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << getStringStr(bufData) << ");";
 }
 
 void CallLogWrapper::glDebugMessageInsert (glw::GLenum source, glw::GLenum type, glw::GLuint id, glw::GLenum severity, glw::GLsizei length, const glw::GLchar *buf)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << getStringStr(buf) << ");" << TestLog::EndMessage;
 	m_gl.debugMessageInsert(source, type, id, severity, length, buf);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDebugMessageInsert) << source << type << id << severity << length << traceString(buf) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> buffersData = trace.getArray<glw::GLuint>();
+	str << "glDeleteBuffers(" << n << ", " << getPointerStr(buffersData.arr, buffersData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteBuffers (glw::GLsizei n, const glw::GLuint *buffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteBuffers(" << n << ", " << getPointerStr(buffers, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteBuffers(n, buffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteBuffers) << n << traceArray(buffers, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteFramebuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> framebuffersData = trace.getArray<glw::GLuint>();
+	str << "glDeleteFramebuffers(" << n << ", " << getPointerStr(framebuffersData.arr, framebuffersData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteFramebuffers (glw::GLsizei n, const glw::GLuint *framebuffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteFramebuffers(" << n << ", " << getPointerStr(framebuffers, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteFramebuffers(n, framebuffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteFramebuffers) << n << traceArray(framebuffers, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	str << "glDeleteProgram(" << program << ");";
 }
 
 void CallLogWrapper::glDeleteProgram (glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteProgram(" << program << ");" << TestLog::EndMessage;
 	m_gl.deleteProgram(program);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteProgram) << program << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteProgramPipelines (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> pipelinesData = trace.getArray<glw::GLuint>();
+	str << "glDeleteProgramPipelines(" << n << ", " << getPointerStr(pipelinesData.arr, pipelinesData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteProgramPipelines (glw::GLsizei n, const glw::GLuint *pipelines)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteProgramPipelines(" << n << ", " << getPointerStr(pipelines, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteProgramPipelines(n, pipelines);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteProgramPipelines) << n << traceArray(pipelines, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteQueries (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> idsData = trace.getArray<glw::GLuint>();
+	str << "glDeleteQueries(" << n << ", " << getPointerStr(idsData.arr, idsData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteQueries (glw::GLsizei n, const glw::GLuint *ids)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteQueries(" << n << ", " << getPointerStr(ids, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteQueries(n, ids);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteQueries) << n << traceArray(ids, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteRenderbuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> renderbuffersData = trace.getArray<glw::GLuint>();
+	str << "glDeleteRenderbuffers(" << n << ", " << getPointerStr(renderbuffersData.arr, renderbuffersData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteRenderbuffers (glw::GLsizei n, const glw::GLuint *renderbuffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteRenderbuffers(" << n << ", " << getPointerStr(renderbuffers, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteRenderbuffers(n, renderbuffers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteRenderbuffers) << n << traceArray(renderbuffers, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteSamplers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *samplers = trace.get<const glw::GLuint *>();
+	str << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
 }
 
 void CallLogWrapper::glDeleteSamplers (glw::GLsizei count, const glw::GLuint *samplers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
 	m_gl.deleteSamplers(count, samplers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteSamplers) << count << samplers << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteShader (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	str << "glDeleteShader(" << shader << ");";
 }
 
 void CallLogWrapper::glDeleteShader (glw::GLuint shader)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteShader(" << shader << ");" << TestLog::EndMessage;
 	m_gl.deleteShader(shader);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteShader) << shader << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteSync (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsync sync = trace.get<glw::GLsync>();
+	str << "glDeleteSync(" << sync << ");";
 }
 
 void CallLogWrapper::glDeleteSync (glw::GLsync sync)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteSync(" << sync << ");" << TestLog::EndMessage;
 	m_gl.deleteSync(sync);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteSync) << sync << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteTextures (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> texturesData = trace.getArray<glw::GLuint>();
+	str << "glDeleteTextures(" << n << ", " << getPointerStr(texturesData.arr, texturesData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteTextures (glw::GLsizei n, const glw::GLuint *textures)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteTextures(" << n << ", " << getPointerStr(textures, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteTextures(n, textures);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteTextures) << n << traceArray(textures, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteTransformFeedbacks (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const glw::GLuint *ids = trace.get<const glw::GLuint *>();
+	str << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
 }
 
 void CallLogWrapper::glDeleteTransformFeedbacks (glw::GLsizei n, const glw::GLuint *ids)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
 	m_gl.deleteTransformFeedbacks(n, ids);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteTransformFeedbacks) << n << ids << CallTrace::EndRecord;
+}
+
+static void formatGlDeleteVertexArrays (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> arraysData = trace.getArray<glw::GLuint>();
+	str << "glDeleteVertexArrays(" << n << ", " << getPointerStr(arraysData.arr, arraysData.size) << ");";
 }
 
 void CallLogWrapper::glDeleteVertexArrays (glw::GLsizei n, const glw::GLuint *arrays)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDeleteVertexArrays(" << n << ", " << getPointerStr(arrays, n) << ");" << TestLog::EndMessage;
 	m_gl.deleteVertexArrays(n, arrays);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDeleteVertexArrays) << n << traceArray(arrays, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDepthBoundsEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLclampd zmin = trace.get<glw::GLclampd>();
+	glw::GLclampd zmax = trace.get<glw::GLclampd>();
+	str << "glDepthBoundsEXT(" << zmin << ", " << zmax << ");";
 }
 
 void CallLogWrapper::glDepthBoundsEXT (glw::GLclampd zmin, glw::GLclampd zmax)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthBoundsEXT(" << zmin << ", " << zmax << ");" << TestLog::EndMessage;
 	m_gl.depthBoundsEXT(zmin, zmax);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthBoundsEXT) << zmin << zmax << CallTrace::EndRecord;
+}
+
+static void formatGlDepthFunc (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum func = trace.get<glw::GLenum>();
+	str << "glDepthFunc(" << getCompareFuncStr(func) << ");";
 }
 
 void CallLogWrapper::glDepthFunc (glw::GLenum func)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthFunc(" << getCompareFuncStr(func) << ");" << TestLog::EndMessage;
 	m_gl.depthFunc(func);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthFunc) << func << CallTrace::EndRecord;
+}
+
+static void formatGlDepthMask (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLboolean flag = trace.get<glw::GLboolean>();
+	str << "glDepthMask(" << getBooleanStr(flag) << ");";
 }
 
 void CallLogWrapper::glDepthMask (glw::GLboolean flag)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthMask(" << getBooleanStr(flag) << ");" << TestLog::EndMessage;
 	m_gl.depthMask(flag);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthMask) << flag << CallTrace::EndRecord;
+}
+
+static void formatGlDepthRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLdouble near = trace.get<glw::GLdouble>();
+	glw::GLdouble far = trace.get<glw::GLdouble>();
+	str << "glDepthRange(" << near << ", " << far << ");";
 }
 
 void CallLogWrapper::glDepthRange (glw::GLdouble near, glw::GLdouble far)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthRange(" << near << ", " << far << ");" << TestLog::EndMessage;
 	m_gl.depthRange(near, far);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthRange) << near << far << CallTrace::EndRecord;
+}
+
+static void formatGlDepthRangeArrayfvOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLfloat *v = trace.get<const glw::GLfloat *>();
+	str << "glDepthRangeArrayfvOES(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glDepthRangeArrayfvOES (glw::GLuint first, glw::GLsizei count, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthRangeArrayfvOES(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.depthRangeArrayfvOES(first, count, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthRangeArrayfvOES) << first << count << v << CallTrace::EndRecord;
+}
+
+static void formatGlDepthRangeArrayv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *v = trace.get<const glw::GLdouble *>();
+	str << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glDepthRangeArrayv (glw::GLuint first, glw::GLsizei count, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.depthRangeArrayv(first, count, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthRangeArrayv) << first << count << v << CallTrace::EndRecord;
+}
+
+static void formatGlDepthRangeIndexed (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble n = trace.get<glw::GLdouble>();
+	glw::GLdouble f = trace.get<glw::GLdouble>();
+	str << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");";
 }
 
 void CallLogWrapper::glDepthRangeIndexed (glw::GLuint index, glw::GLdouble n, glw::GLdouble f)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
 	m_gl.depthRangeIndexed(index, n, f);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthRangeIndexed) << index << n << f << CallTrace::EndRecord;
+}
+
+static void formatGlDepthRangeIndexedfOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat n = trace.get<glw::GLfloat>();
+	glw::GLfloat f = trace.get<glw::GLfloat>();
+	str << "glDepthRangeIndexedfOES(" << index << ", " << n << ", " << f << ");";
 }
 
 void CallLogWrapper::glDepthRangeIndexedfOES (glw::GLuint index, glw::GLfloat n, glw::GLfloat f)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthRangeIndexedfOES(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
 	m_gl.depthRangeIndexedfOES(index, n, f);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthRangeIndexedfOES) << index << n << f << CallTrace::EndRecord;
+}
+
+static void formatGlDepthRangef (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat n = trace.get<glw::GLfloat>();
+	glw::GLfloat f = trace.get<glw::GLfloat>();
+	str << "glDepthRangef(" << n << ", " << f << ");";
 }
 
 void CallLogWrapper::glDepthRangef (glw::GLfloat n, glw::GLfloat f)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDepthRangef(" << n << ", " << f << ");" << TestLog::EndMessage;
 	m_gl.depthRangef(n, f);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDepthRangef) << n << f << CallTrace::EndRecord;
+}
+
+static void formatGlDetachShader (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	str << "glDetachShader(" << program << ", " << shader << ");";
 }
 
 void CallLogWrapper::glDetachShader (glw::GLuint program, glw::GLuint shader)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDetachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
 	m_gl.detachShader(program, shader);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDetachShader) << program << shader << CallTrace::EndRecord;
+}
+
+static void formatGlDisable (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum cap = trace.get<glw::GLenum>();
+	str << "glDisable(" << getEnableCapStr(cap) << ");";
 }
 
 void CallLogWrapper::glDisable (glw::GLenum cap)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
 	m_gl.disable(cap);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisable) << cap << CallTrace::EndRecord;
+}
+
+static void formatGlDisableClientStateIndexedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum array = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glDisableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");";
 }
 
 void CallLogWrapper::glDisableClientStateIndexedEXT (glw::GLenum array, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.disableClientStateIndexedEXT(array, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisableClientStateIndexedEXT) << array << index << CallTrace::EndRecord;
+}
+
+static void formatGlDisableClientStateiEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum array = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glDisableClientStateiEXT(" << toHex(array) << ", " << index << ");";
 }
 
 void CallLogWrapper::glDisableClientStateiEXT (glw::GLenum array, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.disableClientStateiEXT(array, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisableClientStateiEXT) << array << index << CallTrace::EndRecord;
+}
+
+static void formatGlDisableIndexedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glDisableIndexedEXT(" << toHex(target) << ", " << index << ");";
 }
 
 void CallLogWrapper::glDisableIndexedEXT (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisableIndexedEXT(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.disableIndexedEXT(target, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisableIndexedEXT) << target << index << CallTrace::EndRecord;
+}
+
+static void formatGlDisableVertexArrayAttrib (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");";
 }
 
 void CallLogWrapper::glDisableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.disableVertexArrayAttrib(vaobj, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisableVertexArrayAttrib) << vaobj << index << CallTrace::EndRecord;
+}
+
+static void formatGlDisableVertexArrayEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLenum array = trace.get<glw::GLenum>();
+	str << "glDisableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");";
 }
 
 void CallLogWrapper::glDisableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum array)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
 	m_gl.disableVertexArrayEXT(vaobj, array);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisableVertexArrayEXT) << vaobj << array << CallTrace::EndRecord;
+}
+
+static void formatGlDisableVertexAttribArray (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glDisableVertexAttribArray(" << index << ");";
 }
 
 void CallLogWrapper::glDisableVertexAttribArray (glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
 	m_gl.disableVertexAttribArray(index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisableVertexAttribArray) << index << CallTrace::EndRecord;
+}
+
+static void formatGlDisablei (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");";
 }
 
 void CallLogWrapper::glDisablei (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.disablei(target, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDisablei) << target << index << CallTrace::EndRecord;
+}
+
+static void formatGlDispatchCompute (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint num_groups_x = trace.get<glw::GLuint>();
+	glw::GLuint num_groups_y = trace.get<glw::GLuint>();
+	glw::GLuint num_groups_z = trace.get<glw::GLuint>();
+	str << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");";
 }
 
 void CallLogWrapper::glDispatchCompute (glw::GLuint num_groups_x, glw::GLuint num_groups_y, glw::GLuint num_groups_z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");" << TestLog::EndMessage;
 	m_gl.dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDispatchCompute) << num_groups_x << num_groups_y << num_groups_z << CallTrace::EndRecord;
+}
+
+static void formatGlDispatchComputeIndirect (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLintptr indirect = trace.get<glw::GLintptr>();
+	str << "glDispatchComputeIndirect(" << indirect << ");";
 }
 
 void CallLogWrapper::glDispatchComputeIndirect (glw::GLintptr indirect)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDispatchComputeIndirect(" << indirect << ");" << TestLog::EndMessage;
 	m_gl.dispatchComputeIndirect(indirect);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDispatchComputeIndirect) << indirect << CallTrace::EndRecord;
+}
+
+static void formatGlDrawArrays (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLint first = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	str << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");";
 }
 
 void CallLogWrapper::glDrawArrays (glw::GLenum mode, glw::GLint first, glw::GLsizei count)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");" << TestLog::EndMessage;
 	m_gl.drawArrays(mode, first, count);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawArrays) << mode << first << count << CallTrace::EndRecord;
+}
+
+static void formatGlDrawArraysIndirect (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const void *indirect = trace.get<const void *>();
+	str << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << indirect << ");";
 }
 
 void CallLogWrapper::glDrawArraysIndirect (glw::GLenum mode, const void *indirect)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << indirect << ");" << TestLog::EndMessage;
 	m_gl.drawArraysIndirect(mode, indirect);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawArraysIndirect) << mode << indirect << CallTrace::EndRecord;
+}
+
+static void formatGlDrawArraysInstanced (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLint first = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	str << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");";
 }
 
 void CallLogWrapper::glDrawArraysInstanced (glw::GLenum mode, glw::GLint first, glw::GLsizei count, glw::GLsizei instancecount)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");" << TestLog::EndMessage;
 	m_gl.drawArraysInstanced(mode, first, count, instancecount);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawArraysInstanced) << mode << first << count << instancecount << CallTrace::EndRecord;
+}
+
+static void formatGlDrawArraysInstancedBaseInstance (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLint first = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	glw::GLuint baseinstance = trace.get<glw::GLuint>();
+	str << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");";
 }
 
 void CallLogWrapper::glDrawArraysInstancedBaseInstance (glw::GLenum mode, glw::GLint first, glw::GLsizei count, glw::GLsizei instancecount, glw::GLuint baseinstance)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
 	m_gl.drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawArraysInstancedBaseInstance) << mode << first << count << instancecount << baseinstance << CallTrace::EndRecord;
+}
+
+static void formatGlDrawBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum buf = trace.get<glw::GLenum>();
+	str << "glDrawBuffer(" << toHex(buf) << ");";
 }
 
 void CallLogWrapper::glDrawBuffer (glw::GLenum buf)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawBuffer(" << toHex(buf) << ");" << TestLog::EndMessage;
 	m_gl.drawBuffer(buf);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawBuffer) << buf << CallTrace::EndRecord;
+}
+
+static void formatGlDrawBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLenum> bufsData = trace.getArray<glw::GLenum>();
+	str << "glDrawBuffers(" << n << ", " << getEnumPointerStr(bufsData.arr, bufsData.size, getDrawReadBufferName) << ");";
 }
 
 void CallLogWrapper::glDrawBuffers (glw::GLsizei n, const glw::GLenum *bufs)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawBuffers(" << n << ", " << getEnumPointerStr(bufs, n, getDrawReadBufferName) << ");" << TestLog::EndMessage;
 	m_gl.drawBuffers(n, bufs);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawBuffers) << n << traceArray(bufs, n) << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElements (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	str << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");";
 }
 
 void CallLogWrapper::glDrawElements (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
 	m_gl.drawElements(mode, count, type, indices);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElements) << mode << count << type << indices << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElementsBaseVertex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	glw::GLint basevertex = trace.get<glw::GLint>();
+	str << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");";
 }
 
 void CallLogWrapper::glDrawElementsBaseVertex (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLint basevertex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
 	m_gl.drawElementsBaseVertex(mode, count, type, indices, basevertex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElementsBaseVertex) << mode << count << type << indices << basevertex << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElementsIndirect (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indirect = trace.get<const void *>();
+	str << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << indirect << ");";
 }
 
 void CallLogWrapper::glDrawElementsIndirect (glw::GLenum mode, glw::GLenum type, const void *indirect)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << indirect << ");" << TestLog::EndMessage;
 	m_gl.drawElementsIndirect(mode, type, indirect);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElementsIndirect) << mode << type << indirect << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElementsInstanced (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	str << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ");";
 }
 
 void CallLogWrapper::glDrawElementsInstanced (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ");" << TestLog::EndMessage;
 	m_gl.drawElementsInstanced(mode, count, type, indices, instancecount);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElementsInstanced) << mode << count << type << indices << instancecount << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElementsInstancedBaseInstance (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	glw::GLuint baseinstance = trace.get<glw::GLuint>();
+	str << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << baseinstance << ");";
 }
 
 void CallLogWrapper::glDrawElementsInstancedBaseInstance (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount, glw::GLuint baseinstance)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
 	m_gl.drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElementsInstancedBaseInstance) << mode << count << type << indices << instancecount << baseinstance << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElementsInstancedBaseVertex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	glw::GLint basevertex = trace.get<glw::GLint>();
+	str << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ");";
 }
 
 void CallLogWrapper::glDrawElementsInstancedBaseVertex (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount, glw::GLint basevertex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ");" << TestLog::EndMessage;
 	m_gl.drawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElementsInstancedBaseVertex) << mode << count << type << indices << instancecount << basevertex << CallTrace::EndRecord;
+}
+
+static void formatGlDrawElementsInstancedBaseVertexBaseInstance (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	glw::GLint basevertex = trace.get<glw::GLint>();
+	glw::GLuint baseinstance = trace.get<glw::GLuint>();
+	str << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");";
 }
 
 void CallLogWrapper::glDrawElementsInstancedBaseVertexBaseInstance (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount, glw::GLint basevertex, glw::GLuint baseinstance)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");" << TestLog::EndMessage;
 	m_gl.drawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawElementsInstancedBaseVertexBaseInstance) << mode << count << type << indices << instancecount << basevertex << baseinstance << CallTrace::EndRecord;
+}
+
+static void formatGlDrawRangeElements (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLuint start = trace.get<glw::GLuint>();
+	glw::GLuint end = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	str << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");";
 }
 
 void CallLogWrapper::glDrawRangeElements (glw::GLenum mode, glw::GLuint start, glw::GLuint end, glw::GLsizei count, glw::GLenum type, const void *indices)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
 	m_gl.drawRangeElements(mode, start, end, count, type, indices);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawRangeElements) << mode << start << end << count << type << indices << CallTrace::EndRecord;
+}
+
+static void formatGlDrawRangeElementsBaseVertex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLuint start = trace.get<glw::GLuint>();
+	glw::GLuint end = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indices = trace.get<const void *>();
+	glw::GLint basevertex = trace.get<glw::GLint>();
+	str << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");";
 }
 
 void CallLogWrapper::glDrawRangeElementsBaseVertex (glw::GLenum mode, glw::GLuint start, glw::GLuint end, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLint basevertex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
 	m_gl.drawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawRangeElementsBaseVertex) << mode << start << end << count << type << indices << basevertex << CallTrace::EndRecord;
+}
+
+static void formatGlDrawTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	str << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");";
 }
 
 void CallLogWrapper::glDrawTransformFeedback (glw::GLenum mode, glw::GLuint id)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");" << TestLog::EndMessage;
 	m_gl.drawTransformFeedback(mode, id);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawTransformFeedback) << mode << id << CallTrace::EndRecord;
+}
+
+static void formatGlDrawTransformFeedbackInstanced (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	str << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");";
 }
 
 void CallLogWrapper::glDrawTransformFeedbackInstanced (glw::GLenum mode, glw::GLuint id, glw::GLsizei instancecount)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");" << TestLog::EndMessage;
 	m_gl.drawTransformFeedbackInstanced(mode, id, instancecount);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawTransformFeedbackInstanced) << mode << id << instancecount << CallTrace::EndRecord;
+}
+
+static void formatGlDrawTransformFeedbackStream (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLuint stream = trace.get<glw::GLuint>();
+	str << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");";
 }
 
 void CallLogWrapper::glDrawTransformFeedbackStream (glw::GLenum mode, glw::GLuint id, glw::GLuint stream)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");" << TestLog::EndMessage;
 	m_gl.drawTransformFeedbackStream(mode, id, stream);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawTransformFeedbackStream) << mode << id << stream << CallTrace::EndRecord;
+}
+
+static void formatGlDrawTransformFeedbackStreamInstanced (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLuint stream = trace.get<glw::GLuint>();
+	glw::GLsizei instancecount = trace.get<glw::GLsizei>();
+	str << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");";
 }
 
 void CallLogWrapper::glDrawTransformFeedbackStreamInstanced (glw::GLenum mode, glw::GLuint id, glw::GLuint stream, glw::GLsizei instancecount)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");" << TestLog::EndMessage;
 	m_gl.drawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlDrawTransformFeedbackStreamInstanced) << mode << id << stream << instancecount << CallTrace::EndRecord;
+}
+
+static void formatGlEGLImageTargetRenderbufferStorageOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLeglImageOES image = trace.get<glw::GLeglImageOES>();
+	str << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");";
 }
 
 void CallLogWrapper::glEGLImageTargetRenderbufferStorageOES (glw::GLenum target, glw::GLeglImageOES image)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
 	m_gl.eglImageTargetRenderbufferStorageOES(target, image);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEGLImageTargetRenderbufferStorageOES) << target << image << CallTrace::EndRecord;
+}
+
+static void formatGlEGLImageTargetTexture2DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLeglImageOES image = trace.get<glw::GLeglImageOES>();
+	str << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");";
 }
 
 void CallLogWrapper::glEGLImageTargetTexture2DOES (glw::GLenum target, glw::GLeglImageOES image)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
 	m_gl.eglImageTargetTexture2DOES(target, image);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEGLImageTargetTexture2DOES) << target << image << CallTrace::EndRecord;
+}
+
+static void formatGlEnable (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum cap = trace.get<glw::GLenum>();
+	str << "glEnable(" << getEnableCapStr(cap) << ");";
 }
 
 void CallLogWrapper::glEnable (glw::GLenum cap)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
 	m_gl.enable(cap);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnable) << cap << CallTrace::EndRecord;
+}
+
+static void formatGlEnableClientStateIndexedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum array = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEnableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");";
 }
 
 void CallLogWrapper::glEnableClientStateIndexedEXT (glw::GLenum array, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.enableClientStateIndexedEXT(array, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnableClientStateIndexedEXT) << array << index << CallTrace::EndRecord;
+}
+
+static void formatGlEnableClientStateiEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum array = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEnableClientStateiEXT(" << toHex(array) << ", " << index << ");";
 }
 
 void CallLogWrapper::glEnableClientStateiEXT (glw::GLenum array, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.enableClientStateiEXT(array, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnableClientStateiEXT) << array << index << CallTrace::EndRecord;
+}
+
+static void formatGlEnableIndexedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEnableIndexedEXT(" << toHex(target) << ", " << index << ");";
 }
 
 void CallLogWrapper::glEnableIndexedEXT (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnableIndexedEXT(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.enableIndexedEXT(target, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnableIndexedEXT) << target << index << CallTrace::EndRecord;
+}
+
+static void formatGlEnableVertexArrayAttrib (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");";
 }
 
 void CallLogWrapper::glEnableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.enableVertexArrayAttrib(vaobj, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnableVertexArrayAttrib) << vaobj << index << CallTrace::EndRecord;
+}
+
+static void formatGlEnableVertexArrayEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLenum array = trace.get<glw::GLenum>();
+	str << "glEnableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");";
 }
 
 void CallLogWrapper::glEnableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum array)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
 	m_gl.enableVertexArrayEXT(vaobj, array);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnableVertexArrayEXT) << vaobj << array << CallTrace::EndRecord;
+}
+
+static void formatGlEnableVertexAttribArray (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEnableVertexAttribArray(" << index << ");";
 }
 
 void CallLogWrapper::glEnableVertexAttribArray (glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
 	m_gl.enableVertexAttribArray(index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnableVertexAttribArray) << index << CallTrace::EndRecord;
+}
+
+static void formatGlEnablei (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");";
 }
 
 void CallLogWrapper::glEnablei (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.enablei(target, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEnablei) << target << index << CallTrace::EndRecord;
+}
+
+static void formatGlEndConditionalRender (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glEndConditionalRender(" << ");";
 }
 
 void CallLogWrapper::glEndConditionalRender (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEndConditionalRender(" << ");" << TestLog::EndMessage;
 	m_gl.endConditionalRender();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEndConditionalRender) << CallTrace::EndRecord;
+}
+
+static void formatGlEndQuery (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	str << "glEndQuery(" << getQueryTargetStr(target) << ");";
 }
 
 void CallLogWrapper::glEndQuery (glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEndQuery(" << getQueryTargetStr(target) << ");" << TestLog::EndMessage;
 	m_gl.endQuery(target);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEndQuery) << target << CallTrace::EndRecord;
+}
+
+static void formatGlEndQueryIndexed (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");";
 }
 
 void CallLogWrapper::glEndQueryIndexed (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
 	m_gl.endQueryIndexed(target, index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEndQueryIndexed) << target << index << CallTrace::EndRecord;
+}
+
+static void formatGlEndTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glEndTransformFeedback(" << ");";
 }
 
 void CallLogWrapper::glEndTransformFeedback (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glEndTransformFeedback(" << ");" << TestLog::EndMessage;
 	m_gl.endTransformFeedback();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlEndTransformFeedback) << CallTrace::EndRecord;
+}
+
+static void formatGlFenceSync (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum condition = trace.get<glw::GLenum>();
+	glw::GLbitfield flags = trace.get<glw::GLbitfield>();
+	glw::GLsync returnValue = trace.get<glw::GLsync>();
+	str << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLsync CallLogWrapper::glFenceSync (glw::GLenum condition, glw::GLbitfield flags)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");" << TestLog::EndMessage;
 	glw::GLsync returnValue = m_gl.fenceSync(condition, flags);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFenceSync) << condition << flags << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlFinish (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glFinish(" << ");";
+}
+
 void CallLogWrapper::glFinish (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFinish(" << ");" << TestLog::EndMessage;
 	m_gl.finish();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFinish) << CallTrace::EndRecord;
+}
+
+static void formatGlFlush (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glFlush(" << ");";
 }
 
 void CallLogWrapper::glFlush (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFlush(" << ");" << TestLog::EndMessage;
 	m_gl.flush();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFlush) << CallTrace::EndRecord;
+}
+
+static void formatGlFlushMappedBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr length = trace.get<glw::GLsizeiptr>();
+	str << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");";
 }
 
 void CallLogWrapper::glFlushMappedBufferRange (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr length)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
 	m_gl.flushMappedBufferRange(target, offset, length);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFlushMappedBufferRange) << target << offset << length << CallTrace::EndRecord;
+}
+
+static void formatGlFlushMappedNamedBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr length = trace.get<glw::GLsizeiptr>();
+	str << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");";
 }
 
 void CallLogWrapper::glFlushMappedNamedBufferRange (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr length)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
 	m_gl.flushMappedNamedBufferRange(buffer, offset, length);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFlushMappedNamedBufferRange) << buffer << offset << length << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferDrawBufferEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glFramebufferDrawBufferEXT(" << framebuffer << ", " << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glFramebufferDrawBufferEXT (glw::GLuint framebuffer, glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferDrawBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.framebufferDrawBufferEXT(framebuffer, mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferDrawBufferEXT) << framebuffer << mode << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferDrawBuffersEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const glw::GLenum *bufs = trace.get<const glw::GLenum *>();
+	str << "glFramebufferDrawBuffersEXT(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");";
 }
 
 void CallLogWrapper::glFramebufferDrawBuffersEXT (glw::GLuint framebuffer, glw::GLsizei n, const glw::GLenum *bufs)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferDrawBuffersEXT(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
 	m_gl.framebufferDrawBuffersEXT(framebuffer, n, bufs);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferDrawBuffersEXT) << framebuffer << n << bufs << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glFramebufferParameteri (glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.framebufferParameteri(target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferParameteri) << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferReadBufferEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glFramebufferReadBufferEXT(" << framebuffer << ", " << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glFramebufferReadBufferEXT (glw::GLuint framebuffer, glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferReadBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.framebufferReadBufferEXT(framebuffer, mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferReadBufferEXT) << framebuffer << mode << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferRenderbuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum renderbuffertarget = trace.get<glw::GLenum>();
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	str << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");";
 }
 
 void CallLogWrapper::glFramebufferRenderbuffer (glw::GLenum target, glw::GLenum attachment, glw::GLenum renderbuffertarget, glw::GLuint renderbuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
 	m_gl.framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferRenderbuffer) << target << attachment << renderbuffertarget << renderbuffer << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferTexture (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glFramebufferTexture (glw::GLenum target, glw::GLenum attachment, glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.framebufferTexture(target, attachment, texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferTexture) << target << attachment << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferTexture1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glFramebufferTexture1D (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.framebufferTexture1D(target, attachment, textarget, texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferTexture1D) << target << attachment << textarget << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferTexture2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glFramebufferTexture2D (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.framebufferTexture2D(target, attachment, textarget, texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferTexture2D) << target << attachment << textarget << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferTexture3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	str << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");";
 }
 
 void CallLogWrapper::glFramebufferTexture3D (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level, glw::GLint zoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
 	m_gl.framebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferTexture3D) << target << attachment << textarget << texture << level << zoffset << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferTexture3DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	str << "glFramebufferTexture3DOES(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");";
 }
 
 void CallLogWrapper::glFramebufferTexture3DOES (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level, glw::GLint zoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferTexture3DOES(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
 	m_gl.framebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferTexture3DOES) << target << attachment << textarget << texture << level << zoffset << CallTrace::EndRecord;
+}
+
+static void formatGlFramebufferTextureLayer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint layer = trace.get<glw::GLint>();
+	str << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");";
 }
 
 void CallLogWrapper::glFramebufferTextureLayer (glw::GLenum target, glw::GLenum attachment, glw::GLuint texture, glw::GLint level, glw::GLint layer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
 	m_gl.framebufferTextureLayer(target, attachment, texture, level, layer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFramebufferTextureLayer) << target << attachment << texture << level << layer << CallTrace::EndRecord;
+}
+
+static void formatGlFrontFace (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glFrontFace(" << getWindingStr(mode) << ");";
 }
 
 void CallLogWrapper::glFrontFace (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glFrontFace(" << getWindingStr(mode) << ");" << TestLog::EndMessage;
 	m_gl.frontFace(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlFrontFace) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlGenBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *buffers = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> buffersResult = trace.getArray<glw::GLuint>();
+	str << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
+	str << "\n// buffers = " << getPointerStr(buffersResult.arr, buffersResult.size);
 }
 
 void CallLogWrapper::glGenBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
 	m_gl.genBuffers(n, buffers);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// buffers = " << getPointerStr(buffers, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenBuffers) << n << buffers << traceArray(buffers, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenFramebuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *framebuffers = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> framebuffersResult = trace.getArray<glw::GLuint>();
+	str << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");";
+	str << "\n// framebuffers = " << getPointerStr(framebuffersResult.arr, framebuffersResult.size);
 }
 
 void CallLogWrapper::glGenFramebuffers (glw::GLsizei n, glw::GLuint *framebuffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
 	m_gl.genFramebuffers(n, framebuffers);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// framebuffers = " << getPointerStr(framebuffers, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenFramebuffers) << n << framebuffers << traceArray(framebuffers, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenProgramPipelines (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *pipelines = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> pipelinesResult = trace.getArray<glw::GLuint>();
+	str << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");";
+	str << "\n// pipelines = " << getPointerStr(pipelinesResult.arr, pipelinesResult.size);
 }
 
 void CallLogWrapper::glGenProgramPipelines (glw::GLsizei n, glw::GLuint *pipelines)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
 	m_gl.genProgramPipelines(n, pipelines);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// pipelines = " << getPointerStr(pipelines, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenProgramPipelines) << n << pipelines << traceArray(pipelines, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenQueries (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *ids = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> idsResult = trace.getArray<glw::GLuint>();
+	str << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	str << "\n// ids = " << getPointerStr(idsResult.arr, idsResult.size);
 }
 
 void CallLogWrapper::glGenQueries (glw::GLsizei n, glw::GLuint *ids)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
 	m_gl.genQueries(n, ids);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenQueries) << n << ids << traceArray(ids, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenRenderbuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *renderbuffers = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> renderbuffersResult = trace.getArray<glw::GLuint>();
+	str << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");";
+	str << "\n// renderbuffers = " << getPointerStr(renderbuffersResult.arr, renderbuffersResult.size);
 }
 
 void CallLogWrapper::glGenRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuffers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
 	m_gl.genRenderbuffers(n, renderbuffers);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// renderbuffers = " << getPointerStr(renderbuffers, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenRenderbuffers) << n << renderbuffers << traceArray(renderbuffers, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenSamplers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLuint *samplers = trace.get<glw::GLuint *>();
+	str << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
 }
 
 void CallLogWrapper::glGenSamplers (glw::GLsizei count, glw::GLuint *samplers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
 	m_gl.genSamplers(count, samplers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenSamplers) << count << samplers << CallTrace::EndRecord;
+}
+
+static void formatGlGenTextures (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *textures = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> texturesResult = trace.getArray<glw::GLuint>();
+	str << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+	str << "\n// textures = " << getPointerStr(texturesResult.arr, texturesResult.size);
 }
 
 void CallLogWrapper::glGenTextures (glw::GLsizei n, glw::GLuint *textures)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
 	m_gl.genTextures(n, textures);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// textures = " << getPointerStr(textures, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenTextures) << n << textures << traceArray(textures, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenTransformFeedbacks (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *ids = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> idsResult = trace.getArray<glw::GLuint>();
+	str << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	str << "\n// ids = " << getPointerStr(idsResult.arr, idsResult.size);
 }
 
 void CallLogWrapper::glGenTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
 	m_gl.genTransformFeedbacks(n, ids);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenTransformFeedbacks) << n << ids << traceArray(ids, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenVertexArrays (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	glw::GLuint *arrays = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> arraysResult = trace.getArray<glw::GLuint>();
+	str << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");";
+	str << "\n// arrays = " << getPointerStr(arraysResult.arr, arraysResult.size);
 }
 
 void CallLogWrapper::glGenVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
 	m_gl.genVertexArrays(n, arrays);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// arrays = " << getPointerStr(arrays, n) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenVertexArrays) << n << arrays << traceArray(arrays, n) << CallTrace::EndRecord;
+}
+
+static void formatGlGenerateMipmap (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	str << "glGenerateMipmap(" << getTextureTargetStr(target) << ");";
 }
 
 void CallLogWrapper::glGenerateMipmap (glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenerateMipmap(" << getTextureTargetStr(target) << ");" << TestLog::EndMessage;
 	m_gl.generateMipmap(target);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenerateMipmap) << target << CallTrace::EndRecord;
+}
+
+static void formatGlGenerateMultiTexMipmapEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	str << "glGenerateMultiTexMipmapEXT(" << toHex(texunit) << ", " << toHex(target) << ");";
 }
 
 void CallLogWrapper::glGenerateMultiTexMipmapEXT (glw::GLenum texunit, glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenerateMultiTexMipmapEXT(" << toHex(texunit) << ", " << toHex(target) << ");" << TestLog::EndMessage;
 	m_gl.generateMultiTexMipmapEXT(texunit, target);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenerateMultiTexMipmapEXT) << texunit << target << CallTrace::EndRecord;
+}
+
+static void formatGlGenerateTextureMipmap (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	str << "glGenerateTextureMipmap(" << texture << ");";
 }
 
 void CallLogWrapper::glGenerateTextureMipmap (glw::GLuint texture)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGenerateTextureMipmap(" << texture << ");" << TestLog::EndMessage;
 	m_gl.generateTextureMipmap(texture);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGenerateTextureMipmap) << texture << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveAtomicCounterBufferiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint bufferIndex = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetActiveAtomicCounterBufferiv (glw::GLuint program, glw::GLuint bufferIndex, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveAtomicCounterBufferiv) << program << bufferIndex << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveAttrib (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLint *size = trace.get<glw::GLint *>();
+	glw::GLenum *type = trace.get<glw::GLenum *>();
+	glw::GLchar *name = trace.get<glw::GLchar *>();
+	str << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
 }
 
 void CallLogWrapper::glGetActiveAttrib (glw::GLuint program, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *size, glw::GLenum *type, glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveAttrib(program, index, bufSize, length, size, type, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveAttrib) << program << index << bufSize << length << size << type << name << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveSubroutineName (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei bufsize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *name = trace.get<glw::GLchar *>();
+	str << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
 }
 
 void CallLogWrapper::glGetActiveSubroutineName (glw::GLuint program, glw::GLenum shadertype, glw::GLuint index, glw::GLsizei bufsize, glw::GLsizei *length, glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveSubroutineName) << program << shadertype << index << bufsize << length << name << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveSubroutineUniformName (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei bufsize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *name = trace.get<glw::GLchar *>();
+	str << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
 }
 
 void CallLogWrapper::glGetActiveSubroutineUniformName (glw::GLuint program, glw::GLenum shadertype, glw::GLuint index, glw::GLsizei bufsize, glw::GLsizei *length, glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveSubroutineUniformName) << program << shadertype << index << bufsize << length << name << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveSubroutineUniformiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *values = trace.get<glw::GLint *>();
+	str << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
 }
 
 void CallLogWrapper::glGetActiveSubroutineUniformiv (glw::GLuint program, glw::GLenum shadertype, glw::GLuint index, glw::GLenum pname, glw::GLint *values)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveSubroutineUniformiv) << program << shadertype << index << pname << values << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveUniform (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLint *size = trace.get<glw::GLint *>();
+	glw::GLenum *type = trace.get<glw::GLenum *>();
+	glw::GLchar *name = trace.get<glw::GLchar *>();
+	const tcu::Format::ArrayPointer<glw::GLsizei> lengthResult = trace.getArray<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> sizeResult = trace.getArray<glw::GLint>();
+	const tcu::Format::ArrayPointer<glw::GLenum> typeResult = trace.getArray<glw::GLenum>();
+	const char* nameResult = trace.getString();
+	str << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	str << "\n// length = " << getPointerStr(lengthResult.arr, lengthResult.size);
+	str << "\n// size = " << getPointerStr(sizeResult.arr, sizeResult.size);
+	str << "\n// type = " << getEnumPointerStr(typeResult.arr, typeResult.size, getShaderVarTypeName);
+	str << "\n// name = " << getStringStr(nameResult);
 }
 
 void CallLogWrapper::glGetActiveUniform (glw::GLuint program, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *size, glw::GLenum *type, glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveUniform(program, index, bufSize, length, size, type, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 	{
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
 		m_log << TestLog::Message << "// size = " << getPointerStr(size, 1) << TestLog::EndMessage;
 		m_log << TestLog::Message << "// type = " << getEnumPointerStr(type, 1, getShaderVarTypeName) << TestLog::EndMessage;
 		m_log << TestLog::Message << "// name = " << getStringStr(name) << TestLog::EndMessage;
 	}
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveUniform) << program << index << bufSize << length << size << type << name << traceArray(length, 1) << traceArray(size, 1) << traceArray(type, 1) << traceString(name) << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveUniformBlockName (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint uniformBlockIndex = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *uniformBlockName = trace.get<glw::GLchar *>();
+	str << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");";
 }
 
 void CallLogWrapper::glGetActiveUniformBlockName (glw::GLuint program, glw::GLuint uniformBlockIndex, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *uniformBlockName)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveUniformBlockName) << program << uniformBlockIndex << bufSize << length << uniformBlockName << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveUniformBlockiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint uniformBlockIndex = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetActiveUniformBlockiv (glw::GLuint program, glw::GLuint uniformBlockIndex, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveUniformBlockiv) << program << uniformBlockIndex << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveUniformName (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint uniformIndex = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *uniformName = trace.get<glw::GLchar *>();
+	str << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");";
 }
 
 void CallLogWrapper::glGetActiveUniformName (glw::GLuint program, glw::GLuint uniformIndex, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *uniformName)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveUniformName) << program << uniformIndex << bufSize << length << uniformName << CallTrace::EndRecord;
+}
+
+static void formatGlGetActiveUniformsiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLsizei uniformCount = trace.get<glw::GLsizei>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> uniformIndicesData = trace.getArray<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << getPointerStr(uniformIndicesData.arr, uniformIndicesData.size) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetActiveUniformsiv (glw::GLuint program, glw::GLsizei uniformCount, const glw::GLuint *uniformIndices, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << getPointerStr(uniformIndices, uniformCount) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, uniformCount) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetActiveUniformsiv) << program << uniformCount << pname << params << traceArray(uniformIndices, uniformCount) << traceArray(params, uniformCount) << CallTrace::EndRecord;
+}
+
+static void formatGlGetAttachedShaders (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLsizei maxCount = trace.get<glw::GLsizei>();
+	glw::GLsizei *count = trace.get<glw::GLsizei *>();
+	glw::GLuint *shaders = trace.get<glw::GLuint *>();
+	str << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");";
 }
 
 void CallLogWrapper::glGetAttachedShaders (glw::GLuint program, glw::GLsizei maxCount, glw::GLsizei *count, glw::GLuint *shaders)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");" << TestLog::EndMessage;
 	m_gl.getAttachedShaders(program, maxCount, count, shaders);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetAttachedShaders) << program << maxCount << count << shaders << CallTrace::EndRecord;
+}
+
+static void formatGlGetAttribLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetAttribLocation(" << program << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLint CallLogWrapper::glGetAttribLocation (glw::GLuint program, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetAttribLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getAttribLocation(program, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetAttribLocation) << program << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetBooleanIndexedvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLboolean *data = trace.get<glw::GLboolean *>();
+	str << "glGetBooleanIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+}
+
 void CallLogWrapper::glGetBooleanIndexedvEXT (glw::GLenum target, glw::GLuint index, glw::GLboolean *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBooleanIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getBooleanIndexedvEXT(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBooleanIndexedvEXT) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetBooleani_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLboolean *data = trace.get<glw::GLboolean *>();
+	const tcu::Format::ArrayPointer<glw::GLboolean> dataResult = trace.getArray<glw::GLboolean>();
+	str << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getBooleanPointerStr(dataResult.arr, dataResult.size);
 }
 
 void CallLogWrapper::glGetBooleani_v (glw::GLenum target, glw::GLuint index, glw::GLboolean *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getBooleani_v(target, index, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBooleani_v) << target << index << data << traceArray(data, getIndexedQueryNumArgsOut(target)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetBooleanv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLboolean *data = trace.get<glw::GLboolean *>();
+	const tcu::Format::ArrayPointer<glw::GLboolean> dataResult = trace.getArray<glw::GLboolean>();
+	str << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getBooleanPointerStr(dataResult.arr, dataResult.size);
 }
 
 void CallLogWrapper::glGetBooleanv (glw::GLenum pname, glw::GLboolean *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getBooleanv(pname, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBooleanv) << pname << data << traceArray(data, getBasicQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetBufferParameteri64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint64 *params = trace.get<glw::GLint64 *>();
+	str << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetBufferParameteri64v (glw::GLenum target, glw::GLenum pname, glw::GLint64 *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getBufferParameteri64v(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBufferParameteri64v) << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetBufferParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetBufferParameteriv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getBufferParameteriv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBufferParameteriv) << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetBufferPointerv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void **params = trace.get<void **>();
+	str << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetBufferPointerv (glw::GLenum target, glw::GLenum pname, void **params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getBufferPointerv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBufferPointerv) << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	void *data = trace.get<void *>();
+	str << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << data << ");";
 }
 
 void CallLogWrapper::glGetBufferSubData (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr size, void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.getBufferSubData(target, offset, size, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetBufferSubData) << target << offset << size << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetCompressedMultiTexImageEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint lod = trace.get<glw::GLint>();
+	void *img = trace.get<void *>();
+	str << "glGetCompressedMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << lod << ", " << img << ");";
 }
 
 void CallLogWrapper::glGetCompressedMultiTexImageEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint lod, void *img)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetCompressedMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << lod << ", " << img << ");" << TestLog::EndMessage;
 	m_gl.getCompressedMultiTexImageEXT(texunit, target, lod, img);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetCompressedMultiTexImageEXT) << texunit << target << lod << img << CallTrace::EndRecord;
+}
+
+static void formatGlGetCompressedTexImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	void *img = trace.get<void *>();
+	str << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << img << ");";
 }
 
 void CallLogWrapper::glGetCompressedTexImage (glw::GLenum target, glw::GLint level, void *img)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << img << ");" << TestLog::EndMessage;
 	m_gl.getCompressedTexImage(target, level, img);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetCompressedTexImage) << target << level << img << CallTrace::EndRecord;
+}
+
+static void formatGlGetCompressedTextureImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *pixels = trace.get<void *>();
+	str << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetCompressedTextureImage (glw::GLuint texture, glw::GLint level, glw::GLsizei bufSize, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getCompressedTextureImage(texture, level, bufSize, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetCompressedTextureImage) << texture << level << bufSize << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetCompressedTextureSubImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *pixels = trace.get<void *>();
+	str << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetCompressedTextureSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLsizei bufSize, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetCompressedTextureSubImage) << texture << level << xoffset << yoffset << zoffset << width << height << depth << bufSize << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetDebugMessageLog (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint count = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLenum *sources = trace.get<glw::GLenum *>();
+	glw::GLenum *types = trace.get<glw::GLenum *>();
+	glw::GLuint *ids = trace.get<glw::GLuint *>();
+	glw::GLenum *severities = trace.get<glw::GLenum *>();
+	glw::GLsizei *lengths = trace.get<glw::GLsizei *>();
+	glw::GLchar *messageLog = trace.get<glw::GLchar *>();
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	str << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLuint CallLogWrapper::glGetDebugMessageLog (glw::GLuint count, glw::GLsizei bufSize, glw::GLenum *sources, glw::GLenum *types, glw::GLuint *ids, glw::GLenum *severities, glw::GLsizei *lengths, glw::GLchar *messageLog)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.getDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetDebugMessageLog) << count << bufSize << sources << types << ids << severities << lengths << messageLog << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetDoubleIndexedvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble *data = trace.get<glw::GLdouble *>();
+	str << "glGetDoubleIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+}
+
 void CallLogWrapper::glGetDoubleIndexedvEXT (glw::GLenum target, glw::GLuint index, glw::GLdouble *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetDoubleIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getDoubleIndexedvEXT(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetDoubleIndexedvEXT) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetDoublei_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble *data = trace.get<glw::GLdouble *>();
+	str << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
 }
 
 void CallLogWrapper::glGetDoublei_v (glw::GLenum target, glw::GLuint index, glw::GLdouble *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getDoublei_v(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetDoublei_v) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetDoublev (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLdouble *data = trace.get<glw::GLdouble *>();
+	str << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
 }
 
 void CallLogWrapper::glGetDoublev (glw::GLenum pname, glw::GLdouble *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getDoublev(pname, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetDoublev) << pname << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetError (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum returnValue = trace.get<glw::GLenum>();
+	str << "glGetError(" << ");";
+	str << "\n// " << getErrorStr(returnValue) << " returned";
 }
 
 glw::GLenum CallLogWrapper::glGetError (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetError(" << ");" << TestLog::EndMessage;
 	glw::GLenum returnValue = m_gl.getError();
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getErrorStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetError) << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
-void CallLogWrapper::glGetFloatIndexedvEXT (glw::GLenum target, glw::GLuint index, glw::GLfloat *data)
+static void formatGlGetFloatIndexedvEXT (std::ostream& str, CallTraceReader& trace)
 {
-	if (m_enableLog)
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat *data = trace.get<glw::GLfloat *>();
+	str << "glGetFloatIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+}
+
+void CallLogWrapper::glGetFloatIndexedvEXT (glw::GLenum target, glw::GLuint index, glw::GLfloat *data)
+{
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFloatIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getFloatIndexedvEXT(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFloatIndexedvEXT) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetFloati_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat *data = trace.get<glw::GLfloat *>();
+	str << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
 }
 
 void CallLogWrapper::glGetFloati_v (glw::GLenum target, glw::GLuint index, glw::GLfloat *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getFloati_v(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFloati_v) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetFloatv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *data = trace.get<glw::GLfloat *>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> dataResult = trace.getArray<glw::GLfloat>();
+	str << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getPointerStr(dataResult.arr, dataResult.size);
 }
 
 void CallLogWrapper::glGetFloatv (glw::GLenum pname, glw::GLfloat *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getFloatv(pname, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFloatv) << pname << data << traceArray(data, getBasicQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetFragDataIndex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetFragDataIndex(" << program << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLint CallLogWrapper::glGetFragDataIndex (glw::GLuint program, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFragDataIndex(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getFragDataIndex(program, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFragDataIndex) << program << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetFragDataLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetFragDataLocation(" << program << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 glw::GLint CallLogWrapper::glGetFragDataLocation (glw::GLuint program, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFragDataLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getFragDataLocation(program, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFragDataLocation) << program << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetFramebufferAttachmentParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const char* paramsResult = trace.getString();
+	str << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << paramsResult;
+}
+
 void CallLogWrapper::glGetFramebufferAttachmentParameteriv (glw::GLenum target, glw::GLenum attachment, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getFramebufferAttachmentParameteriv(target, attachment, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getFramebufferAttachmentParameterValueStr(pname, params) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFramebufferAttachmentParameteriv) << target << attachment << pname << params << traceText(getFramebufferAttachmentParameterValueStr(pname, params)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetFramebufferParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetFramebufferParameteriv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getFramebufferParameteriv(target, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetFramebufferParameteriv) << target << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetGraphicsResetStatus (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum returnValue = trace.get<glw::GLenum>();
+	str << "glGetGraphicsResetStatus(" << ");";
+	str << "\n// " << toHex(returnValue) << " returned";
 }
 
 glw::GLenum CallLogWrapper::glGetGraphicsResetStatus (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetGraphicsResetStatus(" << ");" << TestLog::EndMessage;
 	glw::GLenum returnValue = m_gl.getGraphicsResetStatus();
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetGraphicsResetStatus) << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetInteger64i_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint64 *data = trace.get<glw::GLint64 *>();
+	const tcu::Format::ArrayPointer<glw::GLint64> dataResult = trace.getArray<glw::GLint64>();
+	str << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getPointerStr(dataResult.arr, dataResult.size);
+}
+
 void CallLogWrapper::glGetInteger64i_v (glw::GLenum target, glw::GLuint index, glw::GLint64 *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getInteger64i_v(target, index, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetInteger64i_v) << target << index << data << traceArray(data, getIndexedQueryNumArgsOut(target)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetInteger64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint64 *data = trace.get<glw::GLint64 *>();
+	const tcu::Format::ArrayPointer<glw::GLint64> dataResult = trace.getArray<glw::GLint64>();
+	str << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getPointerStr(dataResult.arr, dataResult.size);
 }
 
 void CallLogWrapper::glGetInteger64v (glw::GLenum pname, glw::GLint64 *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getInteger64v(pname, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetInteger64v) << pname << data << traceArray(data, getBasicQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetIntegerIndexedvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint *data = trace.get<glw::GLint *>();
+	str << "glGetIntegerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
 }
 
 void CallLogWrapper::glGetIntegerIndexedvEXT (glw::GLenum target, glw::GLuint index, glw::GLint *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetIntegerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getIntegerIndexedvEXT(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetIntegerIndexedvEXT) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetIntegeri_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint *data = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> dataResult = trace.getArray<glw::GLint>();
+	str << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getPointerStr(dataResult.arr, dataResult.size);
 }
 
 void CallLogWrapper::glGetIntegeri_v (glw::GLenum target, glw::GLuint index, glw::GLint *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getIntegeri_v(target, index, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetIntegeri_v) << target << index << data << traceArray(data, getIndexedQueryNumArgsOut(target)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetIntegerv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *data = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> dataResult = trace.getArray<glw::GLint>();
+	str << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	str << "\n// data = " << getPointerStr(dataResult.arr, dataResult.size);
 }
 
 void CallLogWrapper::glGetIntegerv (glw::GLenum pname, glw::GLint *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getIntegerv(pname, data);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetIntegerv) << pname << data << traceArray(data, getBasicQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetInternalformatSampleivNV (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetInternalformatSampleivNV(" << toHex(target) << ", " << toHex(internalformat) << ", " << samples << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetInternalformatSampleivNV (glw::GLenum target, glw::GLenum internalformat, glw::GLsizei samples, glw::GLenum pname, glw::GLsizei bufSize, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetInternalformatSampleivNV(" << toHex(target) << ", " << toHex(internalformat) << ", " << samples << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getInternalformatSampleivNV(target, internalformat, samples, pname, bufSize, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetInternalformatSampleivNV) << target << internalformat << samples << pname << bufSize << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetInternalformati64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLint64 *params = trace.get<glw::GLint64 *>();
+	str << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetInternalformati64v (glw::GLenum target, glw::GLenum internalformat, glw::GLenum pname, glw::GLsizei bufSize, glw::GLint64 *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getInternalformati64v(target, internalformat, pname, bufSize, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetInternalformati64v) << target << internalformat << pname << bufSize << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetInternalformativ (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetInternalformativ (glw::GLenum target, glw::GLenum internalformat, glw::GLenum pname, glw::GLsizei bufSize, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getInternalformativ(target, internalformat, pname, bufSize, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, bufSize) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetInternalformativ) << target << internalformat << pname << bufSize << params << traceArray(params, bufSize) << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexEnvfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexEnvfvEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexEnvfvEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexEnvivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexEnvivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexEnvivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexGendvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLdouble *params = trace.get<glw::GLdouble *>();
+	str << "glGetMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexGendvEXT(texunit, coord, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexGendvEXT) << texunit << coord << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexGenfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexGenfvEXT(texunit, coord, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexGenfvEXT) << texunit << coord << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexGenivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexGenivEXT(texunit, coord, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexGenivEXT) << texunit << coord << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexImageEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	void *pixels = trace.get<void *>();
+	str << "glGetMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetMultiTexImageEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum format, glw::GLenum type, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexImageEXT(texunit, target, level, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexImageEXT) << texunit << target << level << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexLevelParameterfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetMultiTexLevelParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexLevelParameterfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexLevelParameterfvEXT(texunit, target, level, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexLevelParameterfvEXT) << texunit << target << level << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexLevelParameterivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetMultiTexLevelParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexLevelParameterivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexLevelParameterivEXT(texunit, target, level, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexLevelParameterivEXT) << texunit << target << level << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexParameterIivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexParameterIivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexParameterIivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexParameterIuivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	str << "glGetMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexParameterIuivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexParameterIuivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexParameterfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexParameterfvEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexParameterfvEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultiTexParameterivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetMultiTexParameterivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getMultiTexParameterivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultiTexParameterivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetMultisamplefv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat *val = trace.get<glw::GLfloat *>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valResult = trace.getArray<glw::GLfloat>();
+	str << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");";
+	str << "\n// val = " << getPointerStr(valResult.arr, valResult.size);
 }
 
 void CallLogWrapper::glGetMultisamplefv (glw::GLenum pname, glw::GLuint index, glw::GLfloat *val)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");" << TestLog::EndMessage;
 	m_gl.getMultisamplefv(pname, index, val);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// val = " << getPointerStr(val, 2) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetMultisamplefv) << pname << index << val << traceArray(val, 2) << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedBufferParameteri64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint64 *params = trace.get<glw::GLint64 *>();
+	str << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedBufferParameteri64v (glw::GLuint buffer, glw::GLenum pname, glw::GLint64 *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedBufferParameteri64v(buffer, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedBufferParameteri64v) << buffer << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedBufferParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedBufferParameteriv (glw::GLuint buffer, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedBufferParameteriv(buffer, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedBufferParameteriv) << buffer << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedBufferPointerv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void **params = trace.get<void **>();
+	str << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedBufferPointerv (glw::GLuint buffer, glw::GLenum pname, void **params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedBufferPointerv(buffer, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedBufferPointerv) << buffer << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	void *data = trace.get<void *>();
+	str << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");";
 }
 
 void CallLogWrapper::glGetNamedBufferSubData (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.getNamedBufferSubData(buffer, offset, size, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedBufferSubData) << buffer << offset << size << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedFramebufferAttachmentParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedFramebufferAttachmentParameteriv (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedFramebufferAttachmentParameteriv) << framebuffer << attachment << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedFramebufferParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetNamedFramebufferParameteriv (glw::GLuint framebuffer, glw::GLenum pname, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedFramebufferParameteriv(framebuffer, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedFramebufferParameteriv) << framebuffer << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedProgramLocalParameterIivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetNamedProgramLocalParameterIivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterIivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedProgramLocalParameterIivEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedProgramLocalParameterIivEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedProgramLocalParameterIuivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	str << "glGetNamedProgramLocalParameterIuivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterIuivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIuivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedProgramLocalParameterIuivEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedProgramLocalParameterIuivEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedProgramLocalParameterdvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble *params = trace.get<glw::GLdouble *>();
+	str << "glGetNamedProgramLocalParameterdvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterdvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterdvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedProgramLocalParameterdvEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedProgramLocalParameterdvEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedProgramLocalParameterfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetNamedProgramLocalParameterfvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterfvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterfvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedProgramLocalParameterfvEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedProgramLocalParameterfvEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedProgramStringEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void *string = trace.get<void *>();
+	str << "glGetNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << string << ");";
 }
 
 void CallLogWrapper::glGetNamedProgramStringEXT (glw::GLuint program, glw::GLenum target, glw::GLenum pname, void *string)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << string << ");" << TestLog::EndMessage;
 	m_gl.getNamedProgramStringEXT(program, target, pname, string);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedProgramStringEXT) << program << target << pname << string << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedProgramivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetNamedProgramivEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedProgramivEXT (glw::GLuint program, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedProgramivEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedProgramivEXT(program, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedProgramivEXT) << program << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetNamedRenderbufferParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetNamedRenderbufferParameteriv (glw::GLuint renderbuffer, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetNamedRenderbufferParameteriv) << renderbuffer << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetObjectLabel (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum identifier = trace.get<glw::GLenum>();
+	glw::GLuint name = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *label = trace.get<glw::GLchar *>();
+	str << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");";
 }
 
 void CallLogWrapper::glGetObjectLabel (glw::GLenum identifier, glw::GLuint name, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *label)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
 	m_gl.getObjectLabel(identifier, name, bufSize, length, label);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetObjectLabel) << identifier << name << bufSize << length << label << CallTrace::EndRecord;
+}
+
+static void formatGlGetObjectPtrLabel (std::ostream& str, CallTraceReader& trace)
+{
+	const void *ptr = trace.get<const void *>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *label = trace.get<glw::GLchar *>();
+	str << "glGetObjectPtrLabel(" << ptr << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");";
 }
 
 void CallLogWrapper::glGetObjectPtrLabel (const void *ptr, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *label)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetObjectPtrLabel(" << ptr << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
 	m_gl.getObjectPtrLabel(ptr, bufSize, length, label);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetObjectPtrLabel) << ptr << bufSize << length << label << CallTrace::EndRecord;
+}
+
+static void formatGlGetPointerIndexedvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	void **data = trace.get<void **>();
+	str << "glGetPointerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
 }
 
 void CallLogWrapper::glGetPointerIndexedvEXT (glw::GLenum target, glw::GLuint index, void **data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetPointerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
 	m_gl.getPointerIndexedvEXT(target, index, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetPointerIndexedvEXT) << target << index << data << CallTrace::EndRecord;
+}
+
+static void formatGlGetPointeri_vEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	void **params = trace.get<void **>();
+	str << "glGetPointeri_vEXT(" << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetPointeri_vEXT (glw::GLenum pname, glw::GLuint index, void **params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetPointeri_vEXT(" << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getPointeri_vEXT(pname, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetPointeri_vEXT) << pname << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetPointerv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void **params = trace.get<void **>();
+	const tcu::Format::ArrayPointer<void *> paramsResult = trace.getArray<void *>();
+	str << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetPointerv (glw::GLenum pname, void **params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getPointerv(pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetPointerv) << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramBinary (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLenum *binaryFormat = trace.get<glw::GLenum *>();
+	void *binary = trace.get<void *>();
+	str << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << binary << ");";
 }
 
 void CallLogWrapper::glGetProgramBinary (glw::GLuint program, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLenum *binaryFormat, void *binary)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << binary << ");" << TestLog::EndMessage;
 	m_gl.getProgramBinary(program, bufSize, length, binaryFormat, binary);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramBinary) << program << bufSize << length << binaryFormat << binary << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramInfoLog (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *infoLog = trace.get<glw::GLchar *>();
+	const tcu::Format::ArrayPointer<glw::GLsizei> lengthResult = trace.getArray<glw::GLsizei>();
+	str << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");";
+	str << "\n// length = " << getPointerStr(lengthResult.arr, lengthResult.size);
 }
 
 void CallLogWrapper::glGetProgramInfoLog (glw::GLuint program, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *infoLog)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramInfoLog(program, bufSize, length, infoLog);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramInfoLog) << program << bufSize << length << infoLog << traceArray(length, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramInterfaceiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum programInterface = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetProgramInterfaceiv (glw::GLuint program, glw::GLenum programInterface, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramInterfaceiv(program, programInterface, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramInterfaceiv) << program << programInterface << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramPipelineInfoLog (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *infoLog = trace.get<glw::GLchar *>();
+	const tcu::Format::ArrayPointer<glw::GLsizei> lengthResult = trace.getArray<glw::GLsizei>();
+	str << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");";
+	str << "\n// length = " << getPointerStr(lengthResult.arr, lengthResult.size);
 }
 
 void CallLogWrapper::glGetProgramPipelineInfoLog (glw::GLuint pipeline, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *infoLog)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramPipelineInfoLog) << pipeline << bufSize << length << infoLog << traceArray(length, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramPipelineiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetProgramPipelineiv (glw::GLuint pipeline, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramPipelineiv(pipeline, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramPipelineiv) << pipeline << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramResourceIndex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum programInterface = trace.get<glw::GLenum>();
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	const char* nameData = trace.getString();
+	str << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLuint CallLogWrapper::glGetProgramResourceIndex (glw::GLuint program, glw::GLenum programInterface, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.getProgramResourceIndex(program, programInterface, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramResourceIndex) << program << programInterface << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetProgramResourceLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum programInterface = trace.get<glw::GLenum>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 glw::GLint CallLogWrapper::glGetProgramResourceLocation (glw::GLuint program, glw::GLenum programInterface, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getProgramResourceLocation(program, programInterface, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramResourceLocation) << program << programInterface << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetProgramResourceLocationIndex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum programInterface = trace.get<glw::GLenum>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 glw::GLint CallLogWrapper::glGetProgramResourceLocationIndex (glw::GLuint program, glw::GLenum programInterface, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getProgramResourceLocationIndex(program, programInterface, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramResourceLocationIndex) << program << programInterface << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetProgramResourceName (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum programInterface = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *name = trace.get<glw::GLchar *>();
+	str << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+}
+
 void CallLogWrapper::glGetProgramResourceName (glw::GLuint program, glw::GLenum programInterface, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramResourceName(program, programInterface, index, bufSize, length, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramResourceName) << program << programInterface << index << bufSize << length << name << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramResourceiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum programInterface = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei propCount = trace.get<glw::GLsizei>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLenum> propsData = trace.getArray<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLsizei> lengthResult = trace.getArray<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << getEnumPointerStr(propsData.arr, propsData.size, getProgramResourcePropertyName) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// length = " << getPointerStr(lengthResult.arr, lengthResult.size);
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetProgramResourceiv (glw::GLuint program, glw::GLenum programInterface, glw::GLuint index, glw::GLsizei propCount, const glw::GLenum *props, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << getEnumPointerStr(props, propCount, getProgramResourcePropertyName) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 	{
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, ((length == DE_NULL) ? (bufSize) : ((bufSize < *length) ? (bufSize) : (*length)))) << TestLog::EndMessage;
 	}
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramResourceiv) << program << programInterface << index << propCount << bufSize << length << params << traceArray(props, propCount) << traceArray(length, 1) << traceArray(params, ((length == DE_NULL) ? (bufSize) : ((bufSize < *length) ? (bufSize) : (*length)))) << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramStageiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *values = trace.get<glw::GLint *>();
+	str << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
 }
 
 void CallLogWrapper::glGetProgramStageiv (glw::GLuint program, glw::GLenum shadertype, glw::GLenum pname, glw::GLint *values)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramStageiv(program, shadertype, pname, values);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramStageiv) << program << shadertype << pname << values << CallTrace::EndRecord;
+}
+
+static void formatGlGetProgramiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetProgramiv (glw::GLuint program, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getProgramiv(program, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getProgramQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetProgramiv) << program << pname << params << traceArray(params, getProgramQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryBufferObjecti64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
 }
 
 void CallLogWrapper::glGetQueryBufferObjecti64v (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.getQueryBufferObjecti64v(id, buffer, pname, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryBufferObjecti64v) << id << buffer << pname << offset << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryBufferObjectiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
 }
 
 void CallLogWrapper::glGetQueryBufferObjectiv (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.getQueryBufferObjectiv(id, buffer, pname, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryBufferObjectiv) << id << buffer << pname << offset << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryBufferObjectui64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
 }
 
 void CallLogWrapper::glGetQueryBufferObjectui64v (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.getQueryBufferObjectui64v(id, buffer, pname, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryBufferObjectui64v) << id << buffer << pname << offset << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryBufferObjectuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
 }
 
 void CallLogWrapper::glGetQueryBufferObjectuiv (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.getQueryBufferObjectuiv(id, buffer, pname, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryBufferObjectuiv) << id << buffer << pname << offset << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryIndexediv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetQueryIndexediv (glw::GLenum target, glw::GLuint index, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getQueryIndexediv(target, index, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryIndexediv) << target << index << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryObjecti64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint64 *params = trace.get<glw::GLint64 *>();
+	const tcu::Format::ArrayPointer<glw::GLint64> paramsResult = trace.getArray<glw::GLint64>();
+	str << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetQueryObjecti64v (glw::GLuint id, glw::GLenum pname, glw::GLint64 *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getQueryObjecti64v(id, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryObjecti64v) << id << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryObjectiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetQueryObjectiv (glw::GLuint id, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getQueryObjectiv(id, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryObjectiv) << id << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryObjectui64v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint64 *params = trace.get<glw::GLuint64 *>();
+	const tcu::Format::ArrayPointer<glw::GLuint64> paramsResult = trace.getArray<glw::GLuint64>();
+	str << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetQueryObjectui64v (glw::GLuint id, glw::GLenum pname, glw::GLuint64 *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getQueryObjectui64v(id, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryObjectui64v) << id << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryObjectuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> paramsResult = trace.getArray<glw::GLuint>();
+	str << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetQueryObjectuiv (glw::GLuint id, glw::GLenum pname, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getQueryObjectuiv(id, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryObjectuiv) << id << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetQueryiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetQueryiv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getQueryiv(target, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetQueryiv) << target << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetRenderbufferParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetRenderbufferParameteriv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getRenderbufferParameteriv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetRenderbufferParameteriv) << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetSamplerParameterIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getSamplerParameterIiv(sampler, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSamplerParameterIiv) << sampler << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetSamplerParameterIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> paramsResult = trace.getArray<glw::GLuint>();
+	str << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum pname, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getSamplerParameterIuiv(sampler, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSamplerParameterIuiv) << sampler << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetSamplerParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> paramsResult = trace.getArray<glw::GLfloat>();
+	str << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetSamplerParameterfv (glw::GLuint sampler, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getSamplerParameterfv(sampler, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSamplerParameterfv) << sampler << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetSamplerParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetSamplerParameteriv (glw::GLuint sampler, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getSamplerParameteriv(sampler, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSamplerParameteriv) << sampler << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetShaderInfoLog (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *infoLog = trace.get<glw::GLchar *>();
+	const tcu::Format::ArrayPointer<glw::GLsizei> lengthResult = trace.getArray<glw::GLsizei>();
+	str << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");";
+	str << "\n// length = " << getPointerStr(lengthResult.arr, lengthResult.size);
 }
 
 void CallLogWrapper::glGetShaderInfoLog (glw::GLuint shader, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *infoLog)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
 	m_gl.getShaderInfoLog(shader, bufSize, length, infoLog);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetShaderInfoLog) << shader << bufSize << length << infoLog << traceArray(length, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetShaderPrecisionFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLenum precisiontype = trace.get<glw::GLenum>();
+	glw::GLint *range = trace.get<glw::GLint *>();
+	glw::GLint *precision = trace.get<glw::GLint *>();
+	str << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");";
 }
 
 void CallLogWrapper::glGetShaderPrecisionFormat (glw::GLenum shadertype, glw::GLenum precisiontype, glw::GLint *range, glw::GLint *precision)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");" << TestLog::EndMessage;
 	m_gl.getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetShaderPrecisionFormat) << shadertype << precisiontype << range << precision << CallTrace::EndRecord;
+}
+
+static void formatGlGetShaderSource (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLchar *source = trace.get<glw::GLchar *>();
+	str << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");";
 }
 
 void CallLogWrapper::glGetShaderSource (glw::GLuint shader, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *source)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");" << TestLog::EndMessage;
 	m_gl.getShaderSource(shader, bufSize, length, source);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetShaderSource) << shader << bufSize << length << source << CallTrace::EndRecord;
+}
+
+static void formatGlGetShaderiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetShaderiv (glw::GLuint shader, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getShaderiv(shader, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetShaderiv) << shader << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetString (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum name = trace.get<glw::GLenum>();
+	const char* returnValueData = trace.getString();
+	str << "glGetString(" << getGettableStringStr(name) << ");";
+	str << "\n// " << getStringStr(returnValueData) << " returned";
 }
 
 const glw::GLubyte * CallLogWrapper::glGetString (glw::GLenum name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetString(" << getGettableStringStr(name) << ");" << TestLog::EndMessage;
 	const glw::GLubyte * returnValue = m_gl.getString(name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetString) << name << traceString(returnValue) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetStringi (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum name = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const char* returnValueData = trace.getString();
+	str << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");";
+	str << "\n// " << getStringStr(returnValueData) << " returned";
+}
+
 const glw::GLubyte * CallLogWrapper::glGetStringi (glw::GLenum name, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");" << TestLog::EndMessage;
 	const glw::GLubyte * returnValue = m_gl.getStringi(name, index);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetStringi) << name << index << traceString(returnValue) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetSubroutineIndex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	const char* nameData = trace.getString();
+	str << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 glw::GLuint CallLogWrapper::glGetSubroutineIndex (glw::GLuint program, glw::GLenum shadertype, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.getSubroutineIndex(program, shadertype, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSubroutineIndex) << program << shadertype << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetSubroutineUniformLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 glw::GLint CallLogWrapper::glGetSubroutineUniformLocation (glw::GLuint program, glw::GLenum shadertype, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getSubroutineUniformLocation(program, shadertype, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSubroutineUniformLocation) << program << shadertype << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetSynciv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsync sync = trace.get<glw::GLsync>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLint *values = trace.get<glw::GLint *>();
+	str << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
+}
+
 void CallLogWrapper::glGetSynciv (glw::GLsync sync, glw::GLenum pname, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *values)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
 	m_gl.getSynciv(sync, pname, bufSize, length, values);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetSynciv) << sync << pname << bufSize << length << values << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	void *pixels = trace.get<void *>();
+	str << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetTexImage (glw::GLenum target, glw::GLint level, glw::GLenum format, glw::GLenum type, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getTexImage(target, level, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexImage) << target << level << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexLevelParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> paramsResult = trace.getArray<glw::GLfloat>();
+	str << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetTexLevelParameterfv (glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTexLevelParameterfv(target, level, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexLevelParameterfv) << target << level << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexLevelParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetTexLevelParameteriv (glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTexLevelParameteriv(target, level, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexLevelParameteriv) << target << level << pname << params << traceArray(params, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexParameterIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetTexParameterIiv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTexParameterIiv(target, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexParameterIiv) << target << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexParameterIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> paramsResult = trace.getArray<glw::GLuint>();
+	str << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetTexParameterIuiv (glw::GLenum target, glw::GLenum pname, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTexParameterIuiv(target, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexParameterIuiv) << target << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> paramsResult = trace.getArray<glw::GLfloat>();
+	str << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetTexParameterfv (glw::GLenum target, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTexParameterfv(target, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexParameterfv) << target << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetTexParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetTexParameteriv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTexParameteriv(target, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTexParameteriv) << target << pname << params << traceArray(params, getTextureParamQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *pixels = trace.get<void *>();
+	str << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetTextureImage (glw::GLuint texture, glw::GLint level, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getTextureImage(texture, level, format, type, bufSize, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureImage) << texture << level << format << type << bufSize << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureLevelParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetTextureLevelParameterfv (glw::GLuint texture, glw::GLint level, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTextureLevelParameterfv(texture, level, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureLevelParameterfv) << texture << level << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureLevelParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetTextureLevelParameteriv (glw::GLuint texture, glw::GLint level, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTextureLevelParameteriv(texture, level, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureLevelParameteriv) << texture << level << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureParameterIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetTextureParameterIiv (glw::GLuint texture, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTextureParameterIiv(texture, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureParameterIiv) << texture << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureParameterIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	str << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetTextureParameterIuiv (glw::GLuint texture, glw::GLenum pname, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTextureParameterIuiv(texture, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureParameterIuiv) << texture << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetTextureParameterfv (glw::GLuint texture, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTextureParameterfv(texture, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureParameterfv) << texture << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetTextureParameteriv (glw::GLuint texture, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getTextureParameteriv(texture, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureParameteriv) << texture << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetTextureSubImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *pixels = trace.get<void *>();
+	str << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetTextureSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTextureSubImage) << texture << level << xoffset << yoffset << zoffset << width << height << depth << format << type << bufSize << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetTransformFeedbackVarying (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLsizei *length = trace.get<glw::GLsizei *>();
+	glw::GLsizei *size = trace.get<glw::GLsizei *>();
+	glw::GLenum *type = trace.get<glw::GLenum *>();
+	glw::GLchar *name = trace.get<glw::GLchar *>();
+	str << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
 }
 
 void CallLogWrapper::glGetTransformFeedbackVarying (glw::GLuint program, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLsizei *size, glw::GLenum *type, glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
 	m_gl.getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTransformFeedbackVarying) << program << index << bufSize << length << size << type << name << CallTrace::EndRecord;
+}
+
+static void formatGlGetTransformFeedbacki64_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint xfb = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint64 *param = trace.get<glw::GLint64 *>();
+	str << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetTransformFeedbacki64_v (glw::GLuint xfb, glw::GLenum pname, glw::GLuint index, glw::GLint64 *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getTransformFeedbacki64_v(xfb, pname, index, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTransformFeedbacki64_v) << xfb << pname << index << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetTransformFeedbacki_v (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint xfb = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetTransformFeedbacki_v (glw::GLuint xfb, glw::GLenum pname, glw::GLuint index, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getTransformFeedbacki_v(xfb, pname, index, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTransformFeedbacki_v) << xfb << pname << index << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetTransformFeedbackiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint xfb = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetTransformFeedbackiv (glw::GLuint xfb, glw::GLenum pname, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getTransformFeedbackiv(xfb, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetTransformFeedbackiv) << xfb << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetUniformBlockIndex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint returnValue = trace.get<glw::GLuint>();
+	const char* uniformBlockNameData = trace.getString();
+	str << "glGetUniformBlockIndex(" << program << ", " << getStringStr(uniformBlockNameData) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLuint CallLogWrapper::glGetUniformBlockIndex (glw::GLuint program, const glw::GLchar *uniformBlockName)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformBlockIndex(" << program << ", " << getStringStr(uniformBlockName) << ");" << TestLog::EndMessage;
 	glw::GLuint returnValue = m_gl.getUniformBlockIndex(program, uniformBlockName);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformBlockIndex) << program << returnValue << traceString(uniformBlockName) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetUniformIndices (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLsizei uniformCount = trace.get<glw::GLsizei>();
+	glw::GLuint *uniformIndices = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLchar *const> uniformNamesData = trace.getArray<glw::GLchar *const>();
+	const tcu::Format::ArrayPointer<glw::GLuint> uniformIndicesResult = trace.getArray<glw::GLuint>();
+	str << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << getPointerStr(uniformNamesData.arr, uniformNamesData.size) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");";
+	str << "\n// uniformIndices = " << getPointerStr(uniformIndicesResult.arr, uniformIndicesResult.size);
+}
+
 void CallLogWrapper::glGetUniformIndices (glw::GLuint program, glw::GLsizei uniformCount, const glw::GLchar *const*uniformNames, glw::GLuint *uniformIndices)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << getPointerStr(uniformNames, uniformCount) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");" << TestLog::EndMessage;
 	m_gl.getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// uniformIndices = " << getPointerStr(uniformIndices, uniformCount) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformIndices) << program << uniformCount << uniformIndices << traceArray(uniformNames, uniformCount) << traceArray(uniformIndices, uniformCount) << CallTrace::EndRecord;
+}
+
+static void formatGlGetUniformLocation (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint returnValue = trace.get<glw::GLint>();
+	const char* nameData = trace.getString();
+	str << "glGetUniformLocation(" << program << ", " << getStringStr(nameData) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 glw::GLint CallLogWrapper::glGetUniformLocation (glw::GLuint program, const glw::GLchar *name)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
 	glw::GLint returnValue = m_gl.getUniformLocation(program, name);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformLocation) << program << returnValue << traceString(name) << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlGetUniformSubroutineuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	str << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+}
+
 void CallLogWrapper::glGetUniformSubroutineuiv (glw::GLenum shadertype, glw::GLint location, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getUniformSubroutineuiv(shadertype, location, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformSubroutineuiv) << shadertype << location << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetUniformdv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble *params = trace.get<glw::GLdouble *>();
+	str << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetUniformdv (glw::GLuint program, glw::GLint location, glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getUniformdv(program, location, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformdv) << program << location << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetUniformfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetUniformfv (glw::GLuint program, glw::GLint location, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getUniformfv(program, location, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformfv) << program << location << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetUniformiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetUniformiv (glw::GLuint program, glw::GLint location, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getUniformiv(program, location, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformiv) << program << location << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetUniformuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	str << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetUniformuiv (glw::GLuint program, glw::GLint location, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getUniformuiv(program, location, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetUniformuiv) << program << location << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayIndexed64iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint64 *param = trace.get<glw::GLint64 *>();
+	str << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayIndexed64iv (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, glw::GLint64 *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayIndexed64iv(vaobj, index, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayIndexed64iv) << vaobj << index << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayIndexediv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayIndexediv (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayIndexediv(vaobj, index, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayIndexediv) << vaobj << index << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayIntegeri_vEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetVertexArrayIntegeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayIntegeri_vEXT (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayIntegeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayIntegeri_vEXT(vaobj, index, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayIntegeri_vEXT) << vaobj << index << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayIntegervEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetVertexArrayIntegervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayIntegervEXT (glw::GLuint vaobj, glw::GLenum pname, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayIntegervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayIntegervEXT(vaobj, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayIntegervEXT) << vaobj << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayPointeri_vEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void **param = trace.get<void **>();
+	str << "glGetVertexArrayPointeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayPointeri_vEXT (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, void **param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayPointeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayPointeri_vEXT(vaobj, index, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayPointeri_vEXT) << vaobj << index << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayPointervEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void **param = trace.get<void **>();
+	str << "glGetVertexArrayPointervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayPointervEXT (glw::GLuint vaobj, glw::GLenum pname, void **param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayPointervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayPointervEXT(vaobj, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayPointervEXT) << vaobj << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexArrayiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *param = trace.get<glw::GLint *>();
+	str << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glGetVertexArrayiv (glw::GLuint vaobj, glw::GLenum pname, glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexArrayiv(vaobj, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexArrayiv) << vaobj << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetVertexAttribIiv (glw::GLuint index, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribIiv(index, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribIiv) << index << pname << params << traceArray(params, getAttributeQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	const tcu::Format::ArrayPointer<glw::GLuint> paramsResult = trace.getArray<glw::GLuint>();
+	str << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetVertexAttribIuiv (glw::GLuint index, glw::GLenum pname, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribIuiv(index, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribIuiv) << index << pname << params << traceArray(params, getAttributeQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribLdv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLdouble *params = trace.get<glw::GLdouble *>();
+	str << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetVertexAttribLdv (glw::GLuint index, glw::GLenum pname, glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribLdv(index, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribLdv) << index << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribPointerv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	void **pointer = trace.get<void **>();
+	str << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");";
 }
 
 void CallLogWrapper::glGetVertexAttribPointerv (glw::GLuint index, glw::GLenum pname, void **pointer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribPointerv(index, pname, pointer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribPointerv) << index << pname << pointer << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribdv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLdouble *params = trace.get<glw::GLdouble *>();
+	str << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetVertexAttribdv (glw::GLuint index, glw::GLenum pname, glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribdv(index, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribdv) << index << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> paramsResult = trace.getArray<glw::GLfloat>();
+	str << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetVertexAttribfv (glw::GLuint index, glw::GLenum pname, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribfv(index, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribfv) << index << pname << params << traceArray(params, getAttributeQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetVertexAttribiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsResult = trace.getArray<glw::GLint>();
+	str << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	str << "\n// params = " << getPointerStr(paramsResult.arr, paramsResult.size);
 }
 
 void CallLogWrapper::glGetVertexAttribiv (glw::GLuint index, glw::GLenum pname, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getVertexAttribiv(index, pname, params);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetVertexAttribiv) << index << pname << params << traceArray(params, getAttributeQueryNumArgsOut(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlGetnCompressedTexImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint lod = trace.get<glw::GLint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *pixels = trace.get<void *>();
+	str << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetnCompressedTexImage (glw::GLenum target, glw::GLint lod, glw::GLsizei bufSize, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getnCompressedTexImage(target, lod, bufSize, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetnCompressedTexImage) << target << lod << bufSize << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetnTexImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *pixels = trace.get<void *>();
+	str << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glGetnTexImage (glw::GLenum target, glw::GLint level, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.getnTexImage(target, level, format, type, bufSize, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetnTexImage) << target << level << format << type << bufSize << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlGetnUniformdv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLdouble *params = trace.get<glw::GLdouble *>();
+	str << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetnUniformdv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getnUniformdv(program, location, bufSize, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetnUniformdv) << program << location << bufSize << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetnUniformfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLfloat *params = trace.get<glw::GLfloat *>();
+	str << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetnUniformfv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getnUniformfv(program, location, bufSize, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetnUniformfv) << program << location << bufSize << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetnUniformiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLint *params = trace.get<glw::GLint *>();
+	str << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetnUniformiv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getnUniformiv(program, location, bufSize, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetnUniformiv) << program << location << bufSize << params << CallTrace::EndRecord;
+}
+
+static void formatGlGetnUniformuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	glw::GLuint *params = trace.get<glw::GLuint *>();
+	str << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glGetnUniformuiv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.getnUniformuiv(program, location, bufSize, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlGetnUniformuiv) << program << location << bufSize << params << CallTrace::EndRecord;
+}
+
+static void formatGlHint (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");";
 }
 
 void CallLogWrapper::glHint (glw::GLenum target, glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");" << TestLog::EndMessage;
 	m_gl.hint(target, mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlHint) << target << mode << CallTrace::EndRecord;
+}
+
+static void formatGlInsertEventMarkerEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	const char* markerData = trace.getString();
+	str << "glInsertEventMarkerEXT(" << length << ", " << getStringStr(markerData) << ");";
 }
 
 void CallLogWrapper::glInsertEventMarkerEXT (glw::GLsizei length, const glw::GLchar *marker)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInsertEventMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
 	m_gl.insertEventMarkerEXT(length, marker);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInsertEventMarkerEXT) << length << traceString(marker) << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateBufferData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glInvalidateBufferData(" << buffer << ");";
 }
 
 void CallLogWrapper::glInvalidateBufferData (glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateBufferData(" << buffer << ");" << TestLog::EndMessage;
 	m_gl.invalidateBufferData(buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateBufferData) << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr length = trace.get<glw::GLsizeiptr>();
+	str << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");";
 }
 
 void CallLogWrapper::glInvalidateBufferSubData (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr length)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
 	m_gl.invalidateBufferSubData(buffer, offset, length);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateBufferSubData) << buffer << offset << length << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateFramebuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei numAttachments = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLenum> attachmentsData = trace.getArray<glw::GLenum>();
+	str << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachmentsData.arr, attachmentsData.size, getInvalidateAttachmentName) << ");";
 }
 
 void CallLogWrapper::glInvalidateFramebuffer (glw::GLenum target, glw::GLsizei numAttachments, const glw::GLenum *attachments)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ");" << TestLog::EndMessage;
 	m_gl.invalidateFramebuffer(target, numAttachments, attachments);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateFramebuffer) << target << numAttachments << traceArray(attachments, numAttachments) << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateNamedFramebufferData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLsizei numAttachments = trace.get<glw::GLsizei>();
+	const glw::GLenum *attachments = trace.get<const glw::GLenum *>();
+	str << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");";
 }
 
 void CallLogWrapper::glInvalidateNamedFramebufferData (glw::GLuint framebuffer, glw::GLsizei numAttachments, const glw::GLenum *attachments)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");" << TestLog::EndMessage;
 	m_gl.invalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateNamedFramebufferData) << framebuffer << numAttachments << attachments << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateNamedFramebufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLsizei numAttachments = trace.get<glw::GLsizei>();
+	const glw::GLenum *attachments = trace.get<const glw::GLenum *>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glInvalidateNamedFramebufferSubData (glw::GLuint framebuffer, glw::GLsizei numAttachments, const glw::GLenum *attachments, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.invalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateNamedFramebufferSubData) << framebuffer << numAttachments << attachments << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateSubFramebuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei numAttachments = trace.get<glw::GLsizei>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLenum> attachmentsData = trace.getArray<glw::GLenum>();
+	str << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachmentsData.arr, attachmentsData.size, getInvalidateAttachmentName) << ", " << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glInvalidateSubFramebuffer (glw::GLenum target, glw::GLsizei numAttachments, const glw::GLenum *attachments, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateSubFramebuffer) << target << numAttachments << x << y << width << height << traceArray(attachments, numAttachments) << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateTexImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glInvalidateTexImage(" << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glInvalidateTexImage (glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateTexImage(" << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.invalidateTexImage(texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateTexImage) << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlInvalidateTexSubImage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	str << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");";
 }
 
 void CallLogWrapper::glInvalidateTexSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
 	m_gl.invalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlInvalidateTexSubImage) << texture << level << xoffset << yoffset << zoffset << width << height << depth << CallTrace::EndRecord;
+}
+
+static void formatGlIsBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsBuffer(" << buffer << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
 }
 
 glw::GLboolean CallLogWrapper::glIsBuffer (glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsBuffer(" << buffer << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isBuffer(buffer);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsBuffer) << buffer << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsEnabled (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum cap = trace.get<glw::GLenum>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsEnabled(" << getEnableCapStr(cap) << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsEnabled (glw::GLenum cap)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsEnabled(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isEnabled(cap);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsEnabled) << cap << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsEnabledIndexedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsEnabledIndexedEXT(" << toHex(target) << ", " << index << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsEnabledIndexedEXT (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsEnabledIndexedEXT(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isEnabledIndexedEXT(target, index);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsEnabledIndexedEXT) << target << index << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsEnabledi (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsEnabledi (glw::GLenum target, glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isEnabledi(target, index);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsEnabledi) << target << index << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsFramebuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsFramebuffer(" << framebuffer << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsFramebuffer (glw::GLuint framebuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsFramebuffer(" << framebuffer << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isFramebuffer(framebuffer);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsFramebuffer) << framebuffer << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsProgram(" << program << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsProgram (glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsProgram(" << program << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isProgram(program);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsProgram) << program << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsProgramPipeline (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsProgramPipeline(" << pipeline << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsProgramPipeline (glw::GLuint pipeline)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isProgramPipeline(pipeline);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsProgramPipeline) << pipeline << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsQuery (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsQuery(" << id << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsQuery (glw::GLuint id)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsQuery(" << id << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isQuery(id);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsQuery) << id << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsRenderbuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsRenderbuffer(" << renderbuffer << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsRenderbuffer (glw::GLuint renderbuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsRenderbuffer(" << renderbuffer << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isRenderbuffer(renderbuffer);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsRenderbuffer) << renderbuffer << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsSampler (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsSampler(" << sampler << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsSampler (glw::GLuint sampler)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsSampler(" << sampler << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isSampler(sampler);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsSampler) << sampler << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsShader (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsShader(" << shader << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsShader (glw::GLuint shader)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsShader(" << shader << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isShader(shader);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsShader) << shader << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsSync (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsync sync = trace.get<glw::GLsync>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsSync(" << sync << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsSync (glw::GLsync sync)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsSync(" << sync << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isSync(sync);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsSync) << sync << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsTexture (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsTexture(" << texture << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsTexture (glw::GLuint texture)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsTexture(" << texture << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isTexture(texture);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsTexture) << texture << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsTransformFeedback(" << id << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsTransformFeedback (glw::GLuint id)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsTransformFeedback(" << id << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isTransformFeedback(id);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsTransformFeedback) << id << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlIsVertexArray (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint array = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glIsVertexArray(" << array << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glIsVertexArray (glw::GLuint array)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glIsVertexArray(" << array << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.isVertexArray(array);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlIsVertexArray) << array << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlLineWidth (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat width = trace.get<glw::GLfloat>();
+	str << "glLineWidth(" << width << ");";
+}
+
 void CallLogWrapper::glLineWidth (glw::GLfloat width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glLineWidth(" << width << ");" << TestLog::EndMessage;
 	m_gl.lineWidth(width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlLineWidth) << width << CallTrace::EndRecord;
+}
+
+static void formatGlLinkProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	str << "glLinkProgram(" << program << ");";
 }
 
 void CallLogWrapper::glLinkProgram (glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glLinkProgram(" << program << ");" << TestLog::EndMessage;
 	m_gl.linkProgram(program);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlLinkProgram) << program << CallTrace::EndRecord;
+}
+
+static void formatGlLogicOp (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum opcode = trace.get<glw::GLenum>();
+	str << "glLogicOp(" << toHex(opcode) << ");";
 }
 
 void CallLogWrapper::glLogicOp (glw::GLenum opcode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glLogicOp(" << toHex(opcode) << ");" << TestLog::EndMessage;
 	m_gl.logicOp(opcode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlLogicOp) << opcode << CallTrace::EndRecord;
+}
+
+static void formatGlMapBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum access = trace.get<glw::GLenum>();
+	void * returnValue = trace.get<void *>();
+	str << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");";
+	str << "\n// " << returnValue << " returned";
 }
 
 void * CallLogWrapper::glMapBuffer (glw::GLenum target, glw::GLenum access)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");" << TestLog::EndMessage;
 	void * returnValue = m_gl.mapBuffer(target, access);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMapBuffer) << target << access << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlMapBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr length = trace.get<glw::GLsizeiptr>();
+	glw::GLbitfield access = trace.get<glw::GLbitfield>();
+	void * returnValue = trace.get<void *>();
+	str << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 void * CallLogWrapper::glMapBufferRange (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr length, glw::GLbitfield access)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");" << TestLog::EndMessage;
 	void * returnValue = m_gl.mapBufferRange(target, offset, length, access);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMapBufferRange) << target << offset << length << access << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlMapNamedBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum access = trace.get<glw::GLenum>();
+	void * returnValue = trace.get<void *>();
+	str << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 void * CallLogWrapper::glMapNamedBuffer (glw::GLuint buffer, glw::GLenum access)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
 	void * returnValue = m_gl.mapNamedBuffer(buffer, access);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMapNamedBuffer) << buffer << access << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlMapNamedBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr length = trace.get<glw::GLsizeiptr>();
+	glw::GLbitfield access = trace.get<glw::GLbitfield>();
+	void * returnValue = trace.get<void *>();
+	str << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");";
+	str << "\n// " << returnValue << " returned";
+}
+
 void * CallLogWrapper::glMapNamedBufferRange (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr length, glw::GLbitfield access)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
 	void * returnValue = m_gl.mapNamedBufferRange(buffer, offset, length, access);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMapNamedBufferRange) << buffer << offset << length << access << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlMatrixFrustumEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLdouble left = trace.get<glw::GLdouble>();
+	glw::GLdouble right = trace.get<glw::GLdouble>();
+	glw::GLdouble bottom = trace.get<glw::GLdouble>();
+	glw::GLdouble top = trace.get<glw::GLdouble>();
+	glw::GLdouble zNear = trace.get<glw::GLdouble>();
+	glw::GLdouble zFar = trace.get<glw::GLdouble>();
+	str << "glMatrixFrustumEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");";
+}
+
 void CallLogWrapper::glMatrixFrustumEXT (glw::GLenum mode, glw::GLdouble left, glw::GLdouble right, glw::GLdouble bottom, glw::GLdouble top, glw::GLdouble zNear, glw::GLdouble zFar)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixFrustumEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
 	m_gl.matrixFrustumEXT(mode, left, right, bottom, top, zNear, zFar);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixFrustumEXT) << mode << left << right << bottom << top << zNear << zFar << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixLoadIdentityEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glMatrixLoadIdentityEXT(" << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glMatrixLoadIdentityEXT (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixLoadIdentityEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.matrixLoadIdentityEXT(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixLoadIdentityEXT) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixLoadTransposedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLdouble *m = trace.get<const glw::GLdouble *>();
+	str << "glMatrixLoadTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixLoadTransposedEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixLoadTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixLoadTransposedEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixLoadTransposedEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixLoadTransposefEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLfloat *m = trace.get<const glw::GLfloat *>();
+	str << "glMatrixLoadTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixLoadTransposefEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixLoadTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixLoadTransposefEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixLoadTransposefEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixLoaddEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLdouble *m = trace.get<const glw::GLdouble *>();
+	str << "glMatrixLoaddEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixLoaddEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixLoaddEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixLoaddEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixLoaddEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixLoadfEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLfloat *m = trace.get<const glw::GLfloat *>();
+	str << "glMatrixLoadfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixLoadfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixLoadfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixLoadfEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixLoadfEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixMultTransposedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLdouble *m = trace.get<const glw::GLdouble *>();
+	str << "glMatrixMultTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixMultTransposedEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixMultTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixMultTransposedEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixMultTransposedEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixMultTransposefEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLfloat *m = trace.get<const glw::GLfloat *>();
+	str << "glMatrixMultTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixMultTransposefEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixMultTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixMultTransposefEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixMultTransposefEXT) << mode << m << CallTrace::EndRecord;
 }
 
-void CallLogWrapper::glMatrixMultdEXT (glw::GLenum mode, const glw::GLdouble *m)
+static void formatGlMatrixMultdEXT (std::ostream& str, CallTraceReader& trace)
 {
-	if (m_enableLog)
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLdouble *m = trace.get<const glw::GLdouble *>();
+	str << "glMatrixMultdEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+}
+
+void CallLogWrapper::glMatrixMultdEXT (glw::GLenum mode, const glw::GLdouble *m)
+{
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixMultdEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixMultdEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixMultdEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixMultfEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLfloat *m = trace.get<const glw::GLfloat *>();
+	str << "glMatrixMultfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
 }
 
 void CallLogWrapper::glMatrixMultfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixMultfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
 	m_gl.matrixMultfEXT(mode, m);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixMultfEXT) << mode << m << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixOrthoEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLdouble left = trace.get<glw::GLdouble>();
+	glw::GLdouble right = trace.get<glw::GLdouble>();
+	glw::GLdouble bottom = trace.get<glw::GLdouble>();
+	glw::GLdouble top = trace.get<glw::GLdouble>();
+	glw::GLdouble zNear = trace.get<glw::GLdouble>();
+	glw::GLdouble zFar = trace.get<glw::GLdouble>();
+	str << "glMatrixOrthoEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");";
 }
 
 void CallLogWrapper::glMatrixOrthoEXT (glw::GLenum mode, glw::GLdouble left, glw::GLdouble right, glw::GLdouble bottom, glw::GLdouble top, glw::GLdouble zNear, glw::GLdouble zFar)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixOrthoEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
 	m_gl.matrixOrthoEXT(mode, left, right, bottom, top, zNear, zFar);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixOrthoEXT) << mode << left << right << bottom << top << zNear << zFar << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixPopEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glMatrixPopEXT(" << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glMatrixPopEXT (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixPopEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.matrixPopEXT(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixPopEXT) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixPushEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glMatrixPushEXT(" << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glMatrixPushEXT (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixPushEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.matrixPushEXT(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixPushEXT) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixRotatedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLdouble angle = trace.get<glw::GLdouble>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	str << "glMatrixRotatedEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glMatrixRotatedEXT (glw::GLenum mode, glw::GLdouble angle, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixRotatedEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.matrixRotatedEXT(mode, angle, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixRotatedEXT) << mode << angle << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixRotatefEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLfloat angle = trace.get<glw::GLfloat>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat z = trace.get<glw::GLfloat>();
+	str << "glMatrixRotatefEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glMatrixRotatefEXT (glw::GLenum mode, glw::GLfloat angle, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixRotatefEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.matrixRotatefEXT(mode, angle, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixRotatefEXT) << mode << angle << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixScaledEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	str << "glMatrixScaledEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glMatrixScaledEXT (glw::GLenum mode, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixScaledEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.matrixScaledEXT(mode, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixScaledEXT) << mode << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixScalefEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat z = trace.get<glw::GLfloat>();
+	str << "glMatrixScalefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glMatrixScalefEXT (glw::GLenum mode, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixScalefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.matrixScalefEXT(mode, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixScalefEXT) << mode << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixTranslatedEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	str << "glMatrixTranslatedEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glMatrixTranslatedEXT (glw::GLenum mode, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixTranslatedEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.matrixTranslatedEXT(mode, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixTranslatedEXT) << mode << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlMatrixTranslatefEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat z = trace.get<glw::GLfloat>();
+	str << "glMatrixTranslatefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glMatrixTranslatefEXT (glw::GLenum mode, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMatrixTranslatefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.matrixTranslatefEXT(mode, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMatrixTranslatefEXT) << mode << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlMaxShaderCompilerThreadsARB (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint count = trace.get<glw::GLuint>();
+	str << "glMaxShaderCompilerThreadsARB(" << count << ");";
 }
 
 void CallLogWrapper::glMaxShaderCompilerThreadsARB (glw::GLuint count)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMaxShaderCompilerThreadsARB(" << count << ");" << TestLog::EndMessage;
 	m_gl.maxShaderCompilerThreadsARB(count);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMaxShaderCompilerThreadsARB) << count << CallTrace::EndRecord;
+}
+
+static void formatGlMemoryBarrier (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLbitfield barriers = trace.get<glw::GLbitfield>();
+	str << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");";
 }
 
 void CallLogWrapper::glMemoryBarrier (glw::GLbitfield barriers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");" << TestLog::EndMessage;
 	m_gl.memoryBarrier(barriers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMemoryBarrier) << barriers << CallTrace::EndRecord;
+}
+
+static void formatGlMemoryBarrierByRegion (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLbitfield barriers = trace.get<glw::GLbitfield>();
+	str << "glMemoryBarrierByRegion(" << toHex(barriers) << ");";
 }
 
 void CallLogWrapper::glMemoryBarrierByRegion (glw::GLbitfield barriers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMemoryBarrierByRegion(" << toHex(barriers) << ");" << TestLog::EndMessage;
 	m_gl.memoryBarrierByRegion(barriers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMemoryBarrierByRegion) << barriers << CallTrace::EndRecord;
+}
+
+static void formatGlMinSampleShading (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat value = trace.get<glw::GLfloat>();
+	str << "glMinSampleShading(" << value << ");";
 }
 
 void CallLogWrapper::glMinSampleShading (glw::GLfloat value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMinSampleShading(" << value << ");" << TestLog::EndMessage;
 	m_gl.minSampleShading(value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMinSampleShading) << value << CallTrace::EndRecord;
+}
+
+static void formatGlMultiDrawArrays (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLint *first = trace.get<const glw::GLint *>();
+	const glw::GLsizei *count = trace.get<const glw::GLsizei *>();
+	glw::GLsizei drawcount = trace.get<glw::GLsizei>();
+	str << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");";
 }
 
 void CallLogWrapper::glMultiDrawArrays (glw::GLenum mode, const glw::GLint *first, const glw::GLsizei *count, glw::GLsizei drawcount)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");" << TestLog::EndMessage;
 	m_gl.multiDrawArrays(mode, first, count, drawcount);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiDrawArrays) << mode << first << count << drawcount << CallTrace::EndRecord;
+}
+
+static void formatGlMultiDrawArraysIndirect (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const void *indirect = trace.get<const void *>();
+	glw::GLsizei drawcount = trace.get<glw::GLsizei>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	str << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << stride << ");";
 }
 
 void CallLogWrapper::glMultiDrawArraysIndirect (glw::GLenum mode, const void *indirect, glw::GLsizei drawcount, glw::GLsizei stride)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
 	m_gl.multiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiDrawArraysIndirect) << mode << indirect << drawcount << stride << CallTrace::EndRecord;
+}
+
+static void formatGlMultiDrawElements (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLsizei *count = trace.get<const glw::GLsizei *>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *const*indices = trace.get<const void *const*>();
+	glw::GLsizei drawcount = trace.get<glw::GLsizei>();
+	str << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");";
 }
 
 void CallLogWrapper::glMultiDrawElements (glw::GLenum mode, const glw::GLsizei *count, glw::GLenum type, const void *const*indices, glw::GLsizei drawcount)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");" << TestLog::EndMessage;
 	m_gl.multiDrawElements(mode, count, type, indices, drawcount);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiDrawElements) << mode << count << type << indices << drawcount << CallTrace::EndRecord;
+}
+
+static void formatGlMultiDrawElementsBaseVertex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	const glw::GLsizei *count = trace.get<const glw::GLsizei *>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *const*indices = trace.get<const void *const*>();
+	glw::GLsizei drawcount = trace.get<glw::GLsizei>();
+	const glw::GLint *basevertex = trace.get<const glw::GLint *>();
+	str << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");";
 }
 
 void CallLogWrapper::glMultiDrawElementsBaseVertex (glw::GLenum mode, const glw::GLsizei *count, glw::GLenum type, const void *const*indices, glw::GLsizei drawcount, const glw::GLint *basevertex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");" << TestLog::EndMessage;
 	m_gl.multiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiDrawElementsBaseVertex) << mode << count << type << indices << drawcount << basevertex << CallTrace::EndRecord;
+}
+
+static void formatGlMultiDrawElementsIndirect (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *indirect = trace.get<const void *>();
+	glw::GLsizei drawcount = trace.get<glw::GLsizei>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	str << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << stride << ");";
 }
 
 void CallLogWrapper::glMultiDrawElementsIndirect (glw::GLenum mode, glw::GLenum type, const void *indirect, glw::GLsizei drawcount, glw::GLsizei stride)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
 	m_gl.multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiDrawElementsIndirect) << mode << type << indirect << drawcount << stride << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexBufferEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glMultiTexBufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glMultiTexBufferEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum internalformat, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexBufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.multiTexBufferEXT(texunit, target, internalformat, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexBufferEXT) << texunit << target << internalformat << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexCoordPointerEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	const void *pointer = trace.get<const void *>();
+	str << "glMultiTexCoordPointerEXT(" << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");";
 }
 
 void CallLogWrapper::glMultiTexCoordPointerEXT (glw::GLenum texunit, glw::GLint size, glw::GLenum type, glw::GLsizei stride, const void *pointer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexCoordPointerEXT(" << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
 	m_gl.multiTexCoordPointerEXT(texunit, size, type, stride, pointer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexCoordPointerEXT) << texunit << size << type << stride << pointer << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexEnvfEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glMultiTexEnvfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexEnvfEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexEnvfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexEnvfEXT(texunit, target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexEnvfEXT) << texunit << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexEnvfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLfloat *params = trace.get<const glw::GLfloat *>();
+	str << "glMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexEnvfvEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexEnvfvEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexEnviEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glMultiTexEnviEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexEnviEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexEnviEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexEnviEXT(texunit, target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexEnviEXT) << texunit << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexEnvivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexEnvivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexEnvivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexGendEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLdouble param = trace.get<glw::GLdouble>();
+	str << "glMultiTexGendEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexGendEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLdouble param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexGendEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexGendEXT(texunit, coord, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexGendEXT) << texunit << coord << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexGendvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLdouble *params = trace.get<const glw::GLdouble *>();
+	str << "glMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, const glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexGendvEXT(texunit, coord, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexGendvEXT) << texunit << coord << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexGenfEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glMultiTexGenfEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexGenfEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexGenfEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexGenfEXT(texunit, coord, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexGenfEXT) << texunit << coord << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexGenfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLfloat *params = trace.get<const glw::GLfloat *>();
+	str << "glMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexGenfvEXT(texunit, coord, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexGenfvEXT) << texunit << coord << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexGeniEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glMultiTexGeniEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexGeniEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexGeniEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexGeniEXT(texunit, coord, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexGeniEXT) << texunit << coord << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexGenivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum coord = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexGenivEXT(texunit, coord, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexGenivEXT) << texunit << coord << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.multiTexImage1DEXT(texunit, target, level, internalformat, width, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexImage1DEXT) << texunit << target << level << internalformat << width << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.multiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexImage2DEXT) << texunit << target << level << internalformat << width << height << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glMultiTexImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.multiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexImage3DEXT) << texunit << target << level << internalformat << width << height << depth << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexParameterIivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexParameterIivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexParameterIivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexParameterIuivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLuint *params = trace.get<const glw::GLuint *>();
+	str << "glMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexParameterIuivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexParameterIuivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexParameterfEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glMultiTexParameterfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexParameterfEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexParameterfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexParameterfEXT(texunit, target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexParameterfEXT) << texunit << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexParameterfvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLfloat *params = trace.get<const glw::GLfloat *>();
+	str << "glMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexParameterfvEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexParameterfvEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexParameteriEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glMultiTexParameteriEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glMultiTexParameteriEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexParameteriEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.multiTexParameteriEXT(texunit, target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexParameteriEXT) << texunit << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexParameterivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glMultiTexParameterivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.multiTexParameterivEXT(texunit, target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexParameterivEXT) << texunit << target << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexRenderbufferEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	str << "glMultiTexRenderbufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << renderbuffer << ");";
 }
 
 void CallLogWrapper::glMultiTexRenderbufferEXT (glw::GLenum texunit, glw::GLenum target, glw::GLuint renderbuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexRenderbufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
 	m_gl.multiTexRenderbufferEXT(texunit, target, renderbuffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexRenderbufferEXT) << texunit << target << renderbuffer << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexSubImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.multiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexSubImage1DEXT) << texunit << target << level << xoffset << width << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexSubImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.multiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexSubImage2DEXT) << texunit << target << level << xoffset << yoffset << width << height << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlMultiTexSubImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.multiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlMultiTexSubImage3DEXT) << texunit << target << level << xoffset << yoffset << zoffset << width << height << depth << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlNamedBufferData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	const void *data = trace.get<const void *>();
+	glw::GLenum usage = trace.get<glw::GLenum>();
+	str << "glNamedBufferData(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");";
 }
 
 void CallLogWrapper::glNamedBufferData (glw::GLuint buffer, glw::GLsizeiptr size, const void *data, glw::GLenum usage)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedBufferData(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
 	m_gl.namedBufferData(buffer, size, data, usage);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedBufferData) << buffer << size << data << usage << CallTrace::EndRecord;
+}
+
+static void formatGlNamedBufferPageCommitmentARB (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	glw::GLboolean commit = trace.get<glw::GLboolean>();
+	str << "glNamedBufferPageCommitmentARB(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");";
 }
 
 void CallLogWrapper::glNamedBufferPageCommitmentARB (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLboolean commit)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentARB(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
 	m_gl.namedBufferPageCommitmentARB(buffer, offset, size, commit);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedBufferPageCommitmentARB) << buffer << offset << size << commit << CallTrace::EndRecord;
+}
+
+static void formatGlNamedBufferPageCommitmentEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	glw::GLboolean commit = trace.get<glw::GLboolean>();
+	str << "glNamedBufferPageCommitmentEXT(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");";
 }
 
 void CallLogWrapper::glNamedBufferPageCommitmentEXT (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLboolean commit)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentEXT(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
 	m_gl.namedBufferPageCommitmentEXT(buffer, offset, size, commit);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedBufferPageCommitmentEXT) << buffer << offset << size << commit << CallTrace::EndRecord;
+}
+
+static void formatGlNamedBufferStorage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	const void *data = trace.get<const void *>();
+	glw::GLbitfield flags = trace.get<glw::GLbitfield>();
+	str << "glNamedBufferStorage(" << buffer << ", " << size << ", " << data << ", " << toHex(flags) << ");";
 }
 
 void CallLogWrapper::glNamedBufferStorage (glw::GLuint buffer, glw::GLsizeiptr size, const void *data, glw::GLbitfield flags)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedBufferStorage(" << buffer << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
 	m_gl.namedBufferStorage(buffer, size, data, flags);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedBufferStorage) << buffer << size << data << flags << CallTrace::EndRecord;
+}
+
+static void formatGlNamedBufferSubData (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	const void *data = trace.get<const void *>();
+	str << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");";
 }
 
 void CallLogWrapper::glNamedBufferSubData (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, const void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.namedBufferSubData(buffer, offset, size, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedBufferSubData) << buffer << offset << size << data << CallTrace::EndRecord;
+}
+
+static void formatGlNamedCopyBufferSubDataEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint readBuffer = trace.get<glw::GLuint>();
+	glw::GLuint writeBuffer = trace.get<glw::GLuint>();
+	glw::GLintptr readOffset = trace.get<glw::GLintptr>();
+	glw::GLintptr writeOffset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glNamedCopyBufferSubDataEXT(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");";
 }
 
 void CallLogWrapper::glNamedCopyBufferSubDataEXT (glw::GLuint readBuffer, glw::GLuint writeBuffer, glw::GLintptr readOffset, glw::GLintptr writeOffset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedCopyBufferSubDataEXT(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.namedCopyBufferSubDataEXT(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedCopyBufferSubDataEXT) << readBuffer << writeBuffer << readOffset << writeOffset << size << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferDrawBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum buf = trace.get<glw::GLenum>();
+	str << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferDrawBuffer (glw::GLuint framebuffer, glw::GLenum buf)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferDrawBuffer(framebuffer, buf);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferDrawBuffer) << framebuffer << buf << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferDrawBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLsizei n = trace.get<glw::GLsizei>();
+	const glw::GLenum *bufs = trace.get<const glw::GLenum *>();
+	str << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferDrawBuffers (glw::GLuint framebuffer, glw::GLsizei n, const glw::GLenum *bufs)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferDrawBuffers(framebuffer, n, bufs);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferDrawBuffers) << framebuffer << n << bufs << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferParameteri (glw::GLuint framebuffer, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferParameteri(framebuffer, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferParameteri) << framebuffer << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferReadBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum src = trace.get<glw::GLenum>();
+	str << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferReadBuffer (glw::GLuint framebuffer, glw::GLenum src)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferReadBuffer(framebuffer, src);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferReadBuffer) << framebuffer << src << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferRenderbuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum renderbuffertarget = trace.get<glw::GLenum>();
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	str << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferRenderbuffer (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum renderbuffertarget, glw::GLuint renderbuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferRenderbuffer) << framebuffer << attachment << renderbuffertarget << renderbuffer << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferTexture (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferTexture (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferTexture(framebuffer, attachment, texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferTexture) << framebuffer << attachment << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferTexture1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glNamedFramebufferTexture1DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferTexture1DEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferTexture1DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferTexture1DEXT(framebuffer, attachment, textarget, texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferTexture1DEXT) << framebuffer << attachment << textarget << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferTexture2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	str << "glNamedFramebufferTexture2DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferTexture2DEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferTexture2DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferTexture2DEXT(framebuffer, attachment, textarget, texture, level);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferTexture2DEXT) << framebuffer << attachment << textarget << texture << level << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferTexture3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLenum textarget = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	str << "glNamedFramebufferTexture3DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferTexture3DEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level, glw::GLint zoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferTexture3DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferTexture3DEXT(framebuffer, attachment, textarget, texture, level, zoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferTexture3DEXT) << framebuffer << attachment << textarget << texture << level << zoffset << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferTextureFaceEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum face = trace.get<glw::GLenum>();
+	str << "glNamedFramebufferTextureFaceEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << toHex(face) << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferTextureFaceEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLuint texture, glw::GLint level, glw::GLenum face)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferTextureFaceEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << toHex(face) << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferTextureFaceEXT(framebuffer, attachment, texture, level, face);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferTextureFaceEXT) << framebuffer << attachment << texture << level << face << CallTrace::EndRecord;
+}
+
+static void formatGlNamedFramebufferTextureLayer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint framebuffer = trace.get<glw::GLuint>();
+	glw::GLenum attachment = trace.get<glw::GLenum>();
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint layer = trace.get<glw::GLint>();
+	str << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");";
 }
 
 void CallLogWrapper::glNamedFramebufferTextureLayer (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLuint texture, glw::GLint level, glw::GLint layer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
 	m_gl.namedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedFramebufferTextureLayer) << framebuffer << attachment << texture << level << layer << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameter4dEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	glw::GLdouble w = trace.get<glw::GLdouble>();
+	str << "glNamedProgramLocalParameter4dEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4dEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameter4dEXT(program, target, index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameter4dEXT) << program << target << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameter4dvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLdouble *params = trace.get<const glw::GLdouble *>();
+	str << "glNamedProgramLocalParameter4dvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4dvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLdouble *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameter4dvEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameter4dvEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameter4fEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat z = trace.get<glw::GLfloat>();
+	glw::GLfloat w = trace.get<glw::GLfloat>();
+	str << "glNamedProgramLocalParameter4fEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4fEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z, glw::GLfloat w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameter4fEXT(program, target, index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameter4fEXT) << program << target << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameter4fvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLfloat *params = trace.get<const glw::GLfloat *>();
+	str << "glNamedProgramLocalParameter4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4fvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameter4fvEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameter4fvEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameterI4iEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLint z = trace.get<glw::GLint>();
+	glw::GLint w = trace.get<glw::GLint>();
+	str << "glNamedProgramLocalParameterI4iEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4iEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLint x, glw::GLint y, glw::GLint z, glw::GLint w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4iEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameterI4iEXT(program, target, index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameterI4iEXT) << program << target << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameterI4ivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glNamedProgramLocalParameterI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4ivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameterI4ivEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameterI4ivEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameterI4uiEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint x = trace.get<glw::GLuint>();
+	glw::GLuint y = trace.get<glw::GLuint>();
+	glw::GLuint z = trace.get<glw::GLuint>();
+	glw::GLuint w = trace.get<glw::GLuint>();
+	str << "glNamedProgramLocalParameterI4uiEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4uiEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLuint x, glw::GLuint y, glw::GLuint z, glw::GLuint w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uiEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameterI4uiEXT(program, target, index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameterI4uiEXT) << program << target << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameterI4uivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLuint *params = trace.get<const glw::GLuint *>();
+	str << "glNamedProgramLocalParameterI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4uivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameterI4uivEXT(program, target, index, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameterI4uivEXT) << program << target << index << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParameters4fvEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLfloat *params = trace.get<const glw::GLfloat *>();
+	str << "glNamedProgramLocalParameters4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParameters4fvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLsizei count, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParameters4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParameters4fvEXT(program, target, index, count, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParameters4fvEXT) << program << target << index << count << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParametersI4ivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glNamedProgramLocalParametersI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParametersI4ivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLsizei count, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParametersI4ivEXT(program, target, index, count, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParametersI4ivEXT) << program << target << index << count << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramLocalParametersI4uivEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *params = trace.get<const glw::GLuint *>();
+	str << "glNamedProgramLocalParametersI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glNamedProgramLocalParametersI4uivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLsizei count, const glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.namedProgramLocalParametersI4uivEXT(program, target, index, count, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramLocalParametersI4uivEXT) << program << target << index << count << params << CallTrace::EndRecord;
+}
+
+static void formatGlNamedProgramStringEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLsizei len = trace.get<glw::GLsizei>();
+	const void *string = trace.get<const void *>();
+	str << "glNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(format) << ", " << len << ", " << string << ");";
 }
 
 void CallLogWrapper::glNamedProgramStringEXT (glw::GLuint program, glw::GLenum target, glw::GLenum format, glw::GLsizei len, const void *string)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(format) << ", " << len << ", " << string << ");" << TestLog::EndMessage;
 	m_gl.namedProgramStringEXT(program, target, format, len, string);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedProgramStringEXT) << program << target << format << len << string << CallTrace::EndRecord;
+}
+
+static void formatGlNamedRenderbufferStorage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glNamedRenderbufferStorage (glw::GLuint renderbuffer, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.namedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedRenderbufferStorage) << renderbuffer << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlNamedRenderbufferStorageMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glNamedRenderbufferStorageMultisample (glw::GLuint renderbuffer, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.namedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedRenderbufferStorageMultisample) << renderbuffer << samples << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlNamedRenderbufferStorageMultisampleCoverageEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	glw::GLsizei coverageSamples = trace.get<glw::GLsizei>();
+	glw::GLsizei colorSamples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glNamedRenderbufferStorageMultisampleCoverageEXT(" << renderbuffer << ", " << coverageSamples << ", " << colorSamples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glNamedRenderbufferStorageMultisampleCoverageEXT (glw::GLuint renderbuffer, glw::GLsizei coverageSamples, glw::GLsizei colorSamples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisampleCoverageEXT(" << renderbuffer << ", " << coverageSamples << ", " << colorSamples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.namedRenderbufferStorageMultisampleCoverageEXT(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlNamedRenderbufferStorageMultisampleCoverageEXT) << renderbuffer << coverageSamples << colorSamples << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlObjectLabel (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum identifier = trace.get<glw::GLenum>();
+	glw::GLuint name = trace.get<glw::GLuint>();
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	const char* labelData = trace.getString();
+	str << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << getStringStr(labelData) << ");";
 }
 
 void CallLogWrapper::glObjectLabel (glw::GLenum identifier, glw::GLuint name, glw::GLsizei length, const glw::GLchar *label)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
 	m_gl.objectLabel(identifier, name, length, label);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlObjectLabel) << identifier << name << length << traceString(label) << CallTrace::EndRecord;
+}
+
+static void formatGlObjectPtrLabel (std::ostream& str, CallTraceReader& trace)
+{
+	const void *ptr = trace.get<const void *>();
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	const char* labelData = trace.getString();
+	str << "glObjectPtrLabel(" << ptr << ", " << length << ", " << getStringStr(labelData) << ");";
 }
 
 void CallLogWrapper::glObjectPtrLabel (const void *ptr, glw::GLsizei length, const glw::GLchar *label)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glObjectPtrLabel(" << ptr << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
 	m_gl.objectPtrLabel(ptr, length, label);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlObjectPtrLabel) << ptr << length << traceString(label) << CallTrace::EndRecord;
+}
+
+static void formatGlPatchParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLfloat *values = trace.get<const glw::GLfloat *>();
+	str << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
 }
 
 void CallLogWrapper::glPatchParameterfv (glw::GLenum pname, const glw::GLfloat *values)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
 	m_gl.patchParameterfv(pname, values);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPatchParameterfv) << pname << values << CallTrace::EndRecord;
+}
+
+static void formatGlPatchParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint value = trace.get<glw::GLint>();
+	str << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");";
 }
 
 void CallLogWrapper::glPatchParameteri (glw::GLenum pname, glw::GLint value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
 	m_gl.patchParameteri(pname, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPatchParameteri) << pname << value << CallTrace::EndRecord;
+}
+
+static void formatGlPauseTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glPauseTransformFeedback(" << ");";
 }
 
 void CallLogWrapper::glPauseTransformFeedback (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPauseTransformFeedback(" << ");" << TestLog::EndMessage;
 	m_gl.pauseTransformFeedback();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPauseTransformFeedback) << CallTrace::EndRecord;
+}
+
+static void formatGlPixelStoref (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glPixelStoref(" << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glPixelStoref (glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPixelStoref(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.pixelStoref(pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPixelStoref) << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlPixelStorei (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glPixelStorei (glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.pixelStorei(pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPixelStorei) << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlPointParameterf (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glPointParameterf(" << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glPointParameterf (glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPointParameterf(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.pointParameterf(pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPointParameterf) << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlPointParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLfloat *params = trace.get<const glw::GLfloat *>();
+	str << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glPointParameterfv (glw::GLenum pname, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.pointParameterfv(pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPointParameterfv) << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlPointParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glPointParameteri(" << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glPointParameteri (glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPointParameteri(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.pointParameteri(pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPointParameteri) << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlPointParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glPointParameteriv (glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.pointParameteriv(pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPointParameteriv) << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlPointSize (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat size = trace.get<glw::GLfloat>();
+	str << "glPointSize(" << size << ");";
 }
 
 void CallLogWrapper::glPointSize (glw::GLfloat size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPointSize(" << size << ");" << TestLog::EndMessage;
 	m_gl.pointSize(size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPointSize) << size << CallTrace::EndRecord;
+}
+
+static void formatGlPolygonMode (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum face = trace.get<glw::GLenum>();
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");";
 }
 
 void CallLogWrapper::glPolygonMode (glw::GLenum face, glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");" << TestLog::EndMessage;
 	m_gl.polygonMode(face, mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPolygonMode) << face << mode << CallTrace::EndRecord;
+}
+
+static void formatGlPolygonOffset (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat factor = trace.get<glw::GLfloat>();
+	glw::GLfloat units = trace.get<glw::GLfloat>();
+	str << "glPolygonOffset(" << factor << ", " << units << ");";
 }
 
 void CallLogWrapper::glPolygonOffset (glw::GLfloat factor, glw::GLfloat units)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPolygonOffset(" << factor << ", " << units << ");" << TestLog::EndMessage;
 	m_gl.polygonOffset(factor, units);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPolygonOffset) << factor << units << CallTrace::EndRecord;
+}
+
+static void formatGlPopDebugGroup (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glPopDebugGroup(" << ");";
 }
 
 void CallLogWrapper::glPopDebugGroup (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPopDebugGroup(" << ");" << TestLog::EndMessage;
 	m_gl.popDebugGroup();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPopDebugGroup) << CallTrace::EndRecord;
+}
+
+static void formatGlPopGroupMarkerEXT (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glPopGroupMarkerEXT(" << ");";
 }
 
 void CallLogWrapper::glPopGroupMarkerEXT (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPopGroupMarkerEXT(" << ");" << TestLog::EndMessage;
 	m_gl.popGroupMarkerEXT();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPopGroupMarkerEXT) << CallTrace::EndRecord;
+}
+
+static void formatGlPrimitiveBoundingBox (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat minX = trace.get<glw::GLfloat>();
+	glw::GLfloat minY = trace.get<glw::GLfloat>();
+	glw::GLfloat minZ = trace.get<glw::GLfloat>();
+	glw::GLfloat minW = trace.get<glw::GLfloat>();
+	glw::GLfloat maxX = trace.get<glw::GLfloat>();
+	glw::GLfloat maxY = trace.get<glw::GLfloat>();
+	glw::GLfloat maxZ = trace.get<glw::GLfloat>();
+	glw::GLfloat maxW = trace.get<glw::GLfloat>();
+	str << "glPrimitiveBoundingBox(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");";
 }
 
 void CallLogWrapper::glPrimitiveBoundingBox (glw::GLfloat minX, glw::GLfloat minY, glw::GLfloat minZ, glw::GLfloat minW, glw::GLfloat maxX, glw::GLfloat maxY, glw::GLfloat maxZ, glw::GLfloat maxW)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPrimitiveBoundingBox(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");" << TestLog::EndMessage;
 	m_gl.primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPrimitiveBoundingBox) << minX << minY << minZ << minW << maxX << maxY << maxZ << maxW << CallTrace::EndRecord;
+}
+
+static void formatGlPrimitiveRestartIndex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	str << "glPrimitiveRestartIndex(" << index << ");";
 }
 
 void CallLogWrapper::glPrimitiveRestartIndex (glw::GLuint index)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPrimitiveRestartIndex(" << index << ");" << TestLog::EndMessage;
 	m_gl.primitiveRestartIndex(index);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPrimitiveRestartIndex) << index << CallTrace::EndRecord;
+}
+
+static void formatGlProgramBinary (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum binaryFormat = trace.get<glw::GLenum>();
+	const void *binary = trace.get<const void *>();
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	str << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << binary << ", " << length << ");";
 }
 
 void CallLogWrapper::glProgramBinary (glw::GLuint program, glw::GLenum binaryFormat, const void *binary, glw::GLsizei length)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
 	m_gl.programBinary(program, binaryFormat, binary, length);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramBinary) << program << binaryFormat << binary << length << CallTrace::EndRecord;
+}
+
+static void formatGlProgramParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint value = trace.get<glw::GLint>();
+	str << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");";
 }
 
 void CallLogWrapper::glProgramParameteri (glw::GLuint program, glw::GLenum pname, glw::GLint value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
 	m_gl.programParameteri(program, pname, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramParameteri) << program << pname << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble v0 = trace.get<glw::GLdouble>();
+	str << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glProgramUniform1d (glw::GLuint program, glw::GLint location, glw::GLdouble v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.programUniform1d(program, location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1d) << program << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniform1dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniform1dv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1dv) << program << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	str << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glProgramUniform1f (glw::GLuint program, glw::GLint location, glw::GLfloat v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.programUniform1f(program, location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1f) << program << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform1fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform1fv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1fv) << program << location << count << traceArray(value, (count * 1)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	str << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glProgramUniform1i (glw::GLuint program, glw::GLint location, glw::GLint v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.programUniform1i(program, location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1i) << program << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform1iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform1iv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1iv) << program << location << count << traceArray(value, (count * 1)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	str << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glProgramUniform1ui (glw::GLuint program, glw::GLint location, glw::GLuint v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.programUniform1ui(program, location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1ui) << program << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform1uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform1uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform1uiv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform1uiv) << program << location << count << traceArray(value, (count * 1)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble v0 = trace.get<glw::GLdouble>();
+	glw::GLdouble v1 = trace.get<glw::GLdouble>();
+	str << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glProgramUniform2d (glw::GLuint program, glw::GLint location, glw::GLdouble v0, glw::GLdouble v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.programUniform2d(program, location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2d) << program << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniform2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniform2dv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2dv) << program << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	glw::GLfloat v1 = trace.get<glw::GLfloat>();
+	str << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glProgramUniform2f (glw::GLuint program, glw::GLint location, glw::GLfloat v0, glw::GLfloat v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.programUniform2f(program, location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2f) << program << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform2fv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2fv) << program << location << count << traceArray(value, (count * 2)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	glw::GLint v1 = trace.get<glw::GLint>();
+	str << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glProgramUniform2i (glw::GLuint program, glw::GLint location, glw::GLint v0, glw::GLint v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.programUniform2i(program, location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2i) << program << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform2iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform2iv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2iv) << program << location << count << traceArray(value, (count * 2)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	glw::GLuint v1 = trace.get<glw::GLuint>();
+	str << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glProgramUniform2ui (glw::GLuint program, glw::GLint location, glw::GLuint v0, glw::GLuint v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.programUniform2ui(program, location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2ui) << program << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform2uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform2uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform2uiv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform2uiv) << program << location << count << traceArray(value, (count * 2)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble v0 = trace.get<glw::GLdouble>();
+	glw::GLdouble v1 = trace.get<glw::GLdouble>();
+	glw::GLdouble v2 = trace.get<glw::GLdouble>();
+	str << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glProgramUniform3d (glw::GLuint program, glw::GLint location, glw::GLdouble v0, glw::GLdouble v1, glw::GLdouble v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.programUniform3d(program, location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3d) << program << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniform3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniform3dv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3dv) << program << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	glw::GLfloat v1 = trace.get<glw::GLfloat>();
+	glw::GLfloat v2 = trace.get<glw::GLfloat>();
+	str << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glProgramUniform3f (glw::GLuint program, glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.programUniform3f(program, location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3f) << program << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform3fv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3fv) << program << location << count << traceArray(value, (count * 3)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	glw::GLint v1 = trace.get<glw::GLint>();
+	glw::GLint v2 = trace.get<glw::GLint>();
+	str << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glProgramUniform3i (glw::GLuint program, glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.programUniform3i(program, location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3i) << program << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform3iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform3iv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3iv) << program << location << count << traceArray(value, (count * 3)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	glw::GLuint v1 = trace.get<glw::GLuint>();
+	glw::GLuint v2 = trace.get<glw::GLuint>();
+	str << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glProgramUniform3ui (glw::GLuint program, glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.programUniform3ui(program, location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3ui) << program << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform3uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform3uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform3uiv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform3uiv) << program << location << count << traceArray(value, (count * 3)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble v0 = trace.get<glw::GLdouble>();
+	glw::GLdouble v1 = trace.get<glw::GLdouble>();
+	glw::GLdouble v2 = trace.get<glw::GLdouble>();
+	glw::GLdouble v3 = trace.get<glw::GLdouble>();
+	str << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glProgramUniform4d (glw::GLuint program, glw::GLint location, glw::GLdouble v0, glw::GLdouble v1, glw::GLdouble v2, glw::GLdouble v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.programUniform4d(program, location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4d) << program << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniform4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniform4dv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4dv) << program << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	glw::GLfloat v1 = trace.get<glw::GLfloat>();
+	glw::GLfloat v2 = trace.get<glw::GLfloat>();
+	glw::GLfloat v3 = trace.get<glw::GLfloat>();
+	str << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glProgramUniform4f (glw::GLuint program, glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2, glw::GLfloat v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.programUniform4f(program, location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4f) << program << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform4fv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4fv) << program << location << count << traceArray(value, (count * 4)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	glw::GLint v1 = trace.get<glw::GLint>();
+	glw::GLint v2 = trace.get<glw::GLint>();
+	glw::GLint v3 = trace.get<glw::GLint>();
+	str << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glProgramUniform4i (glw::GLuint program, glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2, glw::GLint v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.programUniform4i(program, location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4i) << program << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform4iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform4iv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4iv) << program << location << count << traceArray(value, (count * 4)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	glw::GLuint v1 = trace.get<glw::GLuint>();
+	glw::GLuint v2 = trace.get<glw::GLuint>();
+	glw::GLuint v3 = trace.get<glw::GLuint>();
+	str << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glProgramUniform4ui (glw::GLuint program, glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2, glw::GLuint v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.programUniform4ui(program, location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4ui) << program << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniform4uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniform4uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
 	m_gl.programUniform4uiv(program, location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniform4uiv) << program << location << count << traceArray(value, (count * 4)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix2dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix2dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix2fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix2fv) << program << location << count << transpose << traceArray(value, (count * 2*2)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix2x3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix2x3dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix2x3dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix2x3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix2x3fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix2x3fv) << program << location << count << transpose << traceArray(value, (count * 2*3)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix2x4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix2x4dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix2x4dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix2x4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix2x4fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix2x4fv) << program << location << count << transpose << traceArray(value, (count * 2*4)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix3dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix3dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix3fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix3fv) << program << location << count << transpose << traceArray(value, (count * 3*3)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix3x2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix3x2dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix3x2dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix3x2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix3x2fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix3x2fv) << program << location << count << transpose << traceArray(value, (count * 3*2)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix3x4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix3x4dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix3x4dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix3x4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix3x4fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix3x4fv) << program << location << count << transpose << traceArray(value, (count * 3*4)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix4dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix4dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix4fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix4fv) << program << location << count << transpose << traceArray(value, (count * 4*4)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix4x2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix4x2dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix4x2dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix4x2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix4x2fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix4x2fv) << program << location << count << transpose << traceArray(value, (count * 4*2)) << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix4x3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix4x3dv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix4x3dv) << program << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlProgramUniformMatrix4x3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
 	m_gl.programUniformMatrix4x3fv(program, location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProgramUniformMatrix4x3fv) << program << location << count << transpose << traceArray(value, (count * 4*3)) << CallTrace::EndRecord;
+}
+
+static void formatGlProvokingVertex (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum mode = trace.get<glw::GLenum>();
+	str << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");";
 }
 
 void CallLogWrapper::glProvokingVertex (glw::GLenum mode)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");" << TestLog::EndMessage;
 	m_gl.provokingVertex(mode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlProvokingVertex) << mode << CallTrace::EndRecord;
+}
+
+static void formatGlPushClientAttribDefaultEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLbitfield mask = trace.get<glw::GLbitfield>();
+	str << "glPushClientAttribDefaultEXT(" << toHex(mask) << ");";
 }
 
 void CallLogWrapper::glPushClientAttribDefaultEXT (glw::GLbitfield mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPushClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
 	m_gl.pushClientAttribDefaultEXT(mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPushClientAttribDefaultEXT) << mask << CallTrace::EndRecord;
+}
+
+static void formatGlPushDebugGroup (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum source = trace.get<glw::GLenum>();
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	const char* messageData = trace.getString();
+	str << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << getStringStr(messageData) << ");";
 }
 
 void CallLogWrapper::glPushDebugGroup (glw::GLenum source, glw::GLuint id, glw::GLsizei length, const glw::GLchar *message)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << getStringStr(message) << ");" << TestLog::EndMessage;
 	m_gl.pushDebugGroup(source, id, length, message);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPushDebugGroup) << source << id << length << traceString(message) << CallTrace::EndRecord;
+}
+
+static void formatGlPushGroupMarkerEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	const char* markerData = trace.getString();
+	str << "glPushGroupMarkerEXT(" << length << ", " << getStringStr(markerData) << ");";
 }
 
 void CallLogWrapper::glPushGroupMarkerEXT (glw::GLsizei length, const glw::GLchar *marker)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glPushGroupMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
 	m_gl.pushGroupMarkerEXT(length, marker);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlPushGroupMarkerEXT) << length << traceString(marker) << CallTrace::EndRecord;
+}
+
+static void formatGlQueryCounter (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint id = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	str << "glQueryCounter(" << id << ", " << toHex(target) << ");";
 }
 
 void CallLogWrapper::glQueryCounter (glw::GLuint id, glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glQueryCounter(" << id << ", " << toHex(target) << ");" << TestLog::EndMessage;
 	m_gl.queryCounter(id, target);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlQueryCounter) << id << target << CallTrace::EndRecord;
+}
+
+static void formatGlReadBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum src = trace.get<glw::GLenum>();
+	str << "glReadBuffer(" << getDrawReadBufferStr(src) << ");";
 }
 
 void CallLogWrapper::glReadBuffer (glw::GLenum src)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glReadBuffer(" << getDrawReadBufferStr(src) << ");" << TestLog::EndMessage;
 	m_gl.readBuffer(src);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlReadBuffer) << src << CallTrace::EndRecord;
+}
+
+static void formatGlReadPixels (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	void *pixels = trace.get<void *>();
+	str << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glReadPixels (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.readPixels(x, y, width, height, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlReadPixels) << x << y << width << height << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlReadnPixels (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei bufSize = trace.get<glw::GLsizei>();
+	void *data = trace.get<void *>();
+	str << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << data << ");";
 }
 
 void CallLogWrapper::glReadnPixels (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *data)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << data << ");" << TestLog::EndMessage;
 	m_gl.readnPixels(x, y, width, height, format, type, bufSize, data);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlReadnPixels) << x << y << width << height << format << type << bufSize << data << CallTrace::EndRecord;
+}
+
+static void formatGlReleaseShaderCompiler (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glReleaseShaderCompiler(" << ");";
 }
 
 void CallLogWrapper::glReleaseShaderCompiler (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glReleaseShaderCompiler(" << ");" << TestLog::EndMessage;
 	m_gl.releaseShaderCompiler();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlReleaseShaderCompiler) << CallTrace::EndRecord;
+}
+
+static void formatGlRenderbufferStorage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glRenderbufferStorage (glw::GLenum target, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.renderbufferStorage(target, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlRenderbufferStorage) << target << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlRenderbufferStorageMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glRenderbufferStorageMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.renderbufferStorageMultisample(target, samples, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlRenderbufferStorageMultisample) << target << samples << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlResumeTransformFeedback (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glResumeTransformFeedback(" << ");";
 }
 
 void CallLogWrapper::glResumeTransformFeedback (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glResumeTransformFeedback(" << ");" << TestLog::EndMessage;
 	m_gl.resumeTransformFeedback();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlResumeTransformFeedback) << CallTrace::EndRecord;
+}
+
+static void formatGlSampleCoverage (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLfloat value = trace.get<glw::GLfloat>();
+	glw::GLboolean invert = trace.get<glw::GLboolean>();
+	str << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");";
 }
 
 void CallLogWrapper::glSampleCoverage (glw::GLfloat value, glw::GLboolean invert)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");" << TestLog::EndMessage;
 	m_gl.sampleCoverage(value, invert);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSampleCoverage) << value << invert << CallTrace::EndRecord;
+}
+
+static void formatGlSampleMaski (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint maskNumber = trace.get<glw::GLuint>();
+	glw::GLbitfield mask = trace.get<glw::GLbitfield>();
+	str << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");";
 }
 
 void CallLogWrapper::glSampleMaski (glw::GLuint maskNumber, glw::GLbitfield mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");" << TestLog::EndMessage;
 	m_gl.sampleMaski(maskNumber, mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSampleMaski) << maskNumber << mask << CallTrace::EndRecord;
+}
+
+static void formatGlSamplerParameterIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramData = trace.getArray<glw::GLint>();
+	str << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramData.arr, paramData.size) << ");";
 }
 
 void CallLogWrapper::glSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pname, const glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.samplerParameterIiv(sampler, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSamplerParameterIiv) << sampler << pname << traceArray(param, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlSamplerParameterIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLuint> paramData = trace.getArray<glw::GLuint>();
+	str << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramData.arr, paramData.size) << ");";
 }
 
 void CallLogWrapper::glSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum pname, const glw::GLuint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.samplerParameterIuiv(sampler, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSamplerParameterIuiv) << sampler << pname << traceArray(param, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlSamplerParameterf (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glSamplerParameterf (glw::GLuint sampler, glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.samplerParameterf(sampler, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSamplerParameterf) << sampler << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlSamplerParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> paramData = trace.getArray<glw::GLfloat>();
+	str << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramData.arr, paramData.size) << ");";
 }
 
 void CallLogWrapper::glSamplerParameterfv (glw::GLuint sampler, glw::GLenum pname, const glw::GLfloat *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.samplerParameterfv(sampler, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSamplerParameterfv) << sampler << pname << traceArray(param, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlSamplerParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");";
 }
 
 void CallLogWrapper::glSamplerParameteri (glw::GLuint sampler, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
 	m_gl.samplerParameteri(sampler, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSamplerParameteri) << sampler << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlSamplerParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint sampler = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramData = trace.getArray<glw::GLint>();
+	str << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramData.arr, paramData.size) << ");";
 }
 
 void CallLogWrapper::glSamplerParameteriv (glw::GLuint sampler, glw::GLenum pname, const glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.samplerParameteriv(sampler, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlSamplerParameteriv) << sampler << pname << traceArray(param, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlScissor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glScissor (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.scissor(x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlScissor) << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlScissorArrayv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLint *v = trace.get<const glw::GLint *>();
+	str << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glScissorArrayv (glw::GLuint first, glw::GLsizei count, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.scissorArrayv(first, count, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlScissorArrayv) << first << count << v << CallTrace::EndRecord;
+}
+
+static void formatGlScissorIndexed (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint left = trace.get<glw::GLint>();
+	glw::GLint bottom = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glScissorIndexed (glw::GLuint index, glw::GLint left, glw::GLint bottom, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.scissorIndexed(index, left, bottom, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlScissorIndexed) << index << left << bottom << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlScissorIndexedv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLint *v = trace.get<const glw::GLint *>();
+	str << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glScissorIndexedv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.scissorIndexedv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlScissorIndexedv) << index << v << CallTrace::EndRecord;
+}
+
+static void formatGlShaderBinary (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *shaders = trace.get<const glw::GLuint *>();
+	glw::GLenum binaryformat = trace.get<glw::GLenum>();
+	const void *binary = trace.get<const void *>();
+	glw::GLsizei length = trace.get<glw::GLsizei>();
+	str << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << binary << ", " << length << ");";
 }
 
 void CallLogWrapper::glShaderBinary (glw::GLsizei count, const glw::GLuint *shaders, glw::GLenum binaryformat, const void *binary, glw::GLsizei length)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
 	m_gl.shaderBinary(count, shaders, binaryformat, binary, length);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlShaderBinary) << count << shaders << binaryformat << binary << length << CallTrace::EndRecord;
+}
+
+static void formatGlShaderSource (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint shader = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLchar *const*string = trace.get<const glw::GLchar *const*>();
+	const glw::GLint *length = trace.get<const glw::GLint *>();
+	str << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");";
 }
 
 void CallLogWrapper::glShaderSource (glw::GLuint shader, glw::GLsizei count, const glw::GLchar *const*string, const glw::GLint *length)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");" << TestLog::EndMessage;
 	m_gl.shaderSource(shader, count, string, length);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlShaderSource) << shader << count << string << length << CallTrace::EndRecord;
+}
+
+static void formatGlShaderStorageBlockBinding (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint storageBlockIndex = trace.get<glw::GLuint>();
+	glw::GLuint storageBlockBinding = trace.get<glw::GLuint>();
+	str << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");";
 }
 
 void CallLogWrapper::glShaderStorageBlockBinding (glw::GLuint program, glw::GLuint storageBlockIndex, glw::GLuint storageBlockBinding)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");" << TestLog::EndMessage;
 	m_gl.shaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlShaderStorageBlockBinding) << program << storageBlockIndex << storageBlockBinding << CallTrace::EndRecord;
+}
+
+static void formatGlStencilFunc (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum func = trace.get<glw::GLenum>();
+	glw::GLint ref = trace.get<glw::GLint>();
+	glw::GLuint mask = trace.get<glw::GLuint>();
+	str << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");";
 }
 
 void CallLogWrapper::glStencilFunc (glw::GLenum func, glw::GLint ref, glw::GLuint mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
 	m_gl.stencilFunc(func, ref, mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlStencilFunc) << func << ref << mask << CallTrace::EndRecord;
+}
+
+static void formatGlStencilFuncSeparate (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum face = trace.get<glw::GLenum>();
+	glw::GLenum func = trace.get<glw::GLenum>();
+	glw::GLint ref = trace.get<glw::GLint>();
+	glw::GLuint mask = trace.get<glw::GLuint>();
+	str << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");";
 }
 
 void CallLogWrapper::glStencilFuncSeparate (glw::GLenum face, glw::GLenum func, glw::GLint ref, glw::GLuint mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
 	m_gl.stencilFuncSeparate(face, func, ref, mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlStencilFuncSeparate) << face << func << ref << mask << CallTrace::EndRecord;
+}
+
+static void formatGlStencilMask (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint mask = trace.get<glw::GLuint>();
+	str << "glStencilMask(" << mask << ");";
 }
 
 void CallLogWrapper::glStencilMask (glw::GLuint mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glStencilMask(" << mask << ");" << TestLog::EndMessage;
 	m_gl.stencilMask(mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlStencilMask) << mask << CallTrace::EndRecord;
+}
+
+static void formatGlStencilMaskSeparate (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum face = trace.get<glw::GLenum>();
+	glw::GLuint mask = trace.get<glw::GLuint>();
+	str << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");";
 }
 
 void CallLogWrapper::glStencilMaskSeparate (glw::GLenum face, glw::GLuint mask)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");" << TestLog::EndMessage;
 	m_gl.stencilMaskSeparate(face, mask);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlStencilMaskSeparate) << face << mask << CallTrace::EndRecord;
+}
+
+static void formatGlStencilOp (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum fail = trace.get<glw::GLenum>();
+	glw::GLenum zfail = trace.get<glw::GLenum>();
+	glw::GLenum zpass = trace.get<glw::GLenum>();
+	str << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");";
 }
 
 void CallLogWrapper::glStencilOp (glw::GLenum fail, glw::GLenum zfail, glw::GLenum zpass)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");" << TestLog::EndMessage;
 	m_gl.stencilOp(fail, zfail, zpass);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlStencilOp) << fail << zfail << zpass << CallTrace::EndRecord;
+}
+
+static void formatGlStencilOpSeparate (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum face = trace.get<glw::GLenum>();
+	glw::GLenum sfail = trace.get<glw::GLenum>();
+	glw::GLenum dpfail = trace.get<glw::GLenum>();
+	glw::GLenum dppass = trace.get<glw::GLenum>();
+	str << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");";
 }
 
 void CallLogWrapper::glStencilOpSeparate (glw::GLenum face, glw::GLenum sfail, glw::GLenum dpfail, glw::GLenum dppass)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");" << TestLog::EndMessage;
 	m_gl.stencilOpSeparate(face, sfail, dpfail, dppass);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlStencilOpSeparate) << face << sfail << dpfail << dppass << CallTrace::EndRecord;
+}
+
+static void formatGlTexBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glTexBuffer (glw::GLenum target, glw::GLenum internalformat, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.texBuffer(target, internalformat, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexBuffer) << target << internalformat << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlTexBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");";
 }
 
 void CallLogWrapper::glTexBufferRange (glw::GLenum target, glw::GLenum internalformat, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.texBufferRange(target, internalformat, buffer, offset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexBufferRange) << target << internalformat << buffer << offset << size << CallTrace::EndRecord;
+}
+
+static void formatGlTexImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexImage1D (glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texImage1D(target, level, internalformat, width, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexImage1D) << target << level << internalformat << width << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexImage2D (glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexImage2D) << target << level << internalformat << width << height << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexImage2DMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLboolean fixedsamplelocations = trace.get<glw::GLboolean>();
+	str << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");";
 }
 
 void CallLogWrapper::glTexImage2DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLboolean fixedsamplelocations)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
 	m_gl.texImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexImage2DMultisample) << target << samples << internalformat << width << height << fixedsamplelocations << CallTrace::EndRecord;
+}
+
+static void formatGlTexImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexImage3D (glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexImage3D) << target << level << internalformat << width << height << depth << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexImage3DMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLboolean fixedsamplelocations = trace.get<glw::GLboolean>();
+	str << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");";
 }
 
 void CallLogWrapper::glTexImage3DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean fixedsamplelocations)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
 	m_gl.texImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexImage3DMultisample) << target << samples << internalformat << width << height << depth << fixedsamplelocations << CallTrace::EndRecord;
+}
+
+static void formatGlTexImage3DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexImage3DOES (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexImage3DOES) << target << level << internalformat << width << height << depth << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexPageCommitmentARB (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLboolean commit = trace.get<glw::GLboolean>();
+	str << "glTexPageCommitmentARB(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");";
 }
 
 void CallLogWrapper::glTexPageCommitmentARB (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean commit)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexPageCommitmentARB(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
 	m_gl.texPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexPageCommitmentARB) << target << level << xoffset << yoffset << zoffset << width << height << depth << commit << CallTrace::EndRecord;
+}
+
+static void formatGlTexParameterIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsData = trace.getArray<glw::GLint>();
+	str << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramsData.arr, paramsData.size) << ");";
 }
 
 void CallLogWrapper::glTexParameterIiv (glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.texParameterIiv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexParameterIiv) << target << pname << traceArray(params, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlTexParameterIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLuint> paramsData = trace.getArray<glw::GLuint>();
+	str << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramsData.arr, paramsData.size) << ");";
 }
 
 void CallLogWrapper::glTexParameterIuiv (glw::GLenum target, glw::GLenum pname, const glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.texParameterIuiv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexParameterIuiv) << target << pname << traceArray(params, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlTexParameterf (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glTexParameterf (glw::GLenum target, glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.texParameterf(target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexParameterf) << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlTexParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> paramsData = trace.getArray<glw::GLfloat>();
+	str << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramsData.arr, paramsData.size) << ");";
 }
 
 void CallLogWrapper::glTexParameterfv (glw::GLenum target, glw::GLenum pname, const glw::GLfloat *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.texParameterfv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexParameterfv) << target << pname << traceArray(params, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlTexParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");";
 }
 
 void CallLogWrapper::glTexParameteri (glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
 	m_gl.texParameteri(target, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexParameteri) << target << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlTexParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const tcu::Format::ArrayPointer<glw::GLint> paramsData = trace.getArray<glw::GLint>();
+	str << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(paramsData.arr, paramsData.size) << ");";
 }
 
 void CallLogWrapper::glTexParameteriv (glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
 	m_gl.texParameteriv(target, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexParameteriv) << target << pname << traceArray(params, getTextureParamNumArgs(pname)) << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
 }
 
 void CallLogWrapper::glTexStorage1D (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.texStorage1D(target, levels, internalformat, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage1D) << target << levels << internalformat << width << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glTexStorage1DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
 }
 
 void CallLogWrapper::glTexStorage1DEXT (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage1DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.texStorage1DEXT(target, levels, internalformat, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage1DEXT) << target << levels << internalformat << width << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glTexStorage2D (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.texStorage2D(target, levels, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage2D) << target << levels << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glTexStorage2DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glTexStorage2DEXT (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage2DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.texStorage2DEXT(target, levels, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage2DEXT) << target << levels << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage2DMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLboolean fixedsamplelocations = trace.get<glw::GLboolean>();
+	str << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");";
 }
 
 void CallLogWrapper::glTexStorage2DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLboolean fixedsamplelocations)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
 	m_gl.texStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage2DMultisample) << target << samples << internalformat << width << height << fixedsamplelocations << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	str << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
 }
 
 void CallLogWrapper::glTexStorage3D (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
 	m_gl.texStorage3D(target, levels, internalformat, width, height, depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage3D) << target << levels << internalformat << width << height << depth << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	str << "glTexStorage3DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
 }
 
 void CallLogWrapper::glTexStorage3DEXT (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage3DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
 	m_gl.texStorage3DEXT(target, levels, internalformat, width, height, depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage3DEXT) << target << levels << internalformat << width << height << depth << CallTrace::EndRecord;
+}
+
+static void formatGlTexStorage3DMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLboolean fixedsamplelocations = trace.get<glw::GLboolean>();
+	str << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");";
 }
 
 void CallLogWrapper::glTexStorage3DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean fixedsamplelocations)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
 	m_gl.texStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexStorage3DMultisample) << target << samples << internalformat << width << height << depth << fixedsamplelocations << CallTrace::EndRecord;
+}
+
+static void formatGlTexSubImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexSubImage1D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texSubImage1D(target, level, xoffset, width, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexSubImage1D) << target << level << xoffset << width << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexSubImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexSubImage2D) << target << level << xoffset << yoffset << width << height << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexSubImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexSubImage3D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexSubImage3D) << target << level << xoffset << yoffset << zoffset << width << height << depth << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexSubImage3DOES (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTexSubImage3DOES (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.texSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexSubImage3DOES) << target << level << xoffset << yoffset << zoffset << width << height << depth << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureBarrier (std::ostream& str, CallTraceReader& trace)
+{
+	DE_UNREF(trace);
+	str << "glTextureBarrier(" << ");";
 }
 
 void CallLogWrapper::glTextureBarrier (void)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureBarrier(" << ");" << TestLog::EndMessage;
 	m_gl.textureBarrier();
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureBarrier) << CallTrace::EndRecord;
+}
+
+static void formatGlTextureBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glTextureBuffer (glw::GLuint texture, glw::GLenum internalformat, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.textureBuffer(texture, internalformat, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureBuffer) << texture << internalformat << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlTextureBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");";
 }
 
 void CallLogWrapper::glTextureBufferRange (glw::GLuint texture, glw::GLenum internalformat, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.textureBufferRange(texture, internalformat, buffer, offset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureBufferRange) << texture << internalformat << buffer << offset << size << CallTrace::EndRecord;
+}
+
+static void formatGlTextureImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureImage1DEXT(texture, target, level, internalformat, width, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureImage1DEXT) << texture << target << level << internalformat << width << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureImage2DEXT(texture, target, level, internalformat, width, height, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureImage2DEXT) << texture << target << level << internalformat << width << height << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint internalformat = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLint border = trace.get<glw::GLint>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureImage3DEXT) << texture << target << level << internalformat << width << height << depth << border << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTexturePageCommitmentEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLboolean commit = trace.get<glw::GLboolean>();
+	str << "glTexturePageCommitmentEXT(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");";
 }
 
 void CallLogWrapper::glTexturePageCommitmentEXT (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean commit)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTexturePageCommitmentEXT(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
 	m_gl.texturePageCommitmentEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTexturePageCommitmentEXT) << texture << level << xoffset << yoffset << zoffset << width << height << depth << commit << CallTrace::EndRecord;
+}
+
+static void formatGlTextureParameterIiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *params = trace.get<const glw::GLint *>();
+	str << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glTextureParameterIiv (glw::GLuint texture, glw::GLenum pname, const glw::GLint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.textureParameterIiv(texture, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureParameterIiv) << texture << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlTextureParameterIuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLuint *params = trace.get<const glw::GLuint *>();
+	str << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
 }
 
 void CallLogWrapper::glTextureParameterIuiv (glw::GLuint texture, glw::GLenum pname, const glw::GLuint *params)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
 	m_gl.textureParameterIuiv(texture, pname, params);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureParameterIuiv) << texture << pname << params << CallTrace::EndRecord;
+}
+
+static void formatGlTextureParameterf (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLfloat param = trace.get<glw::GLfloat>();
+	str << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glTextureParameterf (glw::GLuint texture, glw::GLenum pname, glw::GLfloat param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.textureParameterf(texture, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureParameterf) << texture << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlTextureParameterfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLfloat *param = trace.get<const glw::GLfloat *>();
+	str << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glTextureParameterfv (glw::GLuint texture, glw::GLenum pname, const glw::GLfloat *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.textureParameterfv(texture, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureParameterfv) << texture << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlTextureParameteri (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	glw::GLint param = trace.get<glw::GLint>();
+	str << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");";
 }
 
 void CallLogWrapper::glTextureParameteri (glw::GLuint texture, glw::GLenum pname, glw::GLint param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
 	m_gl.textureParameteri(texture, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureParameteri) << texture << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlTextureParameteriv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum pname = trace.get<glw::GLenum>();
+	const glw::GLint *param = trace.get<const glw::GLint *>();
+	str << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
 }
 
 void CallLogWrapper::glTextureParameteriv (glw::GLuint texture, glw::GLenum pname, const glw::GLint *param)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
 	m_gl.textureParameteriv(texture, pname, param);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureParameteriv) << texture << pname << param << CallTrace::EndRecord;
+}
+
+static void formatGlTextureRenderbufferEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint renderbuffer = trace.get<glw::GLuint>();
+	str << "glTextureRenderbufferEXT(" << texture << ", " << toHex(target) << ", " << renderbuffer << ");";
 }
 
 void CallLogWrapper::glTextureRenderbufferEXT (glw::GLuint texture, glw::GLenum target, glw::GLuint renderbuffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureRenderbufferEXT(" << texture << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
 	m_gl.textureRenderbufferEXT(texture, target, renderbuffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureRenderbufferEXT) << texture << target << renderbuffer << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
 }
 
 void CallLogWrapper::glTextureStorage1D (glw::GLuint texture, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.textureStorage1D(texture, levels, internalformat, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage1D) << texture << levels << internalformat << width << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	str << "glTextureStorage1DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
 }
 
 void CallLogWrapper::glTextureStorage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage1DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
 	m_gl.textureStorage1DEXT(texture, target, levels, internalformat, width);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage1DEXT) << texture << target << levels << internalformat << width << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glTextureStorage2D (glw::GLuint texture, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.textureStorage2D(texture, levels, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage2D) << texture << levels << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glTextureStorage2DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glTextureStorage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage2DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.textureStorage2DEXT(texture, target, levels, internalformat, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage2DEXT) << texture << target << levels << internalformat << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage2DMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLboolean fixedsamplelocations = trace.get<glw::GLboolean>();
+	str << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");";
 }
 
 void CallLogWrapper::glTextureStorage2DMultisample (glw::GLuint texture, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLboolean fixedsamplelocations)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
 	m_gl.textureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage2DMultisample) << texture << samples << internalformat << width << height << fixedsamplelocations << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	str << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
 }
 
 void CallLogWrapper::glTextureStorage3D (glw::GLuint texture, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
 	m_gl.textureStorage3D(texture, levels, internalformat, width, height, depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage3D) << texture << levels << internalformat << width << height << depth << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLsizei levels = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	str << "glTextureStorage3DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
 }
 
 void CallLogWrapper::glTextureStorage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage3DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
 	m_gl.textureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage3DEXT) << texture << target << levels << internalformat << width << height << depth << CallTrace::EndRecord;
+}
+
+static void formatGlTextureStorage3DMultisample (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLsizei samples = trace.get<glw::GLsizei>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLboolean fixedsamplelocations = trace.get<glw::GLboolean>();
+	str << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");";
 }
 
 void CallLogWrapper::glTextureStorage3DMultisample (glw::GLuint texture, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean fixedsamplelocations)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
 	m_gl.textureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureStorage3DMultisample) << texture << samples << internalformat << width << height << depth << fixedsamplelocations << CallTrace::EndRecord;
+}
+
+static void formatGlTextureSubImage1D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureSubImage1D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureSubImage1D) << texture << level << xoffset << width << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureSubImage1DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureSubImage1DEXT(texture, target, level, xoffset, width, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureSubImage1DEXT) << texture << target << level << xoffset << width << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureSubImage2D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureSubImage2D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureSubImage2D) << texture << level << xoffset << yoffset << width << height << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureSubImage2DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureSubImage2DEXT) << texture << target << level << xoffset << yoffset << width << height << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureSubImage3D (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureSubImage3D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureSubImage3D) << texture << level << xoffset << yoffset << zoffset << width << height << depth << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureSubImage3DEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLint level = trace.get<glw::GLint>();
+	glw::GLint xoffset = trace.get<glw::GLint>();
+	glw::GLint yoffset = trace.get<glw::GLint>();
+	glw::GLint zoffset = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	glw::GLsizei depth = trace.get<glw::GLsizei>();
+	glw::GLenum format = trace.get<glw::GLenum>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	const void *pixels = trace.get<const void *>();
+	str << "glTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");";
 }
 
 void CallLogWrapper::glTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
 	m_gl.textureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureSubImage3DEXT) << texture << target << level << xoffset << yoffset << zoffset << width << height << depth << format << type << pixels << CallTrace::EndRecord;
+}
+
+static void formatGlTextureView (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint texture = trace.get<glw::GLuint>();
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLuint origtexture = trace.get<glw::GLuint>();
+	glw::GLenum internalformat = trace.get<glw::GLenum>();
+	glw::GLuint minlevel = trace.get<glw::GLuint>();
+	glw::GLuint numlevels = trace.get<glw::GLuint>();
+	glw::GLuint minlayer = trace.get<glw::GLuint>();
+	glw::GLuint numlayers = trace.get<glw::GLuint>();
+	str << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");";
 }
 
 void CallLogWrapper::glTextureView (glw::GLuint texture, glw::GLenum target, glw::GLuint origtexture, glw::GLenum internalformat, glw::GLuint minlevel, glw::GLuint numlevels, glw::GLuint minlayer, glw::GLuint numlayers)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");" << TestLog::EndMessage;
 	m_gl.textureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTextureView) << texture << target << origtexture << internalformat << minlevel << numlevels << minlayer << numlayers << CallTrace::EndRecord;
+}
+
+static void formatGlTransformFeedbackBufferBase (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint xfb = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glTransformFeedbackBufferBase (glw::GLuint xfb, glw::GLuint index, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.transformFeedbackBufferBase(xfb, index, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTransformFeedbackBufferBase) << xfb << index << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlTransformFeedbackBufferRange (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint xfb = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizeiptr size = trace.get<glw::GLsizeiptr>();
+	str << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");";
 }
 
 void CallLogWrapper::glTransformFeedbackBufferRange (glw::GLuint xfb, glw::GLuint index, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
 	m_gl.transformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTransformFeedbackBufferRange) << xfb << index << buffer << offset << size << CallTrace::EndRecord;
+}
+
+static void formatGlTransformFeedbackVaryings (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLchar *const*varyings = trace.get<const glw::GLchar *const*>();
+	glw::GLenum bufferMode = trace.get<glw::GLenum>();
+	str << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");";
 }
 
 void CallLogWrapper::glTransformFeedbackVaryings (glw::GLuint program, glw::GLsizei count, const glw::GLchar *const*varyings, glw::GLenum bufferMode)
 {
-	if (m_enableLog)
-		m_log << TestLog::Message << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");" << TestLog::EndMessage;
-	m_gl.transformFeedbackVaryings(program, count, varyings, bufferMode);
+	if (m_enableLog && !m_callTrace)
+		m_log << TestLog::Message << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");" << TestLog::EndMessage;
+	m_gl.transformFeedbackVaryings(program, count, varyings, bufferMode);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlTransformFeedbackVaryings) << program << count << varyings << bufferMode << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	str << "glUniform1d(" << location << ", " << x << ");";
 }
 
 void CallLogWrapper::glUniform1d (glw::GLint location, glw::GLdouble x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1d(" << location << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.uniform1d(location, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1d) << location << x << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniform1dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniform1dv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1dv) << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	str << "glUniform1f(" << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glUniform1f (glw::GLint location, glw::GLfloat v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1f(" << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.uniform1f(location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1f) << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniform1fv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform1fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
 	m_gl.uniform1fv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1fv) << location << count << traceArray(value, (count * 1)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	str << "glUniform1i(" << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glUniform1i (glw::GLint location, glw::GLint v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1i(" << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.uniform1i(location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1i) << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glUniform1iv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform1iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
 	m_gl.uniform1iv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1iv) << location << count << traceArray(value, (count * 1)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	str << "glUniform1ui(" << location << ", " << v0 << ");";
 }
 
 void CallLogWrapper::glUniform1ui (glw::GLint location, glw::GLuint v0)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1ui(" << location << ", " << v0 << ");" << TestLog::EndMessage;
 	m_gl.uniform1ui(location, v0);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1ui) << location << v0 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform1uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glUniform1uiv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform1uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform1uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
 	m_gl.uniform1uiv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform1uiv) << location << count << traceArray(value, (count * 1)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	str << "glUniform2d(" << location << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glUniform2d (glw::GLint location, glw::GLdouble x, glw::GLdouble y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2d(" << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.uniform2d(location, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2d) << location << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniform2dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniform2dv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2dv) << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	glw::GLfloat v1 = trace.get<glw::GLfloat>();
+	str << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glUniform2f (glw::GLint location, glw::GLfloat v0, glw::GLfloat v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.uniform2f(location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2f) << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniform2fv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform2fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
 	m_gl.uniform2fv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2fv) << location << count << traceArray(value, (count * 2)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	glw::GLint v1 = trace.get<glw::GLint>();
+	str << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glUniform2i (glw::GLint location, glw::GLint v0, glw::GLint v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.uniform2i(location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2i) << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glUniform2iv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform2iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
 	m_gl.uniform2iv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2iv) << location << count << traceArray(value, (count * 2)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	glw::GLuint v1 = trace.get<glw::GLuint>();
+	str << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");";
 }
 
 void CallLogWrapper::glUniform2ui (glw::GLint location, glw::GLuint v0, glw::GLuint v1)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
 	m_gl.uniform2ui(location, v0, v1);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2ui) << location << v0 << v1 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform2uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glUniform2uiv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform2uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform2uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
 	m_gl.uniform2uiv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform2uiv) << location << count << traceArray(value, (count * 2)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	str << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glUniform3d (glw::GLint location, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.uniform3d(location, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3d) << location << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniform3dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniform3dv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3dv) << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	glw::GLfloat v1 = trace.get<glw::GLfloat>();
+	glw::GLfloat v2 = trace.get<glw::GLfloat>();
+	str << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glUniform3f (glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.uniform3f(location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3f) << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniform3fv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform3fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
 	m_gl.uniform3fv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3fv) << location << count << traceArray(value, (count * 3)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	glw::GLint v1 = trace.get<glw::GLint>();
+	glw::GLint v2 = trace.get<glw::GLint>();
+	str << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glUniform3i (glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.uniform3i(location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3i) << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glUniform3iv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform3iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
 	m_gl.uniform3iv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3iv) << location << count << traceArray(value, (count * 3)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	glw::GLuint v1 = trace.get<glw::GLuint>();
+	glw::GLuint v2 = trace.get<glw::GLuint>();
+	str << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
 }
 
 void CallLogWrapper::glUniform3ui (glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
 	m_gl.uniform3ui(location, v0, v1, v2);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3ui) << location << v0 << v1 << v2 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform3uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glUniform3uiv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform3uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform3uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
 	m_gl.uniform3uiv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform3uiv) << location << count << traceArray(value, (count * 3)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	glw::GLdouble w = trace.get<glw::GLdouble>();
+	str << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glUniform4d (glw::GLint location, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.uniform4d(location, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4d) << location << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniform4dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniform4dv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4dv) << location << count << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLfloat v0 = trace.get<glw::GLfloat>();
+	glw::GLfloat v1 = trace.get<glw::GLfloat>();
+	glw::GLfloat v2 = trace.get<glw::GLfloat>();
+	glw::GLfloat v3 = trace.get<glw::GLfloat>();
+	str << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glUniform4f (glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2, glw::GLfloat v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.uniform4f(location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4f) << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniform4fv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform4fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
 	m_gl.uniform4fv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4fv) << location << count << traceArray(value, (count * 4)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLint v0 = trace.get<glw::GLint>();
+	glw::GLint v1 = trace.get<glw::GLint>();
+	glw::GLint v2 = trace.get<glw::GLint>();
+	glw::GLint v3 = trace.get<glw::GLint>();
+	str << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glUniform4i (glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2, glw::GLint v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.uniform4i(location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4i) << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLint> valueData = trace.getArray<glw::GLint>();
+	str << "glUniform4iv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform4iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
 	m_gl.uniform4iv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4iv) << location << count << traceArray(value, (count * 4)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLuint v0 = trace.get<glw::GLuint>();
+	glw::GLuint v1 = trace.get<glw::GLuint>();
+	glw::GLuint v2 = trace.get<glw::GLuint>();
+	glw::GLuint v3 = trace.get<glw::GLuint>();
+	str << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
 }
 
 void CallLogWrapper::glUniform4ui (glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2, glw::GLuint v3)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
 	m_gl.uniform4ui(location, v0, v1, v2, v3);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4ui) << location << v0 << v1 << v2 << v3 << CallTrace::EndRecord;
+}
+
+static void formatGlUniform4uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const tcu::Format::ArrayPointer<glw::GLuint> valueData = trace.getArray<glw::GLuint>();
+	str << "glUniform4uiv(" << location << ", " << count << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniform4uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniform4uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
 	m_gl.uniform4uiv(location, count, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniform4uiv) << location << count << traceArray(value, (count * 4)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformBlockBinding (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	glw::GLuint uniformBlockIndex = trace.get<glw::GLuint>();
+	glw::GLuint uniformBlockBinding = trace.get<glw::GLuint>();
+	str << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");";
 }
 
 void CallLogWrapper::glUniformBlockBinding (glw::GLuint program, glw::GLuint uniformBlockIndex, glw::GLuint uniformBlockBinding)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");" << TestLog::EndMessage;
 	m_gl.uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformBlockBinding) << program << uniformBlockIndex << uniformBlockBinding << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix2dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix2dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix2dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix2fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix2fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix2fv) << location << count << transpose << traceArray(value, (count * 2*2)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix2x3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix2x3dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix2x3dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix2x3dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix2x3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix2x3fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix2x3fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix2x3fv) << location << count << transpose << traceArray(value, (count * 2*3)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix2x4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix2x4dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix2x4dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix2x4dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix2x4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix2x4fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix2x4fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix2x4fv) << location << count << transpose << traceArray(value, (count * 2*4)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix3dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix3dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix3dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix3fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix3fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix3fv) << location << count << transpose << traceArray(value, (count * 3*3)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix3x2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix3x2dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix3x2dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix3x2dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix3x2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix3x2fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix3x2fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix3x2fv) << location << count << transpose << traceArray(value, (count * 3*2)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix3x4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix3x4dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix3x4dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix3x4dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix3x4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix3x4fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix3x4fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix3x4fv) << location << count << transpose << traceArray(value, (count * 3*4)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix4dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix4dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix4dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix4fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix4fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix4fv) << location << count << transpose << traceArray(value, (count * 4*4)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix4x2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix4x2dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix4x2dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix4x2dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix4x2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix4x2fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix4x2fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix4x2fv) << location << count << transpose << traceArray(value, (count * 4*2)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix4x3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const glw::GLdouble *value = trace.get<const glw::GLdouble *>();
+	str << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix4x3dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix4x3dv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix4x3dv) << location << count << transpose << value << CallTrace::EndRecord;
+}
+
+static void formatGlUniformMatrix4x3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint location = trace.get<glw::GLint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	glw::GLboolean transpose = trace.get<glw::GLboolean>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> valueData = trace.getArray<glw::GLfloat>();
+	str << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(valueData.arr, valueData.size) << ");";
 }
 
 void CallLogWrapper::glUniformMatrix4x3fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
 	m_gl.uniformMatrix4x3fv(location, count, transpose, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformMatrix4x3fv) << location << count << transpose << traceArray(value, (count * 4*3)) << CallTrace::EndRecord;
+}
+
+static void formatGlUniformSubroutinesuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum shadertype = trace.get<glw::GLenum>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *indices = trace.get<const glw::GLuint *>();
+	str << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");";
 }
 
 void CallLogWrapper::glUniformSubroutinesuiv (glw::GLenum shadertype, glw::GLsizei count, const glw::GLuint *indices)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");" << TestLog::EndMessage;
 	m_gl.uniformSubroutinesuiv(shadertype, count, indices);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUniformSubroutinesuiv) << shadertype << count << indices << CallTrace::EndRecord;
+}
+
+static void formatGlUnmapBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLenum target = trace.get<glw::GLenum>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glUnmapBuffer(" << getBufferTargetStr(target) << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
 }
 
 glw::GLboolean CallLogWrapper::glUnmapBuffer (glw::GLenum target)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUnmapBuffer(" << getBufferTargetStr(target) << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.unmapBuffer(target);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUnmapBuffer) << target << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlUnmapNamedBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLboolean returnValue = trace.get<glw::GLboolean>();
+	str << "glUnmapNamedBuffer(" << buffer << ");";
+	str << "\n// " << getBooleanStr(returnValue) << " returned";
+}
+
 glw::GLboolean CallLogWrapper::glUnmapNamedBuffer (glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUnmapNamedBuffer(" << buffer << ");" << TestLog::EndMessage;
 	glw::GLboolean returnValue = m_gl.unmapNamedBuffer(buffer);
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUnmapNamedBuffer) << buffer << returnValue << CallTrace::EndRecord;
 	return returnValue;
 }
 
+static void formatGlUseProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	str << "glUseProgram(" << program << ");";
+}
+
 void CallLogWrapper::glUseProgram (glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUseProgram(" << program << ");" << TestLog::EndMessage;
 	m_gl.useProgram(program);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUseProgram) << program << CallTrace::EndRecord;
+}
+
+static void formatGlUseProgramStages (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	glw::GLbitfield stages = trace.get<glw::GLbitfield>();
+	glw::GLuint program = trace.get<glw::GLuint>();
+	str << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");";
 }
 
 void CallLogWrapper::glUseProgramStages (glw::GLuint pipeline, glw::GLbitfield stages, glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");" << TestLog::EndMessage;
 	m_gl.useProgramStages(pipeline, stages, program);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlUseProgramStages) << pipeline << stages << program << CallTrace::EndRecord;
+}
+
+static void formatGlValidateProgram (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint program = trace.get<glw::GLuint>();
+	str << "glValidateProgram(" << program << ");";
 }
 
 void CallLogWrapper::glValidateProgram (glw::GLuint program)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glValidateProgram(" << program << ");" << TestLog::EndMessage;
 	m_gl.validateProgram(program);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlValidateProgram) << program << CallTrace::EndRecord;
+}
+
+static void formatGlValidateProgramPipeline (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint pipeline = trace.get<glw::GLuint>();
+	str << "glValidateProgramPipeline(" << pipeline << ");";
 }
 
 void CallLogWrapper::glValidateProgramPipeline (glw::GLuint pipeline)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glValidateProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
 	m_gl.validateProgramPipeline(pipeline);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlValidateProgramPipeline) << pipeline << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayAttribBinding (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	str << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");";
 }
 
 void CallLogWrapper::glVertexArrayAttribBinding (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLuint bindingindex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayAttribBinding) << vaobj << attribindex << bindingindex << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayAttribFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexArrayAttribFormat (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayAttribFormat) << vaobj << attribindex << size << type << normalized << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayAttribIFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexArrayAttribIFormat (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayAttribIFormat) << vaobj << attribindex << size << type << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayAttribLFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexArrayAttribLFormat (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayAttribLFormat) << vaobj << attribindex << size << type << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayBindVertexBufferEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	str << "glVertexArrayBindVertexBufferEXT(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");";
 }
 
 void CallLogWrapper::glVertexArrayBindVertexBufferEXT (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizei stride)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayBindVertexBufferEXT(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayBindVertexBufferEXT(vaobj, bindingindex, buffer, offset, stride);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayBindVertexBufferEXT) << vaobj << bindingindex << buffer << offset << stride << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayBindingDivisor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	glw::GLuint divisor = trace.get<glw::GLuint>();
+	str << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");";
 }
 
 void CallLogWrapper::glVertexArrayBindingDivisor (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint divisor)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayBindingDivisor) << vaobj << bindingindex << divisor << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayColorOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayColorOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayColorOffsetEXT) << vaobj << buffer << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayEdgeFlagOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayEdgeFlagOffsetEXT(" << vaobj << ", " << buffer << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayEdgeFlagOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayEdgeFlagOffsetEXT(" << vaobj << ", " << buffer << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayEdgeFlagOffsetEXT(vaobj, buffer, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayEdgeFlagOffsetEXT) << vaobj << buffer << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayElementBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	str << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");";
 }
 
 void CallLogWrapper::glVertexArrayElementBuffer (glw::GLuint vaobj, glw::GLuint buffer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayElementBuffer(vaobj, buffer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayElementBuffer) << vaobj << buffer << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayFogCoordOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayFogCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayFogCoordOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayFogCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayFogCoordOffsetEXT(vaobj, buffer, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayFogCoordOffsetEXT) << vaobj << buffer << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayIndexOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayIndexOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayIndexOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayIndexOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayIndexOffsetEXT(vaobj, buffer, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayIndexOffsetEXT) << vaobj << buffer << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayMultiTexCoordOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum texunit = trace.get<glw::GLenum>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayMultiTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayMultiTexCoordOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum texunit, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayMultiTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayMultiTexCoordOffsetEXT(vaobj, buffer, texunit, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayMultiTexCoordOffsetEXT) << vaobj << buffer << texunit << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayNormalOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayNormalOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayNormalOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayNormalOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayNormalOffsetEXT(vaobj, buffer, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayNormalOffsetEXT) << vaobj << buffer << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArraySecondaryColorOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArraySecondaryColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArraySecondaryColorOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArraySecondaryColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArraySecondaryColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArraySecondaryColorOffsetEXT) << vaobj << buffer << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayTexCoordOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayTexCoordOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayTexCoordOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayTexCoordOffsetEXT) << vaobj << buffer << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribBindingEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	str << "glVertexArrayVertexAttribBindingEXT(" << vaobj << ", " << attribindex << ", " << bindingindex << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribBindingEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLuint bindingindex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribBindingEXT(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribBindingEXT(vaobj, attribindex, bindingindex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribBindingEXT) << vaobj << attribindex << bindingindex << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribDivisorEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint divisor = trace.get<glw::GLuint>();
+	str << "glVertexArrayVertexAttribDivisorEXT(" << vaobj << ", " << index << ", " << divisor << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribDivisorEXT (glw::GLuint vaobj, glw::GLuint index, glw::GLuint divisor)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribDivisorEXT(" << vaobj << ", " << index << ", " << divisor << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribDivisorEXT(vaobj, index, divisor);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribDivisorEXT) << vaobj << index << divisor << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribFormatEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexArrayVertexAttribFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribFormatEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribFormatEXT(vaobj, attribindex, size, type, normalized, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribFormatEXT) << vaobj << attribindex << size << type << normalized << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribIFormatEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexArrayVertexAttribIFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribIFormatEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribIFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribIFormatEXT) << vaobj << attribindex << size << type << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribIOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayVertexAttribIOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribIOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribIOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribIOffsetEXT) << vaobj << buffer << index << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribLFormatEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexArrayVertexAttribLFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribLFormatEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribLFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribLFormatEXT) << vaobj << attribindex << size << type << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribLOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayVertexAttribLOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribLOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribLOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribLOffsetEXT) << vaobj << buffer << index << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexAttribOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayVertexAttribOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexAttribOffsetEXT(vaobj, buffer, index, size, type, normalized, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexAttribOffsetEXT) << vaobj << buffer << index << size << type << normalized << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexBindingDivisorEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	glw::GLuint divisor = trace.get<glw::GLuint>();
+	str << "glVertexArrayVertexBindingDivisorEXT(" << vaobj << ", " << bindingindex << ", " << divisor << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexBindingDivisorEXT (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint divisor)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexBindingDivisorEXT(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexBindingDivisorEXT(vaobj, bindingindex, divisor);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexBindingDivisorEXT) << vaobj << bindingindex << divisor << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexBuffer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	str << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexBuffer (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizei stride)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexBuffer) << vaobj << bindingindex << buffer << offset << stride << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexBuffers (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLuint *buffers = trace.get<const glw::GLuint *>();
+	const glw::GLintptr *offsets = trace.get<const glw::GLintptr *>();
+	const glw::GLsizei *strides = trace.get<const glw::GLsizei *>();
+	str << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexBuffers (glw::GLuint vaobj, glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers, const glw::GLintptr *offsets, const glw::GLsizei *strides)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexBuffers) << vaobj << first << count << buffers << offsets << strides << CallTrace::EndRecord;
+}
+
+static void formatGlVertexArrayVertexOffsetEXT (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint vaobj = trace.get<glw::GLuint>();
+	glw::GLuint buffer = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	glw::GLintptr offset = trace.get<glw::GLintptr>();
+	str << "glVertexArrayVertexOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
 }
 
 void CallLogWrapper::glVertexArrayVertexOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexArrayVertexOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
 	m_gl.vertexArrayVertexOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexArrayVertexOffsetEXT) << vaobj << buffer << size << type << stride << offset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib1d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	str << "glVertexAttrib1d(" << index << ", " << x << ");";
 }
 
 void CallLogWrapper::glVertexAttrib1d (glw::GLuint index, glw::GLdouble x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib1d(" << index << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib1d(index, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib1d) << index << x << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib1dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLdouble> vData = trace.getArray<glw::GLdouble>();
+	str << "glVertexAttrib1dv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib1dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib1dv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib1dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib1dv) << index << traceArray(v, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib1f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	str << "glVertexAttrib1f(" << index << ", " << x << ");";
 }
 
 void CallLogWrapper::glVertexAttrib1f (glw::GLuint index, glw::GLfloat x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib1f(" << index << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib1f(index, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib1f) << index << x << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib1fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> vData = trace.getArray<glw::GLfloat>();
+	str << "glVertexAttrib1fv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib1fv (glw::GLuint index, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib1fv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib1fv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib1fv) << index << traceArray(v, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib1s (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLshort x = trace.get<glw::GLshort>();
+	str << "glVertexAttrib1s(" << index << ", " << x << ");";
 }
 
 void CallLogWrapper::glVertexAttrib1s (glw::GLuint index, glw::GLshort x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib1s(" << index << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib1s(index, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib1s) << index << x << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib1sv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLshort> vData = trace.getArray<glw::GLshort>();
+	str << "glVertexAttrib1sv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib1sv (glw::GLuint index, const glw::GLshort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib1sv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib1sv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib1sv) << index << traceArray(v, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib2d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	str << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glVertexAttrib2d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib2d(index, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib2d) << index << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLdouble> vData = trace.getArray<glw::GLdouble>();
+	str << "glVertexAttrib2dv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib2dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib2dv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib2dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib2dv) << index << traceArray(v, 2) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib2f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	str << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glVertexAttrib2f (glw::GLuint index, glw::GLfloat x, glw::GLfloat y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib2f(index, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib2f) << index << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib2fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> vData = trace.getArray<glw::GLfloat>();
+	str << "glVertexAttrib2fv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib2fv (glw::GLuint index, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib2fv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib2fv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib2fv) << index << traceArray(v, 2) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib2s (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLshort x = trace.get<glw::GLshort>();
+	glw::GLshort y = trace.get<glw::GLshort>();
+	str << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glVertexAttrib2s (glw::GLuint index, glw::GLshort x, glw::GLshort y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib2s(index, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib2s) << index << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib2sv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLshort> vData = trace.getArray<glw::GLshort>();
+	str << "glVertexAttrib2sv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib2sv (glw::GLuint index, const glw::GLshort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib2sv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib2sv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib2sv) << index << traceArray(v, 2) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib3d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	str << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glVertexAttrib3d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib3d(index, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib3d) << index << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLdouble> vData = trace.getArray<glw::GLdouble>();
+	str << "glVertexAttrib3dv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib3dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib3dv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib3dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib3dv) << index << traceArray(v, 3) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib3f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat z = trace.get<glw::GLfloat>();
+	str << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glVertexAttrib3f (glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib3f(index, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib3f) << index << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib3fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> vData = trace.getArray<glw::GLfloat>();
+	str << "glVertexAttrib3fv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib3fv (glw::GLuint index, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib3fv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib3fv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib3fv) << index << traceArray(v, 3) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib3s (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLshort x = trace.get<glw::GLshort>();
+	glw::GLshort y = trace.get<glw::GLshort>();
+	glw::GLshort z = trace.get<glw::GLshort>();
+	str << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glVertexAttrib3s (glw::GLuint index, glw::GLshort x, glw::GLshort y, glw::GLshort z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib3s(index, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib3s) << index << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib3sv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLshort> vData = trace.getArray<glw::GLshort>();
+	str << "glVertexAttrib3sv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib3sv (glw::GLuint index, const glw::GLshort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib3sv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib3sv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib3sv) << index << traceArray(v, 3) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Nbv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLbyte> vData = trace.getArray<glw::GLbyte>();
+	str << "glVertexAttrib4Nbv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Nbv (glw::GLuint index, const glw::GLbyte *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Nbv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Nbv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Nbv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Niv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> vData = trace.getArray<glw::GLint>();
+	str << "glVertexAttrib4Niv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Niv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Niv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Niv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Niv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Nsv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLshort> vData = trace.getArray<glw::GLshort>();
+	str << "glVertexAttrib4Nsv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Nsv (glw::GLuint index, const glw::GLshort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Nsv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Nsv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Nsv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Nub (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLubyte x = trace.get<glw::GLubyte>();
+	glw::GLubyte y = trace.get<glw::GLubyte>();
+	glw::GLubyte z = trace.get<glw::GLubyte>();
+	glw::GLubyte w = trace.get<glw::GLubyte>();
+	str << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Nub (glw::GLuint index, glw::GLubyte x, glw::GLubyte y, glw::GLubyte z, glw::GLubyte w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Nub(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Nub) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Nubv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLubyte> vData = trace.getArray<glw::GLubyte>();
+	str << "glVertexAttrib4Nubv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Nubv (glw::GLuint index, const glw::GLubyte *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Nubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Nubv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Nubv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Nuiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLuint> vData = trace.getArray<glw::GLuint>();
+	str << "glVertexAttrib4Nuiv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Nuiv (glw::GLuint index, const glw::GLuint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Nuiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Nuiv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Nuiv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4Nusv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLushort> vData = trace.getArray<glw::GLushort>();
+	str << "glVertexAttrib4Nusv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4Nusv (glw::GLuint index, const glw::GLushort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4Nusv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4Nusv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4Nusv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4bv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLbyte> vData = trace.getArray<glw::GLbyte>();
+	str << "glVertexAttrib4bv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4bv (glw::GLuint index, const glw::GLbyte *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4bv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4bv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	glw::GLdouble w = trace.get<glw::GLdouble>();
+	str << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4d(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4d) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLdouble> vData = trace.getArray<glw::GLdouble>();
+	str << "glVertexAttrib4dv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4dv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4dv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4f (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat z = trace.get<glw::GLfloat>();
+	glw::GLfloat w = trace.get<glw::GLfloat>();
+	str << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4f (glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z, glw::GLfloat w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4f(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4f) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4fv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLfloat> vData = trace.getArray<glw::GLfloat>();
+	str << "glVertexAttrib4fv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4fv (glw::GLuint index, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4fv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4fv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4fv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> vData = trace.getArray<glw::GLint>();
+	str << "glVertexAttrib4iv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4iv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4iv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4iv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4s (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLshort x = trace.get<glw::GLshort>();
+	glw::GLshort y = trace.get<glw::GLshort>();
+	glw::GLshort z = trace.get<glw::GLshort>();
+	glw::GLshort w = trace.get<glw::GLshort>();
+	str << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4s (glw::GLuint index, glw::GLshort x, glw::GLshort y, glw::GLshort z, glw::GLshort w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4s(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4s) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4sv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLshort> vData = trace.getArray<glw::GLshort>();
+	str << "glVertexAttrib4sv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4sv (glw::GLuint index, const glw::GLshort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4sv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4sv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4ubv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLubyte> vData = trace.getArray<glw::GLubyte>();
+	str << "glVertexAttrib4ubv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4ubv (glw::GLuint index, const glw::GLubyte *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4ubv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4ubv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLuint> vData = trace.getArray<glw::GLuint>();
+	str << "glVertexAttrib4uiv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4uiv (glw::GLuint index, const glw::GLuint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4uiv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4uiv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttrib4usv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLushort> vData = trace.getArray<glw::GLushort>();
+	str << "glVertexAttrib4usv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttrib4usv (glw::GLuint index, const glw::GLushort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttrib4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttrib4usv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttrib4usv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribBinding (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	str << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");";
 }
 
 void CallLogWrapper::glVertexAttribBinding (glw::GLuint attribindex, glw::GLuint bindingindex)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribBinding(attribindex, bindingindex);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribBinding) << attribindex << bindingindex << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribDivisor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint divisor = trace.get<glw::GLuint>();
+	str << "glVertexAttribDivisor(" << index << ", " << divisor << ");";
 }
 
 void CallLogWrapper::glVertexAttribDivisor (glw::GLuint index, glw::GLuint divisor)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribDivisor(" << index << ", " << divisor << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribDivisor(index, divisor);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribDivisor) << index << divisor << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexAttribFormat (glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribFormat) << attribindex << size << type << normalized << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI1i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	str << "glVertexAttribI1i(" << index << ", " << x << ");";
 }
 
 void CallLogWrapper::glVertexAttribI1i (glw::GLuint index, glw::GLint x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI1i(" << index << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI1i(index, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI1i) << index << x << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI1iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> vData = trace.getArray<glw::GLint>();
+	str << "glVertexAttribI1iv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI1iv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI1iv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI1iv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI1iv) << index << traceArray(v, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI1ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint x = trace.get<glw::GLuint>();
+	str << "glVertexAttribI1ui(" << index << ", " << x << ");";
 }
 
 void CallLogWrapper::glVertexAttribI1ui (glw::GLuint index, glw::GLuint x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI1ui(" << index << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI1ui(index, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI1ui) << index << x << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI1uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLuint> vData = trace.getArray<glw::GLuint>();
+	str << "glVertexAttribI1uiv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI1uiv (glw::GLuint index, const glw::GLuint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI1uiv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI1uiv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI1uiv) << index << traceArray(v, 1) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI2i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	str << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glVertexAttribI2i (glw::GLuint index, glw::GLint x, glw::GLint y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI2i(index, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI2i) << index << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI2iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> vData = trace.getArray<glw::GLint>();
+	str << "glVertexAttribI2iv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI2iv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI2iv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI2iv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI2iv) << index << traceArray(v, 2) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI2ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint x = trace.get<glw::GLuint>();
+	glw::GLuint y = trace.get<glw::GLuint>();
+	str << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glVertexAttribI2ui (glw::GLuint index, glw::GLuint x, glw::GLuint y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI2ui(index, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI2ui) << index << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI2uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLuint> vData = trace.getArray<glw::GLuint>();
+	str << "glVertexAttribI2uiv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI2uiv (glw::GLuint index, const glw::GLuint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI2uiv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI2uiv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI2uiv) << index << traceArray(v, 2) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI3i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLint z = trace.get<glw::GLint>();
+	str << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glVertexAttribI3i (glw::GLuint index, glw::GLint x, glw::GLint y, glw::GLint z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI3i(index, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI3i) << index << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI3iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> vData = trace.getArray<glw::GLint>();
+	str << "glVertexAttribI3iv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI3iv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI3iv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI3iv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI3iv) << index << traceArray(v, 3) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI3ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint x = trace.get<glw::GLuint>();
+	glw::GLuint y = trace.get<glw::GLuint>();
+	glw::GLuint z = trace.get<glw::GLuint>();
+	str << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glVertexAttribI3ui (glw::GLuint index, glw::GLuint x, glw::GLuint y, glw::GLuint z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI3ui(index, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI3ui) << index << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI3uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLuint> vData = trace.getArray<glw::GLuint>();
+	str << "glVertexAttribI3uiv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI3uiv (glw::GLuint index, const glw::GLuint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI3uiv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI3uiv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI3uiv) << index << traceArray(v, 3) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4bv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLbyte> vData = trace.getArray<glw::GLbyte>();
+	str << "glVertexAttribI4bv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4bv (glw::GLuint index, const glw::GLbyte *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4bv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4bv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4i (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLint z = trace.get<glw::GLint>();
+	glw::GLint w = trace.get<glw::GLint>();
+	str << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4i (glw::GLuint index, glw::GLint x, glw::GLint y, glw::GLint z, glw::GLint w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4i(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4i) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4iv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLint> vData = trace.getArray<glw::GLint>();
+	str << "glVertexAttribI4iv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4iv (glw::GLuint index, const glw::GLint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4iv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4iv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4sv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLshort> vData = trace.getArray<glw::GLshort>();
+	str << "glVertexAttribI4sv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4sv (glw::GLuint index, const glw::GLshort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4sv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4sv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4ubv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLubyte> vData = trace.getArray<glw::GLubyte>();
+	str << "glVertexAttribI4ubv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4ubv (glw::GLuint index, const glw::GLubyte *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4ubv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4ubv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLuint x = trace.get<glw::GLuint>();
+	glw::GLuint y = trace.get<glw::GLuint>();
+	glw::GLuint z = trace.get<glw::GLuint>();
+	glw::GLuint w = trace.get<glw::GLuint>();
+	str << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4ui (glw::GLuint index, glw::GLuint x, glw::GLuint y, glw::GLuint z, glw::GLuint w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4ui(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4ui) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLuint> vData = trace.getArray<glw::GLuint>();
+	str << "glVertexAttribI4uiv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4uiv (glw::GLuint index, const glw::GLuint *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4uiv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4uiv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribI4usv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const tcu::Format::ArrayPointer<glw::GLushort> vData = trace.getArray<glw::GLushort>();
+	str << "glVertexAttribI4usv(" << index << ", " << getPointerStr(vData.arr, vData.size) << ");";
 }
 
 void CallLogWrapper::glVertexAttribI4usv (glw::GLuint index, const glw::GLushort *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribI4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribI4usv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribI4usv) << index << traceArray(v, 4) << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribIFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexAttribIFormat (glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribIFormat(attribindex, size, type, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribIFormat) << attribindex << size << type << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribIPointer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	const void *pointer = trace.get<const void *>();
+	str << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << pointer << ");";
 }
 
 void CallLogWrapper::glVertexAttribIPointer (glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, const void *pointer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribIPointer(index, size, type, stride, pointer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribIPointer) << index << size << type << stride << pointer << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL1d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	str << "glVertexAttribL1d(" << index << ", " << x << ");";
 }
 
 void CallLogWrapper::glVertexAttribL1d (glw::GLuint index, glw::GLdouble x)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL1d(" << index << ", " << x << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL1d(index, x);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL1d) << index << x << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL1dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLdouble *v = trace.get<const glw::GLdouble *>();
+	str << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribL1dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL1dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL1dv) << index << v << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL2d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	str << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");";
 }
 
 void CallLogWrapper::glVertexAttribL2d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL2d(index, x, y);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL2d) << index << x << y << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL2dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLdouble *v = trace.get<const glw::GLdouble *>();
+	str << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribL2dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL2dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL2dv) << index << v << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL3d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	str << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");";
 }
 
 void CallLogWrapper::glVertexAttribL3d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL3d(index, x, y, z);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL3d) << index << x << y << z << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL3dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLdouble *v = trace.get<const glw::GLdouble *>();
+	str << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribL3dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL3dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL3dv) << index << v << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL4d (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLdouble x = trace.get<glw::GLdouble>();
+	glw::GLdouble y = trace.get<glw::GLdouble>();
+	glw::GLdouble z = trace.get<glw::GLdouble>();
+	glw::GLdouble w = trace.get<glw::GLdouble>();
+	str << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
 }
 
 void CallLogWrapper::glVertexAttribL4d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL4d(index, x, y, z, w);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL4d) << index << x << y << z << w << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribL4dv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLdouble *v = trace.get<const glw::GLdouble *>();
+	str << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribL4dv (glw::GLuint index, const glw::GLdouble *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribL4dv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribL4dv) << index << v << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribLFormat (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint attribindex = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLuint relativeoffset = trace.get<glw::GLuint>();
+	str << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
 }
 
 void CallLogWrapper::glVertexAttribLFormat (glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribLFormat(attribindex, size, type, relativeoffset);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribLFormat) << attribindex << size << type << relativeoffset << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribLPointer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	const void *pointer = trace.get<const void *>();
+	str << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");";
 }
 
 void CallLogWrapper::glVertexAttribLPointer (glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, const void *pointer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribLPointer(index, size, type, stride, pointer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribLPointer) << index << size << type << stride << pointer << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP1ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint value = trace.get<glw::GLuint>();
+	str << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
 }
 
 void CallLogWrapper::glVertexAttribP1ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP1ui(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP1ui) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP1uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	const glw::GLuint *value = trace.get<const glw::GLuint *>();
+	str << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribP1uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP1uiv(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP1uiv) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP2ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint value = trace.get<glw::GLuint>();
+	str << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
 }
 
 void CallLogWrapper::glVertexAttribP2ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP2ui(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP2ui) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP2uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	const glw::GLuint *value = trace.get<const glw::GLuint *>();
+	str << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribP2uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP2uiv(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP2uiv) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP3ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint value = trace.get<glw::GLuint>();
+	str << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
 }
 
 void CallLogWrapper::glVertexAttribP3ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP3ui(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP3ui) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP3uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	const glw::GLuint *value = trace.get<const glw::GLuint *>();
+	str << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribP3uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP3uiv(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP3uiv) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP4ui (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLuint value = trace.get<glw::GLuint>();
+	str << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
 }
 
 void CallLogWrapper::glVertexAttribP4ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP4ui(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP4ui) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribP4uiv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	const glw::GLuint *value = trace.get<const glw::GLuint *>();
+	str << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
 }
 
 void CallLogWrapper::glVertexAttribP4uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribP4uiv(index, type, normalized, value);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribP4uiv) << index << type << normalized << value << CallTrace::EndRecord;
+}
+
+static void formatGlVertexAttribPointer (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLint size = trace.get<glw::GLint>();
+	glw::GLenum type = trace.get<glw::GLenum>();
+	glw::GLboolean normalized = trace.get<glw::GLboolean>();
+	glw::GLsizei stride = trace.get<glw::GLsizei>();
+	const void *pointer = trace.get<const void *>();
+	str << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << pointer << ");";
 }
 
 void CallLogWrapper::glVertexAttribPointer (glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLsizei stride, const void *pointer)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
 	m_gl.vertexAttribPointer(index, size, type, normalized, stride, pointer);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexAttribPointer) << index << size << type << normalized << stride << pointer << CallTrace::EndRecord;
+}
+
+static void formatGlVertexBindingDivisor (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint bindingindex = trace.get<glw::GLuint>();
+	glw::GLuint divisor = trace.get<glw::GLuint>();
+	str << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");";
 }
 
 void CallLogWrapper::glVertexBindingDivisor (glw::GLuint bindingindex, glw::GLuint divisor)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
 	m_gl.vertexBindingDivisor(bindingindex, divisor);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlVertexBindingDivisor) << bindingindex << divisor << CallTrace::EndRecord;
+}
+
+static void formatGlViewport (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLint x = trace.get<glw::GLint>();
+	glw::GLint y = trace.get<glw::GLint>();
+	glw::GLsizei width = trace.get<glw::GLsizei>();
+	glw::GLsizei height = trace.get<glw::GLsizei>();
+	str << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");";
 }
 
 void CallLogWrapper::glViewport (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
 	m_gl.viewport(x, y, width, height);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlViewport) << x << y << width << height << CallTrace::EndRecord;
+}
+
+static void formatGlViewportArrayv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint first = trace.get<glw::GLuint>();
+	glw::GLsizei count = trace.get<glw::GLsizei>();
+	const glw::GLfloat *v = trace.get<const glw::GLfloat *>();
+	str << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glViewportArrayv (glw::GLuint first, glw::GLsizei count, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.viewportArrayv(first, count, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlViewportArrayv) << first << count << v << CallTrace::EndRecord;
+}
+
+static void formatGlViewportIndexedf (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	glw::GLfloat x = trace.get<glw::GLfloat>();
+	glw::GLfloat y = trace.get<glw::GLfloat>();
+	glw::GLfloat w = trace.get<glw::GLfloat>();
+	glw::GLfloat h = trace.get<glw::GLfloat>();
+	str << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");";
 }
 
 void CallLogWrapper::glViewportIndexedf (glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat w, glw::GLfloat h)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");" << TestLog::EndMessage;
 	m_gl.viewportIndexedf(index, x, y, w, h);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlViewportIndexedf) << index << x << y << w << h << CallTrace::EndRecord;
+}
+
+static void formatGlViewportIndexedfv (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLuint index = trace.get<glw::GLuint>();
+	const glw::GLfloat *v = trace.get<const glw::GLfloat *>();
+	str << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
 }
 
 void CallLogWrapper::glViewportIndexedfv (glw::GLuint index, const glw::GLfloat *v)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
 	m_gl.viewportIndexedfv(index, v);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlViewportIndexedfv) << index << v << CallTrace::EndRecord;
+}
+
+static void formatGlWaitSync (std::ostream& str, CallTraceReader& trace)
+{
+	glw::GLsync sync = trace.get<glw::GLsync>();
+	glw::GLbitfield flags = trace.get<glw::GLbitfield>();
+	glw::GLuint64 timeout = trace.get<glw::GLuint64>();
+	str << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");";
 }
 
 void CallLogWrapper::glWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::GLuint64 timeout)
 {
-	if (m_enableLog)
+	if (m_enableLog && !m_callTrace)
 		m_log << TestLog::Message << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
 	m_gl.waitSync(sync, flags, timeout);
+	if (m_enableLog && m_callTrace)
+		m_callTrace->beginRecord(formatGlWaitSync) << sync << flags << timeout << CallTrace::EndRecord;
 }
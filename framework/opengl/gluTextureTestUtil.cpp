@@ -1356,7 +1356,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 
 	const tcu::Vec2								lodBias				((sampleParams.flags & ReferenceParams::USE_BIAS) ? sampleParams.bias : 0.0f);
 
-	int											numFailed			= 0;
+	std::vector<tcu::LookupQuery2D>				queries;
+	tcu::TextureLevel							scaledResult		(tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::FLOAT), result.getWidth(), result.getHeight());
 
 	const tcu::Vec2 lodOffsets[] =
 	{
@@ -1368,17 +1369,16 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 
 	tcu::clear(errorMask, tcu::RGBA::green().toVec());
 
+	// Collect pixels that don't match the ideal reference, they are verified in one batch.
 	for (int py = 0; py < result.getHeight(); py++)
 	{
-		// Ugly hack, validation can take way too long at the moment.
-		if (watchDog)
-			qpWatchDog_touch(watchDog);
-
 		for (int px = 0; px < result.getWidth(); px++)
 		{
 			const tcu::Vec4	resPix	= (result.getPixel(px, py)		- sampleParams.colorBias) / sampleParams.colorScale;
 			const tcu::Vec4	refPix	= (reference.getPixel(px, py)	- sampleParams.colorBias) / sampleParams.colorScale;
 
+			scaledResult.getAccess().setPixel(resPix, px, py);
+
 			// Try comparison to ideal reference first, and if that fails use slower verificator.
 			if (!tcu::boolAll(tcu::lessThanEqual(tcu::abs(resPix - refPix), lookupPrec.colorThreshold)))
 			{
@@ -1421,18 +1421,16 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 				}
 
 				const tcu::Vec2	clampedLod	= tcu::clampLodBounds(lodBounds + lodBias, tcu::Vec2(sampleParams.minLod, sampleParams.maxLod), lodPrec);
-				const bool		isOk		= tcu::isLookupResultValid(src, sampleParams.sampler, lookupPrec, coord, clampedLod, resPix);
 
-				if (!isOk)
-				{
-					errorMask.setPixel(tcu::RGBA::red().toVec(), px, py);
-					numFailed += 1;
-				}
+				queries.push_back(tcu::LookupQuery2D(tcu::IVec2(px, py), coord, clampedLod));
 			}
 		}
 	}
 
-	return numFailed;
+	if (queries.empty())
+		return 0;
+
+	return tcu::verifyLookupResults(src, sampleParams.sampler, lookupPrec, scaledResult.getAccess(), &queries[0], (int)queries.size(), errorMask, watchDog);
 }
 
 bool verifyTextureResult (tcu::TestContext&						testCtx,
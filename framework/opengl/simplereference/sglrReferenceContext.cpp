@@ -1814,22 +1814,28 @@ static inline tcu::Sampler::FilterMode mapGLFilterMode (int value)
 	}
 }
 
-void ReferenceContext::texParameteri (deUint32 target, deUint32 pname, int value)
+//! Texture bound to target in active unit, or null if target is not valid.
+Texture* ReferenceContext::getParameterTexture (deUint32 target)
 {
-	TextureUnit&	unit		= m_textureUnits[m_activeTexture];
-	Texture*		texture		= DE_NULL;
+	TextureUnit& unit = m_textureUnits[m_activeTexture];
 
 	switch (target)
 	{
-		case GL_TEXTURE_1D:				texture = unit.tex1DBinding			? unit.tex1DBinding			: &unit.default1DTex;			break;
-		case GL_TEXTURE_2D:				texture = unit.tex2DBinding			? unit.tex2DBinding			: &unit.default2DTex;			break;
-		case GL_TEXTURE_CUBE_MAP:		texture = unit.texCubeBinding		? unit.texCubeBinding		: &unit.defaultCubeTex;			break;
-		case GL_TEXTURE_2D_ARRAY:		texture = unit.tex2DArrayBinding	? unit.tex2DArrayBinding	: &unit.default2DArrayTex;		break;
-		case GL_TEXTURE_3D:				texture = unit.tex3DBinding			? unit.tex3DBinding			: &unit.default3DTex;			break;
-		case GL_TEXTURE_CUBE_MAP_ARRAY:	texture = unit.texCubeArrayBinding	? unit.texCubeArrayBinding	: &unit.defaultCubeArrayTex;	break;
-
-		default:					RC_ERROR_RET(GL_INVALID_ENUM, RC_RET_VOID);
+		case GL_TEXTURE_1D:				return unit.tex1DBinding		? unit.tex1DBinding			: &unit.default1DTex;
+		case GL_TEXTURE_2D:				return unit.tex2DBinding		? unit.tex2DBinding			: &unit.default2DTex;
+		case GL_TEXTURE_CUBE_MAP:		return unit.texCubeBinding		? unit.texCubeBinding		: &unit.defaultCubeTex;
+		case GL_TEXTURE_2D_ARRAY:		return unit.tex2DArrayBinding	? unit.tex2DArrayBinding	: &unit.default2DArrayTex;
+		case GL_TEXTURE_3D:				return unit.tex3DBinding		? unit.tex3DBinding			: &unit.default3DTex;
+		case GL_TEXTURE_CUBE_MAP_ARRAY:	return unit.texCubeArrayBinding	? unit.texCubeArrayBinding	: &unit.defaultCubeArrayTex;
+		default:						return DE_NULL;
 	}
+}
+
+void ReferenceContext::texParameteri (deUint32 target, deUint32 pname, int value)
+{
+	Texture* const texture = getParameterTexture(target);
+
+	RC_IF_ERROR(!texture, GL_INVALID_ENUM, RC_RET_VOID);
 
 	switch (pname)
 	{
@@ -1886,6 +1892,51 @@ void ReferenceContext::texParameteri (deUint32 target, deUint32 pname, int value
 	}
 }
 
+void ReferenceContext::texParameterf (deUint32 target, deUint32 pname, float value)
+{
+	// All supported parameters are integer-valued.
+	texParameteri(target, pname, (int)value);
+}
+
+void ReferenceContext::texParameteriv (deUint32 target, deUint32 pname, const int* values)
+{
+	if (pname == GL_TEXTURE_BORDER_COLOR)
+	{
+		Texture* const	texture		= getParameterTexture(target);
+		tcu::Vec4		color;
+
+		RC_IF_ERROR(!texture, GL_INVALID_ENUM, RC_RET_VOID);
+
+		// Integer values are mapped to [-1, 1] as with signed normalized data.
+		for (int ndx = 0; ndx < 4; ndx++)
+			color[ndx] = (float)((2.0 * (double)values[ndx] + 1.0) / 4294967295.0);
+
+		texture->getSampler().borderColor = rr::GenericVec4(color);
+	}
+	else
+		texParameteri(target, pname, values[0]);
+}
+
+void ReferenceContext::texParameterfv (deUint32 target, deUint32 pname, const float* values)
+{
+	if (pname == GL_TEXTURE_BORDER_COLOR)
+	{
+		Texture* const texture = getParameterTexture(target);
+
+		RC_IF_ERROR(!texture, GL_INVALID_ENUM, RC_RET_VOID);
+
+		texture->getSampler().borderColor = rr::GenericVec4(tcu::Vec4(values[0], values[1], values[2], values[3]));
+	}
+	else
+		texParameterf(target, pname, values[0]);
+}
+
+bool ReferenceContext::isTexture (deUint32 texture)
+{
+	// Texture objects are created on first bind.
+	return texture != 0 && m_textures.find(texture) != DE_NULL;
+}
+
 static inline Framebuffer::AttachmentPoint mapGLAttachmentPoint (deUint32 attachment)
 {
 	switch (attachment)
@@ -2569,6 +2620,7 @@ void ReferenceContext::bufferData (deUint32 target, deIntptr size, const void* d
 	RC_IF_ERROR(!buffer, GL_INVALID_OPERATION, RC_RET_VOID);
 
 	DE_ASSERT((deIntptr)(int)size == size);
+	buffer->setMapping(0, 0, 0);
 	buffer->setStorage((int)size);
 	if (data)
 		deMemcpy(buffer->getData(), data, (int)size);
@@ -2587,6 +2639,51 @@ void ReferenceContext::bufferSubData (deUint32 target, deIntptr offset, deIntptr
 	deMemcpy(buffer->getData()+offset, data, (int)size);
 }
 
+void* ReferenceContext::mapBufferRange (deUint32 target, deIntptr offset, deIntptr length, deUint32 access)
+{
+	const deUint32	validAccessBits	= GL_MAP_READ_BIT|GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_RANGE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT|GL_MAP_FLUSH_EXPLICIT_BIT|GL_MAP_UNSYNCHRONIZED_BIT;
+
+	RC_IF_ERROR(!isValidBufferTarget(target), GL_INVALID_ENUM, DE_NULL);
+	RC_IF_ERROR(offset < 0 || length < 0 || (access & ~validAccessBits) != 0, GL_INVALID_VALUE, DE_NULL);
+
+	DataBuffer* buffer = getBufferBinding(target);
+
+	RC_IF_ERROR(!buffer, GL_INVALID_OPERATION, DE_NULL);
+	RC_IF_ERROR(offset+length > (deIntptr)buffer->getSize(), GL_INVALID_VALUE, DE_NULL);
+	RC_IF_ERROR(length == 0 || buffer->isMapped(), GL_INVALID_OPERATION, DE_NULL);
+	RC_IF_ERROR((access & (GL_MAP_READ_BIT|GL_MAP_WRITE_BIT)) == 0, GL_INVALID_OPERATION, DE_NULL);
+	RC_IF_ERROR((access & GL_MAP_READ_BIT) != 0 && (access & (GL_MAP_INVALIDATE_RANGE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT|GL_MAP_UNSYNCHRONIZED_BIT)) != 0, GL_INVALID_OPERATION, DE_NULL);
+	RC_IF_ERROR((access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0 && (access & GL_MAP_WRITE_BIT) == 0, GL_INVALID_OPERATION, DE_NULL);
+
+	// Buffer store is accessed directly, no copy or flush is needed.
+	buffer->setMapping((int)offset, (int)length, access);
+
+	return buffer->getData() + offset;
+}
+
+bool ReferenceContext::unmapBuffer (deUint32 target)
+{
+	RC_IF_ERROR(!isValidBufferTarget(target), GL_INVALID_ENUM, false);
+
+	DataBuffer* buffer = getBufferBinding(target);
+
+	RC_IF_ERROR(!buffer || !buffer->isMapped(), GL_INVALID_OPERATION, false);
+
+	buffer->setMapping(0, 0, 0);
+
+	return true;
+}
+
+void ReferenceContext::flushMappedBufferRange (deUint32 target, deIntptr offset, deIntptr length)
+{
+	RC_IF_ERROR(!isValidBufferTarget(target), GL_INVALID_ENUM, RC_RET_VOID);
+
+	DataBuffer* buffer = getBufferBinding(target);
+
+	RC_IF_ERROR(!buffer || !buffer->isMapped() || (buffer->getMapAccess() & GL_MAP_FLUSH_EXPLICIT_BIT) == 0, GL_INVALID_OPERATION, RC_RET_VOID);
+	RC_IF_ERROR(offset < 0 || length < 0 || offset+length > (deIntptr)buffer->getMapLength(), GL_INVALID_VALUE, RC_RET_VOID);
+}
+
 void ReferenceContext::clearColor (float red, float green, float blue, float alpha)
 {
 	m_clearColor = Vec4(de::clamp(red,	0.0f, 1.0f),
@@ -4625,7 +4722,13 @@ inline void ReferenceContext::setError (deUint32 error)
 		m_lastError = error;
 }
 
-void ReferenceContext::getIntegerv (deUint32 pname, int* param)
+template <typename T>
+static inline int getObjectName (const T* object)
+{
+	return object ? (int)object->getName() : 0;
+}
+
+bool ReferenceContext::getIntegerState (deUint32 pname, int* param)
 {
 	switch (pname)
 	{
@@ -4637,10 +4740,62 @@ void ReferenceContext::getIntegerv (deUint32 pname, int* param)
 		case GL_MAX_TEXTURE_IMAGE_UNITS:	*param = m_limits.maxTextureImageUnits;		break;
 		case GL_MAX_VERTEX_ATTRIBS:			*param = m_limits.maxVertexAttribs;			break;
 
-		default:
-			setError(GL_INVALID_ENUM);
+		case GL_ACTIVE_TEXTURE:				*param = GL_TEXTURE0 + m_activeTexture;		break;
+		case GL_TEXTURE_BINDING_2D:			*param = getObjectName(m_textureUnits[m_activeTexture].tex2DBinding);			break;
+		case GL_TEXTURE_BINDING_CUBE_MAP:	*param = getObjectName(m_textureUnits[m_activeTexture].texCubeBinding);		break;
+		case GL_TEXTURE_BINDING_2D_ARRAY:	*param = getObjectName(m_textureUnits[m_activeTexture].tex2DArrayBinding);		break;
+		case GL_TEXTURE_BINDING_3D:			*param = getObjectName(m_textureUnits[m_activeTexture].tex3DBinding);			break;
+
+		case GL_ARRAY_BUFFER_BINDING:			*param = getObjectName(m_arrayBufferBinding);						break;
+		case GL_ELEMENT_ARRAY_BUFFER_BINDING:	*param = getObjectName(getBufferBinding(GL_ELEMENT_ARRAY_BUFFER));	break;
+		case GL_PIXEL_PACK_BUFFER_BINDING:		*param = getObjectName(m_pixelPackBufferBinding);					break;
+		case GL_PIXEL_UNPACK_BUFFER_BINDING:	*param = getObjectName(m_pixelUnpackBufferBinding);					break;
+		case GL_COPY_READ_BUFFER_BINDING:		*param = getObjectName(m_copyReadBufferBinding);					break;
+		case GL_COPY_WRITE_BUFFER_BINDING:		*param = getObjectName(m_copyWriteBufferBinding);					break;
+		case GL_VERTEX_ARRAY_BINDING:			*param = getObjectName(m_vertexArrayBinding);						break;
+
+		case GL_DRAW_FRAMEBUFFER_BINDING:	*param = getObjectName(m_drawFramebufferBinding);	break;
+		case GL_READ_FRAMEBUFFER_BINDING:	*param = getObjectName(m_readFramebufferBinding);	break;
+		case GL_RENDERBUFFER_BINDING:		*param = getObjectName(m_renderbufferBinding);		break;
+
+		case GL_UNPACK_ALIGNMENT:			*param = m_pixelUnpackAlignment;		break;
+		case GL_UNPACK_ROW_LENGTH:			*param = m_pixelUnpackRowLength;		break;
+		case GL_UNPACK_SKIP_ROWS:			*param = m_pixelUnpackSkipRows;			break;
+		case GL_UNPACK_SKIP_PIXELS:			*param = m_pixelUnpackSkipPixels;		break;
+		case GL_UNPACK_IMAGE_HEIGHT:		*param = m_pixelUnpackImageHeight;		break;
+		case GL_UNPACK_SKIP_IMAGES:			*param = m_pixelUnpackSkipImages;		break;
+		case GL_PACK_ALIGNMENT:				*param = m_pixelPackAlignment;			break;
+
+		case GL_VIEWPORT:
+			for (int ndx = 0; ndx < 4; ndx++)
+				param[ndx] = m_viewport[ndx];
 			break;
+
+		case GL_SCISSOR_BOX:
+			for (int ndx = 0; ndx < 4; ndx++)
+				param[ndx] = m_scissorBox[ndx];
+			break;
+
+		case GL_STENCIL_CLEAR_VALUE:		*param = m_clearStencil;				break;
+		case GL_DEPTH_FUNC:					*param = (int)m_depthFunc;				break;
+		case GL_BLEND_EQUATION_RGB:			*param = (int)m_blendModeRGB;			break;
+		case GL_BLEND_EQUATION_ALPHA:		*param = (int)m_blendModeAlpha;			break;
+		case GL_BLEND_SRC_RGB:				*param = (int)m_blendFactorSrcRGB;		break;
+		case GL_BLEND_DST_RGB:				*param = (int)m_blendFactorDstRGB;		break;
+		case GL_BLEND_SRC_ALPHA:			*param = (int)m_blendFactorSrcAlpha;	break;
+		case GL_BLEND_DST_ALPHA:			*param = (int)m_blendFactorDstAlpha;	break;
+
+		default:
+			return false;
 	}
+
+	return true;
+}
+
+void ReferenceContext::getIntegerv (deUint32 pname, int* param)
+{
+	if (!getIntegerState(pname, param))
+		setError(GL_INVALID_ENUM);
 }
 
 const char* ReferenceContext::getString (deUint32 pname)
@@ -391,7 +391,7 @@ private:
 class DataBuffer : public NamedObject
 {
 public:
-							DataBuffer			(deUint32 name) : NamedObject(name) {}
+							DataBuffer			(deUint32 name) : NamedObject(name), m_mapOffset(0), m_mapLength(0), m_mapAccess(0) {}
 							~DataBuffer			(void) {}
 
 	void					setStorage			(int size) { m_data.resize(size); }
@@ -400,8 +400,18 @@ public:
 	const deUint8*			getData				(void) const	{ return m_data.empty() ? DE_NULL : &m_data[0];	}
 	deUint8*				getData				(void)			{ return m_data.empty() ? DE_NULL : &m_data[0];	}
 
+	//! Mapped range, access is 0 if buffer is not mapped.
+	void					setMapping			(int offset, int length, deUint32 access)	{ m_mapOffset = offset; m_mapLength = length; m_mapAccess = access;	}
+	bool					isMapped			(void) const	{ return m_mapAccess != 0;	}
+	int						getMapOffset		(void) const	{ return m_mapOffset;		}
+	int						getMapLength		(void) const	{ return m_mapLength;		}
+	deUint32				getMapAccess		(void) const	{ return m_mapAccess;		}
+
 private:
 	std::vector<deUint8>	m_data;
+	int						m_mapOffset;
+	int						m_mapLength;
+	deUint32				m_mapAccess;
 };
 
 class VertexArray : public NamedObject
@@ -641,6 +651,10 @@ public:
 	virtual void			texStorage3D			(deUint32 target, int levels, deUint32 internalFormat, int width, int height, int depth);
 
 	virtual void			texParameteri			(deUint32 target, deUint32 pname, int value);
+	void					texParameterf			(deUint32 target, deUint32 pname, float value);
+	void					texParameteriv			(deUint32 target, deUint32 pname, const int* values);
+	void					texParameterfv			(deUint32 target, deUint32 pname, const float* values);
+	bool					isTexture				(deUint32 texture);
 
 	virtual void			framebufferTexture2D	(deUint32 target, deUint32 attachment, deUint32 textarget, deUint32 texture, int level);
 	virtual void			framebufferTextureLayer	(deUint32 target, deUint32 attachment, deUint32 texture, int level, int layer);
@@ -658,6 +672,9 @@ public:
 
 	virtual void			bufferData				(deUint32 target, deIntptr size, const void* data, deUint32 usage);
 	virtual void			bufferSubData			(deUint32 target, deIntptr offset, deIntptr size, const void* data);
+	void*					mapBufferRange			(deUint32 target, deIntptr offset, deIntptr length, deUint32 access);
+	bool					unmapBuffer				(deUint32 target);
+	void					flushMappedBufferRange	(deUint32 target, deIntptr offset, deIntptr length);
 
 	virtual void			clearColor				(float red, float green, float blue, float alpha);
 	virtual void			clearDepthf				(float depth);
@@ -763,6 +780,9 @@ public:
 	virtual void			getIntegerv				(deUint32 pname, int* params);
 	virtual const char*		getString				(deUint32 pname);
 
+	//! Query integer state without raising an error. Returns false if state is not tracked by the context.
+	bool					getIntegerState			(deUint32 pname, int* params);
+
 	// Expose helpers from Context.
 	using Context::readPixels;
 	using Context::texImage2D;
@@ -805,6 +825,8 @@ private:
 	void					setTex3DBinding			(int unit, rc::Texture3D*			tex3D);
 	void					setTexCubeArrayBinding	(int unit, rc::TextureCubeArray*	texCubeArray);
 
+	rc::Texture*			getParameterTexture		(deUint32 target);
+
 	void					setBufferBinding		(deUint32 target, rc::DataBuffer* buffer);
 	rc::DataBuffer*			getBufferBinding		(deUint32 target) const;
 
@@ -0,0 +1,704 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief GL functions backed by sglr::ReferenceContext.
+ *//*--------------------------------------------------------------------*/
+
+#include "sglrReferenceFunctions.hpp"
+#include "sglrReferenceContext.hpp"
+#include "gluRenderContext.hpp"
+#include "tcuRenderTarget.hpp"
+#include "glwFunctions.hpp"
+#include "deThreadLocal.hpp"
+#include "glwEnums.hpp"
+
+namespace sglr
+{
+
+using namespace glw;
+
+class ReferenceState
+{
+public:
+								ReferenceState	(const glu::RenderContext& baseContext);
+
+	const glGetErrorFunc		baseGetError;
+	const glGetIntegervFunc		baseGetIntegerv;
+
+	ReferenceContextLimits		limits;
+	ReferenceContextBuffers		buffers;
+	ReferenceContext			context;
+};
+
+ReferenceState::ReferenceState (const glu::RenderContext& baseContext)
+	: baseGetError		(baseContext.getFunctions().getError)
+	, baseGetIntegerv	(baseContext.getFunctions().getIntegerv)
+	, limits			(baseContext)
+	, buffers			(baseContext.getRenderTarget().getPixelFormat(),
+						 baseContext.getRenderTarget().getDepthBits(),
+						 baseContext.getRenderTarget().getStencilBits(),
+						 baseContext.getRenderTarget().getWidth(),
+						 baseContext.getRenderTarget().getHeight(),
+						 de::max(1, baseContext.getRenderTarget().getNumSamples()))
+	, context			(limits, buffers.getColorbuffer(), buffers.getDepthbuffer(), buffers.getStencilbuffer())
+{
+}
+
+static de::ThreadLocal s_currentState;
+
+namespace
+{
+
+void setCurrentState (ReferenceState* state)
+{
+	s_currentState.set((void*)state);
+}
+
+ReferenceState* getCurrentState (void)
+{
+	return (ReferenceState*)s_currentState.get();
+}
+
+ReferenceContext& getCurrentContext (void)
+{
+	return getCurrentState()->context;
+}
+
+GLW_APICALL GLenum GLW_APIENTRY glGetError (void)
+{
+	ReferenceState* const	state	= getCurrentState();
+	const GLenum			err		= state->context.getError();
+
+	// Errors raised by the base context functions are reported after ones from the reference context.
+	return (err != GL_NO_ERROR) ? err : state->baseGetError();
+}
+
+GLW_APICALL void GLW_APIENTRY glGetIntegerv (GLenum pname, GLint* data)
+{
+	ReferenceState* const state = getCurrentState();
+
+	// State not tracked by the reference context, such as limits, comes from the base context.
+	if (!state->context.getIntegerState(pname, data))
+		state->baseGetIntegerv(pname, data);
+}
+
+GLW_APICALL void GLW_APIENTRY glFinish (void)
+{
+	getCurrentContext().finish();
+}
+
+GLW_APICALL void GLW_APIENTRY glViewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	getCurrentContext().viewport(x, y, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glActiveTexture (GLenum texture)
+{
+	getCurrentContext().activeTexture(texture);
+}
+
+GLW_APICALL void GLW_APIENTRY glBindTexture (GLenum target, GLuint texture)
+{
+	getCurrentContext().bindTexture(target, texture);
+}
+
+GLW_APICALL void GLW_APIENTRY glGenTextures (GLsizei n, GLuint* textures)
+{
+	getCurrentContext().genTextures(n, textures);
+}
+
+GLW_APICALL void GLW_APIENTRY glDeleteTextures (GLsizei n, const GLuint* textures)
+{
+	getCurrentContext().deleteTextures(n, textures);
+}
+
+GLW_APICALL void GLW_APIENTRY glBindFramebuffer (GLenum target, GLuint framebuffer)
+{
+	getCurrentContext().bindFramebuffer(target, framebuffer);
+}
+
+GLW_APICALL void GLW_APIENTRY glGenFramebuffers (GLsizei n, GLuint* framebuffers)
+{
+	getCurrentContext().genFramebuffers(n, framebuffers);
+}
+
+GLW_APICALL void GLW_APIENTRY glDeleteFramebuffers (GLsizei n, const GLuint* framebuffers)
+{
+	getCurrentContext().deleteFramebuffers(n, framebuffers);
+}
+
+GLW_APICALL void GLW_APIENTRY glBindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+	getCurrentContext().bindRenderbuffer(target, renderbuffer);
+}
+
+GLW_APICALL void GLW_APIENTRY glGenRenderbuffers (GLsizei n, GLuint* renderbuffers)
+{
+	getCurrentContext().genRenderbuffers(n, renderbuffers);
+}
+
+GLW_APICALL void GLW_APIENTRY glDeleteRenderbuffers (GLsizei n, const GLuint* renderbuffers)
+{
+	getCurrentContext().deleteRenderbuffers(n, renderbuffers);
+}
+
+GLW_APICALL void GLW_APIENTRY glPixelStorei (GLenum pname, GLint param)
+{
+	getCurrentContext().pixelStorei(pname, param);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+	getCurrentContext().texImage1D(target, level, (deUint32)internalformat, width, border, format, type, pixels);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+	getCurrentContext().texImage2D(target, level, (deUint32)internalformat, width, height, border, format, type, pixels);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+	getCurrentContext().texImage3D(target, level, (deUint32)internalformat, width, height, depth, border, format, type, pixels);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels)
+{
+	getCurrentContext().texSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+	getCurrentContext().texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels)
+{
+	getCurrentContext().texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+GLW_APICALL void GLW_APIENTRY glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+	getCurrentContext().copyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+GLW_APICALL void GLW_APIENTRY glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+	getCurrentContext().copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+GLW_APICALL void GLW_APIENTRY glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+	getCurrentContext().copyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+GLW_APICALL void GLW_APIENTRY glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	getCurrentContext().copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	getCurrentContext().copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	getCurrentContext().texStorage2D(target, levels, internalformat, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	getCurrentContext().texStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexParameteri (GLenum target, GLenum pname, GLint param)
+{
+	getCurrentContext().texParameteri(target, pname, param);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexParameterf (GLenum target, GLenum pname, GLfloat param)
+{
+	getCurrentContext().texParameterf(target, pname, param);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexParameteriv (GLenum target, GLenum pname, const GLint* params)
+{
+	getCurrentContext().texParameteriv(target, pname, params);
+}
+
+GLW_APICALL void GLW_APIENTRY glTexParameterfv (GLenum target, GLenum pname, const GLfloat* params)
+{
+	getCurrentContext().texParameterfv(target, pname, params);
+}
+
+GLW_APICALL GLboolean GLW_APIENTRY glIsTexture (GLuint texture)
+{
+	return getCurrentContext().isTexture(texture) ? GL_TRUE : GL_FALSE;
+}
+
+GLW_APICALL void GLW_APIENTRY glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	getCurrentContext().framebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+GLW_APICALL void GLW_APIENTRY glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+	getCurrentContext().framebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+GLW_APICALL void GLW_APIENTRY glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	getCurrentContext().framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+GLW_APICALL GLenum GLW_APIENTRY glCheckFramebufferStatus (GLenum target)
+{
+	return getCurrentContext().checkFramebufferStatus(target);
+}
+
+GLW_APICALL void GLW_APIENTRY glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint* params)
+{
+	getCurrentContext().getFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+GLW_APICALL void GLW_APIENTRY glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	getCurrentContext().renderbufferStorage(target, internalformat, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	getCurrentContext().renderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glBindBuffer (GLenum target, GLuint buffer)
+{
+	getCurrentContext().bindBuffer(target, buffer);
+}
+
+GLW_APICALL void GLW_APIENTRY glGenBuffers (GLsizei n, GLuint* buffers)
+{
+	getCurrentContext().genBuffers(n, buffers);
+}
+
+GLW_APICALL void GLW_APIENTRY glDeleteBuffers (GLsizei n, const GLuint* buffers)
+{
+	getCurrentContext().deleteBuffers(n, buffers);
+}
+
+GLW_APICALL void GLW_APIENTRY glBufferData (GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+	getCurrentContext().bufferData(target, (deIntptr)size, data, usage);
+}
+
+GLW_APICALL void GLW_APIENTRY glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+	getCurrentContext().bufferSubData(target, (deIntptr)offset, (deIntptr)size, data);
+}
+
+GLW_APICALL void* GLW_APIENTRY glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	return getCurrentContext().mapBufferRange(target, (deIntptr)offset, (deIntptr)length, access);
+}
+
+GLW_APICALL GLboolean GLW_APIENTRY glUnmapBuffer (GLenum target)
+{
+	return getCurrentContext().unmapBuffer(target) ? GL_TRUE : GL_FALSE;
+}
+
+GLW_APICALL void GLW_APIENTRY glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+	getCurrentContext().flushMappedBufferRange(target, (deIntptr)offset, (deIntptr)length);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	getCurrentContext().clearColor(red, green, blue, alpha);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearDepthf (GLfloat d)
+{
+	getCurrentContext().clearDepthf(d);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearStencil (GLint s)
+{
+	getCurrentContext().clearStencil(s);
+}
+
+GLW_APICALL void GLW_APIENTRY glClear (GLbitfield mask)
+{
+	getCurrentContext().clear(mask);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint* value)
+{
+	getCurrentContext().clearBufferiv(buffer, drawbuffer, value);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat* value)
+{
+	getCurrentContext().clearBufferfv(buffer, drawbuffer, value);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint* value)
+{
+	getCurrentContext().clearBufferuiv(buffer, drawbuffer, value);
+}
+
+GLW_APICALL void GLW_APIENTRY glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+	getCurrentContext().clearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+GLW_APICALL void GLW_APIENTRY glScissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	getCurrentContext().scissor(x, y, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glEnable (GLenum cap)
+{
+	getCurrentContext().enable(cap);
+}
+
+GLW_APICALL void GLW_APIENTRY glDisable (GLenum cap)
+{
+	getCurrentContext().disable(cap);
+}
+
+GLW_APICALL void GLW_APIENTRY glStencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+	getCurrentContext().stencilFunc(func, ref, mask);
+}
+
+GLW_APICALL void GLW_APIENTRY glStencilOp (GLenum fail, GLenum zfail, GLenum zpass)
+{
+	getCurrentContext().stencilOp(fail, zfail, zpass);
+}
+
+GLW_APICALL void GLW_APIENTRY glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+	getCurrentContext().stencilFuncSeparate(face, func, ref, mask);
+}
+
+GLW_APICALL void GLW_APIENTRY glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+	getCurrentContext().stencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+GLW_APICALL void GLW_APIENTRY glDepthFunc (GLenum func)
+{
+	getCurrentContext().depthFunc(func);
+}
+
+GLW_APICALL void GLW_APIENTRY glDepthRangef (GLfloat n, GLfloat f)
+{
+	getCurrentContext().depthRangef(n, f);
+}
+
+GLW_APICALL void GLW_APIENTRY glDepthRange (GLdouble n, GLdouble f)
+{
+	getCurrentContext().depthRange(n, f);
+}
+
+GLW_APICALL void GLW_APIENTRY glPolygonOffset (GLfloat factor, GLfloat units)
+{
+	getCurrentContext().polygonOffset(factor, units);
+}
+
+GLW_APICALL void GLW_APIENTRY glProvokingVertex (GLenum mode)
+{
+	getCurrentContext().provokingVertex(mode);
+}
+
+GLW_APICALL void GLW_APIENTRY glPrimitiveRestartIndex (GLuint index)
+{
+	getCurrentContext().primitiveRestartIndex(index);
+}
+
+GLW_APICALL void GLW_APIENTRY glBlendEquation (GLenum mode)
+{
+	getCurrentContext().blendEquation(mode);
+}
+
+GLW_APICALL void GLW_APIENTRY glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+	getCurrentContext().blendEquationSeparate(modeRGB, modeAlpha);
+}
+
+GLW_APICALL void GLW_APIENTRY glBlendFunc (GLenum sfactor, GLenum dfactor)
+{
+	getCurrentContext().blendFunc(sfactor, dfactor);
+}
+
+GLW_APICALL void GLW_APIENTRY glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+	getCurrentContext().blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+GLW_APICALL void GLW_APIENTRY glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	getCurrentContext().blendColor(red, green, blue, alpha);
+}
+
+GLW_APICALL void GLW_APIENTRY glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+	getCurrentContext().colorMask((deBool)red, (deBool)green, (deBool)blue, (deBool)alpha);
+}
+
+GLW_APICALL void GLW_APIENTRY glDepthMask (GLboolean flag)
+{
+	getCurrentContext().depthMask((deBool)flag);
+}
+
+GLW_APICALL void GLW_APIENTRY glStencilMask (GLuint mask)
+{
+	getCurrentContext().stencilMask(mask);
+}
+
+GLW_APICALL void GLW_APIENTRY glStencilMaskSeparate (GLenum face, GLuint mask)
+{
+	getCurrentContext().stencilMaskSeparate(face, mask);
+}
+
+GLW_APICALL void GLW_APIENTRY glLineWidth (GLfloat width)
+{
+	getCurrentContext().lineWidth(width);
+}
+
+GLW_APICALL void GLW_APIENTRY glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+	getCurrentContext().blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+GLW_APICALL void GLW_APIENTRY glInvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	getCurrentContext().invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+GLW_APICALL void GLW_APIENTRY glInvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum* attachments)
+{
+	getCurrentContext().invalidateFramebuffer(target, numAttachments, attachments);
+}
+
+GLW_APICALL void GLW_APIENTRY glBindVertexArray (GLuint array)
+{
+	getCurrentContext().bindVertexArray(array);
+}
+
+GLW_APICALL void GLW_APIENTRY glGenVertexArrays (GLsizei n, GLuint* arrays)
+{
+	getCurrentContext().genVertexArrays(n, arrays);
+}
+
+GLW_APICALL void GLW_APIENTRY glDeleteVertexArrays (GLsizei n, const GLuint* arrays)
+{
+	getCurrentContext().deleteVertexArrays(n, arrays);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+	getCurrentContext().vertexAttribPointer(index, size, type, (deBool)normalized, stride, pointer);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
+{
+	getCurrentContext().vertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+GLW_APICALL void GLW_APIENTRY glEnableVertexAttribArray (GLuint index)
+{
+	getCurrentContext().enableVertexAttribArray(index);
+}
+
+GLW_APICALL void GLW_APIENTRY glDisableVertexAttribArray (GLuint index)
+{
+	getCurrentContext().disableVertexAttribArray(index);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttribDivisor (GLuint index, GLuint divisor)
+{
+	getCurrentContext().vertexAttribDivisor(index, divisor);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttrib1f (GLuint index, GLfloat x)
+{
+	getCurrentContext().vertexAttrib1f(index, x);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+	getCurrentContext().vertexAttrib2f(index, x, y);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+	getCurrentContext().vertexAttrib3f(index, x, y, z);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+	getCurrentContext().vertexAttrib4f(index, x, y, z, w);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+	getCurrentContext().vertexAttribI4i(index, x, y, z, w);
+}
+
+GLW_APICALL void GLW_APIENTRY glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+	getCurrentContext().vertexAttribI4ui(index, x, y, z, w);
+}
+
+GLW_APICALL void GLW_APIENTRY glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid* pixels)
+{
+	getCurrentContext().readPixels(x, y, width, height, format, type, pixels);
+}
+
+void initReferenceFunctions (glw::Functions* gl)
+{
+	gl->getError							= glGetError;
+	gl->getIntegerv							= glGetIntegerv;
+	gl->finish								= glFinish;
+	gl->viewport							= glViewport;
+	gl->activeTexture						= glActiveTexture;
+	gl->bindTexture							= glBindTexture;
+	gl->genTextures							= glGenTextures;
+	gl->deleteTextures						= glDeleteTextures;
+	gl->bindFramebuffer						= glBindFramebuffer;
+	gl->genFramebuffers						= glGenFramebuffers;
+	gl->deleteFramebuffers					= glDeleteFramebuffers;
+	gl->bindRenderbuffer					= glBindRenderbuffer;
+	gl->genRenderbuffers					= glGenRenderbuffers;
+	gl->deleteRenderbuffers					= glDeleteRenderbuffers;
+	gl->pixelStorei							= glPixelStorei;
+	gl->texImage1D							= glTexImage1D;
+	gl->texImage2D							= glTexImage2D;
+	gl->texImage3D							= glTexImage3D;
+	gl->texSubImage1D						= glTexSubImage1D;
+	gl->texSubImage2D						= glTexSubImage2D;
+	gl->texSubImage3D						= glTexSubImage3D;
+	gl->copyTexImage1D						= glCopyTexImage1D;
+	gl->copyTexImage2D						= glCopyTexImage2D;
+	gl->copyTexSubImage1D					= glCopyTexSubImage1D;
+	gl->copyTexSubImage2D					= glCopyTexSubImage2D;
+	gl->copyTexSubImage3D					= glCopyTexSubImage3D;
+	gl->texStorage2D						= glTexStorage2D;
+	gl->texStorage3D						= glTexStorage3D;
+	gl->texParameteri						= glTexParameteri;
+	gl->texParameterf						= glTexParameterf;
+	gl->texParameteriv						= glTexParameteriv;
+	gl->texParameterfv						= glTexParameterfv;
+	gl->isTexture							= glIsTexture;
+	gl->framebufferTexture2D				= glFramebufferTexture2D;
+	gl->framebufferTextureLayer				= glFramebufferTextureLayer;
+	gl->framebufferRenderbuffer				= glFramebufferRenderbuffer;
+	gl->checkFramebufferStatus				= glCheckFramebufferStatus;
+	gl->getFramebufferAttachmentParameteriv	= glGetFramebufferAttachmentParameteriv;
+	gl->renderbufferStorage					= glRenderbufferStorage;
+	gl->renderbufferStorageMultisample		= glRenderbufferStorageMultisample;
+	gl->bindBuffer							= glBindBuffer;
+	gl->genBuffers							= glGenBuffers;
+	gl->deleteBuffers						= glDeleteBuffers;
+	gl->bufferData							= glBufferData;
+	gl->bufferSubData						= glBufferSubData;
+	gl->mapBufferRange						= glMapBufferRange;
+	gl->unmapBuffer							= glUnmapBuffer;
+	gl->flushMappedBufferRange				= glFlushMappedBufferRange;
+	gl->clearColor							= glClearColor;
+	gl->clearDepthf							= glClearDepthf;
+	gl->clearStencil						= glClearStencil;
+	gl->clear								= glClear;
+	gl->clearBufferiv						= glClearBufferiv;
+	gl->clearBufferfv						= glClearBufferfv;
+	gl->clearBufferuiv						= glClearBufferuiv;
+	gl->clearBufferfi						= glClearBufferfi;
+	gl->scissor								= glScissor;
+	gl->enable								= glEnable;
+	gl->disable								= glDisable;
+	gl->stencilFunc							= glStencilFunc;
+	gl->stencilOp							= glStencilOp;
+	gl->stencilFuncSeparate					= glStencilFuncSeparate;
+	gl->stencilOpSeparate					= glStencilOpSeparate;
+	gl->depthFunc							= glDepthFunc;
+	gl->depthRangef							= glDepthRangef;
+	gl->depthRange							= glDepthRange;
+	gl->polygonOffset						= glPolygonOffset;
+	gl->provokingVertex						= glProvokingVertex;
+	gl->primitiveRestartIndex				= glPrimitiveRestartIndex;
+	gl->blendEquation						= glBlendEquation;
+	gl->blendEquationSeparate				= glBlendEquationSeparate;
+	gl->blendFunc							= glBlendFunc;
+	gl->blendFuncSeparate					= glBlendFuncSeparate;
+	gl->blendColor							= glBlendColor;
+	gl->colorMask							= glColorMask;
+	gl->depthMask							= glDepthMask;
+	gl->stencilMask							= glStencilMask;
+	gl->stencilMaskSeparate					= glStencilMaskSeparate;
+	gl->lineWidth							= glLineWidth;
+	gl->blitFramebuffer						= glBlitFramebuffer;
+	gl->invalidateSubFramebuffer			= glInvalidateSubFramebuffer;
+	gl->invalidateFramebuffer				= glInvalidateFramebuffer;
+	gl->bindVertexArray						= glBindVertexArray;
+	gl->genVertexArrays						= glGenVertexArrays;
+	gl->deleteVertexArrays					= glDeleteVertexArrays;
+	gl->vertexAttribPointer					= glVertexAttribPointer;
+	gl->vertexAttribIPointer				= glVertexAttribIPointer;
+	gl->enableVertexAttribArray				= glEnableVertexAttribArray;
+	gl->disableVertexAttribArray			= glDisableVertexAttribArray;
+	gl->vertexAttribDivisor					= glVertexAttribDivisor;
+	gl->vertexAttrib1f						= glVertexAttrib1f;
+	gl->vertexAttrib2f						= glVertexAttrib2f;
+	gl->vertexAttrib3f						= glVertexAttrib3f;
+	gl->vertexAttrib4f						= glVertexAttrib4f;
+	gl->vertexAttribI4i						= glVertexAttribI4i;
+	gl->vertexAttribI4ui					= glVertexAttribI4ui;
+	gl->readPixels							= glReadPixels;
+}
+
+} // anonymous
+
+ReferenceFunctions::ReferenceFunctions (const glu::RenderContext& baseContext)
+	: m_state		(DE_NULL)
+	, m_functions	(baseContext.getFunctions())
+{
+	// Functions that ReferenceContext doesn't implement fall back to base context
+	m_state = new ReferenceState(baseContext);
+
+	initReferenceFunctions(&m_functions);
+	setCurrentState(m_state);
+}
+
+ReferenceFunctions::~ReferenceFunctions (void)
+{
+	if (getCurrentState() == m_state)
+		setCurrentState(DE_NULL);
+
+	delete m_state;
+}
+
+void ReferenceFunctions::makeCurrent (void)
+{
+	setCurrentState(m_state);
+}
+
+} // sglr
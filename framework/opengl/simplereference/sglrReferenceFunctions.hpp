@@ -0,0 +1,70 @@
+#ifndef _SGLRREFERENCEFUNCTIONS_HPP
+#define _SGLRREFERENCEFUNCTIONS_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief GL functions backed by sglr::ReferenceContext.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "glwFunctions.hpp"
+
+namespace glu
+{
+class RenderContext;
+}
+
+namespace sglr
+{
+
+class ReferenceState;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief GL function table backed by ReferenceContext
+ *
+ * Framebuffer, texture, buffer, vertex array and fragment operation state
+ * functions as well as integer state queries are routed to a
+ * ReferenceContext which renders into CPU-side buffers matching the
+ * render target of the base context. All other functions, and queries of
+ * state ReferenceContext doesn't track, are forwarded to the base context.
+ *
+ * Functions operate on the state made current on the calling thread with
+ * makeCurrent(). Constructor makes the new state current.
+ *//*--------------------------------------------------------------------*/
+class ReferenceFunctions
+{
+public:
+	explicit				ReferenceFunctions	(const glu::RenderContext& baseContext);
+							~ReferenceFunctions	(void);
+
+	const glw::Functions&	getFunctions		(void) const	{ return m_functions;	}
+	void					makeCurrent			(void);
+
+private:
+							ReferenceFunctions	(const ReferenceFunctions& other);
+	ReferenceFunctions&		operator=			(const ReferenceFunctions& other);
+
+	ReferenceState*			m_state;
+	glw::Functions			m_functions;
+};
+
+} // sglr
+
+#endif // _SGLRREFERENCEFUNCTIONS_HPP
@@ -38,6 +38,13 @@ public:
 	glu::RenderContext*	createContext			(const glu::RenderConfig& config, const tcu::CommandLine&) const;
 };
 
+class ReferenceGLContextFactory : public glu::ContextFactory
+{
+public:
+						ReferenceGLContextFactory	(void);
+	glu::RenderContext*	createContext				(const glu::RenderConfig& config, const tcu::CommandLine&) const;
+};
+
 } // null
 } // tcu
 
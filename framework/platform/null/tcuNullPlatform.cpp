@@ -74,6 +74,7 @@ public:
 Platform::Platform (void)
 {
 	m_contextFactoryRegistry.registerFactory(new NullGLContextFactory());
+	m_contextFactoryRegistry.registerFactory(new ReferenceGLContextFactory());
 	m_nativeDisplayFactoryRegistry.registerFactory(new NullEGLDisplayFactory());
 }
 
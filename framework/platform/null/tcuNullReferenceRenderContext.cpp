@@ -0,0 +1,51 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Render context implementation backed by the reference renderer.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuNullReferenceRenderContext.hpp"
+
+namespace tcu
+{
+namespace null
+{
+
+ReferenceRenderContext::ReferenceRenderContext (const glu::RenderConfig& config)
+	: m_nullContext	(config)
+	, m_reference	(m_nullContext)
+{
+}
+
+ReferenceRenderContext::~ReferenceRenderContext (void)
+{
+}
+
+void ReferenceRenderContext::postIterate (void)
+{
+}
+
+void ReferenceRenderContext::makeCurrent (void)
+{
+	m_reference.makeCurrent();
+}
+
+} // null
+} // tcu
@@ -0,0 +1,75 @@
+#ifndef _TCUNULLREFERENCERENDERCONTEXT_HPP
+#define _TCUNULLREFERENCERENDERCONTEXT_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Render context implementation backed by the reference renderer.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuNullRenderContext.hpp"
+#include "sglrReferenceFunctions.hpp"
+
+namespace tcu
+{
+namespace null
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Software render context.
+ *
+ * Reference render context routes framebuffer, texture, buffer, vertex
+ * array and fragment operation state functions as well as integer state
+ * queries to sglr::ReferenceContext (see sglr::ReferenceFunctions) which
+ * renders into a CPU-side default framebuffer. Clears, texture uploads,
+ * copies, blits and glReadPixels() thus produce real results.
+ *
+ * ReferenceContext executes sglr::ShaderProgram objects instead of GLSL,
+ * so shader and program objects as well as draw calls are handled by the
+ * dummy render context like everything else ReferenceContext doesn't
+ * implement.
+ *//*--------------------------------------------------------------------*/
+class ReferenceRenderContext : public glu::RenderContext
+{
+public:
+										ReferenceRenderContext	(const glu::RenderConfig& config);
+	virtual								~ReferenceRenderContext	(void);
+
+	virtual glu::ContextType			getType					(void) const	{ return m_nullContext.getType();			}
+	virtual const glw::Functions&		getFunctions			(void) const	{ return m_reference.getFunctions();		}
+	virtual const tcu::RenderTarget&	getRenderTarget			(void) const	{ return m_nullContext.getRenderTarget();	}
+	virtual deUint32					getDefaultFramebuffer	(void) const	{ return 0;									}
+
+	virtual void						postIterate				(void);
+
+	virtual void						makeCurrent				(void);
+
+private:
+										ReferenceRenderContext	(const ReferenceRenderContext& other);
+	ReferenceRenderContext&				operator=				(const ReferenceRenderContext& other);
+
+	null::RenderContext					m_nullContext;
+	sglr::ReferenceFunctions			m_reference;
+};
+
+} // null
+} // tcu
+
+#endif // _TCUNULLREFERENCERENDERCONTEXT_HPP
@@ -0,0 +1,315 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Helper Library
+ * -------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Compact binary test log writer.
+ *//*--------------------------------------------------------------------*/
+
+#include "qpBinaryLogWriter.h"
+
+#include "deMemory.h"
+
+#include <string.h>
+
+struct qpBinaryLogWriter_s
+{
+	FILE*		outputFile;
+	deBool		flushAfterWrite;
+
+	/* Payload of the record being built. */
+	deUint8*	payload;
+	size_t		payloadSize;
+	size_t		payloadCapacity;
+	deBool		isOutOfMemory;
+};
+
+static void reservePayload (qpBinaryLogWriter* writer, size_t numBytes)
+{
+	const size_t requiredSize = writer->payloadSize + numBytes;
+
+	if (requiredSize > writer->payloadCapacity)
+	{
+		size_t		newCapacity	= writer->payloadCapacity > 0 ? writer->payloadCapacity : 256;
+		deUint8*	newPayload;
+
+		while (newCapacity < requiredSize)
+			newCapacity *= 2;
+
+		newPayload = (deUint8*)deRealloc(writer->payload, newCapacity);
+
+		if (!newPayload)
+		{
+			writer->isOutOfMemory = DE_TRUE;
+			return;
+		}
+
+		writer->payload			= newPayload;
+		writer->payloadCapacity	= newCapacity;
+	}
+}
+
+static void putBytes (qpBinaryLogWriter* writer, const void* data, size_t numBytes)
+{
+	if (numBytes == 0)
+		return;
+
+	reservePayload(writer, numBytes);
+
+	if (!writer->isOutOfMemory)
+	{
+		memcpy(writer->payload + writer->payloadSize, data, numBytes);
+		writer->payloadSize += numBytes;
+	}
+}
+
+static void putByte (qpBinaryLogWriter* writer, deUint8 value)
+{
+	putBytes(writer, &value, 1);
+}
+
+static size_t encodeVarint (deUint64 value, deUint8 dst[10])
+{
+	size_t numBytes = 0;
+
+	while (value >= 0x80)
+	{
+		dst[numBytes++] = (deUint8)(value | 0x80);
+		value >>= 7;
+	}
+
+	dst[numBytes++] = (deUint8)value;
+	return numBytes;
+}
+
+static void putVarint (qpBinaryLogWriter* writer, deUint64 value)
+{
+	deUint8			buf[10];
+	const size_t	numBytes	= encodeVarint(value, buf);
+
+	putBytes(writer, buf, numBytes);
+}
+
+static void putSignedVarint (qpBinaryLogWriter* writer, deInt64 value)
+{
+	/* Zig-zag encoding keeps small negative values short. */
+	putVarint(writer, ((deUint64)value << 1) ^ (deUint64)(value >> 63));
+}
+
+static void putString (qpBinaryLogWriter* writer, const char* str)
+{
+	const size_t length = str ? strlen(str) : 0;
+
+	putVarint(writer, length);
+	putBytes(writer, str, length);
+}
+
+static void putUint32 (qpBinaryLogWriter* writer, deUint32 value)
+{
+	deUint8	buf[4];
+	int		ndx;
+
+	for (ndx = 0; ndx < 4; ndx++)
+		buf[ndx] = (deUint8)(value >> (8*ndx));
+
+	putBytes(writer, buf, sizeof(buf));
+}
+
+static void putUint64 (qpBinaryLogWriter* writer, deUint64 value)
+{
+	deUint8	buf[8];
+	int		ndx;
+
+	for (ndx = 0; ndx < 8; ndx++)
+		buf[ndx] = (deUint8)(value >> (8*ndx));
+
+	putBytes(writer, buf, sizeof(buf));
+}
+
+/* Writes record with current payload followed by optional raw data and resets payload. */
+static deBool writeRecord (qpBinaryLogWriter* writer, qpBinaryLogTag tag, const deUint8* data, size_t dataSize)
+{
+	deUint8		header[11];
+	size_t		headerSize;
+	deBool		isOk;
+
+	if (writer->isOutOfMemory)
+	{
+		writer->payloadSize		= 0;
+		writer->isOutOfMemory	= DE_FALSE;
+		return DE_FALSE;
+	}
+
+	header[0]	= (deUint8)tag;
+	headerSize	= 1 + encodeVarint(writer->payloadSize + dataSize, &header[1]);
+
+	isOk = fwrite(header, 1, headerSize, writer->outputFile) == headerSize &&
+		   fwrite(writer->payload, 1, writer->payloadSize, writer->outputFile) == writer->payloadSize &&
+		   (dataSize == 0 || fwrite(data, 1, dataSize, writer->outputFile) == dataSize);
+
+	writer->payloadSize = 0;
+
+	if (writer->flushAfterWrite)
+		fflush(writer->outputFile);
+
+	return isOk;
+}
+
+qpBinaryLogWriter* qpBinaryLogWriter_createFileWriter (FILE* outputFile, deBool flushAfterWrite)
+{
+	qpBinaryLogWriter* writer = (qpBinaryLogWriter*)deCalloc(sizeof(qpBinaryLogWriter));
+	if (!writer)
+		return DE_NULL;
+
+	writer->outputFile		= outputFile;
+	writer->flushAfterWrite	= flushAfterWrite;
+
+	if (fwrite(QP_BINARY_LOG_MAGIC, 1, QP_BINARY_LOG_MAGIC_SIZE, outputFile) != QP_BINARY_LOG_MAGIC_SIZE)
+	{
+		qpBinaryLogWriter_destroy(writer);
+		return DE_NULL;
+	}
+
+	return writer;
+}
+
+void qpBinaryLogWriter_destroy (qpBinaryLogWriter* writer)
+{
+	DE_ASSERT(writer);
+
+	deFree(writer->payload);
+	deFree(writer);
+}
+
+deBool qpBinaryLogWriter_writeSessionInfo (qpBinaryLogWriter* writer, const char* attribute, const char* value)
+{
+	putString(writer, attribute);
+	putString(writer, value);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_SESSION_INFO, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_beginSession (qpBinaryLogWriter* writer)
+{
+	return writeRecord(writer, QP_BINARY_LOG_TAG_BEGIN_SESSION, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_endSession (qpBinaryLogWriter* writer)
+{
+	return writeRecord(writer, QP_BINARY_LOG_TAG_END_SESSION, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_beginTestCaseResult (qpBinaryLogWriter* writer, const char* casePath)
+{
+	putString(writer, casePath);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_BEGIN_TEST_CASE_RESULT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_endTestCaseResult (qpBinaryLogWriter* writer)
+{
+	return writeRecord(writer, QP_BINARY_LOG_TAG_END_TEST_CASE_RESULT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_terminateTestCaseResult (qpBinaryLogWriter* writer, const char* reason)
+{
+	putString(writer, reason);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_TERMINATE_TEST_CASE_RESULT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_startDocument (qpBinaryLogWriter* writer)
+{
+	return writeRecord(writer, QP_BINARY_LOG_TAG_START_DOCUMENT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_endDocument (qpBinaryLogWriter* writer)
+{
+	return writeRecord(writer, QP_BINARY_LOG_TAG_END_DOCUMENT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_startElement (qpBinaryLogWriter* writer, const char* elementName, int numAttribs, const qpXmlAttribute* attribs)
+{
+	int ndx;
+
+	putString(writer, elementName);
+	putVarint(writer, (deUint64)numAttribs);
+
+	for (ndx = 0; ndx < numAttribs; ndx++)
+	{
+		const qpXmlAttribute* attrib = &attribs[ndx];
+
+		putString(writer, attrib->name);
+		putByte(writer, (deUint8)attrib->type);
+
+		switch (attrib->type)
+		{
+			case QP_XML_ATTRIBUTE_STRING:	putString(writer, attrib->stringValue);				break;
+			case QP_XML_ATTRIBUTE_INT:		putSignedVarint(writer, attrib->intValue);			break;
+			case QP_XML_ATTRIBUTE_BOOL:		putByte(writer, attrib->boolValue ? 1 : 0);			break;
+			default:
+				DE_ASSERT(DE_FALSE);
+		}
+	}
+
+	return writeRecord(writer, QP_BINARY_LOG_TAG_START_ELEMENT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_endElement (qpBinaryLogWriter* writer, const char* elementName)
+{
+	putString(writer, elementName);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_END_ELEMENT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_writeString (qpBinaryLogWriter* writer, const char* content)
+{
+	return writeRecord(writer, QP_BINARY_LOG_TAG_STRING, (const deUint8*)content, strlen(content));
+}
+
+deBool qpBinaryLogWriter_writeInt64 (qpBinaryLogWriter* writer, deInt64 value)
+{
+	putSignedVarint(writer, value);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_INT64, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_writeFloat (qpBinaryLogWriter* writer, float value)
+{
+	deUint32 bits;
+
+	DE_STATIC_ASSERT(sizeof(bits) == sizeof(value));
+	memcpy(&bits, &value, sizeof(bits));
+
+	putUint32(writer, bits);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_FLOAT, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_writeDouble (qpBinaryLogWriter* writer, double value)
+{
+	deUint64 bits;
+
+	DE_STATIC_ASSERT(sizeof(bits) == sizeof(value));
+	memcpy(&bits, &value, sizeof(bits));
+
+	putUint64(writer, bits);
+	return writeRecord(writer, QP_BINARY_LOG_TAG_DOUBLE, DE_NULL, 0);
+}
+
+deBool qpBinaryLogWriter_writeData (qpBinaryLogWriter* writer, const deUint8* data, size_t numBytes)
+{
+	DE_ASSERT(data && numBytes > 0);
+
+	/* Data is written directly from caller's buffer to avoid copying large images. */
+	return writeRecord(writer, QP_BINARY_LOG_TAG_DATA, data, numBytes);
+}
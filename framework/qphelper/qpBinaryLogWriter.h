@@ -0,0 +1,121 @@
+#ifndef _QPBINARYLOGWRITER_H
+#define _QPBINARYLOGWRITER_H
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Helper Library
+ * -------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Compact binary test log writer.
+ *
+ * Binary log records the same sequence of container format and XML
+ * writer operations that qpTestLog would otherwise write as text. It can
+ * be converted back to a .qpa file that is byte-identical to the one
+ * the text backend would have produced.
+ *
+ * File starts with QP_BINARY_LOG_MAGIC followed by a sequence of records:
+ *
+ *   record    := tag:u8 payloadSize:varint payload
+ *   varint    := unsigned LEB128
+ *   svarint   := zig-zag encoded varint
+ *   string    := length:varint bytes (no terminator)
+ *
+ * Record payloads (see qpBinaryLogTag):
+ *
+ *   SESSION_INFO              string attribute, string value
+ *   BEGIN_TEST_CASE_RESULT    string casePath
+ *   TERMINATE_TEST_CASE_RESULT string reason
+ *   START_ELEMENT             string name, varint numAttribs,
+ *                             numAttribs * (string name, u8 type, value)
+ *                             where value is string, svarint or u8 bool
+ *   END_ELEMENT               string name
+ *   STRING                    bytes
+ *   INT64                     svarint
+ *   FLOAT                     u32, little-endian IEEE 754 bits
+ *   DOUBLE                    u64, little-endian IEEE 754 bits
+ *   DATA                      raw bytes, written as base64 in XML
+ *
+ * Other records have an empty payload. Readers must skip records with
+ * unknown tags.
+ *
+ * \note Executor has its own reader (xeBinaryLogParser), keep in sync.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+#include "qpXmlWriter.h"
+
+#include <stdio.h>
+
+DE_BEGIN_EXTERN_C
+
+typedef struct qpBinaryLogWriter_s	qpBinaryLogWriter;
+
+#define QP_BINARY_LOG_MAGIC			"\x89qpLog\r\n"
+#define QP_BINARY_LOG_MAGIC_SIZE	8
+
+typedef enum qpBinaryLogTag_e
+{
+	QP_BINARY_LOG_TAG_SESSION_INFO = 1,
+	QP_BINARY_LOG_TAG_BEGIN_SESSION,
+	QP_BINARY_LOG_TAG_END_SESSION,
+	QP_BINARY_LOG_TAG_BEGIN_TEST_CASE_RESULT,
+	QP_BINARY_LOG_TAG_END_TEST_CASE_RESULT,
+	QP_BINARY_LOG_TAG_TERMINATE_TEST_CASE_RESULT,
+	QP_BINARY_LOG_TAG_START_DOCUMENT,
+	QP_BINARY_LOG_TAG_END_DOCUMENT,
+	QP_BINARY_LOG_TAG_START_ELEMENT,
+	QP_BINARY_LOG_TAG_END_ELEMENT,
+	QP_BINARY_LOG_TAG_STRING,
+	QP_BINARY_LOG_TAG_INT64,
+	QP_BINARY_LOG_TAG_FLOAT,
+	QP_BINARY_LOG_TAG_DOUBLE,
+	QP_BINARY_LOG_TAG_DATA,
+
+	QP_BINARY_LOG_TAG_LAST
+} qpBinaryLogTag;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a file based binary log writer
+ * \param outputFile		Output file, must be opened in binary mode
+ * \param flushAfterWrite	Set to DE_TRUE to call fflush after each record
+ * \return qpBinaryLogWriter instance, or DE_NULL on failure
+ *//*--------------------------------------------------------------------*/
+qpBinaryLogWriter*	qpBinaryLogWriter_createFileWriter			(FILE* outputFile, deBool flushAfterWrite);
+void				qpBinaryLogWriter_destroy					(qpBinaryLogWriter* writer);
+
+/* Container format. */
+deBool				qpBinaryLogWriter_writeSessionInfo			(qpBinaryLogWriter* writer, const char* attribute, const char* value);
+deBool				qpBinaryLogWriter_beginSession				(qpBinaryLogWriter* writer);
+deBool				qpBinaryLogWriter_endSession				(qpBinaryLogWriter* writer);
+deBool				qpBinaryLogWriter_beginTestCaseResult		(qpBinaryLogWriter* writer, const char* casePath);
+deBool				qpBinaryLogWriter_endTestCaseResult			(qpBinaryLogWriter* writer);
+deBool				qpBinaryLogWriter_terminateTestCaseResult	(qpBinaryLogWriter* writer, const char* reason);
+
+/* Test case result document, see qpXmlWriter for semantics. */
+deBool				qpBinaryLogWriter_startDocument				(qpBinaryLogWriter* writer);
+deBool				qpBinaryLogWriter_endDocument				(qpBinaryLogWriter* writer);
+deBool				qpBinaryLogWriter_startElement				(qpBinaryLogWriter* writer, const char* elementName, int numAttribs, const qpXmlAttribute* attribs);
+deBool				qpBinaryLogWriter_endElement				(qpBinaryLogWriter* writer, const char* elementName);
+deBool				qpBinaryLogWriter_writeString				(qpBinaryLogWriter* writer, const char* content);
+deBool				qpBinaryLogWriter_writeInt64				(qpBinaryLogWriter* writer, deInt64 value);
+deBool				qpBinaryLogWriter_writeFloat				(qpBinaryLogWriter* writer, float value);
+deBool				qpBinaryLogWriter_writeDouble				(qpBinaryLogWriter* writer, double value);
+deBool				qpBinaryLogWriter_writeData					(qpBinaryLogWriter* writer, const deUint8* data, size_t numBytes);
+
+DE_END_EXTERN_C
+
+#endif /* _QPBINARYLOGWRITER_H */
@@ -23,6 +23,7 @@
 
 #include "qpTestLog.h"
 #include "qpXmlWriter.h"
+#include "qpBinaryLogWriter.h"
 #include "qpInfo.h"
 #include "qpDebugOut.h"
 
@@ -31,14 +32,17 @@
 #include "deString.h"
 
 #include "deMutex.h"
+#include "deAtomic.h"
 
 #if defined(QP_SUPPORT_PNG)
 #	include <png.h>
+#	include <zlib.h>
 #endif
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 
 #if (DE_OS == DE_OS_WIN32)
 #	include <windows.h>
@@ -128,15 +132,26 @@ struct qpTestLog_s
 
 	/* State protected by lock. */
 	FILE*					outputFile;
-	qpXmlWriter*			writer;
+	qpXmlWriter*			writer;				/*!< XML writer, or DE_NULL if writing binary log.	*/
+	qpBinaryLogWriter*		binaryWriter;		/*!< Binary writer if QP_TEST_LOG_BINARY_FORMAT.	*/
 	deBool					isSessionOpen;
 	deBool					isCaseOpen;
 
+	/* Image encoding state, not protected by lock. */
+	deMutex						encoderLock;		/*!< Lock for fastEncoder.							*/
+	struct PngFastEncoder_s*	fastEncoder;		/*!< Reused encoder if QP_TEST_LOG_IMAGE_ENCODER_FAST.	*/
+	char*						rawImagePrefix;		/*!< Path prefix for QP_TEST_LOG_IMAGE_RAW_FILES images.	*/
+	volatile deInt32			numRawImages;
+
 #if defined(DE_DEBUG)
 	ContainerStack			containerStack;		/*!< For container usage verification.	*/
 #endif
 };
 
+#if defined(QP_SUPPORT_PNG)
+static void PngFastEncoder_destroy (struct PngFastEncoder_s* encoder);
+#endif
+
 /* Maps integer to string. */
 typedef struct qpKeyStringMap_s
 {
@@ -289,17 +304,108 @@ DE_INLINE void doubleToString (double value, char* buf, size_t bufSize)
 	deSprintf(buf, bufSize, "%f", value);
 }
 
+/* Writer dispatch. Either XML or binary writer is used for the whole log. */
+
+static deBool logStartDocument (qpTestLog* log)
+{
+	return log->binaryWriter ? qpBinaryLogWriter_startDocument(log->binaryWriter) : qpXmlWriter_startDocument(log->writer);
+}
+
+static deBool logEndDocument (qpTestLog* log)
+{
+	return log->binaryWriter ? qpBinaryLogWriter_endDocument(log->binaryWriter) : qpXmlWriter_endDocument(log->writer);
+}
+
+static deBool logStartElement (qpTestLog* log, const char* elementName, int numAttribs, const qpXmlAttribute* attribs)
+{
+	return log->binaryWriter ? qpBinaryLogWriter_startElement(log->binaryWriter, elementName, numAttribs, attribs) : qpXmlWriter_startElement(log->writer, elementName, numAttribs, attribs);
+}
+
+static deBool logEndElement (qpTestLog* log, const char* elementName)
+{
+	return log->binaryWriter ? qpBinaryLogWriter_endElement(log->binaryWriter, elementName) : qpXmlWriter_endElement(log->writer, elementName);
+}
+
+static deBool logWriteString (qpTestLog* log, const char* content)
+{
+	return log->binaryWriter ? qpBinaryLogWriter_writeString(log->binaryWriter, content) : qpXmlWriter_writeString(log->writer, content);
+}
+
+static deBool logWriteStringElement (qpTestLog* log, const char* elementName, const char* elementContent)
+{
+	return logStartElement(log, elementName, 0, DE_NULL) &&
+		   (!elementContent || logWriteString(log, elementContent)) &&
+		   logEndElement(log, elementName);
+}
+
+static deBool logWriteData (qpTestLog* log, const deUint8* data, size_t numBytes)
+{
+	return log->binaryWriter ? qpBinaryLogWriter_writeData(log->binaryWriter, data, numBytes) : qpXmlWriter_writeBase64(log->writer, data, numBytes);
+}
+
+/* Numbers are stored in native form in binary logs and formatted identically when converted to XML. */
+
+static deBool logWriteInt64 (qpTestLog* log, deInt64 value)
+{
+	char tmpString[64];
+
+	if (log->binaryWriter)
+		return qpBinaryLogWriter_writeInt64(log->binaryWriter, value);
+
+	int64ToString(value, tmpString);
+	return qpXmlWriter_writeString(log->writer, tmpString);
+}
+
+static deBool logWriteFloat (qpTestLog* log, float value)
+{
+	char tmpString[64];
+
+	if (log->binaryWriter)
+		return qpBinaryLogWriter_writeFloat(log->binaryWriter, value);
+
+	floatToString(value, tmpString, sizeof(tmpString));
+	return qpXmlWriter_writeString(log->writer, tmpString);
+}
+
+static deBool logWriteDouble (qpTestLog* log, double value)
+{
+	char tmpString[512];
+
+	if (log->binaryWriter)
+		return qpBinaryLogWriter_writeDouble(log->binaryWriter, value);
+
+	doubleToString(value, tmpString, sizeof(tmpString));
+	return qpXmlWriter_writeString(log->writer, tmpString);
+}
+
+static void writeSessionInfo (qpTestLog* log, const char* attribute, const char* value)
+{
+	if (log->binaryWriter)
+		qpBinaryLogWriter_writeSessionInfo(log->binaryWriter, attribute, value);
+	else
+		fprintf(log->outputFile, "#sessionInfo %s %s\n", attribute, value);
+}
+
 static deBool beginSession (qpTestLog* log)
 {
+	char releaseIdStr[32];
+	char targetNameStr[256];
+
 	DE_ASSERT(log && !log->isSessionOpen);
 
+	deSprintf(releaseIdStr, sizeof(releaseIdStr), "0x%08x", qpGetReleaseId());
+	deSprintf(targetNameStr, sizeof(targetNameStr), "\"%s\"", qpGetTargetName());
+
 	/* Write session info. */
-	fprintf(log->outputFile, "#sessionInfo releaseName %s\n", qpGetReleaseName());
-	fprintf(log->outputFile, "#sessionInfo releaseId 0x%08x\n", qpGetReleaseId());
-	fprintf(log->outputFile, "#sessionInfo targetName \"%s\"\n", qpGetTargetName());
+	writeSessionInfo(log, "releaseName", qpGetReleaseName());
+	writeSessionInfo(log, "releaseId", releaseIdStr);
+	writeSessionInfo(log, "targetName", targetNameStr);
 
-    /* Write out #beginSession. */
-	fprintf(log->outputFile, "#beginSession\n");
+	/* Write out #beginSession. */
+	if (log->binaryWriter)
+		qpBinaryLogWriter_beginSession(log->binaryWriter);
+	else
+		fprintf(log->outputFile, "#beginSession\n");
 	qpTestLog_flushFile(log);
 
 	log->isSessionOpen = DE_TRUE;
@@ -311,11 +417,16 @@ static deBool endSession (qpTestLog* log)
 {
 	DE_ASSERT(log && log->isSessionOpen);
 
-    /* Make sure xml is flushed. */
-    qpXmlWriter_flush(log->writer);
+	if (log->binaryWriter)
+		qpBinaryLogWriter_endSession(log->binaryWriter);
+	else
+	{
+		/* Make sure xml is flushed. */
+		qpXmlWriter_flush(log->writer);
 
-    /* Write out #endSession. */
-	fprintf(log->outputFile, "\n#endSession\n");
+		/* Write out #endSession. */
+		fprintf(log->outputFile, "\n#endSession\n");
+	}
 	qpTestLog_flushFile(log);
 
 	log->isSessionOpen = DE_FALSE;
@@ -352,25 +463,54 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 	}
 
 	log->flags			= flags;
-	log->writer			= qpXmlWriter_createFileWriter(log->outputFile, 0, !(flags & QP_TEST_LOG_NO_FLUSH));
 	log->lock			= deMutex_create(DE_NULL);
+	log->encoderLock	= deMutex_create(DE_NULL);
 	log->isSessionOpen	= DE_FALSE;
 	log->isCaseOpen		= DE_FALSE;
 
-	if (!log->writer)
+	if (flags & QP_TEST_LOG_IMAGE_RAW_FILES)
+	{
+		/* Raw images are named <log file name without extension>-image<N>.<format> */
+		const char*	extension	= strrchr(fileName, '.');
+		size_t		prefixLen	= strlen(fileName);
+
+		if (extension && !strchr(extension, '/') && !strchr(extension, '\\'))
+			prefixLen = (size_t)(extension - fileName);
+
+		log->rawImagePrefix = (char*)deMalloc(prefixLen+1);
+		if (log->rawImagePrefix)
+		{
+			memcpy(log->rawImagePrefix, fileName, prefixLen);
+			log->rawImagePrefix[prefixLen] = 0;
+		}
+	}
+
+	if (flags & QP_TEST_LOG_BINARY_FORMAT)
+		log->binaryWriter	= qpBinaryLogWriter_createFileWriter(log->outputFile, !(flags & QP_TEST_LOG_NO_FLUSH));
+	else
+		log->writer			= qpXmlWriter_createFileWriter(log->outputFile, 0, !(flags & QP_TEST_LOG_NO_FLUSH));
+
+	if (!log->writer && !log->binaryWriter)
 	{
-		qpPrintf("ERROR: Unable to create output XML writer to file '%s'.\n", fileName);
+		qpPrintf("ERROR: Unable to create output log writer to file '%s'.\n", fileName);
 		qpTestLog_destroy(log);
 		return DE_NULL;
 	}
 
-	if (!log->lock)
+	if (!log->lock || !log->encoderLock)
 	{
 		qpPrintf("ERROR: Unable to create mutex.\n");
 		qpTestLog_destroy(log);
 		return DE_NULL;
 	}
 
+	if ((flags & QP_TEST_LOG_IMAGE_RAW_FILES) && !log->rawImagePrefix)
+	{
+		qpPrintf("ERROR: Out of memory.\n");
+		qpTestLog_destroy(log);
+		return DE_NULL;
+	}
+
 	beginSession(log);
 
 	return log;
@@ -390,12 +530,24 @@ void qpTestLog_destroy (qpTestLog* log)
 	if (log->writer)
 		qpXmlWriter_destroy(log->writer);
 
+	if (log->binaryWriter)
+		qpBinaryLogWriter_destroy(log->binaryWriter);
+
 	if (log->outputFile)
 		fclose(log->outputFile);
 
 	if (log->lock)
 		deMutex_destroy(log->lock);
 
+	if (log->encoderLock)
+		deMutex_destroy(log->encoderLock);
+
+#if defined(QP_SUPPORT_PNG)
+	if (log->fastEncoder)
+		PngFastEncoder_destroy(log->fastEncoder);
+#endif
+
+	deFree(log->rawImagePrefix);
 	deFree(log);
 }
 
@@ -419,8 +571,13 @@ deBool qpTestLog_startCase (qpTestLog* log, const char* testCasePath, qpTestCase
 	DE_ASSERT(ContainerStack_isEmpty(&log->containerStack));
 
 	/* Flush XML and write out #beginTestCaseResult. */
-	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#beginTestCaseResult %s\n", testCasePath);
+	if (log->binaryWriter)
+		qpBinaryLogWriter_beginTestCaseResult(log->binaryWriter, testCasePath);
+	else
+	{
+		qpXmlWriter_flush(log->writer);
+		fprintf(log->outputFile, "\n#beginTestCaseResult %s\n", testCasePath);
+	}
 	if (!(log->flags & QP_TEST_LOG_NO_FLUSH))
 		qpTestLog_flushFile(log);
 
@@ -431,8 +588,8 @@ deBool qpTestLog_startCase (qpTestLog* log, const char* testCasePath, qpTestCase
 	resultAttribs[numResultAttribs++] = qpSetStringAttrib("CasePath", testCasePath);
 	resultAttribs[numResultAttribs++] = qpSetStringAttrib("CaseType", typeStr);
 
-	if (!qpXmlWriter_startDocument(log->writer) ||
-		!qpXmlWriter_startElement(log->writer, "TestCaseResult", numResultAttribs, resultAttribs))
+	if (!logStartDocument(log) ||
+		!logStartElement(log, "TestCaseResult", numResultAttribs, resultAttribs))
 	{
 		qpPrintf("qpTestLog_startCase(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -463,11 +620,11 @@ deBool qpTestLog_endCase (qpTestLog* log, qpTestResult result, const char* resul
 	/* <Result StatusCode="Pass">Result details</Result>
 	 * </TestCaseResult>
 	 */
-	if (!qpXmlWriter_startElement(log->writer, "Result", 1, &statusAttrib) ||
-		(resultDetails && !qpXmlWriter_writeString(log->writer, resultDetails)) ||
-		!qpXmlWriter_endElement(log->writer, "Result") ||
-		!qpXmlWriter_endElement(log->writer, "TestCaseResult") ||
-		!qpXmlWriter_endDocument(log->writer))		/* Close any XML elements still open */
+	if (!logStartElement(log, "Result", 1, &statusAttrib) ||
+		(resultDetails && !logWriteString(log, resultDetails)) ||
+		!logEndElement(log, "Result") ||
+		!logEndElement(log, "TestCaseResult") ||
+		!logEndDocument(log))		/* Close any XML elements still open */
 	{
 		qpPrintf("qpTestLog_endCase(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -475,8 +632,13 @@ deBool qpTestLog_endCase (qpTestLog* log, qpTestResult result, const char* resul
 	}
 
 	/* Flush XML and write #endTestCaseResult. */
-	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#endTestCaseResult\n");
+	if (log->binaryWriter)
+		qpBinaryLogWriter_endTestCaseResult(log->binaryWriter);
+	else
+	{
+		qpXmlWriter_flush(log->writer);
+		fprintf(log->outputFile, "\n#endTestCaseResult\n");
+	}
 	if (!(log->flags & QP_TEST_LOG_NO_FLUSH))
 		qpTestLog_flushFile(log);
 
@@ -508,8 +670,13 @@ deBool qpTestLog_terminateCase (qpTestLog* log, qpTestResult result)
 	}
 
 	/* Flush XML and write #terminateTestCaseResult. */
-	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#terminateTestCaseResult %s\n", resultStr);
+	if (log->binaryWriter)
+		qpBinaryLogWriter_terminateTestCaseResult(log->binaryWriter, resultStr);
+	else
+	{
+		qpXmlWriter_flush(log->writer);
+		fprintf(log->outputFile, "\n#terminateTestCaseResult %s\n", resultStr);
+	}
 	qpTestLog_flushFile(log);
 
 	log->isCaseOpen = DE_FALSE;
@@ -522,13 +689,73 @@ deBool qpTestLog_terminateCase (qpTestLog* log, qpTestResult result)
 	return DE_TRUE;
 }
 
-static deBool qpTestLog_writeKeyValuePair (qpTestLog* log, const char* elementName, const char* name, const char* description, const char* unit, qpKeyValueTag tag, const char* text)
+typedef enum KeyValueType_e
+{
+	KEYVALUETYPE_TEXT = 0,
+	KEYVALUETYPE_INT64,
+	KEYVALUETYPE_FLOAT,
+
+	KEYVALUETYPE_LAST
+} KeyValueType;
+
+typedef struct KeyValue_s
+{
+	KeyValueType	type;
+	const char*		text;
+	deInt64			intValue;
+	float			floatValue;
+} KeyValue;
+
+DE_INLINE KeyValue textKeyValue (const char* text)
+{
+	KeyValue value;
+	value.type			= KEYVALUETYPE_TEXT;
+	value.text			= text;
+	value.intValue		= 0;
+	value.floatValue	= 0.0f;
+	return value;
+}
+
+DE_INLINE KeyValue int64KeyValue (deInt64 intValue)
+{
+	KeyValue value;
+	value.type			= KEYVALUETYPE_INT64;
+	value.text			= DE_NULL;
+	value.intValue		= intValue;
+	value.floatValue	= 0.0f;
+	return value;
+}
+
+DE_INLINE KeyValue floatKeyValue (float floatValue)
+{
+	KeyValue value;
+	value.type			= KEYVALUETYPE_FLOAT;
+	value.text			= DE_NULL;
+	value.intValue		= 0;
+	value.floatValue	= floatValue;
+	return value;
+}
+
+static deBool writeKeyValue (qpTestLog* log, const KeyValue* value)
+{
+	switch (value->type)
+	{
+		case KEYVALUETYPE_TEXT:		return logWriteString(log, value->text);
+		case KEYVALUETYPE_INT64:	return logWriteInt64(log, value->intValue);
+		case KEYVALUETYPE_FLOAT:	return logWriteFloat(log, value->floatValue);
+		default:
+			DE_ASSERT(DE_FALSE);
+			return DE_FALSE;
+	}
+}
+
+static deBool qpTestLog_writeKeyValuePair (qpTestLog* log, const char* elementName, const char* name, const char* description, const char* unit, qpKeyValueTag tag, KeyValue value)
 {
 	const char*		tagString = QP_LOOKUP_STRING(s_qpTagMap, tag);
 	qpXmlAttribute	attribs[8];
 	int				numAttribs = 0;
 
-	DE_ASSERT(log && elementName && text);
+	DE_ASSERT(log && elementName && (value.type != KEYVALUETYPE_TEXT || value.text));
 	deMutex_lock(log->lock);
 
 	/* Fill in attributes. */
@@ -537,9 +764,9 @@ static deBool qpTestLog_writeKeyValuePair (qpTestLog* log, const char* elementNa
 	if (tagString)		attribs[numAttribs++] = qpSetStringAttrib("Tag", tagString);
 	if (unit)			attribs[numAttribs++] = qpSetStringAttrib("Unit", unit);
 
-	if (!qpXmlWriter_startElement(log->writer, elementName, numAttribs, attribs) ||
-		!qpXmlWriter_writeString(log->writer, text) ||
-		!qpXmlWriter_endElement(log->writer, elementName))
+	if (!logStartElement(log, elementName, numAttribs, attribs) ||
+		!writeKeyValue(log, &value) ||
+		!logEndElement(log, elementName))
 	{
 		qpPrintf("qpTestLog_writeKeyValuePair(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -572,7 +799,7 @@ deBool qpTestLog_writeMessage (qpTestLog* log, const char* format, ...)
 	printf("%s\n", buffer);
 
 	/* <Text>text</Text> */
-	return qpTestLog_writeKeyValuePair(log, "Text", DE_NULL, DE_NULL, DE_NULL, QP_KEY_TAG_LAST, buffer);
+	return qpTestLog_writeKeyValuePair(log, "Text", DE_NULL, DE_NULL, DE_NULL, QP_KEY_TAG_LAST, textKeyValue(buffer));
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -587,7 +814,7 @@ deBool qpTestLog_writeMessage (qpTestLog* log, const char* format, ...)
 deBool qpTestLog_writeText (qpTestLog* log, const char* name, const char* description, qpKeyValueTag tag, const char* text)
 {
 	/* <Text Name="name" Description="description" Tag="tag">text</Text> */
-	return qpTestLog_writeKeyValuePair(log, "Text", name, description, DE_NULL, tag, text);
+	return qpTestLog_writeKeyValuePair(log, "Text", name, description, DE_NULL, tag, textKeyValue(text));
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -601,13 +828,10 @@ deBool qpTestLog_writeText (qpTestLog* log, const char* name, const char* descri
  *//*--------------------------------------------------------------------*/
 deBool qpTestLog_writeInteger (qpTestLog* log, const char* name, const char* description, const char* unit, qpKeyValueTag tag, deInt64 value)
 {
-	char tmpString[64];
-	int64ToString(value, tmpString);
-
 	printf("%s = %lld %s\n", description, (signed long long)value, unit ? unit : "");
 
 	/* <Number Name="name" Description="description" Tag="Performance">15</Number> */
-	return qpTestLog_writeKeyValuePair(log, "Number", name, description, unit, tag, tmpString);
+	return qpTestLog_writeKeyValuePair(log, "Number", name, description, unit, tag, int64KeyValue(value));
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -621,13 +845,10 @@ deBool qpTestLog_writeInteger (qpTestLog* log, const char* name, const char* des
  *//*--------------------------------------------------------------------*/
 deBool qpTestLog_writeFloat (qpTestLog* log, const char* name, const char* description, const char* unit, qpKeyValueTag tag, float value)
 {
-	char tmpString[64];
-	floatToString(value, tmpString, sizeof(tmpString));
-
 	printf("%s = %f %s\n", description, value, unit ? unit : "");
 
 	/* <Number Name="name" Description="description" Tag="Performance">15</Number> */
-	return qpTestLog_writeKeyValuePair(log, "Number", name, description, unit, tag, tmpString);
+	return qpTestLog_writeKeyValuePair(log, "Number", name, description, unit, tag, floatKeyValue(value));
 }
 
 typedef struct Buffer_s
@@ -717,7 +938,7 @@ static deBool writeCompressedPNG (png_structp png, png_infop info, png_byte** ro
 		return DE_FALSE;
 }
 
-static deBool compressImagePNG (Buffer* buffer, qpImageFormat imageFormat, int width, int height, int rowStride, const void* data)
+static deBool compressImagePNG (Buffer* buffer, qpImageFormat imageFormat, int width, int height, int rowStride, const void* data, int compressionLevel)
 {
 	deBool			compressOk		= DE_FALSE;
 	png_structp		png				= DE_NULL;
@@ -745,6 +966,9 @@ static deBool compressImagePNG (Buffer* buffer, qpImageFormat imageFormat, int w
 		/* Set our own write function. */
 		png_set_write_fn(png, buffer, pngWriteData, pngFlushData);
 
+		if (compressionLevel != Z_DEFAULT_COMPRESSION)
+			png_set_compression_level(png, compressionLevel);
+
 		compressOk = writeCompressedPNG(png, info, rowPointers, width, height,
 										hasAlpha ? PNG_COLOR_TYPE_RGBA : PNG_COLOR_TYPE_RGB);
 	}
@@ -761,8 +985,202 @@ static deBool compressImagePNG (Buffer* buffer, qpImageFormat imageFormat, int w
 	deFree(rowPointers);
 	return compressOk;
 }
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Fast PNG encoder
+ *
+ * Writes PNG files directly with zlib. All rows use the Sub filter and
+ * a fixed low compression level is used. The deflate stream and buffers
+ * are kept across images to avoid per-image allocation and setup costs.
+ *//*--------------------------------------------------------------------*/
+typedef struct PngFastEncoder_s
+{
+	z_stream	stream;
+	deBool		isStreamInitialized;
+	Buffer		filteredData;		/*!< Filtered scanlines.	*/
+	Buffer		output;				/*!< Encoded PNG file.		*/
+} PngFastEncoder;
+
+enum
+{
+	PNG_FAST_ENCODER_ZLIB_LEVEL		= Z_BEST_SPEED,
+	PNG_FAST_ENCODER_ZLIB_STRATEGY	= Z_DEFAULT_STRATEGY
+};
+
+static PngFastEncoder* PngFastEncoder_create (void)
+{
+	PngFastEncoder* encoder = (PngFastEncoder*)deCalloc(sizeof(PngFastEncoder));
+
+	if (encoder)
+	{
+		Buffer_init(&encoder->filteredData);
+		Buffer_init(&encoder->output);
+	}
+
+	return encoder;
+}
+
+static void PngFastEncoder_destroy (PngFastEncoder* encoder)
+{
+	if (encoder->isStreamInitialized)
+		deflateEnd(&encoder->stream);
+
+	Buffer_deinit(&encoder->filteredData);
+	Buffer_deinit(&encoder->output);
+	deFree(encoder);
+}
+
+static void writeUint32BE (deUint8* dst, deUint32 value)
+{
+	dst[0] = (deUint8)(value >> 24);
+	dst[1] = (deUint8)(value >> 16);
+	dst[2] = (deUint8)(value >> 8);
+	dst[3] = (deUint8)value;
+}
+
+/* Write chunk whose data is already at dst+8. Returns pointer past the chunk. */
+static deUint8* finishPNGChunk (deUint8* dst, const char* type, size_t dataSize)
+{
+	writeUint32BE(dst, (deUint32)dataSize);
+	memcpy(dst+4, type, 4);
+	writeUint32BE(dst+8+dataSize, (deUint32)crc32(crc32(0L, Z_NULL, 0), dst+4, (uInt)(dataSize+4)));
+
+	return dst + 12 + dataSize;
+}
+
+/* \note Written as a plain loop over bytes so that compilers vectorize it. */
+static void filterRowSub (deUint8* dst, const deUint8* src, int numBytes, int pixelSize)
+{
+	int ndx;
+
+	for (ndx = 0; ndx < pixelSize; ndx++)
+		dst[ndx] = src[ndx];
+
+	for (ndx = pixelSize; ndx < numBytes; ndx++)
+		dst[ndx] = (deUint8)(src[ndx] - src[ndx-pixelSize]);
+}
+
+static deBool compressImagePNGFast (PngFastEncoder* encoder, qpImageFormat imageFormat, int width, int height, int rowStride, const void* data)
+{
+	static const deUint8	signature[]		= { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	const deBool			hasAlpha		= imageFormat == QP_IMAGE_FORMAT_RGBA8888;
+	const int				pixelSize		= hasAlpha ? 4 : 3;
+	const size_t			rowBytes		= (size_t)(pixelSize*width);
+	const size_t			filteredSize	= (rowBytes+1)*(size_t)height;
+	size_t					maxDataSize;
+	deUint8*				dst;
+	int						y;
+
+	DE_ASSERT(imageFormat == QP_IMAGE_FORMAT_RGB888 || imageFormat == QP_IMAGE_FORMAT_RGBA8888);
+
+	/* Filter scanlines. */
+	if (!Buffer_resize(&encoder->filteredData, filteredSize))
+		return DE_FALSE;
+
+	for (y = 0; y < height; y++)
+	{
+		deUint8* const row = &encoder->filteredData.data[(rowBytes+1)*(size_t)y];
+
+		row[0] = PNG_FILTER_VALUE_SUB;
+		filterRowSub(row+1, (const deUint8*)data + y*rowStride, (int)rowBytes, pixelSize);
+	}
+
+	/* Prepare deflate stream. */
+	if (!encoder->isStreamInitialized)
+	{
+		if (deflateInit2(&encoder->stream, PNG_FAST_ENCODER_ZLIB_LEVEL, Z_DEFLATED, 15, 8, PNG_FAST_ENCODER_ZLIB_STRATEGY) != Z_OK)
+			return DE_FALSE;
+
+		encoder->isStreamInitialized = DE_TRUE;
+	}
+	else if (deflateReset(&encoder->stream) != Z_OK)
+		return DE_FALSE;
+
+	/* Signature + IHDR + IDAT + IEND. Each chunk has 12 bytes of length, type and CRC. */
+	maxDataSize = (size_t)deflateBound(&encoder->stream, (uLong)filteredSize);
+
+	if (!Buffer_resize(&encoder->output, sizeof(signature) + (12+13) + (12+maxDataSize) + 12))
+		return DE_FALSE;
+
+	dst = encoder->output.data;
+
+	memcpy(dst, signature, sizeof(signature));
+	dst += sizeof(signature);
+
+	writeUint32BE(dst+8, (deUint32)width);
+	writeUint32BE(dst+12, (deUint32)height);
+	dst[16] = 8;													/* Bit depth		*/
+	dst[17] = hasAlpha ? PNG_COLOR_TYPE_RGBA : PNG_COLOR_TYPE_RGB;	/* Color type		*/
+	dst[18] = PNG_COMPRESSION_TYPE_BASE;
+	dst[19] = PNG_FILTER_TYPE_BASE;
+	dst[20] = PNG_INTERLACE_NONE;
+	dst = finishPNGChunk(dst, "IHDR", 13);
+
+	/* Compress all scanlines at once directly into IDAT chunk. */
+	encoder->stream.next_in		= encoder->filteredData.data;
+	encoder->stream.avail_in	= (uInt)filteredSize;
+	encoder->stream.next_out	= dst+8;
+	encoder->stream.avail_out	= (uInt)maxDataSize;
+
+	if (deflate(&encoder->stream, Z_FINISH) != Z_STREAM_END)
+		return DE_FALSE;
+
+	dst = finishPNGChunk(dst, "IDAT", (size_t)encoder->stream.total_out);
+	dst = finishPNGChunk(dst, "IEND", 0);
+
+	encoder->output.size = (size_t)(dst - encoder->output.data);
+
+	return DE_TRUE;
+}
 #endif /* QP_SUPPORT_PNG */
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Write image pixels into a separate file
+ *
+ * Rows are written tightly packed without any header. On success full
+ * path is written to fileNameDst and *baseName points to file name part
+ * of it, which is what is stored in the log.
+ *//*--------------------------------------------------------------------*/
+static deBool writeRawImageFile (qpTestLog* log, qpImageFormat imageFormat, int width, int height, int rowStride, const void* data, char* fileNameDst, size_t fileNameSize, const char** baseName)
+{
+	const int	pixelSize	= imageFormat == QP_IMAGE_FORMAT_RGB888 ? 3 : 4;
+	const int	imageNdx	= deAtomicIncrement32(&log->numRawImages) - 1;
+	FILE*		file;
+	deBool		writeOk		= DE_TRUE;
+	int			row;
+
+	fileNameDst[0] = 0;
+
+	if (deSprintf(fileNameDst, fileNameSize, "%s-image%06d.%s", log->rawImagePrefix, imageNdx, pixelSize == 3 ? "rgb" : "rgba") < 0)
+		return DE_FALSE;
+
+	file = fopen(fileNameDst, "wb");
+	if (!file)
+		return DE_FALSE;
+
+	for (row = 0; row < height && writeOk; row++)
+		writeOk = fwrite((const deUint8*)data + row*rowStride, (size_t)(pixelSize*width), 1, file) == 1;
+
+	if (fclose(file) != 0)
+		writeOk = DE_FALSE;
+
+	if (!writeOk)
+	{
+		remove(fileNameDst);
+		return DE_FALSE;
+	}
+
+	{
+		const char* sep0 = strrchr(fileNameDst, '/');
+		const char* sep1 = strrchr(fileNameDst, '\\');
+		const char* sep  = sep0 > sep1 ? sep0 : sep1;
+
+		*baseName = sep ? sep+1 : fileNameDst;
+	}
+
+	return DE_TRUE;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Start image set
  * \param log			qpTestLog instance
@@ -783,7 +1201,7 @@ deBool qpTestLog_startImageSet (qpTestLog* log, const char* name, const char* de
 		attribs[numAttribs++] = qpSetStringAttrib("Description", description);
 
 	/* <ImageSet Name="<name>"> */
-	if (!qpXmlWriter_startElement(log->writer, "ImageSet", numAttribs, attribs))
+	if (!logStartElement(log, "ImageSet", numAttribs, attribs))
 	{
 		qpPrintf("qpTestLog_startImageSet(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -807,7 +1225,7 @@ deBool qpTestLog_endImageSet (qpTestLog* log)
 	deMutex_lock(log->lock);
 
 	/* <ImageSet Name="<name>"> */
-	if (!qpXmlWriter_endElement(log->writer, "ImageSet"))
+	if (!logEndElement(log, "ImageSet"))
 	{
 		qpPrintf("qpTestLog_endImageSet(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -851,6 +1269,9 @@ deBool qpTestLog_writeImage	(
 	Buffer			compressedBuffer;
 	const void*		writeDataPtr		= DE_NULL;
 	size_t			writeDataBytes		= ~(size_t)0;
+	char			rawFileName[1024];
+	const char*		rawFileBaseName		= DE_NULL;
+	deBool			holdsEncoderLock	= DE_FALSE;
 
 	DE_ASSERT(log && name);
 	DE_ASSERT(deInRange32(width, 1, 16384));
@@ -862,6 +1283,18 @@ deBool qpTestLog_writeImage	(
 
 	Buffer_init(&compressedBuffer);
 
+	/* Store pixels in a separate file instead of compressing them. */
+	if (log->flags & QP_TEST_LOG_IMAGE_RAW_FILES)
+	{
+		if (writeRawImageFile(log, imageFormat, width, height, stride, data, rawFileName, sizeof(rawFileName), &rawFileBaseName))
+		{
+			compressionMode	= QP_IMAGE_COMPRESSION_MODE_NONE;
+			writeDataBytes	= 0;
+		}
+		else
+			qpPrintf("WARNING: Failed to write image file '%s' -- storing image in log.\n", rawFileName);
+	}
+
 	/* BEST compression mode defaults to PNG. */
 	if (compressionMode == QP_IMAGE_COMPRESSION_MODE_BEST)
 	{
@@ -874,9 +1307,32 @@ deBool qpTestLog_writeImage	(
 
 #if defined(QP_SUPPORT_PNG)
 	/* Try storing with PNG compression. */
-	if (compressionMode == QP_IMAGE_COMPRESSION_MODE_PNG)
+	if (compressionMode == QP_IMAGE_COMPRESSION_MODE_PNG && (log->flags & QP_TEST_LOG_IMAGE_ENCODER_FAST))
 	{
-		deBool compressOk = compressImagePNG(&compressedBuffer, imageFormat, width, height, stride, data);
+		/* \note Encoder lock is held until data has been written, output buffer is owned by the encoder. */
+		deMutex_lock(log->encoderLock);
+		holdsEncoderLock = DE_TRUE;
+
+		if (!log->fastEncoder)
+			log->fastEncoder = PngFastEncoder_create();
+
+		if (log->fastEncoder && compressImagePNGFast(log->fastEncoder, imageFormat, width, height, stride, data))
+		{
+			writeDataPtr	= log->fastEncoder->output.data;
+			writeDataBytes	= log->fastEncoder->output.size;
+		}
+		else
+		{
+			qpPrintf("WARNING: PNG compression failed -- storing image uncompressed.\n");
+			compressionMode	= QP_IMAGE_COMPRESSION_MODE_NONE;
+			deMutex_unlock(log->encoderLock);
+			holdsEncoderLock = DE_FALSE;
+		}
+	}
+	else if (compressionMode == QP_IMAGE_COMPRESSION_MODE_PNG)
+	{
+		const int		compressionLevel	= (log->flags & QP_TEST_LOG_IMAGE_ENCODER_MAX) ? Z_BEST_COMPRESSION : Z_DEFAULT_COMPRESSION;
+		const deBool	compressOk			= compressImagePNG(&compressedBuffer, imageFormat, width, height, stride, data, compressionLevel);
 		if (compressOk)
 		{
 			writeDataPtr	= compressedBuffer.data;
@@ -899,6 +1355,9 @@ deBool qpTestLog_writeImage	(
 			int pixelSize		= imageFormat == QP_IMAGE_FORMAT_RGB888 ? 3 : 4;
 			int packedStride	= pixelSize*width;
 
+			if (rawFileBaseName)
+				break; /* Pixels are in a separate file. */
+
 			if (packedStride == stride)
 				writeDataPtr = data;
 			else
@@ -943,23 +1402,29 @@ deBool qpTestLog_writeImage	(
 	attribs[numAttribs++] = qpSetStringAttrib("Format", QP_LOOKUP_STRING(s_qpImageFormatMap, imageFormat));
 	attribs[numAttribs++] = qpSetStringAttrib("CompressionMode", QP_LOOKUP_STRING(s_qpImageCompressionModeMap, compressionMode));
 	if (description) attribs[numAttribs++] = qpSetStringAttrib("Description", description);
+	if (rawFileBaseName) attribs[numAttribs++] = qpSetStringAttrib("File", rawFileBaseName);
 
 	/* \note Log lock is acquired after compression! */
 	deMutex_lock(log->lock);
 
 	/* <Image ID="result" Name="Foobar" Width="640" Height="480" Format="RGB888" CompressionMode="None">base64 data</Image> */
-	if (!qpXmlWriter_startElement(log->writer, "Image", numAttribs, attribs) ||
-		!qpXmlWriter_writeBase64(log->writer, (const deUint8*)writeDataPtr, writeDataBytes) ||
-		!qpXmlWriter_endElement(log->writer, "Image"))
+	if (!logStartElement(log, "Image", numAttribs, attribs) ||
+		(writeDataBytes > 0 && !logWriteData(log, (const deUint8*)writeDataPtr, writeDataBytes)) ||
+		!logEndElement(log, "Image"))
 	{
 		qpPrintf("qpTestLog_writeImage(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
+		if (holdsEncoderLock)
+			deMutex_unlock(log->encoderLock);
 		Buffer_deinit(&compressedBuffer);
 		return DE_FALSE;
 	}
 
 	deMutex_unlock(log->lock);
 
+	if (holdsEncoderLock)
+		deMutex_unlock(log->encoderLock);
+
 	/* Free compressed data if allocated. */
 	Buffer_deinit(&compressedBuffer);
 
@@ -981,8 +1446,8 @@ deBool qpTestLog_startShaderProgram (qpTestLog* log, deBool linkOk, const char*
 
 	programAttribs[numProgramAttribs++] = qpSetStringAttrib("LinkStatus", linkOk ? "OK" : "Fail");
 
-	if (!qpXmlWriter_startElement(log->writer, "ShaderProgram", numProgramAttribs, programAttribs) ||
-		!qpXmlWriter_writeStringElement(log->writer, "InfoLog", linkInfoLog))
+	if (!logStartElement(log, "ShaderProgram", numProgramAttribs, programAttribs) ||
+		!logWriteStringElement(log, "InfoLog", linkInfoLog))
 	{
 		qpPrintf("qpTestLog_startShaderProgram(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1006,7 +1471,7 @@ deBool qpTestLog_endShaderProgram (qpTestLog* log)
 	deMutex_lock(log->lock);
 
 	/* </ShaderProgram> */
-	if (!qpXmlWriter_endElement(log->writer, "ShaderProgram"))
+	if (!logEndElement(log, "ShaderProgram"))
 	{
 		qpPrintf("qpTestLog_endShaderProgram(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1040,10 +1505,10 @@ deBool qpTestLog_writeShader (qpTestLog* log, qpShaderType type, const char* sou
 
 	shaderAttribs[numShaderAttribs++]	= qpSetStringAttrib("CompileStatus", compileOk ? "OK" : "Fail");
 
-	if (!qpXmlWriter_startElement(log->writer, tagName, numShaderAttribs, shaderAttribs) ||
-		!qpXmlWriter_writeStringElement(log->writer, "ShaderSource", sourceStr) ||
-		!qpXmlWriter_writeStringElement(log->writer, "InfoLog", infoLog) ||
-		!qpXmlWriter_endElement(log->writer, tagName))
+	if (!logStartElement(log, tagName, numShaderAttribs, shaderAttribs) ||
+		!logWriteStringElement(log, "ShaderSource", sourceStr) ||
+		!logWriteStringElement(log, "InfoLog", infoLog) ||
+		!logEndElement(log, tagName))
 	{
 		qpPrintf("qpTestLog_writeShader(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1070,7 +1535,7 @@ deBool qpTestLog_startEglConfigSet (qpTestLog* log, const char* name, const char
 		attribs[numAttribs++] = qpSetStringAttrib("Description", description);
 
 	/* <EglConfigSet Name="<name>"> */
-	if (!qpXmlWriter_startElement(log->writer, "EglConfigSet", numAttribs, attribs))
+	if (!logStartElement(log, "EglConfigSet", numAttribs, attribs))
 	{
 		qpPrintf("qpTestLog_startEglImageSet(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1092,7 +1557,7 @@ deBool qpTestLog_endEglConfigSet (qpTestLog* log)
 	deMutex_lock(log->lock);
 
 	/* <EglConfigSet Name="<name>"> */
-	if (!qpXmlWriter_endElement(log->writer, "EglConfigSet"))
+	if (!logEndElement(log, "EglConfigSet"))
 	{
 		qpPrintf("qpTestLog_endEglImageSet(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1149,8 +1614,8 @@ deBool qpTestLog_writeEglConfig (qpTestLog* log, const qpEglConfigInfo* config)
 	attribs[numAttribs++] = qpSetIntAttrib		("TransparentBlueValue", config->transparentBlueValue);
 	DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
 
-	if (!qpXmlWriter_startElement(log->writer, "EglConfig", numAttribs, attribs) ||
-		!qpXmlWriter_endElement(log->writer, "EglConfig"))
+	if (!logStartElement(log, "EglConfig", numAttribs, attribs) ||
+		!logEndElement(log, "EglConfig"))
 	{
 		qpPrintf("qpTestLog_writeEglConfig(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1181,7 +1646,7 @@ deBool qpTestLog_startSection (qpTestLog* log, const char* name, const char* des
 		attribs[numAttribs++] = qpSetStringAttrib("Description", description);
 
 	/* <Section Name="<name>" Description="<description>"> */
-	if (!qpXmlWriter_startElement(log->writer, "Section", numAttribs, attribs))
+	if (!logStartElement(log, "Section", numAttribs, attribs))
 	{
 		qpPrintf("qpTestLog_startSection(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1205,7 +1670,7 @@ deBool qpTestLog_endSection (qpTestLog* log)
 	deMutex_lock(log->lock);
 
 	/* </Section> */
-	if (!qpXmlWriter_endElement(log->writer, "Section"))
+	if (!logEndElement(log, "Section"))
 	{
 		qpPrintf("qpTestLog_endSection(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1228,7 +1693,7 @@ deBool qpTestLog_writeKernelSource (qpTestLog* log, const char* source)
 	DE_ASSERT(log);
 	deMutex_lock(log->lock);
 
-	if (!qpXmlWriter_writeStringElement(log->writer, "KernelSource", sourceStr))
+	if (!logWriteStringElement(log, "KernelSource", sourceStr))
 	{
 		qpPrintf("qpTestLog_writeKernelSource(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1250,7 +1715,7 @@ deBool qpTestLog_writeSpirVAssemblySource (qpTestLog* log, const char* source)
 
 	DE_ASSERT(ContainerStack_getTop(&log->containerStack) == CONTAINERTYPE_SHADERPROGRAM);
 
-	if (!qpXmlWriter_writeStringElement(log->writer, "SpirVAssemblySource", sourceStr))
+	if (!logWriteStringElement(log, "SpirVAssemblySource", sourceStr))
 	{
 		qpPrintf("qpTestLog_writeSpirVAssemblySource(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1276,9 +1741,9 @@ deBool qpTestLog_writeCompileInfo (qpTestLog* log, const char* name, const char*
 	attribs[numAttribs++] = qpSetStringAttrib("Description", description);
 	attribs[numAttribs++] = qpSetStringAttrib("CompileStatus", compileOk ? "OK" : "Fail");
 
-	if (!qpXmlWriter_startElement(log->writer, "CompileInfo", numAttribs, attribs) ||
-		!qpXmlWriter_writeStringElement(log->writer, "InfoLog", infoLog) ||
-		!qpXmlWriter_endElement(log->writer, "CompileInfo"))
+	if (!logStartElement(log, "CompileInfo", numAttribs, attribs) ||
+		!logWriteStringElement(log, "InfoLog", infoLog) ||
+		!logEndElement(log, "CompileInfo"))
 	{
 		qpPrintf("qpTestLog_writeCompileInfo(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1300,7 +1765,7 @@ deBool qpTestLog_startSampleList (qpTestLog* log, const char* name, const char*
 	attribs[numAttribs++] = qpSetStringAttrib("Name", name);
 	attribs[numAttribs++] = qpSetStringAttrib("Description", description);
 
-	if (!qpXmlWriter_startElement(log->writer, "SampleList", numAttribs, attribs))
+	if (!logStartElement(log, "SampleList", numAttribs, attribs))
 	{
 		qpPrintf("qpTestLog_startSampleList(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1318,7 +1783,7 @@ deBool qpTestLog_startSampleInfo (qpTestLog* log)
 	DE_ASSERT(log);
 	deMutex_lock(log->lock);
 
-	if (!qpXmlWriter_startElement(log->writer, "SampleInfo", 0, DE_NULL))
+	if (!logStartElement(log, "SampleInfo", 0, DE_NULL))
 	{
 		qpPrintf("qpTestLog_startSampleInfo(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1349,8 +1814,8 @@ deBool qpTestLog_writeValueInfo (qpTestLog* log, const char* name, const char* d
 	if (unit)
 		attribs[numAttribs++] = qpSetStringAttrib("Unit", unit);
 
-	if (!qpXmlWriter_startElement(log->writer, "ValueInfo", numAttribs, attribs) ||
-		!qpXmlWriter_endElement(log->writer, "ValueInfo"))
+	if (!logStartElement(log, "ValueInfo", numAttribs, attribs) ||
+		!logEndElement(log, "ValueInfo"))
 	{
 		qpPrintf("qpTestLog_writeValueInfo(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1366,7 +1831,7 @@ deBool qpTestLog_endSampleInfo (qpTestLog* log)
 	DE_ASSERT(log);
 	deMutex_lock(log->lock);
 
-	if (!qpXmlWriter_endElement(log->writer, "SampleInfo"))
+	if (!logEndElement(log, "SampleInfo"))
 	{
 		qpPrintf("qpTestLog_endSampleInfo(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1386,7 +1851,7 @@ deBool qpTestLog_startSample (qpTestLog* log)
 
 	DE_ASSERT(ContainerStack_getTop(&log->containerStack) == CONTAINERTYPE_SAMPLELIST);
 
-	if (!qpXmlWriter_startElement(log->writer, "Sample", 0, DE_NULL))
+	if (!logStartElement(log, "Sample", 0, DE_NULL))
 	{
 		qpPrintf("qpTestLog_startSample(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1401,14 +1866,13 @@ deBool qpTestLog_startSample (qpTestLog* log)
 
 deBool qpTestLog_writeValueFloat (qpTestLog* log, double value)
 {
-	char tmpString[512];
-	doubleToString(value, tmpString, (int)sizeof(tmpString));
-
 	deMutex_lock(log->lock);
 
 	DE_ASSERT(ContainerStack_getTop(&log->containerStack) == CONTAINERTYPE_SAMPLE);
 
-	if (!qpXmlWriter_writeStringElement(log->writer, "Value", &tmpString[0]))
+	if (!logStartElement(log, "Value", 0, DE_NULL) ||
+		!logWriteDouble(log, value) ||
+		!logEndElement(log, "Value"))
 	{
 		qpPrintf("qpTestLog_writeSampleValue(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1421,14 +1885,13 @@ deBool qpTestLog_writeValueFloat (qpTestLog* log, double value)
 
 deBool qpTestLog_writeValueInteger (qpTestLog* log, deInt64 value)
 {
-	char tmpString[64];
-	int64ToString(value, tmpString);
-
 	deMutex_lock(log->lock);
 
 	DE_ASSERT(ContainerStack_getTop(&log->containerStack) == CONTAINERTYPE_SAMPLE);
 
-	if (!qpXmlWriter_writeStringElement(log->writer, "Value", &tmpString[0]))
+	if (!logStartElement(log, "Value", 0, DE_NULL) ||
+		!logWriteInt64(log, value) ||
+		!logEndElement(log, "Value"))
 	{
 		qpPrintf("qpTestLog_writeSampleValue(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1444,7 +1907,7 @@ deBool qpTestLog_endSample (qpTestLog* log)
 	DE_ASSERT(log);
 	deMutex_lock(log->lock);
 
-	if (!qpXmlWriter_endElement(log->writer, "Sample"))
+	if (!logEndElement(log, "Sample"))
 	{
 		qpPrintf("qpTestLog_endSample(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
@@ -1462,7 +1925,7 @@ deBool qpTestLog_endSampleList (qpTestLog* log)
 	DE_ASSERT(log);
 	deMutex_lock(log->lock);
 
-	if (!qpXmlWriter_endElement(log->writer, "SampleList"))
+	if (!logEndElement(log, "SampleList"))
 	{
 		qpPrintf("qpTestLog_endSampleList(): Writing XML failed\n");
 		deMutex_unlock(log->lock);
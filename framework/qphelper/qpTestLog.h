@@ -134,7 +134,12 @@ typedef enum qpTestLogFlag_e
 {
 	QP_TEST_LOG_EXCLUDE_IMAGES			= (1<<0),		/*!< Do not log images. This reduces log size considerably.			*/
 	QP_TEST_LOG_EXCLUDE_SHADER_SOURCES	= (1<<1),		/*!< Do not log shader sources. Helps to reduce log size further.	*/
-	QP_TEST_LOG_NO_FLUSH				= (1<<2)		/*!< Do not do a fflush after writing the log.						*/
+	QP_TEST_LOG_NO_FLUSH				= (1<<2),		/*!< Do not do a fflush after writing the log.						*/
+	QP_TEST_LOG_BINARY_FORMAT			= (1<<3),		/*!< Write compact binary log instead of XML (see qpBinaryLogWriter.h).	*/
+	QP_TEST_LOG_DETAILS_ON_FAILURE		= (1<<4),		/*!< Log images and shader sources only for cases that do not pass (handled by tcu::TestLog).	*/
+	QP_TEST_LOG_IMAGE_ENCODER_FAST		= (1<<5),		/*!< Use built-in fast PNG encoder. Images are slightly larger but compressed several times faster.	*/
+	QP_TEST_LOG_IMAGE_ENCODER_MAX		= (1<<6),		/*!< Use maximum zlib compression level for PNG images.				*/
+	QP_TEST_LOG_IMAGE_RAW_FILES			= (1<<7)		/*!< Write uncompressed image pixels into separate files next to the log.	*/
 } qpTestLogFlag;
 
 /* Shader type. */
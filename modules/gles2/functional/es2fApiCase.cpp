@@ -53,11 +53,24 @@ ApiCase::IterateResult ApiCase::iterate (void)
 	// Initialize result to pass.
 	m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
 
-	// Enable call logging.
+	// Enable call logging. Calls are captured and written to log only if case fails.
 	enableLogging(true);
+	enableDeferredLogging(true);
 
 	// Run test.
-	test();
+	try
+	{
+		test();
+	}
+	catch (...)
+	{
+		// Disabling deferred mode flushes captured calls.
+		enableDeferredLogging(false);
+		throw;
+	}
+
+	endCallLog(m_testCtx.getTestResult());
+	enableDeferredLogging(false);
 
 	return STOP;
 }
@@ -67,6 +80,7 @@ void ApiCase::expectError (deUint32 expected)
 	deUint32 err = glGetError();
 	if (err != expected)
 	{
+		flushCallLog();
 		m_testCtx.getLog() << tcu::TestLog::Message << "// ERROR: expected " << glu::getErrorStr(expected) << tcu::TestLog::EndMessage;
 		if (m_testCtx.getTestResult() == QP_TEST_RESULT_PASS)
 			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Got invalid error");
@@ -78,6 +92,7 @@ void ApiCase::expectError (deUint32 expected0, deUint32 expected1)
 	deUint32 err = glGetError();
 	if (err != expected0 && err != expected1)
 	{
+		flushCallLog();
 		m_log << tcu::TestLog::Message << "// ERROR: expected " << glu::getErrorStr(expected0) << " or " << glu::getErrorStr(expected1) << tcu::TestLog::EndMessage;
 		if (m_testCtx.getTestResult() == QP_TEST_RESULT_PASS)
 			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Got invalid error");
@@ -93,6 +108,7 @@ void ApiCase::checkBooleans (deInt32 value, deUint8 expected)
 {
 	if (value != (deInt32)expected)
 	{
+		flushCallLog();
 		m_log << tcu::TestLog::Message << "// ERROR: expected " << (expected	? "GL_TRUE" : "GL_FALSE") << tcu::TestLog::EndMessage;
 		if (m_testCtx.getTestResult() == QP_TEST_RESULT_PASS)
 			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Got invalid boolean value");
@@ -31,6 +31,7 @@
 #include "glwEnums.hpp"
 
 #include "tcuTestLog.hpp"
+#include "tcuPerfStatistics.hpp"
 
 #include "deRandom.hpp"
 #include "deStringUtil.hpp"
@@ -40,7 +41,6 @@
 #include "deClock.h"
 #include "deThread.h"
 
-#include <cmath>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -783,44 +783,6 @@ deUint64 DrawCallBatchingTest::renderBatched (void)
 	return endUs - beginUs;
 }
 
-struct Statistics
-{
-	double mean;
-	double standardDeviation;
-	double standardErrorOfMean;
-};
-
-Statistics calculateStats (const vector<deUint64>& samples)
-{
-	double mean = 0.0;
-
-	for (int i = 0; i < (int)samples.size(); i++)
-		mean += (double)samples[i];
-
-	mean /= (double)samples.size();
-
-	double standardDeviation = 0.0;
-
-	for (int i = 0; i < (int)samples.size(); i++)
-	{
-		double x = (double)samples[i];
-		standardDeviation += (x - mean) * (x - mean);
-	}
-
-	standardDeviation /= (double)samples.size();
-	standardDeviation = std::sqrt(standardDeviation);
-
-	double standardErrorOfMean = standardDeviation / std::sqrt((double)samples.size());
-
-	Statistics stats;
-
-	stats.mean					= mean;
-	stats.standardDeviation		= standardDeviation;
-	stats.standardErrorOfMean	= standardErrorOfMean;
-
-	return stats;
-}
-
 void DrawCallBatchingTest::logTestInfo (void)
 {
 	TestLog&				log		= m_testCtx.getLog();
@@ -874,8 +836,8 @@ tcu::TestCase::IterateResult DrawCallBatchingTest::iterate (void)
 		const double targetSEM	= 0.02;
 		const double limitSEM	= 0.025;
 
-		Statistics unbatchedStats	= calculateStats(m_unbatchedSamplesUs);
-		Statistics batchedStats		= calculateStats(m_batchedSamplesUs);
+		const tcu::SampleStatistics	unbatchedStats	= tcu::calculateSampleStatistics(m_unbatchedSamplesUs);
+		const tcu::SampleStatistics	batchedStats	= tcu::calculateSampleStatistics(m_batchedSamplesUs);
 
 		log << TestLog::Message << "Batched samples; Count: " << m_batchedSamplesUs.size() << ", Mean: " << batchedStats.mean << "us, Standard deviation: " << batchedStats.standardDeviation << "us, Standard error of mean: " << batchedStats.standardErrorOfMean << "us(" << (batchedStats.standardErrorOfMean/batchedStats.mean) << ")" << TestLog::EndMessage;
 		log << TestLog::Message << "Unbatched samples; Count: " << m_unbatchedSamplesUs.size() << ", Mean: " << unbatchedStats.mean << "us, Standard deviation: " << unbatchedStats.standardDeviation << "us, Standard error of mean: " << unbatchedStats.standardErrorOfMean << "us(" << (unbatchedStats.standardErrorOfMean/unbatchedStats.mean) << ")" << TestLog::EndMessage;
@@ -30,6 +30,7 @@
 #include "tcuRenderTarget.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuSurface.hpp"
+#include "tcuPerfStatistics.hpp"
 #include "deStringUtil.hpp"
 #include "deSharedPtr.hpp"
 #include "deClock.h"
@@ -279,14 +280,7 @@ private:
 				WorkloadRecord	(int workloadSize_)						: workloadSize(workloadSize_) {}
 		bool	operator<		(const WorkloadRecord& other) const		{ return this->workloadSize < other.workloadSize; }
 		void	addFrameTime	(float time)							{ frameTimes.push_back(time); }
-		float	getMedianTime	(void) const
-		{
-			vector<float> times = frameTimes;
-			std::sort(times.begin(), times.end());
-			return times.size() % 2 == 0 ?
-					(times[times.size()/2-1] + times[times.size()/2])*0.5f :
-					times[times.size()/2];
-		}
+		float	getMedianTime	(void) const							{ return tcu::median(frameTimes); }
 	};
 
 	void								prepareProgram				(int progNdx);					//!< Sets attributes and uniforms for m_programs[progNdx].
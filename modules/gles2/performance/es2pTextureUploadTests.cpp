@@ -31,6 +31,7 @@
 #include "tcuTextureUtil.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuSurface.hpp"
+#include "tcuPerfStatistics.hpp"
 #include "gluTextureUtil.hpp"
 #include "gluShaderProgram.hpp"
 #include "gluPixelTransfer.hpp"
@@ -44,7 +45,6 @@
 #include "glwEnums.hpp"
 #include "glwFunctions.hpp"
 
-#include <algorithm>
 #include <vector>
 
 namespace deqp
@@ -254,13 +254,7 @@ void TextureUploadCase::logResults (void)
 	//for (int i = 0; i < m_calibrator.measureState.numFrames; i++)
 	//	m_log << TestLog::Message	<< "Frame "	<< i+1 << " duration: \t" << m_calibrator.measureState.frameTimes[i] << " us."<< TestLog::EndMessage;
 
-	std::vector<deUint64> sortedFrameTimes(measureState.frameTimes.begin(), measureState.frameTimes.end());
-	std::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
-	vector<deUint64>::const_iterator first	= sortedFrameTimes.begin();
-	vector<deUint64>::const_iterator last	= sortedFrameTimes.end();
-	vector<deUint64>::const_iterator middle	= first + (last - first) / 2;
-
-	deUint64 medianFrameTime			=  *middle;
+	double medianFrameTime				= (double)tcu::median(measureState.frameTimes);
 	double medianMTexelsPerSeconds		= (double)(m_texSize*m_texSize*measureState.numDrawCalls) / (double)medianFrameTime;
 	double medianTexelDrawDurationNs	= (double)medianFrameTime * 1000.0 / (double)(m_texSize*m_texSize*measureState.numDrawCalls);
 
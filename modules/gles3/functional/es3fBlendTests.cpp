@@ -261,19 +261,10 @@ BlendCase::IterateResult BlendCase::iterate (void)
 	TextureLevel					renderedImg		(TextureFormat(m_useSrgbFbo ? TextureFormat::sRGBA : TextureFormat::RGBA, TextureFormat::UNORM_INT8), m_viewportWidth, m_viewportHeight);
 	TextureLevel					referenceImg	(renderedImg.getFormat(), m_viewportWidth, m_viewportHeight);
 	TestLog&						log				(m_testCtx.getLog());
+	tcu::AsyncVerifier&				verifier		(m_testCtx.getAsyncVerifier());
 	const BlendParams&				paramSet		= m_paramSets[m_curParamSetNdx];
 	rr::FragmentOperationState		referenceState;
 
-	// Log the blend parameters.
-
-	log << TestLog::Message << "RGB equation = " << getBlendEquationName(paramSet.equationRGB) << TestLog::EndMessage;
-	log << TestLog::Message << "RGB src func = " << getBlendFactorName(paramSet.srcFuncRGB) << TestLog::EndMessage;
-	log << TestLog::Message << "RGB dst func = " << getBlendFactorName(paramSet.dstFuncRGB) << TestLog::EndMessage;
-	log << TestLog::Message << "Alpha equation = " << getBlendEquationName(paramSet.equationAlpha) << TestLog::EndMessage;
-	log << TestLog::Message << "Alpha src func = " << getBlendFactorName(paramSet.srcFuncAlpha) << TestLog::EndMessage;
-	log << TestLog::Message << "Alpha dst func = " << getBlendFactorName(paramSet.dstFuncAlpha) << TestLog::EndMessage;
-	log << TestLog::Message << "Blend color = (" << paramSet.blendColor.x() << ", " << paramSet.blendColor.y() << ", " << paramSet.blendColor.z() << ", " << paramSet.blendColor.w() << ")" << TestLog::EndMessage;
-
 	// Set GL state.
 
 	GLU_CHECK_CALL(glBlendEquationSeparate(paramSet.equationRGB, paramSet.equationAlpha));
@@ -311,11 +302,29 @@ BlendCase::IterateResult BlendCase::iterate (void)
 	// Copy to reference (expansion to RGBA happens here if necessary)
 	copy(referenceImg, m_refColorBuffer->getAccess());
 
+	// Verification of the previous parameter set ran while this one was rendered. Fail now if images didn't match.
+
+	if (!verifier.join(log))
+	{
+		m_context.getTestContext().setTestResult(QP_TEST_RESULT_FAIL, "Image compare failed");
+		return STOP;
+	}
+
+	// Log the blend parameters.
+
+	log << TestLog::Message << "RGB equation = " << getBlendEquationName(paramSet.equationRGB) << TestLog::EndMessage;
+	log << TestLog::Message << "RGB src func = " << getBlendFactorName(paramSet.srcFuncRGB) << TestLog::EndMessage;
+	log << TestLog::Message << "RGB dst func = " << getBlendFactorName(paramSet.dstFuncRGB) << TestLog::EndMessage;
+	log << TestLog::Message << "Alpha equation = " << getBlendEquationName(paramSet.equationAlpha) << TestLog::EndMessage;
+	log << TestLog::Message << "Alpha src func = " << getBlendFactorName(paramSet.srcFuncAlpha) << TestLog::EndMessage;
+	log << TestLog::Message << "Alpha dst func = " << getBlendFactorName(paramSet.dstFuncAlpha) << TestLog::EndMessage;
+	log << TestLog::Message << "Blend color = (" << paramSet.blendColor.x() << ", " << paramSet.blendColor.y() << ", " << paramSet.blendColor.z() << ", " << paramSet.blendColor.w() << ")" << TestLog::EndMessage;
+
 	// Read GL image.
 
 	glu::readPixels(m_context.getRenderContext(), viewportX, viewportY, renderedImg.getAccess());
 
-	// Compare images.
+	// Compare images on a worker thread.
 	// \note In sRGB cases, convert to linear space for comparison.
 
 	if (m_useSrgbFbo)
@@ -327,19 +336,11 @@ BlendCase::IterateResult BlendCase::iterate (void)
 	UVec4 compareThreshold = (m_useSrgbFbo ? tcu::PixelFormat(8, 8, 8, 8) : m_context.getRenderTarget().getPixelFormat()).getColorThreshold().toIVec().asUint()
 							 * UVec4(5) / UVec4(2) + UVec4(m_useSrgbFbo ? 5 : 2); // \note Non-scientific ad hoc formula. Need big threshold when few color bits; blending brings extra inaccuracy.
 
-	bool comparePass = tcu::intThresholdCompare(m_testCtx.getLog(), "CompareResult", "Image Comparison Result",
-												referenceImg.getAccess(), renderedImg.getAccess(),
-												compareThreshold, tcu::COMPARE_LOG_RESULT);
-
-	// Fail now if images don't match.
-
-	if (!comparePass)
-	{
-		m_context.getTestContext().setTestResult(QP_TEST_RESULT_FAIL, "Image compare failed");
-		return STOP;
-	}
+	verifier.submit(tcu::createIntThresholdCompareTask("CompareResult", "Image Comparison Result",
+													   referenceImg.getAccess(), renderedImg.getAccess(),
+													   compareThreshold, tcu::COMPARE_LOG_RESULT));
 
-	// Continue if param sets still remain in m_paramSets; otherwise stop.
+	// Continue if param sets still remain in m_paramSets; otherwise wait for the last comparison and stop.
 
 	m_curParamSetNdx++;
 
@@ -347,7 +348,10 @@ BlendCase::IterateResult BlendCase::iterate (void)
 		return CONTINUE;
 	else
 	{
-		m_context.getTestContext().setTestResult(QP_TEST_RESULT_PASS, "Passed");
+		if (verifier.join(log))
+			m_context.getTestContext().setTestResult(QP_TEST_RESULT_PASS, "Passed");
+		else
+			m_context.getTestContext().setTestResult(QP_TEST_RESULT_FAIL, "Image compare failed");
 		return STOP;
 	}
 }
@@ -22,11 +22,11 @@
  *//*--------------------------------------------------------------------*/
 
 #include "es3pBufferDataUploadTests.hpp"
-#include "glsCalibration.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuSurface.hpp"
 #include "tcuCPUWarmup.hpp"
+#include "tcuPerfStatistics.hpp"
 #include "tcuRenderTarget.hpp"
 #include "gluRenderContext.hpp"
 #include "gluShaderProgram.hpp"
@@ -56,8 +56,9 @@ namespace Performance
 namespace
 {
 
-using gls::theilSenSiegelLinearRegression;
-using gls::LineParametersWithConfidence;
+using tcu::theilSenSiegelLinearRegression;
+using tcu::LineParametersWithConfidence;
+using tcu::linearSample;
 using de::meta::EnableIf;
 using de::meta::Not;
 
@@ -645,25 +646,6 @@ static void busyWait (int microseconds)
 	*tcu::warmupCPUInternal::g_dummy.m_v = dummy;
 }
 
-// Sample from given values using linear interpolation at a given position as if values were laid to range [0, 1]
-template <typename T>
-static float linearSample (const std::vector<T>& values, float position)
-{
-	DE_ASSERT(position >= 0.0f);
-	DE_ASSERT(position <= 1.0f);
-
-	const float	floatNdx			= (float)(values.size() - 1) * position;
-	const int	lowerNdx			= (int)deFloatFloor(floatNdx);
-	const int	higherNdx			= lowerNdx + 1;
-	const float	interpolationFactor = floatNdx - (float)lowerNdx;
-
-	DE_ASSERT(lowerNdx >= 0 && lowerNdx < (int)values.size());
-	DE_ASSERT(higherNdx >= 0 && higherNdx < (int)values.size());
-	DE_ASSERT(interpolationFactor >= 0 && interpolationFactor < 1.0f);
-
-	return tcu::mix((float)values[lowerNdx], (float)values[higherNdx], interpolationFactor);
-}
-
 template <typename T>
 SingleOperationStatistics calculateSingleOperationStatistics (const std::vector<T>& samples, deUint64 T::SampleType::*target)
 {
@@ -30,6 +30,7 @@
 #include "tcuCommandLine.hpp"
 #include "tcuRenderTarget.hpp"
 #include "tcuCPUWarmup.hpp"
+#include "tcuPerfStatistics.hpp"
 #include "tcuStringTemplate.hpp"
 #include "gluTexture.hpp"
 #include "gluPixelTransfer.hpp"
@@ -148,11 +149,7 @@ template <typename T>
 static float vectorFloatMedian (const vector<T>& v)
 {
 	DE_ASSERT(!v.empty());
-	vector<T> temp = v;
-	std::sort(temp.begin(), temp.end());
-	return temp.size() % 2 == 0
-		   ? 0.5f * ((float)temp[temp.size()/2-1] + (float)temp[temp.size()/2])
-		   : (float)temp[temp.size()/2];
+	return tcu::median(v);
 }
 
 template <typename T>
@@ -191,13 +188,8 @@ static float vectorFloatRelativeStandardDeviation (const vector<T>& v)
 template <typename T>
 static float vectorFloatMedianAbsoluteDeviation (const vector<T>& v)
 {
-	float			median				= vectorFloatMedian(v);
-	vector<float>	absoluteDeviations	(v.size());
-
-	for (int i = 0; i < (int)v.size(); i++)
-		absoluteDeviations[i] = deFloatAbs((float)v[i] - median);
-
-	return vectorFloatMedian(absoluteDeviations);
+	DE_ASSERT(!v.empty());
+	return tcu::medianAbsoluteDeviation(v);
 }
 
 template <typename T>
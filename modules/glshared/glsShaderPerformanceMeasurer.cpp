@@ -25,6 +25,7 @@
 #include "gluDefs.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuRenderTarget.hpp"
+#include "tcuPerfStatistics.hpp"
 #include "deStringUtil.hpp"
 #include "deMath.h"
 #include "deClock.h"
@@ -334,6 +335,8 @@ void ShaderPerformanceMeasurer::logMeasurementInfo (TestLog& log) const
 		<< TestLog::Float("FragmentsPerVertices",	"Vertex-fragment ratio",			"Fragments/Vertices",	QP_KEY_TAG_NONE,		(float)numPixels / (float)numVertices)
 		<< TestLog::Float("FragmentPerf",			"Fragment performance",				"MPix/s",				QP_KEY_TAG_PERFORMANCE, (float)mfragPerSecond)
 		<< TestLog::Float("VertexPerf",				"Vertex performance",				"MVert/s",				QP_KEY_TAG_PERFORMANCE, (float)mvertPerSecond);
+
+	tcu::logSampleStatistics(log, "FrameTimeStatistics", "Frame time statistics", tcu::calculateSampleStatistics(measureState.frameTimes), "us");
 }
 
 void ShaderPerformanceMeasurer::setGridSize (int gridW, int gridH)
@@ -31,6 +31,8 @@
 #include "tcuImageCompare.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuRenderTarget.hpp"
+#include "tcuReferenceImageCache.hpp"
+#include "tcuSeedBuilder.hpp"
 
 #include "gluPixelTransfer.hpp"
 #include "gluTexture.hpp"
@@ -45,6 +47,10 @@
 #include "deString.h"
 #include "deMath.h"
 #include "deStringUtil.hpp"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+#include "deUniquePtr.hpp"
+#include "deAtomic.h"
 
 #include <stdio.h>
 #include <vector>
@@ -63,6 +69,7 @@ static const int			GRID_SIZE				= 64;
 static const int			MAX_RENDER_WIDTH		= 128;
 static const int			MAX_RENDER_HEIGHT		= 112;
 static const tcu::Vec4		DEFAULT_CLEAR_COLOR		= tcu::Vec4(0.125f, 0.25f, 0.5f, 1.0f);
+static const int			MIN_VALUES_PER_THREAD	= 2048;
 
 // TextureBinding
 
@@ -157,6 +164,8 @@ public:
 	int						getNumUserAttribs		(void) const { return (int)m_userAttribTransforms.size(); }
 	Vec4					getUserAttrib			(int attribNdx, float sx, float sy) const;
 
+	void					setupBatch				(ShaderEvalBatch& batch, const float* sx, float sy, int numValues) const;
+
 private:
 	int						m_gridSize;
 	int						m_numVertices;
@@ -258,6 +267,58 @@ inline Vec4 QuadGrid::getUserAttrib (int attribNdx, float sx, float sy) const
 	return m_userAttribTransforms[attribNdx] * Vec4(sx, sy, 0.0f, 1.0f);
 }
 
+void QuadGrid::setupBatch (ShaderEvalBatch& batch, const float* sx, float sy, int numValues) const
+{
+	// Same computations as in getCoords(), getUnitCoords() and getUserAttrib(), for a row of values at a time.
+	const float fy = 2.0f * sy - 1.0f;
+
+	DE_ASSERT(numValues <= ShaderEvalBatch::MAX_SIZE);
+	DE_ASSERT(getNumUserAttribs() <= ShaderEvalContext::MAX_USER_ATTRIBS);
+
+	batch.numValues			= numValues;
+	batch.numUserAttribs	= getNumUserAttribs();
+
+	for (int ndx = 0; ndx < numValues; ndx++)
+	{
+		const float fx = 2.0f * sx[ndx] - 1.0f;
+
+		batch.coords[0][ndx]		= fx;
+		batch.coords[1][ndx]		= fy;
+		batch.coords[2][ndx]		= -fx + 0.33f*fy;
+		batch.coords[3][ndx]		= -0.275f*fx - fy;
+
+		batch.unitCoords[0][ndx]	= sx[ndx];
+		batch.unitCoords[1][ndx]	= sy;
+		batch.unitCoords[2][ndx]	= 0.33f*sx[ndx] + 0.5f*sy;
+		batch.unitCoords[3][ndx]	= 0.5f*sx[ndx] + 0.25f*sy;
+
+		batch.color[0][ndx]			= 0.0f;
+		batch.color[1][ndx]			= 0.0f;
+		batch.color[2][ndx]			= 0.0f;
+		batch.color[3][ndx]			= 1.0f;
+		batch.isDiscarded[ndx]		= false;
+	}
+
+	for (int attribNdx = 0; attribNdx < getNumUserAttribs(); attribNdx++)
+	{
+		const Mat4& transform = m_userAttribTransforms[attribNdx];
+
+		for (int compNdx = 0; compNdx < 4; compNdx++)
+		{
+			for (int ndx = 0; ndx < numValues; ndx++)
+			{
+				// Matches Mat4 * Vec4(sx, sy, 0.0, 1.0) exactly
+				float v = 0.0f;
+				v += transform(compNdx, 0) * sx[ndx];
+				v += transform(compNdx, 1) * sy;
+				v += transform(compNdx, 2) * 0.0f;
+				v += transform(compNdx, 3) * 1.0f;
+				batch.in[attribNdx][compNdx][ndx] = v;
+			}
+		}
+	}
+}
+
 // ShaderEvalContext.
 
 ShaderEvalContext::ShaderEvalContext (const QuadGrid& quadGrid_)
@@ -311,6 +372,18 @@ void ShaderEvalContext::reset (float sx, float sy)
 		in[attribNdx] = quadGrid.getUserAttrib(attribNdx, sx, sy);
 }
 
+void ShaderEvalContext::reset (const ShaderEvalBatch& batch, int valueNdx)
+{
+	color		= Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	isDiscarded	= false;
+
+	coords		= batch.getCoords(valueNdx);
+	unitCoords	= batch.getUnitCoords(valueNdx);
+
+	for (int attribNdx = 0; attribNdx < batch.numUserAttribs; attribNdx++)
+		in[attribNdx] = batch.getIn(attribNdx, valueNdx);
+}
+
 tcu::Vec4 ShaderEvalContext::texture2D (int unitNdx, const tcu::Vec2& texCoords)
 {
 	if (textures[unitNdx].tex2D)
@@ -319,6 +392,40 @@ tcu::Vec4 ShaderEvalContext::texture2D (int unitNdx, const tcu::Vec2& texCoords)
 		return tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
 }
 
+// ShaderEvalBatch
+
+ShaderEvalBatch::ShaderEvalBatch (void)
+	: numValues			(0)
+	, numUserAttribs	(0)
+{
+}
+
+tcu::Vec4 ShaderEvalBatch::getCoords (int valueNdx) const
+{
+	return tcu::Vec4(coords[0][valueNdx], coords[1][valueNdx], coords[2][valueNdx], coords[3][valueNdx]);
+}
+
+tcu::Vec4 ShaderEvalBatch::getUnitCoords (int valueNdx) const
+{
+	return tcu::Vec4(unitCoords[0][valueNdx], unitCoords[1][valueNdx], unitCoords[2][valueNdx], unitCoords[3][valueNdx]);
+}
+
+tcu::Vec4 ShaderEvalBatch::getIn (int attribNdx, int valueNdx) const
+{
+	return tcu::Vec4(in[attribNdx][0][valueNdx], in[attribNdx][1][valueNdx], in[attribNdx][2][valueNdx], in[attribNdx][3][valueNdx]);
+}
+
+tcu::Vec4 ShaderEvalBatch::getColor (int valueNdx) const
+{
+	return tcu::Vec4(color[0][valueNdx], color[1][valueNdx], color[2][valueNdx], color[3][valueNdx]);
+}
+
+void ShaderEvalBatch::setColor (int valueNdx, const tcu::Vec4& value)
+{
+	for (int compNdx = 0; compNdx < 4; compNdx++)
+		color[compNdx][valueNdx] = value[compNdx];
+}
+
 // ShaderEvaluator
 
 ShaderEvaluator::ShaderEvaluator (void)
@@ -341,6 +448,134 @@ void ShaderEvaluator::evaluate (ShaderEvalContext& ctx)
 	m_evalFunc(ctx);
 }
 
+void ShaderEvaluator::evaluateBatch (ShaderEvalContext& ctx, ShaderEvalBatch& batch)
+{
+	for (int valueNdx = 0; valueNdx < batch.numValues; valueNdx++)
+	{
+		ctx.reset(batch, valueNdx);
+		evaluate(ctx);
+
+		batch.setColor(valueNdx, ctx.color);
+		batch.isDiscarded[valueNdx] = ctx.isDiscarded;
+	}
+}
+
+namespace
+{
+
+// Evaluates shader at a grid of points given as separate x and y coordinates. Rows are claimed by worker threads.
+class GridEvaluator
+{
+public:
+	GridEvaluator (ShaderEvaluator& evaluator, const QuadGrid& quadGrid, const vector<float>& sx, const vector<float>& sy, qpWatchDog* watchDog)
+		: m_evaluator	(evaluator)
+		, m_quadGrid	(quadGrid)
+		, m_sx			(sx)
+		, m_sy			(sy)
+		, m_watchDog	(watchDog)
+		, m_colors		(sx.size()*sy.size())
+		, m_isDiscarded	(sx.size()*sy.size(), 0)
+		, m_nextRow		(0)
+	{
+	}
+
+	//! Evaluate rows until all rows have been claimed. Called from all evaluation threads.
+	void processRows (bool isMainThread)
+	{
+		const int								numCols	= (int)m_sx.size();
+		ShaderEvalContext						evalCtx	(m_quadGrid);
+		const de::UniquePtr<ShaderEvalBatch>	batch	(new ShaderEvalBatch());
+
+		for (;;)
+		{
+			const int rowNdx = (int)deAtomicIncrementInt32(&m_nextRow) - 1;
+
+			if (rowNdx >= (int)m_sy.size())
+				break;
+
+			for (int colOffset = 0; colOffset < numCols; colOffset += ShaderEvalBatch::MAX_SIZE)
+			{
+				const int numValues = de::min(numCols - colOffset, (int)ShaderEvalBatch::MAX_SIZE);
+
+				m_quadGrid.setupBatch(*batch, &m_sx[colOffset], m_sy[rowNdx], numValues);
+				m_evaluator.evaluateBatch(evalCtx, *batch);
+
+				for (int valueNdx = 0; valueNdx < numValues; valueNdx++)
+				{
+					m_colors[rowNdx*numCols + colOffset + valueNdx]			= batch->getColor(valueNdx);
+					m_isDiscarded[rowNdx*numCols + colOffset + valueNdx]	= batch->isDiscarded[valueNdx] ? 1 : 0;
+				}
+			}
+
+			if (isMainThread && m_watchDog)
+				qpWatchDog_touch(m_watchDog);
+		}
+	}
+
+	const Vec4&		getColor		(int x, int y) const	{ return m_colors[y*(int)m_sx.size() + x];				}
+	bool			isDiscarded		(int x, int y) const	{ return m_isDiscarded[y*(int)m_sx.size() + x] != 0;	}
+
+private:
+	ShaderEvaluator&		m_evaluator;
+	const QuadGrid&			m_quadGrid;
+	const vector<float>&	m_sx;
+	const vector<float>&	m_sy;
+	qpWatchDog* const		m_watchDog;
+
+	vector<Vec4>			m_colors;
+	vector<deUint8>			m_isDiscarded;
+	volatile deInt32		m_nextRow;
+};
+
+class GridEvaluateThread : public de::Thread
+{
+public:
+	GridEvaluateThread (GridEvaluator& evaluator)
+		: m_evaluator(evaluator)
+	{
+	}
+
+	void run (void)
+	{
+		m_evaluator.processRows(false);
+	}
+
+private:
+	GridEvaluator&	m_evaluator;
+};
+
+void evaluateGrid (GridEvaluator& evaluator, int numValues)
+{
+	const int										numThreads	= de::min((int)deGetNumAvailableLogicalCores(), numValues / MIN_VALUES_PER_THREAD);
+	std::vector<de::SharedPtr<GridEvaluateThread> >	threads;
+
+	// Calling thread evaluates rows as well.
+	try
+	{
+		for (int threadNdx = 1; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<GridEvaluateThread>(new GridEvaluateThread(evaluator)));
+			threads.back()->start();
+		}
+
+		evaluator.processRows(true);
+	}
+	catch (...)
+	{
+		for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		{
+			if (threads[threadNdx]->isStarted())
+				threads[threadNdx]->join();
+		}
+		throw;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); threadNdx++)
+		threads[threadNdx]->join();
+}
+
+} // anonymous
+
 // ShaderRenderCase.
 
 ShaderRenderCase::ShaderRenderCase (TestContext& testCtx, RenderContext& renderCtx, const ContextInfo& ctxInfo, const char* name, const char* description, bool isVertexCase, ShaderEvalFunc evalFunc)
@@ -352,6 +587,7 @@ ShaderRenderCase::ShaderRenderCase (TestContext& testCtx, RenderContext& renderC
 	, m_evaluator			(m_defaultEvaluator)
 	, m_clearColor			(DEFAULT_CLEAR_COLOR)
 	, m_program				(DE_NULL)
+	, m_numReferences		(0)
 {
 }
 
@@ -364,6 +600,7 @@ ShaderRenderCase::ShaderRenderCase (TestContext& testCtx, RenderContext& renderC
 	, m_evaluator			(evaluator)
 	, m_clearColor			(DEFAULT_CLEAR_COLOR)
 	, m_program				(DE_NULL)
+	, m_numReferences		(0)
 {
 }
 
@@ -379,6 +616,8 @@ void ShaderRenderCase::init (void)
 
 	GLU_EXPECT_NO_ERROR(gl.getError(), "ShaderRenderCase::init() begin");
 
+	m_numReferences = 0;
+
 	if (m_vertShaderSource.empty() || m_fragShaderSource.empty())
 	{
 		DE_ASSERT(m_vertShaderSource.empty() && m_fragShaderSource.empty());
@@ -439,12 +678,32 @@ TestNode::IterateResult ShaderRenderCase::iterate (void)
 	Surface resImage(width, height);
 	render(resImage, programID, quadGrid);
 
-	// Compute reference.
-	Surface refImage (width, height);
-	if (m_isVertexCase)
-		computeVertexReference(refImage, quadGrid);
+	// Compute reference, or use cached one. Reference depends on case, shaders and inputs. Subclasses
+	// may change evaluator state between iterations so iteration index is part of the key as well.
+	Surface					refImage	(width, height);
+	ReferenceImageCache&	refCache	= m_testCtx.getReferenceImageCache();
+	SeedBuilder				refParams;
+
+	refParams << m_numReferences++ << m_isVertexCase << quadGrid.getGridSize() << m_vertShaderSource << m_fragShaderSource;
+
+	for (size_t transformNdx = 0; transformNdx < m_userAttribTransforms.size(); transformNdx++)
+	{
+		for (int row = 0; row < 4; row++)
+		for (int col = 0; col < 4; col++)
+			refParams << m_userAttribTransforms[transformNdx](row, col);
+	}
+
+	if (refCache.lookup(refParams.get(), refImage.getAccess()))
+		m_testCtx.getLog() << TestLog::Message << "Using cached reference image" << TestLog::EndMessage;
 	else
-		computeFragmentReference(refImage, quadGrid);
+	{
+		if (m_isVertexCase)
+			computeVertexReference(refImage, quadGrid);
+		else
+			computeFragmentReference(refImage, quadGrid);
+
+		refCache.store(refParams.get(), refImage.getAccess());
+	}
 
 	// Compare.
 	bool testOk = compareImages(resImage, refImage, 0.05f);
@@ -640,21 +899,23 @@ void ShaderRenderCase::computeVertexReference (Surface& result, const QuadGrid&
 	int					gridSize	= quadGrid.getGridSize();
 	int					stride		= gridSize + 1;
 	bool				hasAlpha	= m_renderCtx.getRenderTarget().getPixelFormat().alphaBits > 0;
-	ShaderEvalContext	evalCtx		(quadGrid);
+	vector<float>		gridCoords	(gridSize+1);
+
+	for (int ndx = 0; ndx < gridSize+1; ndx++)
+		gridCoords[ndx] = (float)ndx / (float)gridSize;
 
 	// Evaluate color for each vertex.
+	GridEvaluator evaluator (m_evaluator, quadGrid, gridCoords, gridCoords, m_testCtx.getWatchDog());
+	evaluateGrid(evaluator, (gridSize+1)*(gridSize+1));
+
 	vector<Vec4> colors((gridSize+1)*(gridSize+1));
 	for (int y = 0; y < gridSize+1; y++)
 	for (int x = 0; x < gridSize+1; x++)
 	{
-		float				sx			= (float)x / (float)gridSize;
-		float				sy			= (float)y / (float)gridSize;
 		int					vtxNdx		= ((y * (gridSize+1)) + x);
 
-		evalCtx.reset(sx, sy);
-		m_evaluator.evaluate(evalCtx);
-		DE_ASSERT(!evalCtx.isDiscarded); // Discard is not available in vertex shader.
-		Vec4 color = evalCtx.color;
+		DE_ASSERT(!evaluator.isDiscarded(x, y)); // Discard is not available in vertex shader.
+		Vec4 color = evaluator.getColor(x, y);
 
 		if (!hasAlpha)
 			color.w() = 1.0f;
@@ -725,19 +986,25 @@ void ShaderRenderCase::computeFragmentReference (Surface& result, const QuadGrid
 	int					width		= result.getWidth();
 	int					height		= result.getHeight();
 	bool				hasAlpha	= m_renderCtx.getRenderTarget().getPixelFormat().alphaBits > 0;
-	ShaderEvalContext	evalCtx		(quadGrid);
+	vector<float>		sx			(width);
+	vector<float>		sy			(height);
+
+	for (int x = 0; x < width; x++)
+		sx[x] = ((float)x + 0.5f) / (float)width;
+
+	for (int y = 0; y < height; y++)
+		sy[y] = ((float)y + 0.5f) / (float)height;
+
+	// Evaluate.
+	GridEvaluator evaluator (m_evaluator, quadGrid, sx, sy, m_testCtx.getWatchDog());
+	evaluateGrid(evaluator, width*height);
 
 	// Render.
 	for (int y = 0; y < height; y++)
 	for (int x = 0; x < width; x++)
 	{
-		float sx = ((float)x + 0.5f) / (float)width;
-		float sy = ((float)y + 0.5f) / (float)height;
-
-		evalCtx.reset(sx, sy);
-		m_evaluator.evaluate(evalCtx);
 		// Select either clear color or computed color based on discarded bit.
-		Vec4 color = evalCtx.isDiscarded ? m_clearColor : evalCtx.color;
+		Vec4 color = evaluator.isDiscarded(x, y) ? m_clearColor : evaluator.getColor(x, y);
 
 		if (!hasAlpha)
 			color.w() = 1.0f;
@@ -68,6 +68,7 @@ private:
 };
 
 class QuadGrid;
+class ShaderEvalBatch;
 
 // TextureBinding
 
@@ -149,6 +150,7 @@ public:
 							~ShaderEvalContext		(void);
 
 	void					reset					(float sx, float sy);
+	void					reset					(const ShaderEvalBatch& batch, int valueNdx);
 
 	// Inputs.
 	tcu::Vec4				coords;
@@ -170,6 +172,38 @@ private:
 	const QuadGrid&			quadGrid;
 };
 
+// ShaderEvalBatch.
+// Inputs and outputs for a row of evaluations, one array per vector component.
+
+class ShaderEvalBatch
+{
+public:
+	enum
+	{
+		MAX_SIZE	= 128
+	};
+
+							ShaderEvalBatch			(void);
+
+	tcu::Vec4				getCoords				(int valueNdx) const;
+	tcu::Vec4				getUnitCoords			(int valueNdx) const;
+	tcu::Vec4				getIn					(int attribNdx, int valueNdx) const;
+	tcu::Vec4				getColor				(int valueNdx) const;
+	void					setColor				(int valueNdx, const tcu::Vec4& value);
+
+	int						numValues;
+	int						numUserAttribs;
+
+	// Inputs.
+	float					coords[4][MAX_SIZE];
+	float					unitCoords[4][MAX_SIZE];
+	float					in[ShaderEvalContext::MAX_USER_ATTRIBS][4][MAX_SIZE];
+
+	// Outputs.
+	float					color[4][MAX_SIZE];
+	bool					isDiscarded[MAX_SIZE];
+};
+
 // ShaderEvalFunc.
 
 typedef void (*ShaderEvalFunc) (ShaderEvalContext& c);
@@ -181,7 +215,8 @@ inline void evalCoordsPassthrough		(ShaderEvalContext& c) { c.color = c.coords;
 inline void evalCoordsSwizzleWZYX		(ShaderEvalContext& c) { c.color = c.coords.swizzle(3,2,1,0); }
 
 // ShaderEvaluator
-// Either inherit a class with overridden evaluate() or just pass in an evalFunc.
+// Either inherit a class with overridden evaluate() or evaluateBatch(), or just pass in an evalFunc.
+// Reference is computed in several threads at once, so evaluation must not modify evaluator state.
 
 class ShaderEvaluator
 {
@@ -192,6 +227,9 @@ public:
 
 	virtual void		evaluate				(ShaderEvalContext& ctx);
 
+	//! Evaluate all values in batch. Default implementation calls evaluate() for each value using ctx.
+	virtual void		evaluateBatch			(ShaderEvalContext& ctx, ShaderEvalBatch& batch);
+
 private:
 						ShaderEvaluator			(const ShaderEvaluator&);	// not allowed!
 	ShaderEvaluator&	operator=				(const ShaderEvaluator&);	// not allowed!
@@ -252,6 +290,9 @@ protected:
 	std::vector<TextureBinding>	m_textures;
 
 	glu::ShaderProgram*			m_program;
+
+private:
+	int							m_numReferences;		//!< References computed since init(), part of reference cache key.
 };
 
 // Helpers.
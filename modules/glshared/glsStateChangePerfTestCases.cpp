@@ -24,6 +24,7 @@
 #include "glsStateChangePerfTestCases.hpp"
 
 #include "tcuTestLog.hpp"
+#include "tcuCPUWarmup.hpp"
 
 #include "gluDefs.hpp"
 #include "gluRenderContext.hpp"
@@ -52,55 +53,6 @@ namespace gls
 namespace
 {
 
-struct ResultStats
-{
-	double		median;
-	double		mean;
-	double		variance;
-
-	deUint64	min;
-	deUint64	max;
-};
-
-ResultStats calculateStats (const vector<deUint64>& values)
-{
-	ResultStats result = { 0.0, 0.0, 0.0, 0xFFFFFFFFFFFFFFFFu, 0 };
-
-	deUint64 sum = 0;
-
-	for (int i = 0; i < (int)values.size(); i++)
-		sum += values[i];
-
-	result.mean = ((double)sum) / (double)values.size();
-
-	for (int i = 0; i < (int)values.size(); i++)
-	{
-		const double val = (double)values[i];
-		result.variance += (val - result.mean) * (val - result.mean);
-	}
-
-	result.variance /= (double)values.size();
-
-	{
-		const int n = (int)(values.size()/2);
-
-		vector<deUint64> sortedValues = values;
-
-		std::sort(sortedValues.begin(), sortedValues.end());
-
-		result.median = (double)sortedValues[n];
-	}
-
-	for (int i = 0; i < (int)values.size(); i++)
-	{
-		result.min = std::min(result.min, values[i]);
-		result.max = std::max(result.max, values[i]);
-	}
-
-	return result;
-}
-
-
 void genIndices (vector<GLushort>& indices, int triangleCount)
 {
 	indices.reserve(triangleCount*3);
@@ -163,49 +115,6 @@ void genTextureData (vector<deUint8>& data, int width, int height)
 	}
 }
 
-double calculateVariance (const vector<deUint64>& values, double avg)
-{
-	double sum = 0.0;
-
-	for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-	{
-		double value = (double)values[valueNdx];
-		sum += (value - avg) * (value - avg);
-	}
-
-	return sum / (double)values.size();
-}
-
-deUint64 findMin (const vector<deUint64>& values)
-{
-	deUint64 min = ~0ull;
-
-	for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-		min = std::min(values[valueNdx], min);
-
-	return min;
-}
-
-deUint64 findMax (const vector<deUint64>& values)
-{
-	deUint64 max = 0;
-
-	for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-		max = std::max(values[valueNdx], max);
-
-	return max;
-}
-
-deUint64 findMedian (const vector<deUint64>& v)
-{
-	vector<deUint64> values = v;
-	size_t n = values.size() / 2;
-
-	std::nth_element(values.begin(), values.begin() + n, values.end());
-
-	return values[n];
-}
-
 } // anonymous
 
 StateChangePerformanceCase::StateChangePerformanceCase (tcu::TestContext& testCtx, glu::RenderContext& renderCtx, const char* name, const char* description, DrawType drawType, int drawCallCount, int triangleCount)
@@ -538,26 +447,29 @@ void StateChangePerformanceCase::deinit (void)
 
 void StateChangePerformanceCase::logAndSetTestResult (void)
 {
-	TestLog&	log			= m_testCtx.getLog();
+	TestLog&						log			= m_testCtx.getLog();
 
-	ResultStats interleaved	= calculateStats(m_interleavedResults);
-	ResultStats batched		= calculateStats(m_batchedResults);
+	const tcu::SampleStatistics		interleaved	= tcu::calculateSampleStatistics(m_interleavedResults);
+	const tcu::SampleStatistics		batched		= tcu::calculateSampleStatistics(m_batchedResults);
 
 	log << TestLog::Message << "Interleaved mean: "					<< interleaved.mean						<< TestLog::EndMessage;
 	log << TestLog::Message << "Interleaved median: "				<< interleaved.median					<< TestLog::EndMessage;
 	log << TestLog::Message << "Interleaved variance: "				<< interleaved.variance					<< TestLog::EndMessage;
-	log << TestLog::Message << "Interleaved min: "					<< interleaved.min						<< TestLog::EndMessage;
-	log << TestLog::Message << "Interleaved max: "					<< interleaved.max						<< TestLog::EndMessage;
+	log << TestLog::Message << "Interleaved min: "					<< interleaved.minimum					<< TestLog::EndMessage;
+	log << TestLog::Message << "Interleaved max: "					<< interleaved.maximum					<< TestLog::EndMessage;
 
 	log << TestLog::Message << "Batched mean: "						<< batched.mean							<< TestLog::EndMessage;
 	log << TestLog::Message << "Batched median: "					<< batched.median						<< TestLog::EndMessage;
 	log << TestLog::Message << "Batched variance: "					<< batched.variance						<< TestLog::EndMessage;
-	log << TestLog::Message << "Batched min: "						<< batched.min							<< TestLog::EndMessage;
-	log << TestLog::Message << "Batched max: "						<< batched.max							<< TestLog::EndMessage;
+	log << TestLog::Message << "Batched min: "						<< batched.minimum						<< TestLog::EndMessage;
+	log << TestLog::Message << "Batched max: "						<< batched.maximum						<< TestLog::EndMessage;
 
 	log << TestLog::Message << "Batched/Interleaved mean ratio: "	<< (interleaved.mean/batched.mean)		<< TestLog::EndMessage;
 	log << TestLog::Message << "Batched/Interleaved median ratio: "	<< (interleaved.median/batched.median)	<< TestLog::EndMessage;
 
+	tcu::logSamples(log, "InterleavedSamples",	"Interleaved rendering times",	vector<float>(m_interleavedResults.begin(), m_interleavedResults.end()),	"us");
+	tcu::logSamples(log, "BatchedSamples",		"Batched rendering times",		vector<float>(m_batchedResults.begin(), m_batchedResults.end()),			"us");
+
 	m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)(((double)interleaved.median) / batched.median), 2).c_str());
 }
 
@@ -642,8 +554,8 @@ void StateChangePerformanceCase::callDraw (const glw::Functions& gl)
 StateChangeCallPerformanceCase::StateChangeCallPerformanceCase (tcu::TestContext& testCtx, glu::RenderContext& renderCtx, const char* name, const char* description)
 	: tcu::TestCase		(testCtx, tcu::NODETYPE_PERFORMANCE, name, description)
 	, m_renderCtx		(renderCtx)
-	, m_iterationCount	(100)
 	, m_callCount		(1000)
+	, m_sampler			(tcu::AdaptiveSampler::Parameters(20, 100, 0.05f, 0.95f))
 {
 }
 
@@ -659,60 +571,58 @@ void StateChangeCallPerformanceCase::executeTest (void)
 
 	beginTimeUs = deGetMicroseconds();
 
-	execCalls(gl, (int)m_results.size(), m_callCount);
+	execCalls(gl, (int)m_sampler.getSamples().size(), m_callCount);
 
 	endTimeUs = deGetMicroseconds();
 
-	m_results.push_back(endTimeUs - beginTimeUs);
+	m_sampler.addSample((float)(endTimeUs - beginTimeUs));
 }
 
 void StateChangeCallPerformanceCase::logTestCase (void)
 {
 	TestLog& log = m_testCtx.getLog();
 
-	log << TestLog::Message << "Iteration count: " << m_iterationCount << TestLog::EndMessage;
+	log << TestLog::Message << "Maximum iteration count: " << m_sampler.getParameters().maxSamples << TestLog::EndMessage;
 	log << TestLog::Message << "Per iteration call count: " << m_callCount << TestLog::EndMessage;
 }
 
-double calculateAverage (const vector<deUint64>& values)
+void StateChangeCallPerformanceCase::logAndSetTestResult (void)
 {
-	deUint64 sum = 0;
+	TestLog&						log				= m_testCtx.getLog();
 
-	for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-		sum += values[valueNdx];
+	const tcu::SampleStatistics		stats			= tcu::calculateSampleStatistics(m_sampler.getSteadyStateSamples());
+	const tcu::ConfidenceInterval	interval		= m_sampler.getConfidenceInterval();
+	const double					avgCallUs		= stats.mean / m_callCount;
+	const double					avgMedianCallUs	= stats.median / m_callCount;
 
-	return ((double)sum) / (double)values.size();
-}
+	log << TestLog::Message << "Iteration count: " << m_sampler.getSamples().size() << ", of which " << m_sampler.getWarmupLength() << " discarded as warmup" << TestLog::EndMessage;
 
-void StateChangeCallPerformanceCase::logAndSetTestResult (void)
-{
-	TestLog&	log				= m_testCtx.getLog();
-
-	deUint64	minUs			= findMin(m_results);
-	deUint64	maxUs			= findMax(m_results);
-	deUint64	medianUs		= findMedian(m_results);
-	double		avgIterationUs	= calculateAverage(m_results);
-	double		avgCallUs		= avgIterationUs / m_callCount;
-	double		varIteration	= calculateVariance(m_results, avgIterationUs);
-	double		avgMedianCallUs	= ((double)medianUs)/m_callCount;
-
-	log << TestLog::Message << "Min iteration time: "						<< minUs << "us" << TestLog::EndMessage;
-	log << TestLog::Message << "Max iteration time: "						<< maxUs << "us" << TestLog::EndMessage;
-	log << TestLog::Message << "Average iteration time: "					<< avgIterationUs << "us" << TestLog::EndMessage;
-	log << TestLog::Message << "Iteration variance time: "					<< varIteration << TestLog::EndMessage;
-	log << TestLog::Message << "Median iteration time: "					<< medianUs << "us" << TestLog::EndMessage;
+	if (!m_sampler.isTargetReached())
+		log << TestLog::Message << "Maximum iteration count reached before median time converged." << TestLog::EndMessage;
+
+	log << TestLog::Message << "Min iteration time: "						<< stats.minimum << "us" << TestLog::EndMessage;
+	log << TestLog::Message << "Max iteration time: "						<< stats.maximum << "us" << TestLog::EndMessage;
+	log << TestLog::Message << "Average iteration time: "					<< stats.mean << "us" << TestLog::EndMessage;
+	log << TestLog::Message << "Iteration variance time: "					<< stats.variance << TestLog::EndMessage;
+	log << TestLog::Message << "Median iteration time: "					<< stats.median << "us" << TestLog::EndMessage;
+	log << TestLog::Message << "Median iteration time " << (int)(interval.confidence * 100.0f) << "% confidence interval: [" << interval.lower << "us, " << interval.upper << "us]" << TestLog::EndMessage;
 	log << TestLog::Message << "Average call time: "						<< avgCallUs << "us" << TestLog::EndMessage;
 	log << TestLog::Message << "Average call time for median iteration: "	<< avgMedianCallUs << "us" << TestLog::EndMessage;
 
+	tcu::logSamples(log, "IterationTimes", "Iteration times", m_sampler.getSamples(), "us");
+
 	m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)avgMedianCallUs, 3).c_str());
 }
 
 tcu::TestCase::IterateResult StateChangeCallPerformanceCase::iterate (void)
 {
-	if (m_results.empty())
+	if (m_sampler.getSamples().empty())
+	{
 		logTestCase();
+		tcu::warmupCPU();
+	}
 
-	if ((int)m_results.size() < m_iterationCount)
+	if (!m_sampler.isDone())
 	{
 		executeTest();
 		GLU_EXPECT_NO_ERROR(m_renderCtx.getFunctions().getError(), "Unexpected error");
@@ -25,6 +25,7 @@
 
 #include "tcuDefs.hpp"
 #include "tcuTestCase.hpp"
+#include "tcuPerfStatistics.hpp"
 
 namespace glu
 {
@@ -124,10 +125,9 @@ private:
 
 	glu::RenderContext&		m_renderCtx;
 
-	const int				m_iterationCount;
 	const int				m_callCount;
 
-	std::vector<deUint64>	m_results;
+	tcu::AdaptiveSampler	m_sampler;
 };
 
 } // gls
@@ -25,6 +25,7 @@
 #include "tcuTestLog.hpp"
 
 // depool
+#include "deMemPool.h"
 #include "dePoolArray.h"
 #include "dePoolHeap.h"
 #include "dePoolHash.h"
@@ -40,6 +41,7 @@
 // deutil
 #include "deTimerTest.h"
 #include "deCommandLine.h"
+#include "deFile.h"
 
 // debase
 #include "deInt32.h"
@@ -79,6 +81,7 @@ public:
 
 	void init (void)
 	{
+		addChild(new SelfCheckCase(m_testCtx, "mem_pool",	"deMemPool_selfTest()",			deMemPool_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "array",		"dePoolArray_selfTest()",		dePoolArray_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "heap",		"dePoolHeap_selfTest()",		dePoolHeap_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "hash",		"dePoolHash_selfTest()",		dePoolHash_selfTest));
@@ -147,6 +150,7 @@ public:
 	{
 		addChild(new SelfCheckCase(m_testCtx, "timer",			"deTimer_selfTest()",		deTimer_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "command_line",	"deCommandLine_selfTest()",	deCommandLine_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "file",			"deFile_selfTest()",		deFile_selfTest));
 	}
 };
 
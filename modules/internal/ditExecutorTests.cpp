@@ -0,0 +1,618 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Test Module
+ * ---------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test executor tests.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditExecutorTests.hpp"
+#include "tcuTestLog.hpp"
+#include "xeTestResultMatcher.hpp"
+#include "xeTestCaseListParser.hpp"
+#include "xeTestCase.hpp"
+#include "xeTestCaseIndex.hpp"
+#include "deString.h"
+#include "deRandom.hpp"
+#include "deStringUtil.hpp"
+
+#include <sstream>
+
+namespace dit
+{
+
+using tcu::TestLog;
+using std::string;
+using std::vector;
+
+namespace
+{
+
+struct ResultDesc
+{
+	const char*			casePath;
+	xe::TestStatusCode	statusCode;
+};
+
+class ArrayResultSource : public xe::TestResultSource
+{
+public:
+	ArrayResultSource (const ResultDesc* results, int numResults)
+		: m_results		(results)
+		, m_numResults	(numResults)
+		, m_pos			(0)
+	{
+	}
+
+	bool getNext (xe::TestCaseResultHeader& dst)
+	{
+		if (m_pos == m_numResults)
+			return false;
+
+		dst				= xe::TestCaseResultHeader();
+		dst.casePath	= m_results[m_pos].casePath;
+		dst.caseType	= xe::TESTCASETYPE_SELF_VALIDATE;
+		dst.statusCode	= m_results[m_pos].statusCode;
+		m_pos += 1;
+
+		return true;
+	}
+
+private:
+	const ResultDesc*	m_results;
+	const int			m_numResults;
+	int					m_pos;
+};
+
+//! Format matched results as CSV rows, using the same status names as testlog-to-csv.
+class CsvResultHandler : public xe::MatchedResultHandler
+{
+public:
+	void matched (const vector<xe::TestCaseResultHeader>& results)
+	{
+		m_str << results[0].casePath;
+
+		for (vector<xe::TestCaseResultHeader>::const_iterator iter = results.begin(); iter != results.end(); ++iter)
+			m_str << "," << (iter->statusCode == xe::TESTSTATUSCODE_LAST ? "Missing" : xe::getTestStatusCodeName(iter->statusCode));
+
+		m_str << "\n";
+	}
+
+	string getRows (void) const { return m_str.str(); }
+
+private:
+	std::ostringstream	m_str;
+};
+
+class ResultMatcherCase : public tcu::TestCase
+{
+public:
+	ResultMatcherCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "result_matcher", "Match results of logs with different case order and duplicate cases")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		// Both logs list a case twice; the first result of each log must be used.
+		static const ResultDesc s_logA[] =
+		{
+			{ "group.a",		xe::TESTSTATUSCODE_PASS		},
+			{ "group.b",		xe::TESTSTATUSCODE_FAIL		},
+			{ "group.a",		xe::TESTSTATUSCODE_FAIL		},
+			{ "group.c",		xe::TESTSTATUSCODE_PASS		},
+		};
+		static const ResultDesc s_logB[] =
+		{
+			{ "group.c",		xe::TESTSTATUSCODE_PASS		},
+			{ "group.b",		xe::TESTSTATUSCODE_FAIL		},
+			{ "group.b",		xe::TESTSTATUSCODE_PASS		},
+			{ "group.a",		xe::TESTSTATUSCODE_PASS		},
+			{ "group.d",		xe::TESTSTATUSCODE_CRASH	},
+			{ "group.c",		xe::TESTSTATUSCODE_FAIL		},
+		};
+		static const char* const s_expected =
+			"group.a,Pass,Pass\n"
+			"group.b,Fail,Fail\n"
+			"group.c,Pass,Pass\n"
+			"group.d,Missing,Crash\n";
+
+		ArrayResultSource				logA		(s_logA, DE_LENGTH_OF_ARRAY(s_logA));
+		ArrayResultSource				logB		(s_logB, DE_LENGTH_OF_ARRAY(s_logB));
+		vector<xe::TestResultSource*>	sources;
+		CsvResultHandler				handler;
+
+		sources.push_back(&logA);
+		sources.push_back(&logB);
+
+		xe::matchTestResults(sources, handler);
+
+		m_testCtx.getLog() << TestLog::Message << "Matched results:\n" << handler.getRows() << TestLog::EndMessage;
+
+		if (handler.getRows() == s_expected)
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		else
+		{
+			m_testCtx.getLog() << TestLog::Message << "Expected:\n" << s_expected << TestLog::EndMessage;
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Invalid matched results");
+		}
+
+		return STOP;
+	}
+};
+
+//! Writes binary case list in the format of --deqp-runmode=bin-caselist.
+class BinaryCaseListBuilder
+{
+public:
+	enum Code
+	{
+		CODE_END = 0,
+		CODE_GROUP,
+		CODE_SELF_VALIDATE,
+		CODE_CAPABILITY,
+		CODE_ACCURACY,
+		CODE_PERFORMANCE
+	};
+
+	BinaryCaseListBuilder (deUint32 version = 1)
+	{
+		static const char s_magic[] = { 'd', 'Q', 'C', 'L' };
+
+		m_data.insert(m_data.end(), DE_ARRAY_BEGIN(s_magic), DE_ARRAY_END(s_magic));
+		writeUint32(version);
+		writeString("dE-TEST");
+		writeString("Package description");
+	}
+
+	void enter (Code code, const char* name, const char* description)
+	{
+		m_data.push_back((deUint8)code);
+		writeString(name);
+		writeString(description);
+	}
+
+	void end (void)
+	{
+		m_data.push_back((deUint8)CODE_END);
+	}
+
+	const vector<deUint8>& getData (void) const { return m_data; }
+
+private:
+	void writeUint32 (deUint32 value)
+	{
+		for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+			m_data.push_back((deUint8)(value >> (8*byteNdx)));
+	}
+
+	void writeString (const string& str)
+	{
+		writeUint32((deUint32)str.size());
+		m_data.insert(m_data.end(), str.begin(), str.end());
+	}
+
+	vector<deUint8> m_data;
+};
+
+bool parseBinaryCaseListFails (const vector<deUint8>& data, size_t numBytes)
+{
+	xe::TestRoot			root;
+	xe::TestGroup* const	package	= root.createGroup("dE-TEST", "");
+
+	try
+	{
+		xe::parseBinaryCaseList(package, data.empty() ? DE_NULL : &data[0], numBytes);
+		return false;
+	}
+	catch (const xe::Error&)
+	{
+		return true;
+	}
+}
+
+void compareTestNodes (const xe::TestNode& a, const xe::TestNode& b)
+{
+	TCU_CHECK(a.getNodeType() == b.getNodeType());
+	TCU_CHECK(string(a.getName()) == b.getName());
+	TCU_CHECK(string(a.getDescription()) == b.getDescription());
+
+	if (a.getNodeType() == xe::TESTNODETYPE_TEST_CASE)
+		TCU_CHECK(static_cast<const xe::TestCase&>(a).getCaseType() == static_cast<const xe::TestCase&>(b).getCaseType());
+	else
+	{
+		const xe::TestGroup&	groupA	= static_cast<const xe::TestGroup&>(a);
+		const xe::TestGroup&	groupB	= static_cast<const xe::TestGroup&>(b);
+
+		TCU_CHECK(groupA.getNumChildren() == groupB.getNumChildren());
+
+		for (int childNdx = 0; childNdx < groupA.getNumChildren(); childNdx++)
+			compareTestNodes(*groupA.getChild(childNdx), *groupB.getChild(childNdx));
+	}
+}
+
+class BinaryCaseListCase : public tcu::TestCase
+{
+public:
+	BinaryCaseListCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "binary_case_list", "Parse binary case list and compare to XML case list")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const char* const s_xmlCaseList =
+			"<?xml version=\"1.0\"?>\n"
+			"<TestCaseList PackageName=\"dE-TEST\" Description=\"Package description\">\n"
+			"<TestCase Name=\"info\" CaseType=\"TestGroup\" Description=\"Info tests\">\n"
+			"  <TestCase Name=\"version\" CaseType=\"SelfValidate\" Description=\"Version\" />\n"
+			"  <TestCase Name=\"caps\" CaseType=\"Capability\" Description=\"\" />\n"
+			"</TestCase>\n"
+			"<TestCase Name=\"functional\" CaseType=\"TestGroup\" Description=\"Functional tests\">\n"
+			"  <TestCase Name=\"empty\" CaseType=\"TestGroup\" Description=\"Empty group\">\n"
+			"  </TestCase>\n"
+			"  <TestCase Name=\"nested\" CaseType=\"TestGroup\" Description=\"\">\n"
+			"    <TestCase Name=\"accuracy\" CaseType=\"Accuracy\" Description=\"a &lt; b &amp; &quot;c&quot;\" />\n"
+			"    <TestCase Name=\"performance\" CaseType=\"Performance\" Description=\"Performance\" />\n"
+			"  </TestCase>\n"
+			"  <TestCase Name=\"last\" CaseType=\"SelfValidate\" Description=\"Last case\" />\n"
+			"</TestCase>\n"
+			"<TestCase Name=\"root_case\" CaseType=\"SelfValidate\" Description=\"Case in root\" />\n"
+			"</TestCaseList>\n";
+
+		BinaryCaseListBuilder	builder;
+		xe::TestRoot			xmlRoot;
+		xe::TestRoot			binaryRoot;
+		xe::TestGroup* const	xmlPackage		= xmlRoot.createGroup("dE-TEST", "");
+		xe::TestGroup* const	binaryPackage	= binaryRoot.createGroup("dE-TEST", "");
+
+		builder.enter(BinaryCaseListBuilder::CODE_GROUP, "info", "Info tests");
+		builder.enter(BinaryCaseListBuilder::CODE_SELF_VALIDATE, "version", "Version");
+		builder.enter(BinaryCaseListBuilder::CODE_CAPABILITY, "caps", "");
+		builder.end();
+		builder.enter(BinaryCaseListBuilder::CODE_GROUP, "functional", "Functional tests");
+		builder.enter(BinaryCaseListBuilder::CODE_GROUP, "empty", "Empty group");
+		builder.end();
+		builder.enter(BinaryCaseListBuilder::CODE_GROUP, "nested", "");
+		builder.enter(BinaryCaseListBuilder::CODE_ACCURACY, "accuracy", "a < b & \"c\"");
+		builder.enter(BinaryCaseListBuilder::CODE_PERFORMANCE, "performance", "Performance");
+		builder.end();
+		builder.enter(BinaryCaseListBuilder::CODE_SELF_VALIDATE, "last", "Last case");
+		builder.end();
+		builder.enter(BinaryCaseListBuilder::CODE_SELF_VALIDATE, "root_case", "Case in root");
+		builder.end();
+
+		{
+			xe::TestCaseListParser parser;
+
+			parser.init(xmlPackage);
+			parser.parse((const deUint8*)s_xmlCaseList, (int)deStrnlen(s_xmlCaseList, 4096));
+		}
+
+		xe::parseBinaryCaseList(binaryPackage, &builder.getData()[0], builder.getData().size());
+
+		TCU_CHECK(xmlPackage->getNumChildren() == 3);
+		compareTestNodes(xmlRoot, binaryRoot);
+
+		// Every truncated list must be rejected, the last end code included.
+		for (size_t numBytes = 0; numBytes < builder.getData().size(); numBytes++)
+			TCU_CHECK(parseBinaryCaseListFails(builder.getData(), numBytes));
+
+		// Trailing data
+		{
+			vector<deUint8> data = builder.getData();
+
+			data.push_back((deUint8)BinaryCaseListBuilder::CODE_END);
+			TCU_CHECK(parseBinaryCaseListFails(data, data.size()));
+		}
+
+		// Unsupported version, bad magic and unknown node code
+		{
+			BinaryCaseListBuilder	badVersion	(2);
+			BinaryCaseListBuilder	badCode;
+			vector<deUint8>			badMagic	= builder.getData();
+
+			badVersion.end();
+			badCode.enter((BinaryCaseListBuilder::Code)(BinaryCaseListBuilder::CODE_PERFORMANCE+1), "case", "");
+			badCode.end();
+			badMagic[0] = 'x';
+
+			TCU_CHECK(parseBinaryCaseListFails(badVersion.getData(), badVersion.getData().size()));
+			TCU_CHECK(parseBinaryCaseListFails(badCode.getData(), badCode.getData().size()));
+			TCU_CHECK(parseBinaryCaseListFails(badMagic, badMagic.size()));
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+void createRandomTestTree (de::Random& rnd, xe::TestGroup* group, int depth)
+{
+	const int numChildren = rnd.getInt(0, 6);
+
+	for (int childNdx = 0; childNdx < numChildren; childNdx++)
+	{
+		const string name = "n" + de::toString(childNdx);
+
+		if (depth < 4 && rnd.getFloat() < 0.4f)
+			createRandomTestTree(rnd, group->createGroup(name.c_str(), ""), depth+1);
+		else
+			group->createCase(xe::TESTCASETYPE_SELF_VALIDATE, name.c_str(), "");
+	}
+}
+
+//! Trie written from TestSet, as BatchExecutor did before TestCaseIndex.
+void writeTestSetCaseListNode (std::ostream& str, const xe::TestNode* node, const xe::TestSet& testSet)
+{
+	DE_ASSERT(testSet.hasNode(node));
+
+	if (node->getNodeType() != xe::TESTNODETYPE_ROOT)
+		str << node->getName();
+
+	if (node->getNodeType() != xe::TESTNODETYPE_TEST_CASE)
+	{
+		const xe::TestGroup*	group	= static_cast<const xe::TestGroup*>(node);
+		bool					isFirst	= true;
+
+		str << "{";
+
+		for (int ndx = 0; ndx < group->getNumChildren(); ndx++)
+		{
+			const xe::TestNode* child = group->getChild(ndx);
+
+			if (testSet.hasNode(child))
+			{
+				if (!isFirst)
+					str << ",";
+
+				writeTestSetCaseListNode(str, child, testSet);
+				isFirst = false;
+			}
+		}
+
+		str << "}";
+	}
+}
+
+class TestCaseIndexCase : public tcu::TestCase
+{
+public:
+	TestCaseIndexCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "test_case_index", "Compare TestCaseIndex to TestNode hierarchy")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const float	s_densities[]	= { 0.02f, 0.3f, 0.9f, 1.0f };
+		de::Random			rnd				(0x8c1f52a3);
+
+		for (int treeNdx = 0; treeNdx < 10; treeNdx++)
+		{
+			xe::TestRoot root;
+
+			createRandomTestTree(rnd, &root, 0);
+
+			{
+				const xe::TestCaseIndex		index	(&root);
+				xe::ConstTestNodeIterator	iter	= xe::ConstTestNodeIterator::begin(&root);
+				int							nodeNdx	= 0;
+				int							caseNdx	= 0;
+
+				TCU_CHECK(index.getNode(0) == &root);
+				TCU_CHECK(index.getParent(0) == -1);
+				TCU_CHECK(string(index.getPath(0)) == "");
+
+				// Nodes are in iteration order and paths can be found.
+				for (; iter != xe::ConstTestNodeIterator::end(&root); ++iter, nodeNdx++)
+				{
+					const xe::TestNode* node = *iter;
+
+					TCU_CHECK(nodeNdx < index.getNumNodes());
+					TCU_CHECK(index.getNode(nodeNdx) == node);
+					TCU_CHECK(index.findNode(index.getPath(nodeNdx)) == nodeNdx);
+
+					if (nodeNdx > 0)
+					{
+						TCU_CHECK(index.getPath(nodeNdx) == node->getFullPath());
+						TCU_CHECK(index.getNode(index.getParent(nodeNdx)) == node->getParent());
+						TCU_CHECK(index.findNode((node->getFullPath() + "x").c_str()) == -1);
+					}
+
+					if (index.isCase(nodeNdx))
+					{
+						TCU_CHECK(index.getCaseNode(caseNdx) == nodeNdx);
+						TCU_CHECK(index.findCase(index.getPath(nodeNdx)) == caseNdx);
+						TCU_CHECK(index.getCaseBegin(nodeNdx) == caseNdx && index.getCaseEnd(nodeNdx) == caseNdx+1);
+						caseNdx += 1;
+					}
+					else
+						TCU_CHECK(index.findCase(index.getPath(nodeNdx)) == -1);
+				}
+
+				TCU_CHECK(nodeNdx == index.getNumNodes());
+				TCU_CHECK(caseNdx == index.getNumCases());
+				TCU_CHECK(index.findNode("missing") == -1);
+
+				// Sub-tree ranges cover exactly the descendants of each node.
+				for (int ndx = 0; ndx < index.getNumNodes(); ndx++)
+				{
+					int numCases = 0;
+
+					for (int descNdx = ndx+1; descNdx < index.getSubtreeEnd(ndx); descNdx++)
+					{
+						int ancestorNdx = index.getParent(descNdx);
+
+						while (ancestorNdx > ndx)
+							ancestorNdx = index.getParent(ancestorNdx);
+
+						TCU_CHECK(ancestorNdx == ndx);
+					}
+
+					TCU_CHECK(index.getSubtreeEnd(ndx) == index.getNumNodes() || index.getParent(index.getSubtreeEnd(ndx)) < ndx);
+
+					for (int descNdx = ndx; descNdx < index.getSubtreeEnd(ndx); descNdx++)
+						numCases += index.isCase(descNdx) ? 1 : 0;
+
+					TCU_CHECK(index.getCaseEnd(ndx) - index.getCaseBegin(ndx) == numCases);
+				}
+
+				// Case list trie matches the one written from TestSet.
+				for (int setNdx = 0; setNdx < 10 && index.getNumCases() > 0; setNdx++)
+				{
+					const float				density		= rnd.choose<float>(DE_ARRAY_BEGIN(s_densities), DE_ARRAY_END(s_densities));
+					xe::TestCaseBitSet		cases		(index.getNumCases());
+					xe::TestCaseBitSet		setCases;
+					xe::TestSet				testSet;
+					std::ostringstream		trie;
+					std::ostringstream		refTrie;
+
+					for (int ndx = 0; ndx < index.getNumCases(); ndx++)
+					{
+						if (rnd.getFloat() < density)
+							cases.add(ndx);
+					}
+
+					if (cases.empty())
+						cases.add(rnd.getInt(0, index.getNumCases()-1));
+
+					for (int ndx = 0; ndx < index.getNumCases(); ndx++)
+					{
+						if (cases.contains(ndx))
+							testSet.addCase(static_cast<const xe::TestCase*>(index.getNode(index.getCaseNode(ndx))));
+					}
+
+					xe::writeCaseListTrie(trie, index, cases);
+					writeTestSetCaseListNode(refTrie, &root, testSet);
+
+					if (trie.str() != refTrie.str())
+					{
+						m_testCtx.getLog() << TestLog::Message << "ERROR: got " << trie.str() << ", expected " << refTrie.str() << TestLog::EndMessage;
+						TCU_FAIL("Case list trie doesn't match");
+					}
+
+					xe::getTestSetCases(setCases, index, testSet);
+
+					for (int ndx = 0; ndx < index.getNumCases(); ndx++)
+						TCU_CHECK(setCases.contains(ndx) == cases.contains(ndx));
+				}
+			}
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+class TestCaseBitSetCase : public tcu::TestCase
+{
+public:
+	TestCaseBitSetCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "test_case_bitset", "Compare TestCaseBitSet queries to reference set")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const int	s_sizes[]		= { 0, 1, 31, 32, 33, 63, 64, 65, 97, 128 };
+		static const float	s_densities[]	= { 0.0f, 0.05f, 0.5f, 0.95f, 1.0f };
+		de::Random			rnd				(0x29e4c1d7);
+
+		for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(s_sizes); sizeNdx++)
+		for (int densityNdx = 0; densityNdx < DE_LENGTH_OF_ARRAY(s_densities); densityNdx++)
+		{
+			const int			numCases	= s_sizes[sizeNdx];
+			xe::TestCaseBitSet	set			(numCases);
+			vector<bool>		ref			(numCases, false);
+			int					refCount	= 0;
+
+			for (int ndx = 0; ndx < numCases; ndx++)
+			{
+				if (rnd.getFloat() < s_densities[densityNdx])
+				{
+					set.add(ndx);
+					ref[ndx] = true;
+				}
+			}
+
+			// Remove some cases again, including ones at word edges.
+			for (int ndx = 0; ndx < numCases; ndx++)
+			{
+				if ((ndx % 32 == 0 || ndx % 32 == 31) && rnd.getBool())
+				{
+					set.remove(ndx);
+					ref[ndx] = false;
+				}
+			}
+
+			for (int ndx = 0; ndx < numCases; ndx++)
+			{
+				TCU_CHECK(set.contains(ndx) == ref[ndx]);
+				refCount += ref[ndx] ? 1 : 0;
+			}
+
+			TCU_CHECK(set.getNumCases() == numCases);
+			TCU_CHECK(set.count() == refCount);
+			TCU_CHECK(set.empty() == (refCount == 0));
+
+			for (int begin = 0; begin <= numCases; begin++)
+			{
+				int refNext = numCases;
+
+				for (int ndx = begin; ndx < numCases; ndx++)
+				{
+					if (ref[ndx])
+					{
+						refNext = ndx;
+						break;
+					}
+				}
+
+				TCU_CHECK(set.findNext(begin) == refNext);
+
+				for (int end = begin; end <= numCases; end++)
+					TCU_CHECK(set.containsAny(begin, end) == (refNext < end));
+			}
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+} // anonymous
+
+ExecutorTests::ExecutorTests (tcu::TestContext& testCtx)
+	: TestCaseGroup(testCtx, "executor", "Test Executor Tests")
+{
+}
+
+ExecutorTests::~ExecutorTests (void)
+{
+}
+
+void ExecutorTests::init (void)
+{
+	addChild(new ResultMatcherCase(m_testCtx));
+	addChild(new BinaryCaseListCase(m_testCtx));
+	addChild(new TestCaseIndexCase(m_testCtx));
+	addChild(new TestCaseBitSetCase(m_testCtx));
+}
+
+} // dit
@@ -28,18 +28,39 @@
 
 #include "tcuFloatFormat.hpp"
 #include "tcuEither.hpp"
+#include "tcuPerfStatistics.hpp"
+#include "tcuReferenceImageCache.hpp"
+#include "tcuAsyncVerifier.hpp"
+#include "tcuRasterizationVerifier.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
 
 #include "rrRenderer.hpp"
+#include "sglrReferenceFunctions.hpp"
+#include "gluRenderContext.hpp"
+#include "glwFunctions.hpp"
+#include "glwEnums.hpp"
+#include "tcuRenderTarget.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuTexLookupVerifier.hpp"
+#include "tcuSurface.hpp"
+#include "tcuFormatUtil.hpp"
 
 #include "deRandom.hpp"
 #include "deArrayUtil.hpp"
+#include "deFilePath.hpp"
+#include "deDirectoryIterator.hpp"
+#include "deFile.h"
+#include "deThread.h"
+#include "deString.h"
+#include "deInt32.h"
+#include "deMemory.h"
 
 #include <stdexcept>
+#include <limits>
+#include <cstdio>
 
 namespace dit
 {
@@ -880,6 +901,356 @@ protected:
 	vector<SubCase>::const_iterator	m_caseIter;
 };
 
+class ReferenceImageCacheCase : public tcu::TestCase
+{
+public:
+	ReferenceImageCacheCase (tcu::TestContext& testCtx)
+		: tcu::TestCase	(testCtx, "reference_image_cache", "Reference image cache store, lookup and miss")
+		, m_cacheDir	("reference_image_cache_test")
+	{
+	}
+
+	void deinit (void)
+	{
+		removeEntries();
+		std::remove(m_cacheDir.c_str());
+	}
+
+	IterateResult iterate (void)
+	{
+		const tcu::TextureFormat	format		(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8);
+		const deUint32				paramHash	= 0x1234u;
+		tcu::TextureLevel			reference	(format, 13, 7);
+		tcu::TextureLevel			result		(format, 13, 7);
+		de::Random					rnd			(0x9a31);
+
+		if (!de::FilePath(m_cacheDir).exists())
+			de::createDirectory(m_cacheDir.c_str());
+
+		removeEntries();
+
+		for (int y = 0; y < reference.getHeight(); y++)
+		for (int x = 0; x < reference.getWidth(); x++)
+			reference.getAccess().setPixel(tcu::IVec4(rnd.getInt(0, 255), rnd.getInt(0, 255), rnd.getInt(0, 255), rnd.getInt(0, 255)), x, y);
+
+		// Disabled cache never hits and never stores
+		{
+			const tcu::ReferenceImageCache cache (DE_NULL, false);
+
+			TCU_CHECK(!cache.isEnabled());
+			cache.store(paramHash, reference.getAccess());
+			TCU_CHECK(!cache.lookup(paramHash, result.getAccess()));
+			TCU_CHECK(countEntries() == 0);
+		}
+
+		{
+			tcu::ReferenceImageCache cache (m_cacheDir.c_str(), false);
+
+			cache.setCasePath("group.case");
+
+			TCU_CHECK(!cache.lookup(paramHash, result.getAccess()));
+
+			cache.store(paramHash, reference.getAccess());
+			TCU_CHECK(countEntries() == 1);
+
+			tcu::clear(result.getAccess(), tcu::IVec4(0));
+			TCU_CHECK(cache.lookup(paramHash, result.getAccess()));
+			TCU_CHECK(isEqual(reference.getAccess(), result.getAccess()));
+
+			// Any difference in the key is a miss
+			TCU_CHECK(!cache.lookup(paramHash+1, result.getAccess()));
+
+			{
+				tcu::TextureLevel otherSize (format, 7, 13);
+				TCU_CHECK(!cache.lookup(paramHash, otherSize.getAccess()));
+			}
+
+			{
+				tcu::TextureLevel otherFormat (tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::SNORM_INT8), 13, 7);
+				TCU_CHECK(!cache.lookup(paramHash, otherFormat.getAccess()));
+			}
+
+			cache.setCasePath("group.other_case");
+			TCU_CHECK(!cache.lookup(paramHash, result.getAccess()));
+		}
+
+		// Bypassed cache misses but replaces the stored entry
+		{
+			tcu::ReferenceImageCache	cache		(m_cacheDir.c_str(), true);
+			tcu::TextureLevel			replacement	(format, 13, 7);
+
+			tcu::clear(replacement.getAccess(), tcu::IVec4(1, 2, 3, 4));
+
+			cache.setCasePath("group.case");
+			TCU_CHECK(!cache.lookup(paramHash, result.getAccess()));
+
+			cache.store(paramHash, replacement.getAccess());
+			TCU_CHECK(countEntries() == 1);
+
+			{
+				tcu::ReferenceImageCache normalCache (m_cacheDir.c_str(), false);
+
+				normalCache.setCasePath("group.case");
+				TCU_CHECK(normalCache.lookup(paramHash, result.getAccess()));
+				TCU_CHECK(isEqual(replacement.getAccess(), result.getAccess()));
+			}
+		}
+
+		// Truncated entry is a miss
+		{
+			tcu::ReferenceImageCache cache (m_cacheDir.c_str(), false);
+
+			cache.setCasePath("group.case");
+			truncateEntries(16);
+			TCU_CHECK(!cache.lookup(paramHash, result.getAccess()));
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	static bool isEqual (const tcu::ConstPixelBufferAccess& a, const tcu::ConstPixelBufferAccess& b)
+	{
+		for (int y = 0; y < a.getHeight(); y++)
+		for (int x = 0; x < a.getWidth(); x++)
+		{
+			if (a.getPixelInt(x, y) != b.getPixelInt(x, y))
+				return false;
+		}
+
+		return true;
+	}
+
+	vector<string> getEntries (void) const
+	{
+		vector<string> entries;
+
+		if (de::FilePath(m_cacheDir).exists())
+		{
+			for (de::DirectoryIterator iter (m_cacheDir); iter.hasItem(); iter.next())
+				entries.push_back(iter.getItem().getPath());
+		}
+
+		return entries;
+	}
+
+	int countEntries (void) const
+	{
+		return (int)getEntries().size();
+	}
+
+	void removeEntries (void) const
+	{
+		const vector<string> entries = getEntries();
+
+		for (vector<string>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry)
+			deDeleteFile(entry->c_str());
+	}
+
+	void truncateEntries (int size) const
+	{
+		const vector<string> entries = getEntries();
+
+		for (vector<string>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry)
+		{
+			deFile* const	file		= deFile_create(entry->c_str(), DE_FILEMODE_OPEN|DE_FILEMODE_READ);
+			vector<deUint8>	data		((size_t)size);
+			deInt64			numRead		= 0;
+			deInt64			numWritten	= 0;
+
+			TCU_CHECK(file);
+			TCU_CHECK(deFile_read(file, &data[0], size, &numRead) == DE_FILERESULT_SUCCESS && numRead == size);
+			deFile_destroy(file);
+
+			{
+				deFile* const truncated = deFile_create(entry->c_str(), DE_FILEMODE_OPEN|DE_FILEMODE_WRITE|DE_FILEMODE_TRUNCATE);
+
+				TCU_CHECK(truncated);
+				TCU_CHECK(deFile_write(truncated, &data[0], size, &numWritten) == DE_FILERESULT_SUCCESS && numWritten == size);
+				deFile_destroy(truncated);
+			}
+		}
+	}
+
+	const string	m_cacheDir;
+};
+
+class AsyncVerifierCase : public tcu::TestCase
+{
+public:
+	AsyncVerifierCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "async_verifier", "Asynchronous verification results, ordering and exceptions")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const int numThreads[] = { 0, 1, 3 };
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(numThreads); ndx++)
+		{
+			m_testCtx.getLog() << TestLog::Message << "Testing with " << numThreads[ndx] << " worker threads" << TestLog::EndMessage;
+			testResults(numThreads[ndx]);
+			testException(numThreads[ndx]);
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	enum TaskError
+	{
+		TASKERROR_NONE = 0,
+		TASKERROR_NOT_SUPPORTED,
+		TASKERROR_RESOURCE,
+		TASKERROR_STD,
+
+		TASKERROR_LAST
+	};
+
+	class Task : public tcu::AsyncVerifier::Task
+	{
+	public:
+		Task (int index, bool isOk, TaskError error, vector<int>& logged)
+			: m_index	(index)
+			, m_isOk	(isOk)
+			, m_error	(error)
+			, m_logged	(logged)
+		{
+		}
+
+		bool verify (void)
+		{
+			// Early tasks take longer so that they finish out of order
+			deSleep((deUint32)(m_index < 4 ? 4 - m_index : 0));
+
+			if (m_error == TASKERROR_NOT_SUPPORTED)
+				throw tcu::NotSupportedError("Not supported in worker");
+			else if (m_error == TASKERROR_RESOURCE)
+				throw tcu::ResourceError("Out of resources in worker");
+			else if (m_error == TASKERROR_STD)
+				throw std::runtime_error("Standard exception in worker");
+
+			return m_isOk;
+		}
+
+		void log (TestLog& log) const
+		{
+			log << TestLog::Message << "Task " << m_index << (m_isOk ? " passed" : " failed") << TestLog::EndMessage;
+			m_logged.push_back(m_index);
+		}
+
+	private:
+		const int		m_index;
+		const bool		m_isOk;
+		const TaskError	m_error;
+		vector<int>&	m_logged;
+	};
+
+	static de::MovePtr<tcu::AsyncVerifier::Task> createTask (int index, bool isOk, TaskError error, vector<int>& logged)
+	{
+		return de::MovePtr<tcu::AsyncVerifier::Task>(new Task(index, isOk, error, logged));
+	}
+
+	void testResults (int numThreads)
+	{
+		const int			numTasks	= 12;
+		tcu::AsyncVerifier	verifier	(numThreads);
+		vector<int>			logged;
+		vector<int>			expected;
+
+		// All pass
+		for (int taskNdx = 0; taskNdx < numTasks; taskNdx++)
+		{
+			verifier.submit(createTask(taskNdx, true, TASKERROR_NONE, logged));
+			expected.push_back(taskNdx);
+		}
+
+		TCU_CHECK(verifier.join(m_testCtx.getLog()));
+		TCU_CHECK(verifier.getNumPending() == 0);
+		TCU_CHECK(logged == expected);
+
+		// One failure fails the whole join, but all results are logged
+		logged.clear();
+
+		for (int taskNdx = 0; taskNdx < numTasks; taskNdx++)
+			verifier.submit(createTask(taskNdx, taskNdx != 7, TASKERROR_NONE, logged));
+
+		TCU_CHECK(!verifier.join(m_testCtx.getLog()));
+		TCU_CHECK(logged == expected);
+
+		// Discarded results are not logged
+		logged.clear();
+
+		for (int taskNdx = 0; taskNdx < numTasks; taskNdx++)
+			verifier.submit(createTask(taskNdx, false, TASKERROR_NONE, logged));
+
+		verifier.discard();
+		TCU_CHECK(verifier.getNumPending() == 0);
+		TCU_CHECK(logged.empty());
+		TCU_CHECK(verifier.join(m_testCtx.getLog()));
+	}
+
+	void testException (int numThreads)
+	{
+		static const struct
+		{
+			TaskError		error;
+			qpTestResult	result;
+			bool			isFatal;
+		} cases[] =
+		{
+			{ TASKERROR_NOT_SUPPORTED,	QP_TEST_RESULT_NOT_SUPPORTED,	false	},
+			{ TASKERROR_RESOURCE,		QP_TEST_RESULT_RESOURCE_ERROR,	true	},
+			{ TASKERROR_STD,			QP_TEST_RESULT_FAIL,			false	},
+		};
+
+		tcu::AsyncVerifier verifier (numThreads);
+
+		for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(cases); caseNdx++)
+		{
+			const int	numTasks	= 6;
+			vector<int>	logged;
+			vector<int>	expected;
+			bool		thrown		= false;
+
+			// First exception wins; results of tasks that did not throw are still logged in order
+			for (int taskNdx = 0; taskNdx < numTasks; taskNdx++)
+			{
+				const TaskError error = taskNdx == 2 ? cases[caseNdx].error : taskNdx == 4 ? TASKERROR_STD : TASKERROR_NONE;
+
+				verifier.submit(createTask(taskNdx, true, error, logged));
+
+				if (error == TASKERROR_NONE)
+					expected.push_back(taskNdx);
+			}
+
+			try
+			{
+				verifier.join(m_testCtx.getLog());
+			}
+			catch (const tcu::TestException& e)
+			{
+				m_testCtx.getLog() << TestLog::Message << "Caught expected exception: " << e.what() << TestLog::EndMessage;
+
+				TCU_CHECK(e.getTestResult() == cases[caseNdx].result);
+				TCU_CHECK(e.isFatal() == cases[caseNdx].isFatal);
+				thrown = true;
+			}
+
+			TCU_CHECK_MSG(thrown, "Exception thrown in verify() did not reach the caller of join()");
+			TCU_CHECK(verifier.getNumPending() == 0);
+			TCU_CHECK(logged == expected);
+
+			// Verifier is usable after an exception
+			verifier.submit(createTask(0, true, TASKERROR_NONE, logged));
+			TCU_CHECK(verifier.join(m_testCtx.getLog()));
+		}
+	}
+};
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -894,7 +1265,364 @@ public:
 								   tcu::FloatFormat_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "either","tcu::Either_selfTest()",
 								   tcu::Either_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "perf_statistics","tcu::PerfStatistics_selfTest()",
+								   tcu::PerfStatistics_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "rasterization_verifier","tcu::RasterizationVerifier_selfTest()",
+								   tcu::RasterizationVerifier_selfTest));
+		addChild(new ReferenceImageCacheCase(m_testCtx));
+		addChild(new AsyncVerifierCase(m_testCtx));
+	}
+};
+
+//! Compare tcu::verifyLookupResults() against per-pixel tcu::isLookupResultValid().
+class BatchLookupVerifyCase : public tcu::TestCase
+{
+public:
+	BatchLookupVerifyCase (tcu::TestContext& testCtx, const char* name, const tcu::TextureFormat& format, const tcu::Sampler& sampler)
+		: tcu::TestCase	(testCtx, name, "Batched lookup verification matches per-pixel verification")
+		, m_format		(format)
+		, m_sampler		(sampler)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const int					texSize			= 16;
+		const int					resultSize		= 32;
+		const int					numLevels		= deLog2Floor32(texSize)+1;
+		tcu::Texture2D				texture			(m_format, texSize, texSize);
+		tcu::TextureLevel			result			(tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::FLOAT), resultSize, resultSize);
+		tcu::Surface				errorMask		(resultSize, resultSize);
+		de::Random					rnd				(deStringHash(getName()));
+		tcu::LookupPrecision		prec;
+		vector<tcu::LookupQuery2D>	queries;
+		tcu::Vec4					minVal			(std::numeric_limits<float>::infinity());
+		tcu::Vec4					maxVal			(-std::numeric_limits<float>::infinity());
+		int							numMismatches	= 0;
+		int							numValid		= 0;
+
+		prec.coordBits		= tcu::IVec3(20, 20, 0);
+		prec.uvwBits		= tcu::IVec3(7, 7, 0);
+		prec.colorThreshold	= tcu::Vec4(2.0f / 255.0f);
+		prec.colorMask		= tcu::BVec4(true);
+
+		for (int levelNdx = 0; levelNdx < numLevels; levelNdx++)
+		{
+			texture.allocLevel(levelNdx);
+
+			const tcu::PixelBufferAccess level = texture.getLevel(levelNdx);
+
+			for (int y = 0; y < level.getHeight(); y++)
+			for (int x = 0; x < level.getWidth(); x++)
+			{
+				level.setPixel(tcu::Vec4(rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f)), x, y);
+
+				minVal = tcu::min(minVal, level.getPixel(x, y));
+				maxVal = tcu::max(maxVal, level.getPixel(x, y));
+			}
+		}
+
+		if (m_sampler.wrapS == tcu::Sampler::CLAMP_TO_BORDER || m_sampler.wrapT == tcu::Sampler::CLAMP_TO_BORDER)
+		{
+			minVal = tcu::min(minVal, m_sampler.borderColor.get<float>());
+			maxVal = tcu::max(maxVal, m_sampler.borderColor.get<float>());
+		}
+
+		tcu::clear(errorMask.getAccess(), tcu::RGBA::green().toVec());
+
+		for (int y = 0; y < resultSize; y++)
+		for (int x = 0; x < resultSize; x++)
+		{
+			const tcu::Vec2		coord		(rnd.getFloat(-0.5f, 1.5f), rnd.getFloat(-0.5f, 1.5f));
+			const float			minLod		= rnd.getFloat(-1.0f, (float)numLevels);
+			const tcu::Vec2		lodBounds	(minLod, minLod + rnd.getFloat(0.0f, 1.0f));
+			tcu::Vec4			color		= texture.sample(m_sampler, coord.x(), coord.y(), (lodBounds.x()+lodBounds.y())*0.5f);
+			const int			compNdx		= rnd.getInt(0, 3);
+
+			// Move one component around the edges of the early rejection range:
+			// threshold plus 1/4096 relative margin outside the texel value range.
+			switch (rnd.getInt(0, 4))
+			{
+				case 0:
+					break;
+
+				case 1:
+				case 2:
+				{
+					const bool		above		= rnd.getBool();
+					const float		edge		= above ? maxVal[compNdx] : minVal[compNdx];
+					const float		maxAbs		= de::max(de::abs(minVal[compNdx]), de::abs(maxVal[compNdx]));
+					const float		margin		= (maxAbs + de::abs(edge)) * (1.0f / float(1<<12));
+					const float		offset		= prec.colorThreshold[compNdx] + margin * rnd.getFloat(-2.0f, 3.0f);
+
+					color[compNdx] = above ? edge + offset : edge - offset;
+					break;
+				}
+
+				case 3:
+					color[compNdx] += rnd.getFloat(-2.0f, 2.0f) * prec.colorThreshold[compNdx];
+					break;
+
+				case 4:
+				{
+					static const float specialValues[] =
+					{
+						std::numeric_limits<float>::quiet_NaN(),
+						std::numeric_limits<float>::infinity(),
+						-std::numeric_limits<float>::infinity(),
+						1e30f
+					};
+					color[compNdx] = specialValues[rnd.getInt(0, DE_LENGTH_OF_ARRAY(specialValues)-1)];
+					break;
+				}
+
+				default:
+					DE_ASSERT(false);
+			}
+
+			result.getAccess().setPixel(color, x, y);
+			queries.push_back(tcu::LookupQuery2D(tcu::IVec2(x, y), coord, lodBounds));
+		}
+
+		tcu::verifyLookupResults(texture, m_sampler, prec, result.getAccess(), &queries[0], (int)queries.size(), errorMask.getAccess(), DE_NULL);
+
+		for (size_t queryNdx = 0; queryNdx < queries.size(); queryNdx++)
+		{
+			const tcu::LookupQuery2D&	query		= queries[queryNdx];
+			const tcu::Vec4				color		= result.getAccess().getPixel(query.pixel.x(), query.pixel.y());
+			const bool					isValid		= tcu::isLookupResultValid(texture, m_sampler, prec, query.coord, query.lodBounds, color);
+			const bool					batchValid	= errorMask.getPixel(query.pixel.x(), query.pixel.y()) == tcu::RGBA::green();
+
+			if (isValid != batchValid)
+			{
+				if (numMismatches < 10)
+					m_testCtx.getLog() << TestLog::Message << "ERROR: Pixel " << query.pixel << " with result " << color << ": per-pixel verification "
+															<< (isValid ? "accepts" : "rejects") << " but batched verification " << (batchValid ? "accepts" : "rejects")
+									   << TestLog::EndMessage;
+				numMismatches += 1;
+			}
+
+			numValid += isValid ? 1 : 0;
+		}
+
+		m_testCtx.getLog() << TestLog::Message << numValid << " of " << queries.size() << " results valid, " << numMismatches << " mismatches" << TestLog::EndMessage;
+
+		if (numMismatches > 0)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Batched verification differs from per-pixel verification");
+		else if (numValid == 0 || numValid == (int)queries.size())
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Test didn't produce both valid and invalid results");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+
+		return STOP;
+	}
+
+private:
+	const tcu::TextureFormat	m_format;
+	const tcu::Sampler			m_sampler;
+};
+
+class TextureLookupVerifierTests : public tcu::TestCaseGroup
+{
+public:
+	TextureLookupVerifierTests (tcu::TestContext& testCtx)
+		: tcu::TestCaseGroup(testCtx, "texture_lookup_verifier", "Texture lookup verifier tests")
+	{
+	}
+
+	void init (void)
+	{
+		static const struct
+		{
+			const char*						name;
+			tcu::TextureFormat				format;
+			tcu::Sampler::WrapMode			wrapMode;
+			tcu::Sampler::FilterMode		minFilter;
+			tcu::Sampler::FilterMode		magFilter;
+		} cases[] =
+		{
+			{ "rgba8_nearest",				tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::UNORM_INT8),	tcu::Sampler::REPEAT_GL,		tcu::Sampler::NEAREST,					tcu::Sampler::NEAREST	},
+			{ "rgba8_linear",				tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::UNORM_INT8),	tcu::Sampler::CLAMP_TO_EDGE,	tcu::Sampler::LINEAR,					tcu::Sampler::LINEAR	},
+			{ "rgba8_nearest_mipmap_linear",	tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::UNORM_INT8),	tcu::Sampler::MIRRORED_REPEAT_GL,	tcu::Sampler::NEAREST_MIPMAP_LINEAR,	tcu::Sampler::NEAREST	},
+			{ "rgba8_linear_mipmap_nearest",	tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::UNORM_INT8),	tcu::Sampler::REPEAT_GL,		tcu::Sampler::LINEAR_MIPMAP_NEAREST,	tcu::Sampler::LINEAR	},
+			{ "rgba8_border",				tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::UNORM_INT8),	tcu::Sampler::CLAMP_TO_BORDER,	tcu::Sampler::LINEAR_MIPMAP_LINEAR,		tcu::Sampler::LINEAR	},
+			{ "rgba8_snorm_linear",			tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::SNORM_INT8),	tcu::Sampler::REPEAT_GL,		tcu::Sampler::LINEAR_MIPMAP_LINEAR,		tcu::Sampler::LINEAR	},
+			{ "rgb565_linear",				tcu::TextureFormat(tcu::TextureFormat::RGB,		tcu::TextureFormat::UNORM_SHORT_565),	tcu::Sampler::CLAMP_TO_EDGE,	tcu::Sampler::LINEAR_MIPMAP_LINEAR,		tcu::Sampler::LINEAR	},
+			{ "rgba16f_linear",				tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::HALF_FLOAT),	tcu::Sampler::REPEAT_GL,		tcu::Sampler::LINEAR_MIPMAP_LINEAR,		tcu::Sampler::LINEAR	},
+			{ "rgba32f_nearest",			tcu::TextureFormat(tcu::TextureFormat::RGBA,	tcu::TextureFormat::FLOAT),			tcu::Sampler::CLAMP_TO_BORDER,	tcu::Sampler::NEAREST_MIPMAP_NEAREST,	tcu::Sampler::NEAREST	},
+		};
+
+		for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(cases); caseNdx++)
+		{
+			const tcu::Sampler sampler (cases[caseNdx].wrapMode, cases[caseNdx].wrapMode, cases[caseNdx].wrapMode,
+										cases[caseNdx].minFilter, cases[caseNdx].magFilter, 0.0f, true,
+										tcu::Sampler::COMPAREMODE_NONE, 0, tcu::Vec4(0.25f, -0.5f, 0.75f, 1.0f));
+
+			addChild(new BatchLookupVerifyCase(m_testCtx, cases[caseNdx].name, cases[caseNdx].format, sampler));
+		}
+	}
+};
+
+static glw::GLenum GLW_APIENTRY baseGetError (void)
+{
+	return GL_NO_ERROR;
+}
+
+static void GLW_APIENTRY baseGetIntegerv (glw::GLenum pname, glw::GLint* data)
+{
+	DE_UNREF(pname);
+	*data = 64;
+}
+
+//! Base context for reference functions; reports 64 for all integer state.
+class BaseRenderContext : public glu::RenderContext
+{
+public:
+	BaseRenderContext (void)
+		: m_renderTarget(32, 32, tcu::PixelFormat(8,8,8,8), 24, 8, 0)
+	{
+		m_functions.getError	= baseGetError;
+		m_functions.getIntegerv	= baseGetIntegerv;
+	}
+
+	glu::ContextType			getType			(void) const	{ return glu::ContextType(glu::ApiType::es(3,0));	}
+	const glw::Functions&		getFunctions	(void) const	{ return m_functions;								}
+	const tcu::RenderTarget&	getRenderTarget	(void) const	{ return m_renderTarget;							}
+	void						postIterate		(void)			{}
+
+private:
+	glw::Functions				m_functions;
+	tcu::RenderTarget			m_renderTarget;
+};
+
+class ReferenceFunctionsStateCase : public tcu::TestCase
+{
+public:
+	ReferenceFunctionsStateCase (tcu::TestContext& testCtx)
+		: tcu::TestCase	(testCtx, "reference_functions_state", "State set through reference GL functions is returned by queries")
+		, m_numFailed	(0)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const BaseRenderContext			baseContext;
+		const sglr::ReferenceFunctions	reference	(baseContext);
+		const glw::Functions&			gl			= reference.getFunctions();
+		const deUint8					data[16]	= { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+		const float						border[4]	= { 0.25f, 0.5f, 0.75f, 1.0f };
+		const glw::GLint				wrapMode	= GL_CLAMP_TO_EDGE;
+		glw::GLuint						textures[2];
+		glw::GLuint						buffer;
+
+		m_numFailed = 0;
+
+		// Texture state
+		gl.genTextures(2, textures);
+		gl.activeTexture(GL_TEXTURE1);
+		gl.bindTexture(GL_TEXTURE_2D, textures[0]);
+		gl.texParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 3.0f);
+		gl.texParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &wrapMode);
+		gl.texParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, border);
+
+		checkInteger(gl, GL_ACTIVE_TEXTURE,			GL_TEXTURE1);
+		checkInteger(gl, GL_TEXTURE_BINDING_2D,		(int)textures[0]);
+		check(gl.isTexture(textures[0]) == GL_TRUE,	"glIsTexture() returned GL_FALSE for bound texture");
+		check(gl.isTexture(textures[1]) == GL_FALSE,	"glIsTexture() returned GL_TRUE for texture that has never been bound");
+
+		// Buffer state and mapping
+		gl.genBuffers(1, &buffer);
+		gl.bindBuffer(GL_ARRAY_BUFFER, buffer);
+		gl.bufferData(GL_ARRAY_BUFFER, (glw::GLsizeiptr)sizeof(data), DE_NULL, GL_STATIC_DRAW);
+
+		checkInteger(gl, GL_ARRAY_BUFFER_BINDING, (int)buffer);
+
+		{
+			deUint8* const ptr = (deUint8*)gl.mapBufferRange(GL_ARRAY_BUFFER, 0, (glw::GLsizeiptr)sizeof(data), GL_MAP_WRITE_BIT|GL_MAP_FLUSH_EXPLICIT_BIT);
+
+			check(ptr != DE_NULL, "glMapBufferRange() for writing failed");
+			if (ptr)
+				deMemcpy(ptr, data, sizeof(data));
+
+			gl.flushMappedBufferRange(GL_ARRAY_BUFFER, 0, (glw::GLsizeiptr)sizeof(data));
+			check(gl.unmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE, "glUnmapBuffer() failed");
+		}
+
+		{
+			const deUint8* const ptr = (const deUint8*)gl.mapBufferRange(GL_ARRAY_BUFFER, 4, 8, GL_MAP_READ_BIT);
+
+			check(ptr != DE_NULL && deMemCmp(ptr, &data[4], 8) == 0, "Data read through glMapBufferRange() doesn't match written data");
+			check(gl.unmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE, "glUnmapBuffer() failed");
+		}
+
+		checkError(gl, GL_NO_ERROR);
+
+		check(gl.unmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE, "glUnmapBuffer() succeeded for buffer that is not mapped");
+		checkError(gl, GL_INVALID_OPERATION);
+
+		// Other state
+		gl.viewport(1, 2, 3, 4);
+		gl.pixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		{
+			glw::GLint viewport[4] = { 0, 0, 0, 0 };
+
+			gl.getIntegerv(GL_VIEWPORT, viewport);
+			check(viewport[0] == 1 && viewport[1] == 2 && viewport[2] == 3 && viewport[3] == 4, "GL_VIEWPORT doesn't match viewport set with glViewport()");
+		}
+
+		checkInteger(gl, GL_UNPACK_ALIGNMENT,	1);
+
+		// State not tracked by reference context comes from base context.
+		checkInteger(gl, GL_MAX_SAMPLES,		64);
+		checkError(gl, GL_NO_ERROR);
+
+		gl.deleteBuffers(1, &buffer);
+		gl.deleteTextures(2, textures);
+
+		if (m_numFailed == 0)
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Queried state doesn't match");
+
+		return STOP;
+	}
+
+private:
+	void check (bool condition, const char* message)
+	{
+		if (!condition)
+		{
+			m_testCtx.getLog() << TestLog::Message << "ERROR: " << message << TestLog::EndMessage;
+			m_numFailed += 1;
+		}
+	}
+
+	void checkInteger (const glw::Functions& gl, glw::GLenum pname, int expected)
+	{
+		glw::GLint value = -1;
+
+		gl.getIntegerv(pname, &value);
+
+		if (value != expected)
+		{
+			m_testCtx.getLog() << TestLog::Message << "ERROR: Got " << value << " for " << tcu::toHex(pname) << ", expected " << expected << TestLog::EndMessage;
+			m_numFailed += 1;
+		}
 	}
+
+	void checkError (const glw::Functions& gl, glw::GLenum expected)
+	{
+		const glw::GLenum err = gl.getError();
+
+		if (err != expected)
+		{
+			m_testCtx.getLog() << TestLog::Message << "ERROR: Got error " << tcu::toHex(err) << ", expected " << tcu::toHex(expected) << TestLog::EndMessage;
+			m_numFailed += 1;
+		}
+	}
+
+	int m_numFailed;
 };
 
 class ReferenceRendererTests : public tcu::TestCaseGroup
@@ -908,6 +1636,7 @@ public:
 	void init (void)
 	{
 		addChild(new ConstantInterpolationTest(m_testCtx));
+		addChild(new ReferenceFunctionsStateCase(m_testCtx));
 	}
 };
 
@@ -927,7 +1656,9 @@ void FrameworkTests::init (void)
 	addChild(new CommonFrameworkTests	(m_testCtx));
 	addChild(new CaseListParserTests	(m_testCtx));
 	addChild(new ReferenceRendererTests	(m_testCtx));
+	addChild(new TextureLookupVerifierTests	(m_testCtx));
 	addChild(createTextureFormatTests	(m_testCtx));
+	addChild(createTextureCopyTests		(m_testCtx));
 	addChild(createAstcTests			(m_testCtx));
 	addChild(createVulkanTests			(m_testCtx));
 }
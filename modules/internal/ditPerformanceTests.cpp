@@ -0,0 +1,1336 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Test Module
+ * ---------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Framework CPU cost benchmarks.
+ *
+ * Every case runs a fixed, deterministically generated workload through
+ * a framework hot path and reports the median time per operation. Workload
+ * sizes, seeds and sample counts are constants so that results from
+ * different runs and builds can be compared against each other.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditPerformanceTests.hpp"
+
+#include "tcuTestLog.hpp"
+#include "tcuTexture.hpp"
+#include "tcuTextureUtil.hpp"
+#include "tcuImageCompare.hpp"
+#include "tcuCompressedTexture.hpp"
+#include "tcuAstcUtil.hpp"
+#include "tcuInterval.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuCPUWarmup.hpp"
+#include "tcuVectorUtil.hpp"
+
+#include "rrRenderer.hpp"
+
+#include "qpTestLog.h"
+#include "qpXmlWriter.h"
+
+#include "deRandom.hpp"
+#include "deStringUtil.hpp"
+#include "deUniquePtr.hpp"
+#include "deMemPool.hpp"
+#include "dePoolArray.hpp"
+#include "deClock.h"
+#include "deMemory.h"
+#include "deInt32.h"
+
+#include <algorithm>
+#include <vector>
+#include <cstdio>
+
+namespace dit
+{
+
+using std::string;
+using std::vector;
+using tcu::TestLog;
+using tcu::TextureFormat;
+using tcu::TextureLevel;
+using tcu::ConstPixelBufferAccess;
+using tcu::PixelBufferAccess;
+using tcu::Vec4;
+using tcu::IVec3;
+using tcu::IVec4;
+using tcu::UVec4;
+
+namespace
+{
+
+enum
+{
+	NUM_SAMPLES					= 15,		//!< Number of measured samples per case.
+	MIN_SAMPLE_DURATION_US		= 5000,		//!< Workload repeat count is calibrated so that one sample takes at least this long.
+	MAX_WORKLOADS_PER_SAMPLE	= 1<<16
+};
+
+#if (DE_OS == DE_OS_WIN32)
+static const char* const	s_nullDevicePath	= "NUL";
+#else
+static const char* const	s_nullDevicePath	= "/dev/null";
+#endif
+
+// \note Results of measured workloads are accumulated here so that the compiler can't drop them.
+static volatile float		s_resultSink		= 0.0f;
+
+inline void consume (float value)
+{
+	s_resultSink = s_resultSink + value;
+}
+
+inline void consume (const Vec4& value)
+{
+	consume(value.x() + value.y() + value.z() + value.w());
+}
+
+inline void consume (const IVec4& value)
+{
+	consume((float)(value.x() ^ value.y() ^ value.z() ^ value.w()));
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Base class for framework CPU cost benchmarks
+ *
+ * Subclasses prepare their data in init() and implement runWorkload(),
+ * which performs a fixed amount of work and returns the number of
+ * operations performed. The number of workload runs per sample is
+ * calibrated once, after which NUM_SAMPLES samples are measured and
+ * the median time per operation is reported.
+ *//*--------------------------------------------------------------------*/
+class MicroBenchmarkCase : public tcu::TestCase
+{
+public:
+							MicroBenchmarkCase	(tcu::TestContext& testCtx, const char* name, const char* description, const char* opName);
+
+	IterateResult			iterate				(void);
+
+protected:
+	virtual deUint64		runWorkload			(void) = 0;
+
+	//! Called after measurement, may log additional information about the last workload run.
+	virtual void			logWorkloadInfo		(void) {}
+
+private:
+	int						calibrate			(void);
+
+	const string			m_opName;
+};
+
+MicroBenchmarkCase::MicroBenchmarkCase (tcu::TestContext& testCtx, const char* name, const char* description, const char* opName)
+	: tcu::TestCase	(testCtx, tcu::NODETYPE_PERFORMANCE, name, description)
+	, m_opName		(opName)
+{
+}
+
+int MicroBenchmarkCase::calibrate (void)
+{
+	int numWorkloads = 1;
+
+	for (;;)
+	{
+		const deUint64	startTime	= deGetMicroseconds();
+
+		for (int ndx = 0; ndx < numWorkloads; ndx++)
+			runWorkload();
+
+		if (deGetMicroseconds() - startTime >= (deUint64)MIN_SAMPLE_DURATION_US || numWorkloads >= MAX_WORKLOADS_PER_SAMPLE)
+			return numWorkloads;
+
+		numWorkloads *= 2;
+	}
+}
+
+MicroBenchmarkCase::IterateResult MicroBenchmarkCase::iterate (void)
+{
+	TestLog&		log				= m_testCtx.getLog();
+	vector<double>	nsPerOp			(NUM_SAMPLES);
+	int				numWorkloads;
+
+	tcu::warmupCPU();
+
+	numWorkloads = calibrate();
+
+	for (int sampleNdx = 0; sampleNdx < NUM_SAMPLES; sampleNdx++)
+	{
+		deUint64		numOps		= 0;
+		const deUint64	startTime	= deGetMicroseconds();
+
+		for (int ndx = 0; ndx < numWorkloads; ndx++)
+			numOps += runWorkload();
+
+		{
+			const deUint64	duration	= deGetMicroseconds() - startTime;
+
+			DE_ASSERT(numOps > 0);
+			nsPerOp[sampleNdx] = (double)duration * 1000.0 / (double)numOps;
+		}
+	}
+
+	std::sort(nsPerOp.begin(), nsPerOp.end());
+
+	{
+		const double	minTime		= nsPerOp.front();
+		const double	medianTime	= nsPerOp[NUM_SAMPLES/2];
+		const double	maxTime		= nsPerOp.back();
+		const double	opsPerSec	= medianTime > 0.0 ? 1.0e9 / medianTime : 0.0;
+
+		log << TestLog::Message << "Measured " << (int)NUM_SAMPLES << " samples, each consisting of " << numWorkloads << " workload runs" << TestLog::EndMessage
+			<< TestLog::Integer("WorkloadsPerSample",	"Workload runs per sample",							"",				QP_KEY_TAG_NONE,		numWorkloads)
+			<< TestLog::Float("MinTimePerOp",			("Minimum time per " + m_opName).c_str(),			"ns",			QP_KEY_TAG_TIME,		(float)minTime)
+			<< TestLog::Float("MaxTimePerOp",			("Maximum time per " + m_opName).c_str(),			"ns",			QP_KEY_TAG_TIME,		(float)maxTime)
+			<< TestLog::Float("MedianTimePerOp",		("Median time per " + m_opName).c_str(),			"ns",			QP_KEY_TAG_PERFORMANCE,	(float)medianTime)
+			<< TestLog::Float("Throughput",				("Median throughput, " + m_opName + "s per second").c_str(),	"Mops/s",	QP_KEY_TAG_PERFORMANCE,	(float)(opsPerSec / 1.0e6));
+
+		logWorkloadInfo();
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)medianTime, 2).c_str());
+	}
+
+	return STOP;
+}
+
+inline bool isIntegerFormat (const TextureFormat& format)
+{
+	const tcu::TextureChannelClass chClass = tcu::getTextureChannelClass(format.type);
+
+	return chClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER ||
+		   chClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
+}
+
+void fillWithGradients (const PixelBufferAccess& access)
+{
+	const tcu::TextureFormatInfo fmtInfo = tcu::getTextureFormatInfo(access.getFormat());
+
+	tcu::fillWithComponentGradients(access, fmtInfo.valueMin, fmtInfo.valueMax);
+}
+
+// Pixel access
+
+struct FormatCase
+{
+	const char*		name;
+	TextureFormat	format;
+};
+
+static const FormatCase s_pixelAccessFormats[] =
+{
+	{ "rgba8",				TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8)						},
+	{ "rgb8",				TextureFormat(TextureFormat::RGB,	TextureFormat::UNORM_INT8)						},
+	{ "srgb8_alpha8",		TextureFormat(TextureFormat::sRGBA,	TextureFormat::UNORM_INT8)						},
+	{ "rgb565",				TextureFormat(TextureFormat::RGB,	TextureFormat::UNORM_SHORT_565)					},
+	{ "rgb10_a2",			TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT_1010102_REV)			},
+	{ "r11f_g11f_b10f",		TextureFormat(TextureFormat::RGB,	TextureFormat::UNSIGNED_INT_11F_11F_10F_REV)	},
+	{ "rgba16f",			TextureFormat(TextureFormat::RGBA,	TextureFormat::HALF_FLOAT)						},
+	{ "rgba32f",			TextureFormat(TextureFormat::RGBA,	TextureFormat::FLOAT)							},
+	{ "rgba8ui",			TextureFormat(TextureFormat::RGBA,	TextureFormat::UNSIGNED_INT8)					},
+	{ "r32i",				TextureFormat(TextureFormat::R,		TextureFormat::SIGNED_INT32)					},
+};
+
+class PixelAccessCase : public MicroBenchmarkCase
+{
+public:
+	enum Function
+	{
+		FUNCTION_GET_PIXEL = 0,
+		FUNCTION_SET_PIXEL,
+
+		FUNCTION_LAST
+	};
+
+						PixelAccessCase		(tcu::TestContext& testCtx, const char* name, Function function, const TextureFormat& format);
+
+	void				init				(void);
+	void				deinit				(void);
+
+protected:
+	deUint64			runWorkload			(void);
+
+private:
+	enum { SIZE = 128 };
+
+	const Function		m_function;
+	const TextureFormat	m_format;
+	TextureLevel		m_texture;
+	vector<Vec4>		m_floatValues;
+	vector<IVec4>		m_intValues;
+};
+
+PixelAccessCase::PixelAccessCase (tcu::TestContext& testCtx, const char* name, Function function, const TextureFormat& format)
+	: MicroBenchmarkCase	(testCtx, name, "", "pixel")
+	, m_function			(function)
+	, m_format				(format)
+{
+}
+
+void PixelAccessCase::init (void)
+{
+	m_texture.setStorage(m_format, SIZE, SIZE);
+	fillWithGradients(m_texture.getAccess());
+
+	if (m_function == FUNCTION_SET_PIXEL)
+	{
+		const ConstPixelBufferAccess	access	= m_texture.getAccess();
+
+		for (int y = 0; y < SIZE; y++)
+		for (int x = 0; x < SIZE; x++)
+		{
+			if (isIntegerFormat(m_format))
+				m_intValues.push_back(access.getPixelInt(x, y));
+			else
+				m_floatValues.push_back(access.getPixel(x, y));
+		}
+	}
+}
+
+void PixelAccessCase::deinit (void)
+{
+	m_texture = TextureLevel();
+	m_floatValues.clear();
+	m_intValues.clear();
+}
+
+deUint64 PixelAccessCase::runWorkload (void)
+{
+	const PixelBufferAccess	access		= m_texture.getAccess();
+	const bool				isInteger	= isIntegerFormat(m_format);
+
+	if (m_function == FUNCTION_GET_PIXEL)
+	{
+		if (isInteger)
+		{
+			IVec4 sum (0);
+
+			for (int y = 0; y < SIZE; y++)
+			for (int x = 0; x < SIZE; x++)
+				sum += access.getPixelInt(x, y);
+
+			consume(sum);
+		}
+		else
+		{
+			Vec4 sum (0.0f);
+
+			for (int y = 0; y < SIZE; y++)
+			for (int x = 0; x < SIZE; x++)
+				sum += access.getPixel(x, y);
+
+			consume(sum);
+		}
+	}
+	else
+	{
+		// \note Values are written in reverse order to avoid writing back the value just read.
+		for (int y = 0; y < SIZE; y++)
+		for (int x = 0; x < SIZE; x++)
+		{
+			const int srcNdx = (SIZE-1-y)*SIZE + (SIZE-1-x);
+
+			if (isInteger)
+				access.setPixel(m_intValues[srcNdx], x, y);
+			else
+				access.setPixel(m_floatValues[srcNdx], x, y);
+		}
+	}
+
+	return (deUint64)(SIZE*SIZE);
+}
+
+// tcu::copy()
+
+class CopyCase : public MicroBenchmarkCase
+{
+public:
+						CopyCase			(tcu::TestContext& testCtx, const char* name, const TextureFormat& srcFormat, const TextureFormat& dstFormat);
+
+	void				init				(void);
+	void				deinit				(void);
+
+protected:
+	deUint64			runWorkload			(void);
+
+private:
+	enum { SIZE = 256 };
+
+	const TextureFormat	m_srcFormat;
+	const TextureFormat	m_dstFormat;
+	TextureLevel		m_src;
+	TextureLevel		m_dst;
+};
+
+CopyCase::CopyCase (tcu::TestContext& testCtx, const char* name, const TextureFormat& srcFormat, const TextureFormat& dstFormat)
+	: MicroBenchmarkCase	(testCtx, name, "", "pixel")
+	, m_srcFormat			(srcFormat)
+	, m_dstFormat			(dstFormat)
+{
+}
+
+void CopyCase::init (void)
+{
+	m_src.setStorage(m_srcFormat, SIZE, SIZE);
+	m_dst.setStorage(m_dstFormat, SIZE, SIZE);
+	fillWithGradients(m_src.getAccess());
+}
+
+void CopyCase::deinit (void)
+{
+	m_src = TextureLevel();
+	m_dst = TextureLevel();
+}
+
+deUint64 CopyCase::runWorkload (void)
+{
+	tcu::copy(m_dst.getAccess(), m_src.getAccess());
+	return (deUint64)(SIZE*SIZE);
+}
+
+// tcu::sampleLevelArray2D()
+
+class SampleCase : public MicroBenchmarkCase
+{
+public:
+									SampleCase			(tcu::TestContext& testCtx, const char* name, tcu::Sampler::FilterMode minFilter, tcu::Sampler::FilterMode magFilter);
+
+	void							init				(void);
+	void							deinit				(void);
+
+protected:
+	deUint64						runWorkload			(void);
+
+private:
+	enum
+	{
+		TEXTURE_SIZE	= 256,
+		NUM_LOOKUPS		= 4096
+	};
+
+	const tcu::Sampler				m_sampler;
+	de::MovePtr<tcu::Texture2D>		m_texture;
+	vector<ConstPixelBufferAccess>	m_levels;
+	vector<Vec4>					m_lookups;		//!< (s, t, lod, unused)
+};
+
+SampleCase::SampleCase (tcu::TestContext& testCtx, const char* name, tcu::Sampler::FilterMode minFilter, tcu::Sampler::FilterMode magFilter)
+	: MicroBenchmarkCase	(testCtx, name, "", "lookup")
+	, m_sampler				(tcu::Sampler::REPEAT_GL, tcu::Sampler::REPEAT_GL, tcu::Sampler::REPEAT_GL, minFilter, magFilter)
+{
+}
+
+void SampleCase::init (void)
+{
+	const int	numLevels	= deLog2Floor32(TEXTURE_SIZE)+1;
+	de::Random	rnd			(0x4c3a91);
+
+	m_texture = de::MovePtr<tcu::Texture2D>(new tcu::Texture2D(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), TEXTURE_SIZE, TEXTURE_SIZE));
+
+	for (int levelNdx = 0; levelNdx < numLevels; levelNdx++)
+	{
+		m_texture->allocLevel(levelNdx);
+		fillWithGradients(m_texture->getLevel(levelNdx));
+		m_levels.push_back(m_texture->getLevel(levelNdx));
+	}
+
+	for (int lookupNdx = 0; lookupNdx < NUM_LOOKUPS; lookupNdx++)
+		m_lookups.push_back(Vec4(rnd.getFloat(-2.0f, 2.0f), rnd.getFloat(-2.0f, 2.0f), rnd.getFloat(-1.0f, (float)numLevels), 0.0f));
+}
+
+void SampleCase::deinit (void)
+{
+	m_levels.clear();
+	m_lookups.clear();
+	m_texture.clear();
+}
+
+deUint64 SampleCase::runWorkload (void)
+{
+	Vec4 sum (0.0f);
+
+	for (int lookupNdx = 0; lookupNdx < NUM_LOOKUPS; lookupNdx++)
+	{
+		const Vec4& lookup = m_lookups[lookupNdx];
+		sum += tcu::sampleLevelArray2D(&m_levels[0], (int)m_levels.size(), m_sampler, lookup.x(), lookup.y(), 0, lookup.z());
+	}
+
+	consume(sum);
+	return (deUint64)NUM_LOOKUPS;
+}
+
+// Image comparison
+
+class ImageCompareCase : public MicroBenchmarkCase
+{
+public:
+	enum CompareType
+	{
+		COMPARETYPE_FUZZY = 0,
+		COMPARETYPE_INT_THRESHOLD,
+
+		COMPARETYPE_LAST
+	};
+
+						ImageCompareCase	(tcu::TestContext& testCtx, const char* name, CompareType compareType);
+
+	void				init				(void);
+	void				deinit				(void);
+
+protected:
+	deUint64			runWorkload			(void);
+
+private:
+	enum { SIZE = 256 };
+
+	const CompareType	m_compareType;
+	TextureLevel		m_reference;
+	TextureLevel		m_result;
+};
+
+ImageCompareCase::ImageCompareCase (tcu::TestContext& testCtx, const char* name, CompareType compareType)
+	: MicroBenchmarkCase	(testCtx, name, "", "pixel")
+	, m_compareType			(compareType)
+{
+}
+
+void ImageCompareCase::init (void)
+{
+	const TextureFormat	format	(TextureFormat::RGBA, TextureFormat::UNORM_INT8);
+	de::Random			rnd		(0x7a12b3);
+
+	m_reference.setStorage(format, SIZE, SIZE);
+	m_result.setStorage(format, SIZE, SIZE);
+
+	tcu::fillWithMetaballs(m_reference.getAccess(), 8, 0x12345);
+
+	// Result differs from reference by small per-channel noise that both comparisons accept.
+	for (int y = 0; y < SIZE; y++)
+	for (int x = 0; x < SIZE; x++)
+	{
+		const IVec4	refValue	= m_reference.getAccess().getPixelInt(x, y);
+		const IVec4	noise		(rnd.getInt(-1, 1), rnd.getInt(-1, 1), rnd.getInt(-1, 1), 0);
+
+		m_result.getAccess().setPixel(tcu::clamp(refValue + noise, IVec4(0), IVec4(255)), x, y);
+	}
+}
+
+void ImageCompareCase::deinit (void)
+{
+	m_reference	= TextureLevel();
+	m_result	= TextureLevel();
+}
+
+deUint64 ImageCompareCase::runWorkload (void)
+{
+	TestLog&	log		= m_testCtx.getLog();
+	bool		isOk	= false;
+
+	if (m_compareType == COMPARETYPE_FUZZY)
+		isOk = tcu::fuzzyCompare(log, "Compare", "", m_reference.getAccess(), m_result.getAccess(), 0.05f, tcu::COMPARE_LOG_ON_ERROR);
+	else
+		isOk = tcu::intThresholdCompare(log, "Compare", "", m_reference.getAccess(), m_result.getAccess(), UVec4(1), tcu::COMPARE_LOG_ON_ERROR);
+
+	if (!isOk)
+		throw tcu::TestError("Image comparison failed unexpectedly");
+
+	return (deUint64)(SIZE*SIZE);
+}
+
+// rr::Renderer
+
+class RendererCase : public MicroBenchmarkCase
+{
+public:
+						RendererCase		(tcu::TestContext& testCtx, const char* name, float triangleSize);
+
+	void				init				(void);
+	void				deinit				(void);
+
+protected:
+	deUint64			runWorkload			(void);
+
+private:
+	enum
+	{
+		VIEWPORT_SIZE	= 256,
+		NUM_TRIANGLES	= 256
+	};
+
+	const float			m_triangleSize;		//!< Triangle edge length in normalized device coordinates.
+	TextureLevel		m_colorBuffer;
+	vector<Vec4>		m_positions;
+	vector<Vec4>		m_colors;
+};
+
+RendererCase::RendererCase (tcu::TestContext& testCtx, const char* name, float triangleSize)
+	: MicroBenchmarkCase	(testCtx, name, "", "triangle")
+	, m_triangleSize		(triangleSize)
+{
+}
+
+void RendererCase::init (void)
+{
+	de::Random rnd (0x9f0e23);
+
+	m_colorBuffer.setStorage(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), 1, VIEWPORT_SIZE, VIEWPORT_SIZE);
+
+	for (int triNdx = 0; triNdx < NUM_TRIANGLES; triNdx++)
+	{
+		const float x = rnd.getFloat(-1.0f, 1.0f - m_triangleSize);
+		const float y = rnd.getFloat(-1.0f, 1.0f - m_triangleSize);
+
+		m_positions.push_back(Vec4(x,					y,					0.0f, 1.0f));
+		m_positions.push_back(Vec4(x + m_triangleSize,	y,					0.0f, 1.0f));
+		m_positions.push_back(Vec4(x,					y + m_triangleSize,	0.0f, 1.0f));
+
+		for (int vtxNdx = 0; vtxNdx < 3; vtxNdx++)
+			m_colors.push_back(Vec4(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), 1.0f));
+	}
+}
+
+void RendererCase::deinit (void)
+{
+	m_colorBuffer = TextureLevel();
+	m_positions.clear();
+	m_colors.clear();
+}
+
+class ColorVertexShader : public rr::VertexShader
+{
+public:
+	ColorVertexShader (void)
+		: rr::VertexShader(2, 1)
+	{
+		m_inputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+		m_inputs[1].type	= rr::GENERICVECTYPE_FLOAT;
+		m_outputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+	}
+
+	void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
+	{
+		for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+		{
+			rr::readVertexAttrib(packets[packetNdx]->position, inputs[0], packets[packetNdx]->instanceNdx, packets[packetNdx]->vertexNdx);
+			packets[packetNdx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[packetNdx]->instanceNdx, packets[packetNdx]->vertexNdx);
+		}
+	}
+};
+
+class ColorFragmentShader : public rr::FragmentShader
+{
+public:
+	ColorFragmentShader (void)
+		: rr::FragmentShader(1, 1)
+	{
+		m_inputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+		m_outputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+	}
+
+	void shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
+	{
+		for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+		{
+			for (int fragNdx = 0; fragNdx < rr::NUM_FRAGMENTS_PER_PACKET; fragNdx++)
+				rr::writeFragmentOutput(context, packetNdx, fragNdx, 0, rr::readTriangleVarying<float>(packets[packetNdx], context, 0, fragNdx));
+		}
+	}
+};
+
+deUint64 RendererCase::runWorkload (void)
+{
+	const ColorVertexShader					vtxShader;
+	const ColorFragmentShader				fragShader;
+	const rr::Program						program			(&vtxShader, &fragShader);
+	const rr::MultisamplePixelBufferAccess	colorAccess		= rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer.getAccess());
+	const rr::RenderTarget					renderTarget	(colorAccess);
+	const rr::VertexAttrib					vertexAttribs[]	=
+	{
+		rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &m_positions[0]),
+		rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &m_colors[0])
+	};
+	const rr::RenderState					state			((rr::ViewportState(colorAccess)));
+	const rr::PrimitiveList					primitives		(rr::PRIMITIVETYPE_TRIANGLES, (int)m_positions.size(), 0);
+	const rr::DrawCommand					drawCmd			(state, renderTarget, program, DE_LENGTH_OF_ARRAY(vertexAttribs), vertexAttribs, primitives);
+	const rr::Renderer						renderer;
+
+	renderer.draw(drawCmd);
+
+	return (deUint64)NUM_TRIANGLES;
+}
+
+// Compressed texture decompression
+
+class DecompressCase : public MicroBenchmarkCase
+{
+public:
+										DecompressCase		(tcu::TestContext& testCtx, const char* name, tcu::CompressedTexFormat format, tcu::TexDecompressionParams::AstcMode astcMode);
+
+	void								init				(void);
+	void								deinit				(void);
+
+protected:
+	deUint64							runWorkload			(void);
+
+private:
+	enum { NUM_BLOCKS_PER_AXIS = 32 };
+
+	const tcu::CompressedTexFormat		m_format;
+	const tcu::TexDecompressionParams	m_params;
+	vector<deUint8>						m_data;
+	TextureLevel						m_result;
+};
+
+DecompressCase::DecompressCase (tcu::TestContext& testCtx, const char* name, tcu::CompressedTexFormat format, tcu::TexDecompressionParams::AstcMode astcMode)
+	: MicroBenchmarkCase	(testCtx, name, "", "texel")
+	, m_format				(format)
+	, m_params				(astcMode)
+{
+}
+
+void DecompressCase::init (void)
+{
+	const IVec3		blockPixelSize	= tcu::getBlockPixelSize(m_format);
+	const size_t	numBlocks		= (size_t)(NUM_BLOCKS_PER_AXIS*NUM_BLOCKS_PER_AXIS);
+
+	m_data.resize(numBlocks * (size_t)tcu::getBlockSize(m_format));
+	m_result.setStorage(tcu::getUncompressedFormat(m_format), NUM_BLOCKS_PER_AXIS*blockPixelSize.x(), NUM_BLOCKS_PER_AXIS*blockPixelSize.y());
+
+	if (tcu::isAstcFormat(m_format))
+		tcu::astc::generateRandomValidBlocks(&m_data[0], numBlocks, m_format, m_params.astcMode, 0x5a7c1d);
+	else
+	{
+		// \note All bit patterns are valid ETC2 and EAC blocks.
+		de::Random rnd (0x5a7c1d);
+
+		for (size_t ndx = 0; ndx < m_data.size(); ndx++)
+			m_data[ndx] = rnd.getUint8();
+
+		// \note In ETC1 differential mode base + delta must stay within 5 bits, ETC2 uses the overflowing patterns for other modes.
+		if (m_format == tcu::COMPRESSEDTEXFORMAT_ETC1_RGB8)
+		{
+			for (size_t blockNdx = 0; blockNdx < numBlocks; blockNdx++)
+			{
+				deUint8* const	block			= &m_data[blockNdx*8];
+				const bool		diffMode		= (block[3] & 0x2) != 0;
+
+				if (!diffMode)
+					continue;
+
+				for (int channelNdx = 0; channelNdx < 3; channelNdx++)
+				{
+					const int	base	= block[channelNdx] >> 3;
+					const int	delta	= (block[channelNdx] & 0x4) != 0 ? (int)(block[channelNdx] & 0x7) - 8 : (int)(block[channelNdx] & 0x7);
+
+					if (!de::inRange(base + delta, 0, 31))
+						block[channelNdx] = (deUint8)(block[channelNdx] & ~0x7);
+				}
+			}
+		}
+	}
+}
+
+void DecompressCase::deinit (void)
+{
+	m_data.clear();
+	m_result = TextureLevel();
+}
+
+deUint64 DecompressCase::runWorkload (void)
+{
+	tcu::decompress(m_result.getAccess(), m_format, &m_data[0], m_params);
+	return (deUint64)(m_result.getWidth()*m_result.getHeight());
+}
+
+// tcu::Interval
+
+class IntervalCase : public MicroBenchmarkCase
+{
+public:
+	enum Operation
+	{
+		OPERATION_ADD = 0,
+		OPERATION_MUL,
+		OPERATION_DIV,
+		OPERATION_HULL,
+
+		OPERATION_LAST
+	};
+
+							IntervalCase		(tcu::TestContext& testCtx, const char* name, Operation op);
+
+	void					init				(void);
+	void					deinit				(void);
+
+protected:
+	deUint64				runWorkload			(void);
+
+private:
+	enum { NUM_VALUES = 4096 };
+
+	const Operation			m_op;
+	vector<tcu::Interval>	m_a;
+	vector<tcu::Interval>	m_b;
+};
+
+IntervalCase::IntervalCase (tcu::TestContext& testCtx, const char* name, Operation op)
+	: MicroBenchmarkCase	(testCtx, name, "", "operation")
+	, m_op					(op)
+{
+}
+
+void IntervalCase::init (void)
+{
+	de::Random rnd (0x31f9a4);
+
+	for (int ndx = 0; ndx < NUM_VALUES; ndx++)
+	{
+		const double a = rnd.getFloat(-100.0f, 100.0f);
+		const double b = rnd.getFloat(1.0f, 100.0f);
+
+		m_a.push_back(tcu::Interval(false, a, a + rnd.getFloat(0.0f, 1.0f)));
+		m_b.push_back(tcu::Interval(false, b, b + rnd.getFloat(0.0f, 1.0f)));
+	}
+}
+
+void IntervalCase::deinit (void)
+{
+	m_a.clear();
+	m_b.clear();
+}
+
+deUint64 IntervalCase::runWorkload (void)
+{
+	tcu::Interval acc;
+
+	for (int ndx = 0; ndx < NUM_VALUES; ndx++)
+	{
+		switch (m_op)
+		{
+			case OPERATION_ADD:		acc |= m_a[ndx] + m_b[ndx];	break;
+			case OPERATION_MUL:		acc |= m_a[ndx] * m_b[ndx];	break;
+			case OPERATION_DIV:		acc |= m_a[ndx] / m_b[ndx];	break;
+			case OPERATION_HULL:	acc |= m_a[ndx] | m_b[ndx];	break;
+			default:
+				DE_ASSERT(false);
+		}
+	}
+
+	consume((float)(acc.hi() - acc.lo()));
+	return (deUint64)NUM_VALUES;
+}
+
+// qpXmlWriter
+
+class XmlWriterCase : public MicroBenchmarkCase
+{
+public:
+						XmlWriterCase		(tcu::TestContext& testCtx, const char* name);
+
+	void				init				(void);
+	void				deinit				(void);
+
+protected:
+	deUint64			runWorkload			(void);
+
+private:
+	enum { NUM_ELEMENTS = 256 };
+
+	FILE*				m_file;
+	qpXmlWriter*		m_writer;
+};
+
+XmlWriterCase::XmlWriterCase (tcu::TestContext& testCtx, const char* name)
+	: MicroBenchmarkCase	(testCtx, name, "", "element")
+	, m_file				(DE_NULL)
+	, m_writer				(DE_NULL)
+{
+}
+
+void XmlWriterCase::init (void)
+{
+	m_file = fopen(s_nullDevicePath, "wb");
+	if (!m_file)
+		throw tcu::ResourceError(string("Failed to open ") + s_nullDevicePath);
+
+	m_writer = qpXmlWriter_createFileWriter(m_file, DE_FALSE, DE_FALSE);
+	if (!m_writer)
+	{
+		deinit();
+		throw std::bad_alloc();
+	}
+
+	qpXmlWriter_startDocument(m_writer);
+	qpXmlWriter_startElement(m_writer, "Log", 0, DE_NULL);
+}
+
+void XmlWriterCase::deinit (void)
+{
+	if (m_writer)
+	{
+		qpXmlWriter_endElement(m_writer, "Log");
+		qpXmlWriter_endDocument(m_writer);
+		qpXmlWriter_destroy(m_writer);
+		m_writer = DE_NULL;
+	}
+
+	if (m_file)
+	{
+		fclose(m_file);
+		m_file = DE_NULL;
+	}
+}
+
+deUint64 XmlWriterCase::runWorkload (void)
+{
+	for (int ndx = 0; ndx < NUM_ELEMENTS; ndx++)
+	{
+		const qpXmlAttribute attribs[] =
+		{
+			qpSetStringAttrib("Name",			"ResultValue"),
+			qpSetStringAttrib("Description",	"Value with <special> & \"escaped\" characters"),
+			qpSetStringAttrib("Unit",			"ns")
+		};
+
+		qpXmlWriter_startElement(m_writer, "Number", DE_LENGTH_OF_ARRAY(attribs), attribs);
+		qpXmlWriter_writeString(m_writer, "Lorem ipsum dolor sit amet, consectetur adipiscing elit: a < b && b > c\n");
+		qpXmlWriter_endElement(m_writer, "Number");
+	}
+
+	return (deUint64)NUM_ELEMENTS;
+}
+
+// PNG compressed image logging
+
+class PngCompressCase : public MicroBenchmarkCase
+{
+public:
+						PngCompressCase		(tcu::TestContext& testCtx, const char* name);
+
+	void				init				(void);
+	void				deinit				(void);
+
+protected:
+	deUint64			runWorkload			(void);
+
+private:
+	enum { SIZE = 256 };
+
+	qpTestLog*			m_scratchLog;
+	TextureLevel		m_image;
+};
+
+PngCompressCase::PngCompressCase (tcu::TestContext& testCtx, const char* name)
+	: MicroBenchmarkCase	(testCtx, name, "", "pixel")
+	, m_scratchLog			(DE_NULL)
+{
+}
+
+void PngCompressCase::init (void)
+{
+	m_image.setStorage(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), SIZE, SIZE);
+	tcu::fillWithMetaballs(m_image.getAccess(), 8, 0x12345);
+
+	// \note Images are written to a scratch log to keep the actual test log readable.
+	m_scratchLog = qpTestLog_createFileLog(s_nullDevicePath, 0);
+	if (!m_scratchLog)
+		throw tcu::ResourceError("Failed to create scratch log");
+
+	qpTestLog_startCase(m_scratchLog, "scratch", QP_TEST_CASE_TYPE_PERFORMANCE);
+}
+
+void PngCompressCase::deinit (void)
+{
+	if (m_scratchLog)
+	{
+		qpTestLog_endCase(m_scratchLog, QP_TEST_RESULT_PASS, "");
+		qpTestLog_destroy(m_scratchLog);
+		m_scratchLog = DE_NULL;
+	}
+
+	m_image = TextureLevel();
+}
+
+deUint64 PngCompressCase::runWorkload (void)
+{
+	const ConstPixelBufferAccess access = m_image.getAccess();
+
+	if (!qpTestLog_writeImage(m_scratchLog, "Image", "", QP_IMAGE_COMPRESSION_MODE_PNG, QP_IMAGE_FORMAT_RGBA8888, access.getWidth(), access.getHeight(), access.getRowPitch(), access.getDataPtr()))
+		throw tcu::TestError("Failed to write image");
+
+	return (deUint64)(SIZE*SIZE);
+}
+
+// tcu::CaseListFilter
+
+class CaseListFilterCase : public MicroBenchmarkCase
+{
+public:
+	enum FilterType
+	{
+		FILTERTYPE_TRIE = 0,
+		FILTERTYPE_WILDCARD,
+
+		FILTERTYPE_LAST
+	};
+
+										CaseListFilterCase	(tcu::TestContext& testCtx, const char* name, FilterType filterType);
+
+	void								init				(void);
+	void								deinit				(void);
+
+protected:
+	deUint64							runWorkload			(void);
+
+private:
+	enum
+	{
+		NUM_GROUPS				= 16,
+		NUM_SUBGROUPS			= 16,
+		NUM_CASES_PER_SUBGROUP	= 32
+	};
+
+	const FilterType					m_filterType;
+	de::MovePtr<tcu::CaseListFilter>	m_filter;
+	vector<string>						m_groupPaths;
+	vector<string>						m_casePaths;
+};
+
+CaseListFilterCase::CaseListFilterCase (tcu::TestContext& testCtx, const char* name, FilterType filterType)
+	: MicroBenchmarkCase	(testCtx, name, "", "lookup")
+	, m_filterType			(filterType)
+{
+}
+
+void CaseListFilterCase::init (void)
+{
+	// Synthetic hierarchy; trie contains every other case, wildcard pattern every other subgroup.
+	string	trie	= "{pkg{";
+
+	for (int groupNdx = 0; groupNdx < NUM_GROUPS; groupNdx++)
+	{
+		const string groupPath = "pkg.group" + de::toString(groupNdx);
+
+		m_groupPaths.push_back(groupPath);
+		trie += (groupNdx > 0 ? ",group" : "group") + de::toString(groupNdx) + "{";
+
+		for (int subgroupNdx = 0; subgroupNdx < NUM_SUBGROUPS; subgroupNdx++)
+		{
+			const string subgroupPath = groupPath + ".subgroup" + de::toString(subgroupNdx);
+
+			m_groupPaths.push_back(subgroupPath);
+			trie += (subgroupNdx > 0 ? ",subgroup" : "subgroup") + de::toString(subgroupNdx) + "{";
+
+			for (int caseNdx = 0; caseNdx < NUM_CASES_PER_SUBGROUP; caseNdx++)
+			{
+				m_casePaths.push_back(subgroupPath + ".case" + de::toString(caseNdx));
+
+				if (caseNdx % 2 == 0)
+					trie += (caseNdx > 0 ? ",case" : "case") + de::toString(caseNdx);
+			}
+
+			trie += "}";
+		}
+
+		trie += "}";
+	}
+
+	trie += "}}";
+
+	{
+		const string			arg		= m_filterType == FILTERTYPE_TRIE ? "--deqp-caselist=" + trie : "--deqp-case=pkg.group*.subgroup*1.*";
+		const char* const		argv[]	= { "deqp", arg.c_str() };
+		const tcu::CommandLine	cmdLine	(DE_LENGTH_OF_ARRAY(argv), argv);
+
+		m_filter = cmdLine.createCaseListFilter(m_testCtx.getArchive());
+	}
+}
+
+void CaseListFilterCase::deinit (void)
+{
+	m_filter.clear();
+	m_groupPaths.clear();
+	m_casePaths.clear();
+}
+
+deUint64 CaseListFilterCase::runWorkload (void)
+{
+	int numMatches = 0;
+
+	for (vector<string>::const_iterator path = m_groupPaths.begin(); path != m_groupPaths.end(); ++path)
+		numMatches += m_filter->checkTestGroupName(path->c_str()) ? 1 : 0;
+
+	for (vector<string>::const_iterator path = m_casePaths.begin(); path != m_casePaths.end(); ++path)
+		numMatches += m_filter->checkTestCaseName(path->c_str()) ? 1 : 0;
+
+	consume((float)numMatches);
+	return (deUint64)(m_groupPaths.size() + m_casePaths.size());
+}
+
+// deMemPool
+
+class MemPoolCase : public MicroBenchmarkCase
+{
+public:
+	enum Workload
+	{
+		WORKLOAD_SMALL_ALLOCS = 0,	//!< Small allocations of varying size.
+		WORKLOAD_POOL_ARRAY,		//!< de::PoolArray<int>::pushBack().
+
+		WORKLOAD_LAST
+	};
+
+								MemPoolCase			(tcu::TestContext& testCtx, const char* name, Workload workload, bool reusePool);
+
+	void						init				(void);
+	void						deinit				(void);
+
+protected:
+	deUint64					runWorkload			(void);
+	void						logWorkloadInfo		(void);
+
+private:
+	enum { NUM_ALLOCS = 16384 };
+
+	const Workload				m_workload;
+	const bool					m_reusePool;
+	de::MovePtr<de::MemPool>	m_pool;			//!< Pool reset for each workload run, null if each run creates a new pool.
+	deMemPoolStats				m_lastStats;
+	int							m_lastCapacity;
+};
+
+MemPoolCase::MemPoolCase (tcu::TestContext& testCtx, const char* name, Workload workload, bool reusePool)
+	: MicroBenchmarkCase	(testCtx, name, "", "allocation")
+	, m_workload			(workload)
+	, m_reusePool			(reusePool)
+	, m_lastCapacity		(0)
+{
+	deMemset(&m_lastStats, 0, sizeof(m_lastStats));
+}
+
+void MemPoolCase::init (void)
+{
+	if (m_reusePool)
+		m_pool = de::MovePtr<de::MemPool>(new de::MemPool());
+}
+
+void MemPoolCase::deinit (void)
+{
+	m_pool.clear();
+}
+
+deUint64 MemPoolCase::runWorkload (void)
+{
+	de::UniquePtr<de::MemPool>	localPool	(m_reusePool ? DE_NULL : new de::MemPool());
+	de::MemPool&				pool		= m_reusePool ? *m_pool : *localPool;
+	deMemPoolStats				startStats;
+
+	if (m_reusePool)
+		pool.reset();
+
+	deMemPool_getStats(pool.getRawPool(), &startStats, DE_TRUE);
+
+	if (m_workload == WORKLOAD_SMALL_ALLOCS)
+	{
+		deUint32 acc = 0;
+
+		for (int ndx = 0; ndx < NUM_ALLOCS; ndx++)
+		{
+			deUint8* const ptr = (deUint8*)pool.alloc((deUintptr)(8 + (ndx*37) % 120));
+
+			ptr[0]	= (deUint8)ndx;
+			acc		+= (deUint32)(deUintptr)ptr;
+		}
+
+		consume((float)(acc & 0xffff));
+	}
+	else
+	{
+		DE_ASSERT(m_workload == WORKLOAD_POOL_ARRAY);
+
+		de::PoolArray<int> array (&pool);
+
+		for (int ndx = 0; ndx < NUM_ALLOCS; ndx++)
+			array.pushBack(ndx);
+
+		consume((float)array[NUM_ALLOCS/2]);
+	}
+
+	deMemPool_getStats(pool.getRawPool(), &m_lastStats, DE_TRUE);
+
+	m_lastStats.numPageAllocs	-= startStats.numPageAllocs;
+	m_lastStats.numPageReuses	-= startStats.numPageReuses;
+	m_lastStats.numLargeAllocs	-= startStats.numLargeAllocs;
+	m_lastCapacity				= (int)pool.getCapacity(true);
+
+	return (deUint64)NUM_ALLOCS;
+}
+
+void MemPoolCase::logWorkloadInfo (void)
+{
+	m_testCtx.getLog()
+		<< TestLog::Integer("PageAllocs",	"Pages allocated during last workload run",			"",		QP_KEY_TAG_NONE,	m_lastStats.numPageAllocs)
+		<< TestLog::Integer("PageReuses",	"Pages reused during last workload run",			"",		QP_KEY_TAG_NONE,	m_lastStats.numPageReuses)
+		<< TestLog::Integer("LargeAllocs",	"Dedicated page allocations during last run",		"",		QP_KEY_TAG_NONE,	m_lastStats.numLargeAllocs)
+		<< TestLog::Integer("Capacity",		"Pool capacity after last workload run",			"B",	QP_KEY_TAG_NONE,	m_lastCapacity);
+}
+
+void addPixelAccessTests (tcu::TestCaseGroup* group)
+{
+	tcu::TestContext&	testCtx		= group->getTestContext();
+
+	for (int formatNdx = 0; formatNdx < DE_LENGTH_OF_ARRAY(s_pixelAccessFormats); formatNdx++)
+	{
+		const FormatCase& formatCase = s_pixelAccessFormats[formatNdx];
+
+		group->addChild(new PixelAccessCase(testCtx, (string("get_pixel_") + formatCase.name).c_str(), PixelAccessCase::FUNCTION_GET_PIXEL, formatCase.format));
+		group->addChild(new PixelAccessCase(testCtx, (string("set_pixel_") + formatCase.name).c_str(), PixelAccessCase::FUNCTION_SET_PIXEL, formatCase.format));
+	}
+}
+
+void addCopyTests (tcu::TestCaseGroup* group)
+{
+	static const struct
+	{
+		const char*		name;
+		TextureFormat	srcFormat;
+		TextureFormat	dstFormat;
+	} s_cases[] =
+	{
+		{ "rgba8_to_rgba8",		TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8),			TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8)	},
+		{ "rgba8_to_rgba32f",	TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8),			TextureFormat(TextureFormat::RGBA,	TextureFormat::FLOAT)		},
+		{ "rgba32f_to_rgba8",	TextureFormat(TextureFormat::RGBA,	TextureFormat::FLOAT),				TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8)	},
+		{ "rgb8_to_rgba8",		TextureFormat(TextureFormat::RGB,	TextureFormat::UNORM_INT8),			TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8)	},
+		{ "rgb565_to_rgba8",	TextureFormat(TextureFormat::RGB,	TextureFormat::UNORM_SHORT_565),	TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8)	},
+		{ "rgba16f_to_rgba32f",	TextureFormat(TextureFormat::RGBA,	TextureFormat::HALF_FLOAT),			TextureFormat(TextureFormat::RGBA,	TextureFormat::FLOAT)		},
+	};
+
+	for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(s_cases); caseNdx++)
+		group->addChild(new CopyCase(group->getTestContext(), s_cases[caseNdx].name, s_cases[caseNdx].srcFormat, s_cases[caseNdx].dstFormat));
+}
+
+void addSampleTests (tcu::TestCaseGroup* group)
+{
+	tcu::TestContext& testCtx = group->getTestContext();
+
+	group->addChild(new SampleCase(testCtx, "nearest",					tcu::Sampler::NEAREST,					tcu::Sampler::NEAREST));
+	group->addChild(new SampleCase(testCtx, "linear",					tcu::Sampler::LINEAR,					tcu::Sampler::LINEAR));
+	group->addChild(new SampleCase(testCtx, "nearest_mipmap_nearest",	tcu::Sampler::NEAREST_MIPMAP_NEAREST,	tcu::Sampler::NEAREST));
+	group->addChild(new SampleCase(testCtx, "linear_mipmap_linear",		tcu::Sampler::LINEAR_MIPMAP_LINEAR,		tcu::Sampler::LINEAR));
+}
+
+void addDecompressTests (tcu::TestCaseGroup* group)
+{
+	static const struct
+	{
+		const char*								name;
+		tcu::CompressedTexFormat				format;
+		tcu::TexDecompressionParams::AstcMode	astcMode;
+	} s_cases[] =
+	{
+		{ "etc1_rgb8",			tcu::COMPRESSEDTEXFORMAT_ETC1_RGB8,								tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "eac_r11",			tcu::COMPRESSEDTEXFORMAT_EAC_R11,								tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "eac_rg11",			tcu::COMPRESSEDTEXFORMAT_EAC_RG11,								tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "etc2_rgb8",			tcu::COMPRESSEDTEXFORMAT_ETC2_RGB8,								tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "etc2_eac_rgba8",		tcu::COMPRESSEDTEXFORMAT_ETC2_EAC_RGBA8,						tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "astc_4x4_ldr",		tcu::COMPRESSEDTEXFORMAT_ASTC_4x4_RGBA,							tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "astc_4x4_hdr",		tcu::COMPRESSEDTEXFORMAT_ASTC_4x4_RGBA,							tcu::TexDecompressionParams::ASTCMODE_HDR	},
+		{ "astc_6x6_ldr",		tcu::COMPRESSEDTEXFORMAT_ASTC_6x6_RGBA,							tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "astc_8x8_ldr",		tcu::COMPRESSEDTEXFORMAT_ASTC_8x8_RGBA,							tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "astc_12x12_ldr",		tcu::COMPRESSEDTEXFORMAT_ASTC_12x12_RGBA,						tcu::TexDecompressionParams::ASTCMODE_LDR	},
+		{ "astc_8x8_srgb8",		tcu::COMPRESSEDTEXFORMAT_ASTC_8x8_SRGB8_ALPHA8,					tcu::TexDecompressionParams::ASTCMODE_LDR	},
+	};
+
+	for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(s_cases); caseNdx++)
+		group->addChild(new DecompressCase(group->getTestContext(), s_cases[caseNdx].name, s_cases[caseNdx].format, s_cases[caseNdx].astcMode));
+}
+
+void addMemPoolTests (tcu::TestCaseGroup* group)
+{
+	tcu::TestContext&	testCtx		= group->getTestContext();
+
+	group->addChild(new MemPoolCase(testCtx, "small_allocs",			MemPoolCase::WORKLOAD_SMALL_ALLOCS,	false));
+	group->addChild(new MemPoolCase(testCtx, "small_allocs_reset",		MemPoolCase::WORKLOAD_SMALL_ALLOCS,	true));
+	group->addChild(new MemPoolCase(testCtx, "pool_array",				MemPoolCase::WORKLOAD_POOL_ARRAY,	false));
+	group->addChild(new MemPoolCase(testCtx, "pool_array_reset",		MemPoolCase::WORKLOAD_POOL_ARRAY,	true));
+}
+
+void addIntervalTests (tcu::TestCaseGroup* group)
+{
+	tcu::TestContext& testCtx = group->getTestContext();
+
+	group->addChild(new IntervalCase(testCtx, "add",	IntervalCase::OPERATION_ADD));
+	group->addChild(new IntervalCase(testCtx, "mul",	IntervalCase::OPERATION_MUL));
+	group->addChild(new IntervalCase(testCtx, "div",	IntervalCase::OPERATION_DIV));
+	group->addChild(new IntervalCase(testCtx, "hull",	IntervalCase::OPERATION_HULL));
+}
+
+tcu::TestCaseGroup* createGroup (tcu::TestContext& testCtx, const char* name, const char* description, void (*addChildren) (tcu::TestCaseGroup*))
+{
+	de::MovePtr<tcu::TestCaseGroup> group (new tcu::TestCaseGroup(testCtx, name, description));
+	addChildren(group.get());
+	return group.release();
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createPerformanceTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup>	perfTests	(new tcu::TestCaseGroup(testCtx, "perf", "Framework CPU cost benchmarks"));
+
+	perfTests->addChild(createGroup(testCtx, "pixel_access",	"ConstPixelBufferAccess::getPixel() and PixelBufferAccess::setPixel()",	addPixelAccessTests));
+	perfTests->addChild(createGroup(testCtx, "copy",			"tcu::copy()",															addCopyTests));
+	perfTests->addChild(createGroup(testCtx, "sample_2d",		"tcu::sampleLevelArray2D()",											addSampleTests));
+	perfTests->addChild(createGroup(testCtx, "decompress",		"Compressed texture decompression",										addDecompressTests));
+	perfTests->addChild(createGroup(testCtx, "interval",		"tcu::Interval arithmetic",												addIntervalTests));
+	perfTests->addChild(createGroup(testCtx, "mem_pool",		"deMemPool allocation",													addMemPoolTests));
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	compareTests	(new tcu::TestCaseGroup(testCtx, "image_compare", "Image comparison"));
+
+		compareTests->addChild(new ImageCompareCase(testCtx, "fuzzy_compare",			ImageCompareCase::COMPARETYPE_FUZZY));
+		compareTests->addChild(new ImageCompareCase(testCtx, "int_threshold_compare",	ImageCompareCase::COMPARETYPE_INT_THRESHOLD));
+		perfTests->addChild(compareTests.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	rendererTests	(new tcu::TestCaseGroup(testCtx, "renderer", "rr::Renderer triangle throughput"));
+
+		rendererTests->addChild(new RendererCase(testCtx, "small_triangles",	0.02f));
+		rendererTests->addChild(new RendererCase(testCtx, "large_triangles",	0.5f));
+		perfTests->addChild(rendererTests.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	logTests		(new tcu::TestCaseGroup(testCtx, "log", "Test log writing"));
+
+		logTests->addChild(new XmlWriterCase	(testCtx, "xml_writer"));
+		logTests->addChild(new PngCompressCase	(testCtx, "png_image"));
+		perfTests->addChild(logTests.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	filterTests		(new tcu::TestCaseGroup(testCtx, "case_list_filter", "tcu::CaseListFilter lookups"));
+
+		filterTests->addChild(new CaseListFilterCase(testCtx, "trie",		CaseListFilterCase::FILTERTYPE_TRIE));
+		filterTests->addChild(new CaseListFilterCase(testCtx, "wildcard",	CaseListFilterCase::FILTERTYPE_WILDCARD));
+		perfTests->addChild(filterTests.release());
+	}
+
+	return perfTests.release();
+}
+
+} // dit
@@ -23,8 +23,22 @@
 
 #include "ditTestLogTests.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuSurface.hpp"
+#include "tcuImageIO.hpp"
+#include "tcuResource.hpp"
+#include "tcuTextureUtil.hpp"
+#include "deFile.h"
+#include "deString.h"
+#include "deMemory.h"
+#include "deRandom.hpp"
+#include "xeBinaryLogParser.hpp"
+#include "gluCallLogWrapper.hpp"
+#include "glwFunctions.hpp"
+#include "glwEnums.hpp"
 
 #include <limits>
+#include <fstream>
+#include <sstream>
 
 namespace dit
 {
@@ -69,6 +83,521 @@ public:
 	}
 };
 
+class CountingLogContent : public tcu::DeferredLogContent
+{
+public:
+	CountingLogContent (int* numWrites)
+		: m_numWrites(numWrites)
+	{
+	}
+
+	void write (TestLog& log) const
+	{
+		*m_numWrites += 1;
+		log << TestLog::Message << "Deferred content" << TestLog::EndMessage;
+	}
+
+private:
+	int* const	m_numWrites;
+};
+
+class DetailsOnFailureCase : public tcu::TestCase
+{
+public:
+	DetailsOnFailureCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "details_on_failure", "Images and shaders are logged only for failing cases")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const char* const	logPath		= "dit-details-on-failure.qpa";
+		int					numWrites	= 0;
+		std::string			passLog;
+		std::string			failLog;
+
+		try
+		{
+			TestLog			log		(logPath, QP_TEST_LOG_DETAILS_ON_FAILURE|QP_TEST_LOG_NO_FLUSH);
+			tcu::Surface	image	(4, 4);
+
+			image.getAccess().setPixel(tcu::Vec4(1.0f, 0.0f, 0.0f, 1.0f), 1, 1);
+
+			for (int caseNdx = 0; caseNdx < 2; caseNdx++)
+			{
+				log.startCase(caseNdx == 0 ? "pass" : "fail", QP_TEST_CASE_TYPE_SELF_VALIDATE);
+
+				log << TestLog::Section("Result", "Result")
+					<< TestLog::Message << "Kept message" << TestLog::EndMessage
+					<< TestLog::ImageSet("Images", "Images")
+					<< TestLog::Image("Result", "Result", image)
+					<< TestLog::EndImageSet
+					<< TestLog::EndSection;
+
+				log << TestLog::ShaderProgram(true, "")
+					<< TestLog::Shader(QP_SHADER_TYPE_VERTEX, "void main (void) {}", true, "")
+					<< TestLog::EndShaderProgram;
+
+				log.writeDeferred(de::MovePtr<tcu::DeferredLogContent>(new CountingLogContent(&numWrites)));
+
+				log.endCase(caseNdx == 0 ? QP_TEST_RESULT_PASS : QP_TEST_RESULT_FAIL, "");
+			}
+		}
+		catch (const tcu::ResourceError&)
+		{
+			deDeleteFile(logPath);
+			throw tcu::NotSupportedError("Failed to write temporary test log");
+		}
+
+		{
+			std::ifstream		file		(logPath);
+			std::ostringstream	contents;
+			size_t				failStart;
+
+			contents << file.rdbuf();
+			failStart	= contents.str().find("CasePath=\"fail\"");
+			passLog		= contents.str().substr(0, failStart);
+			failLog		= failStart != std::string::npos ? contents.str().substr(failStart) : std::string();
+		}
+
+		deDeleteFile(logPath);
+
+		if (passLog.find("Kept message") == std::string::npos || failLog.find("Kept message") == std::string::npos)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Message missing from log");
+		else if (passLog.find("<Image ") != std::string::npos || passLog.find("<ShaderProgram") != std::string::npos || passLog.find("Deferred content") != std::string::npos)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Details logged for passing case");
+		else if (passLog.find("omitted") == std::string::npos)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Summary missing from passing case");
+		else if (failLog.find("<Image ") == std::string::npos || failLog.find("<ShaderProgram") == std::string::npos || failLog.find("Deferred content") == std::string::npos)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Details missing from failing case");
+		else if (numWrites != 1)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Deferred content written for passing case");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+
+		return STOP;
+	}
+};
+
+static glw::GLenum GLW_APIENTRY getErrorStub (void)
+{
+	return GL_INVALID_ENUM;
+}
+
+static void GLW_APIENTRY clearStub (glw::GLbitfield)
+{
+}
+
+class DeferredCallLogCase : public tcu::TestCase
+{
+public:
+	DeferredCallLogCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "deferred_call_log", "Deferred GL call log is written only for failing cases")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const struct
+		{
+			const char*		name;
+			qpTestResult	result;
+			bool			throws;		//!< Case ends with an exception, deferred mode is disabled before result is known.
+			bool			expectCalls;
+		} s_cases[] =
+		{
+			{ "pass",		QP_TEST_RESULT_PASS,	false,	false	},
+			{ "fail",		QP_TEST_RESULT_FAIL,	false,	true	},
+			{ "exception",	QP_TEST_RESULT_FAIL,	true,	true	},
+			{ "pass2",		QP_TEST_RESULT_PASS,	false,	false	},
+		};
+
+		const char* const	logPath		= "dit-deferred-call-log.qpa";
+		glw::Functions		gl;
+		std::string			contents;
+
+		gl.getError	= getErrorStub;
+		gl.clear	= clearStub;
+
+		try
+		{
+			TestLog				log		(logPath, QP_TEST_LOG_NO_FLUSH);
+			glu::CallLogWrapper	wrapper	(gl, log);
+
+			wrapper.enableLogging(true);
+
+			for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(s_cases); caseNdx++)
+			{
+				log.startCase(s_cases[caseNdx].name, QP_TEST_CASE_TYPE_SELF_VALIDATE);
+				wrapper.enableDeferredLogging(true);
+
+				wrapper.glClear(GL_COLOR_BUFFER_BIT);
+				wrapper.glGetError();
+
+				if (s_cases[caseNdx].throws)
+					wrapper.enableDeferredLogging(false);
+				else
+					wrapper.endCallLog(s_cases[caseNdx].result);
+
+				log.endCase(s_cases[caseNdx].result, "");
+			}
+		}
+		catch (const tcu::ResourceError&)
+		{
+			deDeleteFile(logPath);
+			throw tcu::NotSupportedError("Failed to write temporary test log");
+		}
+
+		{
+			std::ifstream		file	(logPath);
+			std::ostringstream	str;
+
+			str << file.rdbuf();
+			contents = str.str();
+		}
+
+		deDeleteFile(logPath);
+
+		for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(s_cases); caseNdx++)
+		{
+			const size_t		caseStart	= contents.find(std::string("CasePath=\"") + s_cases[caseNdx].name + "\"");
+			const size_t		caseEnd		= contents.find("#endTestCaseResult", caseStart);
+			const std::string	caseLog		= caseStart != std::string::npos ? contents.substr(caseStart, caseEnd - caseStart) : std::string();
+			const bool			hasCalls	= caseLog.find("glClear(GL_COLOR_BUFFER_BIT);") != std::string::npos &&
+											  caseLog.find("GL_INVALID_ENUM returned") != std::string::npos;
+
+			if (caseLog.empty())
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Case missing from log");
+				return STOP;
+			}
+			else if (hasCalls != s_cases[caseNdx].expectCalls)
+			{
+				m_testCtx.getLog() << TestLog::Message << "Case '" << s_cases[caseNdx].name << "': expected call log to be " << (s_cases[caseNdx].expectCalls ? "written" : "omitted") << TestLog::EndMessage;
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Invalid call log");
+				return STOP;
+			}
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+static std::string readFile (const char* path)
+{
+	std::ifstream		file		(path, std::ios_base::binary);
+	std::ostringstream	contents;
+
+	contents << file.rdbuf();
+	return contents.str();
+}
+
+static std::string getAttribute (const std::string& element, const char* name)
+{
+	const std::string	key		= std::string(" ") + name + "=\"";
+	const size_t		start	= element.find(key);
+
+	if (start == std::string::npos)
+		return std::string();
+
+	return element.substr(start + key.size(), element.find('"', start + key.size()) - start - key.size());
+}
+
+static std::vector<deUint8> decodeBase64 (const std::string& src)
+{
+	std::vector<deUint8>	dst;
+	deUint32				bits		= 0;
+	int						numBits		= 0;
+
+	for (size_t ndx = 0; ndx < src.size(); ndx++)
+	{
+		const char	c		= src[ndx];
+		int			value	= -1;
+
+		if (c >= 'A' && c <= 'Z')		value = c - 'A';
+		else if (c >= 'a' && c <= 'z')	value = c - 'a' + 26;
+		else if (c >= '0' && c <= '9')	value = c - '0' + 52;
+		else if (c == '+')				value = 62;
+		else if (c == '/')				value = 63;
+
+		if (value < 0)
+			continue;
+
+		bits		= (bits << 6) | (deUint32)value;
+		numBits		+= 6;
+
+		if (numBits >= 8)
+		{
+			numBits -= 8;
+			dst.push_back((deUint8)(bits >> numBits));
+		}
+	}
+
+	return dst;
+}
+
+class ImageEncoderCase : public tcu::TestCase
+{
+public:
+	ImageEncoderCase (tcu::TestContext& testCtx, const char* name, deUint32 encoderFlags)
+		: TestCase			(testCtx, name, "Logged image is decoded back to original pixels")
+		, m_encoderFlags	(encoderFlags)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const char* const	logPath		= "dit-image-encoder.qpa";
+		const char* const	pngPath		= "dit-image-encoder.png";
+		tcu::Surface		image		(37, 23);
+		de::Random			rnd			(deStringHash(getName()));
+		std::string			element;
+		std::string			data;
+
+		// Mix of flat areas and noise, like typical result images.
+		for (int y = 0; y < image.getHeight(); y++)
+		for (int x = 0; x < image.getWidth(); x++)
+			image.setPixel(x, y, x < 20 ? tcu::RGBA(x*8, y*8, 128, 255) : tcu::RGBA(rnd.getUint32()));
+
+		try
+		{
+			TestLog log (logPath, m_encoderFlags|QP_TEST_LOG_NO_FLUSH);
+
+			log.startCase("image", QP_TEST_CASE_TYPE_SELF_VALIDATE);
+			log << TestLog::Image("Result", "Result", image);
+			log.endCase(QP_TEST_RESULT_PASS, "");
+		}
+		catch (const tcu::ResourceError&)
+		{
+			deDeleteFile(logPath);
+			throw tcu::NotSupportedError("Failed to write temporary test log");
+		}
+
+		{
+			const std::string	contents	= readFile(logPath);
+			const size_t		start		= contents.find("<Image ");
+			const size_t		dataStart	= contents.find('>', start);
+
+			deDeleteFile(logPath);
+
+			if (start == std::string::npos || dataStart == std::string::npos)
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Image missing from log");
+				return STOP;
+			}
+
+			element = contents.substr(start, dataStart - start);
+
+			// Element without data is self-closing.
+			if (contents[dataStart-1] != '/')
+			{
+				const size_t end = contents.find("</Image>", dataStart);
+
+				if (end == std::string::npos)
+				{
+					m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Image element not closed");
+					return STOP;
+				}
+
+				data = contents.substr(dataStart + 1, end - dataStart - 1);
+			}
+		}
+
+		{
+			const std::string		file		= getAttribute(element, "File");
+			const bool				isPNG		= getAttribute(element, "CompressionMode") == "PNG";
+			const bool				isRawFile	= (m_encoderFlags & QP_TEST_LOG_IMAGE_RAW_FILES) != 0;
+			tcu::TextureLevel		decoded;
+
+			if (isRawFile ? (isPNG || file.empty()) : (!isPNG || !file.empty()))
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Unexpected image storage in log");
+				return STOP;
+			}
+
+			if (isPNG)
+			{
+				const std::vector<deUint8>	bytes	= decodeBase64(data);
+
+				{
+					std::ofstream out (pngPath, std::ios_base::binary);
+					out.write((const char*)&bytes[0], (std::streamsize)bytes.size());
+				}
+
+				tcu::ImageIO::loadPNG(decoded, tcu::DirArchive(""), pngPath);
+				deDeleteFile(pngPath);
+			}
+			else
+			{
+				const std::string	pixels	= readFile(file.c_str());
+
+				deDeleteFile(file.c_str());
+
+				if (pixels.size() != (size_t)(image.getWidth()*image.getHeight()*4))
+				{
+					m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Invalid image file size");
+					return STOP;
+				}
+
+				decoded.setStorage(tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8), image.getWidth(), image.getHeight());
+				deMemcpy(decoded.getAccess().getDataPtr(), pixels.data(), pixels.size());
+			}
+
+			if (decoded.getWidth() != image.getWidth() || decoded.getHeight() != image.getHeight())
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Invalid decoded image size");
+				return STOP;
+			}
+
+			for (int y = 0; y < image.getHeight(); y++)
+			for (int x = 0; x < image.getWidth(); x++)
+			{
+				if (tcu::RGBA(decoded.getAccess().getPixel(x, y)) != image.getPixel(x, y))
+				{
+					m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Decoded image doesn't match");
+					return STOP;
+				}
+			}
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	const deUint32	m_encoderFlags;
+};
+
+//! Remove "#sessionInfo timestamp" lines, they differ between runs.
+static std::string removeTimestamps (const std::string& log)
+{
+	std::istringstream	src		(log);
+	std::string			dst;
+	std::string			line;
+
+	while (std::getline(src, line))
+	{
+		if (line.compare(0, 22, "#sessionInfo timestamp") != 0)
+			dst += line + "\n";
+	}
+
+	return dst;
+}
+
+class BinaryFormatCase : public tcu::TestCase
+{
+public:
+	BinaryFormatCase (tcu::TestContext& testCtx)
+		: TestCase(testCtx, "binary_format", "Binary log converted to text matches text log")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const char* const	xmlPath		= "dit-binary-format.qpa";
+		const char* const	binaryPath	= "dit-binary-format.qpb";
+		std::string			xmlLog;
+		std::string			convertedLog;
+
+		try
+		{
+			{
+				TestLog log (xmlPath, QP_TEST_LOG_NO_FLUSH);
+				writeContent(log);
+			}
+
+			{
+				TestLog log (binaryPath, QP_TEST_LOG_BINARY_FORMAT|QP_TEST_LOG_NO_FLUSH);
+				writeContent(log);
+			}
+		}
+		catch (const tcu::ResourceError&)
+		{
+			deDeleteFile(xmlPath);
+			deDeleteFile(binaryPath);
+			throw tcu::NotSupportedError("Failed to write temporary test log");
+		}
+
+		xmlLog = readFile(xmlPath);
+
+		{
+			const std::string	binaryLog	= readFile(binaryPath);
+			xe::BinaryLogParser	parser;
+
+			deDeleteFile(xmlPath);
+			deDeleteFile(binaryPath);
+
+			// Feed in small pieces to exercise records split across calls.
+			for (size_t pos = 0; pos < binaryLog.size(); pos += 7)
+				parser.feed((const deUint8*)binaryLog.data() + pos, de::min<size_t>(7, binaryLog.size() - pos), convertedLog);
+		}
+
+		if (xmlLog.find("#terminateTestCaseResult") == std::string::npos)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Text log is incomplete");
+		else if (removeTimestamps(convertedLog) != removeTimestamps(xmlLog))
+		{
+			m_testCtx.getLog() << TestLog::Message << "Text log:\n" << xmlLog << TestLog::EndMessage
+							   << TestLog::Message << "Converted binary log:\n" << convertedLog << TestLog::EndMessage;
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Converted log doesn't match");
+		}
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+
+		return STOP;
+	}
+
+private:
+	static void writeContent (TestLog& log)
+	{
+		tcu::Surface image (5, 3);
+
+		for (int y = 0; y < image.getHeight(); y++)
+		for (int x = 0; x < image.getWidth(); x++)
+			image.setPixel(x, y, tcu::RGBA(x*50, y*100, 7, 255));
+
+		log.startCase("binary.case", QP_TEST_CASE_TYPE_SELF_VALIDATE);
+
+		log << TestLog::Section("Outer", "Outer <section> & \"quotes\"")
+			<< TestLog::Message << "Message with <xml> & special\tcharacters\n" << TestLog::EndMessage
+			<< TestLog::Integer("Min", "Minimum", "", QP_KEY_TAG_NONE, std::numeric_limits<deInt64>::min())
+			<< TestLog::Integer("Time", "Time", "us", QP_KEY_TAG_TIME, 123456)
+			<< TestLog::Float("Pi", "Pi", "", QP_KEY_TAG_NONE, 3.14159f)
+			<< TestLog::Float("Inf", "Infinity", "", QP_KEY_TAG_NONE, std::numeric_limits<float>::infinity())
+			<< TestLog::Float("NaN", "Not a number", "", QP_KEY_TAG_NONE, std::numeric_limits<float>::quiet_NaN())
+			<< TestLog::Section("Inner", "Inner")
+			<< TestLog::ImageSet("Images", "Images")
+			<< TestLog::Image("PNG", "PNG image", image)
+			<< TestLog::Image("Raw", "Uncompressed image", image, QP_IMAGE_COMPRESSION_MODE_NONE)
+			<< TestLog::EndImageSet
+			<< TestLog::EndSection
+			<< TestLog::EndSection;
+
+		log << TestLog::ShaderProgram(false, "Link failed")
+			<< TestLog::Shader(QP_SHADER_TYPE_VERTEX, "void main (void) { gl_Position = vec4(1.0); }", true, "")
+			<< TestLog::Shader(QP_SHADER_TYPE_FRAGMENT, "void main (void) {}", false, "error: <missing>")
+			<< TestLog::EndShaderProgram;
+
+		log << TestLog::KernelSource("__kernel void k (void) {}");
+		log.writeCompileInfo("Kernel", "Kernel build", true, "");
+
+		log << TestLog::SampleList("Samples", "Samples")
+			<< TestLog::SampleInfo
+			<< TestLog::ValueInfo("Count",	"Count",	"",		QP_SAMPLE_VALUE_TAG_PREDICTOR)
+			<< TestLog::ValueInfo("Time",	"Time",		"us",	QP_SAMPLE_VALUE_TAG_RESPONSE)
+			<< TestLog::EndSampleInfo
+			<< TestLog::Sample << 1 << 0.5 << TestLog::EndSample
+			<< TestLog::Sample << -7 << 1e9 << TestLog::EndSample
+			<< TestLog::EndSampleList;
+
+		log.endCase(QP_TEST_RESULT_FAIL, "Failed & <done>");
+
+		log.startCase("binary.crashed", QP_TEST_CASE_TYPE_SELF_VALIDATE);
+		log << TestLog::Message << "Unterminated case" << TestLog::EndMessage;
+		log.terminateCase(QP_TEST_RESULT_CRASH);
+	}
+};
+
 TestLogTests::TestLogTests (tcu::TestContext& testCtx)
 	: TestCaseGroup(testCtx, "testlog", "Test Log Tests")
 {
@@ -81,6 +610,13 @@ TestLogTests::~TestLogTests (void)
 void TestLogTests::init (void)
 {
 	addChild(new BasicSampleListCase(m_testCtx));
+	addChild(new DetailsOnFailureCase(m_testCtx));
+	addChild(new DeferredCallLogCase(m_testCtx));
+	addChild(new ImageEncoderCase(m_testCtx, "image_encoder_default",	0u));
+	addChild(new ImageEncoderCase(m_testCtx, "image_encoder_fast",		QP_TEST_LOG_IMAGE_ENCODER_FAST));
+	addChild(new ImageEncoderCase(m_testCtx, "image_encoder_max",		QP_TEST_LOG_IMAGE_ENCODER_MAX));
+	addChild(new ImageEncoderCase(m_testCtx, "image_encoder_raw",		QP_TEST_LOG_IMAGE_RAW_FILES));
+	addChild(new BinaryFormatCase(m_testCtx));
 }
 
 } // dit
@@ -24,9 +24,11 @@
 #include "ditTestPackage.hpp"
 #include "ditBuildInfoTests.hpp"
 #include "ditDelibsTests.hpp"
+#include "ditExecutorTests.hpp"
 #include "ditFrameworkTests.hpp"
 #include "ditImageIOTests.hpp"
 #include "ditImageCompareTests.hpp"
+#include "ditPerformanceTests.hpp"
 #include "ditTestLogTests.hpp"
 #include "ditSeedBuilderTests.hpp"
 #include "ditSRGB8ConversionTest.hpp"
@@ -65,6 +67,7 @@ public:
 		addChild(new ImageCompareTests	(m_testCtx));
 		addChild(new TextureTests		(m_testCtx));
 		addChild(createSeedBuilderTests	(m_testCtx));
+		addChild(new ExecutorTests		(m_testCtx));
 	}
 };
 
@@ -112,6 +115,7 @@ void TestPackage::init (void)
 	addChild(new DelibsTests	(m_testCtx));
 	addChild(new FrameworkTests	(m_testCtx));
 	addChild(new DeqpTests		(m_testCtx));
+	addChild(createPerformanceTests(m_testCtx));
 }
 
 tcu::TestCaseExecutor* TestPackage::createExecutor (void) const
@@ -33,6 +33,7 @@
 #include "deArrayUtil.hpp"
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
+#include "deString.h"
 
 #include <sstream>
 
@@ -1577,6 +1578,139 @@ public:
 	}
 };
 
+//! Compare tcu::copy() between given channel types against the generic getPixel() -> setPixel() conversion on all channel order pairs.
+class CopyConversionCase : public tcu::TestCase
+{
+public:
+	CopyConversionCase (tcu::TestContext& testCtx, TextureFormat::ChannelType srcType, TextureFormat::ChannelType dstType)
+		: tcu::TestCase	(testCtx, getCopyCaseName(srcType, dstType).c_str(), "tcu::copy() matches generic conversion")
+		, m_srcType		(srcType)
+		, m_dstType		(dstType)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const vector<TextureFormat::ChannelOrder>	srcOrders		= getColorOrders(m_srcType);
+		const vector<TextureFormat::ChannelOrder>	dstOrders		= getColorOrders(m_dstType);
+		const IVec3									size			(7, 5, 2);
+		de::Random									rnd				(deStringHash(getName()));
+		int											numFailed		= 0;
+
+		for (size_t srcOrderNdx = 0; srcOrderNdx < srcOrders.size(); srcOrderNdx++)
+		for (size_t dstOrderNdx = 0; dstOrderNdx < dstOrders.size(); dstOrderNdx++)
+		{
+			const TextureFormat		srcFormat	(srcOrders[srcOrderNdx], m_srcType);
+			const TextureFormat		dstFormat	(dstOrders[dstOrderNdx], m_dstType);
+
+			if (srcFormat == dstFormat)
+				continue;
+
+			// Padded pitches catch writes outside of the pixels.
+			const IVec3				srcPitch	= getPaddedPitch(rnd, srcFormat, size);
+			const IVec3				dstPitch	= getPaddedPitch(rnd, dstFormat, size);
+			vector<deUint8>			srcData		(srcPitch.z()*size.z());
+			vector<deUint8>			refData		(dstPitch.z()*size.z());
+			vector<deUint8>			resData;
+
+			for (size_t ndx = 0; ndx < srcData.size(); ndx++)
+				srcData[ndx] = rnd.getUint8();
+
+			for (size_t ndx = 0; ndx < refData.size(); ndx++)
+				refData[ndx] = rnd.getUint8();
+
+			resData = refData;
+
+			{
+				const PixelBufferAccess	src	(srcFormat, size, srcPitch, &srcData[0]);
+				const PixelBufferAccess	ref	(dstFormat, size, dstPitch, &refData[0]);
+				const PixelBufferAccess	res	(dstFormat, size, dstPitch, &resData[0]);
+
+				// Keep float inputs finite, NaN payloads are not preserved by conversions.
+				if (m_srcType == TextureFormat::FLOAT)
+				{
+					for (int z = 0; z < size.z(); z++)
+					for (int y = 0; y < size.y(); y++)
+					for (int x = 0; x < size.x(); x++)
+						src.setPixel(tcu::Vec4(rnd.getFloat(-1e4f, 1e4f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(), rnd.getFloat(0.0f, 1e-30f)), x, y, z);
+				}
+
+				copyGeneric(ref, src);
+				tcu::copy(res, src);
+			}
+
+			if (resData != refData)
+			{
+				if (numFailed++ < 10)
+					m_testCtx.getLog() << TestLog::Message << "ERROR: copy from " << srcFormat << " to " << dstFormat << " differs from generic conversion" << TestLog::EndMessage;
+			}
+		}
+
+		if (numFailed == 0)
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, (de::toString(numFailed) + " format pairs failed").c_str());
+
+		return STOP;
+	}
+
+private:
+	static string getCopyCaseName (TextureFormat::ChannelType srcType, TextureFormat::ChannelType dstType)
+	{
+		std::ostringstream str;
+
+		str << srcType << "_to_" << dstType;
+
+		return de::toLower(str.str());
+	}
+
+	static vector<TextureFormat::ChannelOrder> getColorOrders (TextureFormat::ChannelType type)
+	{
+		vector<TextureFormat::ChannelOrder> orders;
+
+		for (int order = 0; order < TextureFormat::CHANNELORDER_LAST; order++)
+		{
+			const TextureFormat format ((TextureFormat::ChannelOrder)order, type);
+
+			if (isValid(format) && format.order != TextureFormat::D && format.order != TextureFormat::S && format.order != TextureFormat::DS)
+				orders.push_back(format.order);
+		}
+
+		return orders;
+	}
+
+	static IVec3 getPaddedPitch (de::Random& rnd, const TextureFormat& format, const IVec3& size)
+	{
+		const int	pixelSize	= tcu::getPixelSize(format);
+		const int	rowPitch	= pixelSize*size.x() + (rnd.getBool() ? pixelSize*rnd.getInt(1, 3) : 0);
+		const int	slicePitch	= rowPitch*size.y() + (rnd.getBool() ? rowPitch : 0);
+
+		return IVec3(pixelSize, rowPitch, slicePitch);
+	}
+
+	//! Generic conversion path of tcu::copy().
+	static void copyGeneric (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
+	{
+		const TextureChannelClass	srcClass	= tcu::getTextureChannelClass(src.getFormat().type);
+		const TextureChannelClass	dstClass	= tcu::getTextureChannelClass(dst.getFormat().type);
+		const bool					srcIsInt	= srcClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER || srcClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
+		const bool					dstIsInt	= dstClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER || dstClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
+
+		for (int z = 0; z < src.getDepth(); z++)
+		for (int y = 0; y < src.getHeight(); y++)
+		for (int x = 0; x < src.getWidth(); x++)
+		{
+			if (srcIsInt && dstIsInt)
+				dst.setPixel(src.getPixelInt(x, y, z), x, y, z);
+			else
+				dst.setPixel(src.getPixel(x, y, z), x, y, z);
+		}
+	}
+
+	const TextureFormat::ChannelType	m_srcType;
+	const TextureFormat::ChannelType	m_dstType;
+};
+
 } // anonymous
 
 tcu::TestCaseGroup* createTextureFormatTests (tcu::TestContext& testCtx)
@@ -1609,4 +1743,29 @@ tcu::TestCaseGroup* createTextureFormatTests (tcu::TestContext& testCtx)
 	return group.release();
 }
 
+tcu::TestCaseGroup* createTextureCopyTests (tcu::TestContext& testCtx)
+{
+	// Channel types tcu::copy() has conversion kernels for
+	static const TextureFormat::ChannelType s_copyTypes[][2] =
+	{
+		{ TextureFormat::UNORM_INT8,		TextureFormat::UNORM_INT8		},
+		{ TextureFormat::UNORM_INT16,		TextureFormat::UNORM_INT16		},
+		{ TextureFormat::SIGNED_INT8,		TextureFormat::SIGNED_INT8		},
+		{ TextureFormat::SIGNED_INT16,		TextureFormat::SIGNED_INT16		},
+		{ TextureFormat::SIGNED_INT32,		TextureFormat::SIGNED_INT32		},
+		{ TextureFormat::UNSIGNED_INT8,		TextureFormat::UNSIGNED_INT8	},
+		{ TextureFormat::UNSIGNED_INT16,	TextureFormat::UNSIGNED_INT16	},
+		{ TextureFormat::UNSIGNED_INT32,	TextureFormat::UNSIGNED_INT32	},
+		{ TextureFormat::FLOAT,				TextureFormat::FLOAT			},
+		{ TextureFormat::UNORM_INT8,		TextureFormat::FLOAT			},
+		{ TextureFormat::UNORM_INT16,		TextureFormat::FLOAT			},
+	};
+	de::MovePtr<tcu::TestCaseGroup>	group	(new tcu::TestCaseGroup(testCtx, "texture_copy", "tcu::copy() conversion tests"));
+
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_copyTypes); ndx++)
+		group->addChild(new CopyConversionCase(testCtx, s_copyTypes[ndx][0], s_copyTypes[ndx][1]));
+
+	return group.release();
+}
+
 } // dit
@@ -30,6 +30,7 @@ namespace dit
 {
 
 tcu::TestCaseGroup*	createTextureFormatTests	(tcu::TestContext& testCtx);
+tcu::TestCaseGroup*	createTextureCopyTests		(tcu::TestContext& testCtx);
 
 } // dit
 
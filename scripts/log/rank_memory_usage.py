@@ -0,0 +1,75 @@
+# -*- coding: utf-8 -*-
+
+#-------------------------------------------------------------------------
+# drawElements Quality Program utilities
+# --------------------------------------
+#
+# Copyright 2016 The Android Open Source Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#-------------------------------------------------------------------------
+
+# Ranks test cases by memory statistics logged with --deqp-memory-stats=enable
+
+import re
+import sys
+from log_parser import BatchResultParser
+
+MEMORY_KEYS = [
+	"HostPeakMemoryDelta",
+	"HostAllocations",
+	"DeviceAllocations",
+	"DeviceMemoryAllocated",
+	"DeviceMemoryPeak",
+	]
+
+# Crashed cases have truncated XML, so values are matched directly from text
+NUMBER_PATTERN = re.compile(r'<Number Name="([^"]+)"[^>]*>(-?[0-9]+)</Number>')
+
+def getMemoryStats (result):
+	stats = {}
+	for name, value in NUMBER_PATTERN.findall(result.log):
+		if name in MEMORY_KEYS:
+			stats[name] = int(value)
+	return stats
+
+def rankMemoryUsage (filename, key, maxCases):
+	parser	= BatchResultParser()
+	results	= parser.parseFile(filename)
+	ranked	= []
+
+	for result in results:
+		stats = getMemoryStats(result)
+		if key in stats:
+			ranked.append((stats[key], result.name, result.statusCode))
+
+	ranked.sort(reverse=True)
+
+	for value, name, statusCode in ranked[:maxCases]:
+		print "%s,%d,%s" % (name, value, statusCode)
+
+if __name__ == "__main__":
+	if len(sys.argv) < 2 or len(sys.argv) > 4:
+		print "%s: [qpa log] [key (default: HostPeakMemoryDelta)] [max cases]" % sys.argv[0]
+		print "  keys: %s" % ", ".join(MEMORY_KEYS)
+		sys.exit(-1)
+
+	key			= sys.argv[2] if len(sys.argv) >= 3 else MEMORY_KEYS[0]
+	maxCases	= int(sys.argv[3]) if len(sys.argv) >= 4 else None
+
+	if not key in MEMORY_KEYS:
+		print "Unknown key '%s'" % key
+		sys.exit(-1)
+
+	rankMemoryUsage(sys.argv[1], key, maxCases)
@@ -32,14 +32,22 @@ class LogSpec:
 def enum (group):
 	return lambda name: "get%sStr(%s)" % (group, name)
 
+class ArrayPrint:
+	def __init__ (self, template, size):
+		self.template	= template
+		self.size		= size
+
+	def __call__ (self, name):
+		return self.template % {"name": name, "size": self.size}
+
 def pointer (size):
-	return lambda name: "getPointerStr(%s, %s)" % (name, size)
+	return ArrayPrint("getPointerStr(%(name)s, %(size)s)", size)
 
 def enumPointer (group, size):
-	return lambda name: "getEnumPointerStr(%(name)s, %(size)s, %(nameFunc)s)" % {"name": name, "size": size, "nameFunc": ("get%sName" % group)}
+	return ArrayPrint("getEnumPointerStr(%%(name)s, %%(size)s, get%sName)" % group, size)
 
 def booleanPointer (size):
-	return lambda name: "getBooleanPointerStr(%s, %s)" % (name, size)
+	return ArrayPrint("getBooleanPointerStr(%(name)s, %(size)s)", size)
 
 def textureUnit (name):
 	return "getTextureUnitStr(%s)" % name
@@ -380,6 +388,47 @@ def getVarDefaultPrint (type, varName):
 	else:
 		return varName
 
+def isPointerType (type):
+	return type.endswith('*')
+
+def isStringType (type):
+	return re.match(r'^const +GLchar *\*$', type) != None
+
+def getPointeeType (type):
+	return glwPrefix(re.sub(r'^const +', '', type[:-1].strip()))
+
+class DeferredPrint:
+	def __init__ (self, printExpr, capture = None, readDecl = None):
+		self.printExpr	= printExpr		# Expression used when formatting captured call
+		self.capture	= capture		# Expression appended to trace record, None if value is printed from arguments
+		self.readDecl	= readDecl		# Declaration reading captured data from trace record
+
+# In deferred mode everything that would be read through a pointer is copied
+# into the trace record when the call is made. All other prints are evaluated
+# from the raw argument values when the trace is formatted.
+def getDeferredPrint (printFunc, type, name, localName):
+	if isinstance(printFunc, ArrayPrint):
+		elemType = getPointeeType(type)
+		return DeferredPrint(printExpr	= printFunc.template % {"name": localName + ".arr", "size": localName + ".size"},
+							 capture	= "traceArray(%s, %s)" % (name, printFunc.size),
+							 readDecl	= "const tcu::Format::ArrayPointer<%s> %s = trace.getArray<%s>();" % (elemType, localName, elemType))
+	elif printFunc == stringVal or (printFunc == None and isStringType(type)):
+		return DeferredPrint(printExpr	= stringVal(localName),
+							 capture	= "traceString(%s)" % name,
+							 readDecl	= "const char* %s = trace.getString();" % localName)
+	elif printFunc != None and isPointerType(type) and printFunc not in (voidPointer, fnPointer):
+		# Custom print dereferencing the pointer, format at call time
+		return DeferredPrint(printExpr	= localName,
+							 capture	= "traceText(%s)" % printFunc(name),
+							 readDecl	= "const char* %s = trace.getString();" % localName)
+	elif printFunc != None:
+		return DeferredPrint(printFunc(name))
+	else:
+		return DeferredPrint(getVarDefaultPrint(type, name))
+
+def getFormatFuncName (command):
+	return "format%s%s" % (command.name[0].upper(), command.name[1:])
+
 def commandLogWrapperMemberDef (command):
 	src = ""
 	try:
@@ -387,6 +436,54 @@ def commandLogWrapperMemberDef (command):
 	except KeyError:
 		logSpec = None
 
+	isVoid		= command.type == 'void'
+	callPrints	= []
+	outPrints	= []
+	returnPrint	= None
+
+	for paramNdx, param in enumerate(command.params):
+		printFunc = logSpec.argInPrints[paramNdx] if logSpec and paramNdx in logSpec.argInPrints else None
+		callPrints.append(getDeferredPrint(printFunc, param.type, param.name, param.name + "Data"))
+
+	if logSpec:
+		for paramNdx, param in enumerate(command.params):
+			if paramNdx in logSpec.argOutPrints:
+				outPrints.append((param.name, getDeferredPrint(logSpec.argOutPrints[paramNdx], param.type, param.name, param.name + "Result")))
+
+	if not isVoid:
+		returnPrint = getDeferredPrint(logSpec.returnPrint if logSpec else None, command.type, "returnValue", "returnValueData")
+
+	# Formatter for deferred call records
+	deferredPrints	= callPrints + [p for n, p in outPrints] + ([returnPrint] if returnPrint else [])
+	valueExprs		= [p.printExpr for p in deferredPrints if p.capture == None]
+	capturedArgs	= [p for p in command.params if any(re.search(r'\b%s\b' % p.name, e) for e in valueExprs)]
+	captureReturn	= not isVoid and returnPrint.capture == None
+
+	src += "\n"
+	src += "static void %s (std::ostream& str, CallTraceReader& trace)\n{\n" % getFormatFuncName(command)
+
+	for param in capturedArgs:
+		src += "\t%s = trace.get<%s>();\n" % (glwPrefix(param.declaration), glwPrefix(param.type))
+	if captureReturn:
+		src += "\t%s returnValue = trace.get<%s>();\n" % (glwPrefix(command.type), glwPrefix(command.type))
+	for p in deferredPrints:
+		if p.readDecl:
+			src += "\t%s\n" % p.readDecl
+	if len(capturedArgs) == 0 and not captureReturn and not any(p.readDecl for p in deferredPrints):
+		src += "\tDE_UNREF(trace);\n"
+
+	src += "\tstr << \"%s(\"" % command.name
+	for paramNdx, p in enumerate(callPrints):
+		if paramNdx > 0:
+			src += " << \", \""
+		src += " << %s" % p.printExpr
+	src += " << \");\";\n"
+	for name, p in outPrints:
+		src += "\tstr << \"\\n// %s = \" << %s;\n" % (name, p.printExpr)
+	if returnPrint:
+		src += "\tstr << \"\\n// \" << %s << \" returned\";\n" % returnPrint.printExpr
+	src += "}\n"
+
 	src += "\n"
 	src += "%s CallLogWrapper::%s (%s)\n{\n" % (glwPrefix(command.type), command.name, prefixedParams(command))
 
@@ -403,12 +500,11 @@ def commandLogWrapperMemberDef (command):
 
 	callPrintItems += ["\");\"", "TestLog::EndMessage"]
 
-	src += "\tif (m_enableLog)\n"
+	src += "\tif (m_enableLog && !m_callTrace)\n"
 	src += "\t\tm_log << TestLog::Message << %s;\n" % " << ".join(callPrintItems)
 
 	callStr = "m_gl.%s(%s)" % (getFunctionMemberName(command.name), ", ".join([p.name for p in command.params]))
 
-	isVoid	= command.type == 'void'
 	if isVoid:
 		src += "\t%s;\n" % callStr
 	else:
@@ -416,7 +512,7 @@ def commandLogWrapperMemberDef (command):
 
 	if logSpec and len(logSpec.argOutPrints) > 0:
 		# Print values returned in pointers
-		src += "\tif (m_enableLog)\n"
+		src += "\tif (m_enableLog && !m_callTrace)\n"
 		printouts = ""
 		numPrintouts = 0
 
@@ -438,12 +534,23 @@ def commandLogWrapperMemberDef (command):
 
 	if not isVoid:
 		# Print return value
-		returnPrint = getVarDefaultPrint(command.type, "returnValue")
+		returnPrintExpr = getVarDefaultPrint(command.type, "returnValue")
 		if logSpec and logSpec.returnPrint:
-			returnPrint = logSpec.returnPrint("returnValue")
+			returnPrintExpr = logSpec.returnPrint("returnValue")
+
+		src += "\tif (m_enableLog && !m_callTrace)\n"
+		src += "\t\tm_log << TestLog::Message << \"// \" << %s << \" returned\" << TestLog::EndMessage;\n" % returnPrintExpr
+
+	# Append call record to deferred trace
+	traceItems = [p.name for p in capturedArgs]
+	if captureReturn:
+		traceItems.append("returnValue")
+	traceItems += [p.capture for p in deferredPrints if p.capture != None]
 
-		src += "\tif (m_enableLog)\n"
-		src += "\t\tm_log << TestLog::Message << \"// \" << %s << \" returned\" << TestLog::EndMessage;\n" % returnPrint
+	src += "\tif (m_enableLog && m_callTrace)\n"
+	src += "\t\tm_callTrace->beginRecord(%s) << %s;\n" % (getFormatFuncName(command), " << ".join(traceItems + ["CallTrace::EndRecord"]))
+
+	if not isVoid:
 		src += "\treturn returnValue;\n"
 
 	src += "}"
@@ -29,4 +29,9 @@ set(TCUTIL_PLATFORM_SRCS
 	null/tcuNullRenderContext.hpp
 	null/tcuNullContextFactory.cpp
 	null/tcuNullContextFactory.hpp
+	null/tcuNullReferenceRenderContext.cpp
+	null/tcuNullReferenceRenderContext.hpp
 	)
+
+# Reference render context is built on top of sglr::ReferenceContext
+set(TCUTIL_PLATFORM_LIBS glutil-sglr)